@@ -13,6 +13,7 @@
 #include "hal_core/utilities/log.h"
 #include "hal_core/utilities/program_arguments.h"
 #include "hal_core/utilities/program_options.h"
+#include "hal_core/utilities/trace.h"
 #include "hal_core/utilities/utils.h"
 #include "hal_version.h"
 
@@ -26,8 +27,40 @@
 
 using namespace hal;
 
+std::filesystem::path trace_file;
+bool print_trace_summary = false;
+
+void finish_trace()
+{
+    if (!trace::is_enabled())
+    {
+        return;
+    }
+    trace::set_enabled(false);
+
+    if (!trace_file.empty())
+    {
+        if (trace::write_chrome_trace(trace_file))
+        {
+            log_info("core", "wrote trace to '{}'.", trace_file.string());
+        }
+        else
+        {
+            log_error("core", "could not write trace to '{}'.", trace_file.string());
+        }
+    }
+
+    if (print_trace_summary)
+    {
+        std::cout << trace::get_summary_table() << std::endl;
+    }
+}
+
 int cleanup(int return_code = SUCCESS)
 {
+    // span names recorded by plugins become invalid once the plugins are unloaded
+    finish_trace();
+
     if (!plugin_manager::unload_all_plugins())
     {
         return ERROR;
@@ -52,6 +85,8 @@ void initialize_cli_options(ProgramOptions& cli_options)
     generic_options.add({"-e", "--empty-project"}, "create an empty project (requires gate library to be specified)");
     generic_options.add("--volatile-mode", "prevent HAL from creating a .hal progress file (e.g., for cluster use)");
     generic_options.add("--no-log", "prevent hal from creating a .log file");
+    generic_options.add("--trace", "record profiling spans and write them to the given file in Chrome trace-event JSON format", {ProgramOptions::A_REQUIRED_PARAMETER});
+    generic_options.add("--trace-summary", "record profiling spans and print a summary table on exit");
 
     /* initialize netlist parser options */
     generic_options.add(netlist_parser_manager::get_cli_options());
@@ -93,6 +128,14 @@ int main(int argc, const char* argv[])
         lm->set_format_pattern("[%d.%m.%Y %H:%M:%S] [%n] [%l] %v");
     }
 
+    /* initialize tracing */
+    if (args.is_option_set("--trace"))
+    {
+        trace_file = std::filesystem::path(args.get_parameter("--trace"));
+    }
+    print_trace_summary = args.is_option_set("--trace-summary");
+    trace::set_enabled(!trace_file.empty() || print_trace_summary);
+
     /* initialize plugin manager */
     plugin_manager::add_existing_options_description(cli_options);
 
@@ -0,0 +1,38 @@
+#include "hal_core/utilities/log.h"
+
+#include <benchmark/benchmark.h>
+
+int main(int argc, char** argv)
+{
+    // silence all channels written to by the benchmarked code, otherwise logging dominates the measurements
+    hal::LogManager* lm = hal::LogManager::get_instance();
+    for (const auto& channel : {"core",
+                                "event",
+                                "gate",
+                                "gate_library",
+                                "gate_library_manager",
+                                "gate_library_parser",
+                                "gate_type",
+                                "grouping",
+                                "module",
+                                "net",
+                                "netlist",
+                                "netlist_parser",
+                                "netlist_persistent",
+                                "netlist_utils",
+                                "verilog_parser",
+                                "vhdl_parser"})
+    {
+        lm->add_channel(channel, {}, "off");
+    }
+    lm->deactivate_all_channels();
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,486 @@
+#include "bench_utils.h"
+
+#include "hal_core/netlist/endpoint.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ff_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/init_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/state_component.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist_factory.h"
+#include "hal_core/utilities/utils.h"
+
+#include <random>
+#include <sstream>
+#include <unistd.h>
+
+namespace hal
+{
+    namespace bench_utils
+    {
+        namespace
+        {
+            // number of most recently created nets that the second input of a random DAG gate is drawn from, keeps the DAG deep rather than wide
+            constexpr u32 DAG_WINDOW_SIZE = 256;
+
+            // distance between two flip-flops of a random sequential circuit
+            constexpr u32 FF_INTERVAL = 16;
+
+            std::unique_ptr<GateLibrary> create_gate_library()
+            {
+                auto lib = std::make_unique<GateLibrary>("hal_bench.hgl", "HAL_BENCH_GATE_LIBRARY");
+
+                const std::vector<std::tuple<std::string, GateTypeProperty, std::vector<std::string>, std::string>> combinational = {
+                    {"BUF", GateTypeProperty::c_buffer, {"I"}, "I"},
+                    {"INV", GateTypeProperty::c_inverter, {"I"}, "!I"},
+                    {"AND2", GateTypeProperty::c_and, {"I0", "I1"}, "I0 & I1"},
+                    {"OR2", GateTypeProperty::c_or, {"I0", "I1"}, "I0 | I1"},
+                    {"XOR2", GateTypeProperty::c_xor, {"I0", "I1"}, "I0 ^ I1"},
+                };
+
+                for (const auto& [name, property, inputs, function] : combinational)
+                {
+                    GateType* gt = lib->create_gate_type(name, {GateTypeProperty::combinational, property});
+                    for (const auto& input : inputs)
+                    {
+                        gt->create_pin(input, PinDirection::input);
+                    }
+                    gt->create_pin("O", PinDirection::output);
+                    gt->add_boolean_function("O", BooleanFunction::from_string(function).get());
+                }
+
+                GateType* dff = lib->create_gate_type("DFF",
+                                                      {GateTypeProperty::sequential, GateTypeProperty::ff},
+                                                      GateTypeComponent::create_ff_component(GateTypeComponent::create_state_component(GateTypeComponent::create_init_component("generic", {"INIT"}), "IQ", "IQN"),
+                                                                                             BooleanFunction::from_string("D").get(),
+                                                                                             BooleanFunction::from_string("CLK").get()));
+                dff->create_pin("CLK", PinDirection::input, PinType::clock);
+                dff->create_pin("D", PinDirection::input, PinType::data);
+                dff->create_pin("Q", PinDirection::output, PinType::state);
+                dff->create_pin("QN", PinDirection::output, PinType::neg_state);
+                dff->add_boolean_function("Q", BooleanFunction::from_string("IQ").get());
+                dff->add_boolean_function("QN", BooleanFunction::from_string("IQN").get());
+
+                return lib;
+            }
+
+            // hands out consecutive gate and net names that are valid identifiers in Verilog and VHDL
+            class NameGenerator
+            {
+            public:
+                std::string next_gate()
+                {
+                    return "g_" + std::to_string(m_gate_index++);
+                }
+
+                std::string next_net()
+                {
+                    return "n_" + std::to_string(m_net_index++);
+                }
+
+            private:
+                u32 m_gate_index = 0;
+                u32 m_net_index  = 0;
+            };
+
+            Gate* create_driven_gate(Netlist* nl, NameGenerator& names, const std::string& type, const std::vector<std::pair<std::string, Net*>>& inputs, Net*& output)
+            {
+                Gate* gate = nl->create_gate(nl->get_gate_library()->get_gate_type_by_name(type), names.next_gate());
+                for (const auto& [pin, net] : inputs)
+                {
+                    net->add_destination(gate, pin);
+                }
+                output = nl->create_net(names.next_net());
+                output->add_source(gate, type == "DFF" ? "Q" : "O");
+                return gate;
+            }
+
+            void mark_dangling_nets_as_outputs(Netlist* nl)
+            {
+                for (Net* net : nl->get_nets())
+                {
+                    if (net->get_num_of_destinations() == 0 && !net->is_global_input_net())
+                    {
+                        nl->mark_global_output_net(net);
+                    }
+                }
+            }
+
+            void create_hierarchy_level(Netlist* nl, NameGenerator& names, Module* parent, Net* input, u32 level, u32 depth, u32 fanout, u32 gates_per_module)
+            {
+                std::vector<Gate*> gates;
+                Net* current = input;
+                for (u32 i = 0; i < gates_per_module; i++)
+                {
+                    Net* next = nullptr;
+                    gates.push_back(create_driven_gate(nl, names, "BUF", {{"I", current}}, next));
+                    current = next;
+                }
+
+                Module* module = (parent == nullptr) ? nl->get_top_module() : nl->create_module("module_" + std::to_string(nl->get_modules().size()), parent, gates);
+
+                if (level == depth)
+                {
+                    return;
+                }
+
+                for (u32 i = 0; i < fanout; i++)
+                {
+                    create_hierarchy_level(nl, names, module, current, level + 1, depth, fanout, gates_per_module);
+                }
+            }
+        }    // namespace
+
+        const GateLibrary* get_gate_library()
+        {
+            static std::unique_ptr<GateLibrary> gate_library = create_gate_library();
+            return gate_library.get();
+        }
+
+        std::unique_ptr<Netlist> create_random_dag(u32 num_inputs, u32 num_gates, u32 seed)
+        {
+            const std::vector<std::string> types = {"BUF", "INV", "AND2", "OR2", "XOR2"};
+
+            auto nl = netlist_factory::create_netlist(get_gate_library());
+            NameGenerator names;
+            std::mt19937 rng(seed);
+
+            std::vector<Net*> nets;
+            for (u32 i = 0; i < num_inputs; i++)
+            {
+                Net* net = nl->create_net(names.next_net());
+                nl->mark_global_input_net(net);
+                nets.push_back(net);
+            }
+
+            auto pick_net = [&nets, &rng]() {
+                const u32 range = std::min<u32>(nets.size(), DAG_WINDOW_SIZE);
+                return nets[nets.size() - 1 - (rng() % range)];
+            };
+
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                const std::string& type = types[rng() % types.size()];
+                std::vector<std::pair<std::string, Net*>> inputs;
+                if (type == "BUF" || type == "INV")
+                {
+                    inputs = {{"I", nets.back()}};
+                }
+                else
+                {
+                    inputs = {{"I0", nets.back()}, {"I1", pick_net()}};
+                }
+
+                Net* output = nullptr;
+                create_driven_gate(nl.get(), names, type, inputs, output);
+                nets.push_back(output);
+            }
+
+            mark_dangling_nets_as_outputs(nl.get());
+            return nl;
+        }
+
+        std::unique_ptr<Netlist> create_random_sequential_circuit(u32 num_inputs, u32 num_gates, u32 seed)
+        {
+            const std::vector<std::string> types = {"BUF", "INV", "AND2", "OR2", "XOR2"};
+
+            auto nl = netlist_factory::create_netlist(get_gate_library());
+            NameGenerator names;
+            std::mt19937 rng(seed);
+
+            Net* clk = nl->create_net(names.next_net());
+            nl->mark_global_input_net(clk);
+
+            std::vector<Net*> nets;
+            for (u32 i = 0; i < num_inputs; i++)
+            {
+                Net* net = nl->create_net(names.next_net());
+                nl->mark_global_input_net(net);
+                nets.push_back(net);
+            }
+
+            auto pick_net = [&nets, &rng]() {
+                const u32 range = std::min<u32>(nets.size(), DAG_WINDOW_SIZE);
+                return nets[nets.size() - 1 - (rng() % range)];
+            };
+
+            // the data inputs of the flip-flops are connected once all gates exist
+            std::vector<std::pair<Gate*, u32>> ffs;
+            std::vector<Net*> outputs;
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                Net* output = nullptr;
+                if (i % FF_INTERVAL == FF_INTERVAL - 1)
+                {
+                    ffs.push_back({create_driven_gate(nl.get(), names, "DFF", {{"CLK", clk}}, output), i});
+                }
+                else
+                {
+                    const std::string& type = types[rng() % types.size()];
+                    std::vector<std::pair<std::string, Net*>> inputs;
+                    if (type == "BUF" || type == "INV")
+                    {
+                        inputs = {{"I", nets.back()}};
+                    }
+                    else
+                    {
+                        inputs = {{"I0", nets.back()}, {"I1", pick_net()}};
+                    }
+                    create_driven_gate(nl.get(), names, type, inputs, output);
+                }
+                nets.push_back(output);
+                outputs.push_back(output);
+            }
+
+            for (const auto& [ff, index] : ffs)
+            {
+                const u32 first = index + 1 < num_gates ? index + 1 : 0;
+                const u32 range = std::min(num_gates - first, 4 * DAG_WINDOW_SIZE);
+                outputs[first + rng() % range]->add_destination(ff, "D");
+            }
+
+            mark_dangling_nets_as_outputs(nl.get());
+            return nl;
+        }
+
+        std::unique_ptr<Netlist> create_pipelined_datapath(u32 width, u32 num_stages)
+        {
+            auto nl = netlist_factory::create_netlist(get_gate_library());
+            NameGenerator names;
+
+            Net* clk = nl->create_net(names.next_net());
+            nl->mark_global_input_net(clk);
+
+            std::vector<Net*> bits;
+            for (u32 i = 0; i < width; i++)
+            {
+                Net* net = nl->create_net(names.next_net());
+                nl->mark_global_input_net(net);
+                bits.push_back(net);
+            }
+
+            for (u32 stage = 0; stage < num_stages; stage++)
+            {
+                std::vector<Net*> next_bits;
+                for (u32 i = 0; i < width; i++)
+                {
+                    Net* conj = nullptr;
+                    Net* mixed = nullptr;
+                    Net* stored = nullptr;
+                    create_driven_gate(nl.get(), names, "AND2", {{"I0", bits[(i + 1) % width]}, {"I1", bits[(i + 2) % width]}}, conj);
+                    create_driven_gate(nl.get(), names, "XOR2", {{"I0", bits[i]}, {"I1", conj}}, mixed);
+                    create_driven_gate(nl.get(), names, "DFF", {{"CLK", clk}, {"D", mixed}}, stored);
+                    next_bits.push_back(stored);
+                }
+                bits = std::move(next_bits);
+            }
+
+            mark_dangling_nets_as_outputs(nl.get());
+            return nl;
+        }
+
+        std::unique_ptr<Netlist> create_deep_hierarchy(u32 depth, u32 fanout, u32 gates_per_module)
+        {
+            auto nl = netlist_factory::create_netlist(get_gate_library());
+            NameGenerator names;
+
+            Net* input = nl->create_net(names.next_net());
+            nl->mark_global_input_net(input);
+
+            create_hierarchy_level(nl.get(), names, nullptr, input, 0, depth, fanout, gates_per_module);
+
+            mark_dangling_nets_as_outputs(nl.get());
+            return nl;
+        }
+
+        std::string to_verilog(const Netlist* nl)
+        {
+            std::stringstream ss;
+
+            std::vector<std::string> ports;
+            for (const Net* net : nl->get_global_input_nets())
+            {
+                ports.push_back(net->get_name());
+            }
+            for (const Net* net : nl->get_global_output_nets())
+            {
+                ports.push_back(net->get_name());
+            }
+
+            ss << "module top (" << utils::join(", ", ports) << ");" << std::endl;
+            for (const Net* net : nl->get_global_input_nets())
+            {
+                ss << "  input " << net->get_name() << ";" << std::endl;
+            }
+            for (const Net* net : nl->get_global_output_nets())
+            {
+                ss << "  output " << net->get_name() << ";" << std::endl;
+            }
+            for (const Net* net : nl->get_nets())
+            {
+                if (!net->is_global_input_net() && !net->is_global_output_net())
+                {
+                    ss << "  wire " << net->get_name() << ";" << std::endl;
+                }
+            }
+
+            for (const Gate* gate : nl->get_gates())
+            {
+                std::vector<std::string> assignments;
+                for (const Endpoint* ep : gate->get_fan_in_endpoints())
+                {
+                    assignments.push_back("." + ep->get_pin()->get_name() + "(" + ep->get_net()->get_name() + ")");
+                }
+                for (const Endpoint* ep : gate->get_fan_out_endpoints())
+                {
+                    assignments.push_back("." + ep->get_pin()->get_name() + "(" + ep->get_net()->get_name() + ")");
+                }
+                ss << "  " << gate->get_type()->get_name() << " " << gate->get_name() << " (" << utils::join(", ", assignments) << ");" << std::endl;
+            }
+            ss << "endmodule" << std::endl;
+
+            return ss.str();
+        }
+
+        std::string to_vhdl(const Netlist* nl)
+        {
+            std::stringstream ss;
+
+            std::vector<std::string> ports;
+            for (const Net* net : nl->get_global_input_nets())
+            {
+                ports.push_back("    " + net->get_name() + " : in STD_LOGIC");
+            }
+            for (const Net* net : nl->get_global_output_nets())
+            {
+                ports.push_back("    " + net->get_name() + " : out STD_LOGIC");
+            }
+
+            ss << "library IEEE;" << std::endl;
+            ss << "use IEEE.STD_LOGIC_1164.ALL;" << std::endl;
+            ss << "entity top is" << std::endl;
+            ss << "  port (" << std::endl << utils::join(";\n", ports) << std::endl << "  );" << std::endl;
+            ss << "end top;" << std::endl;
+            ss << "architecture STRUCTURE of top is" << std::endl;
+            for (const Net* net : nl->get_nets())
+            {
+                if (!net->is_global_input_net() && !net->is_global_output_net())
+                {
+                    ss << "  signal " << net->get_name() << " : STD_LOGIC;" << std::endl;
+                }
+            }
+            ss << "begin" << std::endl;
+
+            for (const Gate* gate : nl->get_gates())
+            {
+                std::vector<std::string> assignments;
+                for (const Endpoint* ep : gate->get_fan_in_endpoints())
+                {
+                    assignments.push_back(ep->get_pin()->get_name() + " => " + ep->get_net()->get_name());
+                }
+                for (const Endpoint* ep : gate->get_fan_out_endpoints())
+                {
+                    assignments.push_back(ep->get_pin()->get_name() + " => " + ep->get_net()->get_name());
+                }
+                ss << "  " << gate->get_name() << " : " << gate->get_type()->get_name() << " port map (" << utils::join(", ", assignments) << ");" << std::endl;
+            }
+            ss << "end STRUCTURE;" << std::endl;
+
+            return ss.str();
+        }
+
+        std::string create_liberty_library(u32 num_cells)
+        {
+            const std::vector<std::string> functions = {"!A0", "(A0 & A1)", "!(A0 | A1 | A2)", "((A0 & A1) | (A2 & !A3))"};
+
+            std::stringstream table;
+            table << "values (";
+            for (u32 row = 0; row < 7; row++)
+            {
+                std::vector<std::string> entries;
+                for (u32 col = 0; col < 7; col++)
+                {
+                    entries.push_back("0." + std::to_string(100 + row * 7 + col));
+                }
+                table << (row == 0 ? "" : ", \\\n                    ") << "\"" << utils::join(", ", entries) << "\"";
+            }
+            table << ");";
+            const std::string values = table.str();
+
+            std::stringstream ss;
+            ss << "library (HAL_BENCH_LIBERTY) {" << std::endl;
+            ss << "    delay_model : table_lookup;" << std::endl;
+            ss << "    time_unit : \"1ns\";" << std::endl;
+            ss << "    lu_table_template (delay_template_7x7) {" << std::endl;
+            ss << "        variable_1 : input_net_transition;" << std::endl;
+            ss << "        variable_2 : total_output_net_capacitance;" << std::endl;
+            ss << "    }" << std::endl;
+
+            for (u32 i = 0; i < num_cells; i++)
+            {
+                if (i % 8 == 7)
+                {
+                    ss << "    cell (DFF_" << i << ") {" << std::endl;
+                    ss << "        area : 4.5;" << std::endl;
+                    ss << "        ff (IQ, IQN) {" << std::endl;
+                    ss << "            next_state : \"D\";" << std::endl;
+                    ss << "            clocked_on : \"CLK\";" << std::endl;
+                    ss << "        }" << std::endl;
+                    ss << "        pin (CLK) {" << std::endl;
+                    ss << "            direction : input;" << std::endl;
+                    ss << "            clock : true;" << std::endl;
+                    ss << "            capacitance : 0.002;" << std::endl;
+                    ss << "        }" << std::endl;
+                    ss << "        pin (D) {" << std::endl;
+                    ss << "            direction : input;" << std::endl;
+                    ss << "            capacitance : 0.001;" << std::endl;
+                    ss << "        }" << std::endl;
+                    ss << "        pin (Q) {" << std::endl;
+                    ss << "            direction : output;" << std::endl;
+                    ss << "            function : \"IQ\";" << std::endl;
+                    ss << "        }" << std::endl;
+                    ss << "    }" << std::endl;
+                    continue;
+                }
+
+                const u32 num_inputs = (i % functions.size()) + 1;
+                ss << "    cell (CELL_" << i << ") {" << std::endl;
+                ss << "        area : " << num_inputs << ".25;" << std::endl;
+                for (u32 j = 0; j < num_inputs; j++)
+                {
+                    ss << "        pin (A" << j << ") {" << std::endl;
+                    ss << "            direction : input;" << std::endl;
+                    ss << "            capacitance : 0.001;" << std::endl;
+                    ss << "        }" << std::endl;
+                }
+                ss << "        pin (Y) {" << std::endl;
+                ss << "            direction : output;" << std::endl;
+                ss << "            function : \"" << functions.at(num_inputs - 1) << "\";" << std::endl;
+                for (u32 j = 0; j < num_inputs; j++)
+                {
+                    ss << "            timing () {" << std::endl;
+                    ss << "                related_pin : \"A" << j << "\";" << std::endl;
+                    for (const char* table_name : {"cell_rise", "cell_fall"})
+                    {
+                        ss << "                " << table_name << " (delay_template_7x7) {" << std::endl;
+                        ss << "                    index_1 (\"0.01, 0.02, 0.04, 0.08, 0.16, 0.32, 0.64\");" << std::endl;
+                        ss << "                    index_2 (\"0.001, 0.002, 0.004, 0.008, 0.016, 0.032, 0.064\");" << std::endl;
+                        ss << "                    " << values << std::endl;
+                        ss << "                }" << std::endl;
+                    }
+                    ss << "            }" << std::endl;
+                }
+                ss << "        }" << std::endl;
+                ss << "    }" << std::endl;
+            }
+            ss << "}" << std::endl;
+
+            return ss.str();
+        }
+
+        std::filesystem::path get_temp_file(const std::string& file_name)
+        {
+            return std::filesystem::temp_directory_path() / ("hal_bench_" + std::to_string(getpid()) + "_" + file_name);
+        }
+    }    // namespace bench_utils
+}    // namespace hal
@@ -0,0 +1,132 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/netlist.h"
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+namespace hal
+{
+    namespace bench_utils
+    {
+        /**
+         * Get the gate library used by all benchmarks.
+         * It contains the combinational gate types 'BUF', 'INV', 'AND2', 'OR2', and 'XOR2' as well as the flip-flop 'DFF' with pins 'CLK', 'D', 'Q', and 'QN'.
+         * The library is created on first use and lives until the end of the program.
+         *
+         * @returns The benchmark gate library.
+         */
+        const GateLibrary* get_gate_library();
+
+        /**
+         * Create a flat, purely combinational netlist forming a random directed acyclic graph.
+         * The first input of every gate is driven by the output of the previously created gate, so the DAG contains a path through all gates.
+         * Further inputs are driven by randomly chosen global input nets or outputs of recently created gates, all nets without destinations are marked as global outputs.
+         * Gates are named 'g_<index>' and nets 'n_<index>', so the netlist can be written as Verilog or VHDL without escaping.
+         *
+         * @param[in] num_inputs - The number of global input nets.
+         * @param[in] num_gates - The number of gates.
+         * @param[in] seed - The seed of the random number generator, the same seed always yields the same netlist.
+         * @returns The netlist.
+         */
+        std::unique_ptr<Netlist> create_random_dag(u32 num_inputs, u32 num_gates, u32 seed = 42);
+
+        /**
+         * Create a flat sequential netlist whose graph contains cycles of varying length.
+         * The netlist is built like a random DAG, but every sixteenth gate is a 'DFF' whose data input is driven by the output of a randomly chosen later gate.
+         * Since every gate drives the first input of the next one, each flip-flop closes a cycle through all gates in between, so overlapping cycles merge into strongly connected components of different sizes.
+         * All flip-flops share a single clock net.
+         *
+         * @param[in] num_inputs - The number of global input nets excluding the clock.
+         * @param[in] num_gates - The number of gates.
+         * @param[in] seed - The seed of the random number generator, the same seed always yields the same netlist.
+         * @returns The netlist.
+         */
+        std::unique_ptr<Netlist> create_random_sequential_circuit(u32 num_inputs, u32 num_gates, u32 seed = 42);
+
+        /**
+         * Create a pipelined datapath consisting of several stages, each of which mixes neighboring bits through XOR and AND gates and stores the result in a register of 'DFF' gates.
+         * All flip-flops share a single clock net.
+         *
+         * @param[in] width - The bit width of the datapath.
+         * @param[in] num_stages - The number of pipeline stages.
+         * @returns The netlist.
+         */
+        std::unique_ptr<Netlist> create_pipelined_datapath(u32 width, u32 num_stages);
+
+        /**
+         * Create a netlist with a deep module hierarchy.
+         * The hierarchy is a complete tree of the given depth in which every module has `fanout` submodules.
+         * Every module directly contains a chain of `gates_per_module` buffers that is fed by the chain of its parent module.
+         *
+         * @param[in] depth - The depth of the module tree below the top module.
+         * @param[in] fanout - The number of submodules per module.
+         * @param[in] gates_per_module - The number of gates directly contained in each module.
+         * @returns The netlist.
+         */
+        std::unique_ptr<Netlist> create_deep_hierarchy(u32 depth, u32 fanout, u32 gates_per_module);
+
+        /**
+         * Write a flat netlist as structural Verilog.
+         * Net and gate names are expected to be valid identifiers, hierarchy and unconnected pins are ignored.
+         *
+         * @param[in] nl - The netlist.
+         * @returns The Verilog source.
+         */
+        std::string to_verilog(const Netlist* nl);
+
+        /**
+         * Write a flat netlist as structural VHDL.
+         * Net and gate names are expected to be valid identifiers, hierarchy and unconnected pins are ignored.
+         *
+         * @param[in] nl - The netlist.
+         * @returns The VHDL source.
+         */
+        std::string to_vhdl(const Netlist* nl);
+
+        /**
+         * Create the source of a Liberty gate library resembling those shipped with standard cell libraries.
+         * Every eighth cell is a flip-flop, all other cells are combinational cells with up to four inputs, each output of which comes with 7x7 rise and fall delay tables per input pin.
+         *
+         * @param[in] num_cells - The number of cells.
+         * @returns The Liberty source.
+         */
+        std::string create_liberty_library(u32 num_cells);
+
+        /**
+         * Get a path within the temporary directory that is unique to this process.
+         *
+         * @param[in] file_name - The name of the file.
+         * @returns The path.
+         */
+        std::filesystem::path get_temp_file(const std::string& file_name);
+    }    // namespace bench_utils
+}    // namespace hal
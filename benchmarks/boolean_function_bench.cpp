@@ -0,0 +1,107 @@
+#include "hal_core/netlist/boolean_function.h"
+
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace hal
+{
+    namespace
+    {
+        std::string variable(u32 index)
+        {
+            return "v_" + std::to_string(index);
+        }
+
+        // builds a random function in which every variable occurs several times, so that the simplifier has work to do
+        BooleanFunction create_random_function(u32 num_variables, u32 num_operations, u32 seed = 42)
+        {
+            std::mt19937 rng(seed);
+            std::vector<BooleanFunction> terms;
+            for (u32 i = 0; i < num_variables; i++)
+            {
+                terms.push_back(BooleanFunction::Var(variable(i)));
+            }
+
+            for (u32 i = 0; i < num_operations; i++)
+            {
+                const BooleanFunction& a = terms[rng() % terms.size()];
+                const BooleanFunction& b = terms[rng() % terms.size()];
+                switch (rng() % 4)
+                {
+                    case 0:
+                        terms.push_back(a & b);
+                        break;
+                    case 1:
+                        terms.push_back(a | b);
+                        break;
+                    case 2:
+                        terms.push_back(a ^ b);
+                        break;
+                    default:
+                        terms.push_back(~a);
+                        break;
+                }
+            }
+            return terms.back();
+        }
+
+        void BM_boolean_function_from_string(benchmark::State& state)
+        {
+            const std::string expression = create_random_function(state.range(0), 4 * state.range(0)).to_string();
+
+            for (auto _ : state)
+            {
+                benchmark::DoNotOptimize(BooleanFunction::from_string(expression));
+            }
+            state.SetBytesProcessed(state.iterations() * expression.size());
+        }
+        BENCHMARK(BM_boolean_function_from_string)->RangeMultiplier(2)->Range(4, 64);
+
+        void BM_boolean_function_evaluate(benchmark::State& state)
+        {
+            const BooleanFunction bf = create_random_function(state.range(0), 4 * state.range(0));
+
+            std::mt19937 rng(7);
+            std::unordered_map<std::string, BooleanFunction::Value> inputs;
+            for (const auto& var : bf.get_variable_names())
+            {
+                inputs[var] = (rng() & 1) ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO;
+            }
+
+            for (auto _ : state)
+            {
+                benchmark::DoNotOptimize(bf.evaluate(inputs));
+            }
+        }
+        BENCHMARK(BM_boolean_function_evaluate)->RangeMultiplier(2)->Range(4, 64);
+
+        void BM_boolean_function_simplify(benchmark::State& state)
+        {
+            const BooleanFunction bf = create_random_function(state.range(0), 4 * state.range(0));
+
+            for (auto _ : state)
+            {
+                benchmark::DoNotOptimize(bf.simplify());
+            }
+        }
+        BENCHMARK(BM_boolean_function_simplify)->RangeMultiplier(2)->Range(4, 32)->Unit(benchmark::kMillisecond);
+
+        void BM_boolean_function_substitute(benchmark::State& state)
+        {
+            const u32 num_variables  = state.range(0);
+            const BooleanFunction bf = create_random_function(num_variables, 4 * num_variables);
+
+            std::map<std::string, BooleanFunction> substitutions;
+            for (u32 i = 0; i < num_variables; i++)
+            {
+                substitutions.emplace(variable(i), BooleanFunction::Var(variable(i)) & BooleanFunction::Var(variable((i + 1) % num_variables)));
+            }
+
+            for (auto _ : state)
+            {
+                benchmark::DoNotOptimize(bf.substitute(substitutions));
+            }
+        }
+        BENCHMARK(BM_boolean_function_substitute)->RangeMultiplier(2)->Range(4, 64);
+    }    // namespace
+}    // namespace hal
@@ -0,0 +1,124 @@
+#include "bench_utils.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_utils.h"
+
+#include <benchmark/benchmark.h>
+
+#ifdef HAL_BENCH_GRAPH_ALGORITHM
+#include "graph_algorithm/csr_graph.h"
+#include "graph_algorithm/graph_kernels.h"
+#include "graph_algorithm/plugin_graph_algorithm.h"
+#endif
+
+namespace hal
+{
+    namespace
+    {
+#ifdef HAL_BENCH_GRAPH_ALGORITHM
+        void BM_csr_graph(benchmark::State& state)
+        {
+            auto nl = bench_utils::create_random_dag(64, state.range(0));
+
+            for (auto _ : state)
+            {
+                CsrGraph graph(nl.get());
+                benchmark::DoNotOptimize(graph.get_num_edges());
+            }
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+        BENCHMARK(BM_csr_graph)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMillisecond);
+
+        // compare to BM_get_shortest_path
+        void BM_csr_get_shortest_path(benchmark::State& state)
+        {
+            auto nl = bench_utils::create_random_dag(64, state.range(0));
+            const CsrGraph graph(nl.get());
+            const u32 from = graph.get_vertex_of_gate(nl->get_gates().front());
+            const u32 to   = graph.get_vertex_of_gate(nl->get_gates().back());
+
+            for (auto _ : state)
+            {
+                benchmark::DoNotOptimize(graph_kernels::get_shortest_path(graph, from, to));
+            }
+        }
+        BENCHMARK(BM_csr_get_shortest_path)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMillisecond);
+
+        // compare to BM_get_next_sequential_gates, the cones additionally contain the combinational gates in between
+        void BM_csr_get_transitive_cones(benchmark::State& state)
+        {
+            auto nl                      = bench_utils::create_pipelined_datapath(state.range(0), 8);
+            const std::vector<Gate*> ffs = nl->get_gates([](const Gate* g) { return g->get_type()->has_property(GateTypeProperty::ff); });
+            const CsrGraph graph(nl.get());
+            const std::vector<u32> start_vertices = graph.get_vertices_of_gates(ffs);
+
+            for (auto _ : state)
+            {
+                benchmark::DoNotOptimize(graph_kernels::get_transitive_cones(
+                    graph, start_vertices, graph_kernels::Direction::successors, [](const Gate* g) { return g->get_type()->has_property(GateTypeProperty::ff); }));
+            }
+            state.SetItemsProcessed(state.iterations() * ffs.size());
+        }
+        BENCHMARK(BM_csr_get_transitive_cones)->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMillisecond);
+
+        void BM_csr_get_neighborhoods(benchmark::State& state)
+        {
+            auto nl = bench_utils::create_random_dag(64, state.range(0));
+            const CsrGraph graph(nl.get());
+            std::vector<u32> start_vertices(graph.get_num_vertices());
+            for (u32 v = 0; v < start_vertices.size(); v++)
+            {
+                start_vertices[v] = v;
+            }
+
+            for (auto _ : state)
+            {
+                benchmark::DoNotOptimize(graph_kernels::get_neighborhoods(graph, start_vertices, 3));
+            }
+            state.SetItemsProcessed(state.iterations() * start_vertices.size());
+        }
+        BENCHMARK(BM_csr_get_neighborhoods)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMillisecond);
+
+        void BM_csr_get_distances(benchmark::State& state)
+        {
+            auto nl = bench_utils::create_random_dag(64, state.range(0));
+            const CsrGraph graph(nl.get());
+
+            for (auto _ : state)
+            {
+                benchmark::DoNotOptimize(graph_kernels::get_distances(graph, {0}, graph_kernels::Direction::both));
+            }
+            state.SetItemsProcessed(state.iterations() * graph.get_num_vertices());
+        }
+        BENCHMARK(BM_csr_get_distances)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMillisecond);
+
+        // the igraph variant includes the conversion of the netlist, just like the CSR variant includes creating the snapshot
+        // a DAG would be removed entirely by the trimming step of the CSR variant, so both run on a circuit with feedback through flip-flops
+        void BM_igraph_get_strongly_connected_components(benchmark::State& state)
+        {
+            auto nl = bench_utils::create_random_sequential_circuit(64, state.range(0));
+            GraphAlgorithmPlugin plugin;
+
+            for (auto _ : state)
+            {
+                benchmark::DoNotOptimize(plugin.get_strongly_connected_components(nl.get()));
+            }
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+        BENCHMARK(BM_igraph_get_strongly_connected_components)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMillisecond);
+
+        void BM_csr_get_strongly_connected_components(benchmark::State& state)
+        {
+            auto nl = bench_utils::create_random_sequential_circuit(64, state.range(0));
+
+            for (auto _ : state)
+            {
+                const CsrGraph graph(nl.get());
+                benchmark::DoNotOptimize(graph_kernels::get_strongly_connected_components(graph));
+            }
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+        BENCHMARK(BM_csr_get_strongly_connected_components)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMillisecond);
+#endif
+    }    // namespace
+}    // namespace hal
@@ -0,0 +1,170 @@
+#ifdef HAL_BENCH_GUI
+#include "bench_utils.h"
+#include "gui/comment_system/comment_manager.h"
+#include "gui/file_status_manager/file_status_manager.h"
+#include "gui/graph_widget/contexts/graph_context.h"
+#include "gui/graph_widget/graph_context_manager.h"
+#include "gui/graph_widget/graphics_scene.h"
+#include "gui/graph_widget/layouters/graph_layouter.h"
+#include "gui/gui_globals.h"
+#include "gui/netlist_relay/netlist_relay.h"
+#include "gui/selection_relay/selection_relay.h"
+#include "hal_core/netlist/gate.h"
+
+#include <QApplication>
+#include <QImage>
+#include <QPainter>
+#include <benchmark/benchmark.h>
+#include <memory>
+
+namespace hal
+{
+    namespace
+    {
+        // the offscreen platform plugin renders without a display, so the benchmark also runs on build servers
+        // the graph view only needs the global relays and managers, not the main window
+        void ensure_gui()
+        {
+            static int argc     = 1;
+            static char arg0[]  = "hal_bench";
+            static char* argv[] = {arg0, nullptr};
+            static std::unique_ptr<QApplication> app;
+            if (app == nullptr)
+            {
+                qputenv("QT_QPA_PLATFORM", "offscreen");
+                app = std::make_unique<QApplication>(argc, argv);
+
+                gNetlistRelay        = new NetlistRelay();
+                gSelectionRelay      = new SelectionRelay();
+                gFileStatusManager   = new FileStatusManager();
+                gGraphContextManager = new GraphContextManager();
+                gCommentManager      = new CommentManager();
+            }
+        }
+
+        // a graph view of all gates of a random netlist, laid out by the layouter of the GUI
+        class GraphViewFixture
+        {
+        public:
+            explicit GraphViewFixture(u32 num_gates)
+            {
+                ensure_gui();
+
+                gNetlistOwner = bench_utils::create_random_dag(64, num_gates);
+                gNetlist      = gNetlistOwner.get();
+                gNetlistRelay->registerNetlistCallbacks();
+
+                QSet<u32> gates;
+                for (const Gate* g : gNetlist->get_gates())
+                {
+                    gates.insert(g->get_id());
+                }
+
+                mContext = gGraphContextManager->createNewContext("hal_bench");
+                mContext->add({}, gates);
+                while (mContext->sceneUpdateInProgress())
+                {
+                    QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+                }
+            }
+
+            ~GraphViewFixture()
+            {
+                gGraphContextManager->deleteGraphContext(mContext);
+                gNetlistRelay->unregisterNetlistCallbacks();
+                gNetlist = nullptr;
+                gNetlistOwner.reset();
+            }
+
+            GraphicsScene* scene() const
+            {
+                return mContext->scene();
+            }
+
+            GraphContext* context() const
+            {
+                return mContext;
+            }
+
+        private:
+            GraphContext* mContext;
+        };
+
+        // renders one frame per iteration while panning across the scene at full detail, arg 1 selects whether all items stay attached to the scene or GraphicsScene::updateViewportItems only attaches the ones close to the viewport
+        void BM_gui_frame_time(benchmark::State& state)
+        {
+            const bool viewport_only = state.range(1) != 0;
+            GraphViewFixture view(state.range(0));
+            GraphicsScene* scene = view.scene();
+            QImage image(1280, 800, QImage::Format_ARGB32_Premultiplied);
+
+            // all items are attached once the layout has finished
+            const QRectF bounds = scene->graphItemsBoundingRect();
+            const qreal step    = image.width() / 8.0;
+            qreal x             = bounds.left();
+            qreal y             = bounds.top();
+
+            state.counters["items"] = scene->items().size();
+
+            for (auto _ : state)
+            {
+                const QRectF visible(x, y, image.width(), image.height());
+                if (viewport_only)
+                {
+                    scene->updateViewportItems(visible);
+                }
+
+                QPainter painter(&image);
+                scene->render(&painter, QRectF(image.rect()), visible);
+                painter.end();
+                benchmark::ClobberMemory();
+
+                // pan right, wrap around to the next row of screens at the right border
+                x += step;
+                if (x + image.width() > bounds.right())
+                {
+                    x = bounds.left();
+                    y += image.height();
+                    if (y + image.height() > bounds.bottom())
+                    {
+                        y = bounds.top();
+                    }
+                }
+            }
+            state.counters["frames_per_second"] = benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
+        }
+        BENCHMARK(BM_gui_frame_time)->ArgsProduct({{1 << 12, 1 << 14, 1 << 15}, {0, 1}})->ArgNames({"gates", "viewport_only"})->Unit(benchmark::kMillisecond);
+
+        // removes one gate from the view and adds it back per iteration, arg 1 selects whether the view gets updated incrementally or laid out from scratch
+        void BM_gui_layout_update(benchmark::State& state)
+        {
+            GraphViewFixture view(state.range(0));
+            GraphContext* ctx = view.context();
+            ctx->getLayouter()->setIncrementalLayoutEnabled(state.range(1) != 0);
+
+            // a gate in the middle of the view
+            const u32 gate_id = ctx->getLayouter()->boxes().at(ctx->getLayouter()->boxes().size() / 2)->getNode().id();
+
+            for (auto _ : state)
+            {
+                for (bool add : {false, true})
+                {
+                    if (add)
+                    {
+                        ctx->add({}, {gate_id});
+                    }
+                    else
+                    {
+                        ctx->remove({}, {gate_id});
+                    }
+                    while (ctx->sceneUpdateInProgress())
+                    {
+                        QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+                    }
+                }
+            }
+        }
+        BENCHMARK(BM_gui_layout_update)->ArgsProduct({{1 << 12, 1 << 14}, {0, 1}})->ArgNames({"gates", "incremental"})->Unit(benchmark::kMillisecond);
+    }    // namespace
+}    // namespace hal
+#endif
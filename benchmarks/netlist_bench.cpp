@@ -0,0 +1,125 @@
+#include "bench_utils.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist_factory.h"
+
+#include <benchmark/benchmark.h>
+#include <malloc.h>
+
+namespace hal
+{
+    namespace
+    {
+        void BM_create_gate(benchmark::State& state)
+        {
+            const u32 num_gates = state.range(0);
+            GateType* buf       = bench_utils::get_gate_library()->get_gate_type_by_name("BUF");
+
+            for (auto _ : state)
+            {
+                auto nl = netlist_factory::create_netlist(bench_utils::get_gate_library());
+                for (u32 i = 0; i < num_gates; i++)
+                {
+                    benchmark::DoNotOptimize(nl->create_gate(buf, "g_" + std::to_string(i)));
+                }
+
+                state.PauseTiming();
+                nl.reset();
+                state.ResumeTiming();
+            }
+            state.SetItemsProcessed(state.iterations() * num_gates);
+        }
+        BENCHMARK(BM_create_gate)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMillisecond);
+
+        void BM_create_net(benchmark::State& state)
+        {
+            const u32 num_nets = state.range(0);
+
+            for (auto _ : state)
+            {
+                auto nl = netlist_factory::create_netlist(bench_utils::get_gate_library());
+                for (u32 i = 0; i < num_nets; i++)
+                {
+                    benchmark::DoNotOptimize(nl->create_net("n_" + std::to_string(i)));
+                }
+
+                state.PauseTiming();
+                nl.reset();
+                state.ResumeTiming();
+            }
+            state.SetItemsProcessed(state.iterations() * num_nets);
+        }
+        BENCHMARK(BM_create_net)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMillisecond);
+
+        void BM_module_assign_gates(benchmark::State& state)
+        {
+            auto nl = bench_utils::create_random_dag(64, state.range(0));
+            const std::vector<Gate*> gates = nl->get_gates();
+
+            for (auto _ : state)
+            {
+                Module* module = nl->create_module("bench", nl->get_top_module());
+                module->assign_gates(gates);
+
+                state.PauseTiming();
+                nl->delete_module(module);
+                state.ResumeTiming();
+            }
+            state.SetItemsProcessed(state.iterations() * gates.size());
+        }
+        BENCHMARK(BM_module_assign_gates)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMillisecond);
+
+        void BM_module_assign_gates_hierarchy(benchmark::State& state)
+        {
+            auto nl      = bench_utils::create_deep_hierarchy(state.range(0), 2, 8);
+            Module* leaf = nl->get_top_module();
+            while (!leaf->get_submodules().empty())
+            {
+                leaf = leaf->get_submodules().front();
+            }
+            const std::vector<Gate*> gates = nl->get_top_module()->get_gates();
+
+            for (auto _ : state)
+            {
+                Module* module = nl->create_module("bench", leaf);
+                module->assign_gates(gates);
+
+                state.PauseTiming();
+                nl->get_top_module()->assign_gates(gates);
+                nl->delete_module(module);
+                state.ResumeTiming();
+            }
+            state.SetItemsProcessed(state.iterations() * gates.size());
+        }
+        BENCHMARK(BM_module_assign_gates_hierarchy)->DenseRange(2, 10, 4)->Unit(benchmark::kMillisecond);
+
+        // reports the heap memory consumed per gate by data entries as they are typically attached by netlist parsers
+        void BM_data_container_memory(benchmark::State& state)
+        {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+            const u32 num_gates   = 1 << 14;
+            const u32 num_entries = state.range(0);
+            auto nl               = bench_utils::create_random_dag(64, num_gates);
+
+            size_t bytes = 0;
+            for (auto _ : state)
+            {
+                const size_t before = mallinfo2().uordblks;
+                for (Gate* gate : nl->get_gates())
+                {
+                    for (u32 i = 0; i < num_entries; i++)
+                    {
+                        gate->set_data("generic", "key_" + std::to_string(i), "bit_vector", "DEADBEEF");
+                    }
+                }
+                bytes = mallinfo2().uordblks - before;
+            }
+            state.counters["bytes_per_gate"] = (double)bytes / num_gates;
+#else
+            state.SkipWithError("memory statistics require glibc 2.33 or newer");
+#endif
+        }
+        BENCHMARK(BM_data_container_memory)->Arg(1)->Arg(4)->Arg(16)->Iterations(1)->Unit(benchmark::kMillisecond);
+    }    // namespace
+}    // namespace hal
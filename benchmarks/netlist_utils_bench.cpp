@@ -0,0 +1,100 @@
+#include "bench_utils.h"
+#include "hal_core/netlist/decorators/subgraph_netlist_decorator.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/netlist_utils.h"
+
+#include <benchmark/benchmark.h>
+
+namespace hal
+{
+    namespace
+    {
+        void BM_get_next_sequential_gates(benchmark::State& state)
+        {
+            auto nl                      = bench_utils::create_pipelined_datapath(state.range(0), 8);
+            const std::vector<Gate*> ffs = nl->get_gates([](const Gate* g) { return g->get_type()->has_property(GateTypeProperty::ff); });
+
+            for (auto _ : state)
+            {
+                std::unordered_map<u32, std::vector<Gate*>> cache;
+                for (const Gate* ff : ffs)
+                {
+                    benchmark::DoNotOptimize(netlist_utils::get_next_sequential_gates(ff, true, cache));
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * ffs.size());
+        }
+        BENCHMARK(BM_get_next_sequential_gates)->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMillisecond);
+
+        // the path search is recursive, so the netlist size is bounded by the stack depth
+        void BM_get_path(benchmark::State& state)
+        {
+            auto nl                = bench_utils::create_random_dag(64, state.range(0));
+            const Gate* start_gate = nl->get_gates().front();
+
+            for (auto _ : state)
+            {
+                std::unordered_map<u32, std::vector<Gate*>> cache;
+                benchmark::DoNotOptimize(netlist_utils::get_path(start_gate, true, {GateTypeProperty::ff}, cache));
+            }
+        }
+        BENCHMARK(BM_get_path)->RangeMultiplier(4)->Range(1 << 8, 1 << 12)->Unit(benchmark::kMillisecond);
+
+        void BM_get_shortest_path(benchmark::State& state)
+        {
+            auto nl          = bench_utils::create_random_dag(64, state.range(0));
+            Gate* start_gate = nl->get_gates().front();
+            Gate* end_gate   = nl->get_gates().back();
+
+            for (auto _ : state)
+            {
+                benchmark::DoNotOptimize(netlist_utils::get_shortest_path(start_gate, end_gate, true));
+            }
+        }
+        BENCHMARK(BM_get_shortest_path)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMillisecond);
+
+        // subgraphs of 16 consecutive gates each, as extracted for per-register cones or small modules
+        std::vector<std::vector<const Gate*>> get_small_subgraphs(const Netlist* nl, u32 num_subgraphs)
+        {
+            const std::vector<Gate*> gates = nl->get_gates();
+            std::vector<std::vector<const Gate*>> subgraphs;
+            for (u32 i = 0; i < num_subgraphs; i++)
+            {
+                const u32 start = (u32)(((u64)i * gates.size()) / num_subgraphs);
+                subgraphs.emplace_back(gates.begin() + start, gates.begin() + std::min<u32>(start + 16, gates.size()));
+            }
+            return subgraphs;
+        }
+
+        void BM_copy_subgraph_netlist(benchmark::State& state)
+        {
+            auto nl              = bench_utils::create_random_dag(64, state.range(0));
+            const auto subgraphs = get_small_subgraphs(nl.get(), 64);
+            SubgraphNetlistDecorator decorator(*nl);
+
+            for (auto _ : state)
+            {
+                for (const auto& subgraph : subgraphs)
+                {
+                    benchmark::DoNotOptimize(decorator.copy_subgraph_netlist(subgraph));
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * subgraphs.size());
+        }
+        BENCHMARK(BM_copy_subgraph_netlist)->RangeMultiplier(8)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMillisecond);
+
+        void BM_copy_subgraph_netlists(benchmark::State& state)
+        {
+            auto nl              = bench_utils::create_random_dag(64, 1 << 16);
+            const auto subgraphs = get_small_subgraphs(nl.get(), state.range(0));
+            SubgraphNetlistDecorator decorator(*nl);
+
+            for (auto _ : state)
+            {
+                benchmark::DoNotOptimize(decorator.copy_subgraph_netlists(subgraphs));
+            }
+            state.SetItemsProcessed(state.iterations() * subgraphs.size());
+        }
+        BENCHMARK(BM_copy_subgraph_netlists)->RangeMultiplier(8)->Range(1 << 6, 1 << 12)->Unit(benchmark::kMillisecond)->UseRealTime();
+    }    // namespace
+}    // namespace hal
@@ -0,0 +1,87 @@
+#include "bench_utils.h"
+
+#include <benchmark/benchmark.h>
+#include <fstream>
+
+#ifdef HAL_BENCH_VERILOG_PARSER
+#include "verilog_parser/verilog_parser.h"
+#endif
+#ifdef HAL_BENCH_VHDL_PARSER
+#include "vhdl_parser/vhdl_parser.h"
+#endif
+#ifdef HAL_BENCH_LIBERTY_PARSER
+#include "liberty_parser/liberty_parser.h"
+#endif
+
+namespace hal
+{
+    namespace
+    {
+        template<typename Parser>
+        void parse_and_instantiate(benchmark::State& state, const std::string& file_name, std::string (*write)(const Netlist*))
+        {
+            const std::filesystem::path file_path = bench_utils::get_temp_file(file_name);
+            u32 num_gates                         = 0;
+            {
+                auto nl   = bench_utils::create_random_dag(64, state.range(0));
+                num_gates = nl->get_gates().size();
+                std::ofstream(file_path) << write(nl.get());
+            }
+
+            for (auto _ : state)
+            {
+                Parser parser;
+                auto res = parser.parse_and_instantiate(file_path, bench_utils::get_gate_library());
+                if (res.is_error())
+                {
+                    state.SkipWithError(res.get_error().get().c_str());
+                    break;
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * num_gates);
+            state.SetBytesProcessed(state.iterations() * std::filesystem::file_size(file_path));
+
+            std::filesystem::remove(file_path);
+        }
+
+#ifdef HAL_BENCH_VERILOG_PARSER
+        void BM_verilog_parser(benchmark::State& state)
+        {
+            parse_and_instantiate<VerilogParser>(state, "netlist.v", bench_utils::to_verilog);
+        }
+        BENCHMARK(BM_verilog_parser)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMillisecond);
+#endif
+
+#ifdef HAL_BENCH_VHDL_PARSER
+        void BM_vhdl_parser(benchmark::State& state)
+        {
+            parse_and_instantiate<VHDLParser>(state, "netlist.vhd", bench_utils::to_vhdl);
+        }
+        BENCHMARK(BM_vhdl_parser)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMillisecond);
+#endif
+
+#ifdef HAL_BENCH_LIBERTY_PARSER
+        void BM_liberty_parser(benchmark::State& state)
+        {
+            const std::filesystem::path file_path = bench_utils::get_temp_file("library.lib");
+            std::ofstream(file_path) << bench_utils::create_liberty_library(state.range(0));
+
+            for (auto _ : state)
+            {
+                LibertyParser parser;
+                auto res = parser.parse(file_path);
+                if (res.is_error())
+                {
+                    state.SkipWithError(res.get_error().get().c_str());
+                    break;
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+            state.SetBytesProcessed(state.iterations() * std::filesystem::file_size(file_path));
+
+            std::filesystem::remove(file_path);
+        }
+        BENCHMARK(BM_liberty_parser)->RangeMultiplier(4)->Range(1 << 6, 1 << 12)->Unit(benchmark::kMillisecond);
+#endif
+    }    // namespace
+}    // namespace hal
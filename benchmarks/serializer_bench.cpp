@@ -0,0 +1,51 @@
+#include "bench_utils.h"
+#include "hal_core/netlist/persistent/netlist_serializer.h"
+
+#include <benchmark/benchmark.h>
+
+namespace hal
+{
+    namespace
+    {
+        void BM_serialize_to_file(benchmark::State& state)
+        {
+            auto nl                              = bench_utils::create_random_dag(64, state.range(0));
+            const std::filesystem::path hal_file = bench_utils::get_temp_file("serialize.hal");
+
+            for (auto _ : state)
+            {
+                benchmark::DoNotOptimize(netlist_serializer::serialize_to_file(nl.get(), hal_file));
+            }
+            state.SetItemsProcessed(state.iterations() * nl->get_gates().size());
+
+            std::filesystem::remove(hal_file);
+        }
+        BENCHMARK(BM_serialize_to_file)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMillisecond);
+
+        void BM_deserialize_from_file(benchmark::State& state)
+        {
+            const std::filesystem::path hal_file = bench_utils::get_temp_file("deserialize.hal");
+            u32 num_gates                        = 0;
+            {
+                auto nl   = bench_utils::create_random_dag(64, state.range(0));
+                num_gates = nl->get_gates().size();
+                netlist_serializer::serialize_to_file(nl.get(), hal_file);
+            }
+
+            GateLibrary* gate_lib = const_cast<GateLibrary*>(bench_utils::get_gate_library());
+            for (auto _ : state)
+            {
+                auto nl = netlist_serializer::deserialize_from_file(hal_file, gate_lib);
+                if (nl == nullptr)
+                {
+                    state.SkipWithError("could not deserialize netlist");
+                    break;
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * num_gates);
+
+            std::filesystem::remove(hal_file);
+        }
+        BENCHMARK(BM_deserialize_from_file)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMillisecond);
+    }    // namespace
+}    // namespace hal
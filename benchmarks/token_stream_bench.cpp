@@ -0,0 +1,72 @@
+#include "hal_core/utilities/token_stream.h"
+
+#include <benchmark/benchmark.h>
+
+namespace hal
+{
+    namespace
+    {
+        // tokens of structural Verilog instances 'TYPE g_<i> (.I0(n_<i>), .I1(n_<i+1>), .O(n_<i+2>));'
+        std::vector<Token<std::string>> create_instance_tokens(u32 num_instances)
+        {
+            std::vector<Token<std::string>> tokens;
+            for (u32 i = 0; i < num_instances; i++)
+            {
+                tokens.emplace_back(i, "AND2");
+                tokens.emplace_back(i, "g_" + std::to_string(i));
+                tokens.emplace_back(i, "(");
+                const std::vector<std::string> pins = {"I0", "I1", "O"};
+                for (u32 j = 0; j < pins.size(); j++)
+                {
+                    if (j != 0)
+                    {
+                        tokens.emplace_back(i, ",");
+                    }
+                    tokens.emplace_back(i, ".");
+                    tokens.emplace_back(i, pins[j]);
+                    tokens.emplace_back(i, "(");
+                    tokens.emplace_back(i, "n_instance_net_" + std::to_string(i + j));
+                    tokens.emplace_back(i, ")");
+                }
+                tokens.emplace_back(i, ")");
+                tokens.emplace_back(i, ";");
+            }
+            return tokens;
+        }
+
+        // extracts statement, port list, and port assignments in the same nested manner as the HDL parsers do
+        void BM_token_stream_nested_extraction(benchmark::State& state)
+        {
+            const TokenStream<std::string> stream(create_instance_tokens(state.range(0)), {"(", "["}, {")", "]"});
+
+            for (auto _ : state)
+            {
+                TokenStream<std::string> ts = stream;
+                u64 num_ports               = 0;
+                while (ts.remaining() > 0)
+                {
+                    TokenStream<std::string> statement = ts.extract_until(";");
+                    ts.consume(";", true);
+
+                    statement.consume(2);
+                    statement.consume("(", true);
+                    TokenStream<std::string> port_list = statement.extract_until(")");
+                    while (port_list.remaining() > 0)
+                    {
+                        TokenStream<std::string> port = port_list.extract_until(",");
+                        port_list.consume(",");
+                        port.consume(".", true);
+                        benchmark::DoNotOptimize(port.consume().string.size());
+                        port.consume("(", true);
+                        TokenStream<std::string> assignment = port.extract_until(")");
+                        benchmark::DoNotOptimize(assignment.join("").string.size());
+                        num_ports++;
+                    }
+                }
+                benchmark::DoNotOptimize(num_ports);
+            }
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+        BENCHMARK(BM_token_stream_nested_extraction)->RangeMultiplier(8)->Range(1 << 10, 1 << 19)->Unit(benchmark::kMillisecond);
+    }    // namespace
+}    // namespace hal
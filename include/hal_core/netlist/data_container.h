@@ -28,13 +28,17 @@
 #include "hal_core/defines.h"
 
 #include <map>
+#include <string>
 #include <tuple>
 #include <vector>
 
 namespace hal
 {
     /**
-     * Container to hold data that is associated with an entity.
+     * Container to hold data that is associated with an entity.<br>
+     * Data categories, keys, and types are interned, i.e., every distinct string is stored only once for all data containers.
+     * The entries of a container are kept in a vector sorted by category and key.
+     * Values of type `integer` and `bit_vector` are stored as integers whenever they can be restored to the exact same string.
      *
      * @ingroup netlist
      */
@@ -106,11 +110,19 @@ namespace hal
         bool delete_data(const std::string& category, const std::string& key, const bool log_with_info_level = false);
 
         /**
-         * Get a map from ((1) category, (2) key) to ((1) type, (2) value) containing all stored data entries.
+         * Get a map from ((1) category, (2) key) to ((1) type, (2) value) containing all stored data entries.<br>
+         * The map is assembled on every call.
          *
          * @returns The stored data as a map.
          */
-        const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& get_data_map() const;
+        std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> get_data_map() const;
+
+        /**
+         * Get the number of stored data entries.
+         *
+         * @returns The number of data entries.
+         */
+        u32 get_num_data_entries() const;
 
         /**
          * Overwrite the existing data with a new map from ((1) category, (2) key) to ((1) type, (2) value).
@@ -119,7 +131,49 @@ namespace hal
          */
         void set_data_map(const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& map);
 
+        /**
+         * Overwrite the existing data with a copy of the data stored in another data container.<br>
+         * The entries are copied as they are, so no map is assembled and no strings are interned again.
+         *
+         * @param[in] other - The data container to copy the data from.
+         */
+        void copy_data_from(const DataContainer& other);
+
     protected:
-        std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> m_data;
+        /**
+         * Called right before the stored data is modified.
+         * Does nothing by default.
+         */
+        virtual void notify_before_update();
+
+        /**
+         * Called whenever the stored data has been modified.
+         * Does nothing by default.
+         */
+        virtual void notify_updated();
+
+        struct DataEntry
+        {
+            enum class Encoding : u8
+            {
+                string,
+                integer,
+                hex_upper,
+                hex_lower
+            };
+
+            const std::string* category;
+            const std::string* key;
+            const std::string* type;
+            Encoding encoding;
+            u8 num_digits;
+            u64 int_value;
+            std::string str_value;
+
+            bool operator==(const DataEntry& other) const;
+            std::string get_value() const;
+        };
+
+        std::vector<DataEntry> m_data;
     };
 }    // namespace hal
@@ -44,6 +44,7 @@ namespace hal
 
         /**
          * Get a deep copy of a netlist subgraph including all of its gates and nets, but excluding modules and groupings.
+         * Only the nets connected to the subgraph gates are copied, so that the runtime depends on the size of the subgraph rather than the size of the netlist.
          * 
          * @param[in] subgraph_gates - The gates making up the subgraph that shall be copied from the netlist.
          * @return The copied subgraph netlist on success, an error otherwise.
@@ -66,6 +67,28 @@ namespace hal
          */
         Result<std::unique_ptr<Netlist>> copy_subgraph_netlist(const Module* subgraph_module) const;
 
+        /**
+         * Get deep copies of multiple netlist subgraphs including all of their gates and nets, but excluding modules and groupings.
+         * The subgraphs are copied in parallel, each copy being equal to the result of `copy_subgraph_netlist` for the respective subgraph.
+         * The netlist must not be modified while the subgraphs are copied.
+         * 
+         * @param[in] subgraphs - The subgraphs that shall be copied from the netlist, each given by the gates making up the subgraph.
+         * @param[in] num_threads - The number of threads to use. Defaults to `0`, which uses as many threads as there are hardware threads.
+         * @return The copied subgraph netlists in the order of the given subgraphs on success, an error otherwise.
+         */
+        Result<std::vector<std::unique_ptr<Netlist>>> copy_subgraph_netlists(const std::vector<std::vector<const Gate*>>& subgraphs, u32 num_threads = 0) const;
+
+        /**
+         * Get deep copies of multiple netlist subgraphs including all of their gates and nets, but excluding modules and groupings.
+         * The subgraphs are copied in parallel, each copy being equal to the result of `copy_subgraph_netlist` for the respective subgraph.
+         * The netlist must not be modified while the subgraphs are copied.
+         * 
+         * @param[in] subgraph_modules - The modules making up the subgraphs that shall be copied from the netlist.
+         * @param[in] num_threads - The number of threads to use. Defaults to `0`, which uses as many threads as there are hardware threads.
+         * @return The copied subgraph netlists in the order of the given modules on success, an error otherwise.
+         */
+        Result<std::vector<std::unique_ptr<Netlist>>> copy_subgraph_netlists(const std::vector<const Module*>& subgraph_modules, u32 num_threads = 0) const;
+
         /**
          * Get the combined Boolean function of a subgraph of combinational gates starting at the source of the provided subgraph output net.
          * The variables of the resulting Boolean function are created from the subgraph input nets using `BooleanFunctionNetDecorator::get_boolean_variable`.
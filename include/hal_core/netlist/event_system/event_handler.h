@@ -29,6 +29,10 @@
 #include "hal_core/utilities/enums.h"
 
 #include <iostream>
+#include <memory>
+#include <unordered_map>
+#include <variant>
+#include <vector>
 
 namespace hal
 {
@@ -142,6 +146,72 @@ namespace hal
     template<>
     std::map<GroupingEvent::event, std::string> EnumStrings<GroupingEvent::event>::data;
 
+    /**
+     * A batch of coalesced events as delivered to batch callbacks.<br>
+     * The events are stored in the order in which they occurred.
+     * Repeated identical events of an object are only stored once, at the position of their first occurrence, unless an event undoing them occurred in between.
+     * Assigning an object to a module or grouping, adding a submodule, or marking a global gate or net is dropped along with its removal if it is undone within the batch.
+     * Events delimiting a sequence of events, such as `ModuleEvent::event::gates_assign_begin`, are never coalesced.
+     * All objects referenced by the events of a batch are guaranteed to be alive while the batch is delivered, including objects that have been removed from the netlist in the meantime.
+     */
+    struct EventBatch
+    {
+        /**
+         * A single event together with the affected object and its associated data.
+         */
+        template<typename E, typename T>
+        struct Event
+        {
+            E event;
+            T* object;
+            u32 associated_data;
+        };
+
+        using Entry = std::variant<Event<NetlistEvent::event, Netlist>, Event<ModuleEvent::event, Module>, Event<GateEvent::event, Gate>, Event<NetEvent::event, Net>, Event<GroupingEvent::event, Grouping>>;
+
+        std::vector<Entry> events;
+        u32 num_events = 0;    ///< number of events before coalescing
+
+        /**
+         * Check whether the batch does not contain any events.
+         *
+         * @returns True if the batch is empty, false otherwise.
+         */
+        NETLIST_API bool empty() const;
+
+        /**
+         * Get the IDs of all modules affected by the given event, compressed into ranges of consecutive IDs.
+         *
+         * @param[in] ev - The event.
+         * @returns The sorted first and last IDs of the ranges.
+         */
+        NETLIST_API std::vector<std::pair<u32, u32>> get_id_ranges(ModuleEvent::event ev) const;
+
+        /**
+         * Get the IDs of all gates affected by the given event, compressed into ranges of consecutive IDs.
+         *
+         * @param[in] ev - The event.
+         * @returns The sorted first and last IDs of the ranges.
+         */
+        NETLIST_API std::vector<std::pair<u32, u32>> get_id_ranges(GateEvent::event ev) const;
+
+        /**
+         * Get the IDs of all nets affected by the given event, compressed into ranges of consecutive IDs.
+         *
+         * @param[in] ev - The event.
+         * @returns The sorted first and last IDs of the ranges.
+         */
+        NETLIST_API std::vector<std::pair<u32, u32>> get_id_ranges(NetEvent::event ev) const;
+
+        /**
+         * Get the IDs of all groupings affected by the given event, compressed into ranges of consecutive IDs.
+         *
+         * @param[in] ev - The event.
+         * @returns The sorted first and last IDs of the ranges.
+         */
+        NETLIST_API std::vector<std::pair<u32, u32>> get_id_ranges(GroupingEvent::event ev) const;
+    };
+
     class EventHandler
     {
     private:
@@ -156,8 +226,37 @@ namespace hal
         bool net_event_enabled;
         bool grouping_event_enabled;
 
+        // batched delivery
+        CallbackHook<void(const EventBatch&)> m_batch_callback;
+        bool m_batching_enabled;
+        EventBatch m_queue;
+        std::vector<bool> m_cancelled_events;
+        std::vector<std::shared_ptr<void>> m_removed_objects;
+
+        // the most recently queued event per object, event, and associated data, with assignments and removals sharing the key of the assignment
+        struct QueuedEventKey
+        {
+            const void* object;
+            u32 event;
+            u32 associated_data;
+
+            bool operator==(const QueuedEventKey& other) const;
+        };
+
+        struct QueuedEventKeyHash
+        {
+            std::size_t operator()(const QueuedEventKey& key) const;
+        };
+
+        std::unordered_map<QueuedEventKey, u32, QueuedEventKeyHash> m_queued_events;
+
+        template<typename E, typename T>
+        void enqueue(E ev, T* object, u32 associated_data);
+
+        void replay(const EventBatch& batch);
+
     public:
-        EventHandler();
+        NETLIST_API EventHandler();
 
         /**
          * Enables/disables callbacks for all handler.<br>
@@ -259,5 +358,77 @@ namespace hal
          */
         NETLIST_API void unregister_callback(const std::string& name);
 
+        /**
+         * Enables/disables batched delivery of events.<br>
+         * While enabled, events are queued instead of executing the registered per-event callbacks.
+         * Queued events are coalesced and delivered in order to the registered batch callbacks on flush.
+         * Per-event callbacks that do not share their name with a batch callback are executed for every event of the batch afterwards, so that subscribers without a batch callback do not miss any event.
+         * Removed modules, gates, nets, and groupings are kept alive until the batch has been delivered.
+         * The per-event log output is replaced by a summary for each delivered batch.
+         * Disabling batched delivery flushes all queued events.<br>
+         * Disabled by default.
+         *
+         * @param[in] flag - True to enable, false to disable.
+         */
+        NETLIST_API void set_batching_enabled(bool flag);
+
+        /**
+         * Checks whether batched delivery of events is enabled.
+         *
+         * @returns True if enabled, false otherwise.
+         */
+        NETLIST_API bool is_batching_enabled() const;
+
+        /**
+         * Delivers all queued events to the registered batch callbacks.<br>
+         * Does nothing if no events are queued.
+         */
+        NETLIST_API void flush();
+
+        /**
+         * Registers a batch callback function.<br>
+         * Per-event callbacks registered under the same name are not executed for batched events, since the batch callback is expected to handle them.
+         *
+         * @param[in] name - name of the callback, used for callback removal.
+         * @param[in] function - The callback function.
+         */
+        NETLIST_API void register_batch_callback(const std::string& name, std::function<void(const EventBatch& batch)> function);
+
+        /**
+         * Keeps an object that has just been removed from the netlist alive until all queued events have been delivered.<br>
+         * If batched delivery is disabled, the object is destroyed right away.
+         *
+         * @param[in] object - The removed object.
+         */
+        NETLIST_API void defer_destruction(std::shared_ptr<void> object);
+
     };    // class event_handler
+
+    /**
+     * Enables batched delivery of the events of an event handler for the lifetime of the guard, e.g., for the duration of a bulk modification.<br>
+     * If batched delivery was disabled before, it is disabled again on destruction, which delivers all queued events.
+     * Guards may be nested.
+     */
+    class EventBatchGuard
+    {
+    public:
+        /**
+         * Enables batched delivery of events.
+         *
+         * @param[in] event_handler - The event handler.
+         */
+        NETLIST_API explicit EventBatchGuard(EventHandler* event_handler);
+
+        /**
+         * Restores the previous batching state.
+         */
+        NETLIST_API ~EventBatchGuard();
+
+        EventBatchGuard(const EventBatchGuard&) = delete;
+        EventBatchGuard& operator=(const EventBatchGuard&) = delete;
+
+    private:
+        EventHandler* m_event_handler;
+        bool m_was_enabled;
+    };
 }    // namespace hal
@@ -80,6 +80,12 @@ namespace hal
         */
         NETLIST_API void handle_module_event(ModuleEvent::event event, Module* module, u32 associated_data);
 
+        /**
+        * dump a summary of a batch of coalesced events to hal log
+        * @param[in] batch - the event batch
+        */
+        NETLIST_API void handle_event_batch(const EventBatch& batch);
+
         /**
          * enable event log
          * @param[in] enable - enable logging for all event types
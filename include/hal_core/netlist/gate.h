@@ -538,6 +538,7 @@ namespace hal
 
     private:
         friend class NetlistInternalManager;
+        friend class NetlistTransaction;
         Gate(NetlistInternalManager* mgr, EventHandler* event_handler, u32 id, GateType* gt, const std::string& name, i32 x, i32 y);
 
         Gate(const Gate&)            = delete;
@@ -545,6 +546,9 @@ namespace hal
         Gate& operator=(const Gate&) = delete;
         Gate& operator=(Gate&&)      = delete;
 
+        void notify_before_update() override;
+        void notify_updated() override;
+
         BooleanFunction get_lut_function(const GatePin* pin) const;
 
         /* pointer to corresponding netlist parent */
@@ -0,0 +1,104 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/utilities/result.h"
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+namespace hal
+{
+    class GateLibrary;
+
+    /**
+     * The gate library cache stores fully parsed and prepared gate libraries in a versioned binary format within a per-user cache directory, so that neither read-only library directories nor source trees are written to.
+     * A cache file is only used if it has been created by the same cache format version, HAL version, and parser version, and its recorded source file size and modification time match the source file.
+     * If only the modification time differs, the content hash of the source file decides whether the cache is still valid.
+     *
+     * @ingroup gate_lib
+     */
+    namespace gate_library_cache
+    {
+        /**
+         * The version of the binary cache format. Cache files of any other version are ignored and rebuilt.
+         */
+        constexpr u32 format_version = 2;
+
+        /**
+         * Get the directory that holds the cache files.
+         * This is `$XDG_CACHE_HOME/hal/gate_libraries` if `XDG_CACHE_HOME` is set and `~/.cache/hal/gate_libraries` otherwise.
+         *
+         * @returns The path to the cache directory.
+         */
+        NETLIST_API std::filesystem::path get_cache_directory();
+
+        /**
+         * Get the path of the cache file belonging to the given gate library source file.
+         * The file name consists of the name of the source file and a hash of its absolute path.
+         *
+         * @param[in] source_path - The path to the gate library source file.
+         * @returns The path to the cache file.
+         */
+        NETLIST_API std::filesystem::path get_cache_path(const std::filesystem::path& source_path);
+
+        /**
+         * Check whether a valid cache file exists for the given gate library source file.
+         *
+         * @param[in] source_path - The path to the gate library source file.
+         * @returns `true` if a valid cache file exists, `false` otherwise.
+         */
+        NETLIST_API bool is_valid(const std::filesystem::path& source_path);
+
+        /**
+         * Get the name of the gate library stored in the cache file of the given gate library source file without reading the entire cache.
+         *
+         * @param[in] source_path - The path to the gate library source file.
+         * @returns The name of the gate library on success, an error otherwise.
+         */
+        NETLIST_API Result<std::string> get_library_name(const std::filesystem::path& source_path);
+
+        /**
+         * Write the given gate library to the cache file of the given gate library source file.
+         *
+         * @param[in] gate_lib - The gate library.
+         * @param[in] source_path - The path to the gate library source file.
+         * @returns Ok() on success, an error otherwise.
+         */
+        NETLIST_API Result<std::monostate> write(const GateLibrary* gate_lib, const std::filesystem::path& source_path);
+
+        /**
+         * Read the gate library from the cache file of the given gate library source file.
+         * Fails if the cache file does not exist, is outdated, or is malformed.
+         *
+         * @param[in] source_path - The path to the gate library source file.
+         * @returns The gate library on success, an error otherwise.
+         */
+        NETLIST_API Result<std::unique_ptr<GateLibrary>> read(const std::filesystem::path& source_path);
+    }    // namespace gate_library_cache
+}    // namespace hal
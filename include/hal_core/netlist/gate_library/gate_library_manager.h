@@ -43,9 +43,11 @@ namespace hal
     {
         /**
          * Load a gate library from file.
+         * If the gate library cache is enabled, a valid cache file of the source file within the per-user cache directory is used instead of parsing the source file.
+         * After parsing, the cache file is (re-)created if possible.
          *
          * @param[in] file_path - The input path.
-         * @param[in] reload - If true, reloads the library in case it is already loaded.
+         * @param[in] reload - If true, reloads the library from its source file in case it is already loaded, ignoring any cache file.
          * @returns The gate library on success, nullptr otherwise.
          */
         NETLIST_API GateLibrary* load(std::filesystem::path file_path, bool reload = false);
@@ -58,7 +60,7 @@ namespace hal
         NETLIST_API void load_all(bool reload = false);
 
         /**
-         * Lists all pathnames to gate libraries
+         * Lists all pathnames to gate libraries, excluding gate library cache files.
          * @return Vector of path
          */
         NETLIST_API std::vector<std::filesystem::path> get_all_path();
@@ -91,13 +93,29 @@ namespace hal
         NETLIST_API GateLibrary* get_gate_library(const std::string& file_path);
 
         /**
-         * Get a gate library by name. If no library with the given name is loaded, a nullptr will be returned.
+         * Get a gate library by name. If no library with the given name is loaded, the libraries within the standard gate library directories are loaded lazily until one with the given name is found.
+         * Valid cache files are used to identify the matching library without parsing any of the other libraries.
+         * If no such library exists, a nullptr will be returned.
          *
          * @param[in] lib_name - The name of the gate library.
          * @returns The gate library on success, nullptr otherwise.
          */
         NETLIST_API GateLibrary* get_gate_library_by_name(const std::string& lib_name);
 
+        /**
+         * Enable or disable the binary gate library cache used when loading gate libraries. The cache is enabled by default.
+         *
+         * @param[in] enable - True to enable the cache, false to disable it.
+         */
+        NETLIST_API void set_cache_enabled(bool enable);
+
+        /**
+         * Check whether the binary gate library cache is enabled.
+         *
+         * @returns True if the cache is enabled, false otherwise.
+         */
+        NETLIST_API bool is_cache_enabled();
+
         /**
          * Get all loaded gate libraries.
          *
@@ -53,8 +53,10 @@ namespace hal
          * @param[in] name - The name of the parser.
          * @param[in] parser_factory - A factory function that constructs a new parser instance.
          * @param[in] supported_file_extensions - The file extensions this parser can process.
+         * @param[in] version - The version of the parser, which invalidates cached gate libraries parsed by other versions. Defaults to an empty string.
          */
-        NETLIST_API void register_parser(const std::string& name, const ParserFactory& parser_factory, const std::vector<std::string>& supported_file_extensions);
+        NETLIST_API void
+            register_parser(const std::string& name, const ParserFactory& parser_factory, const std::vector<std::string>& supported_file_extensions, const std::string& version = "");
 
         /**
          * Unregisters a specific parser.
@@ -63,6 +65,14 @@ namespace hal
          */
         NETLIST_API void unregister_parser(const std::string& name);
 
+        /**
+         * Get the name and version of the parser that is responsible for the given gate library file depending on its file extension.
+         *
+         * @param[in] file_path - The input path.
+         * @returns The name and version of the parser, or an empty string if no parser is registered for the file extension.
+         */
+        NETLIST_API std::string get_parser_version(const std::filesystem::path& file_path);
+
         /**
          * Parses the gate library file depending on its file extension.
          * 
@@ -31,7 +31,9 @@
 #include "hal_core/netlist/pins/gate_pin.h"
 #include "hal_core/netlist/pins/pin_group.h"
 #include "hal_core/utilities/enums.h"
+#include "hal_core/utilities/id_allocator.h"
 
+#include <list>
 #include <map>
 #include <set>
 #include <string>
@@ -445,12 +447,8 @@ namespace hal
         std::unique_ptr<GateTypeComponent> m_component;
 
         // pins
-        u32 m_next_pin_id;
-        std::set<u32> m_used_pin_ids;
-        std::set<u32> m_free_pin_ids;
-        u32 m_next_pin_group_id;
-        std::set<u32> m_used_pin_group_ids;
-        std::set<u32> m_free_pin_group_ids;
+        IdAllocator m_pin_ids;
+        IdAllocator m_pin_group_ids;
 
         std::vector<std::unique_ptr<GatePin>> m_pins;
         std::unordered_map<u32, GatePin*> m_pins_map;
@@ -362,6 +362,7 @@ namespace hal
 
     private:
         friend class NetlistInternalManager;
+        friend class NetlistTransaction;
 
         Grouping(NetlistInternalManager* internal_manager, EventHandler* event_handler, u32 id, std::string name);
 
@@ -34,6 +34,7 @@
 #include "hal_core/netlist/pins/module_pin.h"
 #include "hal_core/netlist/pins/pin_group.h"
 #include "hal_core/utilities/enums.h"
+#include "hal_core/utilities/id_allocator.h"
 #include "hal_core/utilities/result.h"
 
 #include <functional>
@@ -589,6 +590,17 @@ namespace hal
          */
         Result<std::monostate> move_pin_within_group(PinGroup<ModulePin>* pin_group, ModulePin* pin, u32 new_index);
 
+        /**
+         * Reorder all pins of the given pin group at once.
+         * The pins must be a permutation of the pins of the pin group, the first pin is assigned the start index of the group.
+         * Other than repeated calls to `Module::move_pin_within_group`, only a single event is issued.
+         * 
+         * @param[in] pin_group - The pin group.
+         * @param[in] pins - The pins of the pin group in their new order.
+         * @returns Ok on success, an error message otherwise.
+         */
+        Result<std::monostate> reorder_pins_within_group(PinGroup<ModulePin>* pin_group, const std::vector<ModulePin*>& pins);
+
         /**
          * Remove a pin from a pin group.
          * The pin will be moved to a new group that goes by the pin's name.
@@ -682,11 +694,15 @@ namespace hal
 
     private:
         friend class NetlistInternalManager;
+        friend class NetlistTransaction;
         Module(NetlistInternalManager* internal_manager, EventHandler* event_handler, u32 id, Module* parent, const std::string& name);
 
         Module(const Module&)            = delete;    //disable copy-constructor
         Module& operator=(const Module&) = delete;    //disable copy-assignment
 
+        void notify_before_update() override;
+        void notify_updated() override;
+
         struct NetConnectivity
         {
             bool has_internal_source;
@@ -709,12 +725,8 @@ namespace hal
         std::vector<Module*> m_submodules;
 
         // pins
-        u32 m_next_pin_id;
-        std::set<u32> m_used_pin_ids;
-        std::set<u32> m_free_pin_ids;
-        u32 m_next_pin_group_id;
-        std::set<u32> m_used_pin_group_ids;
-        std::set<u32> m_free_pin_group_ids;
+        IdAllocator m_pin_ids;
+        IdAllocator m_pin_group_ids;
 
         u32 m_next_input_index  = 0;
         u32 m_next_inout_index  = 0;
@@ -723,6 +735,7 @@ namespace hal
         std::vector<std::unique_ptr<ModulePin>> m_pins;
         std::unordered_map<u32, ModulePin*> m_pins_map;
         std::unordered_map<std::string, ModulePin*> m_pin_names_map;
+        std::unordered_map<Net*, ModulePin*> m_pin_nets_map;
         std::vector<std::unique_ptr<PinGroup<ModulePin>>> m_pin_groups;
         std::unordered_map<u32, PinGroup<ModulePin>*> m_pin_groups_map;
         std::unordered_map<std::string, PinGroup<ModulePin>*> m_pin_group_names_map;
@@ -0,0 +1,246 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <algorithm>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * An index mapping object names to the objects carrying that name, e.g., gates, nets, or modules.
+     * Names do not have to be unique, objects sharing a name are kept ordered by ID.
+     * Exact name lookups are answered using a hash table.
+     * Prefix and hierarchical path queries are answered using a sorted table of all names that is rebuilt lazily on the first such query after names have been added or removed.
+     *
+     * @ingroup netlist
+     */
+    template<class T>
+    class NameIndex
+    {
+    public:
+        NameIndex() = default;
+
+        /**
+         * Add an object to the index using its current name.
+         *
+         * @param[in] object - The object.
+         */
+        void insert(T* object)
+        {
+            insert(object->get_name(), object);
+        }
+
+        /**
+         * Remove an object from the index using its current name.
+         *
+         * @param[in] object - The object.
+         */
+        void remove(T* object)
+        {
+            remove(object->get_name(), object);
+        }
+
+        /**
+         * Update the index after the name of an object has changed.
+         *
+         * @param[in] object - The object carrying its new name.
+         * @param[in] old_name - The previous name of the object.
+         */
+        void rename(T* object, const std::string& old_name)
+        {
+            remove(old_name, object);
+            insert(object);
+        }
+
+        /**
+         * Remove all objects from the index.
+         */
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock(m_sorted_mutex);
+            m_objects.clear();
+            m_sorted_names.clear();
+            m_sorted = true;
+        }
+
+        /**
+         * Get all objects with exactly the given name.
+         * The objects are ordered by ID.
+         *
+         * @param[in] name - The name.
+         * @returns A vector of objects.
+         */
+        std::vector<T*> find(const std::string& name) const
+        {
+            if (auto it = m_objects.find(name); it != m_objects.end())
+            {
+                return {it->second.begin(), it->second.end()};
+            }
+            return {};
+        }
+
+        /**
+         * Get all objects whose name starts with the given prefix.
+         * The objects are ordered by name and objects of equal name by ID.
+         *
+         * @param[in] prefix - The name prefix.
+         * @returns A vector of objects.
+         */
+        std::vector<T*> find_prefix(const std::string& prefix) const
+        {
+            return find_matching(prefix, [](const std::string&) { return true; });
+        }
+
+        /**
+         * Get all objects within the given hierarchical scope, i.e., all objects whose name is made up of the given path, followed by the separator and a (hierarchical) name.
+         * If `recursive` is `false`, only objects directly within the scope, i.e., without another separator in the remainder of their name, are returned.
+         * An empty path refers to the root scope.
+         * The objects are ordered by name and objects of equal name by ID.
+         *
+         * @param[in] path - The hierarchical path of the scope.
+         * @param[in] separator - The hierarchy separator.
+         * @param[in] recursive - Set `true` to include objects within nested scopes, `false` otherwise.
+         * @returns A vector of objects.
+         */
+        std::vector<T*> find_in_scope(const std::string& path, const std::string& separator, bool recursive) const
+        {
+            const std::string prefix = path.empty() ? "" : path + separator;
+            return find_matching(prefix, [&prefix, &separator, recursive](const std::string& name) { return is_in_scope(name, prefix, separator, recursive); });
+        }
+
+        /**
+         * Check whether a name is within the scope identified by the given prefix, i.e., the path followed by the separator.
+         *
+         * @param[in] name - The name to check.
+         * @param[in] prefix - The path of the scope followed by the separator, or an empty string for the root scope.
+         * @param[in] separator - The hierarchy separator.
+         * @param[in] recursive - Set `true` to include names within nested scopes, `false` otherwise.
+         * @returns `true` if the name is within the scope, `false` otherwise.
+         */
+        static bool is_in_scope(const std::string& name, const std::string& prefix, const std::string& separator, bool recursive)
+        {
+            if (name.size() <= prefix.size() || name.compare(0, prefix.size(), prefix) != 0)
+            {
+                return false;
+            }
+            return recursive || separator.empty() || name.find(separator, prefix.size()) == std::string::npos;
+        }
+
+        /**
+         * Get the number of distinct names within the index.
+         *
+         * @returns The number of distinct names.
+         */
+        size_t size() const
+        {
+            return m_objects.size();
+        }
+
+    private:
+        void insert(const std::string& name, T* object)
+        {
+            auto [it, inserted] = m_objects.try_emplace(name);
+            it->second.insert(object);
+            if (inserted)
+            {
+                m_sorted = false;
+            }
+        }
+
+        void remove(const std::string& name, T* object)
+        {
+            auto it = m_objects.find(name);
+            if (it == m_objects.end())
+            {
+                return;
+            }
+
+            auto& objects = it->second;
+            objects.erase(object);
+
+            if (objects.empty())
+            {
+                m_objects.erase(it);
+                m_sorted = false;
+            }
+        }
+
+        template<typename Predicate>
+        std::vector<T*> find_matching(const std::string& prefix, const Predicate& predicate) const
+        {
+            std::lock_guard<std::mutex> lock(m_sorted_mutex);
+            if (!m_sorted)
+            {
+                // keys of an unordered_map are never moved, so pointers to them stay valid until the key is erased
+                m_sorted_names.clear();
+                m_sorted_names.reserve(m_objects.size());
+                for (const auto& [name, objects] : m_objects)
+                {
+                    m_sorted_names.push_back(&name);
+                }
+                std::sort(m_sorted_names.begin(), m_sorted_names.end(), [](const std::string* a, const std::string* b) { return *a < *b; });
+                m_sorted = true;
+            }
+
+            std::vector<T*> res;
+            auto it = std::lower_bound(m_sorted_names.begin(), m_sorted_names.end(), prefix, [](const std::string* a, const std::string& b) { return *a < b; });
+            for (; it != m_sorted_names.end() && (*it)->compare(0, prefix.size(), prefix) == 0; ++it)
+            {
+                if (predicate(**it))
+                {
+                    const auto& objects = m_objects.at(**it);
+                    res.insert(res.end(), objects.begin(), objects.end());
+                }
+            }
+            return res;
+        }
+
+        struct CompareById
+        {
+            bool operator()(const T* a, const T* b) const
+            {
+                return a->get_id() < b->get_id();
+            }
+        };
+
+        // objects sharing a name are ordered by ID, so that they can be removed without scanning all objects of that name
+        std::unordered_map<std::string, std::set<T*, CompareById>> m_objects;
+
+        mutable std::mutex m_sorted_mutex;
+        mutable std::vector<const std::string*> m_sorted_names;
+        mutable bool m_sorted = true;
+
+        NameIndex(const NameIndex&) = delete;
+        NameIndex& operator=(const NameIndex&) = delete;
+    };
+}    // namespace hal
@@ -397,6 +397,7 @@ namespace hal
 
     private:
         friend class NetlistInternalManager;
+        friend class NetlistTransaction;
         explicit Net(NetlistInternalManager* internal_manager, EventHandler* event_handler, const u32 id, const std::string& name = "");
 
         Net(const Net&)            = delete;
@@ -404,6 +405,9 @@ namespace hal
         Net& operator=(const Net&) = delete;
         Net& operator=(Net&&)      = delete;
 
+        void notify_before_update() override;
+        void notify_updated() override;
+
         NetlistInternalManager* m_internal_manager;
 
         /* stores the id of the net */
@@ -28,6 +28,9 @@
 #include "hal_core/defines.h"
 #include "hal_core/netlist/event_system/event_handler.h"
 #include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/name_index.h"
+#include "hal_core/netlist/search_index.h"
+#include "hal_core/utilities/id_allocator.h"
 
 #include <functional>
 #include <memory>
@@ -50,11 +53,16 @@ namespace hal
     /**
      * Netlist class containing information about the netlist including its gates, modules, nets, and groupings as well as the underlying gate library.
      *
+     * A netlist may be read by any number of threads concurrently, i.e., all const member functions of the netlist and its gates, nets, modules, groupings, and pins may be called in parallel.
+     * Modifications require exclusive access to the netlist, as no locking is performed on the netlist's data structures.
+     * Events are dispatched within the thread performing the modification.
+     *
      * @ingroup netlist
      */
     class NETLIST_API Netlist
     {
         friend class NetlistInternalManager;
+        friend class NetlistTransaction;
 
     public:
         /**
@@ -67,6 +75,58 @@ namespace hal
 
         ~Netlist();
 
+        /**
+         * Enable or disable the name index of the netlist.<br>
+         * While enabled, the name index is automatically kept up to date whenever gates, nets, or modules are created, removed, or renamed and speeds up name-based lookups such as `get_gates_by_name`.
+         * Enabling the index builds it from all current gates, nets, and modules; disabling it frees its memory.
+         * The name index is disabled by default.
+         *
+         * @param[in] enable - True to enable the name index, false to disable it.
+         */
+        void enable_name_index(bool enable);
+
+        /**
+         * Check whether the name index of the netlist is enabled.
+         *
+         * @returns True if the name index is enabled, false otherwise.
+         */
+        bool is_name_index_enabled() const;
+
+        /**
+         * Enable or disable the full-text search index of the netlist.<br>
+         * While enabled, gates, nets, and modules are reindexed whenever they are created, removed, renamed, or their type, data, or pins change, which speeds up `search`.
+         * Enabling the index builds it from all current gates, nets, and modules; disabling it frees its memory.
+         * The search index is disabled by default.
+         *
+         * @param[in] enable - True to enable the search index, false to disable it.
+         */
+        void enable_search_index(bool enable);
+
+        /**
+         * Check whether the full-text search index of the netlist is enabled.
+         *
+         * @returns True if the search index is enabled, false otherwise.
+         */
+        bool is_search_index_enabled() const;
+
+        /**
+         * Search for all gates, nets, and modules with at least one of the given fields matching the text.<br>
+         * By default, a field matches if it contains the text as a substring.
+         * If `exact_match` is set, the field must be equal to the text instead.
+         * If `regex` is set, the text is interpreted as an ECMAScript regular expression that has to match any part of the field.
+         * If both are set, `exact_match` takes precedence.<br>
+         * Uses the search index if it is enabled, otherwise all gates, nets, and modules are searched.
+         *
+         * @param[in] text - The text to search for.
+         * @param[in] fields - The fields to search as a combination of SearchIndex::Field values. Defaults to all fields.
+         * @param[in] case_sensitive - Set `true` to match case-sensitively, `false` otherwise. Defaults to `false`.
+         * @param[in] exact_match - Set `true` to match the whole field, `false` otherwise. Defaults to `false`.
+         * @param[in] regex - Set `true` to interpret the text as a regular expression, `false` otherwise. Ignored if `exact_match` is set. Defaults to `false`.
+         * @returns The IDs of the matching gates, nets, and modules on success, an error if the regular expression is invalid.
+         */
+        Result<SearchIndex::Matches>
+            search(const std::string& text, u8 fields = SearchIndex::Field::all, bool case_sensitive = false, bool exact_match = false, bool regex = false) const;
+
         /**
          * Check whether two netlists are equal.
          * Does not check netlist IDs.
@@ -234,6 +294,37 @@ namespace hal
          */
         std::vector<Gate*> get_gates(const std::function<bool(const Gate*)>& filter) const;
 
+        /**
+         * Get all gates with exactly the given name, ordered by ID.<br>
+         * Uses the name index if it is enabled, otherwise all gates are searched.
+         *
+         * @param[in] name - The name of the gate.
+         * @return A vector of gates.
+         */
+        std::vector<Gate*> get_gates_by_name(const std::string& name) const;
+
+        /**
+         * Get all gates whose name starts with the given prefix, ordered by name and then by ID.<br>
+         * Uses the name index if it is enabled, otherwise all gates are searched.
+         *
+         * @param[in] prefix - The name prefix.
+         * @return A vector of gates.
+         */
+        std::vector<Gate*> get_gates_by_name_prefix(const std::string& prefix) const;
+
+        /**
+         * Get all gates within the given hierarchical scope, ordered by name and then by ID.<br>
+         * A gate is within the scope if its name is made up of the hierarchical path, followed by the separator and a (hierarchical) name, e.g., gate `cpu/alu/add_0` is within scope `cpu/alu` and, recursively, within scope `cpu`.
+         * An empty path refers to the root scope.
+         * Uses the name index if it is enabled, otherwise all gates are searched.
+         *
+         * @param[in] path - The hierarchical path of the scope.
+         * @param[in] separator - The hierarchy separator. Defaults to `/`.
+         * @param[in] recursive - Set `true` to include gates within nested scopes, `false` otherwise. Defaults to `true`.
+         * @return A vector of gates.
+         */
+        std::vector<Gate*> get_gates_by_hierarchy(const std::string& path, const std::string& separator = "/", bool recursive = true) const;
+
         /**
          * Mark a gate as a global VCC gate.
          *
@@ -368,6 +459,37 @@ namespace hal
          */
         std::vector<Net*> get_nets(const std::function<bool(const Net*)>& filter) const;
 
+        /**
+         * Get all nets with exactly the given name, ordered by ID.<br>
+         * Uses the name index if it is enabled, otherwise all nets are searched.
+         *
+         * @param[in] name - The name of the net.
+         * @return A vector of nets.
+         */
+        std::vector<Net*> get_nets_by_name(const std::string& name) const;
+
+        /**
+         * Get all nets whose name starts with the given prefix, ordered by name and then by ID.<br>
+         * Uses the name index if it is enabled, otherwise all nets are searched.
+         *
+         * @param[in] prefix - The name prefix.
+         * @return A vector of nets.
+         */
+        std::vector<Net*> get_nets_by_name_prefix(const std::string& prefix) const;
+
+        /**
+         * Get all nets within the given hierarchical scope, ordered by name and then by ID.<br>
+         * A net is within the scope if its name is made up of the hierarchical path, followed by the separator and a (hierarchical) name, e.g., net `cpu/alu/add_0` is within scope `cpu/alu` and, recursively, within scope `cpu`.
+         * An empty path refers to the root scope.
+         * Uses the name index if it is enabled, otherwise all nets are searched.
+         *
+         * @param[in] path - The hierarchical path of the scope.
+         * @param[in] separator - The hierarchy separator. Defaults to `/`.
+         * @param[in] recursive - Set `true` to include nets within nested scopes, `false` otherwise. Defaults to `true`.
+         * @return A vector of nets.
+         */
+        std::vector<Net*> get_nets_by_hierarchy(const std::string& path, const std::string& separator = "/", bool recursive = true) const;
+
         /**
          * Mark a net as a global input net.
          *
@@ -515,6 +637,37 @@ namespace hal
          */
         std::vector<Module*> get_modules(const std::function<bool(const Module*)>& filter) const;
 
+        /**
+         * Get all modules with exactly the given name, ordered by ID.<br>
+         * Uses the name index if it is enabled, otherwise all modules are searched.
+         *
+         * @param[in] name - The name of the module.
+         * @return A vector of modules.
+         */
+        std::vector<Module*> get_modules_by_name(const std::string& name) const;
+
+        /**
+         * Get all modules whose name starts with the given prefix, ordered by name and then by ID.<br>
+         * Uses the name index if it is enabled, otherwise all modules are searched.
+         *
+         * @param[in] prefix - The name prefix.
+         * @return A vector of modules.
+         */
+        std::vector<Module*> get_modules_by_name_prefix(const std::string& prefix) const;
+
+        /**
+         * Get all modules within the given hierarchical scope, ordered by name and then by ID.<br>
+         * A module is within the scope if its name is made up of the hierarchical path, followed by the separator and a (hierarchical) name, e.g., module `cpu/alu/add_0` is within scope `cpu/alu` and, recursively, within scope `cpu`.
+         * An empty path refers to the root scope.
+         * Uses the name index if it is enabled, otherwise all modules are searched.
+         *
+         * @param[in] path - The hierarchical path of the scope.
+         * @param[in] separator - The hierarchy separator. Defaults to `/`.
+         * @param[in] recursive - Set `true` to include modules within nested scopes, `false` otherwise. Defaults to `true`.
+         * @return A vector of modules.
+         */
+        std::vector<Module*> get_modules_by_hierarchy(const std::string& path, const std::string& separator = "/", bool recursive = true) const;
+
         /**
          * Get the top module of the netlist.
          *
@@ -768,6 +921,15 @@ namespace hal
          */
         void set_free_grouping_ids(const std::set<u32> ids);
 
+        /**
+         * Reserve all gate, net, module, and grouping IDs that have ever been assigned within another netlist.<br>
+         * Afterwards, new elements of this netlist are assigned IDs above the highest ID ever assigned within the other netlist, except for IDs freed within this netlist, which are still handed out first.
+         * Only the next IDs are updated, so this takes constant time regardless of the number of IDs of the other netlist.
+         *
+         * @param[in] other - The netlist whose IDs to reserve.
+         */
+        void reserve_ids(const Netlist& other);
+
         /**
          * Get event handler. Should only be used to register callbacks
          *
@@ -820,18 +982,10 @@ namespace hal
         std::unique_ptr<EventHandler> m_event_handler;
 
         /* stores the auto generated ids for fast next id */
-        u32 m_next_gate_id;
-        std::set<u32> m_used_gate_ids;
-        std::set<u32> m_free_gate_ids;
-        u32 m_next_net_id;
-        std::set<u32> m_used_net_ids;
-        std::set<u32> m_free_net_ids;
-        u32 m_next_module_id;
-        std::set<u32> m_used_module_ids;
-        std::set<u32> m_free_module_ids;
-        u32 m_next_grouping_id;
-        std::set<u32> m_used_grouping_ids;
-        std::set<u32> m_free_grouping_ids;
+        IdAllocator m_gate_ids;
+        IdAllocator m_net_ids;
+        IdAllocator m_module_ids;
+        IdAllocator m_grouping_ids;
 
         /* stores the modules */
         Module* m_top_module;
@@ -859,5 +1013,13 @@ namespace hal
         std::vector<Net*> m_global_output_nets;
         std::vector<Gate*> m_gnd_gates;
         std::vector<Gate*> m_vcc_gates;
+
+        /* stores the optional name indices */
+        std::unique_ptr<NameIndex<Gate>> m_gate_name_index;
+        std::unique_ptr<NameIndex<Net>> m_net_name_index;
+        std::unique_ptr<NameIndex<Module>> m_module_name_index;
+
+        /* stores the optional full-text search index */
+        std::unique_ptr<SearchIndex> m_search_index;
     };
 }    // namespace hal
@@ -30,6 +30,7 @@
 #include "hal_core/netlist/pins/gate_pin.h"
 
 #include <map>
+#include <shared_mutex>
 #include <vector>
 
 namespace hal
@@ -43,6 +44,7 @@ namespace hal
     class Endpoint;
     class Grouping;
     class BooleanFunction;
+    class NetlistTransaction;
 
     /**
      * @ingroup netlist
@@ -54,6 +56,7 @@ namespace hal
         friend class Net;
         friend class Gate;
         friend class Grouping;
+        friend class NetlistTransaction;
 
     private:
         Netlist* m_netlist;
@@ -95,9 +98,30 @@ namespace hal
         bool grouping_assign_module(Grouping* grouping, Module* module, bool force = false);
         bool grouping_remove_module(Grouping* grouping, Module* module);
 
+        // name index functions
+        void name_index_rename(Gate* gate, const std::string& old_name);
+        void name_index_rename(Net* net, const std::string& old_name);
+        void name_index_rename(Module* module, const std::string& old_name);
+
+        // search index functions
+        void search_index_update(Gate* gate);
+        void search_index_update(Net* net);
+        void search_index_update(Module* module);
+
+        // transaction functions
+        void transaction_record(const Gate* gate);
+        void transaction_record(const Net* net);
+        void transaction_record(const Module* module);
+        void transaction_record(const Grouping* grouping);
+        void transaction_record_module_net(const Module* module, const Net* net);
+        void transaction_record_module_nets(const Module* module);
+        void transaction_record_module_pins(const Module* module);
+        NetlistTransaction* m_transaction = nullptr;
+
         // caches
         void clear_caches();
         mutable std::map<std::pair<std::vector<GatePin*>, u64>, BooleanFunction> m_lut_function_cache;
+        mutable std::shared_mutex m_lut_function_cache_mutex;
         bool m_net_checks_enabled = true;
     };
 }    // namespace hal
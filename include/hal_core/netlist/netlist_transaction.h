@@ -0,0 +1,241 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/data_container.h"
+#include "hal_core/netlist/gate_library/enums/pin_direction.h"
+#include "hal_core/netlist/gate_library/enums/pin_type.h"
+#include "hal_core/utilities/id_allocator.h"
+#include "hal_core/utilities/result.h"
+#include "hal_core/utilities/utils.h"
+
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hal
+{
+    /** forward declaration */
+    class Netlist;
+    class Gate;
+    class GateType;
+    class GatePin;
+    class Net;
+    class Module;
+    class Grouping;
+
+    /**
+     * A transaction allows to apply tentative modifications to a netlist and to either keep or revert them afterwards, e.g., to evaluate what-if transformations without copying the netlist.<br>
+     * While a transaction is active, the original state of every gate, net, module, and grouping is recorded right before the object is modified for the first time.
+     * Hence, the memory and the time required to discard the modifications are proportional to the number of modified objects and not to the size of the netlist.<br>
+     * Transactions may be nested, but only the most recently started transaction that is still active may be committed or discarded.
+     * Committing a nested transaction hands its records over to the enclosing transaction, so that discarding the latter also reverts the modifications of the former.<br>
+     * Discarding restores IDs, names, types, locations, data, Boolean functions, connections, module hierarchy and pins, grouping memberships, as well as global markings.
+     * The order of the endpoints of nets and gates is restored, while the order of gates, nets, and submodules within their containers may change.
+     * Pointers to objects, module pins, and pin groups that have been deleted and restored by discarding a transaction become invalid, all other pointers remain valid.<br>
+     * A transaction that is still active when it is destroyed is discarded. A transaction must not outlive its netlist.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API NetlistTransaction
+    {
+    public:
+        /**
+         * Start a new transaction on the given netlist.
+         *
+         * @param[in] netlist - The netlist.
+         */
+        explicit NetlistTransaction(Netlist* netlist);
+
+        /**
+         * Discard the transaction if it is still active.
+         */
+        ~NetlistTransaction();
+
+        NetlistTransaction(const NetlistTransaction&)            = delete;
+        NetlistTransaction& operator=(const NetlistTransaction&) = delete;
+
+        /**
+         * Get the netlist the transaction operates on.
+         *
+         * @returns The netlist.
+         */
+        Netlist* get_netlist() const;
+
+        /**
+         * Check whether the transaction has neither been committed nor discarded yet.
+         *
+         * @returns True if the transaction is active, false otherwise.
+         */
+        bool is_active() const;
+
+        /**
+         * Get the number of gates, nets, modules, and groupings whose original state has been recorded so far, i.e., that have been created, modified, or deleted during the transaction.
+         *
+         * @returns The number of recorded objects.
+         */
+        u32 get_num_recorded_objects() const;
+
+        /**
+         * Keep all modifications made during the transaction.
+         *
+         * @returns Ok on success, an error otherwise.
+         */
+        Result<std::monostate> commit();
+
+        /**
+         * Revert all modifications made during the transaction.
+         *
+         * @returns Ok on success, an error otherwise.
+         */
+        Result<std::monostate> discard();
+
+    private:
+        friend class NetlistInternalManager;
+
+        struct GateRecord
+        {
+            bool existed;
+            bool replaced = false;
+            GateType* type;
+            std::string name;
+            i32 x;
+            i32 y;
+            DataContainer data;
+            std::unordered_map<std::string, BooleanFunction> functions;
+            u32 module_id;
+            u32 grouping_id;
+            bool is_gnd;
+            bool is_vcc;
+            std::vector<std::pair<u32, GatePin*>> fan_in;
+            std::vector<std::pair<u32, GatePin*>> fan_out;
+        };
+
+        struct NetRecord
+        {
+            bool existed;
+            bool replaced = false;
+            std::string name;
+            DataContainer data;
+            std::vector<std::pair<u32, GatePin*>> sources;
+            std::vector<std::pair<u32, GatePin*>> destinations;
+            bool is_global_input;
+            bool is_global_output;
+            u32 grouping_id;
+        };
+
+        struct PinRecord
+        {
+            u32 id;
+            std::string name;
+            u32 net_id;
+            PinDirection direction;
+            PinType type;
+        };
+
+        struct PinGroupRecord
+        {
+            u32 id;
+            std::string name;
+            PinDirection direction;
+            PinType type;
+            bool ascending;
+            u32 start_index;
+            std::vector<PinRecord> pins;
+        };
+
+        struct ModuleRecord
+        {
+            bool existed;
+            bool replaced = false;
+            std::string name;
+            std::string type;
+            u32 parent_id;
+            DataContainer data;
+            u32 grouping_id;
+
+            // pins and pin groups are only recorded right before they are modified for the first time, the fields below are meaningless unless 'pins_recorded' is true
+            bool pins_recorded = false;
+            std::vector<PinGroupRecord> pin_groups;
+            IdAllocator pin_ids;
+            IdAllocator pin_group_ids;
+            u32 next_input_index;
+            u32 next_inout_index;
+            u32 next_output_index;
+
+            // membership of nets in the net sets of the module, all nets that are not listed were not contained in any set if 'all_nets_recorded' is true
+            std::unordered_map<u32, u8> nets;
+            bool all_nets_recorded = false;
+        };
+
+        struct GroupingRecord
+        {
+            bool existed;
+            bool replaced = false;
+            std::string name;
+            utils::Color color;
+        };
+
+        Netlist* m_netlist;
+        NetlistTransaction* m_parent;
+        bool m_active = true;
+
+        std::string m_design_name;
+        std::string m_device_name;
+        std::filesystem::path m_file_name;
+        IdAllocator m_gate_ids;
+        IdAllocator m_net_ids;
+        IdAllocator m_module_ids;
+        IdAllocator m_grouping_ids;
+
+        std::unordered_map<u32, GateRecord> m_gates;
+        std::unordered_map<u32, NetRecord> m_nets;
+        std::unordered_map<u32, ModuleRecord> m_modules;
+        std::unordered_map<u32, GroupingRecord> m_groupings;
+
+        // called by the netlist internal manager before an object is modified or deleted
+        void record(const Gate* gate);
+        void record(const Net* net);
+        void record(const Module* module);
+        void record(const Grouping* grouping);
+        void record_module_net(const Module* module, const Net* net);
+        void record_module_nets(const Module* module);
+        void record_module_pins(const Module* module);
+
+        // called by the netlist internal manager after an object has been created
+        void record_creation(const Gate* gate);
+        void record_creation(const Net* net);
+        void record_creation(const Module* module);
+        void record_creation(const Grouping* grouping);
+
+        void merge_into_parent();
+        Result<std::monostate> restore();
+        Result<std::monostate> restore_pins(Module* module, const ModuleRecord& record);
+    };
+}    // namespace hal
@@ -28,7 +28,7 @@
 #include "hal_core/defines.h"
 #include "hal_core/utilities/result.h"
 
-#include <list>
+#include <algorithm>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -223,23 +223,9 @@ namespace hal
          */
         Result<T*> get_pin_at_index(i32 index) const
         {
-            if (m_ascending)
+            if ((m_ascending && index >= m_start_index && index < m_next_index) || (!m_ascending && index <= m_start_index && index > m_next_index))
             {
-                if (index >= m_start_index && index < m_next_index)
-                {
-                    auto it = m_pins.begin();
-                    std::advance(it, index - m_start_index);
-                    return OK(*it);
-                }
-            }
-            else
-            {
-                if (index <= m_start_index && index > m_next_index)
-                {
-                    auto it = m_pins.begin();
-                    std::advance(it, m_start_index - index);
-                    return OK(*it);
-                }
+                return OK(m_pins[position_of(index)]);
             }
 
             return ERR("no pin exists at index " + std::to_string(index) + " within pin group '" + m_name + "'");
@@ -346,7 +332,7 @@ namespace hal
                 return ERR("pin '" + pin->get_name() + "' with ID " + std::to_string(pin->get_id()) + " does not belong to pin group '" + m_name + "' with ID " + std::to_string(m_id));
             }
 
-            if (m_ascending && new_index >= m_start_index && new_index < m_next_index)
+            if ((m_ascending && new_index >= m_start_index && new_index < m_next_index) || (!m_ascending && new_index <= m_start_index && new_index > m_next_index))
             {
                 i32 old_index = pin->m_group.second;
                 if (old_index == new_index)
@@ -354,43 +340,18 @@ namespace hal
                     return OK({});
                 }
 
-                i32 direction = (old_index > new_index) ? 1 : -1;
-
-                // move pin within vector
-                m_pins.erase(std::next(m_pins.begin(), old_index - m_start_index));
-                auto it = std::next(m_pins.begin(), new_index - m_start_index);
-                it      = m_pins.insert(it, pin);
-
-                // update indices; 'it' now points to inserted pin
-                for (i32 i = new_index; i != old_index; i += direction)
-                {
-                    std::advance(it, direction);
-                    std::get<1>((*it)->m_group) += direction;
-                }
-                std::get<1>(pin->m_group) = new_index;
-            }
-            else if (!m_ascending && new_index <= m_start_index && new_index > m_next_index)
-            {
-                i32 old_index = pin->m_group.second;
-                if (old_index == new_index)
+                // move pin within vector and update indices of all pins in between
+                size_t old_pos = position_of(old_index);
+                size_t new_pos = position_of(new_index);
+                if (old_pos < new_pos)
                 {
-                    return OK({});
+                    std::rotate(m_pins.begin() + old_pos, m_pins.begin() + old_pos + 1, m_pins.begin() + new_pos + 1);
                 }
-
-                i32 direction = (old_index < new_index) ? 1 : -1;
-
-                // move pin within vector
-                m_pins.erase(std::next(m_pins.begin(), m_start_index - old_index));
-                auto it = std::next(m_pins.begin(), m_start_index - new_index);
-                it      = m_pins.insert(it, pin);
-
-                // update indices; 'it' now points to inserted pin
-                for (i32 i = new_index; i != old_index; i -= direction)
+                else
                 {
-                    std::advance(it, direction);
-                    std::get<1>((*it)->m_group) -= direction;
+                    std::rotate(m_pins.begin() + new_pos, m_pins.begin() + old_pos, m_pins.begin() + old_pos + 1);
                 }
-                std::get<1>(pin->m_group) = new_index;
+                update_indices(std::min(old_pos, new_pos), std::max(old_pos, new_pos) + 1);
             }
             else
             {
@@ -419,28 +380,11 @@ namespace hal
                 return ERR("pin '" + pin->get_name() + "' with ID " + std::to_string(pin->get_id()) + " does not belong to pin group '" + m_name + "' with ID " + std::to_string(m_id));
             }
 
-            i32 index    = pin->m_group.second;
+            size_t pos   = position_of(pin->m_group.second);
             pin->m_group = std::make_pair(nullptr, 0);
-            if (m_ascending)
-            {
-                auto it = std::next(m_pins.begin(), index - m_start_index);
-                it      = m_pins.erase(it);
-                for (; it != m_pins.end(); it++)
-                {
-                    std::get<1>((*it)->m_group)--;
-                }
-                m_next_index--;
-            }
-            else
-            {
-                auto it = std::next(m_pins.begin(), m_start_index - index);
-                it      = m_pins.erase(it);
-                for (; it != m_pins.end(); it++)
-                {
-                    std::get<1>((*it)->m_group)++;
-                }
-                m_next_index++;
-            }
+            m_pins.erase(m_pins.begin() + pos);
+            m_next_index += m_ascending ? -1 : 1;
+            update_indices(pos, m_pins.size());
 
             return OK({});
         }
@@ -466,16 +410,76 @@ namespace hal
             return true;
         }
 
+        /**
+         * Reorder all pins of the pin group at once.
+         * The given pins must be a permutation of the pins of the pin group. The first pin is assigned the start index of the pin group.
+         * 
+         * @param[in] pins - The pins of the pin group in their new order.
+         * @returns Ok on success, an error message otherwise.
+         */
+        Result<std::monostate> reorder_pins(const std::vector<T*>& pins)
+        {
+            if (pins.size() != m_pins.size())
+            {
+                return ERR("could not reorder pins of pin group '" + m_name + "' with ID " + std::to_string(m_id) + ": " + std::to_string(pins.size()) + " pins given but pin group contains "
+                           + std::to_string(m_pins.size()) + " pins");
+            }
+
+            std::vector<bool> seen(m_pins.size(), false);
+            for (const T* pin : pins)
+            {
+                if (pin == nullptr)
+                {
+                    return ERR("could not reorder pins of pin group '" + m_name + "' with ID " + std::to_string(m_id) + ": 'nullptr' given instead of a pin");
+                }
+
+                if (pin->m_group.first != this)
+                {
+                    return ERR("could not reorder pins of pin group '" + m_name + "' with ID " + std::to_string(m_id) + ": pin '" + pin->get_name() + "' with ID "
+                               + std::to_string(pin->get_id()) + " does not belong to pin group");
+                }
+
+                if (size_t pos = position_of(pin->m_group.second); seen[pos])
+                {
+                    return ERR("could not reorder pins of pin group '" + m_name + "' with ID " + std::to_string(m_id) + ": pin '" + pin->get_name() + "' with ID "
+                               + std::to_string(pin->get_id()) + " is given more than once");
+                }
+                else
+                {
+                    seen[pos] = true;
+                }
+            }
+
+            m_pins = pins;
+            update_indices(0, m_pins.size());
+            return OK({});
+        }
+
     private:
         u32 m_id;
         std::string m_name;
         PinDirection m_direction;
         PinType m_type;
-        std::list<T*> m_pins;
+        std::vector<T*> m_pins;
         bool m_ascending;
         i32 m_start_index;
         i32 m_next_index;
 
+        // position within m_pins of the pin at the given index
+        size_t position_of(i32 index) const
+        {
+            return m_ascending ? index - m_start_index : m_start_index - index;
+        }
+
+        // reassign the indices of all pins at positions [begin, end) of m_pins
+        void update_indices(size_t begin, size_t end)
+        {
+            for (size_t pos = begin; pos < end; pos++)
+            {
+                std::get<1>(m_pins[pos]->m_group) = m_ascending ? m_start_index + (i32)pos : m_start_index - (i32)pos;
+            }
+        }
+
         PinGroup(const PinGroup&)            = delete;
         PinGroup(PinGroup&&)                 = delete;
         PinGroup& operator=(const PinGroup&) = delete;
@@ -0,0 +1,189 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/utilities/result.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace hal
+{
+    class Netlist;
+    class Gate;
+    class Net;
+    class Module;
+
+    /**
+     * A full-text search index over the gates, nets, and modules of a netlist.<br>
+     * The index covers object names, gate and module types, data container values, and pin names.
+     * Every distinct string is stored only once together with the objects it belongs to, while substring queries are answered by intersecting with a trigram index over the lowercase strings.
+     * Gate types and gate pin names are indexed once per gate type instead of once per gate.<br>
+     * Objects are reindexed lazily on the next search after they have been invalidated.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API SearchIndex
+    {
+    public:
+        /**
+         * The properties of gates, nets, and modules that can be searched.
+         * Fields can be combined using bitwise OR.
+         */
+        enum Field : u8
+        {
+            name = 0x1,    ///< The name of the object.
+            type = 0x2,    ///< The type of a gate or module.
+            data = 0x4,    ///< The values stored in the data container of the object.
+            pin  = 0x8,    ///< The pin names of a gate or module.
+            all  = 0xF     ///< All of the above.
+        };
+
+        /**
+         * The IDs of all gates, nets, and modules matching a search, each sorted in ascending order.
+         */
+        struct Matches
+        {
+            std::vector<u32> gates;
+            std::vector<u32> nets;
+            std::vector<u32> modules;
+        };
+
+        /**
+         * Construct a search index from all current gates, nets, and modules of the netlist.
+         *
+         * @param[in] netlist - The netlist.
+         */
+        explicit SearchIndex(const Netlist* netlist);
+
+        /**
+         * Mark a gate for reindexing, e.g., after it has been created, removed, or modified.
+         *
+         * @param[in] gate - The gate.
+         */
+        void invalidate(const Gate* gate);
+
+        /**
+         * Mark a net for reindexing, e.g., after it has been created, removed, or modified.
+         *
+         * @param[in] net - The net.
+         */
+        void invalidate(const Net* net);
+
+        /**
+         * Mark a module for reindexing, e.g., after it has been created, removed, or modified.
+         *
+         * @param[in] module - The module.
+         */
+        void invalidate(const Module* module);
+
+        /**
+         * Search the index for all gates, nets, and modules with at least one of the given fields matching the text.<br>
+         * By default, a field matches if it contains the text as a substring.
+         * If `exact_match` is set, the field must be equal to the text instead.
+         * If `regex` is set, the text is interpreted as an ECMAScript regular expression that has to match any part of the field.
+         * If both `exact_match` and `regex` are set, `exact_match` takes precedence and the text is not interpreted as a regular expression, just like in the search bars of the GUI.
+         *
+         * @param[in] text - The text to search for.
+         * @param[in] fields - The fields to search as a combination of SearchIndex::Field values.
+         * @param[in] case_sensitive - Set `true` to match case-sensitively, `false` otherwise.
+         * @param[in] exact_match - Set `true` to match the whole field, `false` otherwise.
+         * @param[in] regex - Set `true` to interpret the text as a regular expression, `false` otherwise. Ignored if `exact_match` is set.
+         * @returns The matching IDs on success, an error if the regular expression is invalid.
+         */
+        Result<Matches> search(const std::string& text, u8 fields = Field::all, bool case_sensitive = false, bool exact_match = false, bool regex = false) const;
+
+        /**
+         * Search all gates, nets, and modules of the netlist without using an index.<br>
+         * Yields the same results as SearchIndex::search.
+         *
+         * @param[in] netlist - The netlist.
+         * @param[in] text - The text to search for.
+         * @param[in] fields - The fields to search as a combination of SearchIndex::Field values.
+         * @param[in] case_sensitive - Set `true` to match case-sensitively, `false` otherwise.
+         * @param[in] exact_match - Set `true` to match the whole field, `false` otherwise.
+         * @param[in] regex - Set `true` to interpret the text as a regular expression, `false` otherwise. Ignored if `exact_match` is set.
+         * @returns The matching IDs on success, an error if the regular expression is invalid.
+         */
+        static Result<Matches>
+            scan(const Netlist* netlist, const std::string& text, u8 fields = Field::all, bool case_sensitive = false, bool exact_match = false, bool regex = false);
+
+        /**
+         * Get the number of distinct strings stored in the index.
+         *
+         * @returns The number of distinct strings.
+         */
+        size_t size() const;
+
+    private:
+        enum Kind : u8
+        {
+            gate_kind      = 0,
+            net_kind       = 1,
+            module_kind    = 2,
+            gate_type_kind = 3
+        };
+
+        struct Term
+        {
+            std::string value;
+            // postings combine field, kind, and ID of the objects carrying the string
+            std::unordered_set<u64> postings;
+        };
+
+        struct Document
+        {
+            std::vector<std::pair<u32, u8>> terms;
+            u32 gate_type_id = 0;
+        };
+
+        void update() const;
+        void add_document(u64 key) const;
+        void remove_document(u64 key) const;
+        void add_term(Document& doc, u64 key, Field field, const std::string& value) const;
+        void release_gate_type(u32 gate_type_id) const;
+        void compact() const;
+        std::vector<u32> candidate_terms(const std::string& literal) const;
+
+        const Netlist* m_netlist;
+
+        mutable std::mutex m_mutex;
+        mutable std::unordered_set<u64> m_dirty;
+        mutable std::vector<Term> m_terms;
+        mutable std::unordered_map<std::string, u32> m_term_ids;
+        mutable std::unordered_map<u32, std::vector<u32>> m_trigrams;
+        mutable std::unordered_map<u64, Document> m_documents;
+        mutable std::unordered_map<u32, std::unordered_set<u32>> m_gates_by_type;
+        mutable size_t m_num_dead_terms = 0;
+
+        SearchIndex(const SearchIndex&) = delete;
+        SearchIndex& operator=(const SearchIndex&) = delete;
+    };
+}    // namespace hal
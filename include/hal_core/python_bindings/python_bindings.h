@@ -325,6 +325,27 @@ namespace hal
      * @param[in] m - the python module
      */
     void log_init(py::module& m);
+
+    /**
+     * Initializes Python bindings for the HAL tracing facilities in a python module.
+     *
+     * @param[in] m - the python module
+     */
+    void trace_init(py::module& m);
+
+    /**
+     * Initializes Python bindings for the HAL netlist transaction in a python module.
+     *
+     * @param[in] m - the python module
+     */
+    void netlist_transaction_init(py::module& m);
+
+    /**
+     * Initializes Python bindings for the HAL netlist event handler in a python module.
+     *
+     * @param[in] m - the python module
+     */
+    void event_handler_init(py::module& m);
     /**
      * @}
      */
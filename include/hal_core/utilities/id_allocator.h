@@ -0,0 +1,176 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <set>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * Allocates and tracks unique IDs, e.g., of gates, nets, modules, or pins.<br>
+     * The value of 0 is reserved and represents an invalid ID.
+     *
+     * An ID is either unused, used, or free, i.e., it has been released after being used and will be handed out again before any new ID.
+     * Used and free IDs are stored in bitmaps that cover the dense range of IDs starting at 1 and grow on demand, so that acquiring and releasing an ID takes amortized constant time.
+     * IDs far beyond the dense range are kept in ordered sets instead to not allocate huge bitmaps for a few outliers.
+     *
+     * @ingroup utilities
+     */
+    class CORE_API IdAllocator
+    {
+    public:
+        IdAllocator() = default;
+
+        /**
+         * Get a spare ID, i.e., the smallest free ID or, if there are no free IDs, the next ID that is not used.<br>
+         * The ID is not marked as used until it is acquired.
+         *
+         * @returns The ID.
+         */
+        u32 get_unique_id();
+
+        /**
+         * Check whether an ID is used.
+         *
+         * @param[in] id - The ID.
+         * @returns True if the ID is used, false otherwise.
+         */
+        bool is_used(u32 id) const;
+
+        /**
+         * Check whether an ID is free, i.e., it has been released and not been acquired again.
+         *
+         * @param[in] id - The ID.
+         * @returns True if the ID is free, false otherwise.
+         */
+        bool is_free(u32 id) const;
+
+        /**
+         * Mark an ID as used.
+         *
+         * @param[in] id - The ID.
+         * @returns True on success, false if the ID is invalid or already used.
+         */
+        bool acquire(u32 id);
+
+        /**
+         * Mark a used ID as free.
+         *
+         * @param[in] id - The ID.
+         * @returns True on success, false if the ID is not used.
+         */
+        bool release(u32 id);
+
+        /**
+         * Get the next ID that is considered for allocation once there are no free IDs left.
+         *
+         * @returns The next ID.
+         */
+        u32 get_next_id() const;
+
+        /**
+         * Set the next ID that is considered for allocation once there are no free IDs left.
+         *
+         * @param[in] id - The next ID.
+         */
+        void set_next_id(u32 id);
+
+        /**
+         * Get the largest ID that has ever been acquired, i.e., the largest ID that is used or free.
+         *
+         * @returns The largest ID or 0 if no ID has been acquired.
+         */
+        u32 get_max_id() const;
+
+        /**
+         * Get all used IDs.
+         *
+         * @returns The set of used IDs.
+         */
+        std::set<u32> get_used_ids() const;
+
+        /**
+         * Replace the used IDs.
+         *
+         * @param[in] ids - The set of used IDs.
+         */
+        void set_used_ids(const std::set<u32>& ids);
+
+        /**
+         * Get all free IDs.
+         *
+         * @returns The set of free IDs.
+         */
+        std::set<u32> get_free_ids() const;
+
+        /**
+         * Replace the free IDs.
+         *
+         * @param[in] ids - The set of free IDs.
+         */
+        void set_free_ids(const std::set<u32>& ids);
+
+        /**
+         * Get the number of used IDs.
+         *
+         * @returns The number of used IDs.
+         */
+        u32 get_num_used_ids() const;
+
+        /**
+         * Reset the allocator to its initial state, i.e., no used or free IDs and a next ID of 1.
+         */
+        void clear();
+
+    private:
+        class IdBitmap
+        {
+        public:
+            bool test(u32 id) const;
+            bool set(u32 id);
+            bool reset(u32 id);
+            u32 find_first();
+            std::set<u32> to_set() const;
+            void assign(const std::set<u32>& ids);
+            void clear();
+            u32 size() const;
+
+        private:
+            std::vector<u64> m_words;
+            std::set<u32> m_sparse;
+            u32 m_size       = 0;
+            u32 m_first_word = 0;    // no bit is set in any word before this one
+        };
+
+        IdBitmap m_used;
+        IdBitmap m_free;
+        u32 m_next_id = 1;
+        u32 m_max_id  = 0;
+    };
+}    // namespace hal
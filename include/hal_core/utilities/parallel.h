@@ -0,0 +1,58 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <functional>
+
+namespace hal
+{
+    namespace utils
+    {
+        /**
+         * Resolve the number of worker threads to use for a parallel computation.<br>
+         * A requested number of `0` stands for as many threads as there are hardware threads.
+         * The result is limited to the number of independent work items, but is at least `1`.
+         *
+         * @param[in] num_threads - The requested number of threads.
+         * @param[in] num_items - The number of work items that can be processed independently.
+         * @returns The number of threads to use.
+         */
+        CORE_API u32 get_num_threads(u32 num_threads, u64 num_items);
+
+        /**
+         * Run a worker function on the given number of threads and wait for all of them to finish.<br>
+         * Each invocation receives the index of its thread, which ranges from `0` to the number of threads minus one.
+         * Workers usually claim their work items from a shared atomic counter until all items have been processed.
+         * For a single thread, the worker is run directly on the calling thread.
+         *
+         * @param[in] num_threads - The number of threads, as returned by `utils::get_num_threads`.
+         * @param[in] worker - The worker function.
+         */
+        CORE_API void run_workers(u32 num_threads, const std::function<void(u32 thread_index)>& worker);
+    }    // namespace utils
+}    // namespace hal
@@ -29,6 +29,7 @@
 
 #include <algorithm>
 #include <map>
+#include <memory>
 #include <vector>
 
 namespace hal
@@ -47,7 +48,7 @@ namespace hal
          * @param[in] n - The line number.
          * @param[in] s - The string.
          */
-        Token(u32 n, const T s) : number(n), string(s)
+        Token(u32 n, T s) : number(n), string(std::move(s))
         {
         }
 
@@ -118,6 +119,8 @@ namespace hal
 
     /**
      * A token stream comprises a sequence of tokens that may, for example, have been read from a file.
+     * The tokens are stored only once and shared between a stream, its copies, and all streams extracted from it, each of which only keeps track of its own range and position.
+     * Hence, copying a stream or extracting a sub-stream does not copy any tokens.
      * 
      * @ingroup utilities
      */
@@ -155,10 +158,8 @@ namespace hal
          * @param[in] increase_level_tokens - A vector of tokens that mark the end of a level, i.e., decrease the level.
          */
         TokenStream(const std::vector<T>& increase_level_tokens = {"("}, const std::vector<T>& decrease_level_tokens = {")"})
+            : m_level_tokens(std::make_shared<const LevelTokens>(LevelTokens{increase_level_tokens, decrease_level_tokens})), m_data(std::make_shared<const std::vector<Token<T>>>())
         {
-            m_pos                   = 0;
-            m_increase_level_tokens = increase_level_tokens;
-            m_decrease_level_tokens = decrease_level_tokens;
         }
 
         /**
@@ -171,38 +172,56 @@ namespace hal
          * @param[in] increase_level_tokens - A vector of tokens that mark the end of a level, i.e., decrease the level.
          */
         TokenStream(const std::vector<Token<T>>& init, const std::vector<T>& increase_level_tokens = {"("}, const std::vector<T>& decrease_level_tokens = {")"})
-            : TokenStream(increase_level_tokens, decrease_level_tokens)
+            : TokenStream(std::vector<Token<T>>(init), increase_level_tokens, decrease_level_tokens)
         {
-            m_data = init;
         }
 
         /**
-         * Construct a token stream from another one (i.e., copy constructor).
+         * Construct a token stream from a vector of tokens that is moved into the stream.<br>
+         * The increase-level and decrease-level tokens are used for level-aware iteration. If active, all operations are only executed on tokens on level 0.<br>
+         * Example: consuming until "b" in 'a,(,b,),b,c' would consume 'a,(,b,)', if "(" and ")" are level increase/decrease tokens.
          *
-         * @param[in] other - The token stream to copy.
+         * @param[in] init - The vector of tokens.
+         * @param[in] decrease_level_tokens - A vector of tokens that mark the start of a new level, i.e., increase the level.
+         * @param[in] increase_level_tokens - A vector of tokens that mark the end of a level, i.e., decrease the level.
          */
-        TokenStream(const TokenStream<T>& other)
+        TokenStream(std::vector<Token<T>>&& init, const std::vector<T>& increase_level_tokens = {"("}, const std::vector<T>& decrease_level_tokens = {")"})
+            : m_level_tokens(std::make_shared<const LevelTokens>(LevelTokens{increase_level_tokens, decrease_level_tokens})), m_data(std::make_shared<const std::vector<Token<T>>>(std::move(init)))
         {
-            m_pos                   = other.m_pos;
-            m_data                  = other.m_data;
-            m_increase_level_tokens = other.m_increase_level_tokens;
-            m_decrease_level_tokens = other.m_decrease_level_tokens;
+            m_size = m_data->size();
         }
 
         /**
-         * Assign a token stream.
+         * Construct a token stream from another one (i.e., copy constructor).<br>
+         * The new stream shares the tokens of the other one.
+         *
+         * @param[in] other - The token stream to copy.
+         */
+        TokenStream(const TokenStream<T>& other) = default;
+
+        /**
+         * Construct a token stream from another one by moving it.
+         *
+         * @param[in] other - The token stream to move.
+         */
+        TokenStream(TokenStream<T>&& other) = default;
+
+        /**
+         * Assign a token stream.<br>
+         * The stream shares the tokens of the other one afterwards.
          *
          * @param[in] other - The token stream.
          * @returns A reference to the token stream.
          */
-        TokenStream<T>& operator=(const TokenStream<T>& other)
-        {
-            m_pos                   = other.m_pos;
-            m_data                  = other.m_data;
-            m_increase_level_tokens = other.m_increase_level_tokens;
-            m_decrease_level_tokens = other.m_decrease_level_tokens;
-            return *this;
-        }
+        TokenStream<T>& operator=(const TokenStream<T>& other) = default;
+
+        /**
+         * Assign a token stream by moving it.
+         *
+         * @param[in] other - The token stream.
+         * @returns A reference to the token stream.
+         */
+        TokenStream<T>& operator=(TokenStream<T>&& other) = default;
 
         /**
          * Consume the next token(s) in the stream.<br>
@@ -213,7 +232,7 @@ namespace hal
          * @param[in] num - The amount of tokens to consume.
          * @returns The last consumed token.
          */
-        Token<T> consume(u32 num = 1)
+        const Token<T>& consume(u32 num = 1)
         {
             m_pos += num;
             return at(m_pos - 1);
@@ -263,7 +282,7 @@ namespace hal
          * @param[in] throw_on_error - If true, throws an TokenStreamException instead of returning false on error.
          * @returns The last consumed token or the last token of the stream.
          */
-        Token<T> consume_until(const T& expected, u32 end = END_OF_STREAM, bool level_aware = true, bool throw_on_error = false)
+        const Token<T>& consume_until(const T& expected, u32 end = END_OF_STREAM, bool level_aware = true, bool throw_on_error = false)
         {
             auto found = find_next(expected, end, level_aware);
             if (found > size() && throw_on_error)
@@ -279,7 +298,7 @@ namespace hal
          *
          * @returns The last consumed token or the last token of the stream.
          */
-        Token<T> consume_current_line()
+        const Token<T>& consume_current_line()
         {
             u32 line = at(m_pos).number;
 
@@ -295,7 +314,7 @@ namespace hal
         /**
          * Consume the next tokens in the stream until a token matches the given \p expected string.<br>
          * This final token is not consumed, i.e., it is now the next token in the stream.<br>
-         * All consumed tokens are returned as a new token stream.<br>
+         * All consumed tokens are returned as a new token stream that shares the tokens of this stream, i.e., no tokens are copied.<br>
          * Consumes tokens until reaching the given end position, if no token matches the given string.<br>
          * Can be set to be level-aware with respect to the configured increase and decrease level tokens.
          *
@@ -313,10 +332,11 @@ namespace hal
                 throw TokenStreamException({"expected Token '" + expected + "' not found", get_current_line_number()});
             }
             auto end_pos = std::min(size(), found);
-            TokenStream res(m_increase_level_tokens, m_decrease_level_tokens);
-            res.m_data.reserve(res.m_data.size() + (end_pos - m_pos));
-            res.m_data.insert(res.m_data.begin(), m_data.begin() + m_pos, m_data.begin() + end_pos);
-            m_pos = end_pos;
+            TokenStream res(*this);
+            res.m_offset = m_offset + m_pos;
+            res.m_size   = end_pos - m_pos;
+            res.m_pos    = 0;
+            m_pos        = end_pos;
             return res;
         }
 
@@ -351,7 +371,7 @@ namespace hal
                 {
                     result += joiner;
                 }
-                result += consume();
+                result += consume().string;
             }
             return {start_line, result};
         }
@@ -374,7 +394,7 @@ namespace hal
                 {
                     result += joiner;
                 }
-                result += consume();
+                result += consume().string;
             }
             return {start_line, result};
         }
@@ -389,14 +409,6 @@ namespace hal
          * @param[in] offset - The relative offset from the current position in the stream.
          * @returns The token at the queried position.
          */
-        Token<T>& peek(i32 offset = 0)
-        {
-            return at(m_pos + offset);
-        }
-
-        /**
-         * @copydoc peek(i32)
-         */
         const Token<T>& peek(i32 offset = 0) const
         {
             return at(m_pos + offset);
@@ -412,25 +424,13 @@ namespace hal
          * @param[in] position - The absolute position in the stream.
          * @returns The token at the queried position.
          */
-        Token<T>& at(u32 position)
-        {
-            if (position >= m_data.size())
-            {
-                throw TokenStreamException({"reached the end of the stream", get_current_line_number()});
-            }
-            return m_data[position];
-        }
-
-        /**
-         * @copydoc at(u32)
-         */
         const Token<T>& at(u32 position) const
         {
-            if (position >= m_data.size())
+            if (position >= m_size)
             {
                 throw TokenStreamException({"reached the end of the stream", get_current_line_number()});
             }
-            return m_data[position];
+            return (*m_data)[m_offset + position];
         }
 
         /**
@@ -445,20 +445,23 @@ namespace hal
          */
         u32 find_next(const T& match, u32 end = END_OF_STREAM, bool level_aware = true) const
         {
+            const auto& increase_level_tokens = m_level_tokens->increase;
+            const auto& decrease_level_tokens = m_level_tokens->decrease;
+
             u32 level = 0;
-            for (u32 i = m_pos; i < size() && i < end; ++i)
+            for (u32 i = m_pos; i < m_size && i < end; ++i)
             {
-                const auto& Token = at(i);
+                const auto& Token = (*m_data)[m_offset + i];
                 if ((!level_aware || level == 0) && Token == match)
                 {
                     return i;
                 }
-                else if (level_aware && std::find_if(m_increase_level_tokens.begin(), m_increase_level_tokens.end(), [&Token](const auto& x) { return Token == x; }) != m_increase_level_tokens.end())
+                else if (level_aware && std::find_if(increase_level_tokens.begin(), increase_level_tokens.end(), [&Token](const auto& x) { return Token == x; }) != increase_level_tokens.end())
                 {
                     level++;
                 }
                 else if (level_aware && level > 0
-                         && std::find_if(m_decrease_level_tokens.begin(), m_decrease_level_tokens.end(), [&Token](const auto& x) { return Token == x; }) != m_decrease_level_tokens.end())
+                         && std::find_if(decrease_level_tokens.begin(), decrease_level_tokens.end(), [&Token](const auto& x) { return Token == x; }) != decrease_level_tokens.end())
                 {
                     level--;
                 }
@@ -473,7 +476,7 @@ namespace hal
          */
         u32 size() const
         {
-            return m_data.size();
+            return m_size;
         }
 
         /**
@@ -517,20 +520,31 @@ namespace hal
         }
 
     private:
-        std::vector<T> m_increase_level_tokens;
-        std::vector<T> m_decrease_level_tokens;
-        std::vector<Token<T>> m_data;
-        u32 m_pos;
+        struct LevelTokens
+        {
+            std::vector<T> increase;
+            std::vector<T> decrease;
+        };
+
+        // shared between all streams extracted from the same root stream, never modified after construction
+        std::shared_ptr<const LevelTokens> m_level_tokens;
+        std::shared_ptr<const std::vector<Token<T>>> m_data;
+
+        // range of this stream within m_data
+        u32 m_offset = 0;
+        u32 m_size   = 0;
+
+        u32 m_pos = 0;
 
         u32 get_current_line_number() const
         {
-            if (m_pos < m_data.size())
+            if (m_pos < m_size)
             {
-                return m_data[m_pos].number;
+                return (*m_data)[m_offset + m_pos].number;
             }
-            else if (!m_data.empty())
+            else if (m_size != 0)
             {
-                return m_data.back().number;
+                return (*m_data)[m_offset + m_size - 1].number;
             }
             return END_OF_STREAM;
         }
@@ -0,0 +1,240 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <atomic>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * Lightweight hierarchical profiling of nested code regions.<br>
+     * A span measures the time between its construction and destruction and is nested into the span that was open on the same thread when it was created.
+     * Counters (e.g., the number of solver queries or visited gates) are attributed to the innermost open span of the calling thread.
+     *
+     * Tracing is disabled by default, in which case opening a span or incrementing a counter costs a single relaxed atomic load.
+     * Recorded spans can be exported as Chrome trace-event JSON (viewable with `chrome://tracing` or Perfetto) or aggregated into a summary per span name.
+     *
+     * @ingroup utilities
+     */
+    namespace trace
+    {
+        /**
+         * Aggregated statistics of all spans sharing the same name.
+         */
+        struct SpanSummary
+        {
+            /**
+             * The name of the spans.
+             */
+            std::string name;
+
+            /**
+             * The number of recorded spans.
+             */
+            u64 calls = 0;
+
+            /**
+             * The accumulated wall time of all spans in nanoseconds.
+             */
+            u64 total_ns = 0;
+
+            /**
+             * The accumulated wall time of all spans in nanoseconds, excluding the time spent in nested spans.
+             */
+            u64 self_ns = 0;
+
+            /**
+             * The wall time of the longest span in nanoseconds.
+             */
+            u64 max_ns = 0;
+
+            /**
+             * The accumulated counters of all spans.
+             */
+            std::map<std::string, u64> counters;
+        };
+
+        namespace detail
+        {
+            CORE_API extern std::atomic<bool> enabled;
+
+            // the returned generation is passed on to end_span, spans of an older generation have been discarded by clear
+            CORE_API u64 begin_span(const char* name);
+            CORE_API u64 begin_span(const std::string& name);
+            CORE_API void end_span(u64 generation);
+            CORE_API void add_to_counter(const char* name, u64 value);
+            CORE_API void add_to_counter(const std::string& name, u64 value);
+        }    // namespace detail
+
+        /**
+         * Check whether tracing is enabled.
+         *
+         * @returns True if tracing is enabled, false otherwise.
+         */
+        inline bool is_enabled()
+        {
+            return detail::enabled.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Enable or disable tracing.<br>
+         * Spans that are already open when tracing is enabled are not recorded, spans that are open when tracing is disabled are still completed.
+         *
+         * @param[in] enable - True to enable tracing, false to disable it.
+         */
+        CORE_API void set_enabled(bool enable);
+
+        /**
+         * Discard all recorded spans and counters and restart the trace clock.<br>
+         * Spans that are open while clearing are discarded as well, closing them afterwards records nothing and does not affect spans opened after clearing.
+         */
+        CORE_API void clear();
+
+        /**
+         * Increment a counter of the innermost open span of the calling thread.<br>
+         * Does nothing if tracing is disabled or no span is open.
+         *
+         * @param[in] name - The name of the counter, must remain valid until the trace is cleared (e.g., a string literal).
+         * @param[in] value - The value to add.
+         */
+        inline void count(const char* name, u64 value = 1)
+        {
+            if (is_enabled())
+            {
+                detail::add_to_counter(name, value);
+            }
+        }
+
+        /**
+         * Increment a counter with a name that is computed at runtime of the innermost open span of the calling thread.<br>
+         * The name is copied, so prefer the `const char*` overload in hot code.
+         *
+         * @param[in] name - The name of the counter.
+         * @param[in] value - The value to add.
+         */
+        inline void count(const std::string& name, u64 value = 1)
+        {
+            if (is_enabled())
+            {
+                detail::add_to_counter(name, value);
+            }
+        }
+
+        /**
+         * Get the aggregated statistics of all recorded spans, sorted by descending total time.<br>
+         * Spans that are still open are not included.
+         *
+         * @returns A vector of span summaries.
+         */
+        CORE_API std::vector<SpanSummary> get_summary();
+
+        /**
+         * Get the aggregated statistics of all recorded spans as a human-readable table.
+         *
+         * @returns The table.
+         */
+        CORE_API std::string get_summary_table();
+
+        /**
+         * Get all recorded spans in the Chrome trace-event JSON format.
+         *
+         * @returns The JSON string.
+         */
+        CORE_API std::string get_chrome_trace();
+
+        /**
+         * Write all recorded spans to a file in the Chrome trace-event JSON format.
+         *
+         * @param[in] file_path - The path of the output file.
+         * @returns True on success, false otherwise.
+         */
+        CORE_API bool write_chrome_trace(const std::filesystem::path& file_path);
+
+        /**
+         * A scoped span that is opened on construction and closed on destruction.<br>
+         * Use the `HAL_TRACE_SCOPE` macro to create an anonymous span for the enclosing scope.
+         */
+        class Span
+        {
+        public:
+            /**
+             * Open a span if tracing is enabled.
+             *
+             * @param[in] name - The name of the span, must remain valid until the trace is cleared (e.g., a string literal).
+             */
+            explicit Span(const char* name) : m_active(is_enabled())
+            {
+                if (m_active)
+                {
+                    m_generation = detail::begin_span(name);
+                }
+            }
+
+            /**
+             * Open a span with a name that is computed at runtime if tracing is enabled.<br>
+             * The name is copied, so prefer the `const char*` overload in hot code.
+             *
+             * @param[in] name - The name of the span.
+             */
+            explicit Span(const std::string& name) : m_active(is_enabled())
+            {
+                if (m_active)
+                {
+                    m_generation = detail::begin_span(name);
+                }
+            }
+
+            ~Span()
+            {
+                if (m_active)
+                {
+                    detail::end_span(m_generation);
+                }
+            }
+
+            Span(const Span&)            = delete;
+            Span& operator=(const Span&) = delete;
+
+        private:
+            bool m_active;
+            u64 m_generation = 0;
+        };
+    }    // namespace trace
+}    // namespace hal
+
+#define HAL_TRACE_CONCAT_(a, b) a##b
+#define HAL_TRACE_CONCAT(a, b) HAL_TRACE_CONCAT_(a, b)
+
+/**
+ * Open a span named `name` that lasts until the end of the enclosing scope.
+ */
+#define HAL_TRACE_SCOPE(name) ::hal::trace::Span HAL_TRACE_CONCAT(hal_trace_span_, __LINE__)(name)
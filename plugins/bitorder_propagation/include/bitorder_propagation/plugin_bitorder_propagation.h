@@ -20,6 +20,7 @@ namespace hal
         /**
          * Propagates known bit order information to module pin groups with unknown bit order.
          * Afterwards the algorithm tries to reconstruct valid bit orders from the propagated information.
+         * The module pin groups are processed in parallel, the netlist is not modified.
          *
          * @param[in] known_bitorders - The known indices for the nets belonging to module pin groups. 
          * @param[in] unknown_bitorders - The module pin groups with yet unknown bit order.
@@ -33,6 +34,7 @@ namespace hal
 
         /**
          * This function reorders and renames the pins of the pin groups according to the corresponding bit order information. 
+         * The pins of each pin group are reordered in a single operation, pins without bit order information fill the remaining indices in their previous order.
          *
          * @param[in] ordered_module_pin_groups - A mapping from all the modules and pin groups with known bit order information to the knonw bit order information mapping every net to its corresponding index.
          * @returns OK if everything worked, Error otherwise.
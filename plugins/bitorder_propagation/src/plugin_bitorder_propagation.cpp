@@ -3,8 +3,12 @@
 #include "boost/functional/hash.hpp"
 #include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/module.h"
+#include "hal_core/utilities/parallel.h"
 
-#include <deque>
+#include <atomic>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
 
 // #define PRINT_CONFLICT
 // #define PRINT_CONNECTIVITY
@@ -535,14 +539,7 @@ namespace hal
                 return {};
             }
 
-            // TODO remove
-#ifdef PRINT_CONFLICT
-            std::cout << "Found complete bitorder for pingroup " << mpg.second->get_name() << std::endl;
-            for (const auto& [net, index] : complete_consens)
-            {
-                std::cout << net->get_id() << ": " << index << std::endl;
-            }
-#endif
+            log_debug("bitorder_propagation", "Found complete bitorder for pin group {} of module with ID {}.", mpg.second->get_name(), mpg.first->get_id());
 
             // ########################################################### //
             // ############### CONSENS FINDING - ALIGNMENT ############### //
@@ -605,20 +602,24 @@ namespace hal
             return aligned_consens;
         }
 
-    }    // namespace
 
-    Result<std::map<MPG, std::map<Net*, u32>>> BitorderPropagationPlugin::propagate_module_pingroup_bitorder(const std::map<MPG, std::map<Net*, u32>>& known_bitorders,
-                                                                                                             const std::set<MPG>& unknown_bitorders,
-                                                                                                             const bool strict_consens_finding)
-    {
-        std::unordered_map<std::pair<MPG, Net*>, std::vector<std::pair<MPG, Net*>>, boost::hash<std::pair<MPG, Net*>>> connectivity_inwards;
-        std::unordered_map<std::pair<MPG, Net*>, std::vector<std::pair<MPG, Net*>>, boost::hash<std::pair<MPG, Net*>>> connectivity_outwards;
+        struct PinGroupConnectivity
+        {
+            // for every net of the pin group, the module pin groups and nets it is connected to
+            std::vector<std::pair<Net*, std::vector<std::pair<MPG, Net*>>>> outwards;
+            std::vector<std::pair<Net*, std::vector<std::pair<MPG, Net*>>>> inwards;
+        };
 
-        // Build connectivity
-        for (const auto& [m, pg] : unknown_bitorders)
+        /*
+         * This function gathers the connected neighboring pingroups for all nets of a module pin group in both directions.
+         * It does not modify the netlist and may therefore be called for multiple pin groups in parallel.
+         */
+        Result<PinGroupConnectivity> gather_pin_group_connectivity(const MPG& mpg)
         {
-            bool successors = pg->get_direction() == PinDirection::output;
+            const auto& [m, pg] = mpg;
+            bool successors     = pg->get_direction() == PinDirection::output;
 
+            PinGroupConnectivity connectivity;
             for (const auto& p : pg->get_pins())
             {
                 const auto starting_net = p->get_net();
@@ -643,28 +644,71 @@ namespace hal
                 }
                 const auto connected_inwards = res_inwards.get();
 
-                for (const auto& [org_mpg, nets] : connected_outwards)
+                // ignore MPG origins that are connected via multiple nets
+                // if (nets.size() > 1)
+                // {
+                //     continue;
+                // }
+                if (!connected_outwards.empty())
                 {
-                    // ignore MPG origins that are connected via multiple nets
-                    // if (nets.size() > 1)
-                    // {
-                    //     continue;
-                    // }
-
-                    connectivity_outwards[{{m, pg}, starting_net}].push_back({org_mpg, *nets.begin()});
+                    auto& dst = connectivity.outwards.emplace_back(starting_net, std::vector<std::pair<MPG, Net*>>()).second;
+                    for (const auto& [org_mpg, nets] : connected_outwards)
+                    {
+                        dst.push_back({org_mpg, *nets.begin()});
+                    }
                 }
 
-                for (const auto& [org_mpg, nets] : connected_inwards)
+                if (!connected_inwards.empty())
                 {
-                    // ignore MPG origins that are connected via multiple nets
-                    // if (nets.size() > 1)
-                    // {
-                    //     continue;
-                    // }
-
-                    connectivity_inwards[{{m, pg}, starting_net}].push_back({org_mpg, *nets.begin()});
+                    auto& dst = connectivity.inwards.emplace_back(starting_net, std::vector<std::pair<MPG, Net*>>()).second;
+                    for (const auto& [org_mpg, nets] : connected_inwards)
+                    {
+                        dst.push_back({org_mpg, *nets.begin()});
+                    }
                 }
             }
+
+            return OK(connectivity);
+        }
+    }    // namespace
+
+    Result<std::map<MPG, std::map<Net*, u32>>> BitorderPropagationPlugin::propagate_module_pingroup_bitorder(const std::map<MPG, std::map<Net*, u32>>& known_bitorders,
+                                                                                                             const std::set<MPG>& unknown_bitorders,
+                                                                                                             const bool strict_consens_finding)
+    {
+        std::unordered_map<std::pair<MPG, Net*>, std::vector<std::pair<MPG, Net*>>, boost::hash<std::pair<MPG, Net*>>> connectivity_inwards;
+        std::unordered_map<std::pair<MPG, Net*>, std::vector<std::pair<MPG, Net*>>, boost::hash<std::pair<MPG, Net*>>> connectivity_outwards;
+
+        // Build connectivity, the module/pin group pairs are processed in parallel while the netlist is only read
+        const std::vector<MPG> unknown_mpgs(unknown_bitorders.begin(), unknown_bitorders.end());
+        std::vector<std::optional<Result<PinGroupConnectivity>>> gathered(unknown_mpgs.size());
+        std::atomic<size_t> next_unknown{0};
+        utils::run_workers(utils::get_num_threads(0, unknown_mpgs.size()), [&unknown_mpgs, &gathered, &next_unknown](u32) {
+            for (size_t i = next_unknown++; i < unknown_mpgs.size(); i = next_unknown++)
+            {
+                gathered[i] = gather_pin_group_connectivity(unknown_mpgs[i]);
+            }
+        });
+
+        for (u32 i = 0; i < unknown_mpgs.size(); i++)
+        {
+            if (gathered[i]->is_error())
+            {
+                return ERR_APPEND(gathered[i]->get_error(), "cannot propagate bitorder: failed to build connectivity");
+            }
+
+            const auto& mpg          = unknown_mpgs[i];
+            const auto& connectivity = gathered[i]->get();
+            for (const auto& [starting_net, connected] : connectivity.outwards)
+            {
+                auto& dst = connectivity_outwards[{mpg, starting_net}];
+                dst.insert(dst.end(), connected.begin(), connected.end());
+            }
+            for (const auto& [starting_net, connected] : connectivity.inwards)
+            {
+                auto& dst = connectivity_inwards[{mpg, starting_net}];
+                dst.insert(dst.end(), connected.begin(), connected.end());
+            }
         }
 
         // TODO remove debug printing
@@ -693,184 +737,170 @@ namespace hal
 
         std::map<MPG, std::map<Net*, u32>> wellformed_module_pin_groups = known_bitorders;
 
-        u32 iteration_ctr = 0;
-
-        while (true)
-        {
-            // find modules that are neither blocked nor are they already wellformed
-            std::vector<MPG> modules_and_pingroup;
-            for (const auto& mpg : unknown_bitorders)
-            {
-                if (mpg.first->is_top_module())
-                {
-                    log_error("bitorder_propagation", "Top module is part of the unknown bitorders!");
-                    continue;
-                }
-
-                // NOTE We can skip module/pin group pairs that are already wellformed
-                if (wellformed_module_pin_groups.find(mpg) == wellformed_module_pin_groups.end())
-                {
-                    modules_and_pingroup.push_back(mpg);
-                }
-            };
+        // tries to extract a bitorder for a single module/pin group pair from the bitorders known at the start of the current iteration
+        auto extract_bitorder = [&connectivity_inwards, &connectivity_outwards, &wellformed_module_pin_groups, strict_consens_finding](const MPG& mpg) -> std::map<Net*, u32> {
+            auto [m, pg] = mpg;
 
-            std::deque<MPG> q = {modules_and_pingroup.begin(), modules_and_pingroup.end()};
+            std::map<Net*, POSSIBLE_BITINDICES> collected_inwards;
+            std::map<Net*, POSSIBLE_BITINDICES> collected_outwards;
+            std::map<Net*, POSSIBLE_BITINDICES> collected_combined;
 
-            if (q.empty())
+            for (const auto& pin : pg->get_pins())
             {
-                break;
-            }
+                Net* starting_net = pin->get_net();
 
-            log_info("bitorder_propagation", "Starting {}bitorder propagation iteration {}.", (strict_consens_finding ? "strict " : ""), iteration_ctr);
+                // ############################################### //
+                // ################### INWARDS ################### //
+                // ############################################### //
 
-            std::map<MPG, std::map<Net*, u32>> new_wellformed_module_pin_groups = {};
+                if (auto con_it = connectivity_inwards.find({{m, pg}, starting_net}); con_it == connectivity_inwards.end())
+                {
+                    // log_warning("bitorder_propagation",
+                    //             "There are no valid origins connected to modue {} / {} with pin group {} and net {} / {}.",
+                    //             m->get_id(),
+                    //             m->get_name(),
+                    //             pg->get_name(),
+                    //             starting_net->get_id(),
+                    //             starting_net->get_name());
+                    continue;
+                }
 
-            while (!q.empty())
-            {
-                auto [m, pg] = q.front();
-                q.pop_front();
+                const auto& connected_inwards = connectivity_inwards.at({{m, pg}, starting_net});
 
-                // check wether m has submodules that are in the q
-                bool no_submodules_in_q = true;
-                for (const auto& sub_m : m->get_submodules(nullptr, true))
+                for (const auto& [org_mpg, org_net] : connected_inwards)
                 {
-                    for (const auto& [sm, sp] : q)
+                    if (auto mpg_it = wellformed_module_pin_groups.find(org_mpg); mpg_it != wellformed_module_pin_groups.end())
                     {
-                        if (sm == sub_m)
+                        const auto& nets = mpg_it->second;
+                        if (auto net_it = nets.find(org_net); net_it != nets.end())
+                        {
+                            collected_inwards[starting_net][org_mpg].insert(net_it->second);
+                            collected_combined[starting_net][org_mpg].insert(net_it->second);
+                        }
+                        else
                         {
-                            no_submodules_in_q = false;
-                            break;
+                            log_warning("bitorder_propagation",
+                                        "Module {} / {} and pin group {} are wellformed but are missing an index for net {} / {}!",
+                                        org_mpg.first->get_id(),
+                                        org_mpg.first->get_name(),
+                                        org_mpg.second->get_name(),
+                                        org_net->get_id(),
+                                        org_net->get_name());
                         }
                     }
                 }
 
-                if (!no_submodules_in_q)
+                // ############################################### //
+                // ################### OUTWARDS ################## //
+                // ############################################### //
+
+                if (auto con_it = connectivity_outwards.find({{m, pg}, starting_net}); con_it == connectivity_outwards.end())
                 {
-                    q.push_back({m, pg});
+                    // log_warning("bitorder_propagation",
+                    //             "There are no valid origins connected to modue {} / {} with pin group {} and net {} / {}.",
+                    //             m->get_id(),
+                    //             m->get_name(),
+                    //             pg->get_name(),
+                    //             starting_net->get_id(),
+                    //             starting_net->get_name());
                     continue;
                 }
 
-                bool successors = pg->get_direction() == PinDirection::output;
-
-                std::map<Net*, POSSIBLE_BITINDICES> collected_inwards;
-                std::map<Net*, POSSIBLE_BITINDICES> collected_outwards;
-                std::map<Net*, POSSIBLE_BITINDICES> collected_combined;
+                const auto& connected_outwards = connectivity_outwards.at({{m, pg}, starting_net});
 
-                for (const auto& pin : pg->get_pins())
+                for (const auto& [org_mpg, org_net] : connected_outwards)
                 {
-                    Net* starting_net = pin->get_net();
-
-                    // ############################################### //
-                    // ################### INWARDS ################### //
-                    // ############################################### //
-
-                    if (auto con_it = connectivity_inwards.find({{m, pg}, starting_net}); con_it == connectivity_inwards.end())
-                    {
-                        // log_warning("bitorder_propagation",
-                        //             "There are no valid origins connected to modue {} / {} with pin group {} and net {} / {}.",
-                        //             m->get_id(),
-                        //             m->get_name(),
-                        //             pg->get_name(),
-                        //             starting_net->get_id(),
-                        //             starting_net->get_name());
-                        continue;
-                    }
-
-                    const auto& connected_inwards = connectivity_inwards.at({{m, pg}, starting_net});
-
-                    for (const auto& [org_mpg, org_net] : connected_inwards)
+                    if (auto mpg_it = wellformed_module_pin_groups.find(org_mpg); mpg_it != wellformed_module_pin_groups.end())
                     {
-                        if (auto mpg_it = wellformed_module_pin_groups.find(org_mpg); mpg_it != wellformed_module_pin_groups.end())
+                        const auto& nets = mpg_it->second;
+                        if (auto net_it = nets.find(org_net); net_it != nets.end())
                         {
-                            const auto& nets = mpg_it->second;
-                            if (auto net_it = nets.find(org_net); net_it != nets.end())
-                            {
-                                collected_inwards[starting_net][org_mpg].insert(net_it->second);
-                                collected_combined[starting_net][org_mpg].insert(net_it->second);
-                            }
-                            else
-                            {
-                                log_warning("bitorder_propagation",
-                                            "Module {} / {} and pin group {} are wellformed but are missing an index for net {} / {}!",
-                                            org_mpg.first->get_id(),
-                                            org_mpg.first->get_name(),
-                                            org_mpg.second->get_name(),
-                                            org_net->get_id(),
-                                            org_net->get_name());
-                            }
+                            collected_outwards[starting_net][org_mpg].insert(net_it->second);
+                            collected_combined[starting_net][org_mpg].insert(net_it->second);
                         }
-                    }
-
-                    // ############################################### //
-                    // ################### OUTWARDS ################## //
-                    // ############################################### //
-
-                    if (auto con_it = connectivity_outwards.find({{m, pg}, starting_net}); con_it == connectivity_outwards.end())
-                    {
-                        // log_warning("bitorder_propagation",
-                        //             "There are no valid origins connected to modue {} / {} with pin group {} and net {} / {}.",
-                        //             m->get_id(),
-                        //             m->get_name(),
-                        //             pg->get_name(),
-                        //             starting_net->get_id(),
-                        //             starting_net->get_name());
-                        continue;
-                    }
-
-                    const auto& connected_outwards = connectivity_outwards.at({{m, pg}, starting_net});
-
-                    for (const auto& [org_mpg, org_net] : connected_outwards)
-                    {
-                        if (auto mpg_it = wellformed_module_pin_groups.find(org_mpg); mpg_it != wellformed_module_pin_groups.end())
+                        else
                         {
-                            const auto& nets = mpg_it->second;
-                            if (auto net_it = nets.find(org_net); net_it != nets.end())
-                            {
-                                collected_outwards[starting_net][org_mpg].insert(net_it->second);
-                                collected_combined[starting_net][org_mpg].insert(net_it->second);
-                            }
-                            else
-                            {
-                                log_warning("bitorder_propagation",
-                                            "Module {} / {} and pin group {} are wellformed but are missing an index for net {} / {}!",
-                                            org_mpg.first->get_id(),
-                                            org_mpg.first->get_name(),
-                                            org_mpg.second->get_name(),
-                                            org_net->get_id(),
-                                            org_net->get_name());
-                            }
+                            log_warning("bitorder_propagation",
+                                        "Module {} / {} and pin group {} are wellformed but are missing an index for net {} / {}!",
+                                        org_mpg.first->get_id(),
+                                        org_mpg.first->get_name(),
+                                        org_mpg.second->get_name(),
+                                        org_net->get_id(),
+                                        org_net->get_name());
                         }
                     }
                 }
+            }
 
 #ifdef PRINT_GENERAL
-                std::cout << "Extract for " << m->get_id() << " / " << m->get_name() << " - " << pg->get_name() << ": (INWARDS) " << std::endl;
+            std::cout << "Extract for " << m->get_id() << " / " << m->get_name() << " - " << pg->get_name() << ": (INWARDS) " << std::endl;
 #endif
 
-                const auto newly_wellformed_inwards = extract_well_formed_bitorder({m, pg}, collected_inwards, strict_consens_finding);
-                if (!newly_wellformed_inwards.empty())
-                {
-                    new_wellformed_module_pin_groups[{m, pg}] = newly_wellformed_inwards;
-                    continue;
-                }
+            const auto newly_wellformed_inwards = extract_well_formed_bitorder({m, pg}, collected_inwards, strict_consens_finding);
+            if (!newly_wellformed_inwards.empty())
+            {
+                return newly_wellformed_inwards;
+            }
+
+#ifdef PRINT_GENERAL
+            std::cout << "Extract for " << m->get_id() << " / " << m->get_name() << " - " << pg->get_name() << ": (OUTWARDS) " << std::endl;
+#endif
+            const auto newly_wellformed_outwards = extract_well_formed_bitorder({m, pg}, collected_outwards, strict_consens_finding);
+            if (!newly_wellformed_outwards.empty())
+            {
+                return newly_wellformed_outwards;
+            }
 
 #ifdef PRINT_GENERAL
-                std::cout << "Extract for " << m->get_id() << " / " << m->get_name() << " - " << pg->get_name() << ": (OUTWARDS) " << std::endl;
+            std::cout << "Extract for " << m->get_id() << " / " << m->get_name() << " - " << pg->get_name() << ": (COMBINED) " << std::endl;
 #endif
-                const auto newly_wellformed_outwards = extract_well_formed_bitorder({m, pg}, collected_outwards, strict_consens_finding);
-                if (!newly_wellformed_outwards.empty())
+            return extract_well_formed_bitorder({m, pg}, collected_combined, strict_consens_finding);
+        };
+
+        u32 iteration_ctr = 0;
+
+        while (true)
+        {
+            // find modules that are neither blocked nor are they already wellformed
+            std::vector<MPG> modules_and_pingroup;
+            for (const auto& mpg : unknown_bitorders)
+            {
+                if (mpg.first->is_top_module())
                 {
-                    new_wellformed_module_pin_groups[{m, pg}] = newly_wellformed_outwards;
+                    log_error("bitorder_propagation", "Top module is part of the unknown bitorders!");
                     continue;
                 }
 
-#ifdef PRINT_GENERAL
-                std::cout << "Extract for " << m->get_id() << " / " << m->get_name() << " - " << pg->get_name() << ": (COMBINED) " << std::endl;
-#endif
-                const auto newly_wellformed_combined = extract_well_formed_bitorder({m, pg}, collected_combined, strict_consens_finding);
-                if (!newly_wellformed_combined.empty())
+                // NOTE We can skip module/pin group pairs that are already wellformed
+                if (wellformed_module_pin_groups.find(mpg) == wellformed_module_pin_groups.end())
                 {
-                    new_wellformed_module_pin_groups[{m, pg}] = newly_wellformed_combined;
+                    modules_and_pingroup.push_back(mpg);
+                }
+            };
+
+            if (modules_and_pingroup.empty())
+            {
+                break;
+            }
+
+            log_info("bitorder_propagation", "Starting {}bitorder propagation iteration {}.", (strict_consens_finding ? "strict " : ""), iteration_ctr);
+
+            // bitorders found within an iteration only become visible in the next iteration, hence all pairs are independent of each other
+            std::vector<std::map<Net*, u32>> newly_wellformed(modules_and_pingroup.size());
+            std::atomic<size_t> next_mpg{0};
+            utils::run_workers(utils::get_num_threads(0, modules_and_pingroup.size()), [&modules_and_pingroup, &newly_wellformed, &next_mpg, &extract_bitorder](u32) {
+                for (size_t i = next_mpg++; i < modules_and_pingroup.size(); i = next_mpg++)
+                {
+                    newly_wellformed[i] = extract_bitorder(modules_and_pingroup[i]);
+                }
+            });
+
+            std::map<MPG, std::map<Net*, u32>> new_wellformed_module_pin_groups = {};
+            for (u32 i = 0; i < modules_and_pingroup.size(); i++)
+            {
+                if (!newly_wellformed[i].empty())
+                {
+                    new_wellformed_module_pin_groups[modules_and_pingroup[i]] = std::move(newly_wellformed[i]);
                 }
             }
 
@@ -926,23 +956,76 @@ namespace hal
                 }
             }
 
+            // pins with a known index are placed at that index, the remaining pins fill the free slots in their current order
+            const std::vector<ModulePin*> old_order = pg->get_pins();
+            std::vector<ModulePin*> new_order(old_order.size(), nullptr);
+            std::unordered_set<ModulePin*> placed_pins;
             for (const auto& [index, pin] : index_to_pin)
             {
-                auto move_res = m->move_pin_within_group(pg, pin, index);
-                if (move_res.is_error())
+                const i32 pos = pg->is_ascending() ? (i32)index - pg->get_start_index() : pg->get_start_index() - (i32)index;
+                if (pos < 0 || pos >= (i32)new_order.size())
                 {
-                    return ERR_APPEND(move_res.get_error(),
-                                      "cannot reorder module pin groups: failed to move pin " + pin->get_name() + " in pin group " + pg->get_name() + " of module with ID "
-                                          + std::to_string(m->get_id()) + " to new index " + std::to_string(index));
+                    return ERR("cannot reorder module pin groups: index " + std::to_string(index) + " of pin " + pin->get_name() + " is out of range for pin group " + pg->get_name()
+                               + " of module with ID " + std::to_string(m->get_id()));
                 }
+                new_order[pos] = pin;
+                placed_pins.insert(pin);
+            }
 
+            auto free_it = new_order.begin();
+            for (ModulePin* pin : old_order)
+            {
+                if (placed_pins.find(pin) != placed_pins.end())
+                {
+                    continue;
+                }
+                while (*free_it != nullptr)
+                {
+                    free_it++;
+                }
+                *free_it = pin;
+            }
+
+            if (new_order != old_order)
+            {
+                if (auto reorder_res = m->reorder_pins_within_group(pg, new_order); reorder_res.is_error())
+                {
+                    return ERR_APPEND(reorder_res.get_error(),
+                                      "cannot reorder module pin groups: failed to reorder pins in pin group " + pg->get_name() + " of module with ID " + std::to_string(m->get_id()));
+                }
+            }
+
+            // rename pins according to their index, pins that already carry the right name are left untouched
+            std::unordered_map<std::string, ModulePin*> pins_by_name;
+            for (ModulePin* pin : m->get_pins())
+            {
+                pins_by_name[pin->get_name()] = pin;
+            }
+
+            for (const auto& [index, pin] : index_to_pin)
+            {
                 const auto pin_name = pg->get_name() + "(" + std::to_string(index) + ")";
-                if (auto collision_pins = m->get_pins([pin_name](const ModulePin* pin) { return pin->get_name() == pin_name; }); !collision_pins.empty())
+                if (pin->get_name() == pin_name)
+                {
+                    continue;
+                }
+
+                if (auto collision_it = pins_by_name.find(pin_name); collision_it != pins_by_name.end())
                 {
-                    m->set_pin_name(collision_pins.front(), pin_name + "_OLD");
+                    ModulePin* collision_pin = collision_it->second;
+                    if (m->set_pin_name(collision_pin, pin_name + "_OLD"))
+                    {
+                        pins_by_name.erase(collision_it);
+                        pins_by_name[collision_pin->get_name()] = collision_pin;
+                    }
                 }
 
-                m->set_pin_name(pin, pin_name);
+                const std::string old_name = pin->get_name();
+                if (m->set_pin_name(pin, pin_name))
+                {
+                    pins_by_name.erase(old_name);
+                    pins_by_name[pin_name] = pin;
+                }
             }
         }
 
@@ -0,0 +1,245 @@
+#include "bitorder_propagation/plugin_bitorder_propagation.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+
+#include "netlist_test_utils.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace hal
+{
+    class BitorderPropagationTest : public ::testing::Test
+    {
+    protected:
+        typedef std::pair<Module*, PinGroup<ModulePin>*> MPG;
+
+        static constexpr u32 width = 6;
+
+        std::unique_ptr<Netlist> m_netlist;
+        // the nets of every bit between two buffer stages, i.e., m_stage_nets[s][j] is bit j before stage s
+        std::vector<std::vector<Net*>> m_stage_nets;
+        // the input and output pin groups of every module together with the stage index of their nets
+        std::vector<std::pair<MPG, u32>> m_pin_groups;
+        MPG m_known;
+
+        virtual void SetUp()
+        {
+            NO_COUT_BLOCK;
+            test_utils::init_log_channels();
+            create_chain();
+        }
+
+        virtual void TearDown()
+        {
+#ifdef _OPENMP
+            omp_set_num_threads(omp_get_num_procs());
+#endif
+        }
+
+        /*
+         * Six stages of 'width' buffers each, stage s driving the nets of stage s + 1.
+         * The first five stages are modules, stages 2 and 3 are nested into a common parent module.
+         * Only the output pin group of stage 0 has a known bit order, all other pin groups are created with their pins scrambled,
+         * so that the bit order has to travel along the chain (and through the parent module) over several iterations.
+         */
+        void create_chain()
+        {
+            m_netlist             = test_utils::create_empty_netlist();
+            const GateLibrary* gl = m_netlist->get_gate_library();
+
+            const u32 num_stages        = 6;
+            const u32 num_module_stages = 5;
+            m_stage_nets.resize(num_stages + 1);
+            for (u32 s = 0; s <= num_stages; s++)
+            {
+                for (u32 j = 0; j < width; j++)
+                {
+                    m_stage_nets[s].push_back(m_netlist->create_net("n_" + std::to_string(s) + "_" + std::to_string(j)));
+                }
+            }
+            for (Net* n : m_stage_nets.front())
+            {
+                m_netlist->mark_global_input_net(n);
+            }
+            for (Net* n : m_stage_nets.back())
+            {
+                m_netlist->mark_global_output_net(n);
+            }
+
+            std::vector<std::vector<Gate*>> stage_gates(num_stages);
+            for (u32 s = 0; s < num_stages; s++)
+            {
+                for (u32 j = 0; j < width; j++)
+                {
+                    Gate* buf = m_netlist->create_gate(gl->get_gate_type_by_name("BUF"), "buf_" + std::to_string(s) + "_" + std::to_string(j));
+                    m_stage_nets[s][j]->add_destination(buf, "I");
+                    m_stage_nets[s + 1][j]->add_source(buf, "O");
+                    stage_gates[s].push_back(buf);
+                }
+            }
+
+            Module* top    = m_netlist->get_top_module();
+            Module* parent = m_netlist->create_module("stages_2_3", top);
+            std::vector<std::pair<Module*, u32>> modules;
+            for (u32 s = 0; s < num_module_stages; s++)
+            {
+                modules.push_back({m_netlist->create_module("stage_" + std::to_string(s), (s == 2 || s == 3) ? parent : top, stage_gates[s]), s});
+            }
+            modules.push_back({parent, 2});
+
+            for (const auto& [m, s] : modules)
+            {
+                const u32 last_stage = (m == parent) ? 4 : s + 1;
+                for (const auto& [stage, direction] : {std::make_pair(s, PinDirection::input), std::make_pair(last_stage, PinDirection::output)})
+                {
+                    std::vector<ModulePin*> pins;
+                    for (Net* n : m_stage_nets[stage])
+                    {
+                        ModulePin* pin = m->get_pin_by_net(n);
+                        ASSERT_NE(pin, nullptr) << m->get_name() << ", net " << n->get_name();
+                        pins.push_back(pin);
+                    }
+
+                    const bool known = (s == 0 && direction == PinDirection::output && m != parent);
+                    if (!known)
+                    {
+                        // rotate and swap neighbors so that no pin keeps its index
+                        std::rotate(pins.begin(), pins.begin() + 2, pins.end());
+                        for (u32 j = 0; j + 1 < pins.size(); j += 2)
+                        {
+                            std::swap(pins[j], pins[j + 1]);
+                        }
+                    }
+
+                    const auto pg_res = m->create_pin_group(direction == PinDirection::input ? "in" : "out", pins, direction);
+                    ASSERT_TRUE(pg_res.is_ok());
+
+                    if (known)
+                    {
+                        m_known = {m, pg_res.get()};
+                    }
+                    else
+                    {
+                        m_pin_groups.push_back({{m, pg_res.get()}, stage});
+                    }
+                }
+            }
+        }
+
+        Result<std::map<MPG, std::map<Net*, u32>>> propagate(i32 num_threads) const
+        {
+#ifdef _OPENMP
+            omp_set_num_threads(num_threads);
+#endif
+            std::map<Net*, u32> known_bitorder;
+            for (u32 j = 0; j < width; j++)
+            {
+                known_bitorder[m_stage_nets[1][j]] = j;
+            }
+
+            std::set<MPG> unknown_bitorders;
+            for (const auto& [mpg, stage] : m_pin_groups)
+            {
+                unknown_bitorders.insert(mpg);
+            }
+
+            return BitorderPropagationPlugin::propagate_module_pingroup_bitorder({{m_known, known_bitorder}}, unknown_bitorders);
+        }
+    };
+
+    /**
+     * Test that bit orders are propagated along a chain of modules and through a parent module, and that the parallel propagation yields exactly the result of the serial one.
+     *
+     * Functions: BitorderPropagationPlugin::propagate_module_pingroup_bitorder
+     */
+    TEST_F(BitorderPropagationTest, check_parallel_matches_serial)
+    {
+        TEST_START
+        {
+            const auto serial_res = propagate(1);
+            ASSERT_TRUE(serial_res.is_ok());
+            const auto serial = serial_res.get();
+
+            // every pin group is reconstructed with bit j at index j
+            ASSERT_EQ(serial.size(), m_pin_groups.size() + 1);
+            for (const auto& [mpg, stage] : m_pin_groups)
+            {
+                const auto it = serial.find(mpg);
+                ASSERT_NE(it, serial.end()) << mpg.first->get_name() << " - " << mpg.second->get_name();
+
+                std::map<Net*, u32> expected;
+                for (u32 j = 0; j < width; j++)
+                {
+                    expected[m_stage_nets[stage][j]] = j;
+                }
+                EXPECT_EQ(it->second, expected) << mpg.first->get_name() << " - " << mpg.second->get_name();
+            }
+
+            for (i32 num_threads : {2, 4, 8})
+            {
+                const auto parallel_res = propagate(num_threads);
+                ASSERT_TRUE(parallel_res.is_ok());
+                EXPECT_EQ(parallel_res.get(), serial) << num_threads << " threads";
+            }
+        }
+        TEST_END
+    }
+
+    /**
+     * Test that the propagated bit orders are applied to the pin groups, reordering and renaming their pins.
+     *
+     * Functions: BitorderPropagationPlugin::reorder_module_pin_groups, Module::reorder_pins_within_group
+     */
+    TEST_F(BitorderPropagationTest, check_reorder_module_pin_groups)
+    {
+        TEST_START
+        {
+            const auto res = propagate(4);
+            ASSERT_TRUE(res.is_ok());
+
+            std::map<Module*, u32> pin_events;
+            std::function<void(ModuleEvent::event, Module*, u32)> count_pin_events = [&pin_events](ModuleEvent::event e, Module* m, u32) {
+                if (e == ModuleEvent::event::pin_changed)
+                {
+                    pin_events[m]++;
+                }
+            };
+
+            m_netlist->get_event_handler()->register_callback("bitorder_propagation_test", count_pin_events);
+
+            ASSERT_TRUE(BitorderPropagationPlugin::reorder_module_pin_groups(res.get()).is_ok());
+            m_netlist->get_event_handler()->unregister_callback("bitorder_propagation_test");
+
+            for (const auto& [mpg, stage] : m_pin_groups)
+            {
+                const auto& [m, pg] = mpg;
+                ASSERT_EQ(pg->size(), width);
+                for (u32 j = 0; j < width; j++)
+                {
+                    const auto pin_res = pg->get_pin_at_index(j);
+                    ASSERT_TRUE(pin_res.is_ok());
+                    EXPECT_EQ(pin_res.get()->get_net(), m_stage_nets[stage][j]) << m->get_name() << " - " << pg->get_name() << ", index " << j;
+                    EXPECT_EQ(pin_res.get()->get_name(), pg->get_name() + "(" + std::to_string(j) + ")");
+                }
+            }
+
+            // each pin group is reordered at once, only renaming issues an event per pin
+            for (const auto& [m, count] : pin_events)
+            {
+                EXPECT_LE(count, 2 * (1 + width)) << m->get_name();
+            }
+
+            // applying the same bit orders again does not change anything
+            pin_events.clear();
+            m_netlist->get_event_handler()->register_callback("bitorder_propagation_test", count_pin_events);
+            ASSERT_TRUE(BitorderPropagationPlugin::reorder_module_pin_groups(res.get()).is_ok());
+            m_netlist->get_event_handler()->unregister_callback("bitorder_propagation_test");
+            EXPECT_TRUE(pin_events.empty());
+        }
+        TEST_END
+    }
+}    // namespace hal
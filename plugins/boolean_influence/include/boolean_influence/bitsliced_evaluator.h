@@ -0,0 +1,190 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/utilities/result.h"
+#include "z3++.h"
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * Evaluates single-bit Boolean functions on many assignments at once by compiling them to an instruction tape that operates on bit-sliced values.<br>
+     * Every slot of the tape holds one bit for each of `BLOCK_SIZE` assignments, so that a single pass over the tape evaluates all functions for a whole block of assignments.
+     * The first two slots hold the constants zero and one, they are followed by the input slots and the slots computed by the instructions.
+     * Functions added to the same evaluator share their inputs as well as identical instructions.
+     */
+    class PLUGIN_API BitslicedEvaluator
+    {
+    public:
+        /**
+         * The number of 64-bit words per slot.
+         */
+        static constexpr u32 BLOCK_WORDS = 8;
+
+        /**
+         * The number of assignments that are evaluated at once.
+         */
+        static constexpr u32 BLOCK_SIZE = 64 * BLOCK_WORDS;
+
+        /**
+         * The slot holding the constant zero.
+         */
+        static constexpr u32 ZERO = 0;
+
+        /**
+         * The slot holding the constant one.
+         */
+        static constexpr u32 ONE = 1;
+
+        /**
+         * Create an evaluator without any inputs or instructions.
+         */
+        BitslicedEvaluator() = default;
+
+        /**
+         * Add a new input.
+         * Inputs must be added before the first instruction, since the input slots directly follow the constant slots.
+         *
+         * @returns The slot of the input on success, an error if the tape already contains instructions.
+         */
+        Result<u32> add_input();
+
+        /**
+         * Get the number of inputs.
+         *
+         * @returns The number of inputs.
+         */
+        u32 get_num_inputs() const;
+
+        /**
+         * Get the number of slots including constants and inputs.
+         *
+         * @returns The number of slots.
+         */
+        u32 get_num_slots() const;
+
+        /**
+         * Get the number of instructions of the tape.
+         *
+         * @returns The number of instructions.
+         */
+        u32 get_num_instructions() const;
+
+        /**
+         * Compile a z3 expression of width one into the tape.
+         * Supports Boolean and bit-vector conjunction, disjunction, negation, exclusive disjunction, equality, if-then-else, and constants.
+         *
+         * @param[in] e - The z3 expression.
+         * @param[in] input_slots - A map from the variable names to the slots of the inputs.
+         * @returns The slot holding the value of the expression on success, an error otherwise.
+         */
+        Result<u32> add_function(const z3::expr& e, const std::unordered_map<std::string, u32>& input_slots);
+
+        /**
+         * Compile a Boolean function of width one into the tape.
+         * Supports conjunction, disjunction, negation, exclusive disjunction, equality, if-then-else, and the constants zero and one.
+         *
+         * @param[in] bf - The Boolean function.
+         * @param[in] input_slots - A map from the variable names to the slots of the inputs.
+         * @returns The slot holding the value of the function on success, an error otherwise.
+         */
+        Result<u32> add_function(const BooleanFunction& bf, const std::unordered_map<std::string, u32>& input_slots);
+
+        /**
+         * Evaluate the tape for one block of assignments.
+         * The caller has to fill the input slots, the constant slots are filled by this function.
+         *
+         * @param[inout] values - The values of all slots, `BLOCK_WORDS` words per slot.
+         */
+        void evaluate(u64* values) const;
+
+        /**
+         * The result of counting the influences of the inputs on the outputs.
+         */
+        struct InfluenceCounts
+        {
+            /**
+             * The number of evaluated assignments.
+             */
+            u64 num_evaluations = 0;
+
+            /**
+             * For every output, the inputs the output structurally depends on in ascending order, each paired with the number of evaluated assignments for which flipping the input flips the output.
+             */
+            std::vector<std::vector<std::pair<u32, u64>>> counts;
+        };
+
+        /**
+         * Count for every output and every input the number of evaluated assignments for which flipping the input flips the output.<br>
+         * All inputs are analyzed in a single pass over the assignments: each block is evaluated once and afterwards only the instructions depending on the flipped input are re-evaluated.
+         * Blocks of assignments are distributed across multiple threads, the random assignments only depend on the seed and not on the number of threads.
+         *
+         * @param[in] outputs - The slots of the outputs.
+         * @param[in] num_evaluations - The number of random assignments to evaluate. Ignored if `exhaustive` is `true`.
+         * @param[in] exhaustive - Set `true` to evaluate all assignments of the inputs instead of random ones, which requires at most 32 inputs.
+         * @param[in] num_threads - The number of threads to use. Defaults to `0`, which uses as many threads as there are hardware threads.
+         * @param[in] seed - The seed of the random assignments.
+         * @returns The influence counts on success, an error otherwise.
+         */
+        Result<InfluenceCounts> count_influences(const std::vector<u32>& outputs, u64 num_evaluations, bool exhaustive = false, u32 num_threads = 0, u64 seed = 0) const;
+
+    private:
+        enum class OpCode : u8
+        {
+            And,
+            Or,
+            Xor,
+            Not,
+            Mux,
+        };
+
+        struct Instruction
+        {
+            OpCode op;
+            u32 dst;
+            u32 a;
+            u32 b;
+            u32 c;
+        };
+
+        u32 m_num_inputs = 0;
+        std::vector<Instruction> m_tape;
+        std::map<std::tuple<OpCode, u32, u32, u32>, u32> m_instruction_slots;
+
+        u32 emit(OpCode op, u32 a, u32 b = ZERO, u32 c = ZERO);
+
+        static void execute(const std::vector<Instruction>& tape, u64* values);
+    };
+}    // namespace hal
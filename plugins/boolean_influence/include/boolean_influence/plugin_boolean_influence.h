@@ -29,6 +29,8 @@
 #include "hal_core/plugin_system/plugin_interface_base.h"
 #include "hal_core/utilities/result.h"
 
+#include <functional>
+
 namespace hal
 {
     class Net;
@@ -48,83 +50,161 @@ namespace hal
          *
          * @param[in] bf - The Boolean function.
          * @param[in] num_evaluations - The amount of evaluations that are performed for each input variable.
-         * @param[in] unique_identifier - A unique identifier that is applied to file names to prevent collisions during multi-threading.
          * @returns A map from the variables that appear in the function to their Boolean influence on said function on success, an error otherwise.
          */
-        static Result<std::unordered_map<std::string, double>> get_boolean_influence(const BooleanFunction& bf, const u32 num_evaluations = 32000, const std::string& unique_identifier = "");
+        static Result<std::unordered_map<std::string, double>> get_boolean_influence(const BooleanFunction& bf, const u32 num_evaluations = 32000);
+
+        /**
+         * \deprecated
+         * DEPRECATED <br>
+         * Same as the overload without `unique_identifier`. The identifier used to name temporary files, but no files are written anymore, so it is ignored.
+         */
+        [[deprecated("Will be removed in a future version. Use the overload without unique_identifier instead.")]] static Result<std::unordered_map<std::string, double>> get_boolean_influence(const BooleanFunction& bf, const u32 num_evaluations, const std::string& unique_identifier);
 
         /**
          * Generates the Boolean influence of each input variable of a Boolean function.
          *
          * @param[in] e - The z3 expression representing a Boolean function.
          * @param[in] num_evaluations - The amount of evaluations that are performed for each input variable.
-         * @param[in] unique_identifier - A unique identifier that is applied to file names to prevent collisions during multi threading.
          * @returns A map from the variables that appear in the function to their Boolean influence on said function on success, an error otherwise.
          */
-        static Result<std::unordered_map<std::string, double>> get_boolean_influence(const z3::expr& e, const u32 num_evaluations = 32000, const std::string& unique_identifier = "");
+        static Result<std::unordered_map<std::string, double>> get_boolean_influence(const z3::expr& e, const u32 num_evaluations = 32000);
+
+        /**
+         * \deprecated
+         * DEPRECATED <br>
+         * Same as the overload without `unique_identifier`. The identifier used to name temporary files, but no files are written anymore, so it is ignored.
+         */
+        [[deprecated("Will be removed in a future version. Use the overload without unique_identifier instead.")]] static Result<std::unordered_map<std::string, double>> get_boolean_influence(const z3::expr& e, const u32 num_evaluations, const std::string& unique_identifier);
 
         /**
          * Generates the Boolean influence of each input variable of a Boolean function.
          *
          * @param[in] bf - The Boolean function.
-         * @param[in] unique_identifier - A unique identifier that is applied to file names to prevent collisions during multi-threading.
          * @returns A map from the variables that appear in the function to their Boolean influence on said function on success, an error otherwise.
          */
-        static Result<std::unordered_map<std::string, double>> get_boolean_influence_deterministic(const BooleanFunction& bf, const std::string& unique_identifier = "");
+        static Result<std::unordered_map<std::string, double>> get_boolean_influence_deterministic(const BooleanFunction& bf);
+
+        /**
+         * \deprecated
+         * DEPRECATED <br>
+         * Same as the overload without `unique_identifier`. The identifier used to name temporary files, but no files are written anymore, so it is ignored.
+         */
+        [[deprecated("Will be removed in a future version. Use the overload without unique_identifier instead.")]] static Result<std::unordered_map<std::string, double>> get_boolean_influence_deterministic(const BooleanFunction& bf, const std::string& unique_identifier);
 
         /**
          * Generates the Boolean influence of each input variable of a Boolean function.
          *
          * @param[in] e - The z3 expression representing a Boolean function.
-         * @param[in] unique_identifier - A unique identifier that is applied to file names to prevent collisions during multi threading.
          * @returns A map from the variables that appear in the function to their Boolean influence on said function on success, an error otherwise.
          */
-        static Result<std::unordered_map<std::string, double>> get_boolean_influence_deterministic(const z3::expr& e, const std::string& unique_identifier = "");
+        static Result<std::unordered_map<std::string, double>> get_boolean_influence_deterministic(const z3::expr& e);
+
+        /**
+         * \deprecated
+         * DEPRECATED <br>
+         * Same as the overload without `unique_identifier`. The identifier used to name temporary files, but no files are written anymore, so it is ignored.
+         */
+        [[deprecated("Will be removed in a future version. Use the overload without unique_identifier instead.")]] static Result<std::unordered_map<std::string, double>> get_boolean_influence_deterministic(const z3::expr& e, const std::string& unique_identifier);
 
         /**
          * Generates the function of the net using only the given gates.
-         * Afterwards the generated function gets translated from a z3::expr to efficent c code, compiled, executed and evaluated.
+         * Afterwards the generated function is compiled to a bit-sliced instruction tape and evaluated in-process.
          *
          * @param[in] gates - The gates of the subcircuit.
          * @param[in] start_net - The output net of the subcircuit at which to start the analysis.
          * @param[in] num_evaluations - The amount of evaluations that are performed for each input variable.
-         * @param[in] unique_identifier - A unique identifier that is applied to file names to prevent collisions during multi threading.
          * @returns A map from the nets that appear in the function of the start net to their Boolean influence on said function on success, an error otherwise.
          */
         static Result<std::map<Net*, double>>
-            get_boolean_influences_of_subcircuit(const std::vector<Gate*>& gates, const Net* start_net, const u32 num_evaluations = 32000, const std::string& unique_identifier = "");
+            get_boolean_influences_of_subcircuit(const std::vector<Gate*>& gates, const Net* start_net, const u32 num_evaluations = 32000);
+
+        /**
+         * \deprecated
+         * DEPRECATED <br>
+         * Same as the overload without `unique_identifier`. The identifier used to name temporary files, but no files are written anymore, so it is ignored.
+         */
+        [[deprecated("Will be removed in a future version. Use the overload without unique_identifier instead.")]] static Result<std::map<Net*, double>>
+            get_boolean_influences_of_subcircuit(const std::vector<Gate*>& gates, const Net* start_net, const u32 num_evaluations, const std::string& unique_identifier);
 
         /**
          * Generates the function of the dataport net of the given flip-flop.
-         * Afterwards the generated function gets translated from a z3::expr to efficient c code, compiled, executed and evaluated.
+         * Afterwards the generated function is compiled to a bit-sliced instruction tape and evaluated in-process.
          *
          * @param[in] gate - Pointer to the flip-flop which data input net is used to build the Boolean function.
          * @param[in] num_evaluations - The amount of evaluations that are performed for each input variable.
-         * @param[in] unique_identifier - A unique identifier that is applied to file names to prevent collisions during multi threading.
-         * @returns A map from the nets that appear in the function of the data net to their Boolean influence on said function on success, an error otherwise.
+         * @returns A map from the input nets of the fan-in cone of the data net to their Boolean influence on said function, which is `0.0` for nets without influence, on success, an error otherwise.
+         */
+        static Result<std::map<Net*, double>> get_boolean_influences_of_gate(const Gate* gate, const u32 num_evaluations = 32000);
+
+        /**
+         * \deprecated
+         * DEPRECATED <br>
+         * Same as the overload without `unique_identifier`. The identifier used to name temporary files, but no files are written anymore, so it is ignored.
          */
-        static Result<std::map<Net*, double>> get_boolean_influences_of_gate(const Gate* gate, const u32 num_evaluations = 32000, const std::string& unique_identifier = "");
+        [[deprecated("Will be removed in a future version. Use the overload without unique_identifier instead.")]] static Result<std::map<Net*, double>> get_boolean_influences_of_gate(const Gate* gate, const u32 num_evaluations, const std::string& unique_identifier);
 
         /**
          * Generates the function of the net using only the given gates.
-         * Afterwards the generated function gets translated from a z3::expr to efficent c code, compiled, executed and evaluated.
+         * Afterwards the generated function is compiled to a bit-sliced instruction tape and evaluated in-process.
          *
          * @param[in] gates - The gates of the subcircuit.
          * @param[in] start_net - The output net of the subcircuit at which to start the analysis.
-         * @param[in] unique_identifier - A unique identifier that is applied to file names to prevent collisions during multi threading.
          * @returns A map from the nets that appear in the function of the start net to their Boolean influence on said function on success, an error otherwise.
          */
-        static Result<std::map<Net*, double>> get_boolean_influences_of_subcircuit_deterministic(const std::vector<Gate*>& gates, const Net* start_net, const std::string& unique_identifier = "");
+        static Result<std::map<Net*, double>> get_boolean_influences_of_subcircuit_deterministic(const std::vector<Gate*>& gates, const Net* start_net);
+
+        /**
+         * \deprecated
+         * DEPRECATED <br>
+         * Same as the overload without `unique_identifier`. The identifier used to name temporary files, but no files are written anymore, so it is ignored.
+         */
+        [[deprecated("Will be removed in a future version. Use the overload without unique_identifier instead.")]] static Result<std::map<Net*, double>> get_boolean_influences_of_subcircuit_deterministic(const std::vector<Gate*>& gates, const Net* start_net, const std::string& unique_identifier);
 
         /**
          * Generates the function of the dataport net of the given flip-flop.
-         * Afterwards the generated function gets translated from a z3::expr to efficient c code, compiled, executed and evaluated.
+         * Afterwards the generated function is compiled to a bit-sliced instruction tape and evaluated in-process.
          *
          * @param[in] gate - Pointer to the flip-flop which data input net is used to build the Boolean function.
-         * @param[in] unique_identifier - A unique identifier that is applied to file names to prevent collisions during multi threading.
-         * @returns A map from the nets that appear in the function of the data net to their Boolean influence on said function on success, an error otherwise.
+         * @returns A map from the input nets of the fan-in cone of the data net to their Boolean influence on said function, which is `0.0` for nets without influence, on success, an error otherwise.
          */
-        static Result<std::map<Net*, double>> get_boolean_influences_of_gate_deterministic(const Gate* gate, const std::string& unique_identifier = "");
+        static Result<std::map<Net*, double>> get_boolean_influences_of_gate_deterministic(const Gate* gate);
+
+        /**
+         * \deprecated
+         * DEPRECATED <br>
+         * Same as the overload without `unique_identifier`. The identifier used to name temporary files, but no files are written anymore, so it is ignored.
+         */
+        [[deprecated("Will be removed in a future version. Use the overload without unique_identifier instead.")]] static Result<std::map<Net*, double>> get_boolean_influences_of_gate_deterministic(const Gate* gate, const std::string& unique_identifier);
+
+        /**
+         * Generates the Boolean influences of the nets feeding the data ports of all given flip-flops at once and passes them to a callback.<br>
+         * The fan-in cones of all flip-flops are extracted in a single pass and consecutive flip-flops are grouped into batches, so that logic shared by the cones of a batch is compiled once and evaluated once per block of samples.
+         * Batches are processed in parallel and the influences of the flip-flops of a batch are passed to the callback as soon as the batch is done, so that the complete influence matrix never needs to be held in memory.
+         * The callback is never called concurrently, but the order in which the flip-flops are reported is unspecified.
+         *
+         * @param[in] gates - The flip-flops.
+         * @param[in] callback - Called for each flip-flop with a map from the input nets of the fan-in cone of its data net to their Boolean influence on the data net, which is `0.0` for nets without influence.
+         * @param[in] num_evaluations - The amount of evaluations that are performed for each flip-flop.
+         * @param[in] num_threads - The number of threads to use. Defaults to `0`, which uses as many threads as there are hardware threads.
+         * @returns Ok() on success, an error otherwise.
+         */
+        static Result<std::monostate> get_boolean_influences_of_gates(const std::vector<Gate*>& gates,
+                                                                      const std::function<void(Gate*, const std::map<Net*, double>&)>& callback,
+                                                                      const u32 num_evaluations = 32000,
+                                                                      u32 num_threads           = 0);
+
+        /**
+         * Generates the Boolean influences of the nets feeding the data ports of all given flip-flops at once.<br>
+         * The fan-in cones of all flip-flops are extracted in a single pass and consecutive flip-flops are grouped into batches, so that logic shared by the cones of a batch is compiled once and evaluated once per block of samples.
+         * Batches are processed in parallel.
+         *
+         * @param[in] gates - The flip-flops.
+         * @param[in] num_evaluations - The amount of evaluations that are performed for each flip-flop.
+         * @param[in] num_threads - The number of threads to use. Defaults to `0`, which uses as many threads as there are hardware threads.
+         * @returns A sparse matrix mapping each flip-flop to a map from the input nets of the fan-in cone of its data net to their Boolean influence on the data net, which is `0.0` for nets without influence, on success, an error otherwise.
+         */
+        static Result<std::map<Gate*, std::map<Net*, double>>> get_boolean_influences_of_gates(const std::vector<Gate*>& gates, const u32 num_evaluations = 32000, const u32 num_threads = 0);
 
         /**
          * Get the FF dependency matrix of a netlist.
@@ -137,18 +217,14 @@ namespace hal
         static Result<std::pair<std::map<u32, Gate*>, std::vector<std::vector<double>>>> get_ff_dependency_matrix(const Netlist* netlist, bool with_boolean_influence);
 
     private:
-        static const std::string probabilistic_function;
-        static const std::string deterministic_function;
-
         static Result<std::unordered_map<std::string, double>>
-            get_boolean_influence_internal(const z3::expr& e, const u32 num_evaluations, const bool deterministic, const std::string& unique_identifier);
+            get_boolean_influence_internal(const z3::expr& e, const u32 num_evaluations, const bool deterministic);
 
         static Result<std::map<Net*, double>> get_boolean_influences_of_subcircuit_internal(const std::vector<Gate*>& gates,
                                                                                             const Net* start_net,
                                                                                             const u32 num_evaluations,
-                                                                                            const bool deterministic,
-                                                                                            const std::string& unique_identifier);
+                                                                                            const bool deterministic);
 
-        static Result<std::map<Net*, double>> get_boolean_influences_of_gate_internal(const Gate* gate, const u32 num_evaluations, const bool deterministic, const std::string& unique_identifier);
+        static Result<std::map<Net*, double>> get_boolean_influences_of_gate_internal(const Gate* gate, const u32 num_evaluations, const bool deterministic);
     };
 }    // namespace hal
@@ -10,6 +10,22 @@ namespace py = pybind11;
 
 namespace hal
 {
+    namespace
+    {
+        void warn_unique_identifier_deprecated(const std::string& unique_identifier)
+        {
+            if (unique_identifier.empty())
+            {
+                return;
+            }
+
+            py::gil_scoped_acquire acquire;
+            if (PyErr_WarnEx(PyExc_DeprecationWarning, "unique_identifier is deprecated and ignored, since no files are written anymore.", 1) < 0)
+            {
+                throw py::error_already_set();
+            }
+        }
+    }    // namespace
 
     // the name in PYBIND11_MODULE/PYBIND11_PLUGIN *MUST* match the filename of the output library (without extension),
     // otherwise you will get "ImportError: dynamic module does not define module export function" when importing the module
@@ -32,7 +48,8 @@ namespace hal
             .def_static(
                 "get_boolean_influence",
                 [](const BooleanFunction& bf, const u32 num_evaluations = 32000, const std::string& unique_identifier = "") -> std::optional<std::unordered_map<std::string, double>> {
-                    const auto res = BooleanInfluencePlugin::get_boolean_influence(bf, num_evaluations, unique_identifier);
+                    warn_unique_identifier_deprecated(unique_identifier);
+                    const auto res = BooleanInfluencePlugin::get_boolean_influence(bf, num_evaluations);
                     if (res.is_ok())
                     {
                         return res.get();
@@ -46,20 +63,22 @@ namespace hal
                 py::arg("bf"),
                 py::arg("num_evaluations")   = 32000,
                 py::arg("unique_identifier") = "",
+                py::call_guard<py::gil_scoped_release>(),
                 R"(
-                The Boolean function gets translated to a z3::expr and afterwards efficent c code.
-                The program is compiled and executed many times to meassure the Boolean influence of each input variable.
+                The Boolean function gets translated to a z3::expr and afterwards compiled to a bit-sliced instruction tape.
+                The tape is evaluated in-process for many random input assignments to meassure the Boolean influence of each input variable.
 
                 :param hal_py.BooleanFunction bf: The Boolean function.
                 :param int num_evaluations: The amount of evaluations that are performed for each input variable.
-                :param str unique_identifier: A unique identifier that is applied to file names to prevent collisions during multi-threading.
+                :param str unique_identifier: Deprecated and ignored, since no files are written anymore. Passing an identifier issues a DeprecationWarning.
                 :returns: A dict from the variables that appear in the function to their Boolean influence on said function on success, None otherwise.
                 :rtype: dict[str,float] or None
             )")
             .def_static(
                 "get_boolean_influences_of_subcircuit",
                 [](const std::vector<Gate*>& gates, const Net* start_net, const u32 num_evaluations = 32000, const std::string& unique_identifier = "") -> std::optional<std::map<Net*, double>> {
-                    const auto res = BooleanInfluencePlugin::get_boolean_influences_of_subcircuit(gates, start_net, num_evaluations, unique_identifier);
+                    warn_unique_identifier_deprecated(unique_identifier);
+                    const auto res = BooleanInfluencePlugin::get_boolean_influences_of_subcircuit(gates, start_net, num_evaluations);
                     if (res.is_ok())
                     {
                         return res.get();
@@ -74,21 +93,23 @@ namespace hal
                 py::arg("start_net"),
                 py::arg("num_evaluations")   = 32000,
                 py::arg("unique_identifier") = "",
+                py::call_guard<py::gil_scoped_release>(),
                 R"(
                 Generates the function of the net using only the given gates.
-                Afterwards the generated function gets translated from a z3::expr to efficent c code, compiled, executed and evalated.
+                Afterwards the generated function is compiled to a bit-sliced instruction tape and evaluated in-process.
 
                 :param list[hal_py.Gate] gates: The gates of the subcircuit.
                 :param hal_py.Net start_net: The output net of the subcircuit at which to start the analysis.
                 :param int num_evaluations: The amount of evaluations that are performed for each input variable.
-                :param str unique_identifier: A unique identifier that is applied to file names to prevent collisions during multi-threading.
+                :param str unique_identifier: Deprecated and ignored, since no files are written anymore. Passing an identifier issues a DeprecationWarning.
                 :returns: A dict from the nets that appear in the function of the start net to their Boolean influence on said function on success, None otherwise.
                 :rtype: dict[hal_py.Net,float] or None
             )")
             .def_static(
                 "get_boolean_influences_of_gate",
                 [](const Gate* gate, const u32 num_evaluations = 32000, const std::string& unique_identifier = "") -> std::optional<std::map<Net*, double>> {
-                    const auto res = BooleanInfluencePlugin::get_boolean_influences_of_gate(gate, num_evaluations, unique_identifier);
+                    warn_unique_identifier_deprecated(unique_identifier);
+                    const auto res = BooleanInfluencePlugin::get_boolean_influences_of_gate(gate, num_evaluations);
                     if (res.is_ok())
                     {
                         return res.get();
@@ -102,20 +123,51 @@ namespace hal
                 py::arg("gate"),
                 py::arg("num_evaluations")   = 32000,
                 py::arg("unique_identifier") = "",
+                py::call_guard<py::gil_scoped_release>(),
                 R"(
                 Generates the function of the dataport net of the given flip-flop.
-                Afterwards the generated function gets translated from a z3::expr to efficent c code, compiled, executed and evalated.
+                Afterwards the generated function is compiled to a bit-sliced instruction tape and evaluated in-process.
 
                 :param hal_py.Gate gate: The flip-flop which data input net is used to build the boolean function.
                 :param int num_evaluations: The amount of evaluations that are performed for each input variable.
-                :param str unique_identifier: A unique identifier that is applied to file names to prevent collisions during multi-threading.
-                :returns: A dict from the nets that appear in the function of the data net to their Boolean influence on said function on success, None otherwise.
+                :param str unique_identifier: Deprecated and ignored, since no files are written anymore. Passing an identifier issues a DeprecationWarning.
+                :returns: A dict from the input nets of the fan-in cone of the data net to their Boolean influence on said function, which is ``0.0`` for nets without influence, on success, None otherwise.
                 :rtype: dict[hal_py.Net,float]
             )")
+            .def_static(
+                "get_boolean_influences_of_gates",
+                [](const std::vector<Gate*>& gates, const u32 num_evaluations = 32000, const u32 num_threads = 0) -> std::optional<std::map<Gate*, std::map<Net*, double>>> {
+                    auto res = BooleanInfluencePlugin::get_boolean_influences_of_gates(gates, num_evaluations, num_threads);
+                    if (res.is_ok())
+                    {
+                        return res.get();
+                    }
+                    else
+                    {
+                        log_error("python_context", "cannot get Boolean influences of flip-flop data fan-ins:\n{}", res.get_error().get());
+                        return std::nullopt;
+                    }
+                },
+                py::arg("gates"),
+                py::arg("num_evaluations") = 32000,
+                py::arg("num_threads")     = 0,
+                py::call_guard<py::gil_scoped_release>(),
+                R"(
+                Generates the Boolean influences of the nets feeding the data ports of all given flip-flops at once.
+                The fan-in cones of all flip-flops are extracted in a single pass and consecutive flip-flops are grouped into batches, so that logic shared by the cones of a batch is compiled once and evaluated once per block of samples.
+                Batches are processed in parallel.
+
+                :param list[hal_py.Gate] gates: The flip-flops.
+                :param int num_evaluations: The amount of evaluations that are performed for each flip-flop.
+                :param int num_threads: The number of threads to use. Defaults to ``0``, which uses as many threads as there are hardware threads.
+                :returns: A dict from each flip-flop to a dict from the input nets of the fan-in cone of its data net to their Boolean influence on the data net, which is ``0.0`` for nets without influence, on success, None otherwise.
+                :rtype: dict[hal_py.Gate,dict[hal_py.Net,float]] or None
+            )")
             .def_static(
                 "get_boolean_influence_deterministic",
                 [](const BooleanFunction& bf, const std::string& unique_identifier = "") -> std::optional<std::unordered_map<std::string, double>> {
-                    const auto res = BooleanInfluencePlugin::get_boolean_influence_deterministic(bf, unique_identifier);
+                    warn_unique_identifier_deprecated(unique_identifier);
+                    const auto res = BooleanInfluencePlugin::get_boolean_influence_deterministic(bf);
                     if (res.is_ok())
                     {
                         return res.get();
@@ -128,19 +180,21 @@ namespace hal
                 },
                 py::arg("bf"),
                 py::arg("unique_identifier") = "",
+                py::call_guard<py::gil_scoped_release>(),
                 R"(
-                The Boolean function gets translated to a z3::expr and afterwards efficent c code.
-                The program is compiled and executed exactly once for every possible input mapping to accuratley determine the boolean influence of each variable.
+                The Boolean function gets translated to a z3::expr and afterwards compiled to a bit-sliced instruction tape.
+                The tape is evaluated in-process exactly once for every possible input mapping to accuratley determine the boolean influence of each variable.
 
                 :param hal_py.BooleanFunction bf: The Boolean function.
-                :param str unique_identifier: A unique identifier that is applied to file names to prevent collisions during multi-threading.
+                :param str unique_identifier: Deprecated and ignored, since no files are written anymore. Passing an identifier issues a DeprecationWarning.
                 :returns: A dict from the variables that appear in the function to their Boolean influence on said function on success, None otherwise.
                 :rtype: dict[str,float] or None
             )")
             .def_static(
                 "get_boolean_influences_of_subcircuit_deterministic",
                 [](const std::vector<Gate*>& gates, const Net* start_net, const std::string& unique_identifier = "") -> std::optional<std::map<Net*, double>> {
-                    const auto res = BooleanInfluencePlugin::get_boolean_influences_of_subcircuit_deterministic(gates, start_net, unique_identifier);
+                    warn_unique_identifier_deprecated(unique_identifier);
+                    const auto res = BooleanInfluencePlugin::get_boolean_influences_of_subcircuit_deterministic(gates, start_net);
                     if (res.is_ok())
                     {
                         return res.get();
@@ -154,20 +208,22 @@ namespace hal
                 py::arg("gates"),
                 py::arg("start_net"),
                 py::arg("unique_identifier") = "",
+                py::call_guard<py::gil_scoped_release>(),
                 R"(
                 Generates the function of the net using only the given gates.
-                Afterwards the generated function gets translated from a z3::expr to efficent c code, compiled, executed and evalated.
+                Afterwards the generated function is compiled to a bit-sliced instruction tape and evaluated in-process.
 
                 :param list[hal_py.Gate] gates: The gates of the subcircuit.
                 :param hal_py.Net start_net: The output net of the subcircuit at which to start the analysis.
-                :param str unique_identifier: A unique identifier that is applied to file names to prevent collisions during multi-threading.
+                :param str unique_identifier: Deprecated and ignored, since no files are written anymore. Passing an identifier issues a DeprecationWarning.
                 :returns: A dict from the nets that appear in the function of the start net to their Boolean influence on said function on success, None otherwise.
                 :rtype: dict[hal_py.Net,float] or None
             )")
             .def_static(
                 "get_boolean_influences_of_gate_deterministic",
                 [](const Gate* gate, const std::string& unique_identifier = "") -> std::optional<std::map<Net*, double>> {
-                    const auto res = BooleanInfluencePlugin::get_boolean_influences_of_gate_deterministic(gate, unique_identifier);
+                    warn_unique_identifier_deprecated(unique_identifier);
+                    const auto res = BooleanInfluencePlugin::get_boolean_influences_of_gate_deterministic(gate);
                     if (res.is_ok())
                     {
                         return res.get();
@@ -180,13 +236,14 @@ namespace hal
                 },
                 py::arg("gate"),
                 py::arg("unique_identifier") = "",
+                py::call_guard<py::gil_scoped_release>(),
                 R"(
                 Generates the function of the dataport net of the given flip-flop.
-                Afterwards the generated function gets translated from a z3::expr to efficent c code, compiled, executed and evalated.
+                Afterwards the generated function is compiled to a bit-sliced instruction tape and evaluated in-process.
 
                 :param hal_py.Gate gate: The flip-flop which data input net is used to build the boolean function.
-                :param str unique_identifier: A unique identifier that is applied to file names to prevent collisions during multi-threading.
-                :returns: A dict from the nets that appear in the function of the data net to their Boolean influence on said function on success, None otherwise.
+                :param str unique_identifier: Deprecated and ignored, since no files are written anymore. Passing an identifier issues a DeprecationWarning.
+                :returns: A dict from the input nets of the fan-in cone of the data net to their Boolean influence on said function, which is ``0.0`` for nets without influence, on success, None otherwise.
                 :rtype: dict[hal_py.Net,float]
             )")
             .def_static(
@@ -205,6 +262,7 @@ namespace hal
                 },
                 py::arg("netlist"),
                 py::arg("with_boolean_influence"),
+                py::call_guard<py::gil_scoped_release>(),
                 R"(
                 Get the FF dependency matrix of a netlist, with or without boolean influences.
 
@@ -0,0 +1,623 @@
+#include "boolean_influence/bitsliced_evaluator.h"
+
+#include "hal_core/utilities/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+namespace hal
+{
+    namespace
+    {
+        // minimum number of instruction evaluations that justify an additional thread
+        constexpr u64 MIN_WORK_PER_THREAD = 1 << 18;
+
+        // number of blocks a thread claims at once
+        constexpr u64 BLOCKS_PER_CLAIM = 4;
+
+        constexpr u32 NO_SLOT = std::numeric_limits<u32>::max();
+
+        // the words of the first six inputs in exhaustive mode, bit j of input k is bit k of j
+        constexpr u64 EXHAUSTIVE_PATTERNS[6] = {0xAAAAAAAAAAAAAAAAULL, 0xCCCCCCCCCCCCCCCCULL, 0xF0F0F0F0F0F0F0F0ULL, 0xFF00FF00FF00FF00ULL, 0xFFFF0000FFFF0000ULL, 0xFFFFFFFF00000000ULL};
+
+        u64 splitmix64(u64& state)
+        {
+            u64 z = (state += 0x9E3779B97F4A7C15ULL);
+            z     = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z     = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+
+        bool has_width_one(const z3::expr& e)
+        {
+            return e.is_bool() || (e.is_bv() && e.get_sort().bv_size() == 1);
+        }
+    }    // namespace
+
+    Result<u32> BitslicedEvaluator::add_input()
+    {
+        if (!m_tape.empty())
+        {
+            return ERR("could not add input: inputs must be added before the first instruction, but the tape already contains " + std::to_string(m_tape.size()) + " instructions");
+        }
+        return OK(2 + m_num_inputs++);
+    }
+
+    u32 BitslicedEvaluator::get_num_inputs() const
+    {
+        return m_num_inputs;
+    }
+
+    u32 BitslicedEvaluator::get_num_slots() const
+    {
+        return 2 + m_num_inputs + m_tape.size();
+    }
+
+    u32 BitslicedEvaluator::get_num_instructions() const
+    {
+        return m_tape.size();
+    }
+
+    u32 BitslicedEvaluator::emit(OpCode op, u32 a, u32 b, u32 c)
+    {
+        // fold constants and trivial operations
+        switch (op)
+        {
+            case OpCode::And:
+                if (a == ZERO || b == ZERO)
+                {
+                    return ZERO;
+                }
+                if (a == ONE || a == b)
+                {
+                    return b;
+                }
+                if (b == ONE)
+                {
+                    return a;
+                }
+                break;
+            case OpCode::Or:
+                if (a == ONE || b == ONE)
+                {
+                    return ONE;
+                }
+                if (a == ZERO || a == b)
+                {
+                    return b;
+                }
+                if (b == ZERO)
+                {
+                    return a;
+                }
+                break;
+            case OpCode::Xor:
+                if (a == b)
+                {
+                    return ZERO;
+                }
+                if (a == ZERO)
+                {
+                    return b;
+                }
+                if (b == ZERO)
+                {
+                    return a;
+                }
+                if (a == ONE)
+                {
+                    return emit(OpCode::Not, b);
+                }
+                if (b == ONE)
+                {
+                    return emit(OpCode::Not, a);
+                }
+                break;
+            case OpCode::Not:
+                if (a <= ONE)
+                {
+                    return ONE - a;
+                }
+                b = ZERO;
+                c = ZERO;
+                break;
+            case OpCode::Mux:
+                if (a <= ONE)
+                {
+                    return a == ONE ? b : c;
+                }
+                if (b == c)
+                {
+                    return b;
+                }
+                break;
+        }
+
+        // commutative operations are normalized to find more identical instructions
+        if (op != OpCode::Not && op != OpCode::Mux && a > b)
+        {
+            std::swap(a, b);
+        }
+
+        const auto key = std::make_tuple(op, a, b, c);
+        if (const auto it = m_instruction_slots.find(key); it != m_instruction_slots.end())
+        {
+            return it->second;
+        }
+
+        const u32 dst = get_num_slots();
+        m_tape.push_back({op, dst, a, b, c});
+        m_instruction_slots.emplace(key, dst);
+        return dst;
+    }
+
+    Result<u32> BitslicedEvaluator::add_function(const z3::expr& e, const std::unordered_map<std::string, u32>& input_slots)
+    {
+        // translate the expression in post-order without recursion, since expressions of large circuits may be very deep
+        std::unordered_map<u32, u32> z3_slots;
+        std::vector<std::pair<z3::expr, bool>> stack = {{e, false}};
+        while (!stack.empty())
+        {
+            const z3::expr current = stack.back().first;
+            const bool expanded    = stack.back().second;
+            stack.pop_back();
+
+            const u32 id = current.id();
+            if (z3_slots.find(id) != z3_slots.end())
+            {
+                continue;
+            }
+
+            if (!has_width_one(current))
+            {
+                return ERR("could not compile z3 expression: expected a width of 1 for subexpression " + current.to_string());
+            }
+
+            if (!current.is_app())
+            {
+                return ERR("could not compile z3 expression: unsupported subexpression " + current.to_string());
+            }
+
+            const u32 num_args = current.num_args();
+            if (!expanded)
+            {
+                stack.push_back({current, true});
+                for (u32 i = 0; i < num_args; i++)
+                {
+                    if (z3_slots.find(current.arg(i).id()) == z3_slots.end())
+                    {
+                        stack.push_back({current.arg(i), false});
+                    }
+                }
+                continue;
+            }
+
+            std::vector<u32> args;
+            for (u32 i = 0; i < num_args; i++)
+            {
+                args.push_back(z3_slots.at(current.arg(i).id()));
+            }
+
+            auto fold = [this, &args](OpCode op) {
+                u32 slot = args.front();
+                for (u32 i = 1; i < args.size(); i++)
+                {
+                    slot = emit(op, slot, args.at(i));
+                }
+                return slot;
+            };
+
+            u32 slot;
+            switch (current.decl().decl_kind())
+            {
+                case Z3_OP_UNINTERPRETED:
+                    if (num_args != 0)
+                    {
+                        return ERR("could not compile z3 expression: unsupported function application " + current.to_string());
+                    }
+                    if (const auto it = input_slots.find(current.decl().name().str()); it != input_slots.end())
+                    {
+                        slot = it->second;
+                    }
+                    else
+                    {
+                        return ERR("could not compile z3 expression: no input slot given for variable '" + current.decl().name().str() + "'");
+                    }
+                    break;
+                case Z3_OP_TRUE:
+                    slot = ONE;
+                    break;
+                case Z3_OP_FALSE:
+                    slot = ZERO;
+                    break;
+                case Z3_OP_BNUM:
+                    slot = (current.get_numeral_uint64() & 1) ? ONE : ZERO;
+                    break;
+                case Z3_OP_AND:
+                case Z3_OP_BAND:
+                    slot = fold(OpCode::And);
+                    break;
+                case Z3_OP_OR:
+                case Z3_OP_BOR:
+                    slot = fold(OpCode::Or);
+                    break;
+                case Z3_OP_XOR:
+                case Z3_OP_BXOR:
+                    slot = fold(OpCode::Xor);
+                    break;
+                case Z3_OP_NOT:
+                case Z3_OP_BNOT:
+                    slot = emit(OpCode::Not, args.at(0));
+                    break;
+                case Z3_OP_BNAND:
+                    slot = emit(OpCode::Not, fold(OpCode::And));
+                    break;
+                case Z3_OP_BNOR:
+                    slot = emit(OpCode::Not, fold(OpCode::Or));
+                    break;
+                case Z3_OP_BXNOR:
+                    slot = emit(OpCode::Not, fold(OpCode::Xor));
+                    break;
+                case Z3_OP_EQ:
+                case Z3_OP_IFF:
+                    if (num_args != 2 || !has_width_one(current.arg(0)))
+                    {
+                        return ERR("could not compile z3 expression: unsupported equality " + current.to_string());
+                    }
+                    slot = emit(OpCode::Not, emit(OpCode::Xor, args.at(0), args.at(1)));
+                    break;
+                case Z3_OP_DISTINCT:
+                    if (num_args != 2)
+                    {
+                        return ERR("could not compile z3 expression: unsupported distinct " + current.to_string());
+                    }
+                    slot = emit(OpCode::Xor, args.at(0), args.at(1));
+                    break;
+                case Z3_OP_ITE:
+                    slot = emit(OpCode::Mux, args.at(0), args.at(1), args.at(2));
+                    break;
+                default:
+                    return ERR("could not compile z3 expression: unsupported operation '" + current.decl().name().str() + "'");
+            }
+
+            z3_slots.emplace(id, slot);
+        }
+
+        return OK(z3_slots.at(e.id()));
+    }
+
+    Result<u32> BitslicedEvaluator::add_function(const BooleanFunction& bf, const std::unordered_map<std::string, u32>& input_slots)
+    {
+        if (bf.size() != 1)
+        {
+            return ERR("could not compile Boolean function: expected a bit-size of 1, but got " + std::to_string(bf.size()));
+        }
+
+        std::vector<u32> stack;
+        for (const auto& node : bf.get_nodes())
+        {
+            if (stack.size() < node.get_arity())
+            {
+                return ERR("could not compile Boolean function: invalid number of operands");
+            }
+            std::vector<u32> operands(stack.end() - node.get_arity(), stack.end());
+            stack.erase(stack.end() - node.get_arity(), stack.end());
+
+            switch (node.type)
+            {
+                case BooleanFunction::NodeType::Constant:
+                    if (node.has_constant_value(0))
+                    {
+                        stack.push_back(ZERO);
+                    }
+                    else if (node.has_constant_value(1))
+                    {
+                        stack.push_back(ONE);
+                    }
+                    else
+                    {
+                        return ERR("could not compile Boolean function: unsupported constant " + node.to_string());
+                    }
+                    break;
+                case BooleanFunction::NodeType::Variable:
+                    if (const auto it = input_slots.find(node.variable); it != input_slots.end())
+                    {
+                        stack.push_back(it->second);
+                    }
+                    else
+                    {
+                        return ERR("could not compile Boolean function: no input slot given for variable '" + node.variable + "'");
+                    }
+                    break;
+                case BooleanFunction::NodeType::And:
+                    stack.push_back(emit(OpCode::And, operands[0], operands[1]));
+                    break;
+                case BooleanFunction::NodeType::Or:
+                    stack.push_back(emit(OpCode::Or, operands[0], operands[1]));
+                    break;
+                case BooleanFunction::NodeType::Not:
+                    stack.push_back(emit(OpCode::Not, operands[0]));
+                    break;
+                case BooleanFunction::NodeType::Xor:
+                    stack.push_back(emit(OpCode::Xor, operands[0], operands[1]));
+                    break;
+                case BooleanFunction::NodeType::Eq:
+                    stack.push_back(emit(OpCode::Not, emit(OpCode::Xor, operands[0], operands[1])));
+                    break;
+                case BooleanFunction::NodeType::Ite:
+                    stack.push_back(emit(OpCode::Mux, operands[0], operands[1], operands[2]));
+                    break;
+                default:
+                    return ERR("could not compile Boolean function: unsupported node " + node.to_string());
+            }
+        }
+
+        if (stack.size() != 1)
+        {
+            return ERR("could not compile Boolean function: number of elements remaining on the stack is not 1");
+        }
+        return OK(stack.back());
+    }
+
+    void BitslicedEvaluator::execute(const std::vector<Instruction>& tape, u64* values)
+    {
+        for (const Instruction& ins : tape)
+        {
+            u64* dst     = values + ins.dst * BLOCK_WORDS;
+            const u64* a = values + ins.a * BLOCK_WORDS;
+            const u64* b = values + ins.b * BLOCK_WORDS;
+            const u64* c = values + ins.c * BLOCK_WORDS;
+            switch (ins.op)
+            {
+                case OpCode::And:
+                    for (u32 w = 0; w < BLOCK_WORDS; w++)
+                    {
+                        dst[w] = a[w] & b[w];
+                    }
+                    break;
+                case OpCode::Or:
+                    for (u32 w = 0; w < BLOCK_WORDS; w++)
+                    {
+                        dst[w] = a[w] | b[w];
+                    }
+                    break;
+                case OpCode::Xor:
+                    for (u32 w = 0; w < BLOCK_WORDS; w++)
+                    {
+                        dst[w] = a[w] ^ b[w];
+                    }
+                    break;
+                case OpCode::Not:
+                    for (u32 w = 0; w < BLOCK_WORDS; w++)
+                    {
+                        dst[w] = ~a[w];
+                    }
+                    break;
+                case OpCode::Mux:
+                    for (u32 w = 0; w < BLOCK_WORDS; w++)
+                    {
+                        dst[w] = (a[w] & b[w]) | (~a[w] & c[w]);
+                    }
+                    break;
+            }
+        }
+    }
+
+    void BitslicedEvaluator::evaluate(u64* values) const
+    {
+        std::fill(values + ZERO * BLOCK_WORDS, values + (ZERO + 1) * BLOCK_WORDS, 0);
+        std::fill(values + ONE * BLOCK_WORDS, values + (ONE + 1) * BLOCK_WORDS, ~u64(0));
+        execute(m_tape, values);
+    }
+
+    Result<BitslicedEvaluator::InfluenceCounts>
+        BitslicedEvaluator::count_influences(const std::vector<u32>& outputs, u64 num_evaluations, bool exhaustive, u32 num_threads, u64 seed) const
+    {
+        const u32 num_slots = get_num_slots();
+        for (const u32 output : outputs)
+        {
+            if (output >= num_slots)
+            {
+                return ERR("could not count influences: output slot " + std::to_string(output) + " does not exist");
+            }
+        }
+        if (exhaustive && m_num_inputs > 32)
+        {
+            return ERR("could not count influences: cannot evaluate all assignments of more than 32 inputs but got " + std::to_string(m_num_inputs));
+        }
+
+        InfluenceCounts result;
+        result.num_evaluations = exhaustive ? (u64(1) << m_num_inputs) : num_evaluations;
+        result.counts.resize(outputs.size());
+
+        // outputs sharing a slot are counted once and copied at the end
+        std::vector<std::vector<u32>> outputs_of_slot(num_slots);
+        for (u32 i = 0; i < outputs.size(); i++)
+        {
+            outputs_of_slot[outputs[i]].push_back(i);
+        }
+
+        std::vector<std::vector<u32>> readers(num_slots);
+        for (u32 i = 0; i < m_tape.size(); i++)
+        {
+            const Instruction& ins = m_tape[i];
+            readers[ins.a].push_back(i);
+            if (ins.op != OpCode::Not)
+            {
+                readers[ins.b].push_back(i);
+            }
+            if (ins.op == OpCode::Mux)
+            {
+                readers[ins.c].push_back(i);
+            }
+        }
+
+        // for each input, the instructions depending on it are rewritten to compute into scratch slots behind the regular slots, the first scratch slot holds the flipped input
+        struct Cone
+        {
+            u32 input_slot;
+            std::vector<Instruction> tape;
+            std::vector<std::pair<u32, u32>> counters;    // pairs of regular and scratch slot of an output
+        };
+        std::vector<Cone> cones(m_num_inputs);
+        std::vector<u32> remapped(num_slots, NO_SLOT);
+        std::vector<std::pair<u32, u32>> pairs;    // pairs of output and input whose flips are counted
+        u32 num_scratch_slots = 0;
+        u64 work_per_block    = m_tape.size() + 1;
+        for (u32 input = 0; input < m_num_inputs; input++)
+        {
+            Cone& cone      = cones[input];
+            cone.input_slot = 2 + input;
+
+            std::vector<u32> instructions;
+            std::vector<u32> queue    = {cone.input_slot};
+            remapped[cone.input_slot] = num_slots;
+            for (u32 q = 0; q < queue.size(); q++)
+            {
+                for (const u32 i : readers[queue[q]])
+                {
+                    const u32 dst = m_tape[i].dst;
+                    if (remapped[dst] == NO_SLOT)
+                    {
+                        remapped[dst] = 0;
+                        instructions.push_back(i);
+                        queue.push_back(dst);
+                    }
+                }
+            }
+            std::sort(instructions.begin(), instructions.end());
+
+            for (u32 k = 0; k < instructions.size(); k++)
+            {
+                remapped[m_tape[instructions[k]].dst] = num_slots + 1 + k;
+            }
+            auto remap = [&remapped](u32 slot) { return remapped[slot] == NO_SLOT ? slot : remapped[slot]; };
+            for (const u32 i : instructions)
+            {
+                const Instruction& ins = m_tape[i];
+                cone.tape.push_back({ins.op, remap(ins.dst), remap(ins.a), remap(ins.b), remap(ins.c)});
+            }
+
+            for (const u32 slot : queue)
+            {
+                if (!outputs_of_slot[slot].empty())
+                {
+                    cone.counters.push_back({slot, remapped[slot]});
+                    pairs.push_back({slot, input});
+                }
+                remapped[slot] = NO_SLOT;
+            }
+
+            num_scratch_slots = std::max(num_scratch_slots, (u32)instructions.size() + 1);
+            work_per_block += instructions.size() + cone.counters.size();
+        }
+
+        const u64 num_blocks = (result.num_evaluations + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+        num_threads = utils::get_num_threads(num_threads, std::min(num_blocks * work_per_block / MIN_WORK_PER_THREAD, num_blocks));
+
+        // every thread accumulates its own counters, which are summed up afterwards
+        std::vector<std::vector<u64>> thread_counters(num_threads, std::vector<u64>(pairs.size(), 0));
+        std::atomic<u64> next_block = 0;
+
+        auto work = [&](u32 thread_index) {
+            std::vector<u64> values((num_slots + num_scratch_slots) * BLOCK_WORDS);
+            std::vector<u64>& counters = thread_counters[thread_index];
+            u64 mask[BLOCK_WORDS];
+
+            while (true)
+            {
+                const u64 first_block = next_block.fetch_add(BLOCKS_PER_CLAIM);
+                if (first_block >= num_blocks)
+                {
+                    break;
+                }
+
+                for (u64 block = first_block; block < std::min(first_block + BLOCKS_PER_CLAIM, num_blocks); block++)
+                {
+                    const u64 first_assignment = block * BLOCK_SIZE;
+
+                    // assign the inputs
+                    if (exhaustive)
+                    {
+                        for (u32 input = 0; input < m_num_inputs; input++)
+                        {
+                            u64* words = values.data() + (2 + input) * BLOCK_WORDS;
+                            for (u32 w = 0; w < BLOCK_WORDS; w++)
+                            {
+                                words[w] = input < 6 ? EXHAUSTIVE_PATTERNS[input] : ((((first_assignment + w * 64) >> input) & 1) ? ~u64(0) : 0);
+                            }
+                        }
+                    }
+                    else
+                    {
+                        u64 state = seed ^ (block * 0xD1B54A32D192ED03ULL);
+                        for (u32 input = 0; input < m_num_inputs; input++)
+                        {
+                            u64* words = values.data() + (2 + input) * BLOCK_WORDS;
+                            for (u32 w = 0; w < BLOCK_WORDS; w++)
+                            {
+                                words[w] = splitmix64(state);
+                            }
+                        }
+                    }
+
+                    // lanes beyond the number of evaluations are ignored
+                    const u64 num_lanes = std::min((u64)BLOCK_SIZE, result.num_evaluations - first_assignment);
+                    for (u32 w = 0; w < BLOCK_WORDS; w++)
+                    {
+                        const u64 lanes = std::min(u64(64), num_lanes > w * 64 ? num_lanes - w * 64 : 0);
+                        mask[w]         = lanes == 64 ? ~u64(0) : ((u64(1) << lanes) - 1);
+                    }
+
+                    evaluate(values.data());
+
+                    u32 counter = 0;
+                    for (const Cone& cone : cones)
+                    {
+                        u64* flipped               = values.data() + num_slots * BLOCK_WORDS;
+                        const u64* values_of_input = values.data() + cone.input_slot * BLOCK_WORDS;
+                        for (u32 w = 0; w < BLOCK_WORDS; w++)
+                        {
+                            flipped[w] = ~values_of_input[w];
+                        }
+                        execute(cone.tape, values.data());
+
+                        for (const auto& [slot, scratch_slot] : cone.counters)
+                        {
+                            const u64* a = values.data() + slot * BLOCK_WORDS;
+                            const u64* b = values.data() + scratch_slot * BLOCK_WORDS;
+                            u64 count    = 0;
+                            for (u32 w = 0; w < BLOCK_WORDS; w++)
+                            {
+                                count += __builtin_popcountll((a[w] ^ b[w]) & mask[w]);
+                            }
+                            counters[counter++] += count;
+                        }
+                    }
+                }
+            }
+        };
+
+        utils::run_workers(num_threads, work);
+
+        // pairs are ordered by input, so the counts of each output end up sorted by input
+        for (u32 p = 0; p < pairs.size(); p++)
+        {
+            u64 count = 0;
+            for (const auto& counters : thread_counters)
+            {
+                count += counters[p];
+            }
+
+            const auto& [slot, input] = pairs[p];
+            for (const u32 output : outputs_of_slot[slot])
+            {
+                result.counts[output].push_back({input, count});
+            }
+        }
+
+        return OK(result);
+    }
+}    // namespace hal
@@ -1,12 +1,17 @@
 #include "boolean_influence/plugin_boolean_influence.h"
 
+#include "boolean_influence/bitsliced_evaluator.h"
 #include "hal_core/netlist/decorators/boolean_function_net_decorator.h"
 #include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/netlist_utils.h"
+#include "hal_core/utilities/parallel.h"
 #include "z3_utils/include/z3_utils.h"
 
-#include <filesystem>
-#include <fstream>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <unordered_set>
 
 namespace hal
 {
@@ -62,256 +67,174 @@ namespace hal
             return {function_gates.begin(), function_gates.end()};
         }
 
-    }    // namespace
-
-    const std::string BooleanInfluencePlugin::probabilistic_function = R"(
-#include <stdbool.h> 
-#include <stdio.h>
-#include <stdlib.h>
-
-static unsigned long x=123456789, y=362436069, z=521288629;
-
-// period 2^96-1
-unsigned long xorshf96(void) {          
-    unsigned long t;
-
-    x ^= x << 16;
-    x ^= x >> 5;
-    x ^= x << 1;
-
-    t = x;
-    x = y;
-    y = z;
-    z = t ^ x ^ y;
-
-    return z;
-}
-
-<C_FUNCTION>
-
-const int input_size = <INPUT_SIZE>;
-
-void build_values(bool* values) {
-    for (int i = 0; i < input_size; i++) {
-        bool random_value = xorshf96() % 2;
-        values[i] = random_value;
-    }
-
-    return;
-}
-
-int main(int argc, char *argv[]) {
-    unsigned long long b     = strtoull(argv[1], 0, 10);
-    unsigned long long num   = strtoull(argv[2], 0, 10);
-    unsigned long long count = 0;
-
-    bool values[input_size];
-    for (unsigned long long i = 0; i < num; i++) {
-        build_values(values);
-
-        values[b] = true;
-        bool r1 = func(values);
-
-        values[b] = false;
-        bool r2 = func(values);
-
-        if (r1 != r2) {
-            count++;
-        }
-    }
-
-    printf("%lld\n", count);
-
-    return int(count);
-})";
-
-    const std::string BooleanInfluencePlugin::deterministic_function = R"(
-#include <stdbool.h> 
-#include <stdio.h>
-#include <stdlib.h>
-
-<C_FUNCTION>
-
-const int input_size = <INPUT_SIZE>;
-
-void build_values(bool* values, unsigned long long val) {
-    for (int idx = 0; idx < input_size; idx++) {
-        values[idx] = (val >> idx) & 0x1;
-    }
-
-    return;
-}
-
-int main(int argc, char *argv[]) {
-    unsigned long long b     = strtoull(argv[1], 0, 10);
-    unsigned long long count = 0;
-
-    bool values[input_size];
-    for (unsigned long long i = 0; i < (1 << input_size); i++) {
-        build_values(values, i);
+        // all inputs of the fan-in cone of a net within the given gates, including those that no longer influence the net once its function is simplified
+        std::vector<Net*> get_subcircuit_inputs(const std::vector<Gate*>& gates, Net* start_net)
+        {
+            const std::unordered_set<const Gate*> gate_set(gates.begin(), gates.end());
+            const Netlist* nl = start_net->get_netlist();
 
-        values[b] = true;
-        bool r1 = func(values);
+            std::vector<Net*> inputs;
+            std::unordered_set<const Net*> visited = {start_net};
+            std::vector<Net*> stack                = {start_net};
+            while (!stack.empty())
+            {
+                Net* net = stack.back();
+                stack.pop_back();
 
-        values[b] = false;
-        bool r2 = func(values);
+                const auto sources = net->get_sources();
+                if (sources.size() != 1 || gate_set.find(sources.front()->get_gate()) == gate_set.end())
+                {
+                    inputs.push_back(net);
+                    continue;
+                }
 
-        if (r1 != r2) {
-            count++;
+                const auto bf_res = sources.front()->get_gate()->get_resolved_boolean_function(sources.front()->get_pin());
+                if (bf_res.is_error())
+                {
+                    continue;
+                }
+                for (const auto& var : bf_res.get().get_variable_names())
+                {
+                    const auto in_net_res = BooleanFunctionNetDecorator::get_net_from(nl, var);
+                    if (in_net_res.is_ok() && visited.insert(in_net_res.get()).second)
+                    {
+                        stack.push_back(in_net_res.get());
+                    }
+                }
+            }
+            return inputs;
         }
-    }
 
-    printf("%lld\n", count);
+        // maximum number of nets whose functions are compiled into the tape of a single batch
+        constexpr u32 MAX_BATCH_NETS = 1 << 12;
 
-    return int(count);
-})";
+        // the function of a net driven by a combinational gate and the nets it depends on
+        struct NetFunction
+        {
+            BooleanFunction function;
+            std::vector<const Net*> inputs;
+        };
 
-    Result<std::unordered_map<std::string, double>>
-        BooleanInfluencePlugin::get_boolean_influence_internal(const z3::expr& expr, const u32 num_evaluations, const bool deterministic, const std::string& unique_identifier)
-    {
-        const auto to_replacement_var = [](const u32 var_idx) -> std::string { return "var_" + std::to_string(var_idx); };
+        // flip-flops whose fan-in cones are evaluated together, nets are listed in topological order
+        struct InfluenceBatch
+        {
+            std::vector<std::pair<Gate*, const Net*>> flip_flops;
+            std::vector<const Net*> inputs;
+            std::vector<const Net*> nets;
+        };
 
-        const auto extract_index = [](const std::string& var) -> Result<u32> {
-            if (!utils::starts_with(var, std::string("var_")))
+        // all inputs of the fan-in cone of a data net, including those that no longer influence the data net after constant folding
+        std::vector<const Net*> get_cone_inputs(const Net* data_net, const std::unordered_map<const Net*, NetFunction>& net_functions)
+        {
+            std::vector<const Net*> inputs;
+            std::unordered_set<const Net*> visited = {data_net};
+            std::vector<const Net*> stack          = {data_net};
+            while (!stack.empty())
             {
-                return ERR("variable " + var + " does not start with prefix 'var_', so we cannot extract an index.");
-            }
+                const Net* net = stack.back();
+                stack.pop_back();
 
-            try
-            {
-                return OK(u32(std::stoul(var.substr(4))));
-            }
-            catch (const std::invalid_argument& e)
-            {
-                return ERR("could not get index from string '" + var + "': " + e.what());
+                const auto function_it = net_functions.find(net);
+                if (function_it == net_functions.end() || (net == data_net && net->is_global_input_net()))
+                {
+                    inputs.push_back(net);
+                    continue;
+                }
+                for (const Net* in_net : function_it->second.inputs)
+                {
+                    if (visited.insert(in_net).second)
+                    {
+                        stack.push_back(in_net);
+                    }
+                }
             }
-            catch (const std::out_of_range& e)
+            return inputs;
+        }
+
+        // compile the functions of all nets of a batch into a single tape and count the influences on the data nets of its flip-flops
+        Result<BitslicedEvaluator::InfluenceCounts> evaluate_batch(const InfluenceBatch& batch, const std::unordered_map<const Net*, NetFunction>& net_functions, const u32 num_evaluations)
+        {
+            BitslicedEvaluator evaluator;
+            std::unordered_map<std::string, u32> slots;
+            for (const Net* net : batch.inputs)
             {
-                return ERR("could not get index from string '" + var + "': " + e.what());
+                const auto input_res = evaluator.add_input();
+                if (input_res.is_error())
+                {
+                    return ERR_APPEND(input_res.get_error(), "failed to add input net " + net->get_name() + " with ID " + std::to_string(net->get_id()) + ".");
+                }
+                slots[BooleanFunctionNetDecorator(*net).get_boolean_variable_name()] = input_res.get();
             }
-        };
 
-        const auto to_original_var = [extract_index](const std::string& replacement_var, const std::vector<std::string>& original_vars) -> Result<std::string> {
-            const auto var_idx_res = extract_index(replacement_var);
-            if (var_idx_res.is_error())
+            for (const Net* net : batch.nets)
             {
-                return ERR_APPEND(var_idx_res.get_error(), "unable to reconstruct original variable from replacement variable" + replacement_var + ": failed to extract index.");
+                const auto slot_res = evaluator.add_function(net_functions.at(net).function, slots);
+                if (slot_res.is_error())
+                {
+                    return ERR_APPEND(slot_res.get_error(), "failed to compile function of net " + net->get_name() + " with ID " + std::to_string(net->get_id()) + ".");
+                }
+                slots[BooleanFunctionNetDecorator(*net).get_boolean_variable_name()] = slot_res.get();
             }
-            const auto var_idx = var_idx_res.get();
 
-            if (var_idx > original_vars.size())
+            std::vector<u32> outputs;
+            for (const auto& [gate, data_net] : batch.flip_flops)
             {
-                return ERR("unable to reconstruct original variable from replacement variable" + replacement_var + ": extracted index " + std::to_string(var_idx)
-                           + " is bigger than the size of the original vars (" + std::to_string(original_vars.size()) + ").");
+                outputs.push_back(slots.at(BooleanFunctionNetDecorator(*data_net).get_boolean_variable_name()));
             }
 
-            return OK(original_vars.at(var_idx));
-        };
+            // batches are processed in parallel, hence each batch is evaluated by a single thread
+            return evaluator.count_influences(outputs, num_evaluations, false, 1);
+        }
 
-        std::unordered_map<std::string, double> influences;
+    }    // namespace
 
-        // substitute all variables in the expression to be of the format var_<INDEX>.
-        // This allows for a more efficient translation into a c function
-        std::vector<std::string> input_vars = utils::to_vector(z3_utils::get_variable_names(expr));
+    Result<std::unordered_map<std::string, double>>
+        BooleanInfluencePlugin::get_boolean_influence_internal(const z3::expr& expr, const u32 num_evaluations, const bool deterministic)
+    {
+        const std::vector<std::string> input_vars = utils::to_vector(z3_utils::get_variable_names(expr));
 
         if (deterministic && input_vars.size() > 16)
         {
             return ERR("unable to generate Boolean influence: Cannot evaluate Boolean function deterministically for more than 16 variables but got " + std::to_string(input_vars.size()));
         }
 
-        std::vector<std::string> replacement_vars;
-
-        z3::expr_vector from_vec(expr.ctx());
-        z3::expr_vector to_vec(expr.ctx());
-
-        for (u32 var_idx = 0; var_idx < input_vars.size(); var_idx++)
+        // compile the expression into a bit-sliced instruction tape
+        BitslicedEvaluator evaluator;
+        std::unordered_map<std::string, u32> input_slots;
+        for (const auto& var : input_vars)
         {
-            replacement_vars.push_back(to_replacement_var(var_idx));
-
-            z3::expr from = expr.ctx().bv_const(input_vars.at(var_idx).c_str(), 1);
-            z3::expr to   = expr.ctx().bv_const(to_replacement_var(var_idx).c_str(), 1);
-
-            from_vec.push_back(from);
-            to_vec.push_back(to);
+            const auto input_res = evaluator.add_input();
+            if (input_res.is_error())
+            {
+                return ERR_APPEND(input_res.get_error(), "unable to generate Boolean influence: failed to add input variable " + var + ".");
+            }
+            input_slots[var] = input_res.get();
         }
 
-        auto replaced_e = expr;
-        replaced_e      = replaced_e.substitute(from_vec, to_vec);
-
-        // translate expression into a c program
-        const std::filesystem::path directory = "/tmp/boolean_influence_tmp/";
-        std::filesystem::create_directory(directory);
-
-        const std::filesystem::path file_path = directory / (unique_identifier.empty() ? ("boolean_func.cpp") : ("boolean_func_" + unique_identifier + ".cpp"));
-
-        std::string cpp_program = deterministic ? deterministic_function : probabilistic_function;
-        cpp_program             = utils::replace(cpp_program, std::string("<C_FUNCTION>"), z3_utils::to_cpp(replaced_e));
-        cpp_program             = utils::replace(cpp_program, std::string("<INPUT_SIZE>"), std::to_string(replacement_vars.size()));
-
-        // write cpp program to file
-        std::ofstream ofs(file_path);
-        if (!ofs.is_open())
+        const auto output_res = evaluator.add_function(expr, input_slots);
+        if (output_res.is_error())
         {
-            return ERR("unable to generate Boolean influence: could not open file " + file_path.string() + ".");
+            return ERR_APPEND(output_res.get_error(), "unable to generate Boolean influence: failed to compile z3 expression.");
         }
-        ofs << cpp_program;
-
-        ofs.close();
-
-        // compile the cpp file
-        const std::string program_name    = file_path.string().substr(0, file_path.string().size() - 4);
-        const std::string compile_command = "g++ -o " + program_name + " " + file_path.string() + " -O3";
-        int res                           = system(compile_command.c_str());
-        UNUSED(res);
 
-        // run boolean function program for every input
-        for (const auto& var : replacement_vars)
+        // count the flips of the output caused by flipping each input for all inputs at once
+        const auto counts_res = evaluator.count_influences({output_res.get()}, num_evaluations, deterministic);
+        if (counts_res.is_error())
         {
-            const auto idx_res = extract_index(var);
-            if (idx_res.is_error())
-            {
-                return ERR_APPEND(idx_res.get_error(), "unable to generate Boolean influence: failed to extract index from variable " + var + ".");
-            }
-            const auto idx = idx_res.get();
-
-            const std::string num_evaluations_str = deterministic ? "" : std::to_string(num_evaluations);
-
-            const std::string run_command = program_name + " " + std::to_string(idx) + " " + num_evaluations_str + " 2>&1";
-
-            std::array<char, 128> buffer;
-            std::string result;
-
-            FILE* pipe = popen(run_command.c_str(), "r");
-            if (!pipe)
-            {
-                return ERR("unable to generate Boolean influence: error during execution of compiled boolean program");
-            }
-            while (fgets(buffer.data(), 128, pipe) != NULL)
-            {
-                result += buffer.data();
-            }
-
-            pclose(pipe);
-
-            const u32 count            = std::stoi(result);
-            const u32 real_evaluations = deterministic ? (1 << input_vars.size()) : num_evaluations;
-            double cv                  = (double)(count) / (double)(real_evaluations);
-
-            const auto org_var_res = to_original_var(var, input_vars);
-            if (org_var_res.is_error())
-            {
-                return ERR_APPEND(org_var_res.get_error(), "unable to generate Boolean influence: failed to reconstruct original variable from replacement variable " + var + ".");
-            }
-            const auto org_var = org_var_res.get();
-
-            influences.insert({org_var, cv});
+            return ERR_APPEND(counts_res.get_error(), "unable to generate Boolean influence: failed to evaluate z3 expression.");
         }
+        const auto counts = counts_res.get();
 
-        // delete files and temp directory
-        std::remove(file_path.string().c_str());
-        std::remove(program_name.c_str());
-
-        //std::filesystem::remove(directory);
+        // variables that vanished during compilation have no influence at all
+        std::unordered_map<std::string, double> influences;
+        for (const auto& var : input_vars)
+        {
+            influences[var] = 0.0;
+        }
+        for (const auto& [input, count] : counts.counts.front())
+        {
+            influences[input_vars.at(input)] = (double)(count) / (double)(counts.num_evaluations);
+        }
 
         return OK(influences);
     }
@@ -319,8 +242,7 @@ int main(int argc, char *argv[]) {
     Result<std::map<Net*, double>> BooleanInfluencePlugin::get_boolean_influences_of_subcircuit_internal(const std::vector<Gate*>& gates,
                                                                                                          const Net* start_net,
                                                                                                          const u32 num_evaluations,
-                                                                                                         const bool deterministic,
-                                                                                                         const std::string& unique_identifier)
+                                                                                                         const bool deterministic)
     {
         for (const auto* gate : gates)
         {
@@ -352,7 +274,7 @@ int main(int argc, char *argv[]) {
         }
 
         // Generate Boolean influences
-        const auto inf_res = get_boolean_influence_internal(func, num_evaluations, deterministic, unique_identifier);
+        const auto inf_res = get_boolean_influence_internal(func, num_evaluations, deterministic);
         if (inf_res.is_error())
         {
             return ERR_APPEND(inf_res.get_error(),
@@ -383,7 +305,7 @@ int main(int argc, char *argv[]) {
     }
 
     Result<std::map<Net*, double>>
-        BooleanInfluencePlugin::get_boolean_influences_of_gate_internal(const Gate* gate, const u32 num_evaluations, const bool deterministic, const std::string& unique_identifier)
+        BooleanInfluencePlugin::get_boolean_influences_of_gate_internal(const Gate* gate, const u32 num_evaluations, const bool deterministic)
     {
         if (!gate->get_type()->has_property(GateTypeProperty::ff))
         {
@@ -405,7 +327,7 @@ int main(int argc, char *argv[]) {
         const auto in_net         = gate->get_fan_in_net(data_pin);
 
         // Generate Boolean influences
-        const auto inf_res = get_boolean_influences_of_subcircuit_internal(function_gates, in_net, num_evaluations, deterministic, unique_identifier);
+        const auto inf_res = get_boolean_influences_of_subcircuit_internal(function_gates, in_net, num_evaluations, deterministic);
         if (inf_res.is_error())
         {
             return ERR_APPEND(inf_res.get_error(),
@@ -413,55 +335,289 @@ int main(int argc, char *argv[]) {
                                   + in_net->get_name() + " with ID " + std::to_string(in_net->get_id()) + ".");
         }
 
-        return inf_res;
+        // inputs that vanished during simplification have no influence at all
+        std::map<Net*, double> influences = inf_res.get();
+        for (Net* input : get_subcircuit_inputs(function_gates, in_net))
+        {
+            influences.insert({input, 0.0});
+        }
+
+        return OK(influences);
     }
 
-    Result<std::unordered_map<std::string, double>> BooleanInfluencePlugin::get_boolean_influence(const BooleanFunction& bf, const u32 num_evaluations, const std::string& unique_identifier)
+    Result<std::unordered_map<std::string, double>> BooleanInfluencePlugin::get_boolean_influence(const BooleanFunction& bf, const u32 num_evaluations)
     {
         auto ctx         = z3::context();
         const auto z3_bf = z3_utils::from_bf(bf, ctx);
 
-        return get_boolean_influence(z3_bf, num_evaluations, unique_identifier);
+        return get_boolean_influence(z3_bf, num_evaluations);
     }
 
-    Result<std::unordered_map<std::string, double>> BooleanInfluencePlugin::get_boolean_influence(const z3::expr& expr, const u32 num_evaluations, const std::string& unique_identifier)
+    Result<std::unordered_map<std::string, double>> BooleanInfluencePlugin::get_boolean_influence(const BooleanFunction& bf, const u32 num_evaluations, const std::string&)
     {
-        return get_boolean_influence_internal(expr, num_evaluations, false, unique_identifier);
+        return get_boolean_influence(bf, num_evaluations);
     }
 
-    Result<std::unordered_map<std::string, double>> BooleanInfluencePlugin::get_boolean_influence_deterministic(const BooleanFunction& bf, const std::string& unique_identifier)
+    Result<std::unordered_map<std::string, double>> BooleanInfluencePlugin::get_boolean_influence(const z3::expr& expr, const u32 num_evaluations)
+    {
+        return get_boolean_influence_internal(expr, num_evaluations, false);
+    }
+
+    Result<std::unordered_map<std::string, double>> BooleanInfluencePlugin::get_boolean_influence(const z3::expr& expr, const u32 num_evaluations, const std::string&)
+    {
+        return get_boolean_influence(expr, num_evaluations);
+    }
+
+    Result<std::unordered_map<std::string, double>> BooleanInfluencePlugin::get_boolean_influence_deterministic(const BooleanFunction& bf)
     {
         auto ctx         = z3::context();
         const auto z3_bf = z3_utils::from_bf(bf, ctx);
 
-        return get_boolean_influence_deterministic(z3_bf, unique_identifier);
+        return get_boolean_influence_deterministic(z3_bf);
     }
 
-    Result<std::unordered_map<std::string, double>> BooleanInfluencePlugin::get_boolean_influence_deterministic(const z3::expr& expr, const std::string& unique_identifier)
+    Result<std::unordered_map<std::string, double>> BooleanInfluencePlugin::get_boolean_influence_deterministic(const BooleanFunction& bf, const std::string&)
     {
-        return get_boolean_influence_internal(expr, 0, true, unique_identifier);
+        return get_boolean_influence_deterministic(bf);
     }
 
-    Result<std::map<Net*, double>>
-        BooleanInfluencePlugin::get_boolean_influences_of_subcircuit(const std::vector<Gate*>& gates, const Net* start_net, const u32 num_evaluations, const std::string& unique_identifier)
+    Result<std::unordered_map<std::string, double>> BooleanInfluencePlugin::get_boolean_influence_deterministic(const z3::expr& expr)
     {
-        return get_boolean_influences_of_subcircuit_internal(gates, start_net, num_evaluations, false, unique_identifier);
+        return get_boolean_influence_internal(expr, 0, true);
     }
 
-    Result<std::map<Net*, double>> BooleanInfluencePlugin::get_boolean_influences_of_gate(const Gate* gate, const u32 num_evaluations, const std::string& unique_identifier)
+    Result<std::unordered_map<std::string, double>> BooleanInfluencePlugin::get_boolean_influence_deterministic(const z3::expr& expr, const std::string&)
     {
-        return get_boolean_influences_of_gate_internal(gate, num_evaluations, false, unique_identifier);
+        return get_boolean_influence_deterministic(expr);
     }
 
-    Result<std::map<Net*, double>>
-        BooleanInfluencePlugin::get_boolean_influences_of_subcircuit_deterministic(const std::vector<Gate*>& gates, const Net* start_net, const std::string& unique_identifier)
+    Result<std::map<Net*, double>> BooleanInfluencePlugin::get_boolean_influences_of_subcircuit(const std::vector<Gate*>& gates, const Net* start_net, const u32 num_evaluations)
+    {
+        return get_boolean_influences_of_subcircuit_internal(gates, start_net, num_evaluations, false);
+    }
+
+    Result<std::map<Net*, double>> BooleanInfluencePlugin::get_boolean_influences_of_subcircuit(const std::vector<Gate*>& gates, const Net* start_net, const u32 num_evaluations, const std::string&)
+    {
+        return get_boolean_influences_of_subcircuit(gates, start_net, num_evaluations);
+    }
+
+    Result<std::map<Net*, double>> BooleanInfluencePlugin::get_boolean_influences_of_gate(const Gate* gate, const u32 num_evaluations)
+    {
+        return get_boolean_influences_of_gate_internal(gate, num_evaluations, false);
+    }
+
+    Result<std::map<Net*, double>> BooleanInfluencePlugin::get_boolean_influences_of_gate(const Gate* gate, const u32 num_evaluations, const std::string&)
+    {
+        return get_boolean_influences_of_gate(gate, num_evaluations);
+    }
+
+    Result<std::map<Net*, double>> BooleanInfluencePlugin::get_boolean_influences_of_subcircuit_deterministic(const std::vector<Gate*>& gates, const Net* start_net)
     {
-        return get_boolean_influences_of_subcircuit_internal(gates, start_net, 0, true, unique_identifier);
+        return get_boolean_influences_of_subcircuit_internal(gates, start_net, 0, true);
+    }
+
+    Result<std::map<Net*, double>> BooleanInfluencePlugin::get_boolean_influences_of_subcircuit_deterministic(const std::vector<Gate*>& gates, const Net* start_net, const std::string&)
+    {
+        return get_boolean_influences_of_subcircuit_deterministic(gates, start_net);
+    }
+
+    Result<std::map<Net*, double>> BooleanInfluencePlugin::get_boolean_influences_of_gate_deterministic(const Gate* gate)
+    {
+        return get_boolean_influences_of_gate_internal(gate, 0, true);
+    }
+
+    Result<std::map<Net*, double>> BooleanInfluencePlugin::get_boolean_influences_of_gate_deterministic(const Gate* gate, const std::string&)
+    {
+        return get_boolean_influences_of_gate_deterministic(gate);
+    }
+
+    Result<std::monostate> BooleanInfluencePlugin::get_boolean_influences_of_gates(const std::vector<Gate*>& gates,
+                                                                                 const std::function<void(Gate*, const std::map<Net*, double>&)>& callback,
+                                                                                 const u32 num_evaluations,
+                                                                                 u32 num_threads)
+    {
+        if (gates.empty())
+        {
+            return OK({});
+        }
+        const Netlist* nl = gates.front()->get_netlist();
+
+        // functions are resolved once per net and shared by all cones containing the net
+        std::unordered_map<const Net*, NetFunction> net_functions;
+        std::unordered_map<const Net*, u8> net_states;    // 1 while on the stack, 2 once visited in the current batch
+
+        const auto is_function_gate = [](const Gate* gate) { return gate->get_type()->has_property(GateTypeProperty::combinational) && !gate->is_vcc_gate() && !gate->is_gnd_gate(); };
+
+        // extract the fan-in cones of all flip-flops, nets already visited within the same batch are not traversed again
+        std::vector<InfluenceBatch> batches(1);
+        for (Gate* gate : gates)
+        {
+            if (gate == nullptr || gate->get_netlist() != nl)
+            {
+                return ERR("unable to get Boolean influences of gates: all gates must be part of the same netlist.");
+            }
+            if (!gate->get_type()->has_property(GateTypeProperty::ff))
+            {
+                return ERR("unable to get Boolean influence for gate " + gate->get_name() + " with ID " + std::to_string(gate->get_id()) + ": can only handle flip-flops but found gate type "
+                           + gate->get_type()->get_name() + ".");
+            }
+
+            auto d_pins = gate->get_type()->get_pins([](const GatePin* p) { return p->get_direction() == PinDirection::input && p->get_type() == PinType::data; });
+            if (d_pins.size() != 1)
+            {
+                return ERR("unable to get Boolean influence for gate " + gate->get_name() + " with ID " + std::to_string(gate->get_id())
+                           + ": can only handle flip-flops with exactly one data port, but found " + std::to_string(d_pins.size()) + ".");
+            }
+            const Net* data_net = gate->get_fan_in_net(d_pins.front());
+            if (data_net == nullptr)
+            {
+                return ERR("unable to get Boolean influence for gate " + gate->get_name() + " with ID " + std::to_string(gate->get_id()) + ": data port is not connected to a net.");
+            }
+
+            if (batches.back().nets.size() >= MAX_BATCH_NETS)
+            {
+                batches.emplace_back();
+                net_states.clear();
+            }
+            InfluenceBatch& batch = batches.back();
+            batch.flip_flops.push_back({gate, data_net});
+
+            std::vector<std::pair<const Net*, bool>> stack = {{data_net, false}};
+            while (!stack.empty())
+            {
+                const auto [net, expanded] = stack.back();
+                stack.pop_back();
+
+                if (expanded)
+                {
+                    net_states[net] = 2;
+                    batch.nets.push_back(net);
+                    continue;
+                }
+                if (const auto it = net_states.find(net); it != net_states.end())
+                {
+                    if (it->second == 1)
+                    {
+                        return ERR("unable to get Boolean influence for gate " + gate->get_name() + " with ID " + std::to_string(gate->get_id()) + ": fan-in cone contains a combinational loop through net "
+                                   + net->get_name() + " with ID " + std::to_string(net->get_id()) + ".");
+                    }
+                    continue;
+                }
+
+                const auto sources = net->get_sources();
+                if (sources.size() > 1)
+                {
+                    return ERR("unable to get Boolean influence for gate " + gate->get_name() + " with ID " + std::to_string(gate->get_id()) + ": net " + net->get_name() + " with ID "
+                               + std::to_string(net->get_id()) + " is multi driven.");
+                }
+
+                // nets that are not driven by combinational logic are inputs of the cone
+                if (sources.empty() || (net == data_net && net->is_global_input_net()) || !is_function_gate(sources.front()->get_gate()))
+                {
+                    net_states[net] = 2;
+                    batch.inputs.push_back(net);
+                    continue;
+                }
+
+                auto function_it = net_functions.find(net);
+                if (function_it == net_functions.end())
+                {
+                    const Gate* src = sources.front()->get_gate();
+                    auto bf_res     = src->get_resolved_boolean_function(sources.front()->get_pin());
+                    if (bf_res.is_error())
+                    {
+                        return ERR_APPEND(bf_res.get_error(),
+                                          "unable to get Boolean influence for gate " + gate->get_name() + " with ID " + std::to_string(gate->get_id()) + ": failed to get function of net "
+                                              + net->get_name() + " with ID " + std::to_string(net->get_id()) + ".");
+                    }
+
+                    NetFunction net_function;
+                    net_function.function = bf_res.get();
+                    for (const auto& var : net_function.function.get_variable_names())
+                    {
+                        const auto in_net_res = BooleanFunctionNetDecorator::get_net_from(nl, var);
+                        if (in_net_res.is_error())
+                        {
+                            return ERR_APPEND(in_net_res.get_error(),
+                                              "unable to get Boolean influence for gate " + gate->get_name() + " with ID " + std::to_string(gate->get_id())
+                                                  + ": failed to reconstruct net from variable " + var + ".");
+                        }
+                        net_function.inputs.push_back(in_net_res.get());
+                    }
+                    function_it = net_functions.emplace(net, std::move(net_function)).first;
+                }
+
+                net_states[net] = 1;
+                stack.push_back({net, true});
+                for (const Net* in_net : function_it->second.inputs)
+                {
+                    stack.push_back({in_net, false});
+                }
+            }
+        }
+
+        std::vector<std::optional<Error>> errors(batches.size());
+        std::atomic<size_t> next_index{0};
+        std::atomic<bool> failed{false};
+        std::mutex callback_mutex;
+        auto worker = [&batches, &net_functions, &callback, num_evaluations, &errors, &next_index, &failed, &callback_mutex](u32) {
+            for (size_t i = next_index++; i < batches.size() && !failed; i = next_index++)
+            {
+                const auto counts_res = evaluate_batch(batches[i], net_functions, num_evaluations);
+                if (counts_res.is_error())
+                {
+                    errors[i] = counts_res.get_error();
+                    failed    = true;
+                    break;
+                }
+                const auto counts = counts_res.get();
+
+                // inputs that vanished during compilation have no influence at all
+                std::vector<std::map<Net*, double>> influences(batches[i].flip_flops.size());
+                for (u32 j = 0; j < batches[i].flip_flops.size(); j++)
+                {
+                    for (const Net* input : get_cone_inputs(batches[i].flip_flops[j].second, net_functions))
+                    {
+                        influences[j][const_cast<Net*>(input)] = 0.0;
+                    }
+                    for (const auto& [input, count] : counts.counts[j])
+                    {
+                        influences[j][const_cast<Net*>(batches[i].inputs[input])] = (double)(count) / (double)(counts.num_evaluations);
+                    }
+                }
+
+                std::lock_guard<std::mutex> lock(callback_mutex);
+                for (u32 j = 0; j < batches[i].flip_flops.size(); j++)
+                {
+                    callback(batches[i].flip_flops[j].first, influences[j]);
+                }
+            }
+        };
+
+        utils::run_workers(utils::get_num_threads(num_threads, batches.size()), worker);
+
+        for (size_t i = 0; i < errors.size(); i++)
+        {
+            if (errors[i].has_value())
+            {
+                return ERR_APPEND(errors[i].value(), "unable to get Boolean influences of gates: failed to evaluate batch of flip-flops starting with gate " + batches[i].flip_flops.front().first->get_name() + " with ID "
+                                                         + std::to_string(batches[i].flip_flops.front().first->get_id()) + ".");
+            }
+        }
+
+        return OK({});
     }
 
-    Result<std::map<Net*, double>> BooleanInfluencePlugin::get_boolean_influences_of_gate_deterministic(const Gate* gate, const std::string& unique_identifier)
+    Result<std::map<Gate*, std::map<Net*, double>>> BooleanInfluencePlugin::get_boolean_influences_of_gates(const std::vector<Gate*>& gates, const u32 num_evaluations, const u32 num_threads)
     {
-        return get_boolean_influences_of_gate_internal(gate, 0, true, unique_identifier);
+        std::map<Gate*, std::map<Net*, double>> influences;
+        const auto res = get_boolean_influences_of_gates(
+            gates, [&influences](Gate* gate, const std::map<Net*, double>& gate_influences) { influences[gate] = gate_influences; }, num_evaluations, num_threads);
+        if (res.is_error())
+        {
+            return ERR(res.get_error());
+        }
+        return OK(influences);
     }
 
     Result<std::pair<std::map<u32, Gate*>, std::vector<std::vector<double>>>> BooleanInfluencePlugin::get_ff_dependency_matrix(const Netlist* nl, bool with_boolean_influence)
@@ -484,6 +640,26 @@ int main(int argc, char *argv[]) {
             matrix_gates++;
         }
 
+        // the influences of all flip-flops are computed at once, so that shared logic is only evaluated once
+        std::map<Gate*, std::map<Net*, double>> boolean_influences;
+        if (with_boolean_influence)
+        {
+            // consecutive flip-flops are batched together, ordering them by ID keeps flip-flops created close to each other in the same batch
+            std::vector<Gate*> ffs;
+            for (const auto& [id, gate] : matrix_id_to_gate)
+            {
+                ffs.push_back(gate);
+            }
+            std::sort(ffs.begin(), ffs.end(), [](const Gate* a, const Gate* b) { return a->get_id() < b->get_id(); });
+
+            auto inf_res = get_boolean_influences_of_gates(ffs);
+            if (inf_res.is_error())
+            {
+                return ERR_APPEND(inf_res.get_error(), "unable to generate ff dependency matrix: failed to generate Boolean influences.");
+            }
+            boolean_influences = inf_res.get();
+        }
+
         u32 status_counter = 0;
         for (const auto& [id, gate] : matrix_id_to_gate)
         {
@@ -499,18 +675,7 @@ int main(int argc, char *argv[]) {
             {
                 gates_to_add.insert(gate_to_matrix_id[pred_gate]);
             }
-            std::map<Net*, double> boolean_influence_for_gate;
-            if (with_boolean_influence)
-            {
-                const auto inf_res = get_boolean_influences_of_gate(gate);
-                if (inf_res.is_error())
-                {
-                    return ERR_APPEND(inf_res.get_error(),
-                                      "unable to generate ff dependency matrix: failed to generate Boolean influence for gate " + gate->get_name() + " with ID " + std::to_string(gate->get_id())
-                                          + ".");
-                }
-                boolean_influence_for_gate = inf_res.get();
-            }
+            std::map<Net*, double>& boolean_influence_for_gate = boolean_influences[gate];
 
             for (u32 i = 0; i < matrix_gates; i++)
             {
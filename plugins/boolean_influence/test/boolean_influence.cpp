@@ -0,0 +1,397 @@
+#include "boolean_influence/bitsliced_evaluator.h"
+#include "boolean_influence/plugin_boolean_influence.h"
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+
+#include "netlist_test_utils.h"
+
+namespace hal
+{
+    class BooleanInfluenceTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp()
+        {
+            NO_COUT_BLOCK;
+            test_utils::init_log_channels();
+        }
+
+        virtual void TearDown()
+        {
+        }
+
+        static std::unordered_map<std::string, double> get_deterministic_influences(const std::string& function)
+        {
+            const auto res = BooleanInfluencePlugin::get_boolean_influence_deterministic(BooleanFunction::from_string(function).get());
+            if (res.is_error())
+            {
+                return {};
+            }
+            return res.get();
+        }
+
+        // two flip-flops, ff_0 samples (a & b) | c, ff_1 samples a ^ q_0
+        static std::unique_ptr<Netlist> create_ff_netlist(std::vector<Gate*>& ffs, std::vector<std::map<Net*, double>>& expected_influences)
+        {
+            std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+            const GateLibrary* gl       = nl->get_gate_library();
+
+            Net* clk = nl->create_net("clk");
+            Net* a   = nl->create_net("a");
+            Net* b   = nl->create_net("b");
+            Net* c   = nl->create_net("c");
+            for (Net* net : {clk, a, b, c})
+            {
+                nl->mark_global_input_net(net);
+            }
+
+            Gate* and_gate = nl->create_gate(gl->get_gate_type_by_name("AND2"), "and");
+            Gate* or_gate  = nl->create_gate(gl->get_gate_type_by_name("OR2"), "or");
+            Gate* xor_gate = nl->create_gate(gl->get_gate_type_by_name("XOR2"), "xor");
+            Gate* ff_0     = nl->create_gate(gl->get_gate_type_by_name("DFF"), "ff_0");
+            Gate* ff_1     = nl->create_gate(gl->get_gate_type_by_name("DFF"), "ff_1");
+
+            a->add_destination(and_gate, "I0");
+            b->add_destination(and_gate, "I1");
+            Net* ab = nl->create_net("ab");
+            ab->add_source(and_gate, "O");
+            ab->add_destination(or_gate, "I0");
+            c->add_destination(or_gate, "I1");
+            Net* d_0 = nl->create_net("d_0");
+            d_0->add_source(or_gate, "O");
+            d_0->add_destination(ff_0, "D");
+            clk->add_destination(ff_0, "CLK");
+            Net* q_0 = nl->create_net("q_0");
+            q_0->add_source(ff_0, "Q");
+
+            a->add_destination(xor_gate, "I0");
+            q_0->add_destination(xor_gate, "I1");
+            Net* d_1 = nl->create_net("d_1");
+            d_1->add_source(xor_gate, "O");
+            d_1->add_destination(ff_1, "D");
+            clk->add_destination(ff_1, "CLK");
+
+            ffs                 = {ff_0, ff_1};
+            expected_influences = {{{a, 0.25}, {b, 0.25}, {c, 0.75}}, {{a, 1.0}, {q_0, 1.0}}};
+            return nl;
+        }
+
+        // appends a chain of buffers of the given length to the net and returns the output net of the chain
+        static Net* add_buffer_chain(Netlist* nl, Net* in, u32 length)
+        {
+            const GateLibrary* gl = nl->get_gate_library();
+            for (u32 i = 0; i < length; i++)
+            {
+                Gate* buf = nl->create_gate(gl->get_gate_type_by_name("BUF"), "buf");
+                in->add_destination(buf, "I");
+                in = nl->create_net("buf_out");
+                in->add_source(buf, "O");
+            }
+            return in;
+        }
+
+        static void expect_near(const std::map<Net*, double>& influences, const std::map<Net*, double>& expected, double tolerance)
+        {
+            ASSERT_EQ(influences.size(), expected.size());
+            for (const auto& [net, influence] : expected)
+            {
+                ASSERT_NE(influences.find(net), influences.end());
+                EXPECT_NEAR(influences.at(net), influence, tolerance);
+            }
+        }
+    };
+
+    /**
+     * Test that inputs can only be added to an evaluator before the first instruction.
+     *
+     * Functions: BitslicedEvaluator::add_input
+     */
+    TEST_F(BooleanInfluenceTest, check_evaluator_inputs)
+    {
+        TEST_START
+        {
+            BitslicedEvaluator evaluator;
+            std::unordered_map<std::string, u32> input_slots;
+            for (const std::string var : {"A", "B"})
+            {
+                const auto res = evaluator.add_input();
+                ASSERT_TRUE(res.is_ok());
+                input_slots[var] = res.get();
+            }
+            EXPECT_EQ(input_slots.at("A"), 2);
+            EXPECT_EQ(input_slots.at("B"), 3);
+
+            // a function that only forwards an input does not need any instruction
+            ASSERT_TRUE(evaluator.add_function(BooleanFunction::from_string("A").get(), input_slots).is_ok());
+            EXPECT_EQ(evaluator.get_num_instructions(), 0);
+            EXPECT_TRUE(evaluator.add_input().is_ok());
+
+            ASSERT_TRUE(evaluator.add_function(BooleanFunction::from_string("A & B").get(), input_slots).is_ok());
+            EXPECT_EQ(evaluator.get_num_instructions(), 1);
+            EXPECT_TRUE(evaluator.add_input().is_error());
+            EXPECT_EQ(evaluator.get_num_inputs(), 3);
+            EXPECT_EQ(evaluator.get_num_slots(), 6);
+        }
+        TEST_END
+    }
+
+    /**
+     * Test the exact Boolean influences of small functions.
+     *
+     * Functions: BooleanInfluencePlugin::get_boolean_influence_deterministic
+     */
+    TEST_F(BooleanInfluenceTest, check_deterministic_influence)
+    {
+        TEST_START
+        {
+            {
+                // flipping A or B matters only if the other one is 1 and C is 0, flipping C matters unless A and B are both 1
+                const auto influences = get_deterministic_influences("(A & B) | C");
+                ASSERT_EQ(influences.size(), 3);
+                EXPECT_DOUBLE_EQ(influences.at("A"), 0.25);
+                EXPECT_DOUBLE_EQ(influences.at("B"), 0.25);
+                EXPECT_DOUBLE_EQ(influences.at("C"), 0.75);
+            }
+            {
+                const auto influences = get_deterministic_influences("(A & B) | (A & C) | (B & C)");
+                ASSERT_EQ(influences.size(), 3);
+                EXPECT_DOUBLE_EQ(influences.at("A"), 0.5);
+                EXPECT_DOUBLE_EQ(influences.at("B"), 0.5);
+                EXPECT_DOUBLE_EQ(influences.at("C"), 0.5);
+            }
+            {
+                const auto influences = get_deterministic_influences("A ^ B ^ C ^ D");
+                ASSERT_EQ(influences.size(), 4);
+                for (const auto& [var, influence] : influences)
+                {
+                    EXPECT_DOUBLE_EQ(influence, 1.0);
+                }
+            }
+            {
+                // D selects between A and B, C does not influence the function at all
+                const auto influences = get_deterministic_influences("(D & A) | (~D & B) | (C & ~C)");
+                EXPECT_DOUBLE_EQ(influences.at("A"), 0.5);
+                EXPECT_DOUBLE_EQ(influences.at("B"), 0.5);
+                EXPECT_DOUBLE_EQ(influences.at("D"), 0.5);
+                if (const auto it = influences.find("C"); it != influences.end())
+                {
+                    EXPECT_DOUBLE_EQ(it->second, 0.0);
+                }
+            }
+        }
+        TEST_END
+    }
+
+    /**
+     * Test that the sampled Boolean influences approximate the exact ones.
+     *
+     * Functions: BooleanInfluencePlugin::get_boolean_influence
+     */
+    TEST_F(BooleanInfluenceTest, check_sampled_influence)
+    {
+        TEST_START
+        {
+            const auto res = BooleanInfluencePlugin::get_boolean_influence(BooleanFunction::from_string("(A & B) | C").get(), 32000);
+            ASSERT_TRUE(res.is_ok());
+            const auto influences = res.get();
+            ASSERT_EQ(influences.size(), 3);
+            EXPECT_NEAR(influences.at("A"), 0.25, 0.02);
+            EXPECT_NEAR(influences.at("B"), 0.25, 0.02);
+            EXPECT_NEAR(influences.at("C"), 0.75, 0.02);
+        }
+        TEST_END
+    }
+
+    /**
+     * Test the exact Boolean influences of the nets feeding the data inputs of flip-flops.
+     *
+     * Functions: BooleanInfluencePlugin::get_boolean_influences_of_gate_deterministic
+     */
+    TEST_F(BooleanInfluenceTest, check_gate_influences)
+    {
+        TEST_START
+        {
+            std::vector<Gate*> ffs;
+            std::vector<std::map<Net*, double>> expected;
+            auto nl = create_ff_netlist(ffs, expected);
+
+            for (u32 i = 0; i < ffs.size(); i++)
+            {
+                const auto res = BooleanInfluencePlugin::get_boolean_influences_of_gate_deterministic(ffs.at(i));
+                ASSERT_TRUE(res.is_ok());
+                EXPECT_EQ(res.get(), expected.at(i));
+            }
+        }
+        TEST_END
+    }
+
+    /**
+     * Test the Boolean influences of the nets feeding the data inputs of a batch of flip-flops.
+     *
+     * Functions: BooleanInfluencePlugin::get_boolean_influences_of_gates
+     */
+    TEST_F(BooleanInfluenceTest, check_gates_influences)
+    {
+        TEST_START
+        {
+            std::vector<Gate*> ffs;
+            std::vector<std::map<Net*, double>> expected;
+            auto nl = create_ff_netlist(ffs, expected);
+
+            const auto res = BooleanInfluencePlugin::get_boolean_influences_of_gates(ffs, 32000, 2);
+            ASSERT_TRUE(res.is_ok());
+            const auto influences = res.get();
+            ASSERT_EQ(influences.size(), 2);
+            for (u32 i = 0; i < ffs.size(); i++)
+            {
+                expect_near(influences.at(ffs.at(i)), expected.at(i), 0.02);
+            }
+        }
+        TEST_END
+    }
+
+    /**
+     * Test that the streaming variant reports every flip-flop exactly once with the same influences as the exact computation, even if the flip-flops are split into several batches, and that it
+     * fails without reporting anything if one of the flip-flops cannot be handled.
+     *
+     * Functions: BooleanInfluencePlugin::get_boolean_influences_of_gates, BooleanInfluencePlugin::get_boolean_influences_of_gate_deterministic
+     */
+    TEST_F(BooleanInfluenceTest, check_gates_influences_callback)
+    {
+        TEST_START
+        {
+            // every flip-flop samples (x & y) | z of three inputs that each pass through a chain of buffers, so that the cones of all flip-flops span more nets than fit into a single batch
+            std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+            const GateLibrary* gl       = nl->get_gate_library();
+
+            Net* clk = nl->create_net("clk");
+            nl->mark_global_input_net(clk);
+
+            const u32 num_ffs = 48;
+            const u32 length  = 40;
+            std::vector<Gate*> ffs;
+            for (u32 i = 0; i < num_ffs; i++)
+            {
+                std::vector<Net*> chains;
+                for (const std::string var : {"x", "y", "z"})
+                {
+                    Net* in = nl->create_net(var + "_" + std::to_string(i));
+                    nl->mark_global_input_net(in);
+                    chains.push_back(add_buffer_chain(nl.get(), in, length));
+                }
+
+                Gate* and_gate = nl->create_gate(gl->get_gate_type_by_name("AND2"), "and_" + std::to_string(i));
+                Gate* or_gate  = nl->create_gate(gl->get_gate_type_by_name("OR2"), "or_" + std::to_string(i));
+                Gate* ff       = nl->create_gate(gl->get_gate_type_by_name("DFF"), "ff_" + std::to_string(i));
+                chains.at(0)->add_destination(and_gate, "I0");
+                chains.at(1)->add_destination(and_gate, "I1");
+                Net* xy = nl->create_net("xy_" + std::to_string(i));
+                xy->add_source(and_gate, "O");
+                xy->add_destination(or_gate, "I0");
+                chains.at(2)->add_destination(or_gate, "I1");
+                Net* d = nl->create_net("d_" + std::to_string(i));
+                d->add_source(or_gate, "O");
+                d->add_destination(ff, "D");
+                clk->add_destination(ff, "CLK");
+                ffs.push_back(ff);
+            }
+            // the batches hold at most 4096 nets
+            ASSERT_GT(nl->get_nets().size(), 4096);
+
+            std::map<Gate*, u32> num_calls;
+            std::map<Gate*, std::map<Net*, double>> influences;
+            const auto res = BooleanInfluencePlugin::get_boolean_influences_of_gates(
+                ffs,
+                [&num_calls, &influences](Gate* gate, const std::map<Net*, double>& gate_influences) {
+                    num_calls[gate]++;
+                    influences[gate] = gate_influences;
+                },
+                32000,
+                2);
+            ASSERT_TRUE(res.is_ok());
+            ASSERT_EQ(num_calls.size(), num_ffs);
+            for (Gate* ff : ffs)
+            {
+                EXPECT_EQ(num_calls.at(ff), 1);
+
+                const auto expected_res = BooleanInfluencePlugin::get_boolean_influences_of_gate_deterministic(ff);
+                ASSERT_TRUE(expected_res.is_ok());
+                expect_near(influences.at(ff), expected_res.get(), 0.02);
+            }
+        }
+        {
+            // the callback is never called if one of the gates is not a flip-flop or its data port is not connected
+            std::vector<Gate*> ffs;
+            std::vector<std::map<Net*, double>> expected;
+            auto nl = create_ff_netlist(ffs, expected);
+
+            u32 num_calls          = 0;
+            const auto count_calls = [&num_calls](Gate*, const std::map<Net*, double>&) { num_calls++; };
+
+            Gate* and_gate = nl->get_gates([](const Gate* g) { return g->get_name() == "and"; }).front();
+            EXPECT_TRUE(BooleanInfluencePlugin::get_boolean_influences_of_gates({ffs.at(0), and_gate}, count_calls).is_error());
+
+            Gate* unconnected_ff = nl->create_gate(nl->get_gate_library()->get_gate_type_by_name("DFF"), "unconnected");
+            EXPECT_TRUE(BooleanInfluencePlugin::get_boolean_influences_of_gates({ffs.at(0), ffs.at(1), unconnected_ff}, count_calls).is_error());
+            EXPECT_EQ(num_calls, 0);
+        }
+        TEST_END
+    }
+
+    /**
+     * Test that inputs of the fan-in cone without influence on the data net are reported with an influence of zero by the single and the batched computation alike.
+     *
+     * Functions: BooleanInfluencePlugin::get_boolean_influences_of_gates, BooleanInfluencePlugin::get_boolean_influences_of_gate, BooleanInfluencePlugin::get_boolean_influences_of_gate_deterministic
+     */
+    TEST_F(BooleanInfluenceTest, check_gates_influences_without_influence)
+    {
+        TEST_START
+        {
+            // the flip-flop samples (a ^ a) | c, so a is part of the fan-in cone but has no influence
+            std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+            const GateLibrary* gl       = nl->get_gate_library();
+
+            Net* clk = nl->create_net("clk");
+            Net* a   = nl->create_net("a");
+            Net* c   = nl->create_net("c");
+            for (Net* net : {clk, a, c})
+            {
+                nl->mark_global_input_net(net);
+            }
+
+            Gate* xor_gate = nl->create_gate(gl->get_gate_type_by_name("XOR2"), "xor");
+            Gate* or_gate  = nl->create_gate(gl->get_gate_type_by_name("OR2"), "or");
+            Gate* ff       = nl->create_gate(gl->get_gate_type_by_name("DFF"), "ff");
+
+            a->add_destination(xor_gate, "I0");
+            a->add_destination(xor_gate, "I1");
+            Net* aa = nl->create_net("aa");
+            aa->add_source(xor_gate, "O");
+            aa->add_destination(or_gate, "I0");
+            c->add_destination(or_gate, "I1");
+            Net* d = nl->create_net("d");
+            d->add_source(or_gate, "O");
+            d->add_destination(ff, "D");
+            clk->add_destination(ff, "CLK");
+
+            const std::map<Net*, double> expected = {{a, 0.0}, {c, 1.0}};
+
+            const auto deterministic_res = BooleanInfluencePlugin::get_boolean_influences_of_gate_deterministic(ff);
+            ASSERT_TRUE(deterministic_res.is_ok());
+            EXPECT_EQ(deterministic_res.get(), expected);
+
+            const auto single_res = BooleanInfluencePlugin::get_boolean_influences_of_gate(ff);
+            ASSERT_TRUE(single_res.is_ok());
+            expect_near(single_res.get(), expected, 0.02);
+
+            const auto batch_res = BooleanInfluencePlugin::get_boolean_influences_of_gates({ff});
+            ASSERT_TRUE(batch_res.is_ok());
+            ASSERT_EQ(batch_res.get().size(), 1);
+            expect_near(batch_res.get().at(ff), expected, 0.02);
+            EXPECT_EQ(batch_res.get().at(ff).at(a), 0.0);
+        }
+        TEST_END
+    }
+}    // namespace hal
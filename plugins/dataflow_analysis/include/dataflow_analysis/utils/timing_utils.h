@@ -26,6 +26,7 @@
 #pragma once
 
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/trace.h"
 
 #include <chrono>
 
@@ -44,7 +45,7 @@ namespace hal
         class measure_block_time_t
         {
         public:
-            measure_block_time_t(const std::string& section_name)
+            measure_block_time_t(const std::string& section_name) : m_span(section_name)
             {
                 m_name       = section_name;
                 m_begin_time = std::chrono::high_resolution_clock::now();
@@ -56,6 +57,8 @@ namespace hal
             }
 
         private:
+            // also records the section when tracing is enabled
+            trace::Span m_span;
             std::string m_name;
             std::chrono::time_point<std::chrono::high_resolution_clock> m_begin_time;
         };
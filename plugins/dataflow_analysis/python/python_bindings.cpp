@@ -179,6 +179,7 @@ namespace hal
             },
             py::arg("nl"),
             py::arg("config") = dataflow::Configuration(),
+            py::call_guard<py::gil_scoped_release>(),
             R"(
                 Analyze the datapath to identify word-level registers in the given netlist.
 
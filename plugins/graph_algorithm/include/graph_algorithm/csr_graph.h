@@ -0,0 +1,179 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <limits>
+#include <vector>
+
+namespace hal
+{
+    /* forward declaration */
+    class Netlist;
+    class Gate;
+
+    /**
+     * An immutable snapshot of the connectivity between the gates of a netlist in compressed sparse row (CSR) format that serves as input to the native graph kernels.<br>
+     * Each gate is represented by a vertex and there is an edge from gate A to gate B if a net driven by A has B as a destination.
+     * Parallel edges are merged, global inputs and outputs are not represented.
+     * Vertices are ordered by gate ID.<br>
+     * Since the snapshot is not updated when the netlist is modified, it has to be recreated after modifications.
+     * A snapshot can safely be read by multiple threads at once.
+     *
+     * @ingroup graph_algorithm
+     */
+    class PLUGIN_API CsrGraph
+    {
+    public:
+        /**
+         * Value returned for gates that are not represented by a vertex.
+         */
+        static constexpr u32 NO_VERTEX = std::numeric_limits<u32>::max();
+
+        /**
+         * Create a snapshot of the entire netlist.
+         *
+         * @param[in] netlist - The netlist.
+         * @param[in] num_threads - The number of threads to use. Defaults to `0`, which uses as many threads as there are hardware threads.
+         */
+        explicit CsrGraph(const Netlist* netlist, u32 num_threads = 0);
+
+        /**
+         * Create a snapshot of a subset of the gates of the netlist.
+         * Only edges between gates of the subset are represented.
+         *
+         * @param[in] netlist - The netlist.
+         * @param[in] gates - The gates to represent.
+         * @param[in] num_threads - The number of threads to use. Defaults to `0`, which uses as many threads as there are hardware threads.
+         */
+        CsrGraph(const Netlist* netlist, const std::vector<Gate*>& gates, u32 num_threads = 0);
+
+        /**
+         * Get the netlist the snapshot was created from.
+         *
+         * @returns The netlist.
+         */
+        const Netlist* get_netlist() const;
+
+        /**
+         * Get the number of vertices.
+         *
+         * @returns The number of vertices.
+         */
+        u32 get_num_vertices() const;
+
+        /**
+         * Get the number of edges.
+         *
+         * @returns The number of edges.
+         */
+        u32 get_num_edges() const;
+
+        /**
+         * Get the gates represented by the snapshot ordered by their vertex index.
+         *
+         * @returns The gates.
+         */
+        const std::vector<Gate*>& get_gates() const;
+
+        /**
+         * Get the gate represented by a vertex.
+         *
+         * @param[in] vertex - The vertex index.
+         * @returns The gate, or a nullptr for invalid indices.
+         */
+        Gate* get_gate_of_vertex(u32 vertex) const;
+
+        /**
+         * Get the vertex representing a gate.
+         *
+         * @param[in] gate - The gate.
+         * @returns The vertex index, or `CsrGraph::NO_VERTEX` if the gate is not represented by the snapshot.
+         */
+        u32 get_vertex_of_gate(const Gate* gate) const;
+
+        /**
+         * Get the vertices representing the given gates, skipping gates that are not represented by the snapshot.
+         *
+         * @param[in] gates - The gates.
+         * @returns The vertex indices.
+         */
+        std::vector<u32> get_vertices_of_gates(const std::vector<Gate*>& gates) const;
+
+        /**
+         * Get the gates represented by the given vertices.
+         *
+         * @param[in] vertices - The vertex indices.
+         * @returns The gates.
+         */
+        std::vector<Gate*> get_gates_of_vertices(const std::vector<u32>& vertices) const;
+
+        /**
+         * Get the offsets of the successor lists of all vertices.
+         * The successors of vertex `v` are stored in the range from `get_successor_offsets()[v]` to `get_successor_offsets()[v + 1]` of `get_successors()`.
+         *
+         * @returns The offsets with one entry per vertex plus one.
+         */
+        const std::vector<u32>& get_successor_offsets() const;
+
+        /**
+         * Get the concatenated successor lists of all vertices, each list being sorted in ascending order.
+         *
+         * @returns The successors.
+         */
+        const std::vector<u32>& get_successors() const;
+
+        /**
+         * Get the offsets of the predecessor lists of all vertices.
+         * The predecessors of vertex `v` are stored in the range from `get_predecessor_offsets()[v]` to `get_predecessor_offsets()[v + 1]` of `get_predecessors()`.
+         *
+         * @returns The offsets with one entry per vertex plus one.
+         */
+        const std::vector<u32>& get_predecessor_offsets() const;
+
+        /**
+         * Get the concatenated predecessor lists of all vertices, each list being sorted in ascending order.
+         *
+         * @returns The predecessors.
+         */
+        const std::vector<u32>& get_predecessors() const;
+
+    private:
+        const Netlist* m_netlist;
+
+        // per vertex index: gate, per gate ID: vertex index
+        std::vector<Gate*> m_vertex_to_gate;
+        std::vector<u32> m_gate_to_vertex;
+
+        std::vector<u32> m_successor_offsets;
+        std::vector<u32> m_successors;
+        std::vector<u32> m_predecessor_offsets;
+        std::vector<u32> m_predecessors;
+
+        void build(u32 num_threads);
+    };
+}    // namespace hal
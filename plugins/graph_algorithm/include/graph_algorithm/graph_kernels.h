@@ -0,0 +1,135 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "graph_algorithm/csr_graph.h"
+#include "hal_core/defines.h"
+
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * Native graph kernels operating on a CSR snapshot of a netlist.<br>
+     * All kernels only read the snapshot and distribute their work across multiple threads.
+     * Vertices are referred to by their index within the snapshot, use `CsrGraph::get_gates_of_vertices` to map the results back to gates.
+     *
+     * @ingroup graph_algorithm
+     */
+    namespace graph_kernels
+    {
+        /**
+         * The direction in which edges are traversed.
+         */
+        enum class Direction
+        {
+            successors,      /**< Follow edges from driver to destination. **/
+            predecessors,    /**< Follow edges from destination to driver. **/
+            both             /**< Follow edges in both directions. **/
+        };
+
+        /**
+         * Distance returned for vertices that are not reachable.
+         */
+        constexpr u32 UNREACHABLE = std::numeric_limits<u32>::max();
+
+        /**
+         * Compute the strongly connected components (SCCs) of the graph.<br>
+         * Vertices that cannot be part of a cycle are trimmed first, the remaining vertices are partitioned by forward-backward reachability with the partitions being processed in parallel.
+         * Each SCC is sorted in ascending order and the SCCs are sorted by their smallest vertex.
+         *
+         * @param[in] graph - The graph.
+         * @param[in] include_singletons - Set `true` to include SCCs consisting of a single vertex without a self-loop, `false` otherwise.
+         * @param[in] num_threads - The number of threads to use. Defaults to `0`, which uses as many threads as there are hardware threads.
+         * @returns The SCCs.
+         */
+        PLUGIN_API std::vector<std::vector<u32>> get_strongly_connected_components(const CsrGraph& graph, bool include_singletons = true, u32 num_threads = 0);
+
+        /**
+         * Compute the distance of every vertex to the closest of the given source vertices using a level-synchronous breadth-first search.<br>
+         * The frontier of each level is stored as a bitset and is expanded in parallel.
+         *
+         * @param[in] graph - The graph.
+         * @param[in] sources - The source vertices.
+         * @param[in] direction - The direction in which edges are traversed.
+         * @param[in] max_depth - The maximum distance to explore. Defaults to exploring all reachable vertices.
+         * @param[in] num_threads - The number of threads to use. Defaults to `0`, which uses as many threads as there are hardware threads.
+         * @returns The distance of each vertex, `graph_kernels::UNREACHABLE` for vertices that have not been reached.
+         */
+        PLUGIN_API std::vector<u32>
+            get_distances(const CsrGraph& graph, const std::vector<u32>& sources, Direction direction, u32 max_depth = std::numeric_limits<u32>::max(), u32 num_threads = 0);
+
+        /**
+         * Compute the transitive cone of each of the given start vertices, i.e., all vertices that are reachable from the start vertex via at least one edge.<br>
+         * The traversal does not continue beyond vertices whose gates match the stop filter, these vertices are still part of the cone.
+         * For example, using a stop filter that matches flip-flops yields the combinational logic between a flip-flop and the next flip-flops including the latter.
+         * A start vertex is only part of its own cone if it lies on a cycle, invalid start vertices yield empty cones.<br>
+         * The cones of up to 64 start vertices are computed at once by a bit-parallel breadth-first search, batches of start vertices are processed in parallel.
+         * Each cone is sorted in ascending order.
+         *
+         * @param[in] graph - The graph.
+         * @param[in] start_vertices - The start vertices.
+         * @param[in] direction - The direction in which edges are traversed.
+         * @param[in] stop_filter - A filter matching the gates at which the traversal stops. Defaults to no filter.
+         * @param[in] num_threads - The number of threads to use. Defaults to `0`, which uses as many threads as there are hardware threads.
+         * @returns The cone of each start vertex.
+         */
+        PLUGIN_API std::vector<std::vector<u32>> get_transitive_cones(const CsrGraph& graph,
+                                                                      const std::vector<u32>& start_vertices,
+                                                                      Direction direction,
+                                                                      const std::function<bool(const Gate*)>& stop_filter = nullptr,
+                                                                      u32 num_threads                                      = 0);
+
+        /**
+         * Compute the k-hop neighborhood of each of the given start vertices, i.e., all vertices that are reachable from the start vertex via at least one and at most `k` edges.<br>
+         * A start vertex is only part of its own neighborhood if it lies on a cycle of length at most `k`, invalid start vertices yield empty neighborhoods.<br>
+         * The neighborhoods of up to 64 start vertices are computed at once by a bit-parallel breadth-first search, batches of start vertices are processed in parallel.
+         * Each neighborhood is sorted in ascending order.
+         *
+         * @param[in] graph - The graph.
+         * @param[in] start_vertices - The start vertices.
+         * @param[in] k - The maximum number of edges.
+         * @param[in] direction - The direction in which edges are traversed.
+         * @param[in] num_threads - The number of threads to use. Defaults to `0`, which uses as many threads as there are hardware threads.
+         * @returns The neighborhood of each start vertex.
+         */
+        PLUGIN_API std::vector<std::vector<u32>>
+            get_neighborhoods(const CsrGraph& graph, const std::vector<u32>& start_vertices, u32 k, Direction direction = Direction::both, u32 num_threads = 0);
+
+        /**
+         * Compute a shortest path between two vertices using a breadth-first search.
+         *
+         * @param[in] graph - The graph.
+         * @param[in] from - The start vertex.
+         * @param[in] to - The end vertex.
+         * @param[in] direction - The direction in which edges are traversed.
+         * @returns The vertices of the path including start and end vertex, or an empty vector if there is no path.
+         */
+        PLUGIN_API std::vector<u32> get_shortest_path(const CsrGraph& graph, u32 from, u32 to, Direction direction = Direction::successors);
+    }    // namespace graph_kernels
+}    // namespace hal
@@ -0,0 +1,205 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/utilities/result.h"
+
+#include <igraph/igraph.h>
+#include <limits>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace hal
+{
+    /* forward declaration */
+    class Netlist;
+    class Gate;
+    class Net;
+
+    /**
+     * A persistent directed igraph representation of a netlist or of a subset of its gates that can be passed to all algorithms of the graph algorithm plugin.<br>
+     * Each gate is transformed to a vertex and each net is transformed to edges from its sources to its destinations.
+     * For nets without a source or without a destination within the represented gates, a dummy vertex is added as the missing endpoint.
+     * Gate vertices are ordered by gate ID and are followed by the dummy vertices.<br>
+     * The graph is built on first access and kept up to date by listening to gate and net events of the netlist.
+     * Modified nets are only marked as dirty and are reconverted on the next access, the remaining nets are taken from a cache.
+     * Gates that are added to the netlist only become part of a handle that represents the entire netlist.
+     * While event batching is enabled, modifications are only picked up once the batch has been flushed.
+     * If events are disabled while modifying the netlist, the handle has to be invalidated manually.<br>
+     * A handle must not outlive its netlist.
+     *
+     * @ingroup graph_algorithm
+     */
+    class PLUGIN_API IGraphHandle
+    {
+    public:
+        /**
+         * Value returned for gates that are not represented by a vertex.
+         */
+        static constexpr u32 NO_VERTEX = std::numeric_limits<u32>::max();
+
+        /**
+         * Create a handle representing the entire netlist.
+         *
+         * @param[in] netlist - The netlist.
+         */
+        explicit IGraphHandle(Netlist* netlist);
+
+        /**
+         * Create a handle representing a subset of the gates of the netlist.
+         * Nets crossing the boundary of the subset are connected to dummy vertices.
+         *
+         * @param[in] netlist - The netlist.
+         * @param[in] gates - The gates to represent.
+         */
+        IGraphHandle(Netlist* netlist, const std::vector<Gate*>& gates);
+
+        /**
+         * Unregister the event callbacks and destroy the igraph.
+         */
+        ~IGraphHandle();
+
+        IGraphHandle(const IGraphHandle&)            = delete;
+        IGraphHandle& operator=(const IGraphHandle&) = delete;
+
+        /**
+         * Get the netlist represented by the handle.
+         *
+         * @returns The netlist.
+         */
+        Netlist* get_netlist() const;
+
+        /**
+         * Check whether the handle represents a subset of the gates of the netlist instead of the entire netlist.
+         *
+         * @returns True if the handle represents a subset of the gates, false otherwise.
+         */
+        bool is_subgraph() const;
+
+        /**
+         * Check whether the igraph is up to date, i.e., whether no relevant modification happened since it was last built.
+         *
+         * @returns True if the igraph is up to date, false otherwise.
+         */
+        bool is_up_to_date() const;
+
+        /**
+         * Discard all cached conversion results so that the igraph is rebuilt from scratch on the next access.
+         */
+        void invalidate();
+
+        /**
+         * Get the igraph, updating it first if necessary.<br>
+         * The igraph is owned by the handle and must not be modified, copy it using `igraph_copy` to run destructive operations.
+         * The pointer remains valid until the handle is destroyed, but the graph may change on the next access after a modification of the netlist.
+         *
+         * @returns The igraph.
+         */
+        const igraph_t* get_igraph();
+
+        /**
+         * Get the number of vertices including dummy vertices, updating the igraph first if necessary.
+         *
+         * @returns The number of vertices.
+         */
+        u32 get_num_vertices();
+
+        /**
+         * Get the number of gate vertices, updating the igraph first if necessary.
+         * Gate vertices have the indices from 0 to the number of gate vertices minus one.
+         *
+         * @returns The number of gate vertices.
+         */
+        u32 get_num_gate_vertices();
+
+        /**
+         * Get the gates represented by the handle ordered by their vertex index, updating the igraph first if necessary.
+         *
+         * @returns The gates.
+         */
+        const std::vector<Gate*>& get_gates();
+
+        /**
+         * Get the gate represented by a vertex, updating the igraph first if necessary.
+         *
+         * @param[in] vertex - The vertex index.
+         * @returns The gate, or a nullptr for dummy vertices and invalid indices.
+         */
+        Gate* get_gate_of_vertex(u32 vertex);
+
+        /**
+         * Get the vertex representing a gate, updating the igraph first if necessary.
+         *
+         * @param[in] gate - The gate.
+         * @returns The vertex index, or `IGraphHandle::NO_VERTEX` if the gate is not represented by the handle.
+         */
+        u32 get_vertex_of_gate(const Gate* gate);
+
+        /**
+         * Group the gates of the handle by the membership of their vertices as computed by an igraph clustering algorithm.
+         * Dummy vertices are ignored.
+         *
+         * @param[in] membership - The membership vector with one entry per vertex.
+         * @returns A map from membership ID to the gates of that membership.
+         */
+        std::map<int, std::set<Gate*>> get_memberships(const igraph_vector_t* membership);
+
+    private:
+        // edge endpoint standing for the dummy vertex of a net, gate IDs start at 1
+        static constexpr u32 DUMMY_ENDPOINT = 0;
+
+        Netlist* m_netlist;
+        bool m_is_subgraph;
+        std::string m_callback_name;
+
+        // per gate ID: whether the gate is represented, only used for subgraphs
+        std::vector<bool> m_gate_selected;
+
+        // per net ID: edges as pairs of gate IDs, the dummy vertex of the net is denoted by 'DUMMY_ENDPOINT'
+        std::vector<std::vector<std::pair<u32, u32>>> m_net_edges;
+        std::vector<bool> m_net_dirty;
+        std::vector<u32> m_dirty_nets;
+        bool m_nets_invalid   = true;
+        bool m_vertices_dirty = true;
+        bool m_graph_dirty    = true;
+
+        // per gate ID: vertex index, per vertex index: gate
+        std::vector<u32> m_gate_to_vertex;
+        std::vector<Gate*> m_vertex_to_gate;
+
+        igraph_t m_graph;
+        bool m_graph_initialized = false;
+
+        bool is_selected(u32 gate_id) const;
+        void mark_net_dirty(u32 net_id);
+        void convert_net(const Net* net);
+        void update();
+        void register_callbacks();
+    };
+}    // namespace hal
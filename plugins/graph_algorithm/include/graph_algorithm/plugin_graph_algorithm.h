@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include "graph_algorithm/igraph_handle.h"
 #include "hal_core/plugin_system/plugin_interface_base.h"
 
 #include <igraph/igraph.h>
@@ -75,6 +76,15 @@ namespace hal
          */
         std::map<int, std::set<Gate*>> get_communities(Netlist* const netlist);
 
+        /**
+         * Get a map of community IDs to communities of the gates represented by an igraph handle. Each community is represented by a set of gates.<br>
+         * In contrast to the netlist variant, leaf gates are pruned from the graph instead of being deleted from the netlist.
+         *
+         * @param[in] handle - The igraph handle to operate on.
+         * @returns A map from community IDs to communities.
+         */
+        std::map<int, std::set<Gate*>> get_communities(IGraphHandle* handle);
+
         /**
          * Get a map of community IDs to communities running the spinglass clustering algorithm. Each community is represented by a set of gates.
          *
@@ -84,6 +94,15 @@ namespace hal
          */
         std::map<int, std::set<Gate*>> get_communities_spinglass(Netlist* const netlist, u32 const spins);
 
+        /**
+         * Get a map of community IDs to communities of the gates represented by an igraph handle running the spinglass clustering algorithm. Each community is represented by a set of gates.
+         *
+         * @param[in] handle - The igraph handle to operate on.
+         * @param[in] spins - The number of spins.
+         * @returns A map from community IDs to communities.
+         */
+        std::map<int, std::set<Gate*>> get_communities_spinglass(IGraphHandle* handle, u32 const spins);
+
         /**
          * Get a map of community IDs to communities running the fast greedy clustering algorithm from igraph. Each community is represented by a set of gates.
          *
@@ -92,6 +111,14 @@ namespace hal
          */
         std::map<int, std::set<Gate*>> get_communities_fast_greedy(Netlist* const netlist);
 
+        /**
+         * Get a map of community IDs to communities of the gates represented by an igraph handle running the fast greedy clustering algorithm from igraph. Each community is represented by a set of gates.
+         *
+         * @param[in] handle - The igraph handle to operate on.
+         * @returns A map from community IDs to communities.
+         */
+        std::map<int, std::set<Gate*>> get_communities_fast_greedy(IGraphHandle* handle);
+
         /**
          * Get a vector of strongly connected components (SCC) with each SSC being represented by a vector of gates.
          *
@@ -100,6 +127,14 @@ namespace hal
          */
         std::vector<std::vector<Gate*>> get_strongly_connected_components(Netlist* netlist);
 
+        /**
+         * Get a vector of strongly connected components (SCC) of the gates represented by an igraph handle with each SSC being represented by a vector of gates.
+         *
+         * @param[in] handle - The igraph handle to operate on.
+         * @returns A vector of SCCs.
+         */
+        std::vector<std::vector<Gate*>> get_strongly_connected_components(IGraphHandle* handle);
+
         /**
          * Get a graph cut for a specific gate and depth. Further, a set of gates can be specified that limit the graph cut, i.e., flip-flops and memory cells.<br>
          * The graph cut is returned as a vector of sets of gates with the vector's index representing the distance of each set to the starting point.
@@ -113,6 +148,19 @@ namespace hal
         std::vector<std::set<Gate*>>
             get_graph_cut(Netlist* const netlist, Gate* gate, const u32 depth = std::numeric_limits<u32>::max(), const std::set<std::string> terminal_gate_type = std::set<std::string>());
 
+        /**
+         * Get a graph cut for a specific gate and depth within the gates represented by an igraph handle. Further, a set of gates can be specified that limit the graph cut, i.e., flip-flops and memory cells.<br>
+         * The graph cut is returned as a vector of sets of gates with the vector's index representing the distance of each set to the starting point.
+         *
+         * @param[in] handle - The igraph handle to operate on.
+         * @param[in] gate - The gate that is the starting point for the graph cut.
+         * @param[in] depth - The depth of the graph cut.
+         * @param[in] terminal_gate_type - A set of gates at which to terminate the graph cut.
+         * @returns The graph cut as a vector of sets of gates.
+         */
+        std::vector<std::set<Gate*>>
+            get_graph_cut(IGraphHandle* handle, Gate* gate, const u32 depth = std::numeric_limits<u32>::max(), const std::set<std::string> terminal_gate_type = std::set<std::string>());
+
         /*
          *      igraph specific functions
          */
@@ -121,6 +169,7 @@ namespace hal
          * Generates an directed graph based on the current netlist. Each gate is transformed to a node while each
          * net is transformed to an edge. The function returns the mapping from igraph node ids to HAL gates. Note
          * that for each global input and output dummy nodes are generated in the igraph representation.
+         * Use an IGraphHandle instead to reuse the conversion across multiple algorithms.
          *
          * @param[in] netlist - The netlist to operate on.
          * @param[in] igraph - igraph object
@@ -1,6 +1,9 @@
 
 #include "hal_core/python_bindings/python_bindings.h"
 
+#include "graph_algorithm/csr_graph.h"
+#include "graph_algorithm/graph_kernels.h"
+#include "graph_algorithm/igraph_handle.h"
 #include "graph_algorithm/plugin_graph_algorithm.h"
 
 #pragma GCC diagnostic push
@@ -37,6 +40,101 @@ namespace hal
         py::module m("graph_algorithm", "hal GraphAlgorithmPlugin python bindings");
 #endif    // ifdef PYBIND11_MODULE
 
+        py::class_<IGraphHandle> py_igraph_handle(m, "IGraphHandle", R"(
+            A persistent directed igraph representation of a netlist or of a subset of its gates that can be passed to all algorithms of the graph algorithm plugin.
+            Each gate is transformed to a vertex and each net is transformed to edges from its sources to its destinations.
+            For nets without a source or without a destination within the represented gates, a dummy vertex is added as the missing endpoint.
+            Gate vertices are ordered by gate ID and are followed by the dummy vertices.
+            The graph is built on first access and kept up to date by listening to gate and net events of the netlist, only modified nets are converted again.
+            Gates that are added to the netlist only become part of a handle that represents the entire netlist.
+            If events are disabled while modifying the netlist, the handle has to be invalidated manually.
+        )");
+
+        py_igraph_handle.attr("NO_VERTEX") = IGraphHandle::NO_VERTEX;
+
+        py_igraph_handle.def(py::init<Netlist*>(), py::arg("netlist"), py::keep_alive<1, 2>(), R"(
+            Create a handle representing the entire netlist.
+
+            :param hal_py.Netlist netlist: The netlist.
+        )");
+
+        py_igraph_handle.def(py::init<Netlist*, const std::vector<Gate*>&>(), py::arg("netlist"), py::arg("gates"), py::keep_alive<1, 2>(), R"(
+            Create a handle representing a subset of the gates of the netlist.
+            Nets crossing the boundary of the subset are connected to dummy vertices.
+
+            :param hal_py.Netlist netlist: The netlist.
+            :param list[hal_py.Gate] gates: The gates to represent.
+        )");
+
+        py_igraph_handle.def_property_readonly("netlist", &IGraphHandle::get_netlist, R"(
+            The netlist represented by the handle.
+
+            :type: hal_py.Netlist
+        )");
+
+        py_igraph_handle.def("get_netlist", &IGraphHandle::get_netlist, R"(
+            Get the netlist represented by the handle.
+
+            :returns: The netlist.
+            :rtype: hal_py.Netlist
+        )");
+
+        py_igraph_handle.def("is_subgraph", &IGraphHandle::is_subgraph, R"(
+            Check whether the handle represents a subset of the gates of the netlist instead of the entire netlist.
+
+            :returns: ``True`` if the handle represents a subset of the gates, ``False`` otherwise.
+            :rtype: bool
+        )");
+
+        py_igraph_handle.def("is_up_to_date", &IGraphHandle::is_up_to_date, R"(
+            Check whether the igraph is up to date, i.e., whether no relevant modification happened since it was last built.
+
+            :returns: ``True`` if the igraph is up to date, ``False`` otherwise.
+            :rtype: bool
+        )");
+
+        py_igraph_handle.def("invalidate", &IGraphHandle::invalidate, R"(
+            Discard all cached conversion results so that the igraph is rebuilt from scratch on the next access.
+        )");
+
+        py_igraph_handle.def("get_num_vertices", &IGraphHandle::get_num_vertices, R"(
+            Get the number of vertices including dummy vertices, updating the igraph first if necessary.
+
+            :returns: The number of vertices.
+            :rtype: int
+        )");
+
+        py_igraph_handle.def("get_num_gate_vertices", &IGraphHandle::get_num_gate_vertices, R"(
+            Get the number of gate vertices, updating the igraph first if necessary.
+            Gate vertices have the indices from 0 to the number of gate vertices minus one.
+
+            :returns: The number of gate vertices.
+            :rtype: int
+        )");
+
+        py_igraph_handle.def("get_gates", &IGraphHandle::get_gates, R"(
+            Get the gates represented by the handle ordered by their vertex index, updating the igraph first if necessary.
+
+            :returns: The gates.
+            :rtype: list[hal_py.Gate]
+        )");
+
+        py_igraph_handle.def("get_gate_of_vertex", &IGraphHandle::get_gate_of_vertex, py::arg("vertex"), R"(
+            Get the gate represented by a vertex, updating the igraph first if necessary.
+
+            :param int vertex: The vertex index.
+            :returns: The gate, or ``None`` for dummy vertices and invalid indices.
+            :rtype: hal_py.Gate or None
+        )");
+
+        py_igraph_handle.def("get_vertex_of_gate", &IGraphHandle::get_vertex_of_gate, py::arg("gate"), R"(
+            Get the vertex representing a gate, updating the igraph first if necessary.
+
+            :param hal_py.Gate gate: The gate.
+            :returns: The vertex index, or ``IGraphHandle.NO_VERTEX`` if the gate is not represented by the handle.
+            :rtype: int
+        )");
+
         py::class_<GraphAlgorithmPlugin, RawPtrWrapper<GraphAlgorithmPlugin>, BasePluginInterface>(m, "GraphAlgorithmPlugin")
             .def_property_readonly("name", &GraphAlgorithmPlugin::get_name, R"(
                 The name of the plugin.
@@ -60,14 +158,22 @@ namespace hal
                 :returns: Plugin version.
                 :rtype: str
                 )")
-            .def("get_communities", &GraphAlgorithmPlugin::get_communities, py::arg("netlist"), R"(
+            .def("get_communities", py::overload_cast<Netlist* const>(&GraphAlgorithmPlugin::get_communities), py::arg("netlist"), R"(
                 Get a dict of community IDs to communities. Each community is represented by a set of gates.
 
                 :param hal_py.Netlist netlist: The netlist to operate on.
                 :returns: A dict from community IDs to communities.
                 :rtype: dict[int,set[hal_py.get_gate()]]
                 )")
-            .def("get_communities_spinglass", &GraphAlgorithmPlugin::get_communities_spinglass, py::arg("netlist"), py::arg("spins"), R"(
+            .def("get_communities", py::overload_cast<IGraphHandle*>(&GraphAlgorithmPlugin::get_communities), py::arg("handle"), R"(
+                Get a dict of community IDs to communities of the gates represented by an igraph handle. Each community is represented by a set of gates.
+                In contrast to the netlist variant, leaf gates are pruned from the graph instead of being deleted from the netlist.
+
+                :param graph_algorithm.IGraphHandle handle: The igraph handle to operate on.
+                :returns: A dict from community IDs to communities.
+                :rtype: dict[int,set[hal_py.Gate]]
+                )")
+            .def("get_communities_spinglass", py::overload_cast<Netlist* const, u32 const>(&GraphAlgorithmPlugin::get_communities_spinglass), py::arg("netlist"), py::arg("spins"), R"(
                 Get a dict of community IDs to communities running the spinglass clustering algorithm. Each community is represented by a set of gates.
 
                 :param hal_py.Netlist netlist: The netlist to operate on.
@@ -75,13 +181,28 @@ namespace hal
                 :returns: A dict from community IDs to communities.
                 :rtype: dict[int,set[hal_py.get_gate()]]
                 )")
-            .def("get_communities_fast_greedy", &GraphAlgorithmPlugin::get_communities_fast_greedy, py::arg("netlist"), R"(
+            .def("get_communities_spinglass", py::overload_cast<IGraphHandle*, u32 const>(&GraphAlgorithmPlugin::get_communities_spinglass), py::arg("handle"), py::arg("spins"), R"(
+                Get a dict of community IDs to communities of the gates represented by an igraph handle running the spinglass clustering algorithm. Each community is represented by a set of gates.
+
+                :param graph_algorithm.IGraphHandle handle: The igraph handle to operate on.
+                :param int spins: The number of spins.
+                :returns: A dict from community IDs to communities.
+                :rtype: dict[int,set[hal_py.Gate]]
+                )")
+            .def("get_communities_fast_greedy", py::overload_cast<Netlist* const>(&GraphAlgorithmPlugin::get_communities_fast_greedy), py::arg("netlist"), R"(
                 Get a dict of community IDs to communities running the fast greedy clustering algorithm from igraph. Each community is represented by a set of gates.
 
                 :param hal_py.Netlist netlist: The netlist to operate on.
                 :returns: A dict from community IDs to communities.
                 :rtype: dict[set[hal_py.get_gate()]]
                 )")
+            .def("get_communities_fast_greedy", py::overload_cast<IGraphHandle*>(&GraphAlgorithmPlugin::get_communities_fast_greedy), py::arg("handle"), R"(
+                Get a dict of community IDs to communities of the gates represented by an igraph handle running the fast greedy clustering algorithm from igraph. Each community is represented by a set of gates.
+
+                :param graph_algorithm.IGraphHandle handle: The igraph handle to operate on.
+                :returns: A dict from community IDs to communities.
+                :rtype: dict[int,set[hal_py.Gate]]
+                )")
             /*
             .def("get_communities_multilevel", &GraphAlgorithmPlugin::get_communities_multilevel, py::arg("netlist"), R"(
                 Get a dict of community IDs to communities running the multilevel clustering algorithm from igraph. Each community is represented by a set of gates.
@@ -90,15 +211,22 @@ namespace hal
                 :returns: A dict from community IDs to communities.
                 :rtype: dict[int,set[hal_py.get_gate()]]
                 )") */
-            .def("get_strongly_connected_components", &GraphAlgorithmPlugin::get_strongly_connected_components, py::arg("netlist"), R"(
+            .def("get_strongly_connected_components", py::overload_cast<Netlist*>(&GraphAlgorithmPlugin::get_strongly_connected_components), py::arg("netlist"), R"(
                 Get a list of strongly connected components (SCC) with each SSC being represented by a list of gates.
 
                 :param hal_py.Netlist netlist: The netlist to operate on.
                 :returns: A list of SCCs.
                 :rtype: list[list[hal_py.get_gate()]]
                 )")
+            .def("get_strongly_connected_components", py::overload_cast<IGraphHandle*>(&GraphAlgorithmPlugin::get_strongly_connected_components), py::arg("handle"), R"(
+                Get a list of strongly connected components (SCC) of the gates represented by an igraph handle with each SSC being represented by a list of gates.
+
+                :param graph_algorithm.IGraphHandle handle: The igraph handle to operate on.
+                :returns: A list of SCCs.
+                :rtype: list[list[hal_py.Gate]]
+                )")
             .def("get_graph_cut",
-                 &GraphAlgorithmPlugin::get_graph_cut,
+                 py::overload_cast<Netlist* const, Gate*, const u32, const std::set<std::string>>(&GraphAlgorithmPlugin::get_graph_cut),
                  py::arg("netlist"),
                  py::arg("gate"),
                  py::arg("depth")              = std::numeric_limits<u32>::max(),
@@ -113,8 +241,287 @@ namespace hal
                 :param set[str] terminal_gate_type:  A set of gates at which to terminate the graph cut.
                 :returns: The graph cut as a list of sets of gates.
                 :rtype: list[set[hal_py.get_gate()]]
+                )")
+            .def("get_graph_cut",
+                 py::overload_cast<IGraphHandle*, Gate*, const u32, const std::set<std::string>>(&GraphAlgorithmPlugin::get_graph_cut),
+                 py::arg("handle"),
+                 py::arg("gate"),
+                 py::arg("depth")              = std::numeric_limits<u32>::max(),
+                 py::arg("terminal_gate_type") = std::set<std::string>(),
+                 R"(
+                Get a graph cut for a specific gate and depth within the gates represented by an igraph handle. Further, a set of gates can be specified that limit the graph cut, i.e., flip-flops and memory cells.
+                The graph cut is returned as a list of sets of gates with the list's index representing the distance of each set to the starting point.
+
+                :param graph_algorithm.IGraphHandle handle: The igraph handle to operate on.
+                :param hal_py.Gate gate: The gate that is the starting point for the graph cut.
+                :param int depth: The depth of the graph cut.
+                :param set[str] terminal_gate_type:  A set of gates at which to terminate the graph cut.
+                :returns: The graph cut as a list of sets of gates.
+                :rtype: list[set[hal_py.Gate]]
                 )");
 
+        py::class_<CsrGraph> py_csr_graph(m, "CsrGraph", R"(
+            An immutable snapshot of the connectivity between the gates of a netlist in compressed sparse row (CSR) format that serves as input to the native graph kernels.
+            Each gate is represented by a vertex and there is an edge from gate A to gate B if a net driven by A has B as a destination.
+            Parallel edges are merged, global inputs and outputs are not represented.
+            Vertices are ordered by gate ID.
+            Since the snapshot is not updated when the netlist is modified, it has to be recreated after modifications.
+        )");
+
+        py_csr_graph.attr("NO_VERTEX") = CsrGraph::NO_VERTEX;
+
+        py_csr_graph.def(py::init<const Netlist*, u32>(), py::arg("netlist"), py::arg("num_threads") = 0, py::keep_alive<1, 2>(), R"(
+            Create a snapshot of the entire netlist.
+
+            :param hal_py.Netlist netlist: The netlist.
+            :param int num_threads: The number of threads to use. Defaults to ``0``, which uses as many threads as there are hardware threads.
+        )");
+
+        py_csr_graph.def(py::init<const Netlist*, const std::vector<Gate*>&, u32>(), py::arg("netlist"), py::arg("gates"), py::arg("num_threads") = 0, py::keep_alive<1, 2>(), R"(
+            Create a snapshot of a subset of the gates of the netlist.
+            Only edges between gates of the subset are represented.
+
+            :param hal_py.Netlist netlist: The netlist.
+            :param list[hal_py.Gate] gates: The gates to represent.
+            :param int num_threads: The number of threads to use. Defaults to ``0``, which uses as many threads as there are hardware threads.
+        )");
+
+        py_csr_graph.def("get_num_vertices", &CsrGraph::get_num_vertices, R"(
+            Get the number of vertices.
+
+            :returns: The number of vertices.
+            :rtype: int
+        )");
+
+        py_csr_graph.def("get_num_edges", &CsrGraph::get_num_edges, R"(
+            Get the number of edges.
+
+            :returns: The number of edges.
+            :rtype: int
+        )");
+
+        py_csr_graph.def("get_gates", &CsrGraph::get_gates, R"(
+            Get the gates represented by the snapshot ordered by their vertex index.
+
+            :returns: The gates.
+            :rtype: list[hal_py.Gate]
+        )");
+
+        py_csr_graph.def("get_gate_of_vertex", &CsrGraph::get_gate_of_vertex, py::arg("vertex"), R"(
+            Get the gate represented by a vertex.
+
+            :param int vertex: The vertex index.
+            :returns: The gate on success, ``None`` for invalid indices.
+            :rtype: hal_py.Gate or None
+        )");
+
+        py_csr_graph.def("get_vertex_of_gate", &CsrGraph::get_vertex_of_gate, py::arg("gate"), R"(
+            Get the vertex representing a gate.
+
+            :param hal_py.Gate gate: The gate.
+            :returns: The vertex index, or ``graph_algorithm.CsrGraph.NO_VERTEX`` if the gate is not represented by the snapshot.
+            :rtype: int
+        )");
+
+        py_csr_graph.def(
+            "get_successors",
+            [](const CsrGraph& self, u32 vertex) {
+                const auto& offsets = self.get_successor_offsets();
+                if (vertex >= self.get_num_vertices())
+                {
+                    return std::vector<u32>();
+                }
+                return std::vector<u32>(self.get_successors().begin() + offsets[vertex], self.get_successors().begin() + offsets[vertex + 1]);
+            },
+            py::arg("vertex"),
+            R"(
+            Get the successors of a vertex in ascending order.
+
+            :param int vertex: The vertex index.
+            :returns: The successors.
+            :rtype: list[int]
+        )");
+
+        py_csr_graph.def(
+            "get_predecessors",
+            [](const CsrGraph& self, u32 vertex) {
+                const auto& offsets = self.get_predecessor_offsets();
+                if (vertex >= self.get_num_vertices())
+                {
+                    return std::vector<u32>();
+                }
+                return std::vector<u32>(self.get_predecessors().begin() + offsets[vertex], self.get_predecessors().begin() + offsets[vertex + 1]);
+            },
+            py::arg("vertex"),
+            R"(
+            Get the predecessors of a vertex in ascending order.
+
+            :param int vertex: The vertex index.
+            :returns: The predecessors.
+            :rtype: list[int]
+        )");
+
+        auto py_graph_kernels = m.def_submodule("graph_kernels", R"(
+            Native graph kernels operating on a CSR snapshot of a netlist.
+            All kernels only read the snapshot and distribute their work across multiple threads.
+        )");
+
+        py::enum_<graph_kernels::Direction>(py_graph_kernels, "Direction", R"(
+            The direction in which edges are traversed.
+        )")
+            .value("successors", graph_kernels::Direction::successors, R"(Follow edges from driver to destination.)")
+            .value("predecessors", graph_kernels::Direction::predecessors, R"(Follow edges from destination to driver.)")
+            .value("both", graph_kernels::Direction::both, R"(Follow edges in both directions.)")
+            .export_values();
+
+        py_graph_kernels.def(
+            "get_strongly_connected_components",
+            [](const CsrGraph& graph, bool include_singletons, u32 num_threads) {
+                std::vector<std::vector<Gate*>> sccs;
+                for (const auto& scc : graph_kernels::get_strongly_connected_components(graph, include_singletons, num_threads))
+                {
+                    sccs.push_back(graph.get_gates_of_vertices(scc));
+                }
+                return sccs;
+            },
+            py::arg("graph"),
+            py::arg("include_singletons") = true,
+            py::arg("num_threads")        = 0,
+            R"(
+            Compute the strongly connected components (SCCs) of the graph.
+            Each SCC is sorted by gate ID and the SCCs are sorted by their first gate.
+
+            :param graph_algorithm.CsrGraph graph: The graph.
+            :param bool include_singletons: Set ``True`` to include SCCs consisting of a single gate without a self-loop, ``False`` otherwise.
+            :param int num_threads: The number of threads to use. Defaults to ``0``, which uses as many threads as there are hardware threads.
+            :returns: The SCCs.
+            :rtype: list[list[hal_py.Gate]]
+        )");
+
+        py_graph_kernels.def(
+            "get_distances",
+            [](const CsrGraph& graph, const std::vector<Gate*>& sources, graph_kernels::Direction direction, u32 max_depth, u32 num_threads) {
+                const std::vector<u32> distances = graph_kernels::get_distances(graph, graph.get_vertices_of_gates(sources), direction, max_depth, num_threads);
+                std::unordered_map<Gate*, u32> result;
+                for (u32 v = 0; v < distances.size(); v++)
+                {
+                    if (distances[v] != graph_kernels::UNREACHABLE)
+                    {
+                        result[graph.get_gate_of_vertex(v)] = distances[v];
+                    }
+                }
+                return result;
+            },
+            py::arg("graph"),
+            py::arg("sources"),
+            py::arg("direction"),
+            py::arg("max_depth")   = std::numeric_limits<u32>::max(),
+            py::arg("num_threads") = 0,
+            R"(
+            Compute the distance of every gate to the closest of the given source gates using a level-synchronous breadth-first search.
+
+            :param graph_algorithm.CsrGraph graph: The graph.
+            :param list[hal_py.Gate] sources: The source gates.
+            :param graph_algorithm.graph_kernels.Direction direction: The direction in which edges are traversed.
+            :param int max_depth: The maximum distance to explore. Defaults to exploring all reachable gates.
+            :param int num_threads: The number of threads to use. Defaults to ``0``, which uses as many threads as there are hardware threads.
+            :returns: A dict from each reached gate to its distance.
+            :rtype: dict[hal_py.Gate,int]
+        )");
+
+        py_graph_kernels.def(
+            "get_transitive_cones",
+            [](const CsrGraph& graph, const std::vector<Gate*>& start_gates, graph_kernels::Direction direction, const std::function<bool(const Gate*)>& stop_filter, u32 num_threads) {
+                // gates that are not represented by the graph are passed as invalid vertices and yield empty cones
+                std::vector<u32> start_vertices;
+                for (const Gate* gate : start_gates)
+                {
+                    start_vertices.push_back(graph.get_vertex_of_gate(gate));
+                }
+
+                std::vector<std::vector<Gate*>> cones;
+                for (const auto& cone : graph_kernels::get_transitive_cones(graph, start_vertices, direction, stop_filter, num_threads))
+                {
+                    cones.push_back(graph.get_gates_of_vertices(cone));
+                }
+                return cones;
+            },
+            py::arg("graph"),
+            py::arg("start_gates"),
+            py::arg("direction"),
+            py::arg("stop_filter") = nullptr,
+            py::arg("num_threads") = 0,
+            R"(
+            Compute the transitive cone of each of the given start gates, i.e., all gates that are reachable from the start gate via at least one edge.
+            The traversal does not continue beyond gates matching the stop filter, these gates are still part of the cone.
+            A start gate is only part of its own cone if it lies on a cycle.
+            Start gates that are not represented by the graph yield an empty cone, so the returned list has one entry per start gate.
+
+            :param graph_algorithm.CsrGraph graph: The graph.
+            :param list[hal_py.Gate] start_gates: The start gates.
+            :param graph_algorithm.graph_kernels.Direction direction: The direction in which edges are traversed.
+            :param lambda stop_filter: A filter matching the gates at which the traversal stops. Defaults to ``None``.
+            :param int num_threads: The number of threads to use. Defaults to ``0``, which uses as many threads as there are hardware threads.
+            :returns: The cone of each start gate sorted by gate ID.
+            :rtype: list[list[hal_py.Gate]]
+        )");
+
+        py_graph_kernels.def(
+            "get_neighborhoods",
+            [](const CsrGraph& graph, const std::vector<Gate*>& start_gates, u32 k, graph_kernels::Direction direction, u32 num_threads) {
+                // gates that are not represented by the graph are passed as invalid vertices and yield empty neighborhoods
+                std::vector<u32> start_vertices;
+                for (const Gate* gate : start_gates)
+                {
+                    start_vertices.push_back(graph.get_vertex_of_gate(gate));
+                }
+
+                std::vector<std::vector<Gate*>> neighborhoods;
+                for (const auto& neighborhood : graph_kernels::get_neighborhoods(graph, start_vertices, k, direction, num_threads))
+                {
+                    neighborhoods.push_back(graph.get_gates_of_vertices(neighborhood));
+                }
+                return neighborhoods;
+            },
+            py::arg("graph"),
+            py::arg("start_gates"),
+            py::arg("k"),
+            py::arg("direction")   = graph_kernels::Direction::both,
+            py::arg("num_threads") = 0,
+            R"(
+            Compute the k-hop neighborhood of each of the given start gates, i.e., all gates that are reachable from the start gate via at least one and at most ``k`` edges.
+            A start gate is only part of its own neighborhood if it lies on a cycle of length at most ``k``.
+            Start gates that are not represented by the graph yield an empty neighborhood, so the returned list has one entry per start gate.
+
+            :param graph_algorithm.CsrGraph graph: The graph.
+            :param list[hal_py.Gate] start_gates: The start gates.
+            :param int k: The maximum number of edges.
+            :param graph_algorithm.graph_kernels.Direction direction: The direction in which edges are traversed. Defaults to ``both``.
+            :param int num_threads: The number of threads to use. Defaults to ``0``, which uses as many threads as there are hardware threads.
+            :returns: The neighborhood of each start gate sorted by gate ID.
+            :rtype: list[list[hal_py.Gate]]
+        )");
+
+        py_graph_kernels.def(
+            "get_shortest_path",
+            [](const CsrGraph& graph, Gate* from, Gate* to, graph_kernels::Direction direction) {
+                return graph.get_gates_of_vertices(graph_kernels::get_shortest_path(graph, graph.get_vertex_of_gate(from), graph.get_vertex_of_gate(to), direction));
+            },
+            py::arg("graph"),
+            py::arg("from_gate"),
+            py::arg("to_gate"),
+            py::arg("direction") = graph_kernels::Direction::successors,
+            R"(
+            Compute a shortest path between two gates using a breadth-first search.
+
+            :param graph_algorithm.CsrGraph graph: The graph.
+            :param hal_py.Gate from_gate: The start gate.
+            :param hal_py.Gate to_gate: The end gate.
+            :param graph_algorithm.graph_kernels.Direction direction: The direction in which edges are traversed. Defaults to ``successors``.
+            :returns: The gates of the path including start and end gate, or an empty list if there is no path.
+            :rtype: list[hal_py.Gate]
+        )");
+
 #ifndef PYBIND11_MODULE
         return m.ptr();
 #endif    // PYBIND11_MODULE
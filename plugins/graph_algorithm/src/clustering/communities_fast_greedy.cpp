@@ -17,9 +17,22 @@ namespace hal
             log_error(this->get_name(), "{}", "parameter 'nl' is nullptr");
             return std::map<int, std::set<Gate*>>();
         }
-        // get igraph
+
+        IGraphHandle handle(nl);
+        return get_communities_fast_greedy(&handle);
+    }
+
+    std::map<int, std::set<Gate*>> GraphAlgorithmPlugin::get_communities_fast_greedy(IGraphHandle* handle)
+    {
+        if (handle == nullptr)
+        {
+            log_error(this->get_name(), "{}", "parameter 'handle' is nullptr");
+            return std::map<int, std::set<Gate*>>();
+        }
+
+        // copy igraph since it is converted to an undirected graph
         igraph_t graph;
-        std::map<int, Gate*> vertex_to_gate = get_igraph_directed(nl, &graph);
+        igraph_copy(&graph, handle->get_igraph());
 
         igraph_vector_t membership, modularity;
         igraph_matrix_t merges;
@@ -37,12 +50,7 @@ namespace hal
                                     &membership);
 
         // map back to HAL structures
-        std::map<int, std::set<Gate*>> community_sets;
-        for (int i = 0; i < igraph_vector_size(&membership); i++)
-        {
-            community_sets[(int)VECTOR(membership)[i]].insert(vertex_to_gate[i]);
-        }
-        //igraph_vector_destroy(&membership);
+        std::map<int, std::set<Gate*>> community_sets = handle->get_memberships(&membership);
 
         igraph_destroy(&graph);
         igraph_vector_destroy(&membership);
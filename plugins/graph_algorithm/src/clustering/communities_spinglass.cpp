@@ -20,17 +20,26 @@ namespace hal
 
         log_info("graph_algorithm", "netlist has {} gates and {} nets", nl->get_gates().size(), nl->get_nets().size());
 
-        // get igraph
-        igraph_t graph;
-        std::map<int, Gate*> vertex_to_gate = get_igraph_directed(nl, &graph);
+        IGraphHandle handle(nl);
+        return get_communities_spinglass(&handle, spins);
+    }
+
+    std::map<int, std::set<Gate*>> GraphAlgorithmPlugin::get_communities_spinglass(IGraphHandle* handle, u32 const spins)
+    {
+        if (handle == nullptr)
+        {
+            log_error(this->get_name(), "{}", "parameter 'handle' is nullptr");
+            return std::map<int, std::set<Gate*>>();
+        }
+
+        const igraph_t* graph = handle->get_igraph();
 
-        
         igraph_real_t modularity, temperature;
         igraph_vector_t membership, csize;
 
         igraph_vector_init(&membership, 0);
         igraph_vector_init(&csize, 0);
-        igraph_community_spinglass(&graph,
+        igraph_community_spinglass(graph,
                                    0, /* no weights */
                                    &modularity,
                                    &temperature,
@@ -57,9 +66,8 @@ namespace hal
         }
 
         // map back to HAL structures
-        auto community_sets = get_memberships_for_hal(&graph, membership, vertex_to_gate);
+        auto community_sets = handle->get_memberships(&membership);
 
-        igraph_destroy(&graph);
         igraph_vector_destroy(&membership);
         igraph_vector_destroy(&csize);
 
@@ -4,6 +4,7 @@
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/utilities/log.h"
 
+#include <algorithm>
 #include <igraph/igraph.h>
 
 namespace hal
@@ -120,4 +121,138 @@ namespace hal
 
         return community_sets;
     }
+
+    std::map<int, std::set<Gate*>> GraphAlgorithmPlugin::get_communities(IGraphHandle* handle)
+    {
+        if (handle == nullptr)
+        {
+            log_error(this->get_name(), "{}", "parameter 'handle' is nullptr");
+            return std::map<int, std::set<Gate*>>();
+        }
+
+        /* collect edges between gates, ignoring dummy vertices */
+        const igraph_t* directed_graph = handle->get_igraph();
+        const u32 num_gates            = handle->get_num_gate_vertices();
+        std::vector<std::vector<u32>> predecessors(num_gates), successors(num_gates);
+        for (igraph_integer_t eid = 0; eid < igraph_ecount(directed_graph); eid++)
+        {
+            igraph_integer_t from, to;
+            igraph_edge(directed_graph, eid, &from, &to);
+            if ((u32)from < num_gates && (u32)to < num_gates)
+            {
+                successors[from].push_back(to);
+                predecessors[to].push_back(from);
+            }
+        }
+
+        /* prune leaves from the graph instead of deleting them from the netlist */
+        std::vector<u32> num_predecessors(num_gates), num_successors(num_gates);
+        std::vector<u32> worklist(num_gates);
+        for (u32 v = 0; v < num_gates; v++)
+        {
+            num_predecessors[v] = predecessors[v].size();
+            num_successors[v]   = successors[v].size();
+            worklist[v]         = v;
+        }
+
+        std::vector<bool> deleted(num_gates, false);
+        auto is_leaf = [&](u32 v) {
+            u32 counter = num_predecessors[v] + num_successors[v];
+            if (counter < 2)
+            {
+                return true;
+            }
+            /* leaves connected to a single gate as successor and predecessor */
+            if ((counter == 2) && (num_predecessors[v] == 1) && (num_successors[v] == 1))
+            {
+                auto pred = std::find_if(predecessors[v].begin(), predecessors[v].end(), [&deleted](u32 p) { return !deleted[p]; });
+                auto succ = std::find_if(successors[v].begin(), successors[v].end(), [&deleted](u32 s) { return !deleted[s]; });
+                return *pred == *succ;
+            }
+            return false;
+        };
+
+        while (!worklist.empty())
+        {
+            u32 v = worklist.back();
+            worklist.pop_back();
+            if (deleted[v] || !is_leaf(v))
+            {
+                continue;
+            }
+
+            deleted[v] = true;
+            for (u32 p : predecessors[v])
+            {
+                if (!deleted[p])
+                {
+                    num_successors[p]--;
+                    worklist.push_back(p);
+                }
+            }
+            for (u32 s : successors[v])
+            {
+                if (!deleted[s])
+                {
+                    num_predecessors[s]--;
+                    worklist.push_back(s);
+                }
+            }
+        }
+
+        /* map remaining vertices to igraph IDs */
+        std::vector<u32> vertex_to_remaining(num_gates), remaining_to_vertex;
+        for (u32 v = 0; v < num_gates; v++)
+        {
+            if (!deleted[v])
+            {
+                vertex_to_remaining[v] = remaining_to_vertex.size();
+                remaining_to_vertex.push_back(v);
+            }
+        }
+
+        std::vector<igraph_real_t> edges;
+        for (u32 v : remaining_to_vertex)
+        {
+            for (u32 s : successors[v])
+            {
+                if (!deleted[s])
+                {
+                    edges.push_back(vertex_to_remaining[v]);
+                    edges.push_back(vertex_to_remaining[s]);
+                }
+            }
+        }
+
+        /* create and add edges to the graph */
+        igraph_t graph;
+        igraph_vector_t netlist_edges;
+        igraph_vector_init_copy(&netlist_edges, edges.data(), edges.size());
+        igraph_create(&graph, &netlist_edges, remaining_to_vertex.size(), IGRAPH_UNDIRECTED);
+        igraph_vector_destroy(&netlist_edges);
+
+        /* remove double edges */
+        igraph_simplify(&graph, true, false, 0);
+
+        /* Louvain method without weights */
+        igraph_vector_t membership, modularity;
+        igraph_matrix_t merges;
+        igraph_vector_init(&membership, 1);
+        igraph_vector_init(&modularity, 1);
+        igraph_matrix_init(&merges, 1, 1);
+        igraph_community_fastgreedy(&graph, nullptr, &merges, &modularity, &membership);
+        igraph_vector_destroy(&modularity);
+        igraph_matrix_destroy(&merges);
+        igraph_destroy(&graph);
+
+        /* group gates by community membership */
+        std::map<int, std::set<Gate*>> community_sets;
+        for (int i = 0; i < igraph_vector_size(&membership); i++)
+        {
+            community_sets[(int)VECTOR(membership)[i]].insert(handle->get_gate_of_vertex(remaining_to_vertex[i]));
+        }
+        igraph_vector_destroy(&membership);
+
+        return community_sets;
+    }
 }    // namespace hal
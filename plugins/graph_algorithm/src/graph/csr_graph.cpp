@@ -0,0 +1,191 @@
+#include "graph_algorithm/csr_graph.h"
+
+#include "hal_core/netlist/endpoint.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/utilities/log.h"
+#include "hal_core/utilities/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace hal
+{
+    CsrGraph::CsrGraph(const Netlist* netlist, u32 num_threads) : m_netlist(netlist)
+    {
+        m_vertex_to_gate = netlist->get_gates();
+        build(num_threads);
+    }
+
+    CsrGraph::CsrGraph(const Netlist* netlist, const std::vector<Gate*>& gates, u32 num_threads) : m_netlist(netlist)
+    {
+        m_vertex_to_gate.reserve(gates.size());
+        for (Gate* gate : gates)
+        {
+            if (gate == nullptr || gate->get_netlist() != netlist)
+            {
+                log_warning("graph_algorithm", "ignoring gate that is not part of netlist with ID {}.", netlist->get_id());
+                continue;
+            }
+            m_vertex_to_gate.push_back(gate);
+        }
+        build(num_threads);
+    }
+
+    const Netlist* CsrGraph::get_netlist() const
+    {
+        return m_netlist;
+    }
+
+    u32 CsrGraph::get_num_vertices() const
+    {
+        return m_vertex_to_gate.size();
+    }
+
+    u32 CsrGraph::get_num_edges() const
+    {
+        return m_successors.size();
+    }
+
+    const std::vector<Gate*>& CsrGraph::get_gates() const
+    {
+        return m_vertex_to_gate;
+    }
+
+    Gate* CsrGraph::get_gate_of_vertex(u32 vertex) const
+    {
+        if (vertex >= m_vertex_to_gate.size())
+        {
+            return nullptr;
+        }
+        return m_vertex_to_gate[vertex];
+    }
+
+    u32 CsrGraph::get_vertex_of_gate(const Gate* gate) const
+    {
+        if (gate == nullptr || gate->get_id() >= m_gate_to_vertex.size() || gate->get_netlist() != m_netlist)
+        {
+            return NO_VERTEX;
+        }
+        return m_gate_to_vertex[gate->get_id()];
+    }
+
+    std::vector<u32> CsrGraph::get_vertices_of_gates(const std::vector<Gate*>& gates) const
+    {
+        std::vector<u32> vertices;
+        vertices.reserve(gates.size());
+        for (const Gate* gate : gates)
+        {
+            if (const u32 vertex = get_vertex_of_gate(gate); vertex != NO_VERTEX)
+            {
+                vertices.push_back(vertex);
+            }
+        }
+        return vertices;
+    }
+
+    std::vector<Gate*> CsrGraph::get_gates_of_vertices(const std::vector<u32>& vertices) const
+    {
+        std::vector<Gate*> gates;
+        gates.reserve(vertices.size());
+        for (u32 vertex : vertices)
+        {
+            if (Gate* gate = get_gate_of_vertex(vertex); gate != nullptr)
+            {
+                gates.push_back(gate);
+            }
+        }
+        return gates;
+    }
+
+    const std::vector<u32>& CsrGraph::get_successor_offsets() const
+    {
+        return m_successor_offsets;
+    }
+
+    const std::vector<u32>& CsrGraph::get_successors() const
+    {
+        return m_successors;
+    }
+
+    const std::vector<u32>& CsrGraph::get_predecessor_offsets() const
+    {
+        return m_predecessor_offsets;
+    }
+
+    const std::vector<u32>& CsrGraph::get_predecessors() const
+    {
+        return m_predecessors;
+    }
+
+    void CsrGraph::build(u32 num_threads)
+    {
+        // assign vertex indices to gates in ascending order of their IDs
+        std::sort(m_vertex_to_gate.begin(), m_vertex_to_gate.end(), [](const Gate* a, const Gate* b) { return a->get_id() < b->get_id(); });
+        m_vertex_to_gate.erase(std::unique(m_vertex_to_gate.begin(), m_vertex_to_gate.end()), m_vertex_to_gate.end());
+
+        const u32 num_vertices = m_vertex_to_gate.size();
+        m_gate_to_vertex.assign(m_vertex_to_gate.empty() ? 0 : m_vertex_to_gate.back()->get_id() + 1, NO_VERTEX);
+        for (u32 v = 0; v < num_vertices; v++)
+        {
+            m_gate_to_vertex[m_vertex_to_gate[v]->get_id()] = v;
+        }
+
+        // collect the successors of every vertex, the netlist is only read
+        std::vector<std::vector<u32>> successors(num_vertices);
+        std::atomic<u32> next_vertex{0};
+        auto worker = [this, &successors, &next_vertex, num_vertices](u32) {
+            for (u32 v = next_vertex++; v < num_vertices; v = next_vertex++)
+            {
+                auto& list = successors[v];
+                for (const Net* net : m_vertex_to_gate[v]->get_fan_out_nets())
+                {
+                    for (const Endpoint* ep : net->get_destinations())
+                    {
+                        const u32 gate_id = ep->get_gate()->get_id();
+                        if (gate_id < m_gate_to_vertex.size() && m_gate_to_vertex[gate_id] != NO_VERTEX)
+                        {
+                            list.push_back(m_gate_to_vertex[gate_id]);
+                        }
+                    }
+                }
+                std::sort(list.begin(), list.end());
+                list.erase(std::unique(list.begin(), list.end()), list.end());
+            }
+        };
+
+        num_threads = utils::get_num_threads(num_threads, num_vertices);
+        utils::run_workers(num_threads, worker);
+
+        // compress the successor lists and transpose them, iterating the vertices in ascending order yields sorted predecessor lists
+        m_successor_offsets.assign(num_vertices + 1, 0);
+        m_predecessor_offsets.assign(num_vertices + 1, 0);
+        for (u32 v = 0; v < num_vertices; v++)
+        {
+            m_successor_offsets[v + 1] = m_successor_offsets[v] + successors[v].size();
+            for (u32 w : successors[v])
+            {
+                m_predecessor_offsets[w + 1]++;
+            }
+        }
+        for (u32 v = 0; v < num_vertices; v++)
+        {
+            m_predecessor_offsets[v + 1] += m_predecessor_offsets[v];
+        }
+
+        m_successors.resize(m_successor_offsets[num_vertices]);
+        m_predecessors.resize(m_predecessor_offsets[num_vertices]);
+        std::vector<u32> fill(m_predecessor_offsets.begin(), m_predecessor_offsets.end() - 1);
+        for (u32 v = 0; v < num_vertices; v++)
+        {
+            std::copy(successors[v].begin(), successors[v].end(), m_successors.begin() + m_successor_offsets[v]);
+            for (u32 w : successors[v])
+            {
+                m_predecessors[fill[w]++] = v;
+            }
+        }
+
+        log_debug("graph_algorithm", "created CSR graph with {} vertices and {} edges using {} threads.", num_vertices, m_successors.size(), num_threads);
+    }
+}    // namespace hal
@@ -55,4 +55,69 @@ namespace hal
         }
         return result;
     }
+
+    std::vector<std::set<Gate*>> GraphAlgorithmPlugin::get_graph_cut(IGraphHandle* handle, Gate* current_gate, const u32 depth, const std::set<std::string> terminal_gate_type)
+    {
+        if (handle == nullptr)
+        {
+            log_error(this->get_name(), "parameter 'handle' is nullptr.");
+            return std::vector<std::set<Gate*>>();
+        }
+        if (current_gate == nullptr)
+        {
+            log_error(this->get_name(), "parameter 'gate' is nullptr.");
+            return std::vector<std::set<Gate*>>();
+        }
+        if (depth == std::numeric_limits<u32>::max() && terminal_gate_type.empty())
+        {
+            log_error(this->get_name(), "parameter 'depth' is 0 and no terminal gate type defined.");
+            return std::vector<std::set<Gate*>>();
+        }
+        if (handle->get_vertex_of_gate(current_gate) == IGraphHandle::NO_VERTEX)
+        {
+            log_error(this->get_name(), "gate '{}' with ID {} is not represented by the igraph handle.", current_gate->get_name(), current_gate->get_id());
+            return std::vector<std::set<Gate*>>();
+        }
+
+        std::vector<std::set<Gate*>> result;
+        result.push_back({current_gate});
+
+        if (depth == 1)
+        {
+            return result;
+        }
+
+        const igraph_t* graph = handle->get_igraph();
+        igraph_vector_t neighbors;
+        igraph_vector_init(&neighbors, 0);
+
+        for (u32 i = 1; i < depth; i++)
+        {
+            std::set<Gate*> previous_state = result.back(), next_state = std::set<Gate*>();
+            for (const auto& it : previous_state)
+            {
+                igraph_neighbors(graph, &neighbors, handle->get_vertex_of_gate(it), IGRAPH_IN);
+                for (long int j = 0; j < igraph_vector_size(&neighbors); j++)
+                {
+                    // dummy vertices do not represent a gate
+                    Gate* predecessor = handle->get_gate_of_vertex((u32)VECTOR(neighbors)[j]);
+                    if (predecessor != nullptr && terminal_gate_type.find(predecessor->get_type()->get_name()) == terminal_gate_type.end())
+                    {
+                        next_state.insert(predecessor);
+                    }
+                }
+            }
+            if (next_state.empty())
+            {
+                break;
+            }
+            else
+            {
+                result.push_back(next_state);
+            }
+        }
+
+        igraph_vector_destroy(&neighbors);
+        return result;
+    }
 }    // namespace hal
@@ -0,0 +1,491 @@
+#include "graph_algorithm/graph_kernels.h"
+
+#include "hal_core/netlist/gate.h"
+#include "hal_core/utilities/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+namespace hal
+{
+    namespace graph_kernels
+    {
+        namespace
+        {
+            // frontiers smaller than this are expanded by a single thread
+            constexpr u32 MIN_PARALLEL_FRONTIER = 4096;
+
+            // number of vertices processed per work item when expanding a frontier bitset
+            constexpr u32 WORDS_PER_CHUNK = 16;
+
+            template<typename F>
+            void for_each_neighbor(const CsrGraph& graph, u32 v, Direction direction, const F& func)
+            {
+                if (direction != Direction::predecessors)
+                {
+                    const auto& offsets = graph.get_successor_offsets();
+                    const auto& targets = graph.get_successors();
+                    for (u32 i = offsets[v]; i < offsets[v + 1]; i++)
+                    {
+                        func(targets[i]);
+                    }
+                }
+                if (direction != Direction::successors)
+                {
+                    const auto& offsets = graph.get_predecessor_offsets();
+                    const auto& targets = graph.get_predecessors();
+                    for (u32 i = offsets[v]; i < offsets[v + 1]; i++)
+                    {
+                        func(targets[i]);
+                    }
+                }
+            }
+
+            // bit-parallel breadth-first search computing the reachable vertices of up to 64 start vertices at once
+            class BatchSearch
+            {
+            public:
+                explicit BatchSearch(u32 num_vertices) : m_reached(num_vertices, 0), m_frontier(num_vertices, 0), m_next(num_vertices, 0)
+                {
+                }
+
+                void run(const CsrGraph& graph,
+                         const std::vector<u32>& start_vertices,
+                         u32 first,
+                         u32 last,
+                         Direction direction,
+                         const std::vector<bool>& stop,
+                         u32 max_depth,
+                         std::vector<std::vector<u32>>& results)
+                {
+                    // start vertices are always expanded, even if they are stop vertices
+                    std::vector<u32> active;
+                    for (u32 i = first; i < last; i++)
+                    {
+                        const u32 v = start_vertices[i];
+                        if (v >= m_frontier.size())
+                        {
+                            continue;
+                        }
+                        if (m_frontier[v] == 0)
+                        {
+                            active.push_back(v);
+                        }
+                        m_frontier[v] |= u64(1) << (i - first);
+                    }
+
+                    std::vector<u32> next_active;
+                    for (u32 depth = 0; depth < max_depth && !active.empty(); depth++)
+                    {
+                        for (u32 v : active)
+                        {
+                            const u64 mask = m_frontier[v];
+                            m_frontier[v]  = 0;
+                            if (depth > 0 && !stop.empty() && stop[v])
+                            {
+                                continue;
+                            }
+
+                            for_each_neighbor(graph, v, direction, [this, mask, &next_active](u32 w) {
+                                const u64 new_bits = mask & ~m_reached[w] & ~m_next[w];
+                                if (new_bits != 0)
+                                {
+                                    if (m_next[w] == 0)
+                                    {
+                                        next_active.push_back(w);
+                                    }
+                                    m_next[w] |= new_bits;
+                                }
+                            });
+                        }
+
+                        for (u32 w : next_active)
+                        {
+                            if (m_reached[w] == 0)
+                            {
+                                m_touched.push_back(w);
+                            }
+                            m_reached[w] |= m_next[w];
+                            m_frontier[w] = m_next[w];
+                            m_next[w]     = 0;
+                        }
+                        std::swap(active, next_active);
+                        next_active.clear();
+                    }
+
+                    for (u32 v : active)
+                    {
+                        m_frontier[v] = 0;
+                    }
+
+                    // collect the results and reset the state for the next batch
+                    std::sort(m_touched.begin(), m_touched.end());
+                    for (u32 v : m_touched)
+                    {
+                        for (u64 bits = m_reached[v]; bits != 0; bits &= bits - 1)
+                        {
+                            results[first + __builtin_ctzll(bits)].push_back(v);
+                        }
+                        m_reached[v] = 0;
+                    }
+                    m_touched.clear();
+                }
+
+            private:
+                std::vector<u64> m_reached;
+                std::vector<u64> m_frontier;
+                std::vector<u64> m_next;
+                std::vector<u32> m_touched;
+            };
+
+            std::vector<std::vector<u32>> get_batched_reachable_vertices(const CsrGraph& graph,
+                                                                         const std::vector<u32>& start_vertices,
+                                                                         Direction direction,
+                                                                         const std::vector<bool>& stop,
+                                                                         u32 max_depth,
+                                                                         u32 num_threads)
+            {
+                const u32 num_vertices = graph.get_num_vertices();
+                std::vector<std::vector<u32>> results(start_vertices.size());
+                const u32 num_batches = (start_vertices.size() + 63) / 64;
+                std::atomic<u32> next_batch{0};
+                auto worker = [&graph, &start_vertices, direction, &stop, max_depth, &results, &next_batch, num_batches, num_vertices](u32) {
+                    std::unique_ptr<BatchSearch> search;
+                    for (u32 b = next_batch++; b < num_batches; b = next_batch++)
+                    {
+                        if (search == nullptr)
+                        {
+                            search = std::make_unique<BatchSearch>(num_vertices);
+                        }
+                        search->run(graph, start_vertices, b * 64, std::min<u32>((b + 1) * 64, start_vertices.size()), direction, stop, max_depth, results);
+                    }
+                };
+                utils::run_workers(utils::get_num_threads(num_threads, num_batches), worker);
+
+                return results;
+            }
+        }    // namespace
+
+        std::vector<std::vector<u32>> get_strongly_connected_components(const CsrGraph& graph, bool include_singletons, u32 num_threads)
+        {
+            const u32 num_vertices = graph.get_num_vertices();
+            const auto& succ_offsets = graph.get_successor_offsets();
+            const auto& succs        = graph.get_successors();
+            const auto& pred_offsets = graph.get_predecessor_offsets();
+            const auto& preds        = graph.get_predecessors();
+
+            std::vector<std::vector<u32>> sccs;
+
+            // trim vertices without predecessors or successors, they are singleton SCCs and their removal may expose further such vertices
+            std::vector<u32> in_degree(num_vertices);
+            std::vector<u32> out_degree(num_vertices);
+            std::vector<bool> trimmed(num_vertices, false);
+            std::vector<u32> queue;
+            for (u32 v = 0; v < num_vertices; v++)
+            {
+                in_degree[v]  = pred_offsets[v + 1] - pred_offsets[v];
+                out_degree[v] = succ_offsets[v + 1] - succ_offsets[v];
+                if (in_degree[v] == 0 || out_degree[v] == 0)
+                {
+                    trimmed[v] = true;
+                    queue.push_back(v);
+                }
+            }
+            for (u32 i = 0; i < queue.size(); i++)
+            {
+                const u32 v = queue[i];
+                for (u32 j = succ_offsets[v]; j < succ_offsets[v + 1]; j++)
+                {
+                    if (const u32 w = succs[j]; !trimmed[w] && --in_degree[w] == 0)
+                    {
+                        trimmed[w] = true;
+                        queue.push_back(w);
+                    }
+                }
+                for (u32 j = pred_offsets[v]; j < pred_offsets[v + 1]; j++)
+                {
+                    if (const u32 w = preds[j]; !trimmed[w] && --out_degree[w] == 0)
+                    {
+                        trimmed[w] = true;
+                        queue.push_back(w);
+                    }
+                }
+            }
+            if (include_singletons)
+            {
+                for (u32 v : queue)
+                {
+                    sccs.push_back({v});
+                }
+            }
+
+            // forward-backward decomposition: the vertices reachable from and reaching a pivot form its SCC, the remaining three partitions are decomposed independently
+            std::vector<std::atomic<u32>> partition(num_vertices);
+            std::vector<u32> initial;
+            for (u32 v = 0; v < num_vertices; v++)
+            {
+                partition[v].store(trimmed[v] ? CsrGraph::NO_VERTEX : 0, std::memory_order_relaxed);
+                if (!trimmed[v])
+                {
+                    initial.push_back(v);
+                }
+            }
+
+            std::vector<std::vector<u32>> tasks;
+            if (!initial.empty())
+            {
+                tasks.push_back(std::move(initial));
+            }
+            std::atomic<u32> next_partition{1};
+            std::mutex mutex;
+            std::condition_variable cv;
+            u32 num_busy = 0;
+
+            auto decompose = [&](const std::vector<u32>& vertices, std::vector<std::vector<u32>>& new_tasks, std::vector<std::vector<u32>>& found) {
+                const u32 id     = partition[vertices.front()].load(std::memory_order_relaxed);
+                const u32 fw_id  = next_partition++;
+                const u32 bw_id  = next_partition++;
+                const u32 scc_id = next_partition++;
+                const u32 pivot  = vertices.front();
+
+                std::vector<u32> stack = {pivot};
+                partition[pivot].store(fw_id, std::memory_order_relaxed);
+                while (!stack.empty())
+                {
+                    const u32 v = stack.back();
+                    stack.pop_back();
+                    for (u32 j = succ_offsets[v]; j < succ_offsets[v + 1]; j++)
+                    {
+                        if (const u32 w = succs[j]; partition[w].load(std::memory_order_relaxed) == id)
+                        {
+                            partition[w].store(fw_id, std::memory_order_relaxed);
+                            stack.push_back(w);
+                        }
+                    }
+                }
+
+                std::vector<u32> scc = {pivot};
+                stack                = {pivot};
+                partition[pivot].store(scc_id, std::memory_order_relaxed);
+                while (!stack.empty())
+                {
+                    const u32 v = stack.back();
+                    stack.pop_back();
+                    for (u32 j = pred_offsets[v]; j < pred_offsets[v + 1]; j++)
+                    {
+                        const u32 w   = preds[j];
+                        const u32 p_w = partition[w].load(std::memory_order_relaxed);
+                        if (p_w == fw_id)
+                        {
+                            partition[w].store(scc_id, std::memory_order_relaxed);
+                            scc.push_back(w);
+                            stack.push_back(w);
+                        }
+                        else if (p_w == id)
+                        {
+                            partition[w].store(bw_id, std::memory_order_relaxed);
+                            stack.push_back(w);
+                        }
+                    }
+                }
+
+                // vertices of a singleton SCC that survived trimming may still lack a self-loop
+                if (scc.size() > 1 || include_singletons || std::binary_search(succs.begin() + succ_offsets[pivot], succs.begin() + succ_offsets[pivot + 1], pivot))
+                {
+                    std::sort(scc.begin(), scc.end());
+                    found.push_back(std::move(scc));
+                }
+
+                std::vector<u32> parts[3];
+                for (u32 v : vertices)
+                {
+                    const u32 p_v = partition[v].load(std::memory_order_relaxed);
+                    if (p_v == id)
+                    {
+                        parts[0].push_back(v);
+                    }
+                    else if (p_v == fw_id)
+                    {
+                        parts[1].push_back(v);
+                    }
+                    else if (p_v == bw_id)
+                    {
+                        parts[2].push_back(v);
+                    }
+                }
+                for (auto& part : parts)
+                {
+                    if (!part.empty())
+                    {
+                        new_tasks.push_back(std::move(part));
+                    }
+                }
+            };
+
+            auto worker = [&](u32) {
+                std::vector<std::vector<u32>> new_tasks;
+                std::vector<std::vector<u32>> found;
+                std::unique_lock<std::mutex> lock(mutex);
+                while (true)
+                {
+                    cv.wait(lock, [&tasks, &num_busy]() { return !tasks.empty() || num_busy == 0; });
+                    if (tasks.empty())
+                    {
+                        break;
+                    }
+
+                    std::vector<u32> task = std::move(tasks.back());
+                    tasks.pop_back();
+                    num_busy++;
+                    lock.unlock();
+
+                    decompose(task, new_tasks, found);
+
+                    lock.lock();
+                    num_busy--;
+                    for (auto& new_task : new_tasks)
+                    {
+                        tasks.push_back(std::move(new_task));
+                    }
+                    new_tasks.clear();
+                    cv.notify_all();
+                }
+                for (auto& scc : found)
+                {
+                    sccs.push_back(std::move(scc));
+                }
+            };
+            utils::run_workers(utils::get_num_threads(num_threads, num_vertices - queue.size()), worker);
+
+            std::sort(sccs.begin(), sccs.end(), [](const std::vector<u32>& a, const std::vector<u32>& b) { return a.front() < b.front(); });
+            return sccs;
+        }
+
+        std::vector<u32> get_distances(const CsrGraph& graph, const std::vector<u32>& sources, Direction direction, u32 max_depth, u32 num_threads)
+        {
+            const u32 num_vertices = graph.get_num_vertices();
+            const u32 num_words    = (num_vertices + 63) / 64;
+            const u32 num_chunks   = (num_words + WORDS_PER_CHUNK - 1) / WORDS_PER_CHUNK;
+
+            std::vector<u32> distances(num_vertices, UNREACHABLE);
+            std::vector<std::atomic<u64>> visited(num_words);
+            std::vector<std::atomic<u64>> frontier(num_words);
+            std::vector<std::atomic<u64>> next(num_words);
+            for (u32 w = 0; w < num_words; w++)
+            {
+                visited[w].store(0, std::memory_order_relaxed);
+                frontier[w].store(0, std::memory_order_relaxed);
+                next[w].store(0, std::memory_order_relaxed);
+            }
+
+            u32 frontier_size = 0;
+            for (u32 v : sources)
+            {
+                if (v < num_vertices && distances[v] == UNREACHABLE)
+                {
+                    distances[v] = 0;
+                    visited[v / 64].fetch_or(u64(1) << (v % 64), std::memory_order_relaxed);
+                    frontier[v / 64].fetch_or(u64(1) << (v % 64), std::memory_order_relaxed);
+                    frontier_size++;
+                }
+            }
+
+            // level-synchronous expansion, every vertex is claimed by exactly one thread through its visited bit
+            for (u32 depth = 0; depth < max_depth && frontier_size > 0; depth++)
+            {
+                std::atomic<u32> next_chunk{0};
+                std::atomic<u32> next_size{0};
+                auto worker = [&graph, direction, depth, num_words, num_chunks, &distances, &visited, &frontier, &next, &next_chunk, &next_size](u32) {
+                    u32 local_size = 0;
+                    for (u32 c = next_chunk++; c < num_chunks; c = next_chunk++)
+                    {
+                        for (u32 w = c * WORDS_PER_CHUNK; w < std::min(num_words, (c + 1) * WORDS_PER_CHUNK); w++)
+                        {
+                            for (u64 bits = frontier[w].exchange(0, std::memory_order_relaxed); bits != 0; bits &= bits - 1)
+                            {
+                                for_each_neighbor(graph, w * 64 + __builtin_ctzll(bits), direction, [&](u32 n) {
+                                    const u64 bit = u64(1) << (n % 64);
+                                    if ((visited[n / 64].load(std::memory_order_relaxed) & bit) == 0 && (visited[n / 64].fetch_or(bit, std::memory_order_relaxed) & bit) == 0)
+                                    {
+                                        distances[n] = depth + 1;
+                                        next[n / 64].fetch_or(bit, std::memory_order_relaxed);
+                                        local_size++;
+                                    }
+                                });
+                            }
+                        }
+                    }
+                    next_size += local_size;
+                };
+                utils::run_workers(frontier_size < MIN_PARALLEL_FRONTIER ? 1 : utils::get_num_threads(num_threads, num_chunks), worker);
+
+                std::swap(frontier, next);
+                frontier_size = next_size;
+            }
+
+            return distances;
+        }
+
+        std::vector<std::vector<u32>>
+            get_transitive_cones(const CsrGraph& graph, const std::vector<u32>& start_vertices, Direction direction, const std::function<bool(const Gate*)>& stop_filter, u32 num_threads)
+        {
+            // the filter is evaluated up front since it is not necessarily thread-safe
+            std::vector<bool> stop;
+            if (stop_filter)
+            {
+                stop.resize(graph.get_num_vertices());
+                for (u32 v = 0; v < graph.get_num_vertices(); v++)
+                {
+                    stop[v] = stop_filter(graph.get_gate_of_vertex(v));
+                }
+            }
+
+            return get_batched_reachable_vertices(graph, start_vertices, direction, stop, std::numeric_limits<u32>::max(), num_threads);
+        }
+
+        std::vector<std::vector<u32>> get_neighborhoods(const CsrGraph& graph, const std::vector<u32>& start_vertices, u32 k, Direction direction, u32 num_threads)
+        {
+            return get_batched_reachable_vertices(graph, start_vertices, direction, {}, k, num_threads);
+        }
+
+        std::vector<u32> get_shortest_path(const CsrGraph& graph, u32 from, u32 to, Direction direction)
+        {
+            const u32 num_vertices = graph.get_num_vertices();
+            if (from >= num_vertices || to >= num_vertices)
+            {
+                return {};
+            }
+
+            std::vector<u32> parents(num_vertices, CsrGraph::NO_VERTEX);
+            std::vector<u32> queue = {from};
+            parents[from]          = from;
+            for (u32 i = 0; i < queue.size() && parents[to] == CsrGraph::NO_VERTEX; i++)
+            {
+                const u32 v = queue[i];
+                for_each_neighbor(graph, v, direction, [v, &parents, &queue](u32 w) {
+                    if (parents[w] == CsrGraph::NO_VERTEX)
+                    {
+                        parents[w] = v;
+                        queue.push_back(w);
+                    }
+                });
+            }
+
+            if (parents[to] == CsrGraph::NO_VERTEX)
+            {
+                return {};
+            }
+
+            std::vector<u32> path = {to};
+            for (u32 v = to; v != from; v = parents[v])
+            {
+                path.push_back(parents[v]);
+            }
+            std::reverse(path.begin(), path.end());
+            return path;
+        }
+    }    // namespace graph_kernels
+}    // namespace hal
@@ -18,9 +18,17 @@ namespace hal
             return std::vector<std::vector<Gate*>>();
         }
 
-        // get igraph
-        igraph_t graph;
-        std::map<int, Gate*> vertex_to_gate = get_igraph_directed(nl, &graph);
+        IGraphHandle handle(nl);
+        return get_strongly_connected_components(&handle);
+    }
+
+    std::vector<std::vector<Gate*>> GraphAlgorithmPlugin::get_strongly_connected_components(IGraphHandle* handle)
+    {
+        if (handle == nullptr)
+        {
+            log_error(this->get_name(), "{}", "parameter 'handle' is nullptr");
+            return std::vector<std::vector<Gate*>>();
+        }
 
         igraph_vector_t membership, csize;
         igraph_integer_t number_of_clusters;
@@ -28,10 +36,10 @@ namespace hal
         igraph_vector_init(&csize, 0);
 
         // run scc
-        igraph_clusters(&graph, &membership, &csize, &number_of_clusters, IGRAPH_STRONG);
+        igraph_clusters(handle->get_igraph(), &membership, &csize, &number_of_clusters, IGRAPH_STRONG);
 
         // map back to HAL structures
-        std::map<int, std::set<Gate*>> ssc_membership = get_memberships_for_hal(&graph, membership, vertex_to_gate);
+        std::map<int, std::set<Gate*>> ssc_membership = handle->get_memberships(&membership);
 
         // convert to set
         std::vector<std::vector<Gate*>> sccs;
@@ -46,7 +54,6 @@ namespace hal
         }
 
         // cleanup
-        igraph_destroy(&graph);
         igraph_vector_destroy(&membership);
         igraph_vector_destroy(&csize);
 
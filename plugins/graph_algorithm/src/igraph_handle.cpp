@@ -0,0 +1,406 @@
+#include "graph_algorithm/igraph_handle.h"
+
+#include "hal_core/netlist/endpoint.h"
+#include "hal_core/netlist/event_system/event_handler.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/utilities/log.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace hal
+{
+    IGraphHandle::IGraphHandle(Netlist* netlist) : m_netlist(netlist), m_is_subgraph(false)
+    {
+        register_callbacks();
+    }
+
+    IGraphHandle::IGraphHandle(Netlist* netlist, const std::vector<Gate*>& gates) : m_netlist(netlist), m_is_subgraph(true)
+    {
+        for (const Gate* gate : gates)
+        {
+            if (gate == nullptr || gate->get_netlist() != netlist)
+            {
+                log_warning("graph_algorithm", "ignoring gate that is not part of netlist with ID {}.", netlist->get_id());
+                continue;
+            }
+
+            const u32 id = gate->get_id();
+            if (id >= m_gate_selected.size())
+            {
+                m_gate_selected.resize(id + 1, false);
+            }
+            m_gate_selected[id] = true;
+        }
+
+        register_callbacks();
+    }
+
+    IGraphHandle::~IGraphHandle()
+    {
+        m_netlist->get_event_handler()->unregister_callback(m_callback_name);
+        if (m_graph_initialized)
+        {
+            igraph_destroy(&m_graph);
+        }
+    }
+
+    Netlist* IGraphHandle::get_netlist() const
+    {
+        return m_netlist;
+    }
+
+    bool IGraphHandle::is_subgraph() const
+    {
+        return m_is_subgraph;
+    }
+
+    bool IGraphHandle::is_up_to_date() const
+    {
+        return !m_graph_dirty;
+    }
+
+    void IGraphHandle::invalidate()
+    {
+        m_nets_invalid   = true;
+        m_vertices_dirty = true;
+        m_graph_dirty    = true;
+    }
+
+    const igraph_t* IGraphHandle::get_igraph()
+    {
+        update();
+        return &m_graph;
+    }
+
+    u32 IGraphHandle::get_num_vertices()
+    {
+        update();
+        return (u32)igraph_vcount(&m_graph);
+    }
+
+    u32 IGraphHandle::get_num_gate_vertices()
+    {
+        update();
+        return m_vertex_to_gate.size();
+    }
+
+    const std::vector<Gate*>& IGraphHandle::get_gates()
+    {
+        update();
+        return m_vertex_to_gate;
+    }
+
+    Gate* IGraphHandle::get_gate_of_vertex(u32 vertex)
+    {
+        update();
+        if (vertex >= m_vertex_to_gate.size())
+        {
+            return nullptr;
+        }
+        return m_vertex_to_gate[vertex];
+    }
+
+    u32 IGraphHandle::get_vertex_of_gate(const Gate* gate)
+    {
+        update();
+        if (gate == nullptr || gate->get_id() >= m_gate_to_vertex.size())
+        {
+            return NO_VERTEX;
+        }
+        return m_gate_to_vertex[gate->get_id()];
+    }
+
+    std::map<int, std::set<Gate*>> IGraphHandle::get_memberships(const igraph_vector_t* membership)
+    {
+        update();
+
+        std::map<int, std::set<Gate*>> community_sets;
+        const u32 num_vertices = std::min((u32)igraph_vector_size(membership), (u32)m_vertex_to_gate.size());
+        for (u32 i = 0; i < num_vertices; i++)
+        {
+            community_sets[(int)VECTOR(*membership)[i]].insert(m_vertex_to_gate[i]);
+        }
+        return community_sets;
+    }
+
+    bool IGraphHandle::is_selected(u32 gate_id) const
+    {
+        return !m_is_subgraph || (gate_id < m_gate_selected.size() && m_gate_selected[gate_id]);
+    }
+
+    void IGraphHandle::mark_net_dirty(u32 net_id)
+    {
+        m_graph_dirty = true;
+        if (m_nets_invalid)
+        {
+            return;
+        }
+
+        if (net_id >= m_net_dirty.size())
+        {
+            m_net_dirty.resize(net_id + 1, false);
+        }
+        if (!m_net_dirty[net_id])
+        {
+            m_net_dirty[net_id] = true;
+            m_dirty_nets.push_back(net_id);
+        }
+    }
+
+    void IGraphHandle::convert_net(const Net* net)
+    {
+        const u32 net_id = net->get_id();
+        if (net_id >= m_net_edges.size())
+        {
+            m_net_edges.resize(net_id + 1);
+        }
+
+        auto& edges = m_net_edges[net_id];
+        edges.clear();
+
+        std::vector<u32> src_ids;
+        for (const Endpoint* ep : net->get_sources())
+        {
+            if (const u32 gate_id = ep->get_gate()->get_id(); is_selected(gate_id))
+            {
+                src_ids.push_back(gate_id);
+            }
+        }
+
+        std::vector<u32> dst_ids;
+        for (const Endpoint* ep : net->get_destinations())
+        {
+            if (const u32 gate_id = ep->get_gate()->get_id(); is_selected(gate_id))
+            {
+                dst_ids.push_back(gate_id);
+            }
+        }
+
+        // nets without a source or without a destination get a dummy vertex as their missing endpoint
+        if (src_ids.empty() && dst_ids.empty())
+        {
+            return;
+        }
+        else if (src_ids.empty())
+        {
+            src_ids.push_back(DUMMY_ENDPOINT);
+        }
+        else if (dst_ids.empty())
+        {
+            dst_ids.push_back(DUMMY_ENDPOINT);
+        }
+
+        edges.reserve(src_ids.size() * dst_ids.size());
+        for (u32 src_id : src_ids)
+        {
+            for (u32 dst_id : dst_ids)
+            {
+                edges.emplace_back(src_id, dst_id);
+            }
+        }
+    }
+
+    void IGraphHandle::update()
+    {
+        if (!m_graph_dirty)
+        {
+            return;
+        }
+
+        // convert all nets or only the nets modified since the last update
+        if (m_nets_invalid)
+        {
+            m_net_edges.clear();
+            m_net_dirty.clear();
+            if (m_is_subgraph)
+            {
+                std::vector<bool> visited;
+                for (u32 gate_id = 0; gate_id < m_gate_selected.size(); gate_id++)
+                {
+                    const Gate* gate = m_gate_selected[gate_id] ? m_netlist->get_gate_by_id(gate_id) : nullptr;
+                    if (gate == nullptr)
+                    {
+                        continue;
+                    }
+
+                    for (const auto& nets : {gate->get_fan_in_nets(), gate->get_fan_out_nets()})
+                    {
+                        for (const Net* net : nets)
+                        {
+                            if (net->get_id() >= visited.size())
+                            {
+                                visited.resize(net->get_id() + 1, false);
+                            }
+                            if (!visited[net->get_id()])
+                            {
+                                visited[net->get_id()] = true;
+                                convert_net(net);
+                            }
+                        }
+                    }
+                }
+            }
+            else
+            {
+                for (const Net* net : m_netlist->get_nets())
+                {
+                    convert_net(net);
+                }
+            }
+            m_nets_invalid = false;
+        }
+        else
+        {
+            for (u32 net_id : m_dirty_nets)
+            {
+                m_net_dirty[net_id] = false;
+                if (const Net* net = m_netlist->get_net_by_id(net_id); net != nullptr)
+                {
+                    convert_net(net);
+                }
+                else if (net_id < m_net_edges.size())
+                {
+                    m_net_edges[net_id].clear();
+                }
+            }
+        }
+        m_dirty_nets.clear();
+
+        // assign vertex indices to gates in ascending order of their IDs
+        if (m_vertices_dirty)
+        {
+            m_vertex_to_gate.clear();
+            if (m_is_subgraph)
+            {
+                for (u32 gate_id = 0; gate_id < m_gate_selected.size(); gate_id++)
+                {
+                    if (!m_gate_selected[gate_id])
+                    {
+                        continue;
+                    }
+
+                    if (Gate* gate = m_netlist->get_gate_by_id(gate_id); gate != nullptr)
+                    {
+                        m_vertex_to_gate.push_back(gate);
+                    }
+                }
+            }
+            else
+            {
+                m_vertex_to_gate = m_netlist->get_gates();
+                std::sort(m_vertex_to_gate.begin(), m_vertex_to_gate.end(), [](const Gate* a, const Gate* b) { return a->get_id() < b->get_id(); });
+            }
+
+            m_gate_to_vertex.assign(m_vertex_to_gate.empty() ? 0 : m_vertex_to_gate.back()->get_id() + 1, NO_VERTEX);
+            for (u32 i = 0; i < m_vertex_to_gate.size(); i++)
+            {
+                m_gate_to_vertex[m_vertex_to_gate[i]->get_id()] = i;
+            }
+            m_vertices_dirty = false;
+        }
+
+        // assemble the edges of all nets in ascending order of their IDs, dummy vertices follow the gate vertices
+        u32 num_vertices = m_vertex_to_gate.size();
+        std::vector<igraph_real_t> edge_vertices;
+        for (const auto& edges : m_net_edges)
+        {
+            u32 dummy_vertex = NO_VERTEX;
+            for (const auto& [src_id, dst_id] : edges)
+            {
+                u32 vertices[2];
+                const u32 gate_ids[2] = {src_id, dst_id};
+                for (u32 i = 0; i < 2; i++)
+                {
+                    if (gate_ids[i] == DUMMY_ENDPOINT)
+                    {
+                        if (dummy_vertex == NO_VERTEX)
+                        {
+                            dummy_vertex = num_vertices++;
+                        }
+                        vertices[i] = dummy_vertex;
+                    }
+                    else
+                    {
+                        vertices[i] = gate_ids[i] < m_gate_to_vertex.size() ? m_gate_to_vertex[gate_ids[i]] : NO_VERTEX;
+                    }
+                }
+
+                if (vertices[0] == NO_VERTEX || vertices[1] == NO_VERTEX)
+                {
+                    continue;
+                }
+                edge_vertices.push_back(vertices[0]);
+                edge_vertices.push_back(vertices[1]);
+            }
+        }
+
+        log_debug("graph_algorithm", "converted {} gates and {} edges to igraph with {} vertices.", m_vertex_to_gate.size(), edge_vertices.size() / 2, num_vertices);
+
+        if (m_graph_initialized)
+        {
+            igraph_destroy(&m_graph);
+        }
+        if (edge_vertices.empty())
+        {
+            igraph_empty(&m_graph, num_vertices, IGRAPH_DIRECTED);
+        }
+        else
+        {
+            igraph_vector_t edges;
+            igraph_vector_view(&edges, edge_vertices.data(), edge_vertices.size());
+            igraph_create(&m_graph, &edges, num_vertices, IGRAPH_DIRECTED);
+        }
+        m_graph_initialized = true;
+        m_graph_dirty       = false;
+    }
+
+    void IGraphHandle::register_callbacks()
+    {
+        static std::atomic<u32> next_handle_id = 0;
+        m_callback_name                        = "graph_algorithm_igraph_handle_" + std::to_string(next_handle_id++);
+
+        std::function<void(GateEvent::event, Gate*, u32)> gate_callback = [this](GateEvent::event e, Gate* gate, u32) {
+            if ((e == GateEvent::event::created && !m_is_subgraph) || (e == GateEvent::event::removed && is_selected(gate->get_id())))
+            {
+                // IDs of removed gates may be reused by new gates that are not part of the subgraph
+                if (m_is_subgraph)
+                {
+                    m_gate_selected[gate->get_id()] = false;
+                }
+                m_vertices_dirty = true;
+                m_graph_dirty    = true;
+            }
+        };
+
+        std::function<void(NetEvent::event, Net*, u32)> net_callback = [this](NetEvent::event e, Net* net, u32 associated_data) {
+            const u32 net_id = net->get_id();
+            switch (e)
+            {
+                case NetEvent::event::src_added:
+                case NetEvent::event::src_removed:
+                case NetEvent::event::dst_added:
+                case NetEvent::event::dst_removed:
+                    if (is_selected(associated_data))
+                    {
+                        mark_net_dirty(net_id);
+                    }
+                    break;
+                case NetEvent::event::removed:
+                    if (net_id < m_net_edges.size() && !m_net_edges[net_id].empty())
+                    {
+                        mark_net_dirty(net_id);
+                    }
+                    break;
+                default:
+                    break;
+            }
+        };
+
+        // batched events are replayed to these callbacks once the batch is delivered
+        m_netlist->get_event_handler()->register_callback(m_callback_name, gate_callback);
+        m_netlist->get_event_handler()->register_callback(m_callback_name, net_callback);
+    }
+}    // namespace hal
@@ -0,0 +1,360 @@
+#include "graph_algorithm/csr_graph.h"
+#include "graph_algorithm/graph_kernels.h"
+#include "graph_algorithm/igraph_handle.h"
+#include "graph_algorithm/plugin_graph_algorithm.h"
+#include "hal_core/netlist/event_system/event_handler.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_utils.h"
+
+#include "netlist_test_utils.h"
+
+#include <random>
+
+namespace hal
+{
+    using test_utils::MIN_GATE_ID;
+    using test_utils::MIN_NET_ID;
+
+    class GraphAlgorithmTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp()
+        {
+            NO_COUT_BLOCK;
+            test_utils::init_log_channels();
+        }
+
+        virtual void TearDown()
+        {
+        }
+
+        // edges of the igraph as pairs of gate IDs, dummy vertices are denoted by 0
+        static std::multiset<std::pair<u32, u32>> get_edges(IGraphHandle& handle)
+        {
+            std::multiset<std::pair<u32, u32>> edges;
+            const igraph_t* graph = handle.get_igraph();
+            for (igraph_integer_t e = 0; e < igraph_ecount(graph); e++)
+            {
+                igraph_integer_t from, to;
+                igraph_edge(graph, e, &from, &to);
+                const Gate* src = handle.get_gate_of_vertex(from);
+                const Gate* dst = handle.get_gate_of_vertex(to);
+                edges.insert({src ? src->get_id() : 0, dst ? dst->get_id() : 0});
+            }
+            return edges;
+        }
+
+        // edges of a handle freshly built from the netlist
+        static std::multiset<std::pair<u32, u32>> get_rebuilt_edges(Netlist* nl)
+        {
+            IGraphHandle handle(nl);
+            return get_edges(handle);
+        }
+
+        // random netlist with combinational loops and feedback through flip-flops, every gate drives the first input of the next one
+        static std::unique_ptr<Netlist> create_cyclic_netlist(u32 num_gates, u32 seed = 42)
+        {
+            std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+            const GateLibrary* gl       = nl->get_gate_library();
+            std::mt19937 rng(seed);
+
+            Net* clk = nl->create_net("clk");
+            nl->mark_global_input_net(clk);
+            Net* current = nl->create_net("in");
+            nl->mark_global_input_net(current);
+
+            // the second inputs are connected to randomly chosen outputs once all gates exist
+            std::vector<std::pair<Gate*, std::string>> open_inputs;
+            std::vector<Net*> outputs;
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                Gate* gate;
+                Net* output = nl->create_net("n_" + std::to_string(i));
+                if (i % 8 == 7)
+                {
+                    gate = nl->create_gate(gl->get_gate_type_by_name("DFF"), "ff_" + std::to_string(i));
+                    clk->add_destination(gate, "CLK");
+                    open_inputs.push_back({gate, "D"});
+                    output->add_source(gate, "Q");
+                }
+                else if (rng() % 4 == 0)
+                {
+                    gate = nl->create_gate(gl->get_gate_type_by_name("BUF"), "g_" + std::to_string(i));
+                    current->add_destination(gate, "I");
+                    output->add_source(gate, "O");
+                }
+                else
+                {
+                    gate = nl->create_gate(gl->get_gate_type_by_name("AND2"), "g_" + std::to_string(i));
+                    current->add_destination(gate, "I0");
+                    open_inputs.push_back({gate, "I1"});
+                    output->add_source(gate, "O");
+                }
+                outputs.push_back(output);
+                current = output;
+            }
+
+            for (const auto& [gate, pin] : open_inputs)
+            {
+                outputs[rng() % num_gates]->add_destination(gate, pin);
+            }
+            return nl;
+        }
+
+        static std::set<u32> get_ids(const std::vector<Gate*>& gates)
+        {
+            std::set<u32> ids;
+            for (const Gate* g : gates)
+            {
+                ids.insert(g->get_id());
+            }
+            return ids;
+        }
+    };
+
+    /**
+     * Test that a handle keeps its igraph up to date when the netlist is modified after the igraph has been built.
+     *
+     * Functions: IGraphHandle::get_igraph, IGraphHandle::is_up_to_date, IGraphHandle::invalidate
+     */
+    TEST_F(GraphAlgorithmTest, check_igraph_handle_update)
+    {
+        TEST_START
+        {
+            std::unique_ptr<Netlist> nl = test_utils::create_example_netlist();
+            ASSERT_NE(nl, nullptr);
+
+            IGraphHandle handle(nl.get());
+            EXPECT_FALSE(handle.is_up_to_date());
+            EXPECT_EQ(handle.get_num_gate_vertices(), 9);
+            const auto initial_edges = get_edges(handle);
+            EXPECT_EQ(initial_edges.count({MIN_GATE_ID + 0, MIN_GATE_ID + 5}), 1);
+            EXPECT_TRUE(handle.is_up_to_date());
+
+            // connect a new gate to an existing net
+            Gate* new_gate = nl->create_gate(nl->get_gate_library()->get_gate_type_by_name("BUF"), "new_gate");
+            ASSERT_NE(new_gate, nullptr);
+            nl->get_net_by_id(MIN_NET_ID + 13)->add_destination(new_gate, "I");
+            EXPECT_FALSE(handle.is_up_to_date());
+            EXPECT_EQ(handle.get_num_gate_vertices(), 10);
+            EXPECT_NE(handle.get_vertex_of_gate(new_gate), IGraphHandle::NO_VERTEX);
+            auto edges = get_edges(handle);
+            EXPECT_EQ(edges.count({MIN_GATE_ID + 1, new_gate->get_id()}), 1);
+            EXPECT_EQ(edges, get_rebuilt_edges(nl.get()));
+
+            // disconnect a destination and delete a gate
+            nl->get_net_by_id(MIN_NET_ID + 045)->remove_destination(nl->get_gate_by_id(MIN_GATE_ID + 5), "I0");
+            nl->delete_gate(nl->get_gate_by_id(MIN_GATE_ID + 4));
+            EXPECT_FALSE(handle.is_up_to_date());
+            EXPECT_EQ(handle.get_num_gate_vertices(), 9);
+            edges = get_edges(handle);
+            EXPECT_EQ(edges.count({MIN_GATE_ID + 0, MIN_GATE_ID + 5}), 0);
+            EXPECT_EQ(edges.count({MIN_GATE_ID + 0, MIN_GATE_ID + 4}), 0);
+            EXPECT_EQ(edges, get_rebuilt_edges(nl.get()));
+
+            // batched modifications are picked up once the batch is flushed
+            nl->get_event_handler()->set_batching_enabled(true);
+            nl->get_net_by_id(MIN_NET_ID + 20)->remove_destination(nl->get_gate_by_id(MIN_GATE_ID + 0), "I1");
+            nl->get_event_handler()->set_batching_enabled(false);
+            edges = get_edges(handle);
+            EXPECT_EQ(edges.count({MIN_GATE_ID + 2, MIN_GATE_ID + 0}), 0);
+            EXPECT_EQ(edges, get_rebuilt_edges(nl.get()));
+
+            // modifications while events are disabled require a manual invalidation
+            nl->get_event_handler()->event_enable_all(false);
+            nl->get_net_by_id(MIN_NET_ID + 13)->remove_destination(new_gate, "I");
+            nl->get_event_handler()->event_enable_all(true);
+            EXPECT_TRUE(handle.is_up_to_date());
+            EXPECT_EQ(get_edges(handle), edges);
+            handle.invalidate();
+            EXPECT_EQ(get_edges(handle).count({MIN_GATE_ID + 1, new_gate->get_id()}), 0);
+            EXPECT_EQ(get_edges(handle), get_rebuilt_edges(nl.get()));
+        }
+        TEST_END
+    }
+
+    /**
+     * Test that a handle representing a subset of the gates only follows modifications of its own gates.
+     *
+     * Functions: IGraphHandle::get_igraph, IGraphHandle::is_up_to_date
+     */
+    TEST_F(GraphAlgorithmTest, check_igraph_handle_subgraph_update)
+    {
+        TEST_START
+        {
+            std::unique_ptr<Netlist> nl = test_utils::create_example_netlist();
+            ASSERT_NE(nl, nullptr);
+            Gate* gate_0 = nl->get_gate_by_id(MIN_GATE_ID + 0);
+            Gate* gate_3 = nl->get_gate_by_id(MIN_GATE_ID + 3);
+            Gate* gate_5 = nl->get_gate_by_id(MIN_GATE_ID + 5);
+
+            IGraphHandle handle(nl.get(), {gate_0, gate_3, gate_5});
+            EXPECT_TRUE(handle.is_subgraph());
+            EXPECT_EQ(handle.get_num_gate_vertices(), 3);
+            auto edges = get_edges(handle);
+            EXPECT_EQ(edges.count({gate_3->get_id(), gate_0->get_id()}), 1);
+            EXPECT_EQ(edges.count({gate_0->get_id(), gate_5->get_id()}), 1);
+
+            // new gates do not become part of a subgraph, but their nets are cut at the subgraph boundary
+            Gate* new_gate = nl->create_gate(nl->get_gate_library()->get_gate_type_by_name("BUF"), "new_gate");
+            ASSERT_NE(new_gate, nullptr);
+            test_utils::connect(nl.get(), gate_5, "O", new_gate, "I");
+            EXPECT_FALSE(handle.is_up_to_date());
+            EXPECT_EQ(handle.get_num_gate_vertices(), 3);
+            EXPECT_EQ(handle.get_vertex_of_gate(new_gate), IGraphHandle::NO_VERTEX);
+            edges = get_edges(handle);
+            EXPECT_EQ(edges.count({gate_5->get_id(), 0}), 1);
+
+            nl->get_net_by_id(MIN_NET_ID + 30)->remove_destination(gate_0, "I0");
+            edges = get_edges(handle);
+            EXPECT_EQ(edges.count({gate_3->get_id(), gate_0->get_id()}), 0);
+            EXPECT_EQ(edges.count({gate_3->get_id(), 0}), 1);
+        }
+        TEST_END
+    }
+
+    /**
+     * Test the strongly connected components of the native graph kernels against the igraph implementation on a netlist with cycles.
+     *
+     * Functions: graph_kernels::get_strongly_connected_components
+     */
+    TEST_F(GraphAlgorithmTest, check_csr_strongly_connected_components)
+    {
+        TEST_START
+        {
+            std::unique_ptr<Netlist> nl = create_cyclic_netlist(200);
+            const CsrGraph graph(nl.get(), 4);
+            ASSERT_EQ(graph.get_num_vertices(), 200);
+
+            GraphAlgorithmPlugin plugin;
+            std::set<std::set<u32>> expected;
+            u32 num_cyclic = 0;
+            for (const auto& scc : plugin.get_strongly_connected_components(nl.get()))
+            {
+                expected.insert(get_ids(scc));
+                num_cyclic += (scc.size() > 1) ? 1 : 0;
+            }
+            ASSERT_GT(num_cyclic, 0);
+
+            for (const u32 num_threads : {1, 4})
+            {
+                std::set<std::set<u32>> actual;
+                for (const auto& scc : graph_kernels::get_strongly_connected_components(graph, true, num_threads))
+                {
+                    actual.insert(get_ids(graph.get_gates_of_vertices(scc)));
+                }
+                EXPECT_EQ(actual, expected);
+
+                // the generated netlist does not contain self-loops, so only the cyclic SCCs remain
+                EXPECT_EQ(graph_kernels::get_strongly_connected_components(graph, false, num_threads).size(), num_cyclic);
+            }
+        }
+        TEST_END
+    }
+
+    /**
+     * Test the transitive cones and neighborhoods of the native graph kernels against the netlist utilities on a netlist with cycles.
+     *
+     * Functions: graph_kernels::get_transitive_cones, graph_kernels::get_neighborhoods
+     */
+    TEST_F(GraphAlgorithmTest, check_csr_transitive_cones)
+    {
+        TEST_START
+        {
+            std::unique_ptr<Netlist> nl = create_cyclic_netlist(200);
+            const CsrGraph graph(nl.get(), 4);
+            const std::vector<Gate*>& gates = graph.get_gates();
+            std::vector<u32> start_vertices(gates.size());
+            for (u32 v = 0; v < start_vertices.size(); v++)
+            {
+                start_vertices[v] = v;
+            }
+
+            // the netlist utilities never include the start gate, the kernels do if it lies on a cycle
+            auto compare = [&gates, &graph](const std::vector<std::vector<u32>>& results, const std::function<std::vector<Gate*>(const Gate*)>& expected) {
+                ASSERT_EQ(results.size(), gates.size());
+                for (u32 v = 0; v < gates.size(); v++)
+                {
+                    std::set<u32> actual = get_ids(graph.get_gates_of_vertices(results[v]));
+                    actual.erase(gates[v]->get_id());
+                    EXPECT_EQ(actual, get_ids(expected(gates[v]))) << "start gate " << gates[v]->get_name();
+                }
+            };
+
+            compare(graph_kernels::get_transitive_cones(graph, start_vertices, graph_kernels::Direction::successors, nullptr, 4),
+                    [](const Gate* g) { return netlist_utils::get_next_gates(g, true); });
+            compare(graph_kernels::get_transitive_cones(graph, start_vertices, graph_kernels::Direction::predecessors, nullptr, 4),
+                    [](const Gate* g) { return netlist_utils::get_next_gates(g, false); });
+            compare(graph_kernels::get_neighborhoods(graph, start_vertices, 3, graph_kernels::Direction::successors, 4),
+                    [](const Gate* g) { return netlist_utils::get_next_gates(g, true, 3); });
+
+            // cones stopping at flip-flops contain the next flip-flops, which may include the start flip-flop itself
+            auto is_ff          = [](const Gate* g) { return g->get_type()->has_property(GateTypeProperty::ff); };
+            std::vector<Gate*> ffs = nl->get_gates(is_ff);
+            const std::vector<std::vector<u32>> cones =
+                graph_kernels::get_transitive_cones(graph, graph.get_vertices_of_gates(ffs), graph_kernels::Direction::successors, is_ff, 4);
+            ASSERT_EQ(cones.size(), ffs.size());
+            for (u32 i = 0; i < ffs.size(); i++)
+            {
+                std::set<u32> actual;
+                for (const Gate* g : graph.get_gates_of_vertices(cones[i]))
+                {
+                    if (is_ff(g))
+                    {
+                        actual.insert(g->get_id());
+                    }
+                }
+                EXPECT_EQ(actual, get_ids(netlist_utils::get_next_sequential_gates(ffs[i], true))) << "start gate " << ffs[i]->get_name();
+            }
+
+            // start vertices that are not part of the graph yield empty cones
+            const std::vector<std::vector<u32>> invalid = graph_kernels::get_transitive_cones(graph, {CsrGraph::NO_VERTEX, 0}, graph_kernels::Direction::successors);
+            ASSERT_EQ(invalid.size(), 2);
+            EXPECT_TRUE(invalid[0].empty());
+            EXPECT_FALSE(invalid[1].empty());
+        }
+        TEST_END
+    }
+
+    /**
+     * Test the distances of the native graph kernels against the shortest paths of the netlist utilities on a netlist with cycles.
+     *
+     * Functions: graph_kernels::get_distances, graph_kernels::get_shortest_path
+     */
+    TEST_F(GraphAlgorithmTest, check_csr_distances)
+    {
+        TEST_START
+        {
+            std::unique_ptr<Netlist> nl = create_cyclic_netlist(200);
+            const CsrGraph graph(nl.get(), 4);
+            const std::vector<Gate*>& gates = graph.get_gates();
+
+            for (const u32 source : {0u, 77u, 199u})
+            {
+                const std::vector<u32> distances = graph_kernels::get_distances(graph, {source}, graph_kernels::Direction::successors, std::numeric_limits<u32>::max(), 4);
+                ASSERT_EQ(distances.size(), gates.size());
+                EXPECT_EQ(distances[source], 0);
+                for (u32 v = 0; v < gates.size(); v++)
+                {
+                    if (v == source)
+                    {
+                        continue;
+                    }
+                    const std::vector<Gate*> path = netlist_utils::get_shortest_path(gates[source], gates[v]);
+                    if (path.empty())
+                    {
+                        EXPECT_EQ(distances[v], graph_kernels::UNREACHABLE) << "gate " << gates[v]->get_name();
+                    }
+                    else
+                    {
+                        EXPECT_EQ(distances[v], path.size() - 1) << "gate " << gates[v]->get_name();
+                        EXPECT_EQ(graph_kernels::get_shortest_path(graph, source, v).size(), path.size()) << "gate " << gates[v]->get_name();
+                    }
+                }
+            }
+        }
+        TEST_END
+    }
+}    // namespace hal
@@ -198,6 +198,12 @@ namespace hal
          */
         void layoutProgress(int percent) const;
 
+        /**
+         * Called by layouter once all gates and modules got their final position. The scene is shown
+         * while nets are still being routed.
+         */
+        void layoutBoxesPlaced();
+
         /**
          * Checks whether a modification affects the context and schedules an scene update if necessary.
          *
@@ -331,6 +337,12 @@ namespace hal
          */
         void scheduleSceneUpdate();
 
+        /**
+         * Schedules a scene update which discards the current layout and lays out the whole view from scratch
+         * instead of updating it incrementally.
+         */
+        void scheduleFullLayout();
+
         /**
          * Get a Node that contains a specific Gate. <br>
          * If the context contains the Gate, the node of this gate is returned. <br>
@@ -456,6 +468,7 @@ namespace hal
 
     private Q_SLOTS:
         void handleLayouterFinished();
+        void handleLayouterStopped();
         void handleStyleChanged(int istyle);
         void handleExclusiveModuleLost(u32 old_id);
         void handleModuleNameChanged(Module* m);
@@ -466,6 +479,7 @@ namespace hal
         void applyChanges();
         void requireSceneUpdate();
         void startSceneUpdate();
+        bool layoutInterrupted();
         bool testIfAffectedInternal(const u32 id, const u32* moduleId, const u32* gateId);
         void removeModuleContents(const u32 moduleId);
 
@@ -495,6 +509,9 @@ namespace hal
         bool mUnappliedChanges;
         bool mSceneUpdateRequired;
         bool mSceneUpdateInProgress;
+        bool mSceneShown;
+        bool mAbortRequested;
+        bool mDeleteRequested;
 
         QDateTime mTimestamp;
 
@@ -397,5 +397,6 @@ namespace hal
         SettingsItemCheckbox* mSettingDumpJunction;
         SettingsItemCheckbox* mSettingParseLayout;
         SettingsItemCheckbox* mSettingLayoutBoxes;
+        SettingsItemCheckbox* mSettingIncrementalLayout;
     };
 }    // namespace hal
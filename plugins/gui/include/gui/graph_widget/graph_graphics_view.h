@@ -159,6 +159,7 @@ namespace hal
 
         void handleAddModuleToView();
         void handleAddGateToView();
+        void handleRelayoutAction();
 
         void handleAddSuccessorToView();
         void handleAddPredecessorToView();
@@ -59,6 +59,13 @@ namespace hal
         static const qreal sGridFadeStartLod = 0.4;
         static const qreal sGridFadeEndLod = 1.0;
 
+        static const qreal sOverviewMaxLod = 0.1; // if current lod < than this large scenes are drawn as aggregated tiles
+        static const int sOverviewMinItems = 20000; // minimum number of gate, module, and net items to draw large scenes as tiles
+        static const int sOverviewTileSize = 500; // edge length of an overview tile in scene coordinates
+
+        static const int sViewportPopulationMinItems = 20000; // minimum number of gate, module, and net items to only attach items close to the viewport
+        static const int sViewportNetMaxTiles = 64; // nets overlapping more overview tiles are not part of the spatial index of nets but checked individually
+
         static const int mDragSwapSensitivityDistance = 100;
 
         enum class grid_type
@@ -35,6 +35,7 @@
 #include "hal_core/netlist/module.h"
 
 #include <QGraphicsScene>
+#include <QHash>
 #include <QPair>
 #include <QVector>
 
@@ -44,6 +45,7 @@ namespace hal
     class GraphicsItem;
     class GraphicsModule;
     class GraphicsNet;
+    class GraphicsNode;
 
     /**
      * @ingroup graph
@@ -149,7 +151,8 @@ namespace hal
         QPointF dropTarget();
 
         /**
-         * Adds a GraphicsItem to the scene.
+         * Adds a GraphicsItem to the scene. Adding an item that is already owned by the scene (e.g., because it was
+         * detached from the visible area) only attaches it again.
          *
          * @param item - The GraphicsItem to add
          */
@@ -223,6 +226,63 @@ namespace hal
          */
         void setMousePressed(bool isPressed);
 
+        /**
+         * Switches between detailed rendering and the overview of large scenes depending on the level of detail.
+         * In overview mode all gate, module, and net items are hidden and the scene is drawn as aggregated tiles
+         * instead, which keeps zooming and panning responsive for scenes with a huge number of items.
+         *
+         * @param lod - The current level of detail
+         */
+        void updateOverviewMode(qreal lod);
+
+        /**
+         * Checks whether the scene is currently drawn as aggregated tiles.
+         *
+         * @returns <b>true</b> if the scene is in overview mode.
+         */
+        bool overviewMode() const;
+
+        /**
+         * Finds the gate or module item at the given scene position using the spatial index of the scene.
+         * Unlike QGraphicsScene::itemAt this also finds items hidden in overview mode.
+         *
+         * @param pos - The scene position
+         * @returns the node item or a nullptr if there is none at the given position.
+         */
+        GraphicsNode* nodeItemAt(const QPointF& pos);
+
+        /**
+         * Gets the scene rectangle of the overview tile containing the given scene position.
+         *
+         * @param pos - The scene position
+         * @returns the tile rectangle.
+         */
+        QRectF overviewTileRect(const QPointF& pos) const;
+
+        /**
+         * Marks the spatial index as outdated. Must be called whenever gate or module items have been moved.
+         */
+        void invalidateSpatialIndex();
+
+        /**
+         * Adds the gate, module, and net items of large scenes to the QGraphicsScene only if they are close to the visible area.
+         * Items farther away are kept by the scene but detached from the QGraphicsScene, so that Qt does not index, paint,
+         * or hit-test them. The items close to the visible area are looked up in the spatial indices of nodes and nets,
+         * only the attached items are visited to detach the ones that moved out of range. Nets create their detailed shapes
+         * once they get attached and release them when detached. Selected items always stay attached. Scenes with fewer items than
+         * graph_widget_constants::sViewportPopulationMinItems always have all items attached.
+         *
+         * @param visibleRect - The visible area in scene coordinates
+         */
+        void updateViewportItems(const QRectF& visibleRect);
+
+        /**
+         * Gets the bounding rectangle of all gate, module, and net items including the ones detached by updateViewportItems.
+         *
+         * @returns the bounding rectangle in scene coordinates.
+         */
+        QRectF graphItemsBoundingRect() const;
+
 #ifdef GUI_DEBUG_GRID
         void debugSetLayouterGrid(const QVector<qreal>& debug_x_lines, const QVector<qreal>& debug_y_lines, qreal debug_default_height, qreal debug_default_width);
         void setDebugGridEnabled(bool enabled);
@@ -320,6 +380,17 @@ namespace hal
         using QGraphicsScene::clear;
 
         void drawBackground(QPainter* painter, const QRectF& rect) override;
+        void drawForeground(QPainter* painter, const QRectF& rect) override;
+
+        static quint64 tileKey(int ix, int iy);
+        template<typename T, typename F>
+        static void forEachTile(const QHash<quint64, QVector<T*>>& index, const QRectF& rect, F func);
+        void buildSpatialIndex();
+        void buildNetSpatialIndex();
+        void applyOverviewVisibility();
+        void attachGraphItem(GraphicsItem* item);
+        bool ownsGraphItem(const GraphicsItem* item) const;
+        bool isPopulatedLazily() const;
 
         NodeDragShadow* mDragShadowGate;
 
@@ -327,6 +398,17 @@ namespace hal
         QVector<GraphicsGate*> mGateItems;
         QVector<GraphicsNet*> mNetItems;
 
+        bool mOverviewMode;
+        bool mSpatialIndexDirty;
+        int mMaxNodesPerTile;
+        QHash<quint64, QVector<GraphicsNode*>> mSpatialIndex;
+        bool mNetSpatialIndexDirty;
+        QHash<quint64, QVector<GraphicsNet*>> mNetSpatialIndex;
+        QVector<GraphicsNet*> mWideNetItems;
+
+        QRectF mPopulatedRect;
+        bool mPopulationDirty;
+
 #ifdef GUI_DEBUG_GRID
         void debugDrawLayouterGrid(QPainter* painter, const int x_from, const int x_to, const int y_from, const int y_to);
         QVector<qreal> mDebugXLines;
@@ -79,6 +79,12 @@ namespace hal {
         void paint(QPainter* painter,
                    const QStyleOptionGraphicsItem* option,
                    QWidget* widget) override;
+
+    protected:
+        /**
+         * Builds the shape of the lines, splits, and arrows of the net.
+         */
+        void buildShape() override;
     };
 
 }
@@ -135,6 +135,23 @@ namespace hal
          */
         void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) override;
 
+    protected:
+        /**
+         * Builds the shape used for picking from the lines and splits of the net.
+         * The shape is only kept while the net is part of a scene.
+         */
+        virtual void buildShape();
+
+        /**
+         * Builds the shape when the net is added to a scene and releases it when the net is removed from its scene.
+         * Large GraphicsScenes only attach the nets close to the visible area, so the detailed shapes of the other nets are never created.
+         *
+         * @param change - The change of the item
+         * @param value - The new value
+         * @returns the value passed to Qt.
+         */
+        QVariant itemChange(GraphicsItemChange change, const QVariant& value) override;
+
     private:
         static qreal sAlpha;
 
@@ -36,6 +36,8 @@
 #include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/net.h"
 
+#include <QElapsedTimer>
+#include <QFutureWatcher>
 #include <QMap>
 #include <QMultiHash>
 #include <QObject>
@@ -44,6 +46,7 @@
 #include <QSet>
 #include <QVector>
 #include <QThread>
+#include <atomic>
 
 namespace hal
 {
@@ -118,6 +121,7 @@ namespace hal
                 return lanePosition(maxLane - 1);
             }
             float xBoxOffset() const;
+            bool operator==(const SceneCoordinate& other) const;
         };
 
         class SceneCoordinateArray
@@ -185,6 +189,7 @@ namespace hal
             bool hasInputArrow() const { return mInputArrow; }
             void setOutputArrow() { mOutputArrow = true; }
             bool hasOutputArrow() const { return  mOutputArrow; }
+            bool operator==(const EndpointList& other) const;
 
         private:
             EndpointType mNetType;
@@ -224,6 +229,24 @@ namespace hal
             QSet<Road*> mVRoads;
         };
 
+        /**
+         * Everything the drawing of a net depends on. If the signature of a net did not change
+         * since the previous layout and none of the junctions or boxes touched by the net were
+         * replaced, the graphics items of the net can be reused.
+         */
+        struct NetRouteSignature
+        {
+            EndpointList mEndpoints;
+            QHash<NetLayoutWire, int> mLanes;
+            QMap<int, SceneCoordinate> mCoordX;
+            QMap<int, SceneCoordinate> mCoordY;
+
+            bool operator==(const NetRouteSignature& other) const
+            {
+                return mEndpoints == other.mEndpoints && mLanes == other.mLanes && mCoordX == other.mCoordX && mCoordY == other.mCoordY;
+            }
+        };
+
     public:
         /**
          * Constructor.
@@ -257,7 +280,15 @@ namespace hal
         virtual void remove(const QSet<u32> modules, const QSet<u32> gates, const QSet<u32> nets) = 0;
 
         /**
-         * Does the actual layout process.
+         * Starts the actual layout process and returns immediately. The layout is computed in steps which are
+         * either executed by worker threads or as queued calls in the GUI thread, thus the scene gets populated
+         * region by region while GUI events are processed. Signal layoutFinished() is emitted once it has stopped.
+         * Net routing and the grid computation run in worker threads on data owned by the layouter. Box creation,
+         * the net scan, and gate placement run in the GUI thread in time slices of 20 ms, since they read the
+         * live netlist, create graphics items, or add them to the scene. There is no copied snapshot of the netlist,
+         * instead a change of the context cancels the running layout before the netlist is read again.
+         * If incremental layout is enabled and no full layout was requested, node positions and graphics items
+         * from the previous layout are kept and only nets and junctions affected by the changes are routed again.
          */
         void layout();
         void alternateLayout();
@@ -310,6 +341,51 @@ namespace hal
         bool canRollback() const;
         bool rollback();
 
+        /**
+         * Requests that the next call to layout() rebuilds the scene from scratch even if
+         * incremental layout is enabled.
+         */
+        void requestFullLayout();
+
+        /**
+         * Marks the graphics item of the given node as outdated (e.g. after renaming) so that it
+         * gets recreated by the next incremental layout.
+         *
+         * @param nd - The node
+         */
+        void invalidateNode(const Node& nd);
+
+        /**
+         * Marks the graphics items of the given net as outdated so that they get recreated by
+         * the next incremental layout.
+         *
+         * @param netId - The ID of the net
+         */
+        void invalidateNet(u32 netId);
+
+        bool incrementalLayoutEnabled() const;
+        void setIncrementalLayoutEnabled(bool enabled);
+
+        /**
+         * Asks a running layout to stop after the current step. The scene is left incomplete and
+         * the next layout will be a full layout. Has no effect if no layout is running.
+         */
+        void requestCancel();
+
+        /**
+         * Checks whether a layout started by layout() has not stopped yet. Since the GUI event loop
+         * keeps running while the layout gets computed, events might be processed in the meantime.
+         *
+         * @returns true if a layout is running.
+         */
+        bool layoutRunning() const;
+
+    Q_SIGNALS:
+        /**
+         * Emitted when a layout started by layout() has either finished or was cancelled.
+         */
+        void layoutFinished();
+
     protected:
         GraphicsScene* mScene;
         GraphContext* mParentContext;
@@ -318,22 +394,38 @@ namespace hal
         QMap<Node, QPoint> mNodeToPositionRollback;
 
     private Q_SLOTS:
+        void continueLayout();
         void handleDrawNetThreadFinished();
         void handleJunctionThreadFinished();
 
     private:
         void clearLayoutData();
         void clearComments();
-        void createBoxes();
-        void getWireHash();
+        void scheduleLayoutStep();
+        void finishLayout();
+        void cancelLayout();
+        void deleteCoordArrays();
+        bool createBoxes();
+        bool scanNets();
+        void scanNet(u32 id);
+        void routeNets();
+        void collectEndpoints();
+        bool routeJunctions();
         void findMaxBoxDimensions();
         void findMaxChannelLanes();
         void calculateJunctionMinDistance();
         void calculateGateOffsets();
-        void placeGates();
-        void drawNets();
+        void collectPlacementRegions();
+        bool placeGates();
+        void prepareDrawNets();
+        bool drawNets();
         void drawComments();
         void drawNetsIsolated(u32 id, Net* n, const EndpointList& epl);
+        void addNetItem(GraphicsNet* item);
+        void removeNetItems(u32 id);
+        bool canReuseNetItems(u32 id, const NetRouteSignature& sig) const;
+        NetRouteSignature netRouteSignature(u32 id) const;
+        void discardPreviousLayout();
         void updateSceneRect();
         static bool verifyModulePort(Net* n, const Node& modNode, bool isModInput);
         void handleCommentAboutToDeleted(CommentEntry* entry);
@@ -406,6 +498,46 @@ namespace hal
 
         SceneCoordinateArray* mCoordArrayX;
         SceneCoordinateArray* mCoordArrayY;
+
+        bool mIncrementalLayout;
+        bool mIncrementalEnabled;
+        bool mFullLayoutRequired;
+        bool mLayoutRunning;
+        std::atomic<bool> mCancelRequested;
+
+        // steps of a running layout, each one is started once the previous one has finished
+        enum LayoutStage
+        {
+            StageIdle,
+            StageCreateBoxes,
+            StageScanNets,
+            StageRouteNets,
+            StageRouteJunctions,
+            StageComputeGrid,
+            StagePlaceGates,
+            StageDrawNets
+        };
+        LayoutStage mLayoutStage;
+        bool mStepScheduled;
+        int mStepIndex;
+        int mNetsDone;
+        QElapsedTimer mLayoutTimer;
+        QFutureWatcher<void> mWorker;
+        QList<QPoint> mPendingPositions;
+        QList<u32> mNetQueue;
+        QHash<u32, QPair<QList<NetLayoutPoint>, QList<NetLayoutPoint>>> mRoutedNets;
+        QHash<NetLayoutPoint, NetLayoutJunctionEntries>::const_iterator mJunctionIterator;
+        QList<QList<const NodeBox*>> mPlacementRegions;
+        QSet<u32> mNetsSnapshot;
+        QSet<Node> mInvalidNodes;
+        QSet<u32> mInvalidNets;
+        QHash<Node, GraphicsNode*> mPreviousNodeItems;
+        QHash<Node, QPoint> mPreviousNodePositions;
+        QHash<NetLayoutPoint, NetLayoutJunctionEntries> mPreviousJunctionEntries;
+        NetLayoutJunctionHash mPreviousJunctionHash;
+        QSet<NetLayoutPoint> mChangedPoints;
+        QMultiHash<u32, GraphicsNet*> mNetItems;
+        QHash<u32, NetRouteSignature> mNetSignatures;
     };
 
     class DrawNetThread : public QThread
@@ -292,6 +292,13 @@ namespace hal {
          */
         bool isTrivial() const;
 
+        /**
+         * Equality check, junctions with identical entries are routed identically
+         * @param other The entries to compare with
+         * @return true if all entry lists are equal, false otherwise
+         */
+        bool operator==(const NetLayoutJunctionEntries& other) const;
+
         /**
          * Reset dump junction file, initialize file with timestamp
          */
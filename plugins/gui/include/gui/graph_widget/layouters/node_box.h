@@ -68,6 +68,15 @@ namespace hal {
          */
         NodeBox(const Node& n, int px, int py);
 
+        /**
+         * @brief NodeBox constructor reusing an existing graphic item
+         * @param n node of type gate or module
+         * @param px x grid position where box is placed
+         * @param py y grid position where box is placed
+         * @param item graphic item created by a previous layout for the same node
+         */
+        NodeBox(const Node& n, int px, int py, GraphicsNode* item);
+
         /**
          * @brief getNode getter for node information
          * @return the node represented by NodeBox
@@ -167,6 +176,15 @@ namespace hal {
          */
         void addBox(const Node& nd, int px, int py);
 
+        /**
+         * @brief addBox store NodeBox for existing graphic item in vector
+         * @param nd Node to be added
+         * @param px grid x-position
+         * @param py grid y-position
+         * @param item graphic item to be reused, a new one gets created if nullptr
+         */
+        void addBox(const Node& nd, int px, int py, GraphicsNode* item);
+
         /**
          * @brief clearBoxes delete all NodeBox'es and clear vector.
          */
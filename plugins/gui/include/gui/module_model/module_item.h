@@ -30,6 +30,7 @@
 
 
 #include <QColor>
+#include <QHash>
 #include <QList>
 #include <QString>
 #include <QVariant>
@@ -69,7 +70,7 @@ namespace hal
          *
          * @param moduleMap - A map [id]->[ModuleItem] of children candidates
          */
-        void appendExistingChildIfAny(const QMap<u32,ModuleItem*>& moduleMap);
+        void appendExistingChildIfAny(const QHash<u32,ModuleItem*>& moduleMap);
 
         /**
          * Gets the data of this item model item i.e. the name of this ModuleItem if column=1.
@@ -129,11 +130,27 @@ namespace hal
          */
         void setHighlighted(const bool highlighted);
 
+        /**
+         * Checks whether the children of this ModuleItem have already been created. Gate and net items have no
+         * children and are therefore always considered fetched.
+         *
+         * @returns <b>true</b> if the children of this ModuleItem have been created.
+         */
+        bool isFetched() const;
+
+        /**
+         * Marks the children of this ModuleItem as created.
+         *
+         * @param fetched - <b>true</b> if the children have been created, <b>false</b> otherwise.
+         */
+        void setFetched(const bool fetched);
+
     private:
         u32 mId;
         TreeItemType mType;
         QString mName;
 
         bool mHighlighted;
+        bool mFetched;
     };
 }
@@ -32,7 +32,9 @@
 
 
 #include <QAbstractItemModel>
+#include <QHash>
 #include <QModelIndex>
+#include <QSet>
 #include <QVariant>
 #include <set>
 #include <array>
@@ -80,6 +82,30 @@ namespace hal
          */
         Qt::ItemFlags flags(const QModelIndex& index) const override;
 
+        /**
+         * Returns <b>true</b> if the item at the given index has children. For modules whose children have not been
+         * created yet, the netlist is queried instead of the item tree.
+         *
+         * @param parent - The model index
+         * @returns <b>true</b> if the item has children, <b>false</b> otherwise
+         */
+        bool hasChildren(const QModelIndex& parent = QModelIndex()) const override;
+
+        /**
+         * Returns <b>true</b> if the children of the module at the given index have not been created yet.
+         *
+         * @param parent - The model index
+         * @returns <b>true</b> if more items can be fetched for the given index
+         */
+        bool canFetchMore(const QModelIndex& parent) const override;
+
+        /**
+         * Creates the ModuleItems for all submodules, gates, and nets of the module at the given index.
+         *
+         * @param parent - The model index
+         */
+        void fetchMore(const QModelIndex& parent) override;
+
         // === Others ===
 
         /**
@@ -108,7 +134,18 @@ namespace hal
         ModuleItem* getItem(const u32 id, ModuleItem::TreeItemType type = ModuleItem::TreeItemType::Module) const;
 
         /**
-         * Initializes the item model using the global netlist object gNetlist.
+         * Returns the ModuleItem for a specified id and type. If the item has not been created yet, the children of all
+         * modules on the path from the top module to the item are fetched first.
+         *
+         * @param id - The id of the ModuleItem
+         * @param type - The type of the ModuleItem
+         * @returns the ModuleItem with the specified id and type or a nullptr if the item is not part of the tree.
+         */
+        ModuleItem* fetchItem(const u32 id, ModuleItem::TreeItemType type = ModuleItem::TreeItemType::Module);
+
+        /**
+         * Initializes the item model using the global netlist object gNetlist. Only the item of the top module is
+         * created, all other items are created once their parent module is expanded.
          */
         void init();
 
@@ -119,6 +156,7 @@ namespace hal
 
         /**
          * Add a module to the item model. For the specified module a new ModuleItem is created and stored.
+         * Nothing is done if the children of the parent module have not been fetched yet.
          *
          * @param id - The id of the module to add.
          * @param parent_module - The id of the parent module of the module to add.
@@ -127,6 +165,7 @@ namespace hal
 
         /**
          * Add a gate to the item model. For the specified gate a new ModuleItem is created and stored.
+         * Nothing is done if the children of the parent module have not been fetched yet.
          *
          * @param id - The id of the gate to add.
          * @param parent_module - The id of the parent module of the gate to add.
@@ -135,6 +174,7 @@ namespace hal
 
         /**
          * Add a net to the item model. For the specified net a new ModuleItem is created and stored.
+         * Nothing is done if the children of the parent module have not been fetched yet.
          *
          * @param id - The id of the net to add.
          * @param parent_module - The id of the parent module of the net to add.
@@ -142,23 +182,15 @@ namespace hal
         void addNet(const u32 id, const u32 parent_module);
 
         /**
-         * Recursively adds the given module with all of its submodules (and their submodules and so on...)
-         * and the gates those modules to the item model.
-         *
-         * @param module - The module which should be added to the item model together with all its
-         *                  submodules, gates and nets.
-         */
-        void addRecursively(const Module* module);
-
-        /**
-         * Removes a module from the item model. The specified module MUST be contained in the item model.
+         * Removes a module and all of its fetched children from the item model. Nothing is done if no item has
+         * been created for the module.
          *
          * @param id - The id of the module to remove
          */
         void removeModule(const u32 id);
 
         /**
-         * Removes a gate from the item model. The specified gate MUST be contained in the item model.
+         * Removes a gate from the item model. Nothing is done if no item has been created for the gate.
          *
          * @param id - The id of the gate to remove
          */
@@ -182,7 +214,7 @@ namespace hal
 
         /**
          * Handles the assigment of gates to modules. 
-         * If the gate does not yet exist in the item model, a new one is created.
+         * If the gate does not yet exist in the item model and the children of the module have been fetched, a new one is created.
          * All nets, that are connected to the gate, will be updated.
         */
         void handleModuleGateAssinged(const u32 id, const u32 parent_module);
@@ -191,7 +223,8 @@ namespace hal
          * Updates the position of a net in the ModuleTree. 
          * The net will be placed under the deepest module, that contains all sources and destinations of the net.
          * If no suitable parent could be found, then the net will instead be placed under the top module.
-         * If the net does not exist in the item model (e.g. it's a global net), then nothing is updated.
+         * If the net is a global net, then nothing is updated. If the children of the new parent module have not been
+         * fetched yet, the item of the net is removed instead.
          * 
          * @param net The net whose source or destination might have changed.
         */
@@ -199,28 +232,29 @@ namespace hal
 
         /**
          * Reattaches the ModuleItem corresponding to the specified module to a new parent item.
-         * The new parent must already be set in the Module object.
+         * The new parent must already be set in the Module object. If the children of the new parent have not been
+         * fetched yet, the item is removed instead.
          *
          * @param module - The module whose ModuleItem will be reattached to a new parent in the item model.
         */
         void updateModuleParent(const Module* module);
 
         /**
-         * Updates the ModuleItem for the specified module. The specified module MUST be contained in the item model.
+         * Updates the ModuleItem for the specified module. Nothing is done if no item has been created for the module.
          *
          * @param id - The id of the module to update
          */
         void updateModuleName(const u32 id);
 
         /**
-         * Updates the ModuleItem for the specified gate. The specified gate MUST be contained in the item model.
+         * Updates the ModuleItem for the specified gate. Nothing is done if no item has been created for the gate.
          *
          * @param id - The id of the gate to update
          */
         void updateGateName(const u32 id);
 
         /**
-         * Updates the ModuleItem for the specified net. The specified gate MUST be contained in the item model.
+         * Updates the ModuleItem for the specified net. Nothing is done if no item has been created for the net.
          *
          * @param id - The id of the net to update
          */
@@ -235,7 +269,6 @@ namespace hal
          */
         bool isModifying();
 
-    private:
         /**
          * Searches for a new parent module, such that it is the deepest module in the hierarchy, that contains all
          * sources and destinations of the net. 
@@ -245,12 +278,53 @@ namespace hal
          * @return The new parent module, that contains all sources and destinations of net. If no such parent could be found 
          * (e.g. net has no sources or destinations), nullptr is returned instead.
         */
-        Module* findNetParent(const Net* net);
+        Module* findNetParent(const Net* net) const;
+
+    private:
+        /**
+         * Inserts the item as last child of the parent item and stores it in the id map of its type.
+         *
+         * @param item - The new item
+         * @param parent - The parent item
+         */
+        void insertItem(ModuleItem* item, ModuleItem* parent);
+
+        /**
+         * Removes the item and all of its children from the tree and the id maps and deletes them.
+         *
+         * @param item - The item to remove
+         */
+        void removeItem(ModuleItem* item);
+
+        /**
+         * Removes the item and all of its children from the id maps.
+         *
+         * @param item - The item to forget
+         */
+        void forgetItem(ModuleItem* item);
+
+        /**
+         * Returns <b>true</b> if the net is shown in the module tree, i.e., if it is not a global input or output net.
+         *
+         * @param net - The net
+         * @returns <b>true</b> if the net is shown in the module tree
+         */
+        bool isTreeNet(const Net* net) const;
+
+        /**
+         * Keeps track of whether the net has any endpoint, nets without endpoints are placed under the top module.
+         *
+         * @param net - The net
+         */
+        void updateUnconnectedNet(const Net* net);
+
+        QHash<u32, ModuleItem*> mModuleMap;
+        QHash<u32, ModuleItem*> mGateMap;
+        QHash<u32, ModuleItem*> mNetMap;
+        std::array<QHash<u32, ModuleItem*>*, 3> mModuleItemMaps = {&mModuleMap, &mGateMap, &mNetMap};
 
-        QMap<u32, ModuleItem*> mModuleMap;
-        QMap<u32, ModuleItem*> mGateMap;
-        QMap<u32, ModuleItem*> mNetMap;
-        std::array<QMap<u32, ModuleItem*>*, 3> mModuleItemMaps = {&mModuleMap, &mGateMap, &mNetMap};;
+        // IDs of all nets without sources and destinations, collected once by init and kept up to date by the net events
+        QSet<u32> mUnconnectedNets;
 
         bool mIsModifying;
     };
@@ -27,8 +27,10 @@
 
 #include "gui/gui_utils/sort.h"
 #include "gui/searchbar/search_proxy_model.h"
+#include "hal_core/defines.h"
 
 
+#include <QSet>
 #include <QSortFilterProxyModel>
 
 namespace hal
@@ -104,10 +106,27 @@ namespace hal
         bool lessThan(const QModelIndex &source_left, const QModelIndex &source_right) const override;
         bool checkRowRecursion(int sourceRow, const QModelIndex& sourceParent, int startIndex, int endIndex, int offset = 0) const override;
 
+    private Q_SLOTS:
+        void handleSourceModelChanged();
+        void handleSourceRowsChanged();
+        void handleSearchMatchesOutdated();
+
     private:
+        /**
+         * Queries the search index of the netlist for the current search string and collects the matching
+         * items together with all of their ancestors, so that filterAcceptsRow does not need to check
+         * the subtree of each row.
+         */
+        void updateSearchMatches();
+
         gui_utility::mSortMechanism mSortMechanism;
 
         bool mFilterNets;
         bool mFilterGates;
+
+        QSet<u32> mAcceptedModules;
+        QSet<u32> mAcceptedGates;
+        QSet<u32> mAcceptedNets;
+        bool mSearchMatchesOutdated;
     };
 }
@@ -155,6 +155,8 @@ namespace hal
 
         void signalThreadEvent(int type, int evt, void* object, u32 associated_data);
 
+        void signalThreadEventBatch(void* batch);
+
         /**
          * Q_SIGNAL to notify that the netlists id has been changed. <br>
          * Relays the following hal-core event: <i>NetlistEvent::event::id_changed</i>
@@ -594,6 +596,15 @@ namespace hal
         */
         void groupingModuleRemoved(Grouping* grp, u32 id) const;
 
+        /**
+         * Q_SIGNAL to notify that a batch of events has been relayed through the signals above. <br>
+         * Allows to handle bulk modifications at once, the IDs of the objects affected by an event are available as ranges of consecutive IDs via EventBatch::get_id_ranges.
+         * Events of objects that have been removed later on within the batch are not contained, apart from their removal.
+         *
+         * @param batch - The relayed events
+         */
+        void eventBatchRelayed(const EventBatch& batch) const;
+
     public Q_SLOTS:
         /**
          * Q_SLOT to handle that a netlist has been opened.
@@ -608,7 +619,11 @@ namespace hal
 
         void handleThreadEvent(int type, int evt, void* object, u32 associated_data);
 
+        void handleThreadEventBatch(void* batch);
+
     private:
+        void relayEventBatch(const EventBatch& batch);
+        EventBatch dropStaleEvents(const EventBatch& batch) const;
         void relayNetlistEvent(NetlistEvent::event ev, Netlist* object, u32 associated_data);
         void relayModuleEvent(ModuleEvent::event ev, Module* mod, u32 associated_data);
         void relayGateEvent(GateEvent::event ev, Gate* gat, u32 associated_data);
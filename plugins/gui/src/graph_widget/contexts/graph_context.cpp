@@ -34,6 +34,9 @@ namespace hal
           mUnappliedChanges(false),
           mSceneUpdateRequired(false),
           mSceneUpdateInProgress(false),
+          mSceneShown(false),
+          mAbortRequested(false),
+          mDeleteRequested(false),
           mSpecialUpdate(false),
           mExclusiveModuleId(0)
     {
@@ -59,6 +62,7 @@ namespace hal
             delete mLayouter;
 
         mLayouter = layouter;
+        connect(mLayouter, &GraphLayouter::layoutFinished, this, &GraphContext::handleLayouterStopped);
     }
 
     void GraphContext::setShader(GraphShader* shader)
@@ -246,7 +250,20 @@ namespace hal
     void GraphContext::testIfAffected(const u32 id, const u32* moduleId, const u32* gateId)
     {
         if (testIfAffectedInternal(id, moduleId, gateId))
+        {
+            // boxes of modified modules need to be recreated in case of incremental layout
+            mLayouter->invalidateNode(Node(id, Node::Module));
+            if (moduleId)
+                mLayouter->invalidateNode(Node(*moduleId, Node::Module));
+            if (gateId)
+            {
+                Gate* g = gNetlist->get_gate_by_id(*gateId);
+                const NodeBox* box = g ? mLayouter->boxes().boxForGate(g) : nullptr;
+                if (box)
+                    mLayouter->invalidateNode(box->getNode());
+            }
             scheduleSceneUpdate();
+        }
     }
 
     bool GraphContext::testIfAffectedInternal(const u32 id, const u32* moduleId, const u32* gateId)
@@ -471,6 +488,12 @@ namespace hal
             update();
     }
 
+    void GraphContext::scheduleFullLayout()
+    {
+        mLayouter->requestFullLayout();
+        scheduleSceneUpdate();
+    }
+
     Node GraphContext::nodeForGate(const u32 id) const
     {
         if (mGates.contains(id))
@@ -500,11 +523,22 @@ namespace hal
 
     void GraphContext::layoutProgress(int percent) const
     {
+        // do not cover the scene once it is shown
+        if (mSceneShown)
+            return;
         QString text;
         if (!percent) text = QString("Layout %1[%2]").arg(mName).arg(mId);
         if (mParentWidget) mParentWidget->showProgress(percent,text);
     }
 
+    void GraphContext::layoutBoxesPlaced()
+    {
+        if (mSceneShown)
+            return;
+        mSceneShown = true;
+        if (mParentWidget) mParentWidget->handleSceneAvailable();
+    }
+
     void GraphContext::storeViewport()
     {
         if (mParentWidget) mParentWidget->storeViewport();
@@ -512,6 +546,8 @@ namespace hal
 
     void GraphContext::moveNodeAction(const QPoint& from, const QPoint& to)
     {
+        // node positions must not change while layout is running
+        if (mLayouter->layoutRunning()) return;
         const QMap<QPoint,Node> nodeMap = mLayouter->positionToNodeMap();
         auto it = nodeMap.find(from);
         if (it==nodeMap.constEnd()) return;
@@ -537,7 +573,8 @@ namespace hal
 
             mLayouter->scene()->connectAll();
 
-            if (mParentWidget) mParentWidget->handleSceneAvailable();
+            if (mParentWidget && !mSceneShown) mParentWidget->handleSceneAvailable();
+            mSceneShown = false;
         }
     }
 
@@ -550,7 +587,12 @@ namespace hal
     void GraphContext::update()
     {
         if (mSceneUpdateInProgress)
+        {
+            // running layout is outdated, changes get applied when it has stopped
+            if (mUnappliedChanges || mSceneUpdateRequired)
+                mLayouter->requestCancel();
             return;
+        }
 
         storeViewport();
 
@@ -563,6 +605,14 @@ namespace hal
 
     void GraphContext::applyChanges()
     {
+        if (mLayouter->layoutRunning())
+        {
+            // layouter must not be modified while layout is running
+            mUnappliedChanges = true;
+            mLayouter->requestCancel();
+            return;
+        }
+
         // since changes are only applied once in a while added module might not exist any more
         auto it = mAddedModules.begin();
         while (it != mAddedModules.end())
@@ -659,8 +709,17 @@ namespace hal
 
     void GraphContext::startSceneUpdate()
     {
+        if (mLayouter->layoutRunning())
+        {
+            // events processed by running layout might trigger another update, restart once it has stopped
+            mSceneUpdateRequired = true;
+            mLayouter->requestCancel();
+            return;
+        }
+
         mSceneUpdateRequired = false;
         mSceneUpdateInProgress = true;
+        mSceneShown = false;
 
         if (mParentWidget) mParentWidget->handleSceneUnavailable();
         mLayouter->scene()->disconnectAll();
@@ -671,14 +730,50 @@ namespace hal
 
         exclusiveModuleCheck();
 
+        // layout is computed asynchronously, handleLayouterStopped() gets called once it has stopped
         mLayouter->layout();
+    }
+
+    void GraphContext::handleLayouterStopped()
+    {
+        if (layoutInterrupted()) return;
         handleLayouterFinished();
     }
 
+    bool GraphContext::layoutInterrupted()
+    {
+        if (mDeleteRequested)
+        {
+            // context was deleted by user while layout was running
+            deleteLater();
+            return true;
+        }
+        if (mAbortRequested)
+        {
+            abortLayout();
+            return true;
+        }
+        return false;
+    }
+
     void GraphContext::abortLayout()
     {
         if (!mSceneUpdateInProgress) return;
-        if (!mLayouter->rollback()) return;
+        if (mLayouter->layoutRunning())
+        {
+            // layouter must not be rolled back while layout is running
+            mAbortRequested = true;
+            mLayouter->requestCancel();
+            return;
+        }
+        mAbortRequested = false;
+        if (!mLayouter->rollback())
+        {
+            // nothing to roll back to, finish cancelled layout
+            mSceneUpdateRequired = true;
+            handleLayouterFinished();
+            return;
+        }
         mGates.clear();
         mModules.clear();
         for (const Node& nd : mLayouter->nodeToPositionMap().keys())
@@ -691,12 +786,13 @@ namespace hal
             }
         }
         mLayouter->layout();
-        handleLayouterFinished();
     }
 
     void GraphContext::handleStyleChanged(int istyle)
     {
         Q_UNUSED(istyle);
+        // scene gets restyled once running layout has finished
+        if (mLayouter->layoutRunning()) return;
         handleLayouterFinished();
     }
 
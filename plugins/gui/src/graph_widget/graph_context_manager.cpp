@@ -47,6 +47,13 @@ namespace hal
         mSettingParseLayout = new SettingsItemCheckbox("Apply Parsed Position", "graph_view/layout_parse", true, "Graph View", "Use parsed verilog coordinates if available.");
 
         mSettingLayoutBoxes = new SettingsItemCheckbox("Optimize Box Layout", "graph_view/layout_boxes", true, "Graph View", "If disabled faster randomized placement.");
+
+        mSettingIncrementalLayout = new SettingsItemCheckbox("Incremental Layout",
+                                                             "graph_view/layout_incremental",
+                                                             true,
+                                                             "Graph View",
+                                                             "If enabled changes to a view keep the existing layout and only nets affected by the change are routed again. "
+                                                             "A full relayout can be triggered from the context menu of the view.");
     }
 
     GraphContext* GraphContextManager::createNewContext(const QString& name)
@@ -93,6 +100,14 @@ namespace hal
         mContextTableModel->removeContext(ctx);
         mContextTableModel->endRemoveContext();
 
+        if (ctx->getLayouter()->layoutRunning())
+        {
+            // layout is computed asynchronously, context gets deleted once it has stopped
+            ctx->mDeleteRequested = true;
+            ctx->getLayouter()->requestCancel();
+            return;
+        }
+
         delete ctx;
     }
 
@@ -187,14 +202,20 @@ namespace hal
     {
         for (GraphContext* context : mContextTableModel->list())
             if (context->modules().contains(m->get_id()))
+            {
+                context->getLayouter()->invalidateNode(Node(m->get_id(), Node::Module));
                 context->scheduleSceneUpdate();
+            }
     }
 
     void GraphContextManager::handleModuleTypeChanged(Module* m) const
     {
         for (GraphContext* context : mContextTableModel->list())
             if (context->modules().contains(m->get_id()))
+            {
+                context->getLayouter()->invalidateNode(Node(m->get_id(), Node::Module));
                 context->scheduleSceneUpdate();
+            }
     }
 
     void GraphContextManager::handleModuleColorChanged(Module* m) const
@@ -372,6 +393,7 @@ namespace hal
         for (GraphContext* context : mContextTableModel->list())
             if (context->modules().contains(m->get_id()))
             {
+                context->getLayouter()->invalidateNode(Node(m->get_id(), Node::Module));
                 context->updateNets();
                 context->scheduleSceneUpdate();
             }
@@ -388,7 +410,10 @@ namespace hal
     {
         for (GraphContext* context : mContextTableModel->list())
             if (context->gates().contains(g->get_id()))
+            {
+                context->getLayouter()->invalidateNode(Node(g->get_id(), Node::Gate));
                 context->scheduleSceneUpdate();
+            }
     }
 
     void GraphContextManager::handleNetCreated(Net* n) const
@@ -410,7 +435,10 @@ namespace hal
     {
         for (GraphContext* context : mContextTableModel->list())
             if (context->nets().contains(n->get_id()))
+            {
+                context->getLayouter()->invalidateNet(n->get_id());
                 context->scheduleSceneUpdate();
+            }
     }
 
     void GraphContextManager::handleNetSourceAdded(Net* n, const u32 src_gate_id) const
@@ -519,10 +547,12 @@ namespace hal
         layouter->setDumpJunctionEnabled(mSettingDumpJunction->value().toBool());
         layouter->setParseLayoutEnabled(mSettingParseLayout->value().toBool());
         layouter->setLayoutBoxesEnabled(mSettingLayoutBoxes->value().toBool());
+        layouter->setIncrementalLayoutEnabled(mSettingIncrementalLayout->value().toBool());
 
         connect(mSettingDumpJunction, &SettingsItemCheckbox::boolChanged, layouter, &GraphLayouter::setDumpJunctionEnabled);
         connect(mSettingParseLayout, &SettingsItemCheckbox::boolChanged, layouter, &StandardGraphLayouter::setParseLayoutEnabled);
         connect(mSettingLayoutBoxes, &SettingsItemCheckbox::boolChanged, layouter, &StandardGraphLayouter::setLayoutBoxesEnabled);
+        connect(mSettingIncrementalLayout, &SettingsItemCheckbox::boolChanged, layouter, &GraphLayouter::setIncrementalLayoutEnabled);
 
         return layouter;
     }
@@ -540,7 +570,15 @@ namespace hal
     void GraphContextManager::clear()
     {
         for (GraphContext* context : mContextTableModel->list())
-            delete context;
+        {
+            if (context->getLayouter()->layoutRunning())
+            {
+                context->mDeleteRequested = true;
+                context->getLayouter()->requestCancel();
+            }
+            else
+                delete context;
+        }
 
         mContextTableModel->clear();
     }
@@ -316,6 +316,13 @@ namespace hal
         GraphicsItem::setLod(lod);
         NodeDragShadow::setLod(lod);
 
+        GraphicsScene* s = static_cast<GraphicsScene*>(scene());
+        if (s)
+        {
+            s->updateOverviewMode(lod);
+            s->updateViewportItems(mapToScene(viewport()->rect()).boundingRect());
+        }
+
         StandardGraphicsModule::updateAlpha();
         StandardGraphicsGate::updateAlpha();
         StandardGraphicsNet::updateAlpha();
@@ -329,6 +336,14 @@ namespace hal
         if (event->button() != Qt::LeftButton)
             return;
 
+        GraphicsScene* s = static_cast<GraphicsScene*>(scene());
+        if (s && s->overviewMode())
+        {
+            // zoom into the tile to switch to detailed view
+            fitInView(s->overviewTileRect(mapToScene(event->pos())), Qt::KeepAspectRatio);
+            return;
+        }
+
         QGraphicsItem* item = itemAt(event->pos());
         if (!item) return;
 
@@ -642,7 +657,8 @@ namespace hal
         QMenu context_menu(this);
         QAction* action;
 
-        QGraphicsItem* item = itemAt(pos);
+        // items are hidden in overview mode and can only be found using the spatial index
+        QGraphicsItem* item = s->overviewMode() ? s->nodeItemAt(mapToScene(pos)) : itemAt(pos);
         bool isGate         = false;
         bool isModule       = false;
         bool isNet          = false;
@@ -862,6 +878,9 @@ namespace hal
                  action->setDisabled(true);
 
             QObject::connect(action, &QAction::triggered, this, &GraphGraphicsView::handleAddGateToView);
+
+            action = context_menu.addAction("Relayout view");
+            QObject::connect(action, &QAction::triggered, this, &GraphGraphicsView::handleRelayoutAction);
         }
 
 
@@ -1189,6 +1208,10 @@ namespace hal
         }
     }
 
+    void GraphGraphicsView::handleRelayoutAction()
+    {
+        mGraphWidget->getContext()->scheduleFullLayout();
+    }
 
     void GraphGraphicsView::handleAddSuccessorToView()
     {
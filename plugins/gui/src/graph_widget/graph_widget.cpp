@@ -92,6 +92,9 @@ namespace hal
 
     GraphWidget::~GraphWidget()
     {
+        // context might outlive view, e.g. when view is closed while layout is running
+        if (mContext)
+            mContext->setParentWidget(nullptr);
         sInstance = nullptr;
     }
 
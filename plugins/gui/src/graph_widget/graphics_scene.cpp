@@ -19,6 +19,8 @@
 #include <QGraphicsSceneMouseEvent>
 #include <QPainter>
 #include <QString>
+#include <algorithm>
+#include <cmath>
 
 #include <QDebug>
 
@@ -74,7 +76,7 @@ namespace hal
     }
 
     GraphicsScene::GraphicsScene(QObject* parent) : QGraphicsScene(parent),
-        mDragShadowGate(new NodeDragShadow()), mDebugGridEnable(false),
+        mDragShadowGate(new NodeDragShadow()), mOverviewMode(false), mSpatialIndexDirty(true), mMaxNodesPerTile(0), mNetSpatialIndexDirty(true), mPopulationDirty(true), mDebugGridEnable(false),
         mSelectionStatus(NotPressed)
     {
         // FIND OUT IF MANUAL CHANGE TO DEPTH IS NECESSARY / INCREASES PERFORMANCE
@@ -91,6 +93,18 @@ namespace hal
     GraphicsScene::~GraphicsScene()
     {
         disconnect(this, &QGraphicsScene::selectionChanged, this, &GraphicsScene::handleInternSelectionChanged);
+
+        // items detached by updateViewportItems are not known to the QGraphicsScene
+        for (GraphicsModule* gm : mModuleItems)
+            if (gm->scene() != this)
+                delete gm;
+        for (GraphicsGate* gg : mGateItems)
+            if (gg->scene() != this)
+                delete gg;
+        for (GraphicsNet* gn : mNetItems)
+            if (gn->scene() != this)
+                delete gn;
+
         for (QGraphicsItem* gi : items())
         {
             removeItem(gi);
@@ -127,50 +141,48 @@ namespace hal
         if (!item)
             return;
 
-        QGraphicsScene::addItem(item);
+        // items of large scenes far away from the visible area are attached once they get close to it
+        if (!isPopulatedLazily() || mPopulatedRect.isNull() || item->sceneBoundingRect().intersects(mPopulatedRect))
+            attachGraphItem(item);
+
+        // items detached by updateViewportItems are still owned by the scene and must not be registered twice,
+        // otherwise removeGraphItem would leave a dangling duplicate behind
+        if (ownsGraphItem(item))
+        {
+            if (item->itemType() == ItemType::Net)
+                mNetSpatialIndexDirty = true;
+            else
+                mSpatialIndexDirty = true;
+            mPopulationDirty = true;
+            return;
+        }
+
+        auto idLess = [](u32 id, const GraphicsItem* other) { return id < other->id(); };
 
         switch (item->itemType())
         {
         case ItemType::Gate:
         {
             GraphicsGate* g = static_cast<GraphicsGate*>(item);
-            int i = 0;
-            while (i < mGateItems.size())
-            {
-                if (g->id() < mGateItems.at(i)->id())
-                    break;
-
-                i++;
-            }
-            mGateItems.insert(i, g);
+            mGateItems.insert(std::upper_bound(mGateItems.begin(), mGateItems.end(), g->id(), idLess), g);
+            g->setVisible(!mOverviewMode);
+            mSpatialIndexDirty = true;
             return;
         }
         case ItemType::Net:
         {
             GraphicsNet* n = static_cast<GraphicsNet*>(item);
-            int i = 0;
-            while (i < mNetItems.size())
-            {
-                if (n->id() < mNetItems.at(i)->id())
-                    break;
-
-                i++;
-            }
-            mNetItems.insert(i, n);
+            mNetItems.insert(std::upper_bound(mNetItems.begin(), mNetItems.end(), n->id(), idLess), n);
+            n->setVisible(!mOverviewMode);
+            mNetSpatialIndexDirty = true;
             return;
         }
         case ItemType::Module:
         {
             GraphicsModule* m = static_cast<GraphicsModule*>(item);
-            int i = 0;
-            while (i < mModuleItems.size())
-            {
-                if (m->id() < mModuleItems.at(i)->id())
-                    break;
-
-                i++;
-            }
-            mModuleItems.insert(i, m);
+            mModuleItems.insert(std::upper_bound(mModuleItems.begin(), mModuleItems.end(), m->id(), idLess), m);
+            m->setVisible(!mOverviewMode);
+            mSpatialIndexDirty = true;
             return;
         }
         default:
@@ -178,6 +190,30 @@ namespace hal
         }
     }
 
+    bool GraphicsScene::ownsGraphItem(const GraphicsItem* item) const
+    {
+        // the item lists are sorted by ID, compare pointers since a net might be represented by more than one item
+        auto contains = [item](const auto& items) {
+            auto it = std::lower_bound(items.constBegin(), items.constEnd(), item->id(), [](const GraphicsItem* gi, u32 id) { return gi->id() < id; });
+            for (; it != items.constEnd() && (*it)->id() == item->id(); ++it)
+                if (*it == item)
+                    return true;
+            return false;
+        };
+
+        switch (item->itemType())
+        {
+        case ItemType::Gate:
+            return contains(mGateItems);
+        case ItemType::Net:
+            return contains(mNetItems);
+        case ItemType::Module:
+            return contains(mModuleItems);
+        default:
+            return false;
+        }
+    }
+
     void GraphicsScene::removeGraphItem(GraphicsItem* item)
     {
         // SELECTION HAS TO BE UPDATED MANUALLY AFTER ADDING / REMOVING ITEMS
@@ -185,7 +221,13 @@ namespace hal
         if (!item)
             return;
 
-        QGraphicsScene::removeItem(item);
+        if (item->scene() == this)
+            QGraphicsScene::removeItem(item);
+
+        if (item->itemType() == ItemType::Net)
+            mNetSpatialIndexDirty = true;
+        else
+            mSpatialIndexDirty = true;
 
         switch (item->itemType())
         {
@@ -212,12 +254,12 @@ namespace hal
         case ItemType::Net:
         {
             GraphicsNet* n = static_cast<GraphicsNet*>(item);
-            u32 id = n->id();
 
+            // compare pointers since a net might be represented by more than one item
             int i = 0;
             while (i < mNetItems.size())
             {
-                if (mNetItems.at(i)->id() == id)
+                if (mNetItems.at(i) == n)
                 {
                     mNetItems.remove(i);
                     delete n;
@@ -256,14 +298,10 @@ namespace hal
 
     const GraphicsGate* GraphicsScene::getGateItem(const u32 id) const
     {
-        for (const GraphicsGate* gg : mGateItems)
-        {
-            if (gg->id() > id)
-                break;
-
-            if (gg->id() == id)
-                return gg;
-        }
+        // items are sorted by ID
+        auto it = std::lower_bound(mGateItems.constBegin(), mGateItems.constEnd(), id, [](const GraphicsGate* gg, u32 id) { return gg->id() < id; });
+        if (it != mGateItems.constEnd() && (*it)->id() == id)
+            return *it;
 
         return nullptr;
     }
@@ -284,14 +322,10 @@ namespace hal
 
     const GraphicsModule* GraphicsScene::getModuleItem(const u32 id) const
     {
-        for (const GraphicsModule* gm : mModuleItems)
-        {
-            if (gm->id() > id)
-                break;
-
-            if (gm->id() == id)
-                return gm;
-        }
+        // items are sorted by ID
+        auto it = std::lower_bound(mModuleItems.constBegin(), mModuleItems.constEnd(), id, [](const GraphicsModule* gm, u32 id) { return gm->id() < id; });
+        if (it != mModuleItems.constEnd() && (*it)->id() == id)
+            return *it;
 
         return nullptr;
     }
@@ -308,8 +342,10 @@ namespace hal
         connect(gNetlistRelay, &NetlistRelay::groupingGateRemoved, this, &GraphicsScene::handleGroupingAssignGate);
         connect(gNetlistRelay, &NetlistRelay::groupingNetAssigned, this, &GraphicsScene::handleGroupingAssignNet);
         connect(gNetlistRelay, &NetlistRelay::groupingNetRemoved, this, &GraphicsScene::handleGroupingAssignNet);
-        connect(gContentManager->getGroupingManagerWidget()->getModel(),&GroupingTableModel::groupingColorChanged,
-                this, &GraphicsScene::handleGroupingColorChanged);
+        // scenes of headless layouts (benchmarks, tests) exist without content manager
+        if (gContentManager)
+            connect(gContentManager->getGroupingManagerWidget()->getModel(),&GroupingTableModel::groupingColorChanged,
+                    this, &GraphicsScene::handleGroupingColorChanged);
     }
 
     void GraphicsScene::disconnectAll()
@@ -324,8 +360,9 @@ namespace hal
         disconnect(gNetlistRelay, &NetlistRelay::groupingGateRemoved, this, &GraphicsScene::handleGroupingAssignGate);
         disconnect(gNetlistRelay, &NetlistRelay::groupingNetAssigned, this, &GraphicsScene::handleGroupingAssignNet);
         disconnect(gNetlistRelay, &NetlistRelay::groupingNetRemoved, this, &GraphicsScene::handleGroupingAssignNet);
-        disconnect(gContentManager->getGroupingManagerWidget()->getModel(),&GroupingTableModel::groupingColorChanged,
-                   this, &GraphicsScene::handleGroupingColorChanged);
+        if (gContentManager)
+            disconnect(gContentManager->getGroupingManagerWidget()->getModel(),&GroupingTableModel::groupingColorChanged,
+                       this, &GraphicsScene::handleGroupingColorChanged);
     }
 
     void GraphicsScene::deleteAllItems()
@@ -345,6 +382,10 @@ namespace hal
         mModuleItems.clear();
         mGateItems.clear();
         mNetItems.clear();
+        mSpatialIndexDirty = true;
+        mNetSpatialIndexDirty = true;
+        mPopulatedRect = QRectF();
+        mPopulationDirty = true;
         GraphicsQssAdapter::instance()->repolish();
     }
 
@@ -364,6 +405,252 @@ namespace hal
         {
             gn->setVisuals(s.mNetVisuals.value(gn->id()));
         }
+
+        // visuals reset the visibility of items
+        if (mOverviewMode)
+            applyOverviewVisibility();
+    }
+
+    void GraphicsScene::updateOverviewMode(qreal lod)
+    {
+        bool overview = lod < graph_widget_constants::sOverviewMaxLod
+                && mGateItems.size() + mModuleItems.size() + mNetItems.size() >= graph_widget_constants::sOverviewMinItems;
+        if (overview == mOverviewMode)
+            return;
+
+        mOverviewMode = overview;
+        applyOverviewVisibility();
+
+        // hidden items cannot be selected, restore selection when items become visible again
+        if (!mOverviewMode)
+            handleExternSelectionChanged(nullptr);
+        update();
+    }
+
+    bool GraphicsScene::overviewMode() const
+    {
+        return mOverviewMode;
+    }
+
+    void GraphicsScene::applyOverviewVisibility()
+    {
+        // hiding selected items must not clear the selection
+        bool original_value = blockSignals(true);
+
+        for (GraphicsModule* gm : mModuleItems)
+            gm->setVisible(!mOverviewMode);
+        for (GraphicsGate* gg : mGateItems)
+            gg->setVisible(!mOverviewMode);
+        for (GraphicsNet* gn : mNetItems)
+            gn->setVisible(!mOverviewMode);
+
+        blockSignals(original_value);
+    }
+
+    void GraphicsScene::invalidateSpatialIndex()
+    {
+        mSpatialIndexDirty = true;
+        mNetSpatialIndexDirty = true;
+        mPopulationDirty = true;
+    }
+
+    bool GraphicsScene::isPopulatedLazily() const
+    {
+        return mGateItems.size() + mModuleItems.size() + mNetItems.size() >= graph_widget_constants::sViewportPopulationMinItems;
+    }
+
+    void GraphicsScene::attachGraphItem(GraphicsItem* item)
+    {
+        if (item->scene() != this)
+            QGraphicsScene::addItem(item);
+    }
+
+    void GraphicsScene::updateViewportItems(const QRectF& visibleRect)
+    {
+        // all items are hidden in overview mode anyway
+        if (mOverviewMode)
+            return;
+
+        if (!isPopulatedLazily())
+        {
+            if (!mPopulatedRect.isNull())
+            {
+                for (GraphicsModule* gm : mModuleItems)
+                    attachGraphItem(gm);
+                for (GraphicsGate* gg : mGateItems)
+                    attachGraphItem(gg);
+                for (GraphicsNet* gn : mNetItems)
+                    attachGraphItem(gn);
+                mPopulatedRect = QRectF();
+            }
+            return;
+        }
+
+        if (!mPopulationDirty && mPopulatedRect.contains(visibleRect))
+            return;
+
+        // attach a margin of one visible area in each direction so that panning does not require an update for every frame
+        mPopulatedRect = visibleRect.adjusted(-visibleRect.width(), -visibleRect.height(), visibleRect.width(), visibleRect.height());
+        mPopulationDirty = false;
+
+        // only attached items need to be checked for being out of range, the QGraphicsScene knows them without visiting detached ones
+        for (QGraphicsItem* qgi : items())
+        {
+            GraphicsItem* item = dynamic_cast<GraphicsItem*>(qgi);
+            if (item && !item->isSelected() && !item->sceneBoundingRect().intersects(mPopulatedRect))
+                QGraphicsScene::removeItem(item);
+        }
+
+        if (mSpatialIndexDirty)
+            buildSpatialIndex();
+        if (mNetSpatialIndexDirty)
+            buildNetSpatialIndex();
+
+        auto populate = [this](GraphicsItem* item) {
+            if (item->sceneBoundingRect().intersects(mPopulatedRect))
+                attachGraphItem(item);
+        };
+
+        forEachTile(mSpatialIndex, mPopulatedRect, [&populate](int, int, const QVector<GraphicsNode*>& tile) {
+            for (GraphicsNode* node : tile)
+                populate(node);
+        });
+        forEachTile(mNetSpatialIndex, mPopulatedRect, [&populate](int, int, const QVector<GraphicsNet*>& tile) {
+            for (GraphicsNet* net : tile)
+                populate(net);
+        });
+        for (GraphicsNet* gn : mWideNetItems)
+            populate(gn);
+    }
+
+    QRectF GraphicsScene::graphItemsBoundingRect() const
+    {
+        QRectF rect = itemsBoundingRect();
+        for (const GraphicsModule* gm : mModuleItems)
+            rect |= gm->sceneBoundingRect();
+        for (const GraphicsGate* gg : mGateItems)
+            rect |= gg->sceneBoundingRect();
+        for (const GraphicsNet* gn : mNetItems)
+            rect |= gn->sceneBoundingRect();
+        return rect;
+    }
+
+    quint64 GraphicsScene::tileKey(int ix, int iy)
+    {
+        return (((quint64)(quint32) ix) << 32) | (quint32) iy;
+    }
+
+    template<typename T, typename F>
+    void GraphicsScene::forEachTile(const QHash<quint64, QVector<T*>>& index, const QRectF& rect, F func)
+    {
+        const int tileSize = graph_widget_constants::sOverviewTileSize;
+        const int ix0 = std::floor(rect.left() / tileSize);
+        const int ix1 = std::floor(rect.right() / tileSize);
+        const int iy0 = std::floor(rect.top() / tileSize);
+        const int iy1 = std::floor(rect.bottom() / tileSize);
+
+        // iterate over the occupied tiles instead if there are fewer of them than tiles within the rectangle
+        if ((qint64)(ix1 - ix0 + 1) * (iy1 - iy0 + 1) > index.size())
+        {
+            for (auto it = index.constBegin(); it != index.constEnd(); ++it)
+            {
+                int ix = (qint32)(it.key() >> 32);
+                int iy = (qint32)(it.key() & 0xFFFFFFFF);
+                if (ix >= ix0 && ix <= ix1 && iy >= iy0 && iy <= iy1)
+                    func(ix, iy, it.value());
+            }
+        }
+        else
+        {
+            for (int ix = ix0; ix <= ix1; ix++)
+                for (int iy = iy0; iy <= iy1; iy++)
+                {
+                    auto it = index.constFind(tileKey(ix, iy));
+                    if (it != index.constEnd())
+                        func(ix, iy, it.value());
+                }
+        }
+    }
+
+    QRectF GraphicsScene::overviewTileRect(const QPointF& pos) const
+    {
+        const int tileSize = graph_widget_constants::sOverviewTileSize;
+        return QRectF(std::floor(pos.x() / tileSize) * tileSize, std::floor(pos.y() / tileSize) * tileSize, tileSize, tileSize);
+    }
+
+    void GraphicsScene::buildSpatialIndex()
+    {
+        const int tileSize = graph_widget_constants::sOverviewTileSize;
+
+        mSpatialIndex.clear();
+        mMaxNodesPerTile = 0;
+
+        auto insertNode = [this, tileSize](GraphicsNode* node) {
+            // nodes are registered in every tile they overlap
+            QRectF r = node->sceneBoundingRect();
+            for (int ix = std::floor(r.left() / tileSize); ix <= std::floor(r.right() / tileSize); ix++)
+                for (int iy = std::floor(r.top() / tileSize); iy <= std::floor(r.bottom() / tileSize); iy++)
+                {
+                    QVector<GraphicsNode*>& tile = mSpatialIndex[tileKey(ix, iy)];
+                    tile.append(node);
+                    if (tile.size() > mMaxNodesPerTile)
+                        mMaxNodesPerTile = tile.size();
+                }
+        };
+
+        for (GraphicsModule* gm : mModuleItems)
+            insertNode(gm);
+        for (GraphicsGate* gg : mGateItems)
+            insertNode(gg);
+
+        mSpatialIndexDirty = false;
+    }
+
+    void GraphicsScene::buildNetSpatialIndex()
+    {
+        const int tileSize = graph_widget_constants::sOverviewTileSize;
+
+        mNetSpatialIndex.clear();
+        mWideNetItems.clear();
+
+        for (GraphicsNet* gn : mNetItems)
+        {
+            QRectF r = gn->sceneBoundingRect();
+            const int ix0 = std::floor(r.left() / tileSize);
+            const int ix1 = std::floor(r.right() / tileSize);
+            const int iy0 = std::floor(r.top() / tileSize);
+            const int iy1 = std::floor(r.bottom() / tileSize);
+
+            // long nets would be registered in a huge number of tiles
+            if ((qint64)(ix1 - ix0 + 1) * (iy1 - iy0 + 1) > graph_widget_constants::sViewportNetMaxTiles)
+            {
+                mWideNetItems.append(gn);
+                continue;
+            }
+
+            for (int ix = ix0; ix <= ix1; ix++)
+                for (int iy = iy0; iy <= iy1; iy++)
+                    mNetSpatialIndex[tileKey(ix, iy)].append(gn);
+        }
+
+        mNetSpatialIndexDirty = false;
+    }
+
+    GraphicsNode* GraphicsScene::nodeItemAt(const QPointF& pos)
+    {
+        if (mSpatialIndexDirty)
+            buildSpatialIndex();
+
+        const int tileSize = graph_widget_constants::sOverviewTileSize;
+        auto it = mSpatialIndex.constFind(tileKey(std::floor(pos.x() / tileSize), std::floor(pos.y() / tileSize)));
+        if (it == mSpatialIndex.constEnd())
+            return nullptr;
+
+        for (GraphicsNode* node : it.value())
+            if (node->sceneBoundingRect().contains(pos))
+                return node;
+
+        return nullptr;
     }
 
     void GraphicsScene::moveNetsToBackground()
@@ -535,27 +822,27 @@ namespace hal
 
         clearSelection();
 
-        if (gSelectionRelay->numberSelectedModules())
+        // look up selected nodes by ID instead of testing every item of large scenes
+        for (u32 id : gSelectionRelay->selectedModules())
         {
-            for (GraphicsModule* gm : mModuleItems)
+            GraphicsModule* gm = (GraphicsModule*) getModuleItem(id);
+            if (gm)
             {
-                if (gSelectionRelay->isModuleSelected(gm->id()))
-                {
-                    gm->setSelected(true);
-                    gm->update();
-                }
+                // only attached items are part of the selection of the QGraphicsScene
+                attachGraphItem(gm);
+                gm->setSelected(true);
+                gm->update();
             }
         }
 
-        if (gSelectionRelay->numberSelectedGates())
+        for (u32 id : gSelectionRelay->selectedGates())
         {
-            for (GraphicsGate* gg : mGateItems)
+            GraphicsGate* gg = (GraphicsGate*) getGateItem(id);
+            if (gg)
             {
-                if (gSelectionRelay->isGateSelected(gg->id()))
-                {
-                    gg->setSelected(true);
-                    gg->update();
-                }
+                attachGraphItem(gg);
+                gg->setSelected(true);
+                gg->update();
             }
         }
 
@@ -565,6 +852,7 @@ namespace hal
             {
                 if (gSelectionRelay->isNetSelected(gn->id()))
                 {
+                    attachGraphItem(gn);
                     gn->setSelected(true);
                     gn->update();
                 }
@@ -591,6 +879,36 @@ namespace hal
         QGraphicsScene::mousePressEvent(event);
     }
 
+    void GraphicsScene::drawForeground(QPainter* painter, const QRectF& rect)
+    {
+        if (!mOverviewMode)
+            return;
+
+        if (mSpatialIndexDirty)
+            buildSpatialIndex();
+
+        if (mSpatialIndex.isEmpty())
+            return;
+
+        const int tileSize = graph_widget_constants::sOverviewTileSize;
+
+        // tile opacity represents the number of nodes within the tile
+        QColor tileColor = GraphicsQssAdapter::instance()->gateBaseColor();
+        forEachTile(mSpatialIndex, rect, [&](int ix, int iy, const QVector<GraphicsNode*>& tile) {
+            tileColor.setAlpha(40 + 215 * tile.size() / mMaxNodesPerTile);
+            painter->fillRect(QRectF(ix * tileSize, iy * tileSize, tileSize, tileSize), tileColor);
+        });
+
+        // selected nodes stay visible as solid boxes
+        QColor selColor = GraphicsQssAdapter::instance()->gateSelectionColor();
+        for (u32 id : gSelectionRelay->selectedModules())
+            if (const GraphicsModule* gm = getModuleItem(id))
+                painter->fillRect(gm->sceneBoundingRect(), selColor);
+        for (u32 id : gSelectionRelay->selectedGates())
+            if (const GraphicsGate* gg = getGateItem(id))
+                painter->fillRect(gg->sceneBoundingRect(), selColor);
+    }
+
     void GraphicsScene::drawBackground(QPainter* painter, const QRectF& rect)
     {
         if (!sGridEnabled)
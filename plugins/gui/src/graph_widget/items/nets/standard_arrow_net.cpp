@@ -10,7 +10,8 @@ namespace hal
     {
         mArrowNet.addInput(pos);
         QRectF r = mArrowNet.shape().boundingRect();
-        mShape.addPath(mArrowNet.shape());
+        if (scene())
+            mShape.addPath(mArrowNet.shape());
         mRect = mRect.united(r);
     }
 
@@ -18,10 +19,17 @@ namespace hal
     {
         mArrowNet.addOutput(pos);
         QRectF r = mArrowNet.shape().boundingRect();
-        mShape.addPath(mArrowNet.shape());
+        if (scene())
+            mShape.addPath(mArrowNet.shape());
         mRect = mRect.united(r);
     }
 
+    void StandardArrowNet::buildShape()
+    {
+        StandardGraphicsNet::buildShape();
+        mShape.addPath(mArrowNet.shape());
+    }
+
     void StandardArrowNet::paint(QPainter* painter,
                                  const QStyleOptionGraphicsItem* option,
                                  QWidget* widget)
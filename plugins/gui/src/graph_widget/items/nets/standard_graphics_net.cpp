@@ -79,10 +79,7 @@ namespace hal
     StandardGraphicsNet::StandardGraphicsNet(Net* n, const Lines& l, const QList<QPointF> &knots) : GraphicsNet(n)
     {
         for (const QPointF& point : knots)
-        {
             mSplits.append(point);
-            mShape.addEllipse(point, sSplitRadius, sSplitRadius);
-        }
 
         qreal smallest_x = std::numeric_limits<qreal>::max();
         qreal biggest_x  = std::numeric_limits<qreal>::min();
@@ -103,10 +100,7 @@ namespace hal
             if (h.y > biggest_y)
                 biggest_y = h.y;
 
-            QLineF line(h.mSmallX, h.y, h.mBigX, h.y);
-            mLines.append(line);
-            QRectF rect(h.mSmallX - sShapeWidth / 2, h.y - sShapeWidth / 2, h.mBigX - h.mSmallX + sShapeWidth, sShapeWidth);
-            mShape.addRect(rect);
+            mLines.append(QLineF(h.mSmallX, h.y, h.mBigX, h.y));
         }
 
         for (const VLine& v : l.mVLines)
@@ -122,10 +116,7 @@ namespace hal
             if (v.mBigY > biggest_y)
                 biggest_y = v.mBigY;
 
-            QLineF line(v.x, v.mSmallY, v.x, v.mBigY);
-            mLines.append(line);
-            QRectF rect(v.x - sShapeWidth / 2, v.mSmallY - sShapeWidth / 2, sShapeWidth, v.mBigY - v.mSmallY + sShapeWidth);
-            mShape.addRect(rect);
+            mLines.append(QLineF(v.x, v.mSmallY, v.x, v.mBigY));
         }
 
         const qreal padding = sSplitRadius + sShapeWidth;
@@ -133,6 +124,27 @@ namespace hal
         mRect = QRectF(smallest_x - padding, smallest_y - padding, biggest_x - smallest_x + padding, biggest_y - smallest_y + padding);
     }
 
+    void StandardGraphicsNet::buildShape()
+    {
+        for (const QPointF& point : mSplits)
+            mShape.addEllipse(point, sSplitRadius, sSplitRadius);
+
+        // lines are either horizontal or vertical and start at their smaller coordinate
+        for (const QLineF& line : mLines)
+            mShape.addRect(QRectF(line.x1() - sShapeWidth / 2, line.y1() - sShapeWidth / 2, line.x2() - line.x1() + sShapeWidth, line.y2() - line.y1() + sShapeWidth));
+    }
+
+    QVariant StandardGraphicsNet::itemChange(GraphicsItemChange change, const QVariant& value)
+    {
+        if (change == ItemSceneChange)
+        {
+            mShape = QPainterPath();
+            if (value.value<QGraphicsScene*>())
+                buildShape();
+        }
+        return GraphicsNet::itemChange(change, value);
+    }
+
     void StandardGraphicsNet::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
     {
         Q_UNUSED(widget);
@@ -164,7 +164,7 @@ void StandardGraphicsGate::paint(QPainter* painter, const QStyleOptionGraphicsIt
                 QColor pinTextColor = penColor(option->state,sTextColor);
                 if (inpNetId)
                 {
-                    if (gGraphContextManager->sSettingNetGroupingToPins->value().toBool())
+                    if (gContentManager && gGraphContextManager->sSettingNetGroupingToPins->value().toBool())
                     {
                         QColor pinBackground = gContentManager->getGroupingManagerWidget()->getModel()->colorForItem(ItemType::Net, inpNetId);
                         if (pinBackground.isValid())
@@ -200,7 +200,7 @@ void StandardGraphicsGate::paint(QPainter* painter, const QStyleOptionGraphicsIt
                 QColor pinTextColor = penColor(option->state,sTextColor);
                 if (outNetId)
                 {
-                    if (gGraphContextManager->sSettingNetGroupingToPins->value().toBool())
+                    if (gContentManager && gGraphContextManager->sSettingNetGroupingToPins->value().toBool())
                     {
                         QColor pinBackground = gContentManager->getGroupingManagerWidget()->getModel()->colorForItem(ItemType::Net, outNets.at(i));
                         if (pinBackground.isValid())
@@ -19,8 +19,8 @@
 #include "hal_core/netlist/net.h"
 
 #include <QDebug>
-#include <QApplication>
-#include <QElapsedTimer>
+#include <QTimer>
+#include <QtConcurrent>
 #include <qmath.h>
 
 namespace hal
@@ -41,10 +41,18 @@ namespace hal
     const static qreal sMinimumVChannelWidth  = 20;
     const static qreal sMinimumHChannelHeight = 20;
 
+    // GUI thread work per layout step before the event loop gets control back
+    const static qint64 sLayoutStepMs     = 20;
+    const static int sPlacementRegionSize = 16;
+
     GraphLayouter::GraphLayouter(GraphContext* context, QObject* parent)
-        : QObject(parent), mScene(new GraphicsScene(this)), mParentContext(context), mDone(false), mRollbackStatus(0), mDumpJunctions(false)
+        : QObject(parent), mScene(new GraphicsScene(this)), mParentContext(context), mDone(false), mRollbackStatus(0), mDumpJunctions(false),
+          mCoordArrayX(nullptr), mCoordArrayY(nullptr), mIncrementalLayout(false), mIncrementalEnabled(true), mFullLayoutRequired(false), mLayoutRunning(false),
+          mCancelRequested(false), mLayoutStage(StageIdle), mStepScheduled(false), mStepIndex(0), mNetsDone(0)
     {
-        SelectionDetailsWidget* details = gContentManager->getSelectionDetailsWidget();
+        connect(&mWorker, &QFutureWatcher<void>::finished, this, &GraphLayouter::continueLayout);
+
+        SelectionDetailsWidget* details = gContentManager ? gContentManager->getSelectionDetailsWidget() : nullptr;
         if (details)
             connect(details, &SelectionDetailsWidget::triggerHighlight, mScene, &GraphicsScene::handleHighlight);
 
@@ -55,6 +63,14 @@ namespace hal
 
     GraphLayouter::~GraphLayouter()
     {
+        // worker and threads access layout data
+        mWorker.waitForFinished();
+        for (JunctionThread* jt : mJunctionThreads)
+            jt->wait();
+        for (DrawNetThread* dnt : mDrawNetThreads)
+            dnt->wait();
+        deleteCoordArrays();
+        mPreviousJunctionHash.clearAll();
         mScene->deleteLater();
     }
 
@@ -215,33 +231,149 @@ namespace hal
     {
         if (mDumpJunctions)
             NetLayoutJunctionEntries::resetFile();
-        QElapsedTimer timer;
-        timer.start();
+        mLayoutTimer.start();
+        mLayoutRunning   = true;
+        mCancelRequested = false;
         mParentContext->layoutProgress(0);
-        mScene->deleteAllItems();
+
+        // net list might change while events are processed during layout
+        mNetsSnapshot = mParentContext->nets();
+
+        mIncrementalLayout  = mIncrementalEnabled && !mFullLayoutRequired && mDone;
+        mFullLayoutRequired = false;
+        if (mIncrementalLayout)
+        {
+            // keep graphics items and junctions of previous layout, they get reused unless affected by changes
+            mChangedPoints.clear();
+            for (const NodeBox* box : mBoxes)
+            {
+                if (mInvalidNodes.contains(box->getNode()))
+                {
+                    mChangedPoints.insert(NetLayoutPoint(box->x(), 2 * box->y()));
+                    mChangedPoints.insert(NetLayoutPoint(box->x() + 1, 2 * box->y()));
+                    mScene->removeGraphItem(box->item());
+                    continue;
+                }
+                mPreviousNodeItems.insert(box->getNode(), box->item());
+                mPreviousNodePositions.insert(box->getNode(), box->gridPosition());
+            }
+            mPreviousJunctionEntries.swap(mJunctionEntries);
+            mPreviousJunctionHash.swap(mJunctionHash);
+        }
+        else
+        {
+            mScene->deleteAllItems();
+            discardPreviousLayout();
+        }
+        mInvalidNodes.clear();
         clearLayoutData();
 
-        createBoxes();
+        mPendingPositions = mPositionToNodeMap.keys();
+        mStepIndex        = 0;
+        mLayoutStage      = StageCreateBoxes;
+        scheduleLayoutStep();
+    }
 
-        mParentContext->layoutProgress(1);
-        getWireHash();
+    void GraphLayouter::scheduleLayoutStep()
+    {
+        // at most one step is queued, further requests are served by it
+        if (mStepScheduled)
+            return;
+        mStepScheduled = true;
+        QTimer::singleShot(0, this, &GraphLayouter::continueLayout);
+    }
 
-        mParentContext->layoutProgress(2);
-        findMaxBoxDimensions();
-        mParentContext->layoutProgress(3);
-        findMaxChannelLanes();
-        mParentContext->layoutProgress(4);
-        calculateJunctionMinDistance();
-        mParentContext->layoutProgress(5);
-        calculateGateOffsets();
-        mParentContext->layoutProgress(6);
+    void GraphLayouter::continueLayout()
+    {
+        mStepScheduled = false;
+        if (mLayoutStage == StageIdle)
+            return;
 
-        mCoordArrayX = new SceneCoordinateArray(mCoordX);
-        mCoordArrayY = new SceneCoordinateArray(mCoordY);
+        if (mCancelRequested)
+        {
+            // running threads access layout data, last one to finish schedules the next step
+            if (mJunctionThreads.isEmpty() && mDrawNetThreads.isEmpty())
+                cancelLayout();
+            return;
+        }
 
-        placeGates();
-        mParentContext->layoutProgress(7);
-        drawNets();
+        switch (mLayoutStage)
+        {
+            case StageCreateBoxes:
+                if (createBoxes())
+                {
+                    mParentContext->layoutProgress(1);
+                    mNetQueue    = mNetsSnapshot.values();
+                    mStepIndex   = 0;
+                    mLayoutStage = StageScanNets;
+                }
+                scheduleLayoutStep();
+                break;
+            case StageScanNets:
+                if (!scanNets())
+                {
+                    scheduleLayoutStep();
+                    break;
+                }
+                // routing does not depend on netlist or graphics items, thus it is computed in worker thread
+                mLayoutStage = StageRouteNets;
+                mWorker.setFuture(QtConcurrent::run([this]() { routeNets(); }));
+                break;
+            case StageRouteNets:
+                collectEndpoints();
+                mJunctionIterator = mJunctionEntries.constBegin();
+                mLayoutStage      = StageRouteJunctions;
+                scheduleLayoutStep();
+                break;
+            case StageRouteJunctions:
+                if (!routeJunctions())
+                    break;
+                mPreviousJunctionHash.clearAll();
+                mPreviousJunctionEntries.clear();
+
+                // pure grid computations, item geometry is only read
+                mParentContext->layoutProgress(2);
+                mLayoutStage = StageComputeGrid;
+                mWorker.setFuture(QtConcurrent::run([this]() {
+                    findMaxBoxDimensions();
+                    findMaxChannelLanes();
+                    calculateJunctionMinDistance();
+                    calculateGateOffsets();
+                }));
+                break;
+            case StageComputeGrid:
+                mParentContext->layoutProgress(6);
+                mCoordArrayX = new SceneCoordinateArray(mCoordX);
+                mCoordArrayY = new SceneCoordinateArray(mCoordY);
+                collectPlacementRegions();
+                mLayoutStage = StagePlaceGates;
+                scheduleLayoutStep();
+                break;
+            case StagePlaceGates:
+                if (!placeGates())
+                {
+                    scheduleLayoutStep();
+                    break;
+                }
+                mScene->invalidateSpatialIndex();
+                updateSceneRect();
+                mParentContext->layoutBoxesPlaced();
+                mParentContext->layoutProgress(7);
+                prepareDrawNets();
+                mLayoutStage = StageDrawNets;
+                scheduleLayoutStep();
+                break;
+            case StageDrawNets:
+                if (drawNets())
+                    finishLayout();
+                break;
+            default:
+                break;
+        }
+    }
+
+    void GraphLayouter::finishLayout()
+    {
         drawComments();
         updateSceneRect();
 
@@ -253,11 +385,85 @@ namespace hal
 #endif
         mRollbackStatus = 0;
 
-        qDebug() << "elapsed time (experimental new) layout [ms]" << timer.elapsed();
+        qDebug() << "elapsed time (experimental new) layout [ms]" << mLayoutTimer.elapsed();
+
+        deleteCoordArrays();
+        mInvalidNets.clear();
+        mDone          = true;
+        mLayoutStage   = StageIdle;
+        mLayoutRunning = false;
+        Q_EMIT layoutFinished();
+    }
+
+    void GraphLayouter::cancelLayout()
+    {
+        // scene is incomplete and cannot serve as base for an incremental layout
+        mCancelRequested    = false;
+        mFullLayoutRequired = true;
+        mInvalidNets.clear();
+        mPreviousJunctionHash.clearAll();
+        mPreviousJunctionEntries.clear();
+        mPlacementRegions.clear();
+        deleteCoordArrays();
+        mLayoutStage   = StageIdle;
+        mLayoutRunning = false;
+        Q_EMIT layoutFinished();
+    }
 
+    void GraphLayouter::deleteCoordArrays()
+    {
         delete mCoordArrayX;
         delete mCoordArrayY;
-        mDone = true;
+        mCoordArrayX = nullptr;
+        mCoordArrayY = nullptr;
+    }
+
+    void GraphLayouter::requestCancel()
+    {
+        if (mLayoutRunning)
+            mCancelRequested = true;
+    }
+
+    bool GraphLayouter::layoutRunning() const
+    {
+        return mLayoutRunning;
+    }
+
+    void GraphLayouter::discardPreviousLayout()
+    {
+        mPreviousNodeItems.clear();
+        mPreviousNodePositions.clear();
+        mPreviousJunctionEntries.clear();
+        mPreviousJunctionHash.clearAll();
+        mChangedPoints.clear();
+        mNetItems.clear();
+        mNetSignatures.clear();
+        mInvalidNets.clear();
+    }
+
+    void GraphLayouter::requestFullLayout()
+    {
+        mFullLayoutRequired = true;
+    }
+
+    void GraphLayouter::invalidateNode(const Node& nd)
+    {
+        mInvalidNodes.insert(nd);
+    }
+
+    void GraphLayouter::invalidateNet(u32 netId)
+    {
+        mInvalidNets.insert(netId);
+    }
+
+    bool GraphLayouter::incrementalLayoutEnabled() const
+    {
+        return mIncrementalEnabled;
+    }
+
+    void GraphLayouter::setIncrementalLayoutEnabled(bool enabled)
+    {
+        mIncrementalEnabled = enabled;
     }
 
     void GraphLayouter::prepareRollback()
@@ -328,6 +534,7 @@ namespace hal
         mWireHash.clear();
         mJunctionEntries.clear();
         mSeparatedWidth.clear();
+        mRoutedNets.clear();
         mCoordX.clear();
         mCoordY.clear();
         mJunctionMinDistanceY.clear();
@@ -341,16 +548,42 @@ namespace hal
         mLaneMap.clear();
     }
 
-    void GraphLayouter::createBoxes()
+    bool GraphLayouter::createBoxes()
     {
+        QElapsedTimer slice;
+        slice.start();
+        while (mStepIndex < mPendingPositions.size())
+        {
+            const QPoint& pos = mPendingPositions.at(mStepIndex++);
+            const Node nd     = mPositionToNodeMap.value(pos);
+            int x             = pos.x();
+            int y             = pos.y();
+
+            GraphicsNode* item = nullptr;
+            if (mIncrementalLayout)
+            {
+                item = mPreviousNodeItems.take(nd);
+                auto itPrevious = mPreviousNodePositions.constFind(nd);
+                if (!item || itPrevious == mPreviousNodePositions.constEnd() || itPrevious.value() != pos)
+                {
+                    // endpoints of new or moved boxes need to be routed again
+                    mChangedPoints.insert(NetLayoutPoint(x, 2 * y));
+                    mChangedPoints.insert(NetLayoutPoint(x + 1, 2 * y));
+                }
+            }
+            mBoxes.addBox(nd, x, y, item);
+            if (slice.elapsed() >= sLayoutStepMs)
+                return false;
+        }
+        mPendingPositions.clear();
+
         bool first = true;
         int xmin, xmax, ymin, ymax;
-        xmin = ymin = xmax = ymax            = 0;
-        QMap<QPoint, Node>::const_iterator i = positionToNodeMap().constBegin();
-        while (i != positionToNodeMap().constEnd())
+        xmin = ymin = xmax = ymax = 0;
+        for (const NodeBox* box : mBoxes)
         {
-            int x = i.key().x();
-            int y = i.key().y();
+            int x = box->x();
+            int y = box->y();
             if (first || x + 1 > xmax)
                 xmax = x + 1;
             if (first || y + 1 > ymax)
@@ -360,10 +593,20 @@ namespace hal
             if (first || y < ymin)
                 ymin = y;
             first = false;
-            mBoxes.addBox(i.value(), x, y);
-            ++i;
         }
         mNodeBoundingBox = QRect(xmin, ymin, xmax - xmin, ymax - ymin);
+
+        // remaining items belong to nodes that have been removed from view
+        for (auto it = mPreviousNodeItems.constBegin(); it != mPreviousNodeItems.constEnd(); ++it)
+        {
+            QPoint p = mPreviousNodePositions.value(it.key());
+            mChangedPoints.insert(NetLayoutPoint(p.x(), 2 * p.y()));
+            mChangedPoints.insert(NetLayoutPoint(p.x() + 1, 2 * p.y()));
+            mScene->removeGraphItem(it.value());
+        }
+        mPreviousNodeItems.clear();
+        mPreviousNodePositions.clear();
+        return true;
     }
 
     bool GraphLayouter::verifyModulePort(Net* n, const Node& modNode, bool isModInput)
@@ -410,123 +653,141 @@ namespace hal
         drawComments();
     }
 
-    void GraphLayouter::getWireHash()
+    bool GraphLayouter::scanNets()
     {
-        for (const u32 id : mParentContext->nets())
+        QElapsedTimer slice;
+        slice.start();
+        while (mStepIndex < mNetQueue.size())
         {
-            qApp->processEvents(QEventLoop::AllEvents, 100);
-            Net* n = gNetlist->get_net_by_id(id);
-            if (!n)
-                continue;
+            scanNet(mNetQueue.at(mStepIndex++));
+            if (slice.elapsed() >= sLayoutStepMs)
+                return false;
+        }
+        mNetQueue.clear();
+        return true;
+    }
+
+    void GraphLayouter::scanNet(u32 id)
+    {
+        Net* n = gNetlist->get_net_by_id(id);
+        if (!n)
+            return;
 
-            QSet<NetLayoutPoint> srcPoints;
-            QSet<NetLayoutPoint> dstPoints;
+        QSet<NetLayoutPoint> srcPoints;
+        QSet<NetLayoutPoint> dstPoints;
 
-            mWireEndpoint[id] = EndpointList();
+        mWireEndpoint[id] = EndpointList();
 
-            for (const Endpoint* src : n->get_sources())
+        for (const Endpoint* src : n->get_sources())
+        {
+            // FIND SRC BOX
+            const NodeBox* srcBox = mBoxes.boxForGate(src->get_gate());
+            if (!srcBox)
             {
-                // FIND SRC BOX
-                const NodeBox* srcBox = mBoxes.boxForGate(src->get_gate());
-                if (!srcBox)
-                {
-                    // not among visible boxes
-                    mViewInput.insert(n->get_id());
-                    continue;
-                }
+                // not among visible boxes
+                mViewInput.insert(n->get_id());
+                continue;
+            }
 
-                if (!verifyModulePort(n, srcBox->getNode(), false))
-                    continue;
+            if (!verifyModulePort(n, srcBox->getNode(), false))
+                continue;
 
-                NetLayoutPoint srcPnt(srcBox->x() + 1, 2 * srcBox->y());
-                srcPoints.insert(srcPnt);
-                mWireEndpoint[id].addSource(srcPnt);
-            }
+            NetLayoutPoint srcPnt(srcBox->x() + 1, 2 * srcBox->y());
+            srcPoints.insert(srcPnt);
+            mWireEndpoint[id].addSource(srcPnt);
+        }
 
-            for (const Endpoint* dst : n->get_destinations())
+        for (const Endpoint* dst : n->get_destinations())
+        {
+            // find dst box
+            const NodeBox* dstBox = mBoxes.boxForGate(dst->get_gate());
+            if (!dstBox)
             {
-                // find dst box
-                const NodeBox* dstBox = mBoxes.boxForGate(dst->get_gate());
-                if (!dstBox)
-                {
-                    // not among visible boxes
-                    mViewOutput.insert(n->get_id());
-                    continue;
-                }
+                // not among visible boxes
+                mViewOutput.insert(n->get_id());
+                continue;
+            }
 
-                if (!verifyModulePort(n, dstBox->getNode(), true))
-                    continue;
+            if (!verifyModulePort(n, dstBox->getNode(), true))
+                continue;
 
-                NetLayoutPoint dstPnt(dstBox->x(), 2 * dstBox->y());
-                dstPoints.insert(dstPnt);
-                mWireEndpoint[id].addDestination(dstPnt);
-            }
+            NetLayoutPoint dstPnt(dstBox->x(), 2 * dstBox->y());
+            dstPoints.insert(dstPnt);
+            mWireEndpoint[id].addDestination(dstPnt);
+        }
 
-            if (isConstNet(n))
-                mWireEndpoint[id].setNetType(EndpointList::ConstantLevel);
+        if (isConstNet(n))
+            mWireEndpoint[id].setNetType(EndpointList::ConstantLevel);
 
-            // test for global inputs
-            EndpointList::EndpointType nType = mWireEndpoint.value(id).netType();
-            if ((nType == EndpointList::SingleDestination && dstPoints.size() > 1) || (nType == EndpointList::SourceAndDestination && mViewInput.contains(n->get_id())))
-            {
-                // global input connects to multiple boxes
-                int ypos = mGlobalInputHash.size();
-                NetLayoutPoint srcPnt(mNodeBoundingBox.left(), 2 * ypos);
-                srcPoints.insert(srcPnt);
-                mWireEndpoint[id].addSource(srcPnt);
-                mGlobalInputHash[id] = ypos;
-                mWireEndpoint[id].setNetType(EndpointList::HasGlobalEndpoint);
-                mWireEndpoint[id].setInputArrow();
-            }
+        // test for global inputs
+        EndpointList::EndpointType nType = mWireEndpoint.value(id).netType();
+        if ((nType == EndpointList::SingleDestination && dstPoints.size() > 1) || (nType == EndpointList::SourceAndDestination && mViewInput.contains(n->get_id())))
+        {
+            // global input connects to multiple boxes
+            int ypos = mGlobalInputHash.size();
+            NetLayoutPoint srcPnt(mNodeBoundingBox.left(), 2 * ypos);
+            srcPoints.insert(srcPnt);
+            mWireEndpoint[id].addSource(srcPnt);
+            mGlobalInputHash[id] = ypos;
+            mWireEndpoint[id].setNetType(EndpointList::HasGlobalEndpoint);
+            mWireEndpoint[id].setInputArrow();
+        }
 
-            if ((nType == EndpointList::SingleSource && srcPoints.size() > 1) || (nType == EndpointList::SourceAndDestination && mViewOutput.contains(n->get_id())))
-            {
-                // multi-driven global output or global output back coupled to net gate
-                int ypos = mGlobalOutputHash.size();
-                NetLayoutPoint dstPnt(mNodeBoundingBox.right() + 1, 2 * ypos);
-                dstPoints.insert(dstPnt);
-                mWireEndpoint[id].addDestination(dstPnt);
-                mGlobalOutputHash[id] = ypos;
-                mWireEndpoint[id].setNetType(EndpointList::HasGlobalEndpoint);
-                mWireEndpoint[id].setOutputArrow();
-            }
+        if ((nType == EndpointList::SingleSource && srcPoints.size() > 1) || (nType == EndpointList::SourceAndDestination && mViewOutput.contains(n->get_id())))
+        {
+            // multi-driven global output or global output back coupled to net gate
+            int ypos = mGlobalOutputHash.size();
+            NetLayoutPoint dstPnt(mNodeBoundingBox.right() + 1, 2 * ypos);
+            dstPoints.insert(dstPnt);
+            mWireEndpoint[id].addDestination(dstPnt);
+            mGlobalOutputHash[id] = ypos;
+            mWireEndpoint[id].setNetType(EndpointList::HasGlobalEndpoint);
+            mWireEndpoint[id].setOutputArrow();
+        }
 
-            const EndpointList& epl = mWireEndpoint.value(id);
-            switch (epl.netType())
-            {
-                case EndpointList::SingleSource:
-                case EndpointList::SingleDestination:
-                case EndpointList::ConstantLevel: {
-                    int ipnt = 0;
-                    for (const NetLayoutPoint& pnt : epl)
+        const EndpointList& epl = mWireEndpoint.value(id);
+        switch (epl.netType())
+        {
+            case EndpointList::SingleSource:
+            case EndpointList::SingleDestination:
+            case EndpointList::ConstantLevel: {
+                int ipnt = 0;
+                for (const NetLayoutPoint& pnt : epl)
+                {
+                    bool isInput                   = epl.isInput(ipnt++);
+                    SeparatedGraphicsNet* net_item = epl.netType() == EndpointList::ConstantLevel
+                                                         ? static_cast<SeparatedGraphicsNet*>(new LabeledSeparatedNet(n, QString::fromStdString(n->get_name())))
+                                                         : static_cast<SeparatedGraphicsNet*>(new ArrowSeparatedNet(n));
+                    if (isInput)
+                        mSeparatedWidth[pnt].requireInputSpace(net_item->inputWidth() + sLaneSpacing);
+                    else
                     {
-                        bool isInput                   = epl.isInput(ipnt++);
-                        SeparatedGraphicsNet* net_item = epl.netType() == EndpointList::ConstantLevel
-                                                             ? static_cast<SeparatedGraphicsNet*>(new LabeledSeparatedNet(n, QString::fromStdString(n->get_name())))
-                                                             : static_cast<SeparatedGraphicsNet*>(new ArrowSeparatedNet(n));
-                        if (isInput)
-                            mSeparatedWidth[pnt].requireInputSpace(net_item->inputWidth() + sLaneSpacing);
-                        else
-                        {
-                            const NodeBox* nb = mBoxes.boxForPoint(QPoint(pnt.x() - 1, pnt.y() / 2));
-                            Q_ASSERT(nb);
-                            mSeparatedWidth[pnt].requireOutputSpace(nb->item()->width() + net_item->outputWidth() + sLaneSpacing);
-                        }
-                        delete net_item;
+                        const NodeBox* nb = mBoxes.boxForPoint(QPoint(pnt.x() - 1, pnt.y() / 2));
+                        Q_ASSERT(nb);
+                        mSeparatedWidth[pnt].requireOutputSpace(nb->item()->width() + net_item->outputWidth() + sLaneSpacing);
                     }
+                    delete net_item;
                 }
+            }
+            break;
+            case EndpointList::SourceAndDestination:
+            case EndpointList::HasGlobalEndpoint:
+                mRoutedNets.insert(id, qMakePair(srcPoints.toList(), dstPoints.toList()));
                 break;
-                case EndpointList::SourceAndDestination:
-                case EndpointList::HasGlobalEndpoint:
-                {
-                    NetLayoutConnectionFactory nlcf(srcPoints.toList(), dstPoints.toList());
-                    // nlcf.dump(QString("wire %1").arg(id));
-                    mConnectionMetric.insert(NetLayoutMetric(id, nlcf.connection), nlcf.connection);
-                }
+            default:
                 break;
-                default:
-                    break;
-            }
+        }
+    }
+
+    void GraphLayouter::routeNets()
+    {
+        for (auto it = mRoutedNets.constBegin(); it != mRoutedNets.constEnd(); ++it)
+        {
+            if (mCancelRequested)
+                return;
+            NetLayoutConnectionFactory nlcf(it.value().first, it.value().second);
+            // nlcf.dump(QString("wire %1").arg(it.key()));
+            mConnectionMetric.insert(NetLayoutMetric(it.key(), nlcf.connection), nlcf.connection);
         }
 
         /// logic nets -> wire mLanes
@@ -551,7 +812,10 @@ namespace hal
                 mJunctionEntries[pnt].mEntries[idirBase + iend] = it.value();
             }
         }
+    }
 
+    void GraphLayouter::collectEndpoints()
+    {
         /// end points -> junction entries
         for (const NodeBox* nbox : mBoxes)
         {
@@ -583,25 +847,35 @@ namespace hal
             if (!mEndpointHash.contains(pnt))
                 mEndpointHash[pnt].setInputPins(netIds, 0, 0);
         }
+    }
 
-        auto it = mJunctionEntries.constBegin();
-        while (it != mJunctionEntries.constEnd() || !mJunctionThreads.isEmpty())
+    bool GraphLayouter::routeJunctions()
+    {
+        while (mJunctionIterator != mJunctionEntries.constEnd() && mJunctionThreads.size() < QThread::idealThreadCount())
         {
-            if (it != mJunctionEntries.constEnd() && mJunctionThreads.size() < QThread::idealThreadCount())
+            NetLayoutJunction* nlj = nullptr;
+            if (mIncrementalLayout)
             {
-                if (!it.value().isTrivial())
-                {
-                    if (mDumpJunctions)
-                        it.value().dumpToFile(it.key());
-                    JunctionThread* jt = new JunctionThread(it.key(), it.value());
-                    connect(jt,&QThread::finished,this,&GraphLayouter::handleJunctionThreadFinished);
-                    mJunctionThreads.append(jt);
-                    jt->start();
-                }
-                ++it;
+                // junction routing only depends on entries, unchanged junctions are taken from previous layout
+                if (mPreviousJunctionEntries.value(mJunctionIterator.key()) == mJunctionIterator.value())
+                    nlj = mPreviousJunctionHash.take(mJunctionIterator.key());
+                else
+                    mChangedPoints.insert(mJunctionIterator.key());
             }
-            qApp->processEvents();
+            if (nlj)
+                mJunctionHash.insert(mJunctionIterator.key(), nlj);
+            else if (!mJunctionIterator.value().isTrivial())
+            {
+                if (mDumpJunctions)
+                    mJunctionIterator.value().dumpToFile(mJunctionIterator.key());
+                JunctionThread* jt = new JunctionThread(mJunctionIterator.key(), mJunctionIterator.value());
+                connect(jt,&QThread::finished,this,&GraphLayouter::handleJunctionThreadFinished);
+                mJunctionThreads.append(jt);
+                jt->start();
+            }
+            ++mJunctionIterator;
         }
+        return mJunctionIterator == mJunctionEntries.constEnd() && mJunctionThreads.isEmpty();
     }
 
     void GraphLayouter::findMaxBoxDimensions()
@@ -785,21 +1059,41 @@ namespace hal
         }
     }
 
-    void GraphLayouter::placeGates()
+    void GraphLayouter::collectPlacementRegions()
     {
+        // boxes get added to the scene region by region in between processing of GUI events
+        QMap<QPoint, QList<const NodeBox*>> regions;
         for (const NodeBox* box : mBoxes)
+            regions[QPoint(box->x() / sPlacementRegionSize, box->y() / sPlacementRegionSize)].append(box);
+        mPlacementRegions = regions.values();
+        mStepIndex        = 0;
+    }
+
+    bool GraphLayouter::placeGates()
+    {
+        QElapsedTimer slice;
+        slice.start();
+        while (mStepIndex < mPlacementRegions.size())
         {
-            box->item()->setPos(mCoordX[box->x()].xBoxOffset(), mCoordY[box->y() * 2].lanePosition(0));
-            mScene->addGraphItem(box->item());
+            for (const NodeBox* box : mPlacementRegions.at(mStepIndex))
+            {
+                box->item()->setPos(mCoordX[box->x()].xBoxOffset(), mCoordY[box->y() * 2].lanePosition(0));
+                // reused items are owned by the scene already, even if currently detached from the visible area
+                mScene->addGraphItem(box->item());
 
-            NetLayoutPoint outPnt(box->x() + 1, box->y() * 2);
-            QPointF outPos = box->item()->endpointPositionByIndex(0, false);
-            mEndpointHash[outPnt].setOutputPosition(outPos);
+                NetLayoutPoint outPnt(box->x() + 1, box->y() * 2);
+                QPointF outPos = box->item()->endpointPositionByIndex(0, false);
+                mEndpointHash[outPnt].setOutputPosition(outPos);
 
-            NetLayoutPoint inPnt(box->x(), box->y() * 2);
-            QPointF inPos = box->item()->endpointPositionByIndex(0, true);
-            mEndpointHash[inPnt].setInputPosition(inPos);
+                NetLayoutPoint inPnt(box->x(), box->y() * 2);
+                QPointF inPos = box->item()->endpointPositionByIndex(0, true);
+                mEndpointHash[inPnt].setInputPosition(inPos);
+            }
+            ++mStepIndex;
+            if (slice.elapsed() >= sLayoutStepMs)
+                return false;
         }
+        mPlacementRegions.clear();
 
         /// place endpoints which are not connected to any box
         for (auto itEp = mEndpointHash.begin(); itEp != mEndpointHash.end(); ++itEp)
@@ -811,6 +1105,7 @@ namespace hal
                 itEp->setOutputPosition(QPointF(px, py));
             }
         }
+        return true;
     }
 
     void GraphLayouter::drawComments()
@@ -828,7 +1123,7 @@ namespace hal
         }
     }
 
-    void GraphLayouter::drawNets()
+    void GraphLayouter::prepareDrawNets()
     {
         // lane for given wire and net id
 
@@ -839,48 +1134,54 @@ namespace hal
                 mLaneMap[id].insert(it.key(), ilane++);
         }
 
-        int netCount     = mParentContext->nets().size();
-        int percentCount = netCount / 93;
-        int doneCount    = 0;
-
-        mNetsToDraw = mParentContext->nets();
+        mNetsDone    = 0;
+        mNetsToDraw  = mNetsSnapshot;
         mNetIterator = mNetsToDraw.constBegin();
 
+        // remove items of nets which are no longer shown
+        for (u32 id : mNetSignatures.keys())
+        {
+            if (mNetsToDraw.contains(id))
+                continue;
+            removeNetItems(id);
+            mNetSignatures.remove(id);
+        }
+    }
 
+    bool GraphLayouter::drawNets()
+    {
+        int netCount     = mNetsToDraw.size();
+        int percentCount = netCount / 93;
 
-        enum LoopState { LoopInit, CanStartThread, WaitForSlot, WaitForLastThread, LoopDone } loopState = LoopInit;
-        while (loopState != LoopDone)
+        QElapsedTimer slice;
+        slice.start();
+        while (mNetIterator != mNetsToDraw.constEnd() && mDrawNetThreads.size() < QThread::idealThreadCount())
         {
-            if (mNetIterator != mNetsToDraw.constEnd())
+            if (slice.elapsed() >= sLayoutStepMs)
             {
-                if  (mDrawNetThreads.size() < QThread::idealThreadCount())
-                    loopState = CanStartThread;
-                else
-                    loopState = WaitForSlot;
-            }
-            else
-            {
-                if (mDrawNetThreads.isEmpty())
-                    loopState = LoopDone;
-                else
-                    loopState = WaitForLastThread;
+                // isolated and reused nets are handled without thread, continue in next step
+                scheduleLayoutStep();
+                return false;
             }
 
-            if (loopState == LoopDone)
-                break;
+            u32 id = *(mNetIterator++);
 
-            if (loopState == WaitForLastThread || loopState == WaitForSlot)
+            Net* n = gNetlist->get_net_by_id(id);
+            if (!n)
             {
-                qApp->processEvents();
+                removeNetItems(id);
+                mNetSignatures.remove(id);
                 continue;
             }
 
-            Q_ASSERT(loopState == CanStartThread);
-            u32 id = *(mNetIterator++);
-
-            Net* n = gNetlist->get_net_by_id(id);
-            if (!n)
+            NetRouteSignature sig = netRouteSignature(id);
+            if (mIncrementalLayout && canReuseNetItems(id, sig))
+            {
+                ++mNetsDone;
                 continue;
+            }
+            removeNetItems(id);
+            mNetSignatures.insert(id, sig);
 
             const EndpointList& epl = mWireEndpoint.value(id);
             bool regularNet         = false;
@@ -888,12 +1189,12 @@ namespace hal
             switch (epl.netType())
             {
                 case EndpointList::NoEndpoint:
-                    ++doneCount;
+                    ++mNetsDone;
                     break;
                 case EndpointList::SingleSource:
                 case EndpointList::SingleDestination:
                 case EndpointList::ConstantLevel:
-                    ++doneCount;
+                    ++mNetsDone;
                     drawNetsIsolated(id, n, epl);
                     break;
                     ;
@@ -905,20 +1206,21 @@ namespace hal
             if (!regularNet)
                 continue;
 
-            ++doneCount;
+            ++mNetsDone;
             if (percentCount)
             {
-                if (doneCount % percentCount == 0)
-                    mParentContext->layoutProgress(7 + doneCount / percentCount);
+                if (mNetsDone % percentCount == 0)
+                    mParentContext->layoutProgress(7 + mNetsDone / percentCount);
             }
             else
-                mParentContext->layoutProgress(7 + (int)floor(92. * doneCount / netCount));
+                mParentContext->layoutProgress(7 + (int)floor(92. * mNetsDone / netCount));
 
             DrawNetThread* dnt = new DrawNetThread(id,this);
             connect(dnt,&QThread::finished,this,&GraphLayouter::handleDrawNetThreadFinished);
             mDrawNetThreads.append(dnt);
             dnt->start();
         }
+        return mNetIterator == mNetsToDraw.constEnd() && mDrawNetThreads.isEmpty();
     }
 
     void GraphLayouter::handleJunctionThreadFinished()
@@ -927,6 +1229,7 @@ namespace hal
         mJunctionHash.insert(jt->mNetLayoutPoint,jt->mJunction);
         mJunctionThreads.removeAll(jt);
         jt->deleteLater();
+        scheduleLayoutStep();
     }
 
     void GraphLayouter::handleDrawNetThreadFinished()
@@ -952,7 +1255,7 @@ namespace hal
                 }
                 if (epl.hasOutputArrow())
                 {
-                    if (graphicsNet) mScene->addGraphItem(graphicsNet);
+                    if (graphicsNet) addNetItem(graphicsNet);
                     StandardArrowNet* san = new StandardArrowNet(n, dnt->mLines, dnt->mKnots);
                     graphicsNet           = san;
                     int yGridPos          = mGlobalOutputHash.value(dnt->id(), -1);
@@ -973,10 +1276,11 @@ namespace hal
         }
 
         if (graphicsNet)
-            mScene->addGraphItem(graphicsNet);
+            addNetItem(graphicsNet);
 
         mDrawNetThreads.removeAll(dnt);
         dnt->deleteLater();
+        scheduleLayoutStep();
     }
 
     void GraphLayouter::drawNetsIsolated(u32 id, Net* n, const EndpointList& epl)
@@ -1015,7 +1319,63 @@ namespace hal
             }
         }
         net_item->finalize();
-        mScene->addGraphItem(net_item);
+        addNetItem(net_item);
+    }
+
+    void GraphLayouter::addNetItem(GraphicsNet* item)
+    {
+        mScene->addGraphItem(item);
+        mNetItems.insert(item->id(), item);
+    }
+
+    void GraphLayouter::removeNetItems(u32 id)
+    {
+        for (GraphicsNet* item : mNetItems.values(id))
+            mScene->removeGraphItem(item);
+        mNetItems.remove(id);
+    }
+
+    GraphLayouter::NetRouteSignature GraphLayouter::netRouteSignature(u32 id) const
+    {
+        NetRouteSignature retval;
+        retval.mEndpoints = mWireEndpoint.value(id);
+        retval.mLanes     = mLaneMap.value(id);
+
+        QList<NetLayoutPoint> points = retval.mEndpoints;
+        for (auto it = retval.mLanes.constBegin(); it != retval.mLanes.constEnd(); ++it)
+        {
+            points.append(it.key().endPoint(NetLayoutWire::SourcePoint));
+            points.append(it.key().endPoint(NetLayoutWire::DestinationPoint));
+        }
+
+        for (const NetLayoutPoint& pnt : points)
+        {
+            // box position of output endpoints is determined by the coordinate left of the endpoint
+            retval.mCoordX.insert(pnt.x() - 1, mCoordX.value(pnt.x() - 1));
+            retval.mCoordX.insert(pnt.x(), mCoordX.value(pnt.x()));
+            retval.mCoordY.insert(pnt.y(), mCoordY.value(pnt.y()));
+        }
+        return retval;
+    }
+
+    bool GraphLayouter::canReuseNetItems(u32 id, const NetRouteSignature& sig) const
+    {
+        if (mInvalidNets.contains(id))
+            return false;
+
+        auto it = mNetSignatures.constFind(id);
+        if (it == mNetSignatures.constEnd() || !(it.value() == sig))
+            return false;
+
+        for (const NetLayoutPoint& pnt : sig.mEndpoints)
+            if (mChangedPoints.contains(pnt))
+                return false;
+
+        for (auto itLane = sig.mLanes.constBegin(); itLane != sig.mLanes.constEnd(); ++itLane)
+            if (mChangedPoints.contains(itLane.key().endPoint(NetLayoutWire::SourcePoint)) || mChangedPoints.contains(itLane.key().endPoint(NetLayoutWire::DestinationPoint)))
+                return false;
+
+        return true;
     }
 
     void GraphLayouter::updateSceneRect()
@@ -1023,7 +1383,7 @@ namespace hal
         // SCENE RECT STUFF BEHAVES WEIRDLY, FURTHER RESEARCH REQUIRED
         //QRectF rect = mScene->sceneRect();
 
-        QRectF rect(mScene->itemsBoundingRect());
+        QRectF rect(mScene->graphItemsBoundingRect());
         rect.adjust(-200, -200, 200, 200);
         mScene->setSceneRect(rect);
     }
@@ -1168,6 +1528,11 @@ namespace hal
         return junctionExit() + sHRoadPadding + mPadding;
     }
 
+    bool GraphLayouter::SceneCoordinate::operator==(const SceneCoordinate& other) const
+    {
+        return minLane == other.minLane && maxLane == other.maxLane && mOffset == other.mOffset && mPadding == other.mPadding;
+    }
+
     GraphLayouter::SceneCoordinateArray::SceneCoordinateArray(const QMap<int,SceneCoordinate>& inputMap)
         : mArray(nullptr), mFirstIndex(0)
     {
@@ -1290,6 +1655,12 @@ namespace hal
         mPointIsInput.append(true);
     }
 
+    bool GraphLayouter::EndpointList::operator==(const EndpointList& other) const
+    {
+        return QList<NetLayoutPoint>::operator==(other) && mNetType == other.mNetType && mPointIsInput == other.mPointIsInput && mInputArrow == other.mInputArrow
+               && mOutputArrow == other.mOutputArrow;
+    }
+
     void GraphLayouter::SeparatedNetWidth::requireInputSpace(float spc)
     {
         if (spc > mInputSpace)
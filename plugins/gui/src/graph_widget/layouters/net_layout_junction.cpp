@@ -918,6 +918,14 @@ namespace hal {
         return false;
     }
 
+    bool NetLayoutJunctionEntries::operator==(const NetLayoutJunctionEntries& other) const
+    {
+        for (int i = 0; i < 4; i++)
+            if (mEntries[i] != other.mEntries[i])
+                return false;
+        return true;
+    }
+
     void NetLayoutJunctionEntries::dumpToFile(const QPoint &pnt) const
     {
         QFile ff(QString::fromStdString(ProjectManager::instance()->get_project_directory().get_filename("junction_data.txt").string()));
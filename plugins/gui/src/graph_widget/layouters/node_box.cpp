@@ -34,6 +34,12 @@ namespace hal
         }
     }
 
+    NodeBox::NodeBox(const Node &n, int px, int py, GraphicsNode* item)
+        : mNode(n), mItem(item), mX(px), mY(py),
+          mInputPadding(sMinimumGateIoPadding),
+          mOutputPadding(sMinimumGateIoPadding)
+    {;}
+
     void NodeBox::setItemPosition(qreal xpos, qreal ypos)
     {
         Q_ASSERT(mItem);
@@ -60,7 +66,12 @@ namespace hal
 
     void NodeBoxes::addBox(const Node &nd, int px, int py)
     {
-        NodeBox* nbox = new NodeBox(nd,px,py);
+        addBox(nd,px,py,nullptr);
+    }
+
+    void NodeBoxes::addBox(const Node &nd, int px, int py, GraphicsNode* item)
+    {
+        NodeBox* nbox = item ? new NodeBox(nd,px,py,item) : new NodeBox(nd,px,py);
 
         mNodeHash.insert(nd,nbox);
         mPointHash.insert(QPoint(px,py),nbox);
@@ -1,6 +1,8 @@
 #include "gui/module_model/module_item.h"
 
+#include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
 
 #include "gui/gui_globals.h"
 #include "gui/gui_utils/graphics.h"
@@ -12,18 +14,23 @@ ModuleItem::ModuleItem(const u32 id, const TreeItemType type) :
         BaseTreeItem(),
         mId(id),
         mType(type),
-        mHighlighted(false)
+        mHighlighted(false),
+        mFetched(type != TreeItemType::Module)
     {
+        // the name stays empty if the object does not exist (anymore)
         switch(type)
         {
         case TreeItemType::Module:
-            mName = QString::fromStdString(gNetlist->get_module_by_id(id)->get_name());
+            if (const Module* m = gNetlist->get_module_by_id(id); m)
+                mName = QString::fromStdString(m->get_name());
             break;
         case TreeItemType::Gate:
-            mName = QString::fromStdString(gNetlist->get_gate_by_id(id)->get_name());
+            if (const Gate* g = gNetlist->get_gate_by_id(id); g)
+                mName = QString::fromStdString(g->get_name());
             break;
         case TreeItemType::Net:
-            mName = QString::fromStdString(gNetlist->get_net_by_id(id)->get_name());
+            if (const Net* n = gNetlist->get_net_by_id(id); n)
+                mName = QString::fromStdString(n->get_name());
             break;
         }
     }
@@ -36,7 +43,7 @@ ModuleItem::ModuleItem(const u32 id, const TreeItemType type) :
     }
 
 
-    void ModuleItem::appendExistingChildIfAny(const QMap<u32,ModuleItem*>& moduleMap)
+    void ModuleItem::appendExistingChildIfAny(const QHash<u32,ModuleItem*>& moduleMap)
     {
         if(mType != TreeItemType::Module) // only module can have children
             return;
@@ -154,6 +161,16 @@ ModuleItem::ModuleItem(const u32 id, const TreeItemType type) :
         mHighlighted = highlighted;
     }
 
+    bool ModuleItem::isFetched() const
+    {
+        return mFetched;
+    }
+
+    void ModuleItem::setFetched(const bool fetched)
+    {
+        mFetched = fetched;
+    }
+
     int ModuleItem::getColumnCount() const
     {
         return 3;
@@ -7,6 +7,8 @@
 #include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/net.h"
 
+#include <unordered_set>
+
 namespace hal
 {
     ModuleModel::ModuleModel(QObject* parent) : BaseTreeModel(parent)
@@ -67,6 +69,84 @@ namespace hal
         return QAbstractItemModel::flags(index);
     }
 
+    bool ModuleModel::hasChildren(const QModelIndex& parent) const
+    {
+        ModuleItem* item = getItem(parent);
+        if (!item || item->isFetched())
+            return BaseTreeModel::hasChildren(parent);
+
+        // children not created yet, a module without gates and submodules cannot have nets either
+        Module* module = gNetlist->get_module_by_id(item->id());
+        if (!module)
+            return false;
+        return module->is_top_module() || !module->get_gates().empty() || !module->get_submodules().empty();
+    }
+
+    bool ModuleModel::canFetchMore(const QModelIndex& parent) const
+    {
+        ModuleItem* item = getItem(parent);
+        return item && !item->isFetched();
+    }
+
+    void ModuleModel::fetchMore(const QModelIndex& parent)
+    {
+        ModuleItem* parentItem = getItem(parent);
+        if (!parentItem || parentItem->isFetched())
+            return;
+
+        parentItem->setFetched(true);
+        Module* module = gNetlist->get_module_by_id(parentItem->id());
+        if (!module)
+            return;
+
+        QList<ModuleItem*> children;
+        for (const Module* m : module->get_submodules())
+            children.append(new ModuleItem(m->get_id()));
+        for (const Gate* g : module->get_gates())
+            children.append(new ModuleItem(g->get_id(), ModuleItem::TreeItemType::Gate));
+
+        // nets are placed under the deepest module containing all of their endpoints, such a net is either connected
+        // to a gate of the module itself or connects submodules, so only those nets need to be checked
+        std::unordered_set<const Net*> candidates;
+        for (const Gate* g : module->get_gates())
+        {
+            for (const Net* n : g->get_fan_in_nets())
+                candidates.insert(n);
+            for (const Net* n : g->get_fan_out_nets())
+                candidates.insert(n);
+        }
+        for (const Module* m : module->get_submodules())
+        {
+            candidates.insert(m->get_input_nets().begin(), m->get_input_nets().end());
+            candidates.insert(m->get_output_nets().begin(), m->get_output_nets().end());
+        }
+        for (const Net* n : candidates)
+            if (isTreeNet(n) && findNetParent(n) == module)
+                children.append(new ModuleItem(n->get_id(), ModuleItem::TreeItemType::Net));
+
+        // nets without any endpoint are placed under the top module
+        if (module->is_top_module())
+        {
+            for (u32 id : mUnconnectedNets)
+                if (const Net* n = gNetlist->get_net_by_id(id); n && isTreeNet(n))
+                    children.append(new ModuleItem(id, ModuleItem::TreeItemType::Net));
+        }
+
+        if (children.isEmpty())
+            return;
+
+        int first = parentItem->getChildCount();
+        mIsModifying = true;
+        beginInsertRows(parent, first, first + children.size() - 1);
+        for (ModuleItem* child : children)
+        {
+            mModuleItemMaps[(int)child->getType()]->insert(child->id(), child);
+            parentItem->appendChild(child);
+        }
+        mIsModifying = false;
+        endInsertRows();
+    }
+
     ModuleItem* ModuleModel::getItem(const QModelIndex& index) const
     {
         if (index.isValid())
@@ -101,17 +181,13 @@ namespace hal
         ModuleItem* item = new ModuleItem(1);
         mModuleMap.insert(1, item);
 
+        mUnconnectedNets.clear();
+        for (const Net* n : gNetlist->get_nets())
+            updateUnconnectedNet(n);
+
         beginInsertRows(index(0, 0, QModelIndex()), 0, 0);
         mRootItem->appendChild(item);
         endInsertRows();
-
-        Module* m = gNetlist->get_top_module();
-        addRecursively(m);
-        for(auto net : gNetlist->get_top_module()->get_internal_nets())
-        {
-            addNet(net->get_id(), m->get_id());
-            updateNet(net);
-        }
     }
 
     void ModuleModel::clear()
@@ -122,162 +198,82 @@ namespace hal
         mModuleMap.clear();
         mGateMap.clear();
         mNetMap.clear();
+        mUnconnectedNets.clear();
         //TODO : clear colors
         endResetModel();
     }
 
     void ModuleModel::addModule(u32 id, u32 parent_module)
     {
-        assert(gNetlist->get_module_by_id(id));
-        assert(gNetlist->get_module_by_id(parent_module));
-        assert(!mModuleMap.contains(id));
-        assert(mModuleMap.contains(parent_module));
+        // the module may have been removed again in the meantime if events are delivered in batches
+        if (!gNetlist->get_module_by_id(id) || !gNetlist->get_module_by_id(parent_module))
+            return;
 
-        ModuleItem* item   = new ModuleItem(id);
+        // item will be created when the parent is expanded or has already been created while fetching the parent
         ModuleItem* parent = mModuleMap.value(parent_module);
+        if (!parent || !parent->isFetched() || mModuleMap.contains(id))
+            return;
 
-        item->setParent(parent);
-        mModuleMap.insert(id, item);
-
-        QModelIndex index = getIndex(parent);
-
-        int row = parent->getChildCount();
-        mIsModifying = true;
-        beginInsertRows(index, row, row);
-        parent->appendChild(item);
-        mIsModifying = false;
-        endInsertRows();
+        insertItem(new ModuleItem(id), parent);
     }
 
     void ModuleModel::addGate(u32 id, u32 parent_module)
     {
-        assert(gNetlist->get_gate_by_id(id));
-        assert(gNetlist->get_module_by_id(parent_module));
-        assert(!mGateMap.contains(id));
-        assert(mModuleMap.contains(parent_module));
+        if (!gNetlist->get_gate_by_id(id) || !gNetlist->get_module_by_id(parent_module))
+            return;
 
-        ModuleItem* item   = new ModuleItem(id, ModuleItem::TreeItemType::Gate);
         ModuleItem* parent = mModuleMap.value(parent_module);
+        if (!parent || !parent->isFetched() || mGateMap.contains(id))
+            return;
 
-        item->setParent(parent);
-        mGateMap.insert(id, item);
-
-        QModelIndex index = getIndex(parent);
-
-        int row = parent->getChildCount();
-        mIsModifying = true;
-        beginInsertRows(index, row, row);
-        parent->appendChild(item);
-        mIsModifying = false;
-        endInsertRows();
+        insertItem(new ModuleItem(id, ModuleItem::TreeItemType::Gate), parent);
     }
 
     void ModuleModel::addNet(u32 id, u32 parent_module)
     {
-        assert(gNetlist->get_net_by_id(id));
-        assert(gNetlist->get_module_by_id(parent_module));
-        assert(!mNetMap.contains(id));
-        assert(mModuleMap.contains(parent_module));
-
-        ModuleItem* item   = new ModuleItem(id, ModuleItem::TreeItemType::Net);
-        ModuleItem* parent = mModuleMap.value(parent_module);
-
-        item->setParent(parent);
-        mNetMap.insert(id, item);
+        const Net* net = gNetlist->get_net_by_id(id);
+        if (!net || !gNetlist->get_module_by_id(parent_module))
+            return;
 
-        QModelIndex index = getIndex(parent);
+        updateUnconnectedNet(net);
 
-        int row = parent->getChildCount();
-        mIsModifying = true;
-        beginInsertRows(index, row, row);
-        parent->appendChild(item);
-        mIsModifying = false;
-        endInsertRows();
-    }
-
-    void ModuleModel::addRecursively(const Module* module)
-    {
-        if(!module->is_top_module())
-            addModule(module->get_id(), module->get_parent_module()->get_id());
-        for(auto &m : module->get_submodules())
-            addRecursively(m);
+        ModuleItem* parent = mModuleMap.value(parent_module);
+        if (!parent || !parent->isFetched() || mNetMap.contains(id))
+            return;
 
-        for(auto &g : module->get_gates())
-            addGate(g->get_id(), module->get_id());
+        insertItem(new ModuleItem(id, ModuleItem::TreeItemType::Net), parent);
     }
 
     void ModuleModel::removeModule(const u32 id)
     {
         assert(id != 1);
-        // module was most likely already purged from netlist
-        assert(mModuleMap.contains(id));
-
-        ModuleItem* item   = mModuleMap.value(id);
-        ModuleItem* parent = static_cast<ModuleItem*>(item->getParent());
-        assert(item);
-        assert(parent);
-
-        QModelIndex index = getIndex(parent);
 
-        int row = item->row();
-
-        mIsModifying = true;
-        beginRemoveRows(index, row, row);
-        parent->removeChild(item);
-        mIsModifying = false;
-        endRemoveRows();
+        ModuleItem* item = mModuleMap.value(id);
+        if (!item)
+            return;
 
-        mModuleMap.remove(id);
-        delete item;
+        removeItem(item);
     }
 
     void ModuleModel::removeGate(const u32 id)
     {
-        //assert(gNetlist->get_gate_by_id(id));
-        assert(mGateMap.contains(id));
-
-        ModuleItem* item   = mGateMap.value(id);
-        ModuleItem* parent = static_cast<ModuleItem*>(item->getParent());
-        assert(item);
-        assert(parent);
-
-        QModelIndex index = getIndex(parent);
-
-        int row = item->row();
-
-        mIsModifying = true;
-        beginRemoveRows(index, row, row);
-        parent->removeChild(item);
-        mIsModifying = false;
-        endRemoveRows();
+        ModuleItem* item = mGateMap.value(id);
+        if (!item)
+            return;
 
-        mGateMap.remove(id);
-        delete item;
+        removeItem(item);
     }
 
     void ModuleModel::removeNet(const u32 id)
     {
-        //assert(gNetlist->get_net_by_id(id));
-        if(!mNetMap.contains(id)) // global nets are not contained in the item model
-            return;
-
-        ModuleItem* item   = mNetMap.value(id);
-        ModuleItem* parent = static_cast<ModuleItem*>(item->getParent());
-        assert(item);
-        assert(parent);
-
-        QModelIndex index = getIndex(parent);
+        mUnconnectedNets.remove(id);
 
-        int row = item->row();
-
-        mIsModifying = true;
-        beginRemoveRows(index, row, row);
-        parent->removeChild(item);
-        mIsModifying = false;
-        endRemoveRows();
+        // global nets are not contained in the item model
+        ModuleItem* item = mNetMap.value(id);
+        if (!item)
+            return;
 
-        mNetMap.remove(id);
-        delete item;
+        removeItem(item);
     }
 
     void ModuleModel::handleModuleParentChanged(const Module* module)
@@ -294,10 +290,13 @@ namespace hal
         // Don't need new function handleModuleGateRemoved(), because the GateAssinged event always follows GateRemoved
         // or NetlistInternalManager updates Net connections when a gate is deleted.
 
+        Gate* gate = gNetlist->get_gate_by_id(id);
+        if(!gate)
+            return;
+
         if(!mGateMap.contains(id))
             addGate(id, parent_module);
-            
-        Gate* gate = gNetlist->get_gate_by_id(id);
+
         for(Net* in_net : gate->get_fan_in_nets())
             updateNet(in_net);
         for(Net* in_net : gate->get_fan_out_nets())
@@ -309,21 +308,36 @@ namespace hal
         assert(net);
         u32 id = net->get_id();
 
-        if(!mNetMap.contains(id))
+        updateUnconnectedNet(net);
+        if(!isTreeNet(net))
             return;
-            
-        ModuleItem* item = mNetMap.value(id);
-        ModuleItem* oldParentItem = static_cast<ModuleItem*>(item->getParent());
-        assert(oldParentItem);
 
         Module* newParentModule = findNetParent(net);
         if(newParentModule == nullptr)
             newParentModule = gNetlist->get_top_module();
+        ModuleItem* newParentItem = mModuleMap.value(newParentModule->get_id());
+        bool newParentFetched = newParentItem && newParentItem->isFetched();
+
+        ModuleItem* item = mNetMap.value(id);
+        if(!item)
+        {
+            if(newParentFetched)
+                insertItem(new ModuleItem(id, ModuleItem::TreeItemType::Net), newParentItem);
+            return;
+        }
+
+        ModuleItem* oldParentItem = static_cast<ModuleItem*>(item->getParent());
+        assert(oldParentItem);
         if(newParentModule->get_id() == oldParentItem->id())
             return;
 
-        assert(mModuleMap.contains(newParentModule->get_id()));
-        ModuleItem* newParentItem = mModuleMap[newParentModule->get_id()];
+        if(!newParentFetched)
+        {
+            // will be created again once the new parent is expanded
+            removeItem(item);
+            return;
+        }
+
         QModelIndex newIndex = getIndex(newParentItem);
         QModelIndex oldIndex = getIndex(oldParentItem);
         int row = item->row();
@@ -340,17 +354,29 @@ namespace hal
         assert(module);
         u32 id = module->get_id();
         assert(id != 1);
-        assert(mModuleMap.contains(id));
+
+        assert(module->get_parent_module());
+        ModuleItem* newParent = mModuleMap.value(module->get_parent_module()->get_id());
+        bool newParentFetched = newParent && newParent->isFetched();
+
         ModuleItem* item = mModuleMap.value(id);
+        if(!item)
+        {
+            if(newParentFetched)
+                insertItem(new ModuleItem(id), newParent);
+            return;
+        }
+
         ModuleItem* oldParent = static_cast<ModuleItem*>(item->getParent());
         assert(oldParent);
-
-        assert(module->get_parent_module());
         if(oldParent->id() == module->get_parent_module()->get_id())
             return;
 
-        assert(mModuleMap.contains(module->get_parent_module()->get_id()));
-        ModuleItem* newParent = mModuleMap.value(module->get_parent_module()->get_id());
+        if(!newParentFetched)
+        {
+            removeItem(item);
+            return;
+        }
 
         QModelIndex oldIndex = getIndex(oldParent);
         QModelIndex newIndex = getIndex(newParent);
@@ -367,10 +393,10 @@ namespace hal
     void ModuleModel::updateModuleName(u32 id)
     {
         assert(gNetlist->get_module_by_id(id));
-        assert(mModuleMap.contains(id));
 
         ModuleItem* item = mModuleMap.value(id);
-        assert(item);
+        if (!item)
+            return;
 
         item->setName(QString::fromStdString(gNetlist->get_module_by_id(id)->get_name()));    // REMOVE & ADD AGAIN
 
@@ -381,10 +407,10 @@ namespace hal
     void ModuleModel::updateGateName(u32 id)
     {
         assert(gNetlist->get_gate_by_id(id));
-        assert(mGateMap.contains(id));
 
         ModuleItem* item = mGateMap.value(id);
-        assert(item);
+        if (!item)
+            return;
 
         item->setName(QString::fromStdString(gNetlist->get_gate_by_id(id)->get_name()));    // REMOVE & ADD AGAIN
 
@@ -395,10 +421,10 @@ namespace hal
     void ModuleModel::updateNetName(u32 id)
     {
         assert(gNetlist->get_net_by_id(id));
-        assert(mNetMap.contains(id));
 
         ModuleItem* item = mNetMap.value(id);
-        assert(item);
+        if (!item)
+            return;
         
         item->setName(QString::fromStdString(gNetlist->get_net_by_id(id)->get_name()));    // REMOVE & ADD AGAIN
 
@@ -411,12 +437,116 @@ namespace hal
         return mModuleItemMaps[(int)type]->value(id);
     }
 
+    ModuleItem* ModuleModel::fetchItem(u32 id, ModuleItem::TreeItemType type)
+    {
+        if (ModuleItem* item = getItem(id, type))
+            return item;
+
+        Module* parentModule = nullptr;
+        switch (type)
+        {
+            case ModuleItem::TreeItemType::Module: {
+                Module* module = gNetlist->get_module_by_id(id);
+                if (!module)
+                    return nullptr;
+                parentModule = module->get_parent_module();
+                break;
+            }
+            case ModuleItem::TreeItemType::Gate: {
+                Gate* gate = gNetlist->get_gate_by_id(id);
+                if (!gate)
+                    return nullptr;
+                parentModule = gate->get_module();
+                break;
+            }
+            case ModuleItem::TreeItemType::Net: {
+                Net* net = gNetlist->get_net_by_id(id);
+                if (!net || !isTreeNet(net))
+                    return nullptr;
+                parentModule = findNetParent(net);
+                if (!parentModule)
+                    parentModule = gNetlist->get_top_module();
+                break;
+            }
+        }
+        if (!parentModule)
+            return nullptr;
+
+        // fetch children top-down along the path from the top module
+        QList<u32> path;
+        for (Module* m = parentModule; m; m = m->get_parent_module())
+            path.prepend(m->get_id());
+        for (u32 mid : path)
+        {
+            ModuleItem* moduleItem = mModuleMap.value(mid);
+            if (!moduleItem)
+                return nullptr;
+            if (!moduleItem->isFetched())
+                fetchMore(getIndex(moduleItem));
+        }
+
+        return getItem(id, type);
+    }
+
+    void ModuleModel::insertItem(ModuleItem* item, ModuleItem* parent)
+    {
+        mModuleItemMaps[(int)item->getType()]->insert(item->id(), item);
+
+        QModelIndex index = getIndex(parent);
+
+        int row = parent->getChildCount();
+        mIsModifying = true;
+        beginInsertRows(index, row, row);
+        parent->appendChild(item);
+        mIsModifying = false;
+        endInsertRows();
+    }
+
+    void ModuleModel::removeItem(ModuleItem* item)
+    {
+        ModuleItem* parent = static_cast<ModuleItem*>(item->getParent());
+        assert(parent);
+
+        QModelIndex index = getIndex(parent);
+
+        int row = item->row();
+
+        mIsModifying = true;
+        beginRemoveRows(index, row, row);
+        parent->removeChild(item);
+        mIsModifying = false;
+        endRemoveRows();
+
+        forgetItem(item);
+        delete item;
+    }
+
+    void ModuleModel::forgetItem(ModuleItem* item)
+    {
+        for (BaseTreeItem* child : item->getChildren())
+            forgetItem(static_cast<ModuleItem*>(child));
+        mModuleItemMaps[(int)item->getType()]->remove(item->id());
+    }
+
+    bool ModuleModel::isTreeNet(const Net* net) const
+    {
+        return !gNetlist->is_global_input_net(net) && !gNetlist->is_global_output_net(net);
+    }
+
+    void ModuleModel::updateUnconnectedNet(const Net* net)
+    {
+        if (net->get_num_of_sources() == 0 && net->get_num_of_destinations() == 0)
+            mUnconnectedNets.insert(net->get_id());
+        else
+            mUnconnectedNets.remove(net->get_id());
+    }
+
     bool ModuleModel::isModifying()
     {
         return mIsModifying;
     }
     
-    Module* ModuleModel::findNetParent(const Net* net){
+    Module* ModuleModel::findNetParent(const Net* net) const {
         // cannot use Module::get_internal_nets(), because currently that function is implemented so, 
         // that a net can be "internal" to multiple modules at the same depth.
         // => instead manually search for deepest module, that contains all sources and destinations of net.
@@ -1,12 +1,20 @@
 #include "gui/module_model/module_proxy_model.h"
 #include "gui/module_model/module_item.h"
+#include "gui/module_model/module_model.h"
 
 #include "gui/gui_globals.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+
+#include <QTimer>
 
 namespace hal
 {
-    ModuleProxyModel::ModuleProxyModel(QObject* parent) : SearchProxyModel(parent), mSortMechanism(gui_utility::mSortMechanism::lexical), mFilterNets(true), mFilterGates(true)
+    ModuleProxyModel::ModuleProxyModel(QObject* parent) : SearchProxyModel(parent), mSortMechanism(gui_utility::mSortMechanism::lexical), mFilterNets(true), mFilterGates(true), mSearchMatchesOutdated(false)
     {
+        connect(this, &QAbstractProxyModel::sourceModelChanged, this, &ModuleProxyModel::handleSourceModelChanged);
+
         // QTS PROXY MODELS ARE DUMB, IMPLEMENT CUSTOM SOLUTION OR SWITCH TO A DIFFERENT FILTER METHOD
 
         // IN VIEW
@@ -17,6 +25,7 @@ namespace hal
     bool ModuleProxyModel::toggleFilterNets()
     {
         mFilterNets = !mFilterNets;
+        updateSearchMatches();
         invalidateFilter();
         return mFilterNets;
     }
@@ -24,6 +33,7 @@ namespace hal
     bool ModuleProxyModel::toggleFilterGates()
     {
         mFilterGates = !mFilterGates;
+        updateSearchMatches();
         invalidateFilter();
         return mFilterGates;
     }
@@ -40,7 +50,19 @@ namespace hal
         if(mFilterNets && item->getType() == ModuleItem::TreeItemType::Net)
             return false;
 
-        return checkRowRecursion(sourceRow, sourceParent, 0, 2);
+        if (mSearchString.isEmpty())
+            return true;
+
+        switch (item->getType())
+        {
+            case ModuleItem::TreeItemType::Module:
+                return mAcceptedModules.contains(item->id());
+            case ModuleItem::TreeItemType::Gate:
+                return mAcceptedGates.contains(item->id());
+            case ModuleItem::TreeItemType::Net:
+                return mAcceptedNets.contains(item->id());
+        }
+        return false;
     }
 
     bool ModuleProxyModel::lessThan(const QModelIndex &source_left, const QModelIndex &source_right) const
@@ -75,8 +97,122 @@ namespace hal
     {
         mSearchString = text;
         mSearchOptions = SearchOptions(options);
+        updateSearchMatches();
         invalidateFilter();
     }
+
+    void ModuleProxyModel::handleSourceModelChanged()
+    {
+        if (!sourceModel())
+            return;
+        connect(sourceModel(), &QAbstractItemModel::rowsInserted, this, &ModuleProxyModel::handleSourceRowsChanged);
+        connect(sourceModel(), &QAbstractItemModel::rowsRemoved, this, &ModuleProxyModel::handleSourceRowsChanged);
+        connect(sourceModel(), &QAbstractItemModel::rowsMoved, this, &ModuleProxyModel::handleSourceRowsChanged);
+        connect(sourceModel(), &QAbstractItemModel::dataChanged, this, &ModuleProxyModel::handleSourceRowsChanged);
+        connect(sourceModel(), &QAbstractItemModel::modelReset, this, &ModuleProxyModel::handleSourceRowsChanged);
+        handleSourceRowsChanged();
+    }
+
+    void ModuleProxyModel::handleSourceRowsChanged()
+    {
+        // items were added, removed, moved or renamed, accepted items are collected once all pending changes are done
+        if (mSearchString.isEmpty() || mSearchMatchesOutdated)
+            return;
+        mSearchMatchesOutdated = true;
+        QTimer::singleShot(0, this, &ModuleProxyModel::handleSearchMatchesOutdated);
+    }
+
+    void ModuleProxyModel::handleSearchMatchesOutdated()
+    {
+        if (!mSearchMatchesOutdated)
+            return;
+        updateSearchMatches();
+        invalidateFilter();
+    }
+
+    void ModuleProxyModel::updateSearchMatches()
+    {
+        mSearchMatchesOutdated = false;
+
+        mAcceptedModules.clear();
+        mAcceptedGates.clear();
+        mAcceptedNets.clear();
+
+        ModuleModel* model = dynamic_cast<ModuleModel*>(sourceModel());
+        if (mSearchString.isEmpty() || !model || !gNetlist)
+            return;
+
+        // columns: name, ID, type
+        QList<int> columns = mSearchOptions.getColumns();
+        if (columns.isEmpty())
+            columns = {0, 1, 2};
+
+        u8 fields = 0;
+        if (columns.contains(0)) fields |= SearchIndex::Field::name;
+        if (columns.contains(2)) fields |= SearchIndex::Field::type;
+
+        // a row is accepted if the row itself or any of its descendants matches, ancestors are taken from the
+        // netlist so that rows which have not been fetched yet are accepted once their parent is expanded
+        auto acceptModule = [this](const Module* m) {
+            for (; m && !mAcceptedModules.contains(m->get_id()); m = m->get_parent_module())
+                mAcceptedModules.insert(m->get_id());
+        };
+        auto acceptMatches = [this, model, &acceptModule](const std::vector<u32>& ids, ModuleItem::TreeItemType type) {
+            for (u32 id : ids)
+            {
+                switch (type)
+                {
+                    case ModuleItem::TreeItemType::Module:
+                        acceptModule(gNetlist->get_module_by_id(id));
+                        break;
+                    case ModuleItem::TreeItemType::Gate:
+                        if (const Gate* g = gNetlist->get_gate_by_id(id); g)
+                        {
+                            mAcceptedGates.insert(id);
+                            acceptModule(g->get_module());
+                        }
+                        break;
+                    case ModuleItem::TreeItemType::Net:
+                        if (const Net* n = gNetlist->get_net_by_id(id); n && !gNetlist->is_global_input_net(n) && !gNetlist->is_global_output_net(n))
+                        {
+                            mAcceptedNets.insert(id);
+                            const Module* parent = model->findNetParent(n);
+                            acceptModule(parent ? parent : gNetlist->get_top_module());
+                        }
+                        break;
+                }
+            }
+        };
+
+        if (fields)
+        {
+            // the search index is built on the first search, netlists that are never searched do not pay for keeping it up to date
+            if (!gNetlist->is_search_index_enabled())
+                gNetlist->enable_search_index(true);
+
+            auto res = gNetlist->search(mSearchString.toStdString(), fields, mSearchOptions.isCaseSensitive(), mSearchOptions.isExactMatch(), mSearchOptions.isRegularExpression());
+            if (res.is_ok())
+            {
+                const SearchIndex::Matches& matches = res.get();
+                acceptMatches(matches.modules, ModuleItem::TreeItemType::Module);
+                if (!mFilterGates) acceptMatches(matches.gates, ModuleItem::TreeItemType::Gate);
+                if (!mFilterNets) acceptMatches(matches.nets, ModuleItem::TreeItemType::Net);
+            }
+        }
+
+        if (columns.contains(1))
+        {
+            // IDs are not part of the search index, a numeric search string is looked up directly and matches the object with exactly that ID
+            bool isId = false;
+            const u32 id = mSearchString.trimmed().toUInt(&isId);
+            if (isId)
+            {
+                acceptMatches({id}, ModuleItem::TreeItemType::Module);
+                if (!mFilterGates) acceptMatches({id}, ModuleItem::TreeItemType::Gate);
+                if (!mFilterNets) acceptMatches({id}, ModuleItem::TreeItemType::Net);
+            }
+        }
+    }
     bool ModuleProxyModel::checkRowRecursion(int sourceRow, const QModelIndex& sourceParent, int startIndex, int endIndex, int offset) const
     {
         QModelIndex sourceIndex = sourceModel()->index(sourceRow, 0, sourceParent);
@@ -75,7 +75,8 @@ namespace hal
         mTreeView->setExpandsOnDoubleClick(false);
         mTreeView->setSelectionBehavior(QAbstractItemView::SelectRows);
         mTreeView->setSelectionMode(QAbstractItemView::SingleSelection);
-        mTreeView->expandAllModules();
+        // only expand the top module, all other items are created on demand
+        mTreeView->expandToDepth(0);
         mContentLayout->addWidget(mTreeView);
 
         mSearchbar->setColumnNames(gNetlistRelay->getModuleModel()->headerLabels());
@@ -568,7 +569,10 @@ namespace hal
 
         for (auto module_id : gSelectionRelay->selectedModulesList())
         {
-            QModelIndex index = mModuleProxyModel->mapFromSource(gNetlistRelay->getModuleModel()->getIndex(gNetlistRelay->getModuleModel()->getItem(module_id)));
+            ModuleItem* item = gNetlistRelay->getModuleModel()->fetchItem(module_id);
+            if (!item)
+                continue;
+            QModelIndex index = mModuleProxyModel->mapFromSource(gNetlistRelay->getModuleModel()->getIndex(item));
             module_selection.select(index, index);
         }
 
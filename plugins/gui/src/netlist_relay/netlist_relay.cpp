@@ -23,6 +23,8 @@
 #include <QColorDialog>
 #include <QDebug>
 #include <QInputDialog>
+#include <QSet>
+#include <algorithm>
 #include <functional>
 
 namespace hal
@@ -32,6 +34,7 @@ namespace hal
     {
         connect(FileManager::get_instance(), &FileManager::fileOpened, this, &NetlistRelay::debugHandleFileOpened);    // DEBUG LINE
         connect(this, &NetlistRelay::signalThreadEvent, this, &NetlistRelay::handleThreadEvent, Qt::BlockingQueuedConnection);
+        connect(this, &NetlistRelay::signalThreadEventBatch, this, &NetlistRelay::handleThreadEventBatch, Qt::BlockingQueuedConnection);
     }
 
     NetlistRelay::~NetlistRelay()
@@ -43,32 +46,31 @@ namespace hal
     {
         if (!gNetlist)
             return;    // no netlist -> no registered callbacks
-        gNetlist->get_event_handler()->unregister_callback("gui_netlist_handler");
-        gNetlist->get_event_handler()->unregister_callback("gui_module_handler");
-        gNetlist->get_event_handler()->unregister_callback("gui_gate_handler");
-        gNetlist->get_event_handler()->unregister_callback("gui_net_handler");
-        gNetlist->get_event_handler()->unregister_callback("gui_grouping_handler");
+        gNetlist->get_event_handler()->unregister_callback("gui_netlist_relay");
     }
 
     void NetlistRelay::registerNetlistCallbacks()
     {
         gNetlist->get_event_handler()->register_callback(
-            "gui_netlist_handler",
+            "gui_netlist_relay",
             std::function<void(NetlistEvent::event, Netlist*, u32)>(std::bind(&NetlistRelay::relayNetlistEvent, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)));
 
         gNetlist->get_event_handler()->register_callback(
-            "gui_module_handler",
+            "gui_netlist_relay",
             std::function<void(ModuleEvent::event, Module*, u32)>(std::bind(&NetlistRelay::relayModuleEvent, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)));
 
         gNetlist->get_event_handler()->register_callback(
-            "gui_gate_handler", std::function<void(GateEvent::event, Gate*, u32)>(std::bind(&NetlistRelay::relayGateEvent, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)));
+            "gui_netlist_relay", std::function<void(GateEvent::event, Gate*, u32)>(std::bind(&NetlistRelay::relayGateEvent, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)));
 
         gNetlist->get_event_handler()->register_callback(
-            "gui_net_handler", std::function<void(NetEvent::event, Net*, u32)>(std::bind(&NetlistRelay::relayNetEvent, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)));
+            "gui_netlist_relay", std::function<void(NetEvent::event, Net*, u32)>(std::bind(&NetlistRelay::relayNetEvent, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)));
 
         gNetlist->get_event_handler()->register_callback(
-            "gui_grouping_handler",
+            "gui_netlist_relay",
             std::function<void(GroupingEvent::event, Grouping*, u32)>(std::bind(&NetlistRelay::relayGroupingEvent, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)));
+
+        // while batching is enabled the events arrive here instead, the per-event callbacks above share the name and are hence not executed for batched events
+        gNetlist->get_event_handler()->register_batch_callback("gui_netlist_relay", std::bind(&NetlistRelay::relayEventBatch, this, std::placeholders::_1));
     }
 
     void NetlistRelay::handleNetlistModified()
@@ -205,6 +207,124 @@ namespace hal
         mNotified = false;
     }
 
+    void NetlistRelay::relayEventBatch(const EventBatch& batch)
+    {
+        if (dynamic_cast<PythonThread*>(QThread::currentThread()))
+        {
+            // the connection is blocking, hence the batch and the objects it references stay alive until it is handled
+            Q_EMIT signalThreadEventBatch(const_cast<EventBatch*>(&batch));
+            qApp->processEvents();
+            return;
+        }
+
+        const EventBatch relayed = dropStaleEvents(batch);
+        for (const EventBatch::Entry& entry : relayed.events)
+        {
+            if (const auto* e = std::get_if<EventBatch::Event<NetlistEvent::event, Netlist>>(&entry))
+                relayNetlistEvent(e->event, e->object, e->associated_data);
+            else if (const auto* e = std::get_if<EventBatch::Event<ModuleEvent::event, Module>>(&entry))
+                relayModuleEvent(e->event, e->object, e->associated_data);
+            else if (const auto* e = std::get_if<EventBatch::Event<GateEvent::event, Gate>>(&entry))
+                relayGateEvent(e->event, e->object, e->associated_data);
+            else if (const auto* e = std::get_if<EventBatch::Event<NetEvent::event, Net>>(&entry))
+                relayNetEvent(e->event, e->object, e->associated_data);
+            else if (const auto* e = std::get_if<EventBatch::Event<GroupingEvent::event, Grouping>>(&entry))
+                relayGroupingEvent(e->event, e->object, e->associated_data);
+        }
+
+        Q_EMIT eventBatchRelayed(relayed);
+    }
+
+    EventBatch NetlistRelay::dropStaleEvents(const EventBatch& batch) const
+    {
+        // objects removed later on within the batch are kept alive until the batch has been delivered, but the handlers look up
+        // objects by ID, so only the removal of such an object is relayed, as are only assignments of objects that still exist.
+        // IDs of removed objects get reused, so the batch is scanned backwards to drop assignments referring to an object by an ID
+        // that is removed later on, even if a new object with the same ID exists by now
+        QSet<u32> removedGates;
+        QSet<u32> removedNets;
+        QSet<u32> removedModules;
+        auto gateExists   = [&removedGates](u32 id) { return !removedGates.contains(id) && gNetlist->get_gate_by_id(id) != nullptr; };
+        auto netExists    = [&removedNets](u32 id) { return !removedNets.contains(id) && gNetlist->get_net_by_id(id) != nullptr; };
+        auto moduleExists = [&removedModules](u32 id) { return !removedModules.contains(id) && gNetlist->get_module_by_id(id) != nullptr; };
+
+        // an object removed within the batch is referenced by its ID before its removal, a new object with the same ID after its creation
+        auto trackRemoval = [](QSet<u32>& removedIds, u32 id, bool removed, bool created) {
+            if (removed)
+                removedIds.insert(id);
+            else if (created)
+                removedIds.remove(id);
+        };
+
+        EventBatch relayed;
+        relayed.num_events = batch.num_events;
+        relayed.events.reserve(batch.events.size());
+        for (auto it = batch.events.rbegin(); it != batch.events.rend(); ++it)
+        {
+            const EventBatch::Entry& entry = *it;
+            bool keep                      = true;
+            if (const auto* e = std::get_if<EventBatch::Event<NetlistEvent::event, Netlist>>(&entry))
+            {
+                switch (e->event)
+                {
+                    case NetlistEvent::event::marked_global_vcc:
+                    case NetlistEvent::event::marked_global_gnd:
+                    case NetlistEvent::event::unmarked_global_vcc:
+                    case NetlistEvent::event::unmarked_global_gnd:
+                        keep = gateExists(e->associated_data);
+                        break;
+                    case NetlistEvent::event::marked_global_input:
+                    case NetlistEvent::event::marked_global_output:
+                    case NetlistEvent::event::unmarked_global_input:
+                    case NetlistEvent::event::unmarked_global_output:
+                        keep = netExists(e->associated_data);
+                        break;
+                    default:
+                        break;
+                }
+            }
+            else if (const auto* e = std::get_if<EventBatch::Event<ModuleEvent::event, Module>>(&entry))
+            {
+                if (!gNetlist->is_module_in_netlist(e->object))
+                    keep = e->event == ModuleEvent::event::removed;
+                else if (e->event == ModuleEvent::event::gate_assigned)
+                    keep = gateExists(e->associated_data);
+                else if (e->event == ModuleEvent::event::submodule_added)
+                    keep = moduleExists(e->associated_data);
+                trackRemoval(removedModules, e->object->get_id(), e->event == ModuleEvent::event::removed, e->event == ModuleEvent::event::created);
+            }
+            else if (const auto* e = std::get_if<EventBatch::Event<GateEvent::event, Gate>>(&entry))
+            {
+                keep = gNetlist->is_gate_in_netlist(e->object) || e->event == GateEvent::event::removed;
+                trackRemoval(removedGates, e->object->get_id(), e->event == GateEvent::event::removed, e->event == GateEvent::event::created);
+            }
+            else if (const auto* e = std::get_if<EventBatch::Event<NetEvent::event, Net>>(&entry))
+            {
+                if (!gNetlist->is_net_in_netlist(e->object))
+                    keep = e->event == NetEvent::event::removed;
+                else if (e->event == NetEvent::event::src_added || e->event == NetEvent::event::dst_added)
+                    keep = gateExists(e->associated_data);
+                trackRemoval(removedNets, e->object->get_id(), e->event == NetEvent::event::removed, e->event == NetEvent::event::created);
+            }
+            else if (const auto* e = std::get_if<EventBatch::Event<GroupingEvent::event, Grouping>>(&entry))
+            {
+                if (!gNetlist->is_grouping_in_netlist(e->object))
+                    keep = e->event == GroupingEvent::event::removed;
+                else if (e->event == GroupingEvent::event::gate_assigned)
+                    keep = gateExists(e->associated_data);
+                else if (e->event == GroupingEvent::event::net_assigned)
+                    keep = netExists(e->associated_data);
+                else if (e->event == GroupingEvent::event::module_assigned)
+                    keep = moduleExists(e->associated_data);
+            }
+
+            if (keep)
+                relayed.events.push_back(entry);
+        }
+        std::reverse(relayed.events.begin(), relayed.events.end());
+        return relayed;
+    }
+
     void NetlistRelay::relayNetlistEvent(NetlistEvent::event ev, Netlist* object, u32 associated_data)
     {
         if (!object)
@@ -681,6 +801,11 @@ namespace hal
         }
     }
 
+    void NetlistRelay::handleThreadEventBatch(void* batch)
+    {
+        relayEventBatch(*static_cast<const EventBatch*>(batch));
+    }
+
     void NetlistRelay::debugHandleFileOpened()
     {
         for (Module* m : gNetlist->get_modules())
@@ -0,0 +1,248 @@
+#include "gui/graph_widget/contexts/graph_context.h"
+#include "gui/graph_widget/graphics_scene.h"
+#include "gui/graph_widget/items/nets/graphics_net.h"
+#include "gui/graph_widget/items/nodes/graphics_node.h"
+#include "gui/graph_widget/layouters/graph_layouter.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+
+#include "gui_test_utils.h"
+#include "netlist_test_utils.h"
+
+#include <algorithm>
+#include <functional>
+#include <tuple>
+
+namespace hal
+{
+    class GraphLayouterTest : public ::testing::Test
+    {
+    protected:
+        static constexpr u32 num_layers = 6;
+        static constexpr u32 width      = 5;
+
+        // m_layers[l][j] is gate j of layer l
+        std::vector<std::vector<u32>> m_layers;
+        GraphContext* m_incremental = nullptr;
+        GraphContext* m_full        = nullptr;
+
+        virtual void SetUp()
+        {
+            NO_COUT_BLOCK;
+            test_utils::init_log_channels();
+            gui_test_utils::init_headless_gui();
+            gui_test_utils::load_netlist(create_layers());
+
+            m_incremental = gGraphContextManager->createNewContext("incremental");
+            m_full        = gGraphContextManager->createNewContext("full");
+            m_full->getLayouter()->setIncrementalLayoutEnabled(false);
+        }
+
+        virtual void TearDown()
+        {
+            gGraphContextManager->deleteGraphContext(m_incremental);
+            gGraphContextManager->deleteGraphContext(m_full);
+            gui_test_utils::unload_netlist();
+        }
+
+        /*
+         * Layers of AND gates, each gate being driven by two neighboring gates of the previous layer.
+         * The gates of the first layer are driven by global inputs, the gates of the last layer drive global outputs.
+         */
+        std::unique_ptr<Netlist> create_layers()
+        {
+            std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+            const GateLibrary* gl       = nl->get_gate_library();
+
+            std::vector<Net*> previous;
+            for (u32 j = 0; j < width + 1; j++)
+            {
+                Net* n = nl->create_net("in_" + std::to_string(j));
+                nl->mark_global_input_net(n);
+                previous.push_back(n);
+            }
+
+            m_layers.clear();
+            for (u32 l = 0; l < num_layers; l++)
+            {
+                std::vector<u32> layer;
+                std::vector<Net*> outputs;
+                for (u32 j = 0; j < width; j++)
+                {
+                    Gate* g = nl->create_gate(gl->get_gate_type_by_name("AND2"), "gate_" + std::to_string(l) + "_" + std::to_string(j));
+                    previous.at(j)->add_destination(g, "I0");
+                    previous.at((j + 1) % previous.size())->add_destination(g, "I1");
+
+                    Net* out = nl->create_net("net_" + std::to_string(l) + "_" + std::to_string(j));
+                    out->add_source(g, "O");
+                    if (l + 1 == num_layers)
+                    {
+                        nl->mark_global_output_net(out);
+                    }
+                    outputs.push_back(out);
+                    layer.push_back(g->get_id());
+                }
+                m_layers.push_back(layer);
+                previous = outputs;
+            }
+            return nl;
+        }
+
+        QSet<u32> gates_of_layers(u32 first, u32 last) const
+        {
+            QSet<u32> gates;
+            for (u32 l = first; l <= last; l++)
+            {
+                for (u32 id : m_layers.at(l))
+                {
+                    gates.insert(id);
+                }
+            }
+            return gates;
+        }
+
+        // applies the same modification to both views and waits until both have been laid out again
+        void modify(const std::function<void(GraphContext*)>& modification) const
+        {
+            for (GraphContext* ctx : {m_incremental, m_full})
+            {
+                modification(ctx);
+                gui_test_utils::wait_for_layout(ctx);
+            }
+        }
+
+        static QMap<Node, QPointF> node_positions(const GraphContext* ctx)
+        {
+            QMap<Node, QPointF> positions;
+            for (const NodeBox* box : ctx->getLayouter()->boxes())
+            {
+                positions.insert(box->getNode(), box->item()->pos());
+            }
+            return positions;
+        }
+
+        static QMap<Node, const GraphicsNode*> node_items(const GraphContext* ctx)
+        {
+            QMap<Node, const GraphicsNode*> items;
+            for (const NodeBox* box : ctx->getLayouter()->boxes())
+            {
+                items.insert(box->getNode(), box->item());
+            }
+            return items;
+        }
+
+        // the bounding rectangles of all graphics items of a net, sorted so that views can be compared independent of the item order
+        static std::map<u32, std::vector<std::tuple<qreal, qreal, qreal, qreal>>> net_geometry(GraphContext* ctx)
+        {
+            std::map<u32, std::vector<std::tuple<qreal, qreal, qreal, qreal>>> geometry;
+            for (QGraphicsItem* item : ctx->scene()->items())
+            {
+                const GraphicsNet* net = dynamic_cast<const GraphicsNet*>(item);
+                if (net == nullptr)
+                {
+                    continue;
+                }
+                const QRectF rect = net->sceneBoundingRect();
+                geometry[net->id()].push_back({rect.x(), rect.y(), rect.width(), rect.height()});
+            }
+            for (auto& [id, rects] : geometry)
+            {
+                std::sort(rects.begin(), rects.end());
+            }
+            return geometry;
+        }
+
+        void expect_same_layout(const std::string& step) const
+        {
+            ASSERT_FALSE(m_incremental->sceneUpdateInProgress()) << step;
+            ASSERT_FALSE(m_full->sceneUpdateInProgress()) << step;
+
+            EXPECT_EQ(m_incremental->getLayouter()->nodeToPositionMap(), m_full->getLayouter()->nodeToPositionMap()) << step;
+
+            const QMap<Node, QPointF> incremental_positions = node_positions(m_incremental);
+            const QMap<Node, QPointF> full_positions        = node_positions(m_full);
+            ASSERT_EQ(incremental_positions.keys(), full_positions.keys()) << step;
+            for (const Node& nd : full_positions.keys())
+            {
+                EXPECT_EQ(incremental_positions.value(nd), full_positions.value(nd)) << step << ", node " << nd.id();
+            }
+
+            const auto incremental_nets = net_geometry(m_incremental);
+            const auto full_nets        = net_geometry(m_full);
+            ASSERT_EQ(incremental_nets.size(), full_nets.size()) << step;
+            for (const auto& [id, rects] : full_nets)
+            {
+                const auto it = incremental_nets.find(id);
+                ASSERT_NE(it, incremental_nets.end()) << step << ", net " << id;
+                EXPECT_EQ(it->second, rects) << step << ", net " << id;
+            }
+        }
+    };
+
+    /**
+     * Test that the incremental layout places gates and draws nets exactly like a full layout when gates are added to and removed from a view,
+     * and that it keeps the graphics items of gates which are not affected.
+     *
+     * Functions: GraphLayouter::layout, GraphLayouter::setIncrementalLayoutEnabled
+     */
+    TEST_F(GraphLayouterTest, check_incremental_matches_full_layout)
+    {
+        TEST_START
+        {
+            modify([this](GraphContext* ctx) { ctx->add({}, gates_of_layers(0, 2)); });
+            expect_same_layout("add layers 0 to 2");
+            EXPECT_EQ(m_incremental->getLayouter()->boxes().size(), 3 * width);
+
+            const std::vector<std::pair<std::string, std::function<void(GraphContext*)>>> steps = {
+                {"add layers 3 to 5", [this](GraphContext* ctx) { ctx->add({}, gates_of_layers(3, num_layers - 1)); }},
+                {"remove gates of layers 2 and 4", [this](GraphContext* ctx) { ctx->remove({}, {m_layers[2][1], m_layers[2][3], m_layers[4][0]}); }},
+                {"add removed gate", [this](GraphContext* ctx) { ctx->add({}, {m_layers[2][3]}); }},
+                {"remove layer 0", [this](GraphContext* ctx) { ctx->remove({}, gates_of_layers(0, 0)); }},
+                {"add layer 0", [this](GraphContext* ctx) { ctx->add({}, gates_of_layers(0, 0)); }},
+            };
+
+            for (const auto& [step, modification] : steps)
+            {
+                const QMap<Node, const GraphicsNode*> previous_items = node_items(m_incremental);
+
+                modify(modification);
+                expect_same_layout(step);
+
+                // gates which stay in view keep their graphics items
+                u32 reused = 0;
+                for (const auto& [nd, item] : node_items(m_incremental).toStdMap())
+                {
+                    if (previous_items.value(nd) == item)
+                    {
+                        reused++;
+                    }
+                }
+                EXPECT_GT(reused, 0) << step;
+            }
+        }
+        TEST_END
+    }
+
+    /**
+     * Test that a full layout requested for a view with incremental layout enabled yields the same scene.
+     *
+     * Functions: GraphContext::scheduleFullLayout, GraphLayouter::requestFullLayout
+     */
+    TEST_F(GraphLayouterTest, check_requested_full_layout)
+    {
+        TEST_START
+        {
+            modify([this](GraphContext* ctx) { ctx->add({}, gates_of_layers(0, num_layers - 1)); });
+            modify([this](GraphContext* ctx) { ctx->remove({}, {m_layers[3][2]}); });
+            expect_same_layout("remove gate");
+
+            const QMap<Node, QPointF> before = node_positions(m_incremental);
+            m_incremental->scheduleFullLayout();
+            gui_test_utils::wait_for_layout(m_incremental);
+            EXPECT_EQ(node_positions(m_incremental), before);
+            expect_same_layout("full layout");
+        }
+        TEST_END
+    }
+}    // namespace hal
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "gui/comment_system/comment_manager.h"
+#include "gui/file_status_manager/file_status_manager.h"
+#include "gui/graph_widget/contexts/graph_context.h"
+#include "gui/graph_widget/graph_context_manager.h"
+#include "gui/gui_globals.h"
+#include "gui/netlist_relay/netlist_relay.h"
+#include "gui/selection_relay/selection_relay.h"
+#include "hal_core/netlist/netlist.h"
+
+#include <QApplication>
+#include <memory>
+
+namespace hal
+{
+    namespace gui_test_utils
+    {
+        /**
+         * Create the application and the global relays and managers the graph view and the models depend on.
+         * The offscreen platform plugin is used, so the tests run without a display.
+         * Does nothing if called again.
+         */
+        inline void init_headless_gui()
+        {
+            static int argc     = 1;
+            static char arg0[]  = "runTest-gui";
+            static char* argv[] = {arg0, nullptr};
+            static std::unique_ptr<QApplication> app;
+            if (app != nullptr)
+            {
+                return;
+            }
+
+            qputenv("QT_QPA_PLATFORM", "offscreen");
+            app = std::make_unique<QApplication>(argc, argv);
+
+            gNetlistRelay        = new NetlistRelay();
+            gSelectionRelay      = new SelectionRelay();
+            gFileStatusManager   = new FileStatusManager();
+            gGraphContextManager = new GraphContextManager();
+            gCommentManager      = new CommentManager();
+        }
+
+        /**
+         * Make the given netlist the one shown by the GUI and forward its events to the netlist relay.
+         *
+         * @param[in] nl - The netlist.
+         */
+        inline void load_netlist(std::unique_ptr<Netlist> nl)
+        {
+            gNetlistOwner = std::move(nl);
+            gNetlist      = gNetlistOwner.get();
+            gNetlistRelay->registerNetlistCallbacks();
+        }
+
+        /**
+         * Detach the netlist loaded by load_netlist from the GUI and destroy it.
+         */
+        inline void unload_netlist()
+        {
+            gNetlistRelay->unregisterNetlistCallbacks();
+            gNetlist = nullptr;
+            gNetlistOwner.reset();
+        }
+
+        /**
+         * Process GUI events until the scene of the given context is no longer being updated.
+         *
+         * @param[in] ctx - The graph context.
+         */
+        inline void wait_for_layout(const GraphContext* ctx)
+        {
+            while (ctx->sceneUpdateInProgress())
+            {
+                QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+            }
+        }
+    }    // namespace gui_test_utils
+}    // namespace hal
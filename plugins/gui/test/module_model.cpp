@@ -0,0 +1,521 @@
+#include "gui/module_model/module_item.h"
+#include "gui/module_model/module_model.h"
+#include "gui/module_model/module_proxy_model.h"
+#include "gui/searchbar/searchoptions.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+
+#include "gui_test_utils.h"
+#include "netlist_test_utils.h"
+
+#include <QCoreApplication>
+#include <set>
+
+namespace hal
+{
+    // exposes the row filter based on the search index and the row by row matching it replaced
+    class ScanningProxyModel : public ModuleProxyModel
+    {
+    public:
+        bool accepts(int row, const QModelIndex& parent) const
+        {
+            return filterAcceptsRow(row, parent);
+        }
+
+        bool scans(int row, const QModelIndex& parent) const
+        {
+            return checkRowRecursion(row, parent, 0, 2);
+        }
+    };
+
+    class ModuleModelTest : public ::testing::Test
+    {
+    protected:
+        typedef std::pair<ModuleItem::TreeItemType, u32> TypedId;
+
+        ModuleModel* m_model = nullptr;
+        Netlist* m_netlist   = nullptr;
+
+        Module* m_top;
+        Module* m_mod_a;
+        Module* m_mod_b;
+        Module* m_mod_c;
+        Module* m_mod_empty;
+        std::map<std::string, Gate*> m_gates;
+        std::map<std::string, Net*> m_nets;
+
+        virtual void SetUp()
+        {
+            NO_COUT_BLOCK;
+            test_utils::init_log_channels();
+            gui_test_utils::init_headless_gui();
+            gui_test_utils::load_netlist(test_utils::create_empty_netlist());
+            m_netlist = gNetlist;
+            create_hierarchy();
+
+            // the relay forwards the netlist events to its module model
+            m_model = gNetlistRelay->getModuleModel();
+            m_model->init();
+        }
+
+        virtual void TearDown()
+        {
+            m_model->clear();
+            gui_test_utils::unload_netlist();
+        }
+
+        /*
+         * top: g0, g1, module a (a0, a1), module b (b0, module c (c0)), empty module
+         * chain of buffers g0 -> a0 -> a1 -> b0 -> c0 -> g1, i.e., net g0_a0 connects top and a, net a0_a1 is internal to a, and so on
+         */
+        void create_hierarchy()
+        {
+            const GateLibrary* gl = m_netlist->get_gate_library();
+
+            const std::vector<std::string> chain = {"g0", "a0", "a1", "b0", "c0", "g1"};
+            for (const std::string& name : chain)
+            {
+                m_gates[name] = m_netlist->create_gate(gl->get_gate_type_by_name("BUF"), name);
+            }
+            for (u32 i = 0; i + 1 < chain.size(); i++)
+            {
+                Net* n = m_netlist->create_net(chain.at(i) + "_" + chain.at(i + 1));
+                n->add_source(m_gates.at(chain.at(i)), "O");
+                n->add_destination(m_gates.at(chain.at(i + 1)), "I");
+                m_nets[n->get_name()] = n;
+            }
+
+            m_top       = m_netlist->get_top_module();
+            m_mod_a     = m_netlist->create_module("a", m_top, {m_gates.at("a0"), m_gates.at("a1")});
+            m_mod_b     = m_netlist->create_module("b", m_top, {m_gates.at("b0")});
+            m_mod_c     = m_netlist->create_module("c", m_mod_b, {m_gates.at("c0")});
+            m_mod_empty = m_netlist->create_module("empty", m_top);
+        }
+
+        QModelIndex top_index() const
+        {
+            return m_model->index(0, 0, QModelIndex());
+        }
+
+        std::set<TypedId> children(const QModelIndex& parent) const
+        {
+            std::set<TypedId> ids;
+            for (int row = 0; row < m_model->rowCount(parent); row++)
+            {
+                const ModuleItem* item = m_model->getItem(m_model->index(row, 0, parent));
+                ids.insert({item->getType(), item->id()});
+            }
+            return ids;
+        }
+
+        // the parent module of an item if it has been created, 0 otherwise
+        u32 parent_of(u32 id, ModuleItem::TreeItemType type) const
+        {
+            const ModuleItem* item = m_model->getItem(id, type);
+            if (item == nullptr)
+            {
+                return 0;
+            }
+            return static_cast<const ModuleItem*>(item->getParent())->id();
+        }
+
+        // every created item is known to the model under its ID and can be reached through its model index
+        void expect_consistent(const QModelIndex& parent) const
+        {
+            const ModuleItem* parent_item = m_model->getItem(parent);
+            ASSERT_NE(parent_item, nullptr);
+            EXPECT_EQ(m_model->rowCount(parent), parent_item->getChildCount()) << "module " << parent_item->id();
+            for (int row = 0; row < m_model->rowCount(parent); row++)
+            {
+                const QModelIndex index = m_model->index(row, 0, parent);
+                ModuleItem* item        = m_model->getItem(index);
+                ASSERT_NE(item, nullptr);
+                EXPECT_EQ(item->getParent(), parent_item);
+                EXPECT_EQ(m_model->getItem(item->id(), item->getType()), item);
+                EXPECT_EQ(m_model->getIndex(item), index);
+                if (item->getType() == ModuleItem::TreeItemType::Module)
+                {
+                    EXPECT_TRUE(m_netlist->get_module_by_id(item->id()) != nullptr);
+                    expect_consistent(index);
+                }
+            }
+        }
+
+        // all items shown by the proxy model below the given proxy index
+        std::set<TypedId> visible(const ModuleProxyModel& proxy, const QModelIndex& parent = QModelIndex()) const
+        {
+            std::set<TypedId> ids;
+            for (int row = 0; row < proxy.rowCount(parent); row++)
+            {
+                const QModelIndex index = proxy.index(row, 0, parent);
+                const ModuleItem* item  = m_model->getItem(proxy.mapToSource(index));
+                ids.insert({item->getType(), item->id()});
+                const std::set<TypedId> below = visible(proxy, index);
+                ids.insert(below.begin(), below.end());
+            }
+            return ids;
+        }
+
+        // every row below the given source index is accepted by the search index if and only if the row or one of its descendants matches when scanned
+        void expect_same_matches(const ScanningProxyModel& proxy, const QModelIndex& parent = QModelIndex()) const
+        {
+            for (int row = 0; row < m_model->rowCount(parent); row++)
+            {
+                const QModelIndex index = m_model->index(row, 0, parent);
+                const ModuleItem* item  = m_model->getItem(index);
+                EXPECT_EQ(proxy.accepts(row, parent), proxy.scans(row, parent)) << "item " << item->id() << " of type " << (int)item->getType();
+                expect_same_matches(proxy, index);
+            }
+        }
+    };
+
+    /**
+     * Test that the children of a module are created when its index is expanded and not before.
+     *
+     * Functions: ModuleModel::canFetchMore, ModuleModel::fetchMore, ModuleModel::hasChildren, ModuleModel::fetchItem
+     */
+    TEST_F(ModuleModelTest, check_fetch_more)
+    {
+        TEST_START
+        {
+            const QModelIndex top = top_index();
+            ASSERT_TRUE(top.isValid());
+            EXPECT_TRUE(m_model->hasChildren(top));
+            EXPECT_TRUE(m_model->canFetchMore(top));
+            EXPECT_EQ(m_model->rowCount(top), 0);
+            EXPECT_EQ(m_model->getItem(m_mod_a->get_id()), nullptr);
+
+            m_model->fetchMore(top);
+            EXPECT_FALSE(m_model->canFetchMore(top));
+            std::set<TypedId> expected = {{ModuleItem::TreeItemType::Module, m_mod_a->get_id()},
+                                          {ModuleItem::TreeItemType::Module, m_mod_b->get_id()},
+                                          {ModuleItem::TreeItemType::Module, m_mod_empty->get_id()},
+                                          {ModuleItem::TreeItemType::Gate, m_gates.at("g0")->get_id()},
+                                          {ModuleItem::TreeItemType::Gate, m_gates.at("g1")->get_id()},
+                                          {ModuleItem::TreeItemType::Net, m_nets.at("g0_a0")->get_id()},
+                                          {ModuleItem::TreeItemType::Net, m_nets.at("a1_b0")->get_id()},
+                                          {ModuleItem::TreeItemType::Net, m_nets.at("c0_g1")->get_id()}};
+            EXPECT_EQ(children(top), expected);
+
+            // fetching again does not duplicate any item
+            m_model->fetchMore(top);
+            EXPECT_EQ(children(top), expected);
+
+            // submodules are not expanded yet
+            const QModelIndex index_a = m_model->getIndex(m_model->getItem(m_mod_a->get_id()));
+            EXPECT_TRUE(m_model->hasChildren(index_a));
+            EXPECT_TRUE(m_model->canFetchMore(index_a));
+            EXPECT_EQ(m_model->getItem(m_gates.at("a0")->get_id(), ModuleItem::TreeItemType::Gate), nullptr);
+
+            const QModelIndex index_empty = m_model->getIndex(m_model->getItem(m_mod_empty->get_id()));
+            EXPECT_FALSE(m_model->hasChildren(index_empty));
+
+            m_model->fetchMore(index_a);
+            expected = {{ModuleItem::TreeItemType::Gate, m_gates.at("a0")->get_id()},
+                        {ModuleItem::TreeItemType::Gate, m_gates.at("a1")->get_id()},
+                        {ModuleItem::TreeItemType::Net, m_nets.at("a0_a1")->get_id()}};
+            EXPECT_EQ(children(index_a), expected);
+
+            // fetching a nested item expands all modules along its path
+            ModuleItem* item_c0 = m_model->fetchItem(m_gates.at("c0")->get_id(), ModuleItem::TreeItemType::Gate);
+            ASSERT_NE(item_c0, nullptr);
+            EXPECT_EQ(static_cast<const ModuleItem*>(item_c0->getParent())->id(), m_mod_c->get_id());
+            EXPECT_TRUE(m_model->getItem(m_mod_b->get_id())->isFetched());
+            EXPECT_EQ(parent_of(m_nets.at("b0_c0")->get_id(), ModuleItem::TreeItemType::Net), m_mod_b->get_id());
+
+            expect_consistent(top);
+        }
+        TEST_END
+    }
+
+    /**
+     * Test that nets without sources and destinations are shown in the top module and kept up to date before and after it is expanded.
+     *
+     * Functions: ModuleModel::fetchMore, ModuleModel::addNet, ModuleModel::removeNet, ModuleModel::updateNet
+     */
+    TEST_F(ModuleModelTest, check_unconnected_nets)
+    {
+        TEST_START
+        {
+            typedef ModuleItem::TreeItemType Type;
+
+            Net* floating  = m_netlist->create_net("floating");
+            Net* connected = m_netlist->create_net("connected");
+            Net* deleted   = m_netlist->create_net("deleted");
+            const u32 deleted_id = deleted->get_id();
+            ASSERT_TRUE(m_netlist->delete_net(deleted));
+            ASSERT_NE(connected->add_destination(m_gates.at("g0"), "I"), nullptr);
+
+            const QModelIndex top = top_index();
+            m_model->fetchMore(top);
+            EXPECT_EQ(parent_of(floating->get_id(), Type::Net), m_top->get_id());
+            EXPECT_EQ(m_model->getItem(deleted_id, Type::Net), nullptr);
+            EXPECT_EQ(children(top).count({Type::Net, connected->get_id()}), 1);
+            EXPECT_EQ((size_t)m_model->rowCount(top), children(top).size());
+
+            // nets that lose or gain their connections within the top module are shown exactly once
+            ASSERT_TRUE(connected->remove_destination(m_gates.at("g0"), "I"));
+            EXPECT_EQ(parent_of(connected->get_id(), Type::Net), m_top->get_id());
+            ASSERT_NE(floating->add_source(m_gates.at("g1"), "O"), nullptr);
+            EXPECT_EQ(children(top).count({Type::Net, floating->get_id()}), 1);
+
+            Net* created = m_netlist->create_net("created");
+            EXPECT_EQ(parent_of(created->get_id(), Type::Net), m_top->get_id());
+            const u32 created_id = created->get_id();
+            ASSERT_TRUE(m_netlist->delete_net(created));
+            EXPECT_EQ(m_model->getItem(created_id, Type::Net), nullptr);
+
+            EXPECT_EQ((size_t)m_model->rowCount(top), children(top).size());
+            expect_consistent(top);
+        }
+        TEST_END
+    }
+
+    /**
+     * Test that gates and their nets follow when gates are moved between expanded and collapsed modules.
+     *
+     * Functions: ModuleModel::handleModuleGateAssinged, ModuleModel::removeGate, ModuleModel::updateNet
+     */
+    TEST_F(ModuleModelTest, check_move_gates)
+    {
+        TEST_START
+        {
+            m_model->fetchMore(top_index());
+            m_model->fetchMore(m_model->getIndex(m_model->getItem(m_mod_a->get_id())));
+
+            // top -> a, both expanded: net g0_a0 becomes internal to a
+            ASSERT_TRUE(m_mod_a->assign_gate(m_gates.at("g0")));
+            EXPECT_EQ(parent_of(m_gates.at("g0")->get_id(), ModuleItem::TreeItemType::Gate), m_mod_a->get_id());
+            EXPECT_EQ(parent_of(m_nets.at("g0_a0")->get_id(), ModuleItem::TreeItemType::Net), m_mod_a->get_id());
+            expect_consistent(top_index());
+
+            // a -> b, b collapsed: items of the gate and of its nets inside b are created once b is expanded
+            ASSERT_TRUE(m_mod_b->assign_gate(m_gates.at("a1")));
+            EXPECT_EQ(m_model->getItem(m_gates.at("a1")->get_id(), ModuleItem::TreeItemType::Gate), nullptr);
+            EXPECT_EQ(m_model->getItem(m_nets.at("a1_b0")->get_id(), ModuleItem::TreeItemType::Net), nullptr);
+            EXPECT_EQ(parent_of(m_nets.at("a0_a1")->get_id(), ModuleItem::TreeItemType::Net), m_top->get_id());
+            expect_consistent(top_index());
+
+            m_model->fetchMore(m_model->getIndex(m_model->getItem(m_mod_b->get_id())));
+            EXPECT_EQ(parent_of(m_gates.at("a1")->get_id(), ModuleItem::TreeItemType::Gate), m_mod_b->get_id());
+            EXPECT_EQ(parent_of(m_nets.at("a1_b0")->get_id(), ModuleItem::TreeItemType::Net), m_mod_b->get_id());
+
+            // c -> top, c collapsed
+            ASSERT_TRUE(m_top->assign_gate(m_gates.at("c0")));
+            EXPECT_EQ(parent_of(m_gates.at("c0")->get_id(), ModuleItem::TreeItemType::Gate), m_top->get_id());
+            EXPECT_EQ(parent_of(m_nets.at("b0_c0")->get_id(), ModuleItem::TreeItemType::Net), m_top->get_id());
+            EXPECT_EQ(parent_of(m_nets.at("c0_g1")->get_id(), ModuleItem::TreeItemType::Net), m_top->get_id());
+
+            const QModelIndex index_c = m_model->getIndex(m_model->getItem(m_mod_c->get_id()));
+            EXPECT_FALSE(m_model->hasChildren(index_c));
+            expect_consistent(top_index());
+        }
+        TEST_END
+    }
+
+    /**
+     * Test that removing modules which have not been expanded yet moves their contents to the parent module.
+     *
+     * Functions: ModuleModel::removeModule, ModuleModel::updateModuleParent, ModuleModel::handleModuleGateAssinged
+     */
+    TEST_F(ModuleModelTest, check_remove_unfetched_module)
+    {
+        TEST_START
+        {
+            m_model->fetchMore(top_index());
+            ASSERT_NE(m_model->getItem(m_mod_b->get_id()), nullptr);
+            ASSERT_EQ(m_model->getItem(m_mod_c->get_id()), nullptr);
+
+            // c has never been created, its gate moves to b which is collapsed
+            const u32 id_c = m_mod_c->get_id();
+            ASSERT_TRUE(m_netlist->delete_module(m_mod_c));
+            EXPECT_EQ(m_model->getItem(id_c), nullptr);
+            EXPECT_EQ(m_model->getItem(m_gates.at("c0")->get_id(), ModuleItem::TreeItemType::Gate), nullptr);
+            expect_consistent(top_index());
+
+            // b has been created but not expanded, its contents move to top which is expanded
+            const u32 id_b = m_mod_b->get_id();
+            ASSERT_TRUE(m_netlist->delete_module(m_mod_b));
+            EXPECT_EQ(m_model->getItem(id_b), nullptr);
+            EXPECT_EQ(parent_of(m_gates.at("b0")->get_id(), ModuleItem::TreeItemType::Gate), m_top->get_id());
+            EXPECT_EQ(parent_of(m_gates.at("c0")->get_id(), ModuleItem::TreeItemType::Gate), m_top->get_id());
+            EXPECT_EQ(parent_of(m_nets.at("b0_c0")->get_id(), ModuleItem::TreeItemType::Net), m_top->get_id());
+            EXPECT_EQ(parent_of(m_nets.at("c0_g1")->get_id(), ModuleItem::TreeItemType::Net), m_top->get_id());
+            expect_consistent(top_index());
+
+            // removing an expanded module drops the items of its contents
+            m_model->fetchMore(m_model->getIndex(m_model->getItem(m_mod_a->get_id())));
+            const u32 id_a = m_mod_a->get_id();
+            ASSERT_TRUE(m_netlist->delete_module(m_mod_a));
+            EXPECT_EQ(m_model->getItem(id_a), nullptr);
+            EXPECT_EQ(parent_of(m_gates.at("a0")->get_id(), ModuleItem::TreeItemType::Gate), m_top->get_id());
+            EXPECT_EQ(parent_of(m_nets.at("a0_a1")->get_id(), ModuleItem::TreeItemType::Net), m_top->get_id());
+            expect_consistent(top_index());
+        }
+        TEST_END
+    }
+
+    /**
+     * Test that the search of the proxy model shows the matching rows and their ancestors and that the search index is only built once the user searches.
+     *
+     * Functions: ModuleProxyModel::startSearch, ModuleProxyModel::filterAcceptsRow
+     */
+    TEST_F(ModuleModelTest, check_proxy_search)
+    {
+        TEST_START
+        {
+            typedef ModuleItem::TreeItemType Type;
+
+            ModuleProxyModel proxy;
+            proxy.setSourceModel(m_model);
+            proxy.toggleFilterGates();
+            proxy.toggleFilterNets();
+            m_model->fetchItem(m_gates.at("c0")->get_id(), Type::Gate);
+            m_model->fetchMore(m_model->getIndex(m_model->getItem(m_mod_a->get_id())));
+            QCoreApplication::processEvents();
+            EXPECT_FALSE(m_netlist->is_search_index_enabled());
+
+            // the name column is searched only, so that IDs cannot match
+            proxy.startSearch("a0", SearchOptions::toInt(false, false, false, {0}));
+            EXPECT_TRUE(m_netlist->is_search_index_enabled());
+            std::set<TypedId> expected = {{Type::Module, m_top->get_id()},
+                                          {Type::Module, m_mod_a->get_id()},
+                                          {Type::Gate, m_gates.at("a0")->get_id()},
+                                          {Type::Net, m_nets.at("g0_a0")->get_id()},
+                                          {Type::Net, m_nets.at("a0_a1")->get_id()}};
+            EXPECT_EQ(visible(proxy), expected);
+
+            // renaming an object updates the index and hence the accepted rows
+            m_gates.at("g1")->set_name("xa0x");
+            QCoreApplication::processEvents();
+            expected.insert({Type::Gate, m_gates.at("g1")->get_id()});
+            EXPECT_EQ(visible(proxy), expected);
+
+            proxy.startSearch("b", SearchOptions::toInt(true, false, false, {0}));
+            expected = {{Type::Module, m_top->get_id()}, {Type::Module, m_mod_b->get_id()}};
+            EXPECT_EQ(visible(proxy), expected);
+
+            proxy.startSearch("^c", SearchOptions::toInt(false, false, true, {0}));
+            expected = {{Type::Module, m_top->get_id()},
+                        {Type::Module, m_mod_b->get_id()},
+                        {Type::Module, m_mod_c->get_id()},
+                        {Type::Gate, m_gates.at("c0")->get_id()},
+                        {Type::Net, m_nets.at("c0_g1")->get_id()}};
+            EXPECT_EQ(visible(proxy), expected);
+
+            // the same matches are found by the linear scan without index
+            const auto indexed = m_netlist->search("^c", SearchIndex::Field::name, false, false, true);
+            m_netlist->enable_search_index(false);
+            const auto scanned = m_netlist->search("^c", SearchIndex::Field::name, false, false, true);
+            ASSERT_TRUE(indexed.is_ok());
+            ASSERT_TRUE(scanned.is_ok());
+            EXPECT_EQ(indexed.get().modules, scanned.get().modules);
+            EXPECT_EQ(indexed.get().gates, scanned.get().gates);
+            EXPECT_EQ(indexed.get().nets, scanned.get().nets);
+
+            proxy.startSearch("", 0);
+            EXPECT_EQ(visible(proxy).size(), m_netlist->get_modules().size() + m_netlist->get_gates().size() + m_netlist->get_nets().size());
+        }
+        TEST_END
+    }
+
+    /**
+     * Test that the search index accepts exactly the rows that the row by row matching of the search bar accepts once all items have been fetched.
+     *
+     * Functions: ModuleProxyModel::startSearch, ModuleProxyModel::filterAcceptsRow, ModuleProxyModel::checkRowRecursion
+     */
+    TEST_F(ModuleModelTest, check_proxy_search_matches_scan)
+    {
+        TEST_START
+        {
+            ScanningProxyModel proxy;
+            proxy.setSourceModel(m_model);
+            proxy.toggleFilterGates();
+            proxy.toggleFilterNets();
+            m_model->fetchItem(m_gates.at("c0")->get_id(), ModuleItem::TreeItemType::Gate);
+            m_model->fetchMore(m_model->getIndex(m_model->getItem(m_mod_a->get_id())));
+            m_netlist->create_net("A0_floating");
+
+            // exact match, case sensitivity, regular expression
+            const std::vector<std::pair<QString, int>> searches = {{"a", SearchOptions::toInt(false, false, false, {0})},
+                                                                   {"A0", SearchOptions::toInt(false, false, false, {0})},
+                                                                   {"A0", SearchOptions::toInt(false, true, false, {0})},
+                                                                   {"b0", SearchOptions::toInt(true, false, false, {0})},
+                                                                   {"^[ac]0", SearchOptions::toInt(false, false, true, {0})},
+                                                                   {"_g1$", SearchOptions::toInt(false, true, true, {0})},
+                                                                   {"missing", SearchOptions::toInt(false, false, false, {0})}};
+            for (const auto& [text, options] : searches)
+            {
+                SCOPED_TRACE(text.toStdString());
+                proxy.startSearch(text, options);
+                expect_same_matches(proxy);
+            }
+        }
+        TEST_END
+    }
+
+    /**
+     * Test that a batch of events is relayed to the module model without handling objects that have been removed again within the batch.
+     *
+     * Functions: NetlistRelay::relayEventBatch, NetlistRelay::eventBatchRelayed
+     */
+    TEST_F(ModuleModelTest, check_event_batch)
+    {
+        TEST_START
+        {
+            typedef ModuleItem::TreeItemType Type;
+            typedef std::vector<std::pair<u32, u32>> IdRanges;
+
+            m_model->fetchMore(top_index());
+            m_model->fetchMore(m_model->getIndex(m_model->getItem(m_mod_a->get_id())));
+
+            u32 num_batches = 0;
+            IdRanges created_gates, removed_gates, created_modules;
+            QObject receiver;
+            QObject::connect(gNetlistRelay, &NetlistRelay::eventBatchRelayed, &receiver, [&](const EventBatch& batch) {
+                num_batches++;
+                created_gates   = batch.get_id_ranges(GateEvent::event::created);
+                removed_gates   = batch.get_id_ranges(GateEvent::event::removed);
+                created_modules = batch.get_id_ranges(ModuleEvent::event::created);
+            });
+
+            u32 tmp_gate_id;
+            u32 tmp_net_id;
+            u32 tmp_module_id;
+            {
+                EventBatchGuard guard(m_netlist->get_event_handler());
+
+                // create -> delete
+                Gate* tmp_gate = m_netlist->create_gate(m_netlist->get_gate_library()->get_gate_type_by_name("BUF"), "tmp_gate");
+                tmp_gate_id    = tmp_gate->get_id();
+                ASSERT_TRUE(m_mod_a->assign_gate(tmp_gate));
+                ASSERT_TRUE(m_netlist->delete_gate(tmp_gate));
+                Net* tmp_net = m_netlist->create_net("tmp_net");
+                tmp_net_id   = tmp_net->get_id();
+                ASSERT_TRUE(m_netlist->delete_net(tmp_net));
+
+                // assign -> delete parent
+                Module* tmp_module = m_netlist->create_module("tmp_module", m_top, {m_gates.at("g1")});
+                tmp_module_id      = tmp_module->get_id();
+                ASSERT_TRUE(m_netlist->delete_module(tmp_module));
+
+                EXPECT_EQ(num_batches, 0);
+            }
+
+            EXPECT_EQ(num_batches, 1);
+            EXPECT_EQ(m_model->getItem(tmp_gate_id, Type::Gate), nullptr);
+            EXPECT_EQ(m_model->getItem(tmp_net_id, Type::Net), nullptr);
+            EXPECT_EQ(m_model->getItem(tmp_module_id), nullptr);
+            EXPECT_EQ(parent_of(m_gates.at("g1")->get_id(), Type::Gate), m_top->get_id());
+            expect_consistent(top_index());
+
+            // objects that did not survive the batch are only reported as removed
+            EXPECT_TRUE(created_gates.empty());
+            EXPECT_TRUE(created_modules.empty());
+            EXPECT_EQ(removed_gates, IdRanges({{tmp_gate_id, tmp_gate_id}}));
+        }
+        TEST_END
+    }
+}    // namespace hal
@@ -8,6 +8,7 @@
 #include "hal_core/netlist/gate_library/gate_type_component/lut_component.h"
 #include "hal_core/netlist/gate_library/gate_type_component/state_component.h"
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/trace.h"
 #include "hal_core/utilities/result.h"
 #include "rapidjson/filereadstream.h"
 #include "rapidjson/stringbuffer.h"
@@ -16,6 +17,8 @@ namespace hal
 {
     Result<std::unique_ptr<GateLibrary>> HGLParser::parse(const std::filesystem::path& file_path)
     {
+        HAL_TRACE_SCOPE("HGLParser::parse");
+
         m_path = file_path;
 
         FILE* fp = fopen(file_path.string().c_str(), "r");
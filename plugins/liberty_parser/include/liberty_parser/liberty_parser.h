@@ -36,10 +36,13 @@
 #include <filesystem>
 #include <map>
 #include <optional>
+#include <set>
 #include <unordered_map>
 
 namespace hal
 {
+    class Netlist;
+
     /**
      * @ingroup netlist
      */
@@ -51,6 +54,7 @@ namespace hal
 
         /**
          * Deserializes a gate library in Liberty format from the string stream into a gate library object.
+         * The file is read in chunks and groups that are not required to construct gate types, such as timing, power, and lookup table groups, are skipped while reading.
          * In order to also support lookup tables (LUTs) the following extension is allowed:
          *
          * lut(<function name>) {
@@ -67,6 +71,27 @@ namespace hal
          */
         Result<std::unique_ptr<GateLibrary>> parse(const std::filesystem::path& file_path) override;
 
+        /**
+         * Deserializes only the given cells of a gate library in Liberty format into a gate library object.
+         * All other cells are skipped while reading the file, which reduces the time and memory required to load large libraries of which only few cells are used.
+         * Cells that do not exist within the library are ignored.
+         *
+         * @param[in] file_path - Path to the file containing the gate library definition.
+         * @param[in] cell_names - The names of the cells to load.
+         * @returns The gate library on success, an error otherwise.
+         */
+        Result<std::unique_ptr<GateLibrary>> parse(const std::filesystem::path& file_path, const std::set<std::string>& cell_names);
+
+        /**
+         * Deserializes only those cells of a gate library in Liberty format into a gate library object that are instantiated as gate types within the given netlist.
+         * Gate types are matched to cells by name.
+         *
+         * @param[in] file_path - Path to the file containing the gate library definition.
+         * @param[in] netlist - The netlist whose gate types shall be loaded.
+         * @returns The gate library on success, an error otherwise.
+         */
+        Result<std::unique_ptr<GateLibrary>> parse(const std::filesystem::path& file_path, const Netlist* netlist);
+
     private:
         struct type_group
         {
@@ -150,14 +175,14 @@ namespace hal
         };
 
         std::unique_ptr<GateLibrary> m_gate_lib;
-        std::stringstream m_fs;
         std::filesystem::path m_path;
+        const std::set<std::string>* m_cell_filter = nullptr;
 
         TokenStream<std::string> m_token_stream;
         std::map<std::string, type_group> m_bus_types;
         std::set<std::string> m_cell_names;
 
-        void tokenize();
+        void tokenize(std::istream& stream);
         Result<std::monostate> parse_tokens();
 
         Result<cell_group> parse_cell(TokenStream<std::string>& library_stream);
@@ -169,7 +194,6 @@ namespace hal
         Result<latch_group> parse_latch(TokenStream<std::string>& str);
         Result<std::monostate> construct_gate_type(cell_group&& cell);
 
-        void remove_comments(std::string& line, bool& multi_line_comment);
         std::vector<std::string> tokenize_function(const std::string& function);
         std::map<std::string, std::string> expand_bus_function(const std::map<std::string, bus_group>& buses, const std::vector<std::string>& pin_names, const std::string& function);
         std::string prepare_pin_function(const std::map<std::string, bus_group>& buses, const std::string& function);
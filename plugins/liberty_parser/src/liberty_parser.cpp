@@ -1,11 +1,15 @@
 #include "liberty_parser/liberty_parser.h"
 
 #include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/gate_library/gate_type_component/ff_component.h"
 #include "hal_core/netlist/gate_library/gate_type_component/latch_component.h"
+#include "hal_core/netlist/netlist.h"
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/trace.h"
 
 #include <fstream>
+#include <unordered_set>
 
 // TODO remove LUT parsing
 
@@ -13,21 +17,21 @@ namespace hal
 {
     Result<std::unique_ptr<GateLibrary>> LibertyParser::parse(const std::filesystem::path& file_path)
     {
+        HAL_TRACE_SCOPE("LibertyParser::parse");
+
         m_path = file_path;
 
         {
             std::ifstream ifs;
-            ifs.open(m_path.string(), std::ifstream::in);
+            ifs.open(m_path.string(), std::ifstream::in | std::ifstream::binary);
             if (!ifs.is_open())
             {
                 return ERR("could not parse Liberty file '" + m_path.string() + "' : unable to open file");
             }
-            m_fs << ifs.rdbuf();
-            ifs.close();
-        }
 
-        // tokenize file
-        tokenize();
+            // tokenize file
+            tokenize(ifs);
+        }
 
         // parse tokens into intermediate format
         try
@@ -52,65 +56,214 @@ namespace hal
         return OK(std::move(m_gate_lib));
     }
 
-    void LibertyParser::tokenize()
+    Result<std::unique_ptr<GateLibrary>> LibertyParser::parse(const std::filesystem::path& file_path, const std::set<std::string>& cell_names)
+    {
+        m_cell_filter = &cell_names;
+        auto res      = parse(file_path);
+        m_cell_filter = nullptr;
+        return res;
+    }
+
+    Result<std::unique_ptr<GateLibrary>> LibertyParser::parse(const std::filesystem::path& file_path, const Netlist* netlist)
     {
-        std::string delimiters = "{}()[];:\",";
+        if (netlist == nullptr)
+        {
+            return ERR("could not parse Liberty file '" + file_path.string() + "': netlist is a 'nullptr'");
+        }
+
+        std::set<std::string> cell_names;
+        for (const Gate* gate : netlist->get_gates())
+        {
+            cell_names.insert(gate->get_type()->get_name());
+        }
+
+        return parse(file_path, cell_names);
+    }
+
+    void LibertyParser::tokenize(std::istream& stream)
+    {
+        HAL_TRACE_SCOPE("LibertyParser::tokenize");
+
+        // groups that are evaluated by the parser, all other groups (timing, power, lookup tables, ...) are skipped without creating tokens
+        static const std::unordered_set<std::string> parsed_groups = {"library", "type", "cell", "pin", "pg_pin", "bus", "ff", "latch", "lut"};
+
+        const std::string delimiters = "{}()[];:\",";
         std::string current_token;
-        u32 line_number = 0;
+        u32 line_number = 1;
 
-        std::string line;
         bool in_string          = false;
         bool was_in_string      = false;
         bool multi_line_comment = false;
+        bool pending_slash      = false;
+        bool pending_star       = false;
+
+        // header 'name ( ... )' of a potential group that may be skipped once its opening '{' is found
+        std::optional<u32> group_index;
+        u32 group_paren_depth = 0;
+        u32 skip_depth        = 0;
 
         std::vector<Token<std::string>> parsed_tokens;
 
-        while (std::getline(m_fs, line))
-        {
+        auto skip_group = [&](u32 index) {
+            const std::string& group_name = parsed_tokens[index].string;
+            if (group_name != "cell")
+            {
+                return parsed_groups.find(group_name) == parsed_groups.end();
+            }
+
+            // header of a cell group is 'cell', '(', <name>, ')', '{'
+            return m_cell_filter != nullptr && parsed_tokens.size() == index + 5 && m_cell_filter->find(parsed_tokens[index + 2].string) == m_cell_filter->end();
+        };
+
+        auto emit = [&](std::string&& token) {
+            parsed_tokens.emplace_back(line_number, std::move(token));
+            const std::string& tok = parsed_tokens.back().string;
+
+            if (group_index.has_value())
+            {
+                if (group_paren_depth > 0)
+                {
+                    group_paren_depth += (tok == "(") ? 1 : 0;
+                    group_paren_depth -= (tok == ")") ? 1 : 0;
+                    return;
+                }
+
+                const u32 index = group_index.value();
+                group_index.reset();
+                if (tok == "{" && skip_group(index))
+                {
+                    parsed_tokens.erase(parsed_tokens.begin() + index, parsed_tokens.end());
+                    skip_depth = 1;
+                    return;
+                }
+            }
+
+            if (const std::string& prev = (parsed_tokens.size() >= 2) ? parsed_tokens[parsed_tokens.size() - 2].string : tok;
+                tok == "(" && (prev.size() > 1 || (prev.size() == 1 && delimiters.find(prev[0]) == std::string::npos)))
+            {
+                group_index       = parsed_tokens.size() - 2;
+                group_paren_depth = 1;
+            }
+        };
+
+        auto end_line = [&]() {
+            if (!current_token.empty())
+            {
+                emit(std::move(current_token));
+                current_token.clear();
+            }
             line_number++;
-            this->remove_comments(line, multi_line_comment);
+        };
 
-            for (char c : line)
+        auto process = [&](char c) {
+            if (skip_depth > 0)
             {
                 if (c == '\"')
                 {
-                    was_in_string = true;
-                    in_string     = !in_string;
-                    continue;
+                    in_string = !in_string;
                 }
-
-                if (std::isspace(c) && !in_string)
+                else if (!in_string && c == '{')
                 {
-                    continue;
+                    skip_depth++;
                 }
+                else if (!in_string && c == '}' && --skip_depth == 0)
+                {
+                    was_in_string = false;
+                }
+                return;
+            }
+
+            if (c == '\"')
+            {
+                was_in_string = true;
+                in_string     = !in_string;
+                return;
+            }
+
+            if (std::isspace(c) && !in_string)
+            {
+                return;
+            }
 
-                if (delimiters.find(c) == std::string::npos || in_string)
+            if (delimiters.find(c) == std::string::npos || in_string)
+            {
+                current_token += c;
+            }
+            else
+            {
+                if (was_in_string || !current_token.empty())
                 {
-                    current_token += c;
+                    emit(std::move(current_token));
+                    current_token.clear();
+                    was_in_string = false;
                 }
-                else
+
+                emit(std::string(1, c));
+            }
+        };
+
+        // read the file in chunks so that it is never held in memory as a whole
+        std::vector<char> buffer(1 << 20);
+        while (stream)
+        {
+            stream.read(buffer.data(), buffer.size());
+            const std::streamsize num_read = stream.gcount();
+
+            for (std::streamsize i = 0; i < num_read; i++)
+            {
+                const char c = buffer[i];
+
+                if (multi_line_comment)
                 {
-                    if (was_in_string || !current_token.empty())
+                    if (pending_star && c == '/')
+                    {
+                        multi_line_comment = false;
+                    }
+                    pending_star = (c == '*');
+                    if (c == '\n')
                     {
-                        parsed_tokens.emplace_back(line_number, current_token);
-                        current_token.clear();
-                        was_in_string = false;
+                        end_line();
                     }
+                    continue;
+                }
 
-                    if (!std::isspace(c))
+                if (pending_slash)
+                {
+                    pending_slash = false;
+                    if (c == '*')
                     {
-                        parsed_tokens.emplace_back(line_number, std::string(1, c));
+                        multi_line_comment = true;
+                        pending_star       = false;
+                        continue;
                     }
+                    process('/');
+                }
+
+                if (c == '/')
+                {
+                    pending_slash = true;
+                }
+                else if (c == '\n')
+                {
+                    end_line();
+                }
+                else
+                {
+                    process(c);
                 }
-            }
-            if (!current_token.empty())
-            {
-                parsed_tokens.emplace_back(line_number, current_token);
-                current_token.clear();
             }
         }
 
-        m_token_stream = TokenStream<std::string>(parsed_tokens, {"(", "{"}, {")", "}"});
+        if (pending_slash)
+        {
+            process('/');
+        }
+        if (!current_token.empty())
+        {
+            emit(std::move(current_token));
+        }
+
+        m_token_stream = TokenStream<std::string>(std::move(parsed_tokens), {"(", "{"}, {")", "}"});
     }
 
     Result<std::monostate> LibertyParser::parse_tokens()
@@ -1014,59 +1167,6 @@ namespace hal
         return OK({});
     }
 
-    void LibertyParser::remove_comments(std::string& line, bool& multi_line_comment)
-    {
-        bool repeat = true;
-
-        while (repeat)
-        {
-            repeat = false;
-
-            // skip empty lines
-            if (line.empty())
-            {
-                break;
-            }
-            auto multi_line_comment_begin = line.find("/*");
-            auto multi_line_comment_end   = line.find("*/");
-
-            std::string begin = "";
-            std::string end   = "";
-
-            if (multi_line_comment == true)
-            {
-                if (multi_line_comment_end != std::string::npos)
-                {
-                    // multi-line comment ends in current line
-                    multi_line_comment = false;
-                    line               = line.substr(multi_line_comment_end + 2);
-                    repeat             = true;
-                }
-                else
-                {
-                    // current line entirely within multi-line comment
-                    line = "";
-                    break;
-                }
-            }
-            else if (multi_line_comment_begin != std::string::npos)
-            {
-                if (multi_line_comment_end != std::string::npos)
-                {
-                    // multi-line comment entirely in current line
-                    line   = line.substr(0, multi_line_comment_begin) + line.substr(multi_line_comment_end + 2);
-                    repeat = true;
-                }
-                else
-                {
-                    // multi-line comment starts in current line
-                    multi_line_comment = true;
-                    line               = line.substr(0, multi_line_comment_begin);
-                }
-            }
-        }
-    }
-
     std::vector<std::string> LibertyParser::tokenize_function(const std::string& function)
     {
         std::string delimiters = "()[]:!'^+|&* ";
@@ -31,7 +31,7 @@ namespace hal
 
     std::string LibertyParserPlugin::get_version() const
     {
-        return std::string("0.1");
+        return std::string("0.2");
     }
 
     void LibertyParserPlugin::on_load()
@@ -1,6 +1,8 @@
 #include "netlist_test_utils.h"
 #include "liberty_parser/liberty_parser.h"
+#include "hal_core/netlist/gate_library/gate_library.h"
 #include "hal_core/netlist/gate_library/gate_type.h"
+#include "hal_core/netlist/netlist.h"
 #include "hal_core/netlist/gate_library/gate_type_component/ff_component.h"
 #include "hal_core/netlist/gate_library/gate_type_component/latch_component.h"
 #include "hal_core/netlist/gate_library/gate_type_component/state_component.h"
@@ -351,6 +353,90 @@ namespace hal {
         TEST_END
     }
 
+    /**
+     * Testing that groups not required to construct gate types (timing, power, lookup tables) are skipped, including braces within strings and comments.
+     *
+     * Functions: parse
+     */
+    TEST_F(LibertyParserTest, check_skipped_groups) {
+        TEST_START
+            {
+                std::string path_lib = utils::get_base_directory().string() + "/bin/hal_plugins/test-files/liberty_parser/test6.lib";
+                LibertyParser liberty_parser;
+                auto gl_res = liberty_parser.parse(path_lib);
+                ASSERT_TRUE(gl_res.is_ok());
+                std::unique_ptr<GateLibrary> gl = gl_res.get();
+
+                ASSERT_NE(gl, nullptr);
+                auto gate_types = gl->get_gate_types();
+                ASSERT_EQ(gate_types.size(), 3);
+                ASSERT_TRUE(gate_types.find("TEST_INV") != gate_types.end());
+                ASSERT_TRUE(gate_types.find("TEST_AND") != gate_types.end());
+                ASSERT_TRUE(gate_types.find("TEST_BUF") != gate_types.end());
+
+                // attributes within the skipped 'timing' group must not affect the pin
+                GateType* gt = gate_types.at("TEST_INV");
+                ASSERT_EQ(gt->get_pins().size(), 2);
+                const auto* o_pin = gt->get_pin_by_name("O");
+                ASSERT_NE(o_pin, nullptr);
+                EXPECT_EQ(o_pin->get_direction(), PinDirection::output);
+                EXPECT_EQ(gt->get_boolean_function(o_pin), BooleanFunction::from_string("!I").get());
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing the selective loading of cells.
+     *
+     * Functions: parse
+     */
+    TEST_F(LibertyParserTest, check_cell_filter) {
+        TEST_START
+            std::string path_lib = utils::get_base_directory().string() + "/bin/hal_plugins/test-files/liberty_parser/test6.lib";
+            {
+                // Load a subset of cells by name, ignoring unknown names
+                LibertyParser liberty_parser;
+                auto gl_res = liberty_parser.parse(path_lib, std::set<std::string>({"TEST_AND", "TEST_BUF", "UNKNOWN"}));
+                ASSERT_TRUE(gl_res.is_ok());
+                std::unique_ptr<GateLibrary> gl = gl_res.get();
+
+                ASSERT_NE(gl, nullptr);
+                EXPECT_EQ(gl->get_name(), "TEST_GATE_LIBRARY");
+                auto gate_types = gl->get_gate_types();
+                ASSERT_EQ(gate_types.size(), 2);
+                ASSERT_TRUE(gate_types.find("TEST_AND") != gate_types.end());
+                ASSERT_TRUE(gate_types.find("TEST_BUF") != gate_types.end());
+                EXPECT_EQ(gate_types.at("TEST_AND")->get_input_pins().size(), 2);
+            }
+            {
+                // Load the cells instantiated within a netlist
+                GateLibrary netlist_lib("netlist_lib.hgl", "NETLIST_LIB");
+                GateType* inv_type = netlist_lib.create_gate_type("TEST_INV", {GateTypeProperty::combinational});
+                GateType* other_type = netlist_lib.create_gate_type("OTHER", {GateTypeProperty::combinational});
+                netlist_lib.create_gate_type("TEST_BUF", {GateTypeProperty::combinational});
+
+                Netlist nl(&netlist_lib);
+                nl.create_gate(inv_type, "gate_0");
+                nl.create_gate(inv_type, "gate_1");
+                nl.create_gate(other_type, "gate_2");
+
+                LibertyParser liberty_parser;
+                auto gl_res = liberty_parser.parse(path_lib, &nl);
+                ASSERT_TRUE(gl_res.is_ok());
+                std::unique_ptr<GateLibrary> gl = gl_res.get();
+
+                ASSERT_NE(gl, nullptr);
+                auto gate_types = gl->get_gate_types();
+                ASSERT_EQ(gate_types.size(), 1);
+                EXPECT_TRUE(gate_types.find("TEST_INV") != gate_types.end());
+            }
+            {
+                LibertyParser liberty_parser;
+                EXPECT_TRUE(liberty_parser.parse(path_lib, (const Netlist*)nullptr).is_error());
+            }
+        TEST_END
+    }
+
     /**
      * Testing the correct handling of invalid input and other uncommon inputs
      *
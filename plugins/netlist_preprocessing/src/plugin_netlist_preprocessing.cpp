@@ -13,6 +13,7 @@
 #include "hal_core/netlist/netlist_utils.h"
 #include "hal_core/utilities/result.h"
 #include "hal_core/utilities/token_stream.h"
+#include "hal_core/utilities/trace.h"
 
 #include "rapidjson/document.h"
 
@@ -69,6 +70,8 @@ namespace hal
 
     Result<u32> NetlistPreprocessingPlugin::simplify_lut_inits(Netlist* nl)
     {
+        HAL_TRACE_SCOPE("NetlistPreprocessingPlugin::simplify_lut_inits");
+
         u32 num_inits = 0;
 
         for (auto g : nl->get_gates([](const auto& g) { return g->get_type()->has_property(GateTypeProperty::c_lut); }))
@@ -151,6 +154,8 @@ namespace hal
 
     Result<u32> NetlistPreprocessingPlugin::remove_unused_lut_inputs(Netlist* nl)
     {
+        HAL_TRACE_SCOPE("NetlistPreprocessingPlugin::remove_unused_lut_inputs");
+
         u32 num_eps = 0;
 
         // get net connected to GND
@@ -208,6 +213,8 @@ namespace hal
 
     Result<u32> NetlistPreprocessingPlugin::remove_buffers(Netlist* nl)
     {
+        HAL_TRACE_SCOPE("NetlistPreprocessingPlugin::remove_buffers");
+
         u32 num_gates = 0;
 
         std::queue<Gate*> gates_to_be_deleted;
@@ -439,6 +446,8 @@ namespace hal
 
     Result<u32> NetlistPreprocessingPlugin::remove_redundant_logic(Netlist* nl)
     {
+        HAL_TRACE_SCOPE("NetlistPreprocessingPlugin::remove_redundant_logic");
+
         const auto& nets   = nl->get_nets();
         auto nets_to_check = std::set<Net*>(nets.begin(), nets.end());
 
@@ -647,6 +656,8 @@ namespace hal
 
     Result<u32> NetlistPreprocessingPlugin::remove_unconnected_gates(Netlist* nl)
     {
+        HAL_TRACE_SCOPE("NetlistPreprocessingPlugin::remove_unconnected_gates");
+
         u32 num_gates = 0;
         std::vector<Gate*> to_delete;
         do
@@ -689,6 +700,8 @@ namespace hal
 
     Result<u32> NetlistPreprocessingPlugin::remove_unconnected_nets(Netlist* nl)
     {
+        HAL_TRACE_SCOPE("NetlistPreprocessingPlugin::remove_unconnected_nets");
+
         u32 num_nets = 0;
 
         std::vector<Net*> to_delete;
@@ -956,6 +969,8 @@ namespace hal
 
     Result<u32> NetlistPreprocessingPlugin::decompose_gates_of_type(Netlist* nl, const std::vector<const GateType*>& gate_types)
     {
+        HAL_TRACE_SCOPE("NetlistPreprocessingPlugin::decompose_gates_of_type");
+
         u32 counter = 0;
         for (const auto& gt : gate_types)
         {
@@ -1239,6 +1254,8 @@ namespace hal
 
     Result<u32> NetlistPreprocessingPlugin::reconstruct_indexed_ff_identifiers(Netlist* nl)
     {
+        HAL_TRACE_SCOPE("NetlistPreprocessingPlugin::reconstruct_indexed_ff_identifiers");
+
         u32 counter = 0;
         for (auto& ff : nl->get_gates([](const auto g) { return g->get_type()->has_property(GateTypeProperty::ff); }))
         {
@@ -1337,7 +1354,7 @@ namespace hal
                 }
             }
 
-            return TokenStream(parsed_tokens, {}, {});
+            return TokenStream(std::move(parsed_tokens), {}, {});
         }
     
         Result<std::unordered_map<std::string, ComponentData>> parse_tokens(TokenStream<std::string>& ts)
@@ -1407,6 +1424,8 @@ namespace hal
 
     Result<std::monostate> NetlistPreprocessingPlugin::parse_def_file(Netlist* nl, const std::filesystem::path& def_file)
     {
+        HAL_TRACE_SCOPE("NetlistPreprocessingPlugin::parse_def_file");
+
         std::stringstream ss;
         std::ifstream ifs;
         ifs.open(def_file.string(), std::ifstream::in);
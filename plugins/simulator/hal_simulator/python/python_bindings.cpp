@@ -133,12 +133,12 @@ namespace hal
                 This is especially relevant for FPGA netlists, since these may provide initial values to load on startup.
             )")
 
-            .def("initialize", &NetlistSimulator::initialize, R"(
+            .def("initialize", &NetlistSimulator::initialize, py::call_guard<py::gil_scoped_release>(), R"(
                 Initialize the simulation.
                 No additional gates or clocks can be added after this point.
             )")
 
-            .def("simulate", &NetlistSimulator::simulate, py::arg("picoseconds"), R"(
+            .def("simulate", &NetlistSimulator::simulate, py::arg("picoseconds"), py::call_guard<py::gil_scoped_release>(), R"(
                 Simulate for a specific period, advancing the internal state.
                 Automatically initializes the simulation if 'initialize' has not yet been called.
                 Use \p set_input to control specific signals.
@@ -4,6 +4,7 @@
 #include "hal_core/netlist/gate_library/gate_type_component/init_component.h"
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/trace.h"
 #include "netlist_simulator/simulation_utils.h"
 #include "netlist_simulator_controller/simulation_input.h"
 
@@ -17,8 +18,6 @@
 
 namespace hal
 {
-#define measure_block_time(X)
-
     NetlistSimulator::NetlistSimulator(const std::string& nam) : SimulationEngineEventDriven(nam)
     {
         ;
@@ -247,7 +246,8 @@ namespace hal
      */
     void NetlistSimulator::initialize()
     {
-        measure_block_time("NetlistSimulator::initialize()");
+        HAL_TRACE_SCOPE("NetlistSimulator::initialize");
+
         m_successors.clear();
         m_sim_gates.clear();
         m_sim_gates_raw.clear();
@@ -409,7 +409,7 @@ namespace hal
 
     void NetlistSimulator::process_events(u64 timeout)
     {
-        measure_block_time("NetlistSimulator::process_events(" + std::to_string(timeout) + ")");
+        HAL_TRACE_SCOPE("NetlistSimulator::process_events");
 
         // iteration counter to catch infinite loops
         u64 total_iterations_for_one_timeslot = 0;
@@ -511,6 +511,8 @@ namespace hal
                 }
             }
 
+            trace::count("events", processed);
+
             // check for iteration limit
             total_iterations_for_one_timeslot += processed;
             if (m_timeout_iterations > 0 && total_iterations_for_one_timeslot > m_timeout_iterations)
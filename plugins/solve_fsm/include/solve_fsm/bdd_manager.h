@@ -0,0 +1,237 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/utilities/result.h"
+
+#include <functional>
+#include <limits>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * A minimal manager for reduced ordered binary decision diagrams (BDDs) used for the symbolic exploration of finite state machines.<br>
+     * BDDs are referred to by handles that stay valid for the lifetime of the manager, nodes are never freed.
+     * Variables are identified by their index, which also determines their position in the variable order.
+     * Once the node limit is exceeded, all operations return the constant zero BDD and `has_exceeded_node_limit` returns true.
+     */
+    class PLUGIN_API BddManager
+    {
+    public:
+        /**
+         * Handle of a BDD.
+         */
+        using Bdd = u32;
+
+        /**
+         * The constant zero BDD.
+         */
+        static constexpr Bdd ZERO = 0;
+
+        /**
+         * The constant one BDD.
+         */
+        static constexpr Bdd ONE = 1;
+
+        /**
+         * Create a new manager.
+         *
+         * @param[in] num_variables - The number of variables.
+         * @param[in] max_nodes - The maximum number of nodes. Defaults to 2^24.
+         */
+        explicit BddManager(u32 num_variables, u32 max_nodes = 1 << 24);
+
+        /**
+         * Get the number of variables.
+         *
+         * @returns The number of variables.
+         */
+        u32 get_num_variables() const;
+
+        /**
+         * Get the number of nodes allocated so far including the two terminal nodes.
+         *
+         * @returns The number of nodes.
+         */
+        u32 get_num_nodes() const;
+
+        /**
+         * Check whether an operation failed because the node limit was exceeded.
+         *
+         * @returns True if the node limit was exceeded, false otherwise.
+         */
+        bool has_exceeded_node_limit() const;
+
+        /**
+         * Get the BDD of a single variable.
+         *
+         * @param[in] var - The variable index.
+         * @returns The BDD.
+         */
+        Bdd get_variable(u32 var);
+
+        /**
+         * Get the BDD of the conjunction of the given literals.
+         *
+         * @param[in] literals - Pairs of variable index and polarity.
+         * @returns The BDD.
+         */
+        Bdd get_cube(const std::vector<std::pair<u32, bool>>& literals);
+
+        /**
+         * Compute `if f then g else h`.
+         *
+         * @param[in] f - The condition.
+         * @param[in] g - The BDD if the condition holds.
+         * @param[in] h - The BDD if the condition does not hold.
+         * @returns The BDD.
+         */
+        Bdd ite(Bdd f, Bdd g, Bdd h);
+
+        /**
+         * Compute the negation of a BDD.
+         *
+         * @param[in] f - The BDD.
+         * @returns The negated BDD.
+         */
+        Bdd negate(Bdd f);
+
+        /**
+         * Compute the conjunction of two BDDs.
+         *
+         * @param[in] f - The first BDD.
+         * @param[in] g - The second BDD.
+         * @returns The conjunction.
+         */
+        Bdd conjoin(Bdd f, Bdd g);
+
+        /**
+         * Compute the disjunction of two BDDs.
+         *
+         * @param[in] f - The first BDD.
+         * @param[in] g - The second BDD.
+         * @returns The disjunction.
+         */
+        Bdd disjoin(Bdd f, Bdd g);
+
+        /**
+         * Compute the exclusive disjunction of two BDDs.
+         *
+         * @param[in] f - The first BDD.
+         * @param[in] g - The second BDD.
+         * @returns The exclusive disjunction.
+         */
+        Bdd exclusive_disjoin(Bdd f, Bdd g);
+
+        /**
+         * Compute the cofactor of a BDD with respect to a cube of literals, i.e., fix the variables of the cube to the values given by their polarity.
+         *
+         * @param[in] f - The BDD.
+         * @param[in] cube - The cube of literals, see `get_cube`.
+         * @returns The cofactor.
+         */
+        Bdd cofactor(Bdd f, Bdd cube);
+
+        /**
+         * Call a function for each path of a BDD that leads to the constant one.
+         * The paths represent disjoint cubes whose disjunction is the BDD.
+         * For each path, the function is called with the value of every variable, `-1` denoting variables that do not occur on the path.
+         * The enumeration stops as soon as the function returns false.
+         *
+         * @param[in] f - The BDD.
+         * @param[in] callback - The function to call, returning true to continue with the next path and false to stop.
+         */
+        void for_each_cube(Bdd f, const std::function<bool(const std::vector<i8>&)>& callback) const;
+
+        /**
+         * Translate a Boolean function of bit-size 1 into a BDD.
+         * Supports AND, OR, NOT, XOR, EQ, and ITE operations over variables and constants.
+         *
+         * @param[in] function - The Boolean function.
+         * @param[in] variables - A mapping from variable name to variable index.
+         * @returns Ok() and the BDD on success, an error otherwise.
+         */
+        Result<Bdd> from_boolean_function(const BooleanFunction& function, const std::map<std::string, u32>& variables);
+
+        /**
+         * Translate a BDD into a Boolean function in the form of nested Shannon expansions.
+         *
+         * @param[in] f - The BDD.
+         * @param[in] names - The name of each variable.
+         * @returns The Boolean function.
+         */
+        BooleanFunction to_boolean_function(Bdd f, const std::vector<std::string>& names) const;
+
+    private:
+        struct Node
+        {
+            u32 var;
+            Bdd low;
+            Bdd high;
+        };
+
+        struct Key
+        {
+            u32 a;
+            u32 b;
+            u32 c;
+            u32 d;
+
+            bool operator==(const Key& other) const
+            {
+                return a == other.a && b == other.b && c == other.c && d == other.d;
+            }
+        };
+
+        struct KeyHash
+        {
+            std::size_t operator()(const Key& key) const
+            {
+                u64 h = key.a;
+                h     = h * 0x9E3779B97F4A7C15ull + key.b;
+                h     = h * 0x9E3779B97F4A7C15ull + key.c;
+                h     = h * 0x9E3779B97F4A7C15ull + key.d;
+                return h ^ (h >> 29);
+            }
+        };
+
+        static constexpr u32 TERMINAL_VAR = std::numeric_limits<u32>::max();
+
+        u32 m_num_variables;
+        u32 m_max_nodes;
+        bool m_exceeded = false;
+        std::vector<Node> m_nodes;
+        std::unordered_map<Key, Bdd, KeyHash> m_unique;
+        std::unordered_map<Key, Bdd, KeyHash> m_computed;
+
+        Bdd make_node(u32 var, Bdd low, Bdd high);
+    };
+}    // namespace hal
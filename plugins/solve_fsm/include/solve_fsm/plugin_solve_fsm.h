@@ -80,6 +80,30 @@ namespace hal
         static Result<std::map<u64, std::map<u64, BooleanFunction>>>
             solve_fsm_brute_force(Netlist* nl, const std::vector<Gate*>& state_reg, const std::vector<Gate*>& transition_logic, const std::string& graph_path = "");
 
+        /**
+         * Generates the state graph of a finite state machine and returns a mapping from each state to a all its possible transitions.
+         * The transitions are another mapping from all the possible successor states to the corresponding condition under which the transition is taken.
+         * This function represents the next state functions as binary decision diagrams (BDDs) and computes the set of states reachable from the initial state by symbolic image computation.
+         * Transitions and their conditions are afterwards extracted from the BDDs, so that the runtime depends on the number of reachable states and transitions instead of the number of possible states and input combinations.
+         * Bit i of a state corresponds to the i-th gate of the state register.
+         *
+         * @param[in] nl - Pointer to the netlist.
+         * @param[in] state_reg - A vector containing all the gates of the fsm representing the state register.
+         * @param[in] transition_logic - A vector containing all the gates of the fsm representing the transition_logic.
+         * @param[in] initial_state - A mapping from the state registers to their initial value. If omitted the intial state will be set to 0.
+         * @param[in] graph_path - Path where the transition state graph in dot format is saved.
+         * @param[in] max_nodes - The maximum number of BDD nodes to allocate before aborting. Defaults to 2^24.
+         * @param[in] max_transitions - The maximum number of transitions to extract from the BDDs before aborting. Defaults to 2^20.
+         * @returns A mapping from each state to all its possible transitions.
+         */
+        static Result<std::map<u64, std::map<u64, BooleanFunction>>> solve_fsm_symbolic(Netlist* nl,
+                                                                                        const std::vector<Gate*>& state_reg,
+                                                                                        const std::vector<Gate*>& transition_logic,
+                                                                                        const std::map<Gate*, bool>& initial_state = {},
+                                                                                        const std::string& graph_path              = "",
+                                                                                        const u32 max_nodes                        = 1 << 24,
+                                                                                        const u32 max_transitions                  = 1 << 20);
+
         /**
          * Generates the state graph of a finite state machine from the transitions of that fsm.
          *
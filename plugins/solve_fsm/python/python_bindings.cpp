@@ -101,6 +101,49 @@ namespace hal
                 :returns: A mapping from each state to all its possible transitions.
                 :rtype: dict[int,dict[int,hal_py.BooleanFunction]]
             )")
+            .def_static(
+                "solve_fsm_symbolic",
+                [](Netlist* nl,
+                   const std::vector<Gate*>& state_reg,
+                   const std::vector<Gate*>& transition_logic,
+                   const std::map<Gate*, bool>& initial_state = {},
+                   const std::string& graph_path              = "",
+                   const u32 max_nodes                        = 1 << 24,
+                   const u32 max_transitions                  = 1 << 20) -> std::optional<std::map<u64, std::map<u64, BooleanFunction>>> {
+                    auto res = SolveFsmPlugin::solve_fsm_symbolic(nl, state_reg, transition_logic, initial_state, graph_path, max_nodes, max_transitions);
+                    if (res.is_ok())
+                    {
+                        return res.get();
+                    }
+                    else
+                    {
+                        log_error("python_context", "{}", res.get_error().get());
+                        return std::nullopt;
+                    }
+                },
+                py::arg("nl"),
+                py::arg("state_reg"),
+                py::arg("transition_logic"),
+                py::arg("initial_state")   = std::map<Gate*, bool>(),
+                py::arg("graph_path")      = std::string(),
+                py::arg("max_nodes")       = 1 << 24,
+                py::arg("max_transitions") = 1 << 20,
+                R"(
+                Generates the state graph of a finite state machine and returns a mapping from each state to a all its possible transitions.
+                The transitions are another mapping from all the possible successor states to the corresponding condition under which the transition is taken.
+                This function represents the next state functions as binary decision diagrams (BDDs) and computes the set of states reachable from the initial state by symbolic image computation.
+                Bit i of a state corresponds to the i-th gate of the state register.
+
+                :param hal_py.Netlist nl: The netlist.
+                :param list[hal_py.Gate] state_reg: A list containing all the gates of the fsm representing the state register.
+                :param list[hal_py.Gate] transition_logic: A list containing all the gates of the fsm representing the transition_logic.
+                :param dict[hal_py.Gate,bool] initial_state: A mapping from the state registers to their initial value. If omitted the intial state will be set to 0.
+                :param str graph_path: Path to the location where the state graph is saved in dot format.
+                :param int max_nodes: The maximum number of BDD nodes to allocate before aborting.
+                :param int max_transitions: The maximum number of transitions to extract from the BDDs before aborting.
+                :returns: A mapping from each state to all its possible transitions on success, ``None`` otherwise.
+                :rtype: dict[int,dict[int,hal_py.BooleanFunction]] or None
+            )")
             .def_static(
                 "generate_dot_graph",
                 [](const std::vector<Gate*>& state_reg,
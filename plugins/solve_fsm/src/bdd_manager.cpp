@@ -0,0 +1,355 @@
+#include "solve_fsm/bdd_manager.h"
+
+#include <algorithm>
+
+namespace hal
+{
+    namespace
+    {
+        // operation identifiers of the computed table
+        constexpr u32 OP_ITE      = 0;
+        constexpr u32 OP_COFACTOR = 1;
+
+        // the computed table is cleared once it exceeds this number of entries
+        constexpr u32 MAX_COMPUTED_ENTRIES = 1 << 22;
+    }    // namespace
+
+    BddManager::BddManager(u32 num_variables, u32 max_nodes) : m_num_variables(num_variables), m_max_nodes(max_nodes)
+    {
+        m_nodes.push_back({TERMINAL_VAR, ZERO, ZERO});
+        m_nodes.push_back({TERMINAL_VAR, ONE, ONE});
+    }
+
+    u32 BddManager::get_num_variables() const
+    {
+        return m_num_variables;
+    }
+
+    u32 BddManager::get_num_nodes() const
+    {
+        return m_nodes.size();
+    }
+
+    bool BddManager::has_exceeded_node_limit() const
+    {
+        return m_exceeded;
+    }
+
+    BddManager::Bdd BddManager::make_node(u32 var, Bdd low, Bdd high)
+    {
+        if (low == high)
+        {
+            return low;
+        }
+
+        const Key key{var, low, high, 0};
+        if (const auto it = m_unique.find(key); it != m_unique.end())
+        {
+            return it->second;
+        }
+
+        if (m_nodes.size() >= m_max_nodes)
+        {
+            m_exceeded = true;
+            return ZERO;
+        }
+
+        const Bdd node = m_nodes.size();
+        m_nodes.push_back({var, low, high});
+        m_unique.emplace(key, node);
+        return node;
+    }
+
+    BddManager::Bdd BddManager::get_variable(u32 var)
+    {
+        return make_node(var, ZERO, ONE);
+    }
+
+    BddManager::Bdd BddManager::get_cube(const std::vector<std::pair<u32, bool>>& literals)
+    {
+        // build bottom-up so that every node is created once
+        std::vector<std::pair<u32, bool>> sorted = literals;
+        std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+
+        Bdd cube = ONE;
+        for (const auto& [var, value] : sorted)
+        {
+            cube = value ? make_node(var, ZERO, cube) : make_node(var, cube, ZERO);
+        }
+        return cube;
+    }
+
+    BddManager::Bdd BddManager::ite(Bdd f, Bdd g, Bdd h)
+    {
+        if (m_exceeded)
+        {
+            return ZERO;
+        }
+        if (f == ONE)
+        {
+            return g;
+        }
+        if (f == ZERO)
+        {
+            return h;
+        }
+        if (g == h)
+        {
+            return g;
+        }
+        if (g == ONE && h == ZERO)
+        {
+            return f;
+        }
+
+        const Key key{OP_ITE, f, g, h};
+        if (const auto it = m_computed.find(key); it != m_computed.end())
+        {
+            return it->second;
+        }
+
+        const u32 var = std::min({m_nodes[f].var, m_nodes[g].var, m_nodes[h].var});
+        auto low      = [this, var](Bdd x) { return m_nodes[x].var == var ? m_nodes[x].low : x; };
+        auto high     = [this, var](Bdd x) { return m_nodes[x].var == var ? m_nodes[x].high : x; };
+
+        const Bdd t      = ite(high(f), high(g), high(h));
+        const Bdd e      = ite(low(f), low(g), low(h));
+        const Bdd result = make_node(var, e, t);
+
+        if (m_computed.size() >= MAX_COMPUTED_ENTRIES)
+        {
+            m_computed.clear();
+        }
+        m_computed.emplace(key, result);
+        return result;
+    }
+
+    BddManager::Bdd BddManager::negate(Bdd f)
+    {
+        return ite(f, ZERO, ONE);
+    }
+
+    BddManager::Bdd BddManager::conjoin(Bdd f, Bdd g)
+    {
+        return ite(f, g, ZERO);
+    }
+
+    BddManager::Bdd BddManager::disjoin(Bdd f, Bdd g)
+    {
+        return ite(f, ONE, g);
+    }
+
+    BddManager::Bdd BddManager::exclusive_disjoin(Bdd f, Bdd g)
+    {
+        return ite(f, negate(g), g);
+    }
+
+    BddManager::Bdd BddManager::cofactor(Bdd f, Bdd cube)
+    {
+        if (m_exceeded)
+        {
+            return ZERO;
+        }
+
+        // skip literals above the top variable of f, the literal of a cube node continues in its non-zero child
+        auto next = [this](Bdd c) { return m_nodes[c].low == ZERO ? m_nodes[c].high : m_nodes[c].low; };
+        while (cube != ONE && m_nodes[cube].var < m_nodes[f].var)
+        {
+            cube = next(cube);
+        }
+        if (f <= ONE || cube == ONE)
+        {
+            return f;
+        }
+
+        const Key key{OP_COFACTOR, f, cube, 0};
+        if (const auto it = m_computed.find(key); it != m_computed.end())
+        {
+            return it->second;
+        }
+
+        const Node& node = m_nodes[f];
+        const u32 var    = node.var;
+        const Bdd low    = node.low;
+        const Bdd high   = node.high;
+
+        Bdd result;
+        if (m_nodes[cube].var == var)
+        {
+            result = cofactor(m_nodes[cube].low == ZERO ? high : low, next(cube));
+        }
+        else
+        {
+            result = make_node(var, cofactor(low, cube), cofactor(high, cube));
+        }
+
+        if (m_computed.size() >= MAX_COMPUTED_ENTRIES)
+        {
+            m_computed.clear();
+        }
+        m_computed.emplace(key, result);
+        return result;
+    }
+
+    void BddManager::for_each_cube(Bdd f, const std::function<bool(const std::vector<i8>&)>& callback) const
+    {
+        std::vector<i8> values(m_num_variables, -1);
+        std::function<bool(Bdd)> visit = [this, &values, &callback, &visit](Bdd x) -> bool {
+            if (x == ZERO)
+            {
+                return true;
+            }
+            if (x == ONE)
+            {
+                return callback(values);
+            }
+
+            const Node& node = m_nodes[x];
+            values[node.var] = 0;
+            if (!visit(node.low))
+            {
+                return false;
+            }
+            values[node.var] = 1;
+            if (!visit(node.high))
+            {
+                return false;
+            }
+            values[node.var] = -1;
+            return true;
+        };
+        visit(f);
+    }
+
+    Result<BddManager::Bdd> BddManager::from_boolean_function(const BooleanFunction& function, const std::map<std::string, u32>& variables)
+    {
+        if (function.size() != 1)
+        {
+            return ERR("could not translate Boolean function to BDD: expected a bit-size of 1, but got " + std::to_string(function.size()));
+        }
+
+        std::vector<Bdd> stack;
+        for (const auto& node : function.get_nodes())
+        {
+            if (stack.size() < node.get_arity())
+            {
+                return ERR("could not translate Boolean function to BDD: invalid number of operands");
+            }
+            std::vector<Bdd> operands(stack.end() - node.get_arity(), stack.end());
+            stack.erase(stack.end() - node.get_arity(), stack.end());
+
+            switch (node.type)
+            {
+                case BooleanFunction::NodeType::Constant:
+                    if (node.has_constant_value(0))
+                    {
+                        stack.push_back(ZERO);
+                    }
+                    else if (node.has_constant_value(1))
+                    {
+                        stack.push_back(ONE);
+                    }
+                    else
+                    {
+                        return ERR("could not translate Boolean function to BDD: unsupported constant " + node.to_string());
+                    }
+                    break;
+                case BooleanFunction::NodeType::Variable:
+                    if (const auto it = variables.find(node.variable); it != variables.end())
+                    {
+                        stack.push_back(get_variable(it->second));
+                    }
+                    else
+                    {
+                        return ERR("could not translate Boolean function to BDD: no index given for variable '" + node.variable + "'");
+                    }
+                    break;
+                case BooleanFunction::NodeType::And:
+                    stack.push_back(conjoin(operands[0], operands[1]));
+                    break;
+                case BooleanFunction::NodeType::Or:
+                    stack.push_back(disjoin(operands[0], operands[1]));
+                    break;
+                case BooleanFunction::NodeType::Not:
+                    stack.push_back(negate(operands[0]));
+                    break;
+                case BooleanFunction::NodeType::Xor:
+                    stack.push_back(exclusive_disjoin(operands[0], operands[1]));
+                    break;
+                case BooleanFunction::NodeType::Eq:
+                    stack.push_back(negate(exclusive_disjoin(operands[0], operands[1])));
+                    break;
+                case BooleanFunction::NodeType::Ite:
+                    stack.push_back(ite(operands[0], operands[1], operands[2]));
+                    break;
+                default:
+                    return ERR("could not translate Boolean function to BDD: unsupported node " + node.to_string());
+            }
+        }
+
+        if (stack.size() != 1)
+        {
+            return ERR("could not translate Boolean function to BDD: number of elements remaining on the stack is not 1");
+        }
+        if (m_exceeded)
+        {
+            return ERR("could not translate Boolean function to BDD: exceeded the limit of " + std::to_string(m_max_nodes) + " nodes");
+        }
+        return OK(stack.back());
+    }
+
+    BooleanFunction BddManager::to_boolean_function(Bdd f, const std::vector<std::string>& names) const
+    {
+        std::unordered_map<Bdd, BooleanFunction> cache;
+        std::function<BooleanFunction(Bdd)> translate = [this, &names, &cache, &translate](Bdd x) -> BooleanFunction {
+            if (x == ZERO)
+            {
+                return BooleanFunction::Const(0, 1);
+            }
+            if (x == ONE)
+            {
+                return BooleanFunction::Const(1, 1);
+            }
+            if (const auto it = cache.find(x); it != cache.end())
+            {
+                return it->second.clone();
+            }
+
+            const Node& node    = m_nodes[x];
+            BooleanFunction var = BooleanFunction::Var(names.at(node.var));
+            BooleanFunction result;
+            if (node.low == ZERO && node.high == ONE)
+            {
+                result = std::move(var);
+            }
+            else if (node.low == ONE && node.high == ZERO)
+            {
+                result = ~var;
+            }
+            else if (node.low == ZERO)
+            {
+                result = var & translate(node.high);
+            }
+            else if (node.high == ZERO)
+            {
+                result = ~var & translate(node.low);
+            }
+            else if (node.low == ONE)
+            {
+                result = ~var | translate(node.high);
+            }
+            else if (node.high == ONE)
+            {
+                result = var | translate(node.low);
+            }
+            else
+            {
+                result = (var & translate(node.high)) | (~var & translate(node.low));
+            }
+
+            cache.emplace(x, result.clone());
+            return result;
+        };
+        return translate(f);
+    }
+}    // namespace hal
@@ -15,9 +15,14 @@
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/netlist/netlist_utils.h"
+#include "hal_core/utilities/log.h"
+#include "hal_core/utilities/trace.h"
+#include "solve_fsm/bdd_manager.h"
 
+#include <algorithm>
 #include <bitset>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <queue>
@@ -51,6 +56,8 @@ namespace hal
         Result<std::vector<std::pair<Net*, BooleanFunction>>>
             generate_state_bfs(Netlist* nl, const std::vector<Gate*>& state_reg, const std::vector<Gate*>& transition_logic, const bool consider_control_inputs)
         {
+            HAL_TRACE_SCOPE("solve_fsm::generate_state_bfs");
+
             std::map<Net*, Net*> output_net_to_input_net;
 
             for (const auto& ff : state_reg)
@@ -257,6 +264,8 @@ namespace hal
         Result<std::map<u64, std::map<u64, BooleanFunction>>> generate_conditional_transitions(const std::vector<std::pair<Net*, BooleanFunction>>& state_bfs,
                                                                                                const std::map<u64, std::set<u64>>& transitions)
         {
+            HAL_TRACE_SCOPE("solve_fsm::generate_conditional_transitions");
+
             // generate all transitions that are reachable from the inital state.
             std::map<u64, std::map<u64, BooleanFunction>> conditional_transitions;
 
@@ -308,6 +317,8 @@ namespace hal
     Result<std::map<u64, std::map<u64, BooleanFunction>>>
         SolveFsmPlugin::solve_fsm_brute_force(Netlist* nl, const std::vector<Gate*>& state_reg, const std::vector<Gate*>& transition_logic, const std::string& graph_path)
     {
+        HAL_TRACE_SCOPE("SolveFsmPlugin::solve_fsm_brute_force");
+
         const u32 state_size = state_reg.size();
         if (state_size > 64)
         {
@@ -409,6 +420,8 @@ namespace hal
                                                                                     const std::string& graph_path,
                                                                                     const u32 timeout)
     {
+        HAL_TRACE_SCOPE("SolveFsmPlugin::solve_fsm");
+
         const u32 state_size = state_reg.size();
         if (state_size > 64)
         {
@@ -470,6 +483,7 @@ namespace hal
                 continue;
             }
             visited.insert(n);
+            trace::count("states");
 
             // generate new transitions and add them to the queue
             SMT::Solver s;
@@ -554,6 +568,231 @@ namespace hal
         return OK(conditional_transitions);
     }
 
+    Result<std::map<u64, std::map<u64, BooleanFunction>>> SolveFsmPlugin::solve_fsm_symbolic(Netlist* nl,
+                                                                                             const std::vector<Gate*>& state_reg,
+                                                                                             const std::vector<Gate*>& transition_logic,
+                                                                                             const std::map<Gate*, bool>& initial_state,
+                                                                                             const std::string& graph_path,
+                                                                                             const u32 max_nodes,
+                                                                                             const u32 max_transitions)
+    {
+        HAL_TRACE_SCOPE("SolveFsmPlugin::solve_fsm_symbolic");
+
+        const u32 state_size = state_reg.size();
+        if (state_size == 0 || state_size > 64)
+        {
+            return ERR("failed to solve fsm: Currently only supports fsm with 1 to 64 state flip-flops but got " + std::to_string(state_size) + ".");
+        }
+
+        // extract Boolean functions for each state flip-flop
+        const auto state_bfs_res = generate_state_bfs(nl, state_reg, transition_logic, true);
+        if (state_bfs_res.is_error())
+        {
+            return ERR_APPEND(state_bfs_res.get_error(), "failed to solve fsm: unable to generate Boolean functions for state.");
+        }
+        const std::vector<std::pair<Net*, BooleanFunction>> state_bfs = state_bfs_res.get();
+
+        // order the BDD variables such that the state variables come first, followed by the external inputs
+        std::map<std::string, u32> var_indices;
+        std::vector<std::string> var_names;
+        for (const auto& [net, bf] : state_bfs)
+        {
+            const std::string var = BooleanFunctionNetDecorator(*net).get_boolean_variable_name();
+            var_indices[var]      = var_names.size();
+            var_names.push_back(var);
+        }
+        std::set<std::string> input_vars;
+        for (const auto& [net, bf] : state_bfs)
+        {
+            for (const auto& var : bf.get_variable_names())
+            {
+                if (var_indices.find(var) == var_indices.end())
+                {
+                    input_vars.insert(var);
+                }
+            }
+        }
+        for (const auto& var : input_vars)
+        {
+            var_indices[var] = var_names.size();
+            var_names.push_back(var);
+        }
+
+        BddManager bdd(var_names.size(), max_nodes);
+        const std::string node_limit_error = "failed to solve fsm: exceeded the limit of " + std::to_string(max_nodes) + " BDD nodes.";
+
+        std::vector<BddManager::Bdd> next_state_bdds;
+        for (u32 bit = 0; bit < state_size; bit++)
+        {
+            const auto next_state_res = bdd.from_boolean_function(state_bfs.at(bit).second, var_indices);
+            if (next_state_res.is_error())
+            {
+                return ERR_APPEND(next_state_res.get_error(), "failed to solve fsm: unable to build BDD of next state function for state bit " + std::to_string(bit) + ".");
+            }
+            next_state_bdds.push_back(next_state_res.get());
+        }
+
+        // the image of a set of states is the range of the next state functions constrained to that set.
+        // the range is computed by splitting on one next state bit after the other, which avoids building the monolithic transition relation.
+        std::map<std::pair<u32, BddManager::Bdd>, BddManager::Bdd> range_cache;
+        std::function<BddManager::Bdd(u32, BddManager::Bdd)> get_range = [&](u32 bit, BddManager::Bdd constraint) -> BddManager::Bdd {
+            if (constraint == BddManager::ZERO || bdd.has_exceeded_node_limit())
+            {
+                return BddManager::ZERO;
+            }
+            if (bit == state_size)
+            {
+                return BddManager::ONE;
+            }
+            if (const auto it = range_cache.find({bit, constraint}); it != range_cache.end())
+            {
+                return it->second;
+            }
+
+            const BddManager::Bdd high   = get_range(bit + 1, bdd.conjoin(constraint, next_state_bdds.at(bit)));
+            const BddManager::Bdd low    = get_range(bit + 1, bdd.conjoin(constraint, bdd.negate(next_state_bdds.at(bit))));
+            const BddManager::Bdd result = bdd.ite(bdd.get_variable(bit), high, low);
+            range_cache.emplace(std::make_pair(bit, constraint), result);
+            return result;
+        };
+
+        // generate initial state
+        std::vector<std::pair<u32, bool>> initial_literals;
+        for (u32 bit = 0; bit < state_size; bit++)
+        {
+            bool value = false;
+            if (!initial_state.empty())
+            {
+                if (const auto it = initial_state.find(state_reg.at(bit)); it != initial_state.end())
+                {
+                    value = it->second;
+                }
+                else
+                {
+                    return ERR("failed to solve fsm: Unable to find intial value for gate " + std::to_string(state_reg.at(bit)->get_id()) + " in the provided initial state map.");
+                }
+            }
+            initial_literals.push_back({bit, value});
+        }
+
+        // compute the reachable states by repeated image computation, every iteration only processes the states discovered in the previous one
+        BddManager::Bdd reachable = bdd.get_cube(initial_literals);
+        BddManager::Bdd frontier  = reachable;
+        while (frontier != BddManager::ZERO)
+        {
+            trace::count("image_computations");
+            frontier  = bdd.conjoin(get_range(0, frontier), bdd.negate(reachable));
+            reachable = bdd.disjoin(reachable, frontier);
+
+            if (bdd.has_exceeded_node_limit())
+            {
+                return ERR(node_limit_error);
+            }
+        }
+
+        // enumerate the reachable states, state bits that do not occur in a cube may take both values.
+        // every reachable state has at least one transition, so the number of states is bounded by the transition limit as well.
+        const std::string transition_limit_error = "failed to solve fsm: exceeded the limit of " + std::to_string(max_transitions) + " transitions.";
+        std::vector<u64> reachable_states;
+        bool exceeded_transition_limit = false;
+        bdd.for_each_cube(reachable, [state_size, max_transitions, &reachable_states, &exceeded_transition_limit](const std::vector<i8>& values) {
+            u64 fixed = 0;
+            std::vector<u32> free_bits;
+            for (u32 bit = 0; bit < state_size; bit++)
+            {
+                if (values.at(bit) < 0)
+                {
+                    free_bits.push_back(bit);
+                }
+                else if (values.at(bit) == 1)
+                {
+                    fixed |= u64(1) << bit;
+                }
+            }
+
+            // a cube with 32 or more free bits exceeds any limit, checking this first also avoids shifting by 64 bits for a cube that covers all states
+            if (free_bits.size() >= 32 || reachable_states.size() + (u64(1) << free_bits.size()) > max_transitions)
+            {
+                exceeded_transition_limit = true;
+                return false;
+            }
+
+            for (u64 assignment = 0; assignment < (u64(1) << free_bits.size()); assignment++)
+            {
+                u64 state = fixed;
+                for (u32 i = 0; i < free_bits.size(); i++)
+                {
+                    state |= ((assignment >> i) & 1) << free_bits.at(i);
+                }
+                reachable_states.push_back(state);
+            }
+            return true;
+        });
+        if (exceeded_transition_limit)
+        {
+            return ERR(transition_limit_error);
+        }
+        std::sort(reachable_states.begin(), reachable_states.end());
+
+        // extract the successors of every reachable state by splitting on the next state functions of that state, the remaining constraint on the inputs is the condition of the transition
+        std::map<u64, std::map<u64, BooleanFunction>> conditional_transitions;
+        u64 num_transitions = 0;
+        for (const u64 state : reachable_states)
+        {
+            std::vector<std::pair<u32, bool>> state_literals;
+            for (u32 bit = 0; bit < state_size; bit++)
+            {
+                state_literals.push_back({bit, (state >> bit) & 1});
+            }
+            const BddManager::Bdd state_cube = bdd.get_cube(state_literals);
+
+            std::vector<BddManager::Bdd> state_next_state_bdds;
+            for (const BddManager::Bdd next_state_bdd : next_state_bdds)
+            {
+                state_next_state_bdds.push_back(bdd.cofactor(next_state_bdd, state_cube));
+            }
+
+            auto& successors = conditional_transitions[state];
+            std::function<void(u32, u64, BddManager::Bdd)> split = [&](u32 bit, u64 successor, BddManager::Bdd condition) {
+                if (condition == BddManager::ZERO || exceeded_transition_limit)
+                {
+                    return;
+                }
+                if (bit == state_size)
+                {
+                    if (++num_transitions > max_transitions)
+                    {
+                        exceeded_transition_limit = true;
+                        return;
+                    }
+                    successors.insert({successor, bdd.to_boolean_function(condition, var_names).simplify()});
+                    return;
+                }
+                split(bit + 1, successor | (u64(1) << bit), bdd.conjoin(condition, state_next_state_bdds.at(bit)));
+                split(bit + 1, successor, bdd.conjoin(condition, bdd.negate(state_next_state_bdds.at(bit))));
+            };
+            split(0, 0, BddManager::ONE);
+
+            if (bdd.has_exceeded_node_limit())
+            {
+                return ERR(node_limit_error);
+            }
+            if (exceeded_transition_limit)
+            {
+                return ERR(transition_limit_error);
+            }
+        }
+
+        log_info("solve_fsm", "found {} reachable states using {} BDD nodes.", reachable_states.size(), bdd.get_num_nodes());
+
+        if (auto graph_res = generate_dot_graph(state_reg, conditional_transitions, graph_path); graph_res.is_error())
+        {
+            return ERR_APPEND(graph_res.get_error(), "failed to solve fsm: unable to generate dot graph.");
+        }
+
+        return OK(conditional_transitions);
+    }
+
     Result<std::string> SolveFsmPlugin::generate_dot_graph(const std::vector<Gate*>& state_reg,
                                                            const std::map<u64, std::map<u64, BooleanFunction>>& transitions,
                                                            const std::string& graph_path,
@@ -0,0 +1,167 @@
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/decorators/boolean_function_net_decorator.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "solve_fsm/plugin_solve_fsm.h"
+
+#include "netlist_test_utils.h"
+
+namespace hal
+{
+    class SolveFsmTest : public ::testing::Test
+    {
+    protected:
+        std::unique_ptr<Netlist> m_netlist;
+        std::vector<Gate*> m_state_reg;
+        std::vector<Gate*> m_transition_logic;
+        std::vector<std::string> m_input_vars;
+
+        virtual void SetUp()
+        {
+            NO_COUT_BLOCK;
+            test_utils::init_log_channels();
+            create_fsm();
+        }
+
+        virtual void TearDown()
+        {
+        }
+
+        // 3-bit FSM with inputs a and b: s0' = s1 ^ a, s1' = s0 & b, s2' = s0 & s1 & s2, i.e., bit 2 can only be set if it already is
+        void create_fsm()
+        {
+            m_netlist             = test_utils::create_empty_netlist();
+            const GateLibrary* gl = m_netlist->get_gate_library();
+
+            Net* clk = m_netlist->create_net("clk");
+            Net* a   = m_netlist->create_net("a");
+            Net* b   = m_netlist->create_net("b");
+            m_netlist->mark_global_input_net(clk);
+            m_netlist->mark_global_input_net(a);
+            m_netlist->mark_global_input_net(b);
+            m_input_vars = {BooleanFunctionNetDecorator(*a).get_boolean_variable_name(), BooleanFunctionNetDecorator(*b).get_boolean_variable_name()};
+
+            std::vector<Net*> q;
+            std::vector<Net*> d;
+            for (u32 i = 0; i < 3; i++)
+            {
+                Gate* ff = m_netlist->create_gate(gl->get_gate_type_by_name("DFF"), "state_" + std::to_string(i));
+                clk->add_destination(ff, "CLK");
+                q.push_back(m_netlist->create_net("q_" + std::to_string(i)));
+                q.back()->add_source(ff, "Q");
+                d.push_back(m_netlist->create_net("d_" + std::to_string(i)));
+                d.back()->add_destination(ff, "D");
+                m_state_reg.push_back(ff);
+            }
+
+            Gate* xor_0 = m_netlist->create_gate(gl->get_gate_type_by_name("XOR2"), "next_0");
+            q.at(1)->add_destination(xor_0, "I0");
+            a->add_destination(xor_0, "I1");
+            d.at(0)->add_source(xor_0, "O");
+
+            Gate* and_1 = m_netlist->create_gate(gl->get_gate_type_by_name("AND2"), "next_1");
+            q.at(0)->add_destination(and_1, "I0");
+            b->add_destination(and_1, "I1");
+            d.at(1)->add_source(and_1, "O");
+
+            Gate* and_2 = m_netlist->create_gate(gl->get_gate_type_by_name("AND3"), "next_2");
+            q.at(0)->add_destination(and_2, "I0");
+            q.at(1)->add_destination(and_2, "I1");
+            q.at(2)->add_destination(and_2, "I2");
+            d.at(2)->add_source(and_2, "O");
+
+            m_transition_logic = {xor_0, and_1, and_2};
+        }
+
+        // truth table of a transition condition over the inputs a and b
+        std::vector<BooleanFunction::Value> get_truth_table(const BooleanFunction& condition) const
+        {
+            std::vector<BooleanFunction::Value> table;
+            for (u32 assignment = 0; assignment < 4; assignment++)
+            {
+                std::unordered_map<std::string, std::vector<BooleanFunction::Value>> inputs;
+                for (u32 i = 0; i < m_input_vars.size(); i++)
+                {
+                    inputs[m_input_vars.at(i)] = {((assignment >> i) & 1) ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO};
+                }
+                const auto res = condition.evaluate(inputs);
+                table.push_back(res.is_ok() ? res.get().front() : BooleanFunction::Value::X);
+            }
+            return table;
+        }
+
+        // the symbolic solution must cover exactly the given states and agree with the brute force solution on their transitions
+        void expect_matches_brute_force(const std::map<u64, std::map<u64, BooleanFunction>>& symbolic,
+                                        const std::map<u64, std::map<u64, BooleanFunction>>& brute_force,
+                                        const std::set<u64>& expected_states) const
+        {
+            std::set<u64> states;
+            for (const auto& [state, successors] : symbolic)
+            {
+                states.insert(state);
+
+                ASSERT_NE(brute_force.find(state), brute_force.end());
+                const auto& expected_successors = brute_force.at(state);
+                ASSERT_EQ(successors.size(), expected_successors.size()) << "state " << state;
+                for (const auto& [successor, condition] : successors)
+                {
+                    ASSERT_NE(expected_successors.find(successor), expected_successors.end()) << "state " << state << ", successor " << successor;
+                    EXPECT_EQ(get_truth_table(condition), get_truth_table(expected_successors.at(successor))) << "state " << state << ", successor " << successor;
+                }
+            }
+            EXPECT_EQ(states, expected_states);
+        }
+    };
+
+    /**
+     * Test that the symbolic exploration finds the same transitions as the brute force search for all states reachable from the initial state.
+     *
+     * Functions: SolveFsmPlugin::solve_fsm_symbolic, SolveFsmPlugin::solve_fsm_brute_force
+     */
+    TEST_F(SolveFsmTest, check_symbolic_matches_brute_force)
+    {
+        TEST_START
+        {
+            const auto brute_force_res = SolveFsmPlugin::solve_fsm_brute_force(m_netlist.get(), m_state_reg, m_transition_logic);
+            ASSERT_TRUE(brute_force_res.is_ok());
+            const auto brute_force = brute_force_res.get();
+            ASSERT_EQ(brute_force.size(), 8);
+
+            {
+                // starting from state 0, bit 2 is never set
+                const auto symbolic_res = SolveFsmPlugin::solve_fsm_symbolic(m_netlist.get(), m_state_reg, m_transition_logic);
+                ASSERT_TRUE(symbolic_res.is_ok());
+                expect_matches_brute_force(symbolic_res.get(), brute_force, {0, 1, 2, 3});
+            }
+            {
+                // starting from state 7, all states are reachable
+                std::map<Gate*, bool> initial_state = {{m_state_reg.at(0), true}, {m_state_reg.at(1), true}, {m_state_reg.at(2), true}};
+                const auto symbolic_res             = SolveFsmPlugin::solve_fsm_symbolic(m_netlist.get(), m_state_reg, m_transition_logic, initial_state);
+                ASSERT_TRUE(symbolic_res.is_ok());
+                expect_matches_brute_force(symbolic_res.get(), brute_force, {0, 1, 2, 3, 4, 5, 6, 7});
+            }
+        }
+        TEST_END
+    }
+
+    /**
+     * Test that the symbolic exploration fails instead of extracting more transitions than allowed.
+     *
+     * Functions: SolveFsmPlugin::solve_fsm_symbolic
+     */
+    TEST_F(SolveFsmTest, check_symbolic_limits)
+    {
+        TEST_START
+        {
+            // states 0 to 3 have 2, 4, 2, and 4 transitions
+            EXPECT_TRUE(SolveFsmPlugin::solve_fsm_symbolic(m_netlist.get(), m_state_reg, m_transition_logic, {}, "", 1 << 24, 12).is_ok());
+            EXPECT_TRUE(SolveFsmPlugin::solve_fsm_symbolic(m_netlist.get(), m_state_reg, m_transition_logic, {}, "", 1 << 24, 11).is_error());
+            EXPECT_TRUE(SolveFsmPlugin::solve_fsm_symbolic(m_netlist.get(), m_state_reg, m_transition_logic, {}, "", 1 << 24, 3).is_error());
+
+            // too few BDD nodes to even represent the next state functions
+            EXPECT_TRUE(SolveFsmPlugin::solve_fsm_symbolic(m_netlist.get(), m_state_reg, m_transition_logic, {}, "", 4).is_error());
+        }
+        TEST_END
+    }
+}    // namespace hal
@@ -6,6 +6,7 @@
 #include "hal_core/netlist/netlist_factory.h"
 #include "hal_core/utilities/enums.h"
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/trace.h"
 #include "hal_core/utilities/utils.h"
 
 #include <fstream>
@@ -21,6 +22,8 @@ namespace hal
 
     Result<std::monostate> VerilogParser::parse(const std::filesystem::path& file_path)
     {
+        HAL_TRACE_SCOPE("VerilogParser::parse");
+
         m_path = file_path;
         m_modules.clear();
         m_modules_by_name.clear();
@@ -237,6 +240,8 @@ namespace hal
 
     Result<std::unique_ptr<Netlist>> VerilogParser::instantiate(const GateLibrary* gate_library)
     {
+        HAL_TRACE_SCOPE("VerilogParser::instantiate");
+
         // create empty netlist
         std::unique_ptr<Netlist> result = netlist_factory::create_netlist(gate_library);
         m_netlist                       = result.get();
@@ -350,6 +355,13 @@ namespace hal
 
         m_netlist->load_gate_locations_from_data();
 
+        // only query the netlist if the counters are actually recorded
+        if (trace::is_enabled())
+        {
+            trace::count("gates", m_netlist->get_gates().size());
+            trace::count("nets", m_netlist->get_nets().size());
+        }
+
         return OK(std::move(result));
     }
 
@@ -359,6 +371,8 @@ namespace hal
 
     void VerilogParser::tokenize()
     {
+        HAL_TRACE_SCOPE("VerilogParser::tokenize");
+
         const std::string delimiters = "`,()[]{}\\#*: ;=./";
         std::string current_token;
         u32 line_number = 0;
@@ -472,11 +486,14 @@ namespace hal
             }
         }
 
-        m_token_stream = TokenStream(parsed_tokens, {"(", "["}, {")", "]"});
+        trace::count("tokens", parsed_tokens.size());
+        m_token_stream = TokenStream(std::move(parsed_tokens), {"(", "["}, {")", "]"});
     }
 
     Result<std::monostate> VerilogParser::parse_tokens()
     {
+        HAL_TRACE_SCOPE("VerilogParser::parse_tokens");
+
         std::vector<VerilogDataEntry> attributes;
         u32 line_number;
 
@@ -6,6 +6,7 @@
 #include "hal_core/netlist/netlist_factory.h"
 #include "hal_core/utilities/enums.h"
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/trace.h"
 #include "hal_core/utilities/utils.h"
 
 #include <fstream>
@@ -21,6 +22,8 @@ namespace hal
 
     Result<std::monostate> VHDLParser::parse(const std::filesystem::path& file_path)
     {
+        HAL_TRACE_SCOPE("VHDLParser::parse");
+
         m_path = file_path;
         m_entities.clear();
         m_attribute_buffer.clear();
@@ -240,6 +243,8 @@ namespace hal
 
     Result<std::unique_ptr<Netlist>> VHDLParser::instantiate(const GateLibrary* gate_library)
     {
+        HAL_TRACE_SCOPE("VHDLParser::instantiate");
+
         // create empty netlist
         std::unique_ptr<Netlist> result = netlist_factory::create_netlist(gate_library);
         m_netlist                       = result.get();
@@ -411,6 +416,13 @@ namespace hal
 
         m_netlist->load_gate_locations_from_data();
 
+        // only query the netlist if the counters are actually recorded
+        if (trace::is_enabled())
+        {
+            trace::count("gates", m_netlist->get_gates().size());
+            trace::count("nets", m_netlist->get_nets().size());
+        }
+
         return OK(std::move(result));
     }
 
@@ -420,6 +432,8 @@ namespace hal
 
     void VHDLParser::tokenize()
     {
+        HAL_TRACE_SCOPE("VHDLParser::tokenize");
+
         std::vector<Token<core_strings::CaseInsensitiveString>> parsed_tokens;
         const std::string delimiters = ",(): ;=><&";
         core_strings::CaseInsensitiveString current_token;
@@ -505,11 +519,14 @@ namespace hal
                 current_token.clear();
             }
         }
-        m_token_stream = TokenStream(parsed_tokens, {"("}, {")"});
+        trace::count("tokens", parsed_tokens.size());
+        m_token_stream = TokenStream(std::move(parsed_tokens), {"("}, {")"});
     }
 
     Result<std::monostate> VHDLParser::parse_tokens()
     {
+        HAL_TRACE_SCOPE("VHDLParser::parse_tokens");
+
         while (m_token_stream.remaining() > 0)
         {
             if (m_token_stream.peek() == "library" || m_token_stream.peek() == "use")
@@ -68,7 +68,7 @@ namespace hal
                 }
             }
 
-            return TokenStream(parsed_tokens, {}, {});
+            return TokenStream(std::move(parsed_tokens), {}, {});
         }
 
         Result<LOC> parse_LOC(TokenStream<std::string>& ts)
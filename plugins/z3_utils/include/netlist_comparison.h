@@ -0,0 +1,144 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/utilities/result.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace hal
+{
+    class Gate;
+    class GatePin;
+    class Net;
+    class Netlist;
+
+    namespace z3_utils
+    {
+        /**
+         * The result of comparing the functions of the nets connected to the same input pin of two corresponding sequential gates.
+         */
+        struct NetPairComparison
+        {
+            /**
+             * The outcome of a comparison.
+             */
+            enum class Verdict
+            {
+                equal,        /**< The functions of both nets are equivalent. */
+                different,    /**< The functions of both nets differ for at least one input assignment. */
+                unknown       /**< The solver could not decide within the given time limit. */
+            };
+
+            /**
+             * The technique that decided a comparison.
+             */
+            enum class Method
+            {
+                topology,      /**< The pin is connected in only one of the netlists. */
+                structural,    /**< Both functions hash to the same node of the shared and-inverter graph. */
+                simulation,    /**< Random simulation found an input assignment under which both functions differ. */
+                solver         /**< The SMT solver proved equivalence or found a distinguishing input assignment. */
+            };
+
+            /// The sequential gate of the first netlist.
+            const Gate* gate_a = nullptr;
+
+            /// The corresponding sequential gate of the second netlist.
+            const Gate* gate_b = nullptr;
+
+            /// The input pin of both gates.
+            const GatePin* pin = nullptr;
+
+            /// The net connected to the pin of gate A, may be a `nullptr`.
+            const Net* net_a = nullptr;
+
+            /// The net connected to the pin of gate B, may be a `nullptr`.
+            const Net* net_b = nullptr;
+
+            /// The outcome of the comparison.
+            Verdict verdict = Verdict::unknown;
+
+            /// The technique that decided the comparison.
+            Method method = Method::solver;
+
+            /// For differing functions, an assignment of the input variables of both functions under which they differ.
+            std::map<std::string, bool> counterexample;
+        };
+
+        /**
+         * The report of a netlist comparison.
+         */
+        struct NetlistComparisonReport
+        {
+            /// True if both netlists are functionally equivalent, false otherwise.
+            bool equal = true;
+
+            /// A description of the first structural mismatch between the sequential gates of both netlists, empty if they match.
+            std::string mismatch;
+
+            /// The comparisons of all input pins of all pairs of corresponding sequential gates.
+            std::vector<NetPairComparison> comparisons;
+
+            /// The number of comparisons decided by topology, i.e., pins that are connected in only one of the netlists.
+            u32 num_topology = 0;
+
+            /// The number of comparisons decided by structural hashing.
+            u32 num_structural = 0;
+
+            /// The number of comparisons decided by random simulation.
+            u32 num_simulation = 0;
+
+            /// The number of comparisons decided by the SMT solver.
+            u32 num_solver = 0;
+
+            /// The number of comparisons that could not be decided.
+            u32 num_unknown = 0;
+        };
+
+        /**
+         * Compares two netlists by finding a corresponding partner for each sequential gate in the netlist and checking whether the functions of their input nets are equivalent.
+         * In order for this to work the sequential gates of both netlists must have identical names and only the combinational gates may differ.
+         * The inputs of the functions are identified by the name of their source gate and pin, or by their net ID if they do not have a source.
+         * 
+         * The functions of both netlists are built into a single structurally hashed and-inverter graph, so that pairs of functions that end up at the same node are proven equivalent without calling the solver.
+         * Bit-parallel random simulation of the graph then separates pairs that obviously differ and provides a counterexample for them.
+         * Only the remaining pairs are handed to the SMT solver, which runs on multiple threads that each use their own z3 context.
+         * 
+         * @param[in] netlist_a - The first netlist.
+         * @param[in] netlist_b - The second netlist.
+         * @param[in] num_threads - The number of solver threads. Defaults to `0`, which uses as many threads as there are hardware threads.
+         * @param[in] num_simulation_words - The number of 64-bit words of random patterns to simulate, rounded up to a multiple of 4 since the words are simulated in blocks of 4. Defaults to `64`, i.e., 4096 patterns.
+         * @param[in] solver_timeout - The timeout of a single solver call in milliseconds. Defaults to `0`, i.e., no timeout.
+         * @returns Ok and the comparison report on success, an error otherwise.
+         */
+        Result<NetlistComparisonReport>
+            compare_netlists_with_report(const Netlist* netlist_a, const Netlist* netlist_b, u32 num_threads = 0, const u32 num_simulation_words = 64, const u32 solver_timeout = 0);
+    }    // namespace z3_utils
+}    // namespace hal
@@ -158,6 +158,7 @@ namespace hal
          * Compares two netlist by finding a corresponding partner for each sequential gate in the netlist and checking whether they are identical.
          * This is done on a functional level by buidling the subgraph function of all their input nets considering all combinational gates of the netlist.
          * In order for this two work the sequential gates of both netlists must have identical names and only the combinational gates may differ.
+         * The comparison is performed by `compare_netlists_with_report`, which provides details and counterexamples for all compared nets.
          * 
          * @param[in] netlist_a - The first netlist.
          * @param[in] netlist_b - The second netlist.
@@ -1,5 +1,6 @@
 #include "hal_core/python_bindings/python_bindings.h"
 
+#include "netlist_comparison.h"
 #include "plugin_z3_utils.h"
 #include "pybind11/operators.h"
 #include "pybind11/pybind11.h"
@@ -48,6 +49,7 @@ namespace hal
             },
             py::arg("netlist_a"),
             py::arg("netlist_b"),
+            py::call_guard<py::gil_scoped_release>(),
             R"(
             Compares two netlist by finding a corresponding partner for each sequential gate in the netlist and checking whether they are identical.
             This is done on a functional level by buidling the subgraph function of all their input nets considering all combinational gates of the netlist.
@@ -59,6 +61,169 @@ namespace hal
             :rtype: bool or None
         )");
 
+        py::class_<z3_utils::NetPairComparison> py_net_pair_comparison(m, "NetPairComparison", R"(
+            The result of comparing the functions of the nets connected to the same input pin of two corresponding sequential gates.
+        )");
+
+        py::enum_<z3_utils::NetPairComparison::Verdict>(py_net_pair_comparison, "Verdict", R"(
+            The outcome of a comparison.
+        )")
+            .value("equal", z3_utils::NetPairComparison::Verdict::equal, R"(The functions of both nets are equivalent.)")
+            .value("different", z3_utils::NetPairComparison::Verdict::different, R"(The functions of both nets differ for at least one input assignment.)")
+            .value("unknown", z3_utils::NetPairComparison::Verdict::unknown, R"(The solver could not decide within the given time limit.)")
+            .export_values();
+
+        py::enum_<z3_utils::NetPairComparison::Method>(py_net_pair_comparison, "Method", R"(
+            The technique that decided a comparison.
+        )")
+            .value("topology", z3_utils::NetPairComparison::Method::topology, R"(The pin is connected in only one of the netlists.)")
+            .value("structural", z3_utils::NetPairComparison::Method::structural, R"(Both functions hash to the same node of the shared and-inverter graph.)")
+            .value("simulation", z3_utils::NetPairComparison::Method::simulation, R"(Random simulation found an input assignment under which both functions differ.)")
+            .value("solver", z3_utils::NetPairComparison::Method::solver, R"(The SMT solver proved equivalence or found a distinguishing input assignment.)")
+            .export_values();
+
+        py_net_pair_comparison.def_property_readonly(
+            "gate_a", [](const z3_utils::NetPairComparison& self) { return const_cast<Gate*>(self.gate_a); }, R"(
+            The sequential gate of the first netlist.
+
+            :type: hal_py.Gate
+        )");
+
+        py_net_pair_comparison.def_property_readonly(
+            "gate_b", [](const z3_utils::NetPairComparison& self) { return const_cast<Gate*>(self.gate_b); }, R"(
+            The corresponding sequential gate of the second netlist.
+
+            :type: hal_py.Gate
+        )");
+
+        py_net_pair_comparison.def_property_readonly(
+            "pin", [](const z3_utils::NetPairComparison& self) { return const_cast<GatePin*>(self.pin); }, R"(
+            The input pin of both gates.
+
+            :type: hal_py.GatePin
+        )");
+
+        py_net_pair_comparison.def_property_readonly(
+            "net_a", [](const z3_utils::NetPairComparison& self) { return const_cast<Net*>(self.net_a); }, R"(
+            The net connected to the pin of gate A, may be ``None``.
+
+            :type: hal_py.Net or None
+        )");
+
+        py_net_pair_comparison.def_property_readonly(
+            "net_b", [](const z3_utils::NetPairComparison& self) { return const_cast<Net*>(self.net_b); }, R"(
+            The net connected to the pin of gate B, may be ``None``.
+
+            :type: hal_py.Net or None
+        )");
+
+        py_net_pair_comparison.def_readonly("verdict", &z3_utils::NetPairComparison::verdict, R"(
+            The outcome of the comparison.
+
+            :type: z3_utils.NetPairComparison.Verdict
+        )");
+
+        py_net_pair_comparison.def_readonly("method", &z3_utils::NetPairComparison::method, R"(
+            The technique that decided the comparison.
+
+            :type: z3_utils.NetPairComparison.Method
+        )");
+
+        py_net_pair_comparison.def_readonly("counterexample", &z3_utils::NetPairComparison::counterexample, R"(
+            For differing functions, an assignment of the input variables of both functions under which they differ.
+
+            :type: dict[str,bool]
+        )");
+
+        py::class_<z3_utils::NetlistComparisonReport> py_netlist_comparison_report(m, "NetlistComparisonReport", R"(
+            The report of a netlist comparison.
+        )");
+
+        py_netlist_comparison_report.def_readonly("equal", &z3_utils::NetlistComparisonReport::equal, R"(
+            ``True`` if both netlists are functionally equivalent, ``False`` otherwise.
+
+            :type: bool
+        )");
+
+        py_netlist_comparison_report.def_readonly("mismatch", &z3_utils::NetlistComparisonReport::mismatch, R"(
+            A description of the first structural mismatch between the sequential gates of both netlists, empty if they match.
+
+            :type: str
+        )");
+
+        py_netlist_comparison_report.def_readonly("comparisons", &z3_utils::NetlistComparisonReport::comparisons, R"(
+            The comparisons of all input pins of all pairs of corresponding sequential gates.
+
+            :type: list[z3_utils.NetPairComparison]
+        )");
+
+        py_netlist_comparison_report.def_readonly("num_topology", &z3_utils::NetlistComparisonReport::num_topology, R"(
+            The number of comparisons decided by topology, i.e., pins that are connected in only one of the netlists.
+
+            :type: int
+        )");
+
+        py_netlist_comparison_report.def_readonly("num_structural", &z3_utils::NetlistComparisonReport::num_structural, R"(
+            The number of comparisons decided by structural hashing.
+
+            :type: int
+        )");
+
+        py_netlist_comparison_report.def_readonly("num_simulation", &z3_utils::NetlistComparisonReport::num_simulation, R"(
+            The number of comparisons decided by random simulation.
+
+            :type: int
+        )");
+
+        py_netlist_comparison_report.def_readonly("num_solver", &z3_utils::NetlistComparisonReport::num_solver, R"(
+            The number of comparisons decided by the SMT solver.
+
+            :type: int
+        )");
+
+        py_netlist_comparison_report.def_readonly("num_unknown", &z3_utils::NetlistComparisonReport::num_unknown, R"(
+            The number of comparisons that could not be decided.
+
+            :type: int
+        )");
+
+        py_z3_utils.def_static(
+            "compare_netlists_with_report",
+            [](const Netlist* netlist_a, const Netlist* netlist_b, const u32 num_threads = 0, const u32 num_simulation_words = 64, const u32 solver_timeout = 0)
+                -> std::optional<z3_utils::NetlistComparisonReport> {
+                auto res = z3_utils::compare_netlists_with_report(netlist_a, netlist_b, num_threads, num_simulation_words, solver_timeout);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("netlist_a"),
+            py::arg("netlist_b"),
+            py::arg("num_threads")          = 0,
+            py::arg("num_simulation_words") = 64,
+            py::arg("solver_timeout")       = 0,
+            py::call_guard<py::gil_scoped_release>(),
+            R"(
+            Compares two netlists by finding a corresponding partner for each sequential gate in the netlist and checking whether the functions of their input nets are equivalent.
+            In order for this to work the sequential gates of both netlists must have identical names and only the combinational gates may differ.
+            The functions of both netlists are built into a single structurally hashed and-inverter graph, so that pairs of functions that end up at the same node are proven equivalent without calling the solver.
+            Bit-parallel random simulation of the graph then separates pairs that obviously differ and provides a counterexample for them.
+            Only the remaining pairs are handed to the SMT solver, which runs on multiple threads that each use their own z3 context.
+
+            :param hal_py.Netlist netlist_a: First netlist to compare.
+            :param hal_py.Netlist netlist_b: Second netlist to compare.
+            :param int num_threads: The number of solver threads. Defaults to ``0``, which uses as many threads as there are hardware threads.
+            :param int num_simulation_words: The number of 64-bit words of random patterns to simulate, rounded up to a multiple of 4 since the words are simulated in blocks of 4. Defaults to ``64``, i.e., 4096 patterns.
+            :param int solver_timeout: The timeout of a single solver call in milliseconds. Defaults to ``0``, i.e., no timeout.
+            :returns: The comparison report on success, None otherwise.
+            :rtype: z3_utils.NetlistComparisonReport or None
+        )");
+
 #ifndef PYBIND11_MODULE
         return m.ptr();
 #endif    // PYBIND11_MODULE
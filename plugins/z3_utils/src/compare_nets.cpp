@@ -3,6 +3,7 @@
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/utilities/log.h"
+#include "z3_utils/include/netlist_comparison.h"
 #include "z3_utils/include/z3_utils.h"
 
 namespace hal
@@ -169,108 +170,48 @@ namespace hal
 
         Result<bool> compare_netlists(const Netlist* netlist_a, const Netlist* netlist_b)
         {
-            std::vector<Gate*> seq_gates_a = netlist_a->get_gates([](const Gate* g) {
-                auto props = g->get_type()->get_properties();
-                return props.find(GateTypeProperty::sequential) != props.end();
-            });
-            std::vector<Gate*> seq_gates_b = netlist_b->get_gates([](const Gate* g) {
-                auto props = g->get_type()->get_properties();
-                return props.find(GateTypeProperty::sequential) != props.end();
-            });
-
-            if (seq_gates_a.size() != seq_gates_b.size())
+            const auto report_res = z3_utils::compare_netlists_with_report(netlist_a, netlist_b);
+            if (report_res.is_error())
             {
-                log_debug("iphone_tools",
-                          "netlist a with ID {} and netlist b with ID {} are not equal: unequal amount of sequential gates! {} vs. {}",
-                          netlist_a->get_id(),
-                          netlist_b->get_id(),
-                          seq_gates_a.size(),
-                          seq_gates_b.size());
-                return OK(false);
+                return ERR_APPEND(report_res.get_error(), "cannot compare netlists: failed to generate comparison report");
             }
+            const NetlistComparisonReport report = report_res.get();
 
-            // TODO let the user provide a name mapping from gate a to net b incase there was a renaming of the sequential gates
-            std::unordered_map<std::string, Gate*> gate_name_to_gate_a;
-            std::unordered_map<std::string, Gate*> gate_name_to_gate_b;
-
-            for (const auto& gate_a : seq_gates_a)
-            {
-                gate_name_to_gate_a[gate_a->get_name()] = gate_a;
-            }
-            for (const auto& gate_b : seq_gates_b)
+            if (!report.mismatch.empty())
             {
-                gate_name_to_gate_b[gate_b->get_name()] = gate_b;
+                log_debug("z3_utils", "netlist a with ID {} and netlist b with ID {} are not equal: {}", netlist_a->get_id(), netlist_b->get_id(), report.mismatch);
+                return OK(false);
             }
 
-            for (const auto& [gate_a_name, gate_a] : gate_name_to_gate_a)
+            // a single differing pair decides the comparison, even if other pairs could not be decided
+            const NetPairComparison* undecided = nullptr;
+            for (const NetPairComparison& comparison : report.comparisons)
             {
-                if (const auto gate_b_it = gate_name_to_gate_b.find(gate_a_name); gate_b_it == gate_name_to_gate_b.end())
+                if (comparison.verdict == NetPairComparison::Verdict::different)
                 {
-                    log_debug("iphone_tools",
-                              "netlist a with ID {} and netlist b with ID {} are not equal: gate a {} with ID {} is included in netlist a but does not have a counter part in netlist b!",
+                    log_debug("z3_utils",
+                              "netlist a with ID {} and netlist b with ID {} are not equal: gate a {} with ID {} and gate b {} with ID {} are not equal at pin {}",
                               netlist_a->get_id(),
                               netlist_b->get_id(),
-                              gate_a->get_name(),
-                              gate_a->get_id());
+                              comparison.gate_a->get_name(),
+                              comparison.gate_a->get_id(),
+                              comparison.gate_b->get_name(),
+                              comparison.gate_b->get_id(),
+                              comparison.pin->get_name());
                     return OK(false);
                 }
-            }
-
-            log_info("iphone_tools", "Checking {} sequential gates for equality.", seq_gates_a.size());
 
-            for (const Gate* gate_a : seq_gates_a)
-            {
-                const Gate* gate_b = gate_name_to_gate_b.at(gate_a->get_name());
-
-                if (gate_a->get_type() != gate_b->get_type())
+                if (comparison.verdict == NetPairComparison::Verdict::unknown && undecided == nullptr)
                 {
-                    log_debug("iphone_tools",
-                              "netlist a with ID {} and netlist b with ID {} are not equal: gate a {} with ID {} and gate b {} with ID {} do not have the same type! {} vs. {}",
-                              netlist_a->get_id(),
-                              netlist_b->get_id(),
-                              gate_a->get_name(),
-                              gate_a->get_id(),
-                              gate_b->get_name(),
-                              gate_b->get_id(),
-                              gate_a->get_type()->get_name(),
-                              gate_b->get_type()->get_name());
-                    return OK(false);
+                    undecided = &comparison;
                 }
+            }
 
-                for (const GatePin* pin : gate_a->get_type()->get_input_pins())
-                {
-                    const Net* net_a = gate_a->get_fan_in_net(pin);
-                    const Net* net_b = gate_b->get_fan_in_net(pin);
-
-                    if (net_a == nullptr && net_b == nullptr)
-                    {
-                        continue;
-                    }
-
-                    const auto eq_res = z3_utils::compare_nets(netlist_a, netlist_b, net_a, net_b, true);
-                    if (eq_res.is_error())
-                    {
-                        return ERR_APPEND(eq_res.get_error(),
-                                          "cannot compare netlist a with ID " + std::to_string(netlist_a->get_id()) + " netlist b with ID " + std::to_string(netlist_b->get_id())
-                                              + ": failed to compare nets at gate a " + gate_a->get_name() + " with ID " + std::to_string(gate_a->get_id()) + " and gate b" + gate_b->get_name()
-                                              + "with ID " + std::to_string(gate_b->get_id()));
-                    }
-                    const bool eq = eq_res.get();
-
-                    if (!eq)
-                    {
-                        log_debug("iphone_tools",
-                                  "netlist a with ID {} and netlist b with ID {} are not equal: gate a {} with ID {} and gate b {} with ID {} are not equal at pin {}",
-                                  netlist_a->get_id(),
-                                  netlist_b->get_id(),
-                                  gate_a->get_name(),
-                                  gate_a->get_id(),
-                                  gate_b->get_name(),
-                                  gate_b->get_id(),
-                                  pin->get_name());
-                        return OK(false);
-                    }
-                }
+            if (undecided != nullptr)
+            {
+                return ERR("cannot compare netlist a with ID " + std::to_string(netlist_a->get_id()) + " and netlist b with ID " + std::to_string(netlist_b->get_id())
+                           + ": could not decide equality of nets at gate a " + undecided->gate_a->get_name() + " with ID " + std::to_string(undecided->gate_a->get_id()) + " and gate b "
+                           + undecided->gate_b->get_name() + " with ID " + std::to_string(undecided->gate_b->get_id()) + " at pin " + undecided->pin->get_name());
             }
 
             return OK(true);
@@ -0,0 +1,730 @@
+#include "z3_utils/include/netlist_comparison.h"
+
+#include "hal_core/netlist/decorators/boolean_function_net_decorator.h"
+#include "hal_core/netlist/endpoint.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/utilities/log.h"
+#include "hal_core/utilities/parallel.h"
+#include "z3++.h"
+
+#include <algorithm>
+#include <atomic>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace hal
+{
+    namespace z3_utils
+    {
+        namespace
+        {
+            // number of 64-bit words simulated at once for every node of the graph
+            constexpr u32 SIMULATION_BLOCK_WORDS = 4;
+
+            // a pair of nets that is not decided by structural hashing, given as index of the comparison, the literals of both nets, and the inputs both functions depend on
+            struct OpenPair
+            {
+                u32 index;
+                u32 literal_a;
+                u32 literal_b;
+                std::vector<u32> support;
+            };
+
+            u64 splitmix64(u64& state)
+            {
+                u64 z = (state += 0x9E3779B97F4A7C15ULL);
+                z     = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                z     = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+                return z ^ (z >> 31);
+            }
+
+            /**
+             * An and-inverter graph with additional XOR nodes that is shared by the functions of both netlists.
+             * A literal is twice the index of a node, plus one if the node is inverted, and node 0 is the constant zero.
+             * Nodes are normalized and structurally hashed on creation, so that identical subfunctions are represented by the same node.
+             * Since operands are always created before the nodes using them, the node indices are in topological order.
+             */
+            class AndInverterGraph
+            {
+            public:
+                static constexpr u32 ZERO = 0;
+                static constexpr u32 ONE  = 1;
+
+                enum class Kind
+                {
+                    Constant,
+                    Input,
+                    And,
+                    Xor
+                };
+
+                struct Node
+                {
+                    Kind kind;
+                    u32 a;
+                    u32 b;
+                };
+
+                AndInverterGraph()
+                {
+                    m_nodes.push_back({Kind::Constant, 0, 0});
+                }
+
+                u32 get_input(const std::string& name)
+                {
+                    if (const auto it = m_inputs.find(name); it != m_inputs.end())
+                    {
+                        return it->second;
+                    }
+                    const u32 literal = (u32)m_nodes.size() << 1;
+                    m_nodes.push_back({Kind::Input, (u32)m_input_names.size(), 0});
+                    m_input_names.push_back(name);
+                    m_inputs.emplace(name, literal);
+                    return literal;
+                }
+
+                u32 make_and(u32 a, u32 b)
+                {
+                    if (a > b)
+                    {
+                        std::swap(a, b);
+                    }
+                    if (a == ZERO || a == (b ^ 1))
+                    {
+                        return ZERO;
+                    }
+                    if (a == ONE || a == b)
+                    {
+                        return b;
+                    }
+                    return get_node(Kind::And, m_and_nodes, a, b);
+                }
+
+                u32 make_xor(u32 a, u32 b)
+                {
+                    // inversions of the operands are moved to the output
+                    const u32 inverted = (a ^ b) & 1;
+                    a &= ~1u;
+                    b &= ~1u;
+                    if (a > b)
+                    {
+                        std::swap(a, b);
+                    }
+                    if (a == b)
+                    {
+                        return inverted;
+                    }
+                    if (a == ZERO)
+                    {
+                        return b ^ inverted;
+                    }
+                    return get_node(Kind::Xor, m_xor_nodes, a, b) ^ inverted;
+                }
+
+                u32 make_or(u32 a, u32 b)
+                {
+                    return make_and(a ^ 1, b ^ 1) ^ 1;
+                }
+
+                u32 make_mux(u32 s, u32 a, u32 b)
+                {
+                    if (a == b)
+                    {
+                        return a;
+                    }
+                    return make_or(make_and(s, a), make_and(s ^ 1, b));
+                }
+
+                const std::vector<Node>& get_nodes() const
+                {
+                    return m_nodes;
+                }
+
+                const std::string& get_input_name(const Node& node) const
+                {
+                    return m_input_names.at(node.a);
+                }
+
+                /**
+                 * Get the indices of all input nodes that the given literals depend on.
+                 */
+                std::vector<u32> get_support(const std::vector<u32>& literals) const
+                {
+                    std::vector<u32> support;
+                    std::unordered_set<u32> visited;
+                    std::vector<u32> stack;
+                    for (const u32 literal : literals)
+                    {
+                        stack.push_back(literal >> 1);
+                    }
+                    while (!stack.empty())
+                    {
+                        const u32 index = stack.back();
+                        stack.pop_back();
+                        if (!visited.insert(index).second)
+                        {
+                            continue;
+                        }
+
+                        const Node& node = m_nodes[index];
+                        if (node.kind == Kind::Input)
+                        {
+                            support.push_back(index);
+                        }
+                        else if (node.kind != Kind::Constant)
+                        {
+                            stack.push_back(node.a >> 1);
+                            stack.push_back(node.b >> 1);
+                        }
+                    }
+                    std::sort(support.begin(), support.end());
+                    return support;
+                }
+
+            private:
+                u32 get_node(Kind kind, std::unordered_map<u64, u32>& table, u32 a, u32 b)
+                {
+                    const u64 key = ((u64)a << 32) | b;
+                    if (const auto it = table.find(key); it != table.end())
+                    {
+                        return it->second;
+                    }
+                    const u32 literal = (u32)m_nodes.size() << 1;
+                    m_nodes.push_back({kind, a, b});
+                    table.emplace(key, literal);
+                    return literal;
+                }
+
+                std::vector<Node> m_nodes;
+                std::vector<std::string> m_input_names;
+                std::unordered_map<std::string, u32> m_inputs;
+                std::unordered_map<u64, u32> m_and_nodes;
+                std::unordered_map<u64, u32> m_xor_nodes;
+            };
+
+            struct NetFunction
+            {
+                BooleanFunction function;
+                std::unordered_map<std::string, const Net*> inputs;
+            };
+
+            /**
+             * Get the name of the graph input that represents the given net, or an empty string if the net is driven by a combinational gate.
+             * Nets driven by a non-combinational gate are identified by the name of their source gate and pin, so that they match between both netlists.
+             */
+            Result<std::string> get_input_name(const Net* net)
+            {
+                const std::vector<Endpoint*> sources = net->get_sources();
+                if (sources.size() > 1)
+                {
+                    return ERR("cannot get input name of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": net is multi driven");
+                }
+
+                if (sources.empty())
+                {
+                    return OK(BooleanFunctionNetDecorator(*net).get_boolean_variable_name());
+                }
+
+                const Gate* src_gate = sources.front()->get_gate();
+                if (src_gate->get_type()->has_property(GateTypeProperty::combinational))
+                {
+                    return OK(std::string());
+                }
+                return OK(src_gate->get_name() + "_" + sources.front()->get_pin()->get_name());
+            }
+
+            Result<u32> translate_function(AndInverterGraph& aig, const NetFunction& net_function, const std::unordered_map<const Net*, u32>& literals)
+            {
+                const BooleanFunction& bf = net_function.function;
+                if (bf.size() != 1)
+                {
+                    return ERR("could not translate Boolean function: expected a bit-size of 1, but got " + std::to_string(bf.size()));
+                }
+
+                std::vector<u32> stack;
+                for (const auto& node : bf.get_nodes())
+                {
+                    if (stack.size() < node.get_arity())
+                    {
+                        return ERR("could not translate Boolean function: invalid number of operands");
+                    }
+                    std::vector<u32> operands(stack.end() - node.get_arity(), stack.end());
+                    stack.erase(stack.end() - node.get_arity(), stack.end());
+
+                    switch (node.type)
+                    {
+                        case BooleanFunction::NodeType::Constant:
+                            if (node.has_constant_value(0))
+                            {
+                                stack.push_back(AndInverterGraph::ZERO);
+                            }
+                            else if (node.has_constant_value(1))
+                            {
+                                stack.push_back(AndInverterGraph::ONE);
+                            }
+                            else
+                            {
+                                return ERR("could not translate Boolean function: unsupported constant " + node.to_string());
+                            }
+                            break;
+                        case BooleanFunction::NodeType::Variable:
+                            if (const auto it = net_function.inputs.find(node.variable); it != net_function.inputs.end())
+                            {
+                                stack.push_back(literals.at(it->second));
+                            }
+                            else
+                            {
+                                return ERR("could not translate Boolean function: no net found for variable '" + node.variable + "'");
+                            }
+                            break;
+                        case BooleanFunction::NodeType::And:
+                            stack.push_back(aig.make_and(operands[0], operands[1]));
+                            break;
+                        case BooleanFunction::NodeType::Or:
+                            stack.push_back(aig.make_or(operands[0], operands[1]));
+                            break;
+                        case BooleanFunction::NodeType::Not:
+                            stack.push_back(operands[0] ^ 1);
+                            break;
+                        case BooleanFunction::NodeType::Xor:
+                            stack.push_back(aig.make_xor(operands[0], operands[1]));
+                            break;
+                        case BooleanFunction::NodeType::Eq:
+                            stack.push_back(aig.make_xor(operands[0], operands[1]) ^ 1);
+                            break;
+                        case BooleanFunction::NodeType::Ite:
+                            stack.push_back(aig.make_mux(operands[0], operands[1], operands[2]));
+                            break;
+                        default:
+                            return ERR("could not translate Boolean function: unsupported node " + node.to_string());
+                    }
+                }
+
+                if (stack.size() != 1)
+                {
+                    return ERR("could not translate Boolean function: number of elements remaining on the stack is not 1");
+                }
+                return OK(stack.back());
+            }
+
+            /**
+             * Adds the functions of the given nets to the graph, considering all combinational gates of the netlist.
+             * The cones are traversed iteratively, so that deep logic does not exhaust the call stack.
+             */
+            Result<std::monostate> add_net_functions(AndInverterGraph& aig, const std::vector<const Net*>& nets, std::unordered_map<const Net*, u32>& literals)
+            {
+                std::unordered_map<const Net*, NetFunction> pending;
+                std::vector<std::pair<const Net*, bool>> stack;
+                for (const Net* output : nets)
+                {
+                    stack.push_back({output, false});
+                    while (!stack.empty())
+                    {
+                        const auto [net, expanded] = stack.back();
+                        stack.pop_back();
+
+                        if (expanded)
+                        {
+                            const auto it      = pending.find(net);
+                            const auto lit_res = translate_function(aig, it->second, literals);
+                            if (lit_res.is_error())
+                            {
+                                return ERR_APPEND(lit_res.get_error(), "cannot add function of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + " to graph");
+                            }
+                            literals[net] = lit_res.get();
+                            pending.erase(it);
+                            continue;
+                        }
+
+                        if (literals.find(net) != literals.end())
+                        {
+                            continue;
+                        }
+
+                        // an unfinished net that is reached again is part of its own fan-in
+                        if (pending.find(net) != pending.end())
+                        {
+                            return ERR("cannot add function of net '" + output->get_name() + "' with ID " + std::to_string(output->get_id()) + " to graph: net '" + net->get_name() + "' with ID "
+                                       + std::to_string(net->get_id()) + " is part of a combinational loop");
+                        }
+
+                        const auto name_res = get_input_name(net);
+                        if (name_res.is_error())
+                        {
+                            return ERR_APPEND(name_res.get_error(), "cannot add function of net '" + output->get_name() + "' with ID " + std::to_string(output->get_id()) + " to graph");
+                        }
+                        if (const std::string name = name_res.get(); !name.empty())
+                        {
+                            literals[net] = aig.get_input(name);
+                            continue;
+                        }
+
+                        const Endpoint* src_ep = net->get_sources().front();
+                        auto bf_res            = src_ep->get_gate()->get_resolved_boolean_function(src_ep->get_pin());
+                        if (bf_res.is_error())
+                        {
+                            return ERR_APPEND(bf_res.get_error(),
+                                              "cannot add function of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + " to graph: failed to get function of gate '"
+                                                  + src_ep->get_gate()->get_name() + "' with ID " + std::to_string(src_ep->get_gate()->get_id()));
+                        }
+
+                        NetFunction net_function;
+                        net_function.function = bf_res.get();
+                        stack.push_back({net, true});
+                        for (const std::string& var : net_function.function.get_variable_names())
+                        {
+                            const auto in_net_res = BooleanFunctionNetDecorator::get_net_from(net->get_netlist(), var);
+                            if (in_net_res.is_error())
+                            {
+                                return ERR_APPEND(in_net_res.get_error(),
+                                                  "cannot add function of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + " to graph: failed to get net of variable '" + var
+                                                      + "'");
+                            }
+                            const Net* in_net = in_net_res.get();
+                            net_function.inputs.emplace(var, in_net);
+                            stack.push_back({in_net, false});
+                        }
+                        pending.emplace(net, std::move(net_function));
+                    }
+                }
+                return OK({});
+            }
+
+            z3::expr get_z3_expr(const AndInverterGraph& aig, const u32 literal, z3::context& ctx, std::unordered_map<u32, z3::expr>& exprs)
+            {
+                const auto& nodes = aig.get_nodes();
+
+                std::vector<u32> stack = {literal >> 1};
+                while (!stack.empty())
+                {
+                    const u32 index = stack.back();
+                    if (exprs.find(index) != exprs.end())
+                    {
+                        stack.pop_back();
+                        continue;
+                    }
+
+                    const auto& node = nodes[index];
+                    if (node.kind == AndInverterGraph::Kind::Constant)
+                    {
+                        exprs.emplace(index, ctx.bool_val(false));
+                        stack.pop_back();
+                        continue;
+                    }
+                    if (node.kind == AndInverterGraph::Kind::Input)
+                    {
+                        exprs.emplace(index, ctx.bool_const(aig.get_input_name(node).c_str()));
+                        stack.pop_back();
+                        continue;
+                    }
+
+                    const auto it_a = exprs.find(node.a >> 1);
+                    const auto it_b = exprs.find(node.b >> 1);
+                    if (it_a == exprs.end() || it_b == exprs.end())
+                    {
+                        stack.push_back(node.a >> 1);
+                        stack.push_back(node.b >> 1);
+                        continue;
+                    }
+
+                    const z3::expr a = (node.a & 1) ? !it_a->second : it_a->second;
+                    const z3::expr b = (node.b & 1) ? !it_b->second : it_b->second;
+                    exprs.emplace(index, (node.kind == AndInverterGraph::Kind::And) ? (a && b) : (a != b));
+                    stack.pop_back();
+                }
+
+                const z3::expr& e = exprs.at(literal >> 1);
+                return (literal & 1) ? !e : e;
+            }
+
+            void simulate(const AndInverterGraph& aig, u64& state, std::vector<u64>& values)
+            {
+                const auto& nodes = aig.get_nodes();
+                values.resize(nodes.size() * SIMULATION_BLOCK_WORDS);
+
+                for (u32 i = 0; i < nodes.size(); i++)
+                {
+                    const auto& node = nodes[i];
+                    u64* dst         = &values[i * SIMULATION_BLOCK_WORDS];
+                    const u64* a     = &values[(node.a >> 1) * SIMULATION_BLOCK_WORDS];
+                    const u64* b     = &values[(node.b >> 1) * SIMULATION_BLOCK_WORDS];
+                    const u64 mask_a = (node.a & 1) ? ~0ULL : 0ULL;
+                    const u64 mask_b = (node.b & 1) ? ~0ULL : 0ULL;
+                    switch (node.kind)
+                    {
+                        case AndInverterGraph::Kind::Constant:
+                            std::fill(dst, dst + SIMULATION_BLOCK_WORDS, 0ULL);
+                            break;
+                        case AndInverterGraph::Kind::Input:
+                            for (u32 w = 0; w < SIMULATION_BLOCK_WORDS; w++)
+                            {
+                                dst[w] = splitmix64(state);
+                            }
+                            break;
+                        case AndInverterGraph::Kind::And:
+                            for (u32 w = 0; w < SIMULATION_BLOCK_WORDS; w++)
+                            {
+                                dst[w] = (a[w] ^ mask_a) & (b[w] ^ mask_b);
+                            }
+                            break;
+                        case AndInverterGraph::Kind::Xor:
+                            for (u32 w = 0; w < SIMULATION_BLOCK_WORDS; w++)
+                            {
+                                dst[w] = a[w] ^ b[w];
+                            }
+                            break;
+                    }
+                }
+            }
+        }    // namespace
+
+        Result<NetlistComparisonReport> compare_netlists_with_report(const Netlist* netlist_a, const Netlist* netlist_b, u32 num_threads, const u32 num_simulation_words, const u32 solver_timeout)
+        {
+            if (netlist_a == nullptr)
+            {
+                return ERR("cannot compare netlists: netlist_a is a nullptr!");
+            }
+
+            if (netlist_b == nullptr)
+            {
+                return ERR("cannot compare netlists: netlist_b is a nullptr!");
+            }
+
+            NetlistComparisonReport report;
+
+            std::vector<Gate*> seq_gates_a = netlist_a->get_gates([](const Gate* g) { return g->get_type()->has_property(GateTypeProperty::sequential); });
+            std::vector<Gate*> seq_gates_b = netlist_b->get_gates([](const Gate* g) { return g->get_type()->has_property(GateTypeProperty::sequential); });
+            std::sort(seq_gates_a.begin(), seq_gates_a.end(), [](const Gate* g1, const Gate* g2) { return g1->get_id() < g2->get_id(); });
+
+            if (seq_gates_a.size() != seq_gates_b.size())
+            {
+                report.equal    = false;
+                report.mismatch = "unequal amount of sequential gates: " + std::to_string(seq_gates_a.size()) + " vs. " + std::to_string(seq_gates_b.size());
+                return OK(report);
+            }
+
+            std::unordered_map<std::string, Gate*> gate_name_to_gate_b;
+            for (Gate* gate_b : seq_gates_b)
+            {
+                gate_name_to_gate_b[gate_b->get_name()] = gate_b;
+            }
+
+            std::vector<const Net*> nets_a;
+            std::vector<const Net*> nets_b;
+            for (const Gate* gate_a : seq_gates_a)
+            {
+                const auto gate_b_it = gate_name_to_gate_b.find(gate_a->get_name());
+                if (gate_b_it == gate_name_to_gate_b.end())
+                {
+                    report.equal    = false;
+                    report.mismatch = "gate a '" + gate_a->get_name() + "' with ID " + std::to_string(gate_a->get_id()) + " does not have a counterpart in netlist b";
+                    return OK(report);
+                }
+                const Gate* gate_b = gate_b_it->second;
+
+                if (gate_a->get_type() != gate_b->get_type())
+                {
+                    report.equal    = false;
+                    report.mismatch = "gate a '" + gate_a->get_name() + "' with ID " + std::to_string(gate_a->get_id()) + " and gate b with ID " + std::to_string(gate_b->get_id())
+                                      + " do not have the same type: " + gate_a->get_type()->get_name() + " vs. " + gate_b->get_type()->get_name();
+                    return OK(report);
+                }
+
+                for (const GatePin* pin : gate_a->get_type()->get_input_pins())
+                {
+                    NetPairComparison comparison;
+                    comparison.gate_a = gate_a;
+                    comparison.gate_b = gate_b;
+                    comparison.pin    = pin;
+                    comparison.net_a  = gate_a->get_fan_in_net(pin);
+                    comparison.net_b  = gate_b->get_fan_in_net(pin);
+
+                    if (comparison.net_a == nullptr && comparison.net_b == nullptr)
+                    {
+                        continue;
+                    }
+                    else if (comparison.net_a == nullptr || comparison.net_b == nullptr)
+                    {
+                        comparison.verdict = NetPairComparison::Verdict::different;
+                        comparison.method  = NetPairComparison::Method::topology;
+                    }
+                    else
+                    {
+                        nets_a.push_back(comparison.net_a);
+                        nets_b.push_back(comparison.net_b);
+                    }
+                    report.comparisons.push_back(comparison);
+                }
+            }
+
+            // build the functions of both netlists into a single graph, so that shared logic ends up at the same nodes
+            AndInverterGraph aig;
+            std::unordered_map<const Net*, u32> literals_a;
+            std::unordered_map<const Net*, u32> literals_b;
+            if (auto res = add_net_functions(aig, nets_a, literals_a); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "cannot compare netlist a with ID " + std::to_string(netlist_a->get_id()) + " and netlist b with ID " + std::to_string(netlist_b->get_id()));
+            }
+            if (auto res = add_net_functions(aig, nets_b, literals_b); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "cannot compare netlist a with ID " + std::to_string(netlist_a->get_id()) + " and netlist b with ID " + std::to_string(netlist_b->get_id()));
+            }
+
+            // the support of every open pair is computed once and used for the counterexamples of both simulation and solver
+            std::vector<OpenPair> open_pairs;
+            for (u32 i = 0; i < report.comparisons.size(); i++)
+            {
+                NetPairComparison& comparison = report.comparisons[i];
+                if (comparison.method == NetPairComparison::Method::topology)
+                {
+                    continue;
+                }
+
+                const u32 literal_a = literals_a.at(comparison.net_a);
+                const u32 literal_b = literals_b.at(comparison.net_b);
+                if (literal_a == literal_b)
+                {
+                    comparison.verdict = NetPairComparison::Verdict::equal;
+                    comparison.method  = NetPairComparison::Method::structural;
+                }
+                else
+                {
+                    open_pairs.push_back({i, literal_a, literal_b, aig.get_support({literal_a, literal_b})});
+                }
+            }
+
+            log_debug("z3_utils", "built graph with {} nodes, {} of {} pairs of nets are structurally equal.", aig.get_nodes().size(), report.comparisons.size() - open_pairs.size(), report.comparisons.size());
+
+            // random simulation, pairs that differ for any pattern are removed
+            const auto& nodes = aig.get_nodes();
+            u64 state         = 0;
+            std::vector<u64> values;
+            for (u32 word = 0; word < num_simulation_words && !open_pairs.empty(); word += SIMULATION_BLOCK_WORDS)
+            {
+                simulate(aig, state, values);
+
+                auto get_word = [&values](const u32 literal, const u32 w) { return values[(literal >> 1) * SIMULATION_BLOCK_WORDS + w] ^ ((literal & 1) ? ~0ULL : 0ULL); };
+
+                auto it = std::remove_if(open_pairs.begin(), open_pairs.end(), [&](const OpenPair& pair) {
+                    for (u32 w = 0; w < SIMULATION_BLOCK_WORDS; w++)
+                    {
+                        const u64 diff = get_word(pair.literal_a, w) ^ get_word(pair.literal_b, w);
+                        if (diff == 0)
+                        {
+                            continue;
+                        }
+
+                        const u32 bit                 = __builtin_ctzll(diff);
+                        NetPairComparison& comparison = report.comparisons[pair.index];
+                        comparison.verdict            = NetPairComparison::Verdict::different;
+                        comparison.method             = NetPairComparison::Method::simulation;
+                        for (const u32 input : pair.support)
+                        {
+                            comparison.counterexample[aig.get_input_name(nodes[input])] = (values[input * SIMULATION_BLOCK_WORDS + w] >> bit) & 1;
+                        }
+                        return true;
+                    }
+                    return false;
+                });
+                open_pairs.erase(it, open_pairs.end());
+            }
+            values.clear();
+            values.shrink_to_fit();
+
+            // the remaining pairs are proven or refuted by the solver, each thread uses its own context
+            std::atomic<size_t> next_index{0};
+            auto worker = [&aig, &open_pairs, &report, &next_index, &nodes, solver_timeout](u32) {
+                z3::context ctx;
+                std::unordered_map<u32, z3::expr> exprs;
+                for (size_t i = next_index++; i < open_pairs.size(); i = next_index++)
+                {
+                    const OpenPair& pair          = open_pairs[i];
+                    NetPairComparison& comparison = report.comparisons[pair.index];
+                    comparison.method             = NetPairComparison::Method::solver;
+
+                    try
+                    {
+                        // the simple solver avoids the setup cost of the default tactics, which dominates for the many small queries
+                        z3::solver s(ctx, z3::solver::simple());
+                        if (solver_timeout != 0)
+                        {
+                            z3::params p(ctx);
+                            p.set("timeout", solver_timeout);
+                            s.set(p);
+                        }
+                        s.add(get_z3_expr(aig, pair.literal_a, ctx, exprs) != get_z3_expr(aig, pair.literal_b, ctx, exprs));
+
+                        const z3::check_result c = s.check();
+                        if (c == z3::unsat)
+                        {
+                            comparison.verdict = NetPairComparison::Verdict::equal;
+                        }
+                        else if (c == z3::sat)
+                        {
+                            comparison.verdict  = NetPairComparison::Verdict::different;
+                            const z3::model m   = s.get_model();
+                            for (const u32 input : pair.support)
+                            {
+                                const std::string& name           = aig.get_input_name(nodes[input]);
+                                comparison.counterexample[name] = m.eval(ctx.bool_const(name.c_str()), true).is_true();
+                            }
+                        }
+                        else
+                        {
+                            comparison.verdict = NetPairComparison::Verdict::unknown;
+                        }
+                    }
+                    catch (const z3::exception& e)
+                    {
+                        log_warning("z3_utils", "could not compare nets with IDs {} and {}: {}", comparison.net_a->get_id(), comparison.net_b->get_id(), e.msg());
+                        comparison.verdict = NetPairComparison::Verdict::unknown;
+                    }
+                }
+            };
+
+            utils::run_workers(utils::get_num_threads(num_threads, open_pairs.size()), worker);
+
+            for (const NetPairComparison& comparison : report.comparisons)
+            {
+                if (comparison.verdict == NetPairComparison::Verdict::unknown)
+                {
+                    report.num_unknown++;
+                }
+                else if (comparison.method == NetPairComparison::Method::topology)
+                {
+                    report.num_topology++;
+                }
+                else if (comparison.method == NetPairComparison::Method::structural)
+                {
+                    report.num_structural++;
+                }
+                else if (comparison.method == NetPairComparison::Method::simulation)
+                {
+                    report.num_simulation++;
+                }
+                else if (comparison.method == NetPairComparison::Method::solver)
+                {
+                    report.num_solver++;
+                }
+
+                if (comparison.verdict != NetPairComparison::Verdict::equal)
+                {
+                    report.equal = false;
+                }
+            }
+
+            log_info("z3_utils",
+                     "compared {} pairs of nets: {} decided by topology, {} by structural hashing, {} by simulation, {} by the solver, {} undecided.",
+                     report.comparisons.size(),
+                     report.num_topology,
+                     report.num_structural,
+                     report.num_simulation,
+                     report.num_solver,
+                     report.num_unknown);
+
+            return OK(report);
+        }
+    }    // namespace z3_utils
+}    // namespace hal
@@ -1,5 +1,8 @@
+#include "z3_utils/include/netlist_comparison.h"
 #include "z3_utils/include/z3_utils.h"
 
+#include "hal_core/netlist/decorators/boolean_function_net_decorator.h"
+
 #include "gate_library_test_utils.h"
 #include "netlist_test_utils.h"
 
@@ -293,4 +296,159 @@ namespace hal
 
         TEST_END
     }
+
+    TEST_F(Z3UtilsTest, check_compare_netlists)
+    {
+        TEST_START
+        {
+            // variant 0 is the reference, variant 1 is equivalent but differently structured, variant 2 differs at the data input of ff1
+            auto create_netlist = [](const u32 variant) {
+                auto nl         = test_utils::create_empty_netlist();
+                const auto* lib = nl->get_gate_library();
+
+                std::vector<Net*> in;
+                for (u32 i = 0; i < 3; i++)
+                {
+                    in.push_back(nl->create_net("in" + std::to_string(i)));
+                    nl->mark_global_input_net(in.back());
+                }
+                Net* clk = nl->create_net("clk");
+                nl->mark_global_input_net(clk);
+
+                std::vector<Gate*> ffs;
+                for (u32 i = 0; i < 3; i++)
+                {
+                    ffs.push_back(nl->create_gate(lib->get_gate_type_by_name("DFF"), "ff" + std::to_string(i)));
+                    clk->add_destination(ffs.back(), "CLK");
+                }
+                Net* q1 = nl->create_net("q1");
+                q1->add_source(ffs[1], "Q");
+
+                u32 num_gates = 0;
+                auto gate     = [&nl, lib, &num_gates](const std::string& type, const std::vector<Net*>& inputs) {
+                    const std::string name = "g" + std::to_string(num_gates++);
+                    Gate* g                = nl->create_gate(lib->get_gate_type_by_name(type), name);
+                    if (inputs.size() == 1)
+                    {
+                        inputs[0]->add_destination(g, "I");
+                    }
+                    else
+                    {
+                        inputs[0]->add_destination(g, "I0");
+                        inputs[1]->add_destination(g, "I1");
+                    }
+                    Net* out = nl->create_net(name + "_out");
+                    out->add_source(g, "O");
+                    return out;
+                };
+
+                if (variant == 1)
+                {
+                    gate("XOR2", {q1, gate("AND2", {in[1], in[0]})})->add_destination(ffs[0], "D");
+                    gate("AND2", {gate("INV", {in[0]}), gate("INV", {in[2]})})->add_destination(ffs[1], "D");
+                    gate("AND2", {in[0], gate("OR2", {in[1], in[2]})})->add_destination(ffs[2], "D");
+                }
+                else
+                {
+                    gate("XOR2", {gate("AND2", {in[0], in[1]}), q1})->add_destination(ffs[0], "D");
+                    gate("INV", {gate(variant == 0 ? "OR2" : "AND2", {in[0], in[2]})})->add_destination(ffs[1], "D");
+                    gate("OR2", {gate("AND2", {in[0], in[1]}), gate("AND2", {in[0], in[2]})})->add_destination(ffs[2], "D");
+                }
+                return nl;
+            };
+
+            auto nl_0 = create_netlist(0);
+            auto nl_1 = create_netlist(1);
+            auto nl_2 = create_netlist(2);
+
+            {
+                // equivalent netlists
+                const auto res = z3_utils::compare_netlists_with_report(nl_0.get(), nl_1.get(), 2);
+                ASSERT_TRUE(res.is_ok());
+                const auto report = res.get();
+                EXPECT_TRUE(report.equal);
+                EXPECT_TRUE(report.mismatch.empty());
+                EXPECT_EQ(report.comparisons.size(), 6);
+                EXPECT_EQ(report.num_topology, 0);
+                EXPECT_EQ(report.num_structural, 5);
+                EXPECT_EQ(report.num_simulation, 0);
+                EXPECT_EQ(report.num_solver, 1);
+                EXPECT_EQ(report.num_unknown, 0);
+
+                const auto eq_res = z3_utils::compare_netlists(nl_0.get(), nl_1.get());
+                ASSERT_TRUE(eq_res.is_ok());
+                EXPECT_TRUE(eq_res.get());
+            }
+            {
+                // netlists that differ at the data input of ff1
+                const auto res = z3_utils::compare_netlists_with_report(nl_0.get(), nl_2.get(), 2);
+                ASSERT_TRUE(res.is_ok());
+                const auto report = res.get();
+                EXPECT_FALSE(report.equal);
+                EXPECT_EQ(report.num_simulation, 1);
+
+                for (const auto& comparison : report.comparisons)
+                {
+                    if (comparison.gate_a->get_name() == "ff1" && comparison.pin->get_name() == "D")
+                    {
+                        EXPECT_EQ(comparison.verdict, z3_utils::NetPairComparison::Verdict::different);
+                        EXPECT_EQ(comparison.method, z3_utils::NetPairComparison::Method::simulation);
+
+                        // the functions !(in0 | in2) and !(in0 & in2) differ exactly if in0 and in2 differ
+                        const std::string var_0 = BooleanFunctionNetDecorator(*nl_0->get_nets([](const Net* n) { return n->get_name() == "in0"; }).front()).get_boolean_variable_name();
+                        const std::string var_2 = BooleanFunctionNetDecorator(*nl_0->get_nets([](const Net* n) { return n->get_name() == "in2"; }).front()).get_boolean_variable_name();
+                        ASSERT_EQ(comparison.counterexample.size(), 2);
+                        EXPECT_NE(comparison.counterexample.at(var_0), comparison.counterexample.at(var_2));
+                    }
+                    else
+                    {
+                        EXPECT_EQ(comparison.verdict, z3_utils::NetPairComparison::Verdict::equal);
+                    }
+                }
+
+                const auto eq_res = z3_utils::compare_netlists(nl_0.get(), nl_2.get());
+                ASSERT_TRUE(eq_res.is_ok());
+                EXPECT_FALSE(eq_res.get());
+            }
+            {
+                // without simulation the difference is found by the solver
+                const auto res = z3_utils::compare_netlists_with_report(nl_0.get(), nl_2.get(), 1, 0);
+                ASSERT_TRUE(res.is_ok());
+                const auto report = res.get();
+                EXPECT_FALSE(report.equal);
+                EXPECT_EQ(report.num_simulation, 0);
+                EXPECT_EQ(report.num_solver, 1);
+
+                for (const auto& comparison : report.comparisons)
+                {
+                    if (comparison.method == z3_utils::NetPairComparison::Method::solver)
+                    {
+                        EXPECT_EQ(comparison.gate_a->get_name(), "ff1");
+                        EXPECT_EQ(comparison.verdict, z3_utils::NetPairComparison::Verdict::different);
+                        ASSERT_EQ(comparison.counterexample.size(), 2);
+                        EXPECT_NE(comparison.counterexample.begin()->second, comparison.counterexample.rbegin()->second);
+                    }
+                }
+            }
+            {
+                // a pin that is connected in only one of the netlists is decided by topology
+                auto nl_3 = create_netlist(0);
+                Gate* ff2 = nl_3->get_gates([](const Gate* g) { return g->get_name() == "ff2"; }).front();
+                ASSERT_TRUE(ff2->get_fan_in_net("D")->remove_destination(ff2, "D"));
+
+                const auto res = z3_utils::compare_netlists_with_report(nl_0.get(), nl_3.get(), 2);
+                ASSERT_TRUE(res.is_ok());
+                const auto report = res.get();
+                EXPECT_FALSE(report.equal);
+                EXPECT_EQ(report.comparisons.size(), 6);
+                EXPECT_EQ(report.num_topology, 1);
+                EXPECT_EQ(report.num_topology + report.num_structural + report.num_simulation + report.num_solver + report.num_unknown, report.comparisons.size());
+
+                const auto eq_res = z3_utils::compare_netlists(nl_0.get(), nl_3.get());
+                ASSERT_TRUE(eq_res.is_ok());
+                EXPECT_FALSE(eq_res.get());
+            }
+        }
+        TEST_END
+    }
 }    // namespace hal
@@ -4,6 +4,7 @@
 #include "hal_core/netlist/boolean_function/simplification.h"
 #include "hal_core/netlist/boolean_function/symbolic_execution.h"
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/trace.h"
 #include "hal_core/utilities/utils.h"
 
 #include <algorithm>
@@ -1080,6 +1081,9 @@ namespace hal
 
     BooleanFunction BooleanFunction::simplify() const
     {
+        trace::count("simplify_calls");
+        HAL_TRACE_SCOPE("BooleanFunction::simplify");
+
         auto simplified = Simplification::local_simplification(*this).map<BooleanFunction>([](const auto& s) { return Simplification::abc_simplification(s); }).map<BooleanFunction>([](const auto& s) {
             return Simplification::local_simplification(s);
         });
@@ -1089,6 +1093,9 @@ namespace hal
 
     BooleanFunction BooleanFunction::simplify_local() const
     {
+        trace::count("simplify_calls");
+        HAL_TRACE_SCOPE("BooleanFunction::simplify_local");
+
         auto simplified = Simplification::local_simplification(*this);
 
         return (simplified.is_ok()) ? simplified.get() : this->clone();
@@ -1,4 +1,5 @@
 #include "hal_core/netlist/boolean_function/simplification.h"
+#include "hal_core/utilities/trace.h"
 
 #include <boost/fusion/include/at_c.hpp>
 #include <boost/fusion/sequence/intrinsic/at_c.hpp>
@@ -958,6 +959,8 @@ namespace hal
 
     Result<BooleanFunction> Simplification::abc_simplification(const BooleanFunction& function)
     {
+        HAL_TRACE_SCOPE("Simplification::abc_simplification");
+
         // # Developer Note
         // In order to apply a global optimization to the Boolean function, we
         // leverage the rich-featured and robust implementations of ABC [1]. To
@@ -1,14 +1,18 @@
 #include "hal_core/netlist/boolean_function/simplification.h"
 #include "hal_core/netlist/boolean_function/symbolic_execution.h"
+#include "hal_core/utilities/trace.h"
 
 namespace hal
 {
     Result<BooleanFunction> Simplification::local_simplification(const BooleanFunction& function)
     {
+        HAL_TRACE_SCOPE("Simplification::local_simplification");
+
         auto current = function.clone(), before = BooleanFunction();
 
         do
         {
+            trace::count("rounds");
             before          = current.clone();
             auto simplified = SMT::SymbolicExecution().evaluate(current);
             if (simplified.is_error())
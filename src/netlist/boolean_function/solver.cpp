@@ -2,6 +2,7 @@
 
 #include "hal_core/netlist/boolean_function/translator.h"
 #include "hal_core/netlist/boolean_function/types.h"
+#include "hal_core/utilities/trace.h"
 #include "subprocess/process.h"
 
 #include <numeric>
@@ -397,6 +398,9 @@ namespace hal
 
         Result<SolverResult> Solver::query(const QueryConfig& config) const
         {
+            trace::count("smt_queries");
+            HAL_TRACE_SCOPE("SMT::Solver::query");
+
             if (config.local)
             {
                 if (auto res = this->query_local(config); res.is_error())
@@ -2,11 +2,141 @@
 
 #include "hal_core/utilities/log.h"
 
+#include <algorithm>
+#include <mutex>
+#include <unordered_set>
+
 namespace hal
 {
+    namespace
+    {
+        // stores every distinct category, key, and type string only once, entries are never removed so that pointers stay valid
+        const std::string* intern(const std::string& str)
+        {
+            static std::mutex pool_mutex;
+            static std::unordered_set<std::string> pool;
+
+            std::lock_guard<std::mutex> lock(pool_mutex);
+            return &*pool.insert(str).first;
+        }
+
+        template<typename Entries>
+        auto lower_bound_entry(Entries& entries, const std::string& category, const std::string& key)
+        {
+            return std::lower_bound(entries.begin(), entries.end(), std::tie(category, key), [](const auto& entry, const auto& ck) {
+                if (int cmp = entry.category->compare(std::get<0>(ck)); cmp != 0)
+                {
+                    return cmp < 0;
+                }
+                return entry.key->compare(std::get<1>(ck)) < 0;
+            });
+        }
+
+        template<typename Entries, typename It>
+        bool is_entry(const Entries& entries, const It& it, const std::string& category, const std::string& key)
+        {
+            return it != entries.end() && *it->category == category && *it->key == key;
+        }
+
+        bool is_hex_digit(char c, bool& upper, bool& lower)
+        {
+            if (c >= '0' && c <= '9')
+            {
+                return true;
+            }
+            if (c >= 'A' && c <= 'F')
+            {
+                upper = true;
+                return true;
+            }
+            if (c >= 'a' && c <= 'f')
+            {
+                lower = true;
+                return true;
+            }
+            return false;
+        }
+
+        template<typename Entry>
+        void set_entry_value(Entry& entry, const std::string& data_type, const std::string& value)
+        {
+            using Encoding = decltype(entry.encoding);
+
+            entry.encoding   = Encoding::string;
+            entry.num_digits = 0;
+            entry.int_value  = 0;
+            entry.str_value.clear();
+
+            if (data_type == "integer" && !value.empty() && value.size() <= 18)
+            {
+                // only accept the canonical representation so that the value can be restored exactly
+                const bool negative = value[0] == '-';
+                const std::string digits = negative ? value.substr(1) : value;
+                if (!digits.empty() && std::all_of(digits.begin(), digits.end(), [](char c) { return c >= '0' && c <= '9'; }) && (digits[0] != '0' || value == "0"))
+                {
+                    entry.encoding  = Encoding::integer;
+                    entry.int_value = (u64)std::stoll(value);
+                    return;
+                }
+            }
+            else if (data_type == "bit_vector" && !value.empty() && value.size() <= 16)
+            {
+                bool upper = false;
+                bool lower = false;
+                if (std::all_of(value.begin(), value.end(), [&upper, &lower](char c) { return is_hex_digit(c, upper, lower); }) && !(upper && lower))
+                {
+                    entry.encoding   = lower ? Encoding::hex_lower : Encoding::hex_upper;
+                    entry.num_digits = (u8)value.size();
+                    entry.int_value  = std::stoull(value, nullptr, 16);
+                    return;
+                }
+            }
+
+            entry.str_value = value;
+        }
+    }    // namespace
+
+    bool DataContainer::DataEntry::operator==(const DataEntry& other) const
+    {
+        // interned strings are equal if and only if their addresses are equal, encodings are unique for a given value
+        return category == other.category && key == other.key && type == other.type && encoding == other.encoding && num_digits == other.num_digits && int_value == other.int_value
+               && str_value == other.str_value;
+    }
+
+    std::string DataContainer::DataEntry::get_value() const
+    {
+        switch (encoding)
+        {
+            case Encoding::integer:
+                return std::to_string((i64)int_value);
+            case Encoding::hex_upper:
+            case Encoding::hex_lower: {
+                const char* digits = (encoding == Encoding::hex_upper) ? "0123456789ABCDEF" : "0123456789abcdef";
+                std::string res(num_digits, '0');
+                u64 val = int_value;
+                for (u32 i = num_digits; i > 0; i--)
+                {
+                    res[i - 1] = digits[val & 0xF];
+                    val >>= 4;
+                }
+                return res;
+            }
+            default:
+                return str_value;
+        }
+    }
+
+    void DataContainer::notify_before_update()
+    {
+    }
+
+    void DataContainer::notify_updated()
+    {
+    }
+
     bool DataContainer::operator==(const DataContainer& other) const
     {
-        return m_data == other.get_data_map();
+        return m_data == other.m_data;
     }
 
     bool DataContainer::operator!=(const DataContainer& other) const
@@ -22,9 +152,20 @@ namespace hal
             return false;
         }
 
-        m_data[std::make_tuple(category, key)] = std::make_tuple(value_data_type, value);
+        notify_before_update();
 
-        //notify_updated();
+        auto it = lower_bound_entry(m_data, category, key);
+        if (!is_entry(m_data, it, category, key))
+        {
+            DataEntry entry;
+            entry.category = intern(category);
+            entry.key      = intern(key);
+            it             = m_data.insert(it, std::move(entry));
+        }
+        it->type = intern(value_data_type);
+        set_entry_value(*it, value_data_type, value);
+
+        notify_updated();
 
         if (log_with_info_level)
         {
@@ -46,17 +187,19 @@ namespace hal
             return false;
         }
 
-        auto it = m_data.find(std::make_tuple(category, key));
-        if (it == m_data.end())
+        auto it = lower_bound_entry(m_data, category, key);
+        if (!is_entry(m_data, it, category, key))
         {
             log_debug("netlist", "no key ('{}', '{}') found.", category, key);
             return true;
         }
 
-        auto deleted_value = std::get<1>(it->second);
+        notify_before_update();
+
+        auto deleted_value = it->get_value();
         m_data.erase(it);
 
-        //notify_updated();
+        notify_updated();
 
         if (log_with_info_level)
         {
@@ -69,29 +212,61 @@ namespace hal
         return true;
     }
 
-    const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& DataContainer::get_data_map() const
+    std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> DataContainer::get_data_map() const
     {
-        return m_data;
+        std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> res;
+        for (const auto& entry : m_data)
+        {
+            res.emplace_hint(res.end(), std::make_tuple(*entry.category, *entry.key), std::make_tuple(*entry.type, entry.get_value()));
+        }
+        return res;
+    }
+
+    u32 DataContainer::get_num_data_entries() const
+    {
+        return m_data.size();
     }
 
     void DataContainer::set_data_map(const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& map)
     {
-        m_data = map;
+        notify_before_update();
+
+        m_data.clear();
+        m_data.reserve(map.size());
+        for (const auto& [identifier, content] : map)
+        {
+            DataEntry entry;
+            entry.category = intern(std::get<0>(identifier));
+            entry.key      = intern(std::get<1>(identifier));
+            entry.type     = intern(std::get<0>(content));
+            set_entry_value(entry, std::get<0>(content), std::get<1>(content));
+            m_data.push_back(std::move(entry));
+        }
+        m_data.shrink_to_fit();
+
+        notify_updated();
     }
 
-    bool DataContainer::has_data(const std::string& category, const std::string& key) const
+    void DataContainer::copy_data_from(const DataContainer& other)
     {
-        if (category.empty() || key.empty())
+        if (&other == this)
         {
-            return false;
+            return;
         }
 
-        if (auto it = m_data.find(std::make_tuple(category, key)); it == m_data.end())
+        notify_before_update();
+        m_data = other.m_data;
+        notify_updated();
+    }
+
+    bool DataContainer::has_data(const std::string& category, const std::string& key) const
+    {
+        if (category.empty() || key.empty())
         {
             return false;
         }
 
-        return true;
+        return is_entry(m_data, lower_bound_entry(m_data, category, key), category, key);
     }
 
     std::tuple<std::string, std::string> DataContainer::get_data(const std::string& category, const std::string& key) const
@@ -102,13 +277,13 @@ namespace hal
             return std::make_tuple("", "");
         }
 
-        auto it = m_data.find(std::make_tuple(category, key));
-        if (it == m_data.end())
+        auto it = lower_bound_entry(m_data, category, key);
+        if (!is_entry(m_data, it, category, key))
         {
             log_debug("netlist", "no value stored for key ('{}', '{}').", category, key);
             return std::make_tuple("", "");
         }
-        return it->second;
+        return std::make_tuple(*it->type, it->get_value());
     }
 
 }    // namespace hal
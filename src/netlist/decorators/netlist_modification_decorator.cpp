@@ -14,6 +14,9 @@ namespace hal
 
     Result<std::monostate> NetlistModificationDecorator::delete_modules(const std::function<bool(const Module*)>& filter)
     {
+        // subscribers are notified about all removals at once
+        EventBatchGuard batch_guard(m_netlist.get_event_handler());
+
         for (auto module : m_netlist.get_modules(filter))
         {
             if (!module->is_top_module())
@@ -263,9 +266,9 @@ namespace hal
         }
 
         // NOTE i think this is detrimental, as this plainly overrides the master net datacontainer.
-        if (const auto& data_map = slave_net->get_data_map(); !data_map.empty())
+        if (slave_net->get_num_data_entries() != 0)
         {
-            master_net->set_data_map(data_map);
+            master_net->copy_data_from(*slave_net);
         }
 
         if (!m_netlist.delete_net(slave_net))
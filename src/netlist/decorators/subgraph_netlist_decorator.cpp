@@ -5,8 +5,13 @@
 #include "hal_core/netlist/module.h"
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist_factory.h"
+#include "hal_core/utilities/parallel.h"
+#include "hal_core/utilities/trace.h"
 #include "hal_core/utilities/utils.h"
 
+#include <atomic>
+#include <optional>
+
 namespace hal
 {
     SubgraphNetlistDecorator::SubgraphNetlistDecorator(const Netlist& netlist) : m_netlist(netlist)
@@ -20,31 +25,30 @@ namespace hal
 
         // manager, netlist_id, and top_module are set in the constructor
 
-        // get all relevant nets
-        std::set<Net*> all_nets_to_copy;
-        for (const Gate* gate : m_netlist.get_gates())
-        {
-            for (const auto& input_net_of_gate : gate->get_fan_in_nets())
+        // only nets connected to the subgraph are copied, so the cost of the copy does not depend on the size of the source netlist
+        std::unordered_map<const Net*, Net*> net_map;
+        std::vector<std::pair<const Net*, Net*>> copied_nets;
+        auto get_copied_net = [&c_netlist, &net_map, &copied_nets](const Net* net) {
+            if (const auto it = net_map.find(net); it != net_map.end())
             {
-                all_nets_to_copy.insert(input_net_of_gate);
+                return it->second;
             }
-            for (const auto& output_net_gate : gate->get_fan_out_nets())
-            {
-                all_nets_to_copy.insert(output_net_gate);
-            }
-        }
 
-        // copy nets
-        for (const Net* net : all_nets_to_copy)
-        {
             Net* new_net = c_netlist->create_net(net->get_id(), net->get_name());
-            new_net->set_data_map(net->get_data_map());
-        }
+            new_net->copy_data_from(*net);
+            net_map.emplace(net, new_net);
+            copied_nets.emplace_back(net, new_net);
+            return new_net;
+        };
 
         // copy gates
         for (const Gate* gate : subgraph_gates)
         {
             Gate* new_gate = c_netlist->create_gate(gate->get_id(), gate->get_type(), gate->get_name(), gate->get_location_x(), gate->get_location_y());
+            if (new_gate == nullptr)
+            {
+                return ERR("could not copy subgraph netlist: unable to copy gate '" + gate->get_name() + "' with ID " + std::to_string(gate->get_id()));
+            }
 
             for (const auto& [name, func] : gate->get_boolean_functions(true))
             {
@@ -53,21 +57,15 @@ namespace hal
 
             for (const Endpoint* in_point : gate->get_fan_in_endpoints())
             {
-                const auto net_id = in_point->get_net()->get_id();
-                auto c_net        = c_netlist->get_net_by_id(net_id);
-
-                c_net->add_destination(new_gate, in_point->get_pin());
+                get_copied_net(in_point->get_net())->add_destination(new_gate, in_point->get_pin());
             }
 
             for (const Endpoint* out_point : gate->get_fan_out_endpoints())
             {
-                const auto net_id = out_point->get_net()->get_id();
-                auto c_net        = c_netlist->get_net_by_id(net_id);
-
-                c_net->add_source(new_gate, out_point->get_pin());
+                get_copied_net(out_point->get_net())->add_source(new_gate, out_point->get_pin());
             }
 
-            new_gate->set_data_map(gate->get_data_map());
+            new_gate->copy_data_from(*gate);
 
             // mark gnd and vcc gates
             if (gate->is_gnd_gate())
@@ -82,10 +80,8 @@ namespace hal
 
         Module* c_top_module = c_netlist->get_top_module();
 
-        for (Net* c_net : c_netlist->get_nets())
+        for (const auto& [net, c_net] : copied_nets)
         {
-            Net* net = m_netlist.get_net_by_id(c_net->get_id());
-
             // mark new global inputs
             if (c_net->get_num_of_sources() == 0)
             {
@@ -130,21 +126,8 @@ namespace hal
         c_netlist->set_input_filename(m_netlist.get_input_filename());
 
         // update ids last, after all the creation
-        c_netlist->set_next_gate_id(m_netlist.get_next_gate_id());
-        c_netlist->set_used_gate_ids(m_netlist.get_used_gate_ids());
-        c_netlist->set_free_gate_ids(m_netlist.get_free_gate_ids());
-
-        c_netlist->set_next_net_id(m_netlist.get_next_net_id());
-        c_netlist->set_used_net_ids(m_netlist.get_used_net_ids());
-        c_netlist->set_free_net_ids(m_netlist.get_free_net_ids());
-
-        c_netlist->set_next_module_id(m_netlist.get_next_module_id());
-        c_netlist->set_used_module_ids(m_netlist.get_used_module_ids());
-        c_netlist->set_free_module_ids(m_netlist.get_free_module_ids());
-
-        c_netlist->set_next_grouping_id(m_netlist.get_next_grouping_id());
-        c_netlist->set_used_grouping_ids(m_netlist.get_used_grouping_ids());
-        c_netlist->set_free_grouping_ids(m_netlist.get_free_grouping_ids());
+        // only the next ids are taken over, copying all used and freed ids would make every copy scale with the largest id of the source netlist
+        c_netlist->reserve_ids(m_netlist);
 
         c_netlist->enable_automatic_net_checks(true);
 
@@ -176,6 +159,55 @@ namespace hal
         }
     }
 
+    Result<std::vector<std::unique_ptr<Netlist>>> SubgraphNetlistDecorator::copy_subgraph_netlists(const std::vector<std::vector<const Gate*>>& subgraphs, u32 num_threads) const
+    {
+        HAL_TRACE_SCOPE("SubgraphNetlistDecorator::copy_subgraph_netlists");
+
+        std::vector<std::unique_ptr<Netlist>> copies(subgraphs.size());
+        std::vector<std::optional<Error>> errors(subgraphs.size());
+
+        // the source netlist is only read, every worker creates its own copies
+        std::atomic<size_t> next_index{0};
+        auto worker = [this, &subgraphs, &copies, &errors, &next_index](u32) {
+            for (size_t i = next_index++; i < subgraphs.size(); i = next_index++)
+            {
+                if (auto res = copy_subgraph_netlist(subgraphs.at(i)); res.is_ok())
+                {
+                    copies[i] = res.get();
+                }
+                else
+                {
+                    errors[i] = res.get_error();
+                }
+            }
+        };
+
+        utils::run_workers(utils::get_num_threads(num_threads, subgraphs.size()), worker);
+
+        for (size_t i = 0; i < errors.size(); i++)
+        {
+            if (errors[i].has_value())
+            {
+                return ERR_APPEND(errors[i].value(), "could not copy subgraph netlists: unable to copy subgraph at index " + std::to_string(i));
+            }
+        }
+
+        return OK(std::move(copies));
+    }
+
+    Result<std::vector<std::unique_ptr<Netlist>>> SubgraphNetlistDecorator::copy_subgraph_netlists(const std::vector<const Module*>& subgraph_modules, u32 num_threads) const
+    {
+        std::vector<std::vector<const Gate*>> subgraphs;
+        subgraphs.reserve(subgraph_modules.size());
+        for (const Module* subgraph_module : subgraph_modules)
+        {
+            const auto gates = subgraph_module->get_gates();
+            subgraphs.emplace_back(gates.begin(), gates.end());
+        }
+
+        return copy_subgraph_netlists(subgraphs, num_threads);
+    }
+
     namespace
     {
         Result<BooleanFunction> subgraph_function_recursive(const Net* n,
@@ -226,6 +258,7 @@ namespace hal
                 return OK(it->second);
             }
 
+            trace::count("gates_visited");
             const auto bf_res = src_gate->get_resolved_boolean_function(src_ep->get_pin());
             if (bf_res.is_error())
             {
@@ -361,6 +394,8 @@ namespace hal
                                                                             const Net* subgraph_output,
                                                                             std::map<std::pair<u32, const GatePin*>, BooleanFunction>& gate_cache) const
     {
+        HAL_TRACE_SCOPE("SubgraphNetlistDecorator::get_subgraph_function");
+
         // check validity of subgraph_gates
         if (subgraph_gates.empty())
         {
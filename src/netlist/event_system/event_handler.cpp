@@ -6,6 +6,9 @@
 #include "hal_core/netlist/module.h"
 #include "hal_core/netlist/netlist.h"
 
+#include <algorithm>
+#include <optional>
+
 namespace hal
 {
     template<>
@@ -65,8 +68,219 @@ namespace hal
                                                                                            {GroupingEvent::event::module_assigned, "module_assigned"},
                                                                                            {GroupingEvent::event::module_removed, "module_removed"}};
 
-    EventHandler::EventHandler() : netlist_event_enabled(true), module_event_enabled(true), gate_event_enabled(true), net_event_enabled(true), grouping_event_enabled(true)
+    namespace
+    {
+        template<typename E, typename T>
+        std::vector<std::pair<u32, u32>> get_id_ranges_internal(const std::vector<EventBatch::Entry>& events, E ev)
+        {
+            std::vector<u32> ids;
+            for (const auto& entry : events)
+            {
+                if (const auto* e = std::get_if<EventBatch::Event<E, T>>(&entry); e != nullptr && e->event == ev)
+                {
+                    ids.push_back(e->object->get_id());
+                }
+            }
+            std::sort(ids.begin(), ids.end());
+            ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+            std::vector<std::pair<u32, u32>> ranges;
+            for (const u32 id : ids)
+            {
+                if (!ranges.empty() && ranges.back().second + 1 == id)
+                {
+                    ranges.back().second = id;
+                }
+                else
+                {
+                    ranges.push_back({id, id});
+                }
+            }
+            return ranges;
+        }
+
+        // per-event callbacks of subscribers that did not register a batch callback under the same name
+        template<typename E, typename T>
+        std::vector<u64> get_fallback_ids(CallbackHook<void(E, T*, u32)>& hook, CallbackHook<void(const EventBatch&)>& batch_hook)
+        {
+            std::vector<u64> ids;
+            for (const u64 id : hook.get_ids())
+            {
+                if (!batch_hook.is_callback_registered(hook.get_name(id)))
+                {
+                    ids.push_back(id);
+                }
+            }
+            return ids;
+        }
+        // events that undo each other
+        template<typename E>
+        struct InverseEvents
+        {
+            E assigned;
+            E removed;
+            bool cancel;    // whether an assignment undone within a batch is dropped along with its removal
+        };
+
+        template<typename E>
+        std::optional<InverseEvents<E>> get_inverse_events(E)
+        {
+            return std::nullopt;
+        }
+
+        std::optional<InverseEvents<NetlistEvent::event>> get_inverse_events(NetlistEvent::event ev)
+        {
+            switch (ev)
+            {
+                case NetlistEvent::event::marked_global_vcc:
+                case NetlistEvent::event::unmarked_global_vcc:
+                    return InverseEvents<NetlistEvent::event>{NetlistEvent::event::marked_global_vcc, NetlistEvent::event::unmarked_global_vcc, true};
+                case NetlistEvent::event::marked_global_gnd:
+                case NetlistEvent::event::unmarked_global_gnd:
+                    return InverseEvents<NetlistEvent::event>{NetlistEvent::event::marked_global_gnd, NetlistEvent::event::unmarked_global_gnd, true};
+                case NetlistEvent::event::marked_global_input:
+                case NetlistEvent::event::unmarked_global_input:
+                    return InverseEvents<NetlistEvent::event>{NetlistEvent::event::marked_global_input, NetlistEvent::event::unmarked_global_input, true};
+                case NetlistEvent::event::marked_global_output:
+                case NetlistEvent::event::unmarked_global_output:
+                    return InverseEvents<NetlistEvent::event>{NetlistEvent::event::marked_global_output, NetlistEvent::event::unmarked_global_output, true};
+                default:
+                    return std::nullopt;
+            }
+        }
+
+        std::optional<InverseEvents<NetEvent::event>> get_inverse_events(NetEvent::event ev)
+        {
+            // the associated data only identifies the gate, not the pin, so reconnecting a gate to another pin must not cancel out
+            switch (ev)
+            {
+                case NetEvent::event::src_added:
+                case NetEvent::event::src_removed:
+                    return InverseEvents<NetEvent::event>{NetEvent::event::src_added, NetEvent::event::src_removed, false};
+                case NetEvent::event::dst_added:
+                case NetEvent::event::dst_removed:
+                    return InverseEvents<NetEvent::event>{NetEvent::event::dst_added, NetEvent::event::dst_removed, false};
+                default:
+                    return std::nullopt;
+            }
+        }
+
+        std::optional<InverseEvents<ModuleEvent::event>> get_inverse_events(ModuleEvent::event ev)
+        {
+            switch (ev)
+            {
+                case ModuleEvent::event::submodule_added:
+                case ModuleEvent::event::submodule_removed:
+                    return InverseEvents<ModuleEvent::event>{ModuleEvent::event::submodule_added, ModuleEvent::event::submodule_removed, true};
+                case ModuleEvent::event::gate_assigned:
+                case ModuleEvent::event::gate_removed:
+                    return InverseEvents<ModuleEvent::event>{ModuleEvent::event::gate_assigned, ModuleEvent::event::gate_removed, true};
+                default:
+                    return std::nullopt;
+            }
+        }
+
+        std::optional<InverseEvents<GroupingEvent::event>> get_inverse_events(GroupingEvent::event ev)
+        {
+            switch (ev)
+            {
+                case GroupingEvent::event::gate_assigned:
+                case GroupingEvent::event::gate_removed:
+                    return InverseEvents<GroupingEvent::event>{GroupingEvent::event::gate_assigned, GroupingEvent::event::gate_removed, true};
+                case GroupingEvent::event::net_assigned:
+                case GroupingEvent::event::net_removed:
+                    return InverseEvents<GroupingEvent::event>{GroupingEvent::event::net_assigned, GroupingEvent::event::net_removed, true};
+                case GroupingEvent::event::module_assigned:
+                case GroupingEvent::event::module_removed:
+                    return InverseEvents<GroupingEvent::event>{GroupingEvent::event::module_assigned, GroupingEvent::event::module_removed, true};
+                default:
+                    return std::nullopt;
+            }
+        }
+
+        // events delimiting a sequence of events, which are never coalesced
+        template<typename E>
+        bool is_delimiter(E)
+        {
+            return false;
+        }
+
+        bool is_delimiter(ModuleEvent::event ev)
+        {
+            return ev == ModuleEvent::event::gates_assign_begin || ev == ModuleEvent::event::gates_assign_end || ev == ModuleEvent::event::gates_remove_begin
+                   || ev == ModuleEvent::event::gates_remove_end;
+        }
+    }    // namespace
+
+    bool EventBatch::empty() const
+    {
+        return events.empty();
+    }
+
+    std::vector<std::pair<u32, u32>> EventBatch::get_id_ranges(ModuleEvent::event ev) const
+    {
+        return get_id_ranges_internal<ModuleEvent::event, Module>(events, ev);
+    }
+
+    std::vector<std::pair<u32, u32>> EventBatch::get_id_ranges(GateEvent::event ev) const
+    {
+        return get_id_ranges_internal<GateEvent::event, Gate>(events, ev);
+    }
+
+    std::vector<std::pair<u32, u32>> EventBatch::get_id_ranges(NetEvent::event ev) const
+    {
+        return get_id_ranges_internal<NetEvent::event, Net>(events, ev);
+    }
+
+    std::vector<std::pair<u32, u32>> EventBatch::get_id_ranges(GroupingEvent::event ev) const
+    {
+        return get_id_ranges_internal<GroupingEvent::event, Grouping>(events, ev);
+    }
+
+    EventHandler::EventHandler()
+        : netlist_event_enabled(true), module_event_enabled(true), gate_event_enabled(true), net_event_enabled(true), grouping_event_enabled(true), m_batching_enabled(false)
+    {
+    }
+
+    bool EventHandler::QueuedEventKey::operator==(const QueuedEventKey& other) const
+    {
+        return object == other.object && event == other.event && associated_data == other.associated_data;
+    }
+
+    std::size_t EventHandler::QueuedEventKeyHash::operator()(const QueuedEventKey& key) const
     {
+        return std::hash<const void*>()(key.object) ^ (std::hash<u64>()((u64(key.event) << 32) | key.associated_data) << 1);
+    }
+
+    template<typename E, typename T>
+    void EventHandler::enqueue(E ev, T* object, u32 associated_data)
+    {
+        m_queue.num_events++;
+
+        if (!is_delimiter(ev))
+        {
+            // objects referenced by queued events are kept alive until delivery, so their addresses are not reused within a batch
+            const std::optional<InverseEvents<E>> inverse = get_inverse_events(ev);
+            const QueuedEventKey key{object, static_cast<u32>(inverse ? inverse->assigned : ev), associated_data};
+            if (auto it = m_queued_events.find(key); it != m_queued_events.end())
+            {
+                const auto& last = std::get<EventBatch::Event<E, T>>(m_queue.events[it->second]);
+                if (last.event == ev)
+                {
+                    return;
+                }
+                if (inverse && inverse->cancel && last.event == inverse->assigned)
+                {
+                    m_cancelled_events[it->second] = true;
+                    m_queued_events.erase(it);
+                    return;
+                }
+            }
+            m_queued_events[key] = m_queue.events.size();
+        }
+
+        m_queue.events.push_back(EventBatch::Event<E, T>{ev, object, associated_data});
+        m_cancelled_events.push_back(false);
     }
 
     void EventHandler::event_enable_all(bool flag)
@@ -82,8 +296,15 @@ namespace hal
     {
         if (netlist_event_enabled)
         {
-            m_netlist_callback(c, netlist, associated_data);
-            event_log::handle_netlist_event(c, netlist, associated_data);
+            if (m_batching_enabled)
+            {
+                enqueue(c, netlist, associated_data);
+            }
+            else
+            {
+                m_netlist_callback(c, netlist, associated_data);
+                event_log::handle_netlist_event(c, netlist, associated_data);
+            }
         }
     }
 
@@ -91,8 +312,15 @@ namespace hal
     {
         if (gate_event_enabled)
         {
-            m_gate_callback(c, gate, associated_data);
-            event_log::handle_gate_event(c, gate, associated_data);
+            if (m_batching_enabled)
+            {
+                enqueue(c, gate, associated_data);
+            }
+            else
+            {
+                m_gate_callback(c, gate, associated_data);
+                event_log::handle_gate_event(c, gate, associated_data);
+            }
         }
     }
 
@@ -100,8 +328,15 @@ namespace hal
     {
         if (net_event_enabled)
         {
-            m_net_callback(c, net, associated_data);
-            event_log::handle_net_event(c, net, associated_data);
+            if (m_batching_enabled)
+            {
+                enqueue(c, net, associated_data);
+            }
+            else
+            {
+                m_net_callback(c, net, associated_data);
+                event_log::handle_net_event(c, net, associated_data);
+            }
         }
     }
 
@@ -110,8 +345,15 @@ namespace hal
         //        ModuleEvent::dump(c, true);
         if (module_event_enabled)
         {
-            m_module_callback(c, module, associated_data);
-            event_log::handle_module_event(c, module, associated_data);
+            if (m_batching_enabled)
+            {
+                enqueue(c, module, associated_data);
+            }
+            else
+            {
+                m_module_callback(c, module, associated_data);
+                event_log::handle_module_event(c, module, associated_data);
+            }
         }
     }
 
@@ -119,8 +361,15 @@ namespace hal
     {
         if (grouping_event_enabled)
         {
-            m_grouping_callback(c, grouping, associated_data);
-            event_log::handle_grouping_event(c, grouping, associated_data);
+            if (m_batching_enabled)
+            {
+                enqueue(c, grouping, associated_data);
+            }
+            else
+            {
+                m_grouping_callback(c, grouping, associated_data);
+                event_log::handle_grouping_event(c, grouping, associated_data);
+            }
         }
     }
 
@@ -156,5 +405,135 @@ namespace hal
         m_gate_callback.remove_callback(name);
         m_net_callback.remove_callback(name);
         m_grouping_callback.remove_callback(name);
+        m_batch_callback.remove_callback(name);
+    }
+
+    void EventHandler::register_batch_callback(const std::string& name, std::function<void(const EventBatch&)> function)
+    {
+        m_batch_callback.add_callback(name, function);
+    }
+
+    void EventHandler::defer_destruction(std::shared_ptr<void> object)
+    {
+        if (m_batching_enabled)
+        {
+            m_removed_objects.push_back(std::move(object));
+        }
+    }
+
+    void EventHandler::set_batching_enabled(bool flag)
+    {
+        m_batching_enabled = flag;
+        if (!flag)
+        {
+            flush();
+        }
+    }
+
+    bool EventHandler::is_batching_enabled() const
+    {
+        return m_batching_enabled;
+    }
+
+    void EventHandler::flush()
+    {
+        // drop the events that have been cancelled out by later events
+        u32 num_kept = 0;
+        for (u32 i = 0; i < m_queue.events.size(); i++)
+        {
+            if (!m_cancelled_events[i])
+            {
+                m_queue.events[num_kept++] = std::move(m_queue.events[i]);
+            }
+        }
+        m_queue.events.erase(m_queue.events.begin() + num_kept, m_queue.events.end());
+        m_cancelled_events.clear();
+        m_queued_events.clear();
+
+        if (m_queue.empty())
+        {
+            m_queue.num_events = 0;
+            return;
+        }
+
+        // move the queue out first, since batch callbacks may trigger further events
+        EventBatch batch;
+        std::swap(batch, m_queue);
+
+        // removed objects are destroyed once the batch has been delivered
+        std::vector<std::shared_ptr<void>> removed_objects;
+        std::swap(removed_objects, m_removed_objects);
+
+        m_batch_callback(batch);
+        replay(batch);
+        event_log::handle_event_batch(batch);
+    }
+
+    void EventHandler::replay(const EventBatch& batch)
+    {
+        const std::vector<u64> netlist_ids  = get_fallback_ids(m_netlist_callback, m_batch_callback);
+        const std::vector<u64> module_ids   = get_fallback_ids(m_module_callback, m_batch_callback);
+        const std::vector<u64> gate_ids     = get_fallback_ids(m_gate_callback, m_batch_callback);
+        const std::vector<u64> net_ids      = get_fallback_ids(m_net_callback, m_batch_callback);
+        const std::vector<u64> grouping_ids = get_fallback_ids(m_grouping_callback, m_batch_callback);
+        if (netlist_ids.empty() && module_ids.empty() && gate_ids.empty() && net_ids.empty() && grouping_ids.empty())
+        {
+            return;
+        }
+
+        for (const EventBatch::Entry& entry : batch.events)
+        {
+            if (const auto* e = std::get_if<EventBatch::Event<NetlistEvent::event, Netlist>>(&entry))
+            {
+                for (const u64 id : netlist_ids)
+                {
+                    m_netlist_callback.call(id, e->event, e->object, e->associated_data);
+                }
+            }
+            else if (const auto* e = std::get_if<EventBatch::Event<ModuleEvent::event, Module>>(&entry))
+            {
+                for (const u64 id : module_ids)
+                {
+                    m_module_callback.call(id, e->event, e->object, e->associated_data);
+                }
+            }
+            else if (const auto* e = std::get_if<EventBatch::Event<GateEvent::event, Gate>>(&entry))
+            {
+                for (const u64 id : gate_ids)
+                {
+                    m_gate_callback.call(id, e->event, e->object, e->associated_data);
+                }
+            }
+            else if (const auto* e = std::get_if<EventBatch::Event<NetEvent::event, Net>>(&entry))
+            {
+                for (const u64 id : net_ids)
+                {
+                    m_net_callback.call(id, e->event, e->object, e->associated_data);
+                }
+            }
+            else if (const auto* e = std::get_if<EventBatch::Event<GroupingEvent::event, Grouping>>(&entry))
+            {
+                for (const u64 id : grouping_ids)
+                {
+                    m_grouping_callback.call(id, e->event, e->object, e->associated_data);
+                }
+            }
+        }
+    }
+
+    EventBatchGuard::EventBatchGuard(EventHandler* event_handler) : m_event_handler(event_handler), m_was_enabled(event_handler->is_batching_enabled())
+    {
+        if (!m_was_enabled)
+        {
+            m_event_handler->set_batching_enabled(true);
+        }
+    }
+
+    EventBatchGuard::~EventBatchGuard()
+    {
+        if (!m_was_enabled)
+        {
+            m_event_handler->set_batching_enabled(false);
+        }
     }
 }    // namespace hal
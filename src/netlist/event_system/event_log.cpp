@@ -15,6 +15,28 @@ namespace hal
         namespace
         {
             bool mEnableEventLog = false;
+
+            std::string ranges_to_string(const std::vector<std::pair<u32, u32>>& ranges)
+            {
+                std::string res;
+                for (const auto& [first, last] : ranges)
+                {
+                    if (!res.empty())
+                    {
+                        res += ", ";
+                    }
+                    res += (first == last) ? std::to_string(first) : std::to_string(first) + "-" + std::to_string(last);
+                }
+                return res;
+            }
+
+            void log_id_ranges(const std::string& action, const std::string& type, const std::vector<std::pair<u32, u32>>& ranges)
+            {
+                if (!ranges.empty())
+                {
+                    log_info("event", "{} {} with ids {}", action, type, ranges_to_string(ranges));
+                }
+            }
         }
 
         void enable_event_log(bool enable)
@@ -294,6 +316,38 @@ namespace hal
                 log_error("event", "unknown module event");
             }
         }
+
+        void handle_event_batch(const EventBatch& batch)
+        {
+            if (!mEnableEventLog)
+                return;
+
+            // index of the variant alternative: netlist, module, gate, net, grouping
+            u32 num_events_by_type[5] = {0, 0, 0, 0, 0};
+            for (const auto& entry : batch.events)
+            {
+                num_events_by_type[entry.index()]++;
+            }
+
+            log_info("event",
+                     "delivered batch of {} events coalesced from {} events ({} netlist, {} module, {} gate, {} net, {} grouping)",
+                     batch.events.size(),
+                     batch.num_events,
+                     num_events_by_type[0],
+                     num_events_by_type[1],
+                     num_events_by_type[2],
+                     num_events_by_type[3],
+                     num_events_by_type[4]);
+
+            log_id_ranges("created", "modules", batch.get_id_ranges(ModuleEvent::event::created));
+            log_id_ranges("deleted", "modules", batch.get_id_ranges(ModuleEvent::event::removed));
+            log_id_ranges("created", "gates", batch.get_id_ranges(GateEvent::event::created));
+            log_id_ranges("deleted", "gates", batch.get_id_ranges(GateEvent::event::removed));
+            log_id_ranges("created", "nets", batch.get_id_ranges(NetEvent::event::created));
+            log_id_ranges("deleted", "nets", batch.get_id_ranges(NetEvent::event::removed));
+            log_id_ranges("created", "groupings", batch.get_id_ranges(GroupingEvent::event::created));
+            log_id_ranges("deleted", "groupings", batch.get_id_ranges(GroupingEvent::event::removed));
+        }
     }    // namespace event_log
 
     void initialize()
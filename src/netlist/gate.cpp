@@ -117,11 +117,25 @@ namespace hal
 
         if (name != m_name)
         {
-            m_name = name;
+            m_internal_manager->transaction_record(this);
+            const std::string old_name = m_name;
+            m_name                     = name;
+            m_internal_manager->name_index_rename(this, old_name);
+            m_internal_manager->search_index_update(this);
             m_event_handler->notify(GateEvent::event::name_changed, this);
         }
     }
 
+    void Gate::notify_before_update()
+    {
+        m_internal_manager->transaction_record(this);
+    }
+
+    void Gate::notify_updated()
+    {
+        m_internal_manager->search_index_update(this);
+    }
+
     GateType* Gate::get_type() const
     {
         return m_type;
@@ -151,6 +165,7 @@ namespace hal
     {
         if (x != m_x)
         {
+            m_internal_manager->transaction_record(this);
             m_x = x;
             m_event_handler->notify(GateEvent::event::location_changed, this);
         }
@@ -160,6 +175,7 @@ namespace hal
     {
         if (y != m_y)
         {
+            m_internal_manager->transaction_record(this);
             m_y = y;
             m_event_handler->notify(GateEvent::event::location_changed, this);
         }
@@ -424,9 +440,12 @@ namespace hal
         auto cache_key = std::make_pair(inputs, config);
         auto& cache    = m_internal_manager->m_lut_function_cache;
 
-        if (auto it = cache.find(cache_key); it != cache.end())
         {
-            return it->second;
+            std::shared_lock<std::shared_mutex> lock(m_internal_manager->m_lut_function_cache_mutex);
+            if (auto it = cache.find(cache_key); it != cache.end())
+            {
+                return it->second;
+            }
         }
 
         u32 config_size = 0;
@@ -476,8 +495,11 @@ namespace hal
             }
         }
 
-        auto f           = result.simplify();
-        cache[cache_key] = f;
+        auto f = result.simplify();
+        {
+            std::unique_lock<std::shared_mutex> lock(m_internal_manager->m_lut_function_cache_mutex);
+            cache[cache_key] = f;
+        }
         return f;
     }
 
@@ -540,6 +562,7 @@ namespace hal
             }
         }
 
+        m_internal_manager->transaction_record(this);
         m_functions[name] = func;
         m_event_handler->notify(GateEvent::event::boolean_function_changed, this);
         return true;
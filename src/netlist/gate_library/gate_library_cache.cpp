@@ -0,0 +1,932 @@
+#include "hal_core/netlist/gate_library/gate_library_cache.h"
+
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/gate_library/gate_library_parser/gate_library_parser_manager.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ff_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/init_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/latch_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/lut_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/mac_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ram_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ram_port_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/state_component.h"
+#include "hal_core/utilities/log.h"
+#include "hal_version.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+namespace hal
+{
+    namespace gate_library_cache
+    {
+        namespace
+        {
+            const std::string cache_extension = ".halcache";
+            const char cache_magic[8]         = {'H', 'A', 'L', 'G', 'L', 'C', '\0', '\0'};
+            const u32 byte_order_mark         = 0x01020304;
+
+            /**
+             * Header stored at the beginning of every cache file.
+             */
+            struct CacheHeader
+            {
+                u32 version;
+                i64 source_mtime;
+                u64 source_size;
+                u64 source_hash;
+                std::string hal_version;
+                std::string parser_version;
+                std::string lib_name;
+            };
+
+            class BinaryWriter
+            {
+            public:
+                template<typename T>
+                void write(T value)
+                {
+                    static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable types can be written directly");
+                    m_buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+                }
+
+                void write_string(const std::string& str)
+                {
+                    write<u32>((u32)str.size());
+                    m_buffer.append(str);
+                }
+
+                void write_raw(const char* data, size_t size)
+                {
+                    m_buffer.append(data, size);
+                }
+
+                const std::string& get_buffer() const
+                {
+                    return m_buffer;
+                }
+
+            private:
+                std::string m_buffer;
+            };
+
+            class BinaryReader
+            {
+            public:
+                BinaryReader(const std::string& buffer) : m_buffer(buffer)
+                {
+                }
+
+                template<typename T>
+                bool read(T& value)
+                {
+                    static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable types can be read directly");
+                    if (m_pos + sizeof(T) > m_buffer.size())
+                    {
+                        return false;
+                    }
+                    std::memcpy(&value, m_buffer.data() + m_pos, sizeof(T));
+                    m_pos += sizeof(T);
+                    return true;
+                }
+
+                bool read_string(std::string& str)
+                {
+                    u32 size;
+                    if (!read(size) || m_pos + size > m_buffer.size())
+                    {
+                        return false;
+                    }
+                    str.assign(m_buffer.data() + m_pos, size);
+                    m_pos += size;
+                    return true;
+                }
+
+                bool read_raw(char* data, size_t size)
+                {
+                    if (m_pos + size > m_buffer.size())
+                    {
+                        return false;
+                    }
+                    std::memcpy(data, m_buffer.data() + m_pos, size);
+                    m_pos += size;
+                    return true;
+                }
+
+                bool at_end() const
+                {
+                    return m_pos == m_buffer.size();
+                }
+
+            private:
+                const std::string& m_buffer;
+                size_t m_pos = 0;
+            };
+
+            Result<u64> compute_file_hash(const std::filesystem::path& file_path)
+            {
+                std::ifstream ifs(file_path, std::ios::binary);
+                if (!ifs.is_open())
+                {
+                    return ERR("could not open file '" + file_path.string() + "' to compute its hash");
+                }
+
+                // 64-bit FNV-1a
+                u64 hash = 0xcbf29ce484222325ull;
+                std::vector<char> chunk(1 << 16);
+                while (ifs)
+                {
+                    ifs.read(chunk.data(), chunk.size());
+                    const std::streamsize n = ifs.gcount();
+                    for (std::streamsize i = 0; i < n; i++)
+                    {
+                        hash ^= (u8)chunk[i];
+                        hash *= 0x100000001b3ull;
+                    }
+                }
+                return OK(hash);
+            }
+
+            i64 get_mtime(const std::filesystem::path& file_path)
+            {
+                std::error_code ec;
+                auto mtime = std::filesystem::last_write_time(file_path, ec);
+                if (ec)
+                {
+                    return 0;
+                }
+                return (i64)mtime.time_since_epoch().count();
+            }
+
+            Result<std::string> read_file(const std::filesystem::path& file_path)
+            {
+                std::ifstream ifs(file_path, std::ios::binary | std::ios::ate);
+                if (!ifs.is_open())
+                {
+                    return ERR("could not open file '" + file_path.string() + "'");
+                }
+                std::string content;
+                content.resize((size_t)ifs.tellg());
+                ifs.seekg(0);
+                ifs.read(content.data(), content.size());
+                return OK(content);
+            }
+
+            bool read_header(BinaryReader& reader, CacheHeader& header)
+            {
+                char magic[sizeof(cache_magic)];
+                u32 bom;
+                return reader.read_raw(magic, sizeof(magic)) && std::memcmp(magic, cache_magic, sizeof(magic)) == 0 && reader.read(header.version) && header.version == format_version
+                       && reader.read(bom) && bom == byte_order_mark && reader.read(header.source_mtime) && reader.read(header.source_size) && reader.read(header.source_hash)
+                       && reader.read_string(header.hal_version) && reader.read_string(header.parser_version) && reader.read_string(header.lib_name);
+            }
+
+            Result<std::monostate> check_header(const CacheHeader& header, const std::filesystem::path& source_path)
+            {
+                // a cache created by another version of HAL or of the parser may lack fixes of the parser or the gate library
+                if (header.hal_version != hal_version::version || header.parser_version != gate_library_parser_manager::get_parser_version(source_path))
+                {
+                    return ERR("cache of gate library file '" + source_path.string() + "' has been created by HAL version '" + header.hal_version + "' and parser '" + header.parser_version
+                               + "'");
+                }
+
+                std::error_code ec;
+                const u64 source_size = std::filesystem::file_size(source_path, ec);
+                if (ec || source_size != header.source_size)
+                {
+                    return ERR("cache of gate library file '" + source_path.string() + "' is outdated");
+                }
+
+                if (get_mtime(source_path) == header.source_mtime)
+                {
+                    return OK({});
+                }
+
+                // the file has been touched or copied, only its content decides
+                if (auto res = compute_file_hash(source_path); res.is_error())
+                {
+                    return ERR(res.get_error());
+                }
+                else if (res.get() != header.source_hash)
+                {
+                    return ERR("cache of gate library file '" + source_path.string() + "' is outdated");
+                }
+
+                return OK({});
+            }
+
+            Result<CacheHeader> read_valid_header(BinaryReader& reader, const std::filesystem::path& source_path)
+            {
+                CacheHeader header;
+                if (!read_header(reader, header))
+                {
+                    return ERR("cache of gate library file '" + source_path.string() + "' has an unsupported format");
+                }
+                if (auto res = check_header(header, source_path); res.is_error())
+                {
+                    return ERR(res.get_error());
+                }
+                return OK(header);
+            }
+
+            void write_boolean_function(BinaryWriter& writer, const BooleanFunction& bf)
+            {
+                const auto& nodes = bf.get_nodes();
+                writer.write<u32>((u32)nodes.size());
+                for (const auto& node : nodes)
+                {
+                    writer.write<u16>(node.type);
+                    writer.write<u16>(node.size);
+                    writer.write<u16>(node.index);
+                    writer.write<u32>((u32)node.constant.size());
+                    for (const auto value : node.constant)
+                    {
+                        writer.write<u8>((u8)value);
+                    }
+                    writer.write_string(node.variable);
+                }
+            }
+
+            bool read_boolean_function(BinaryReader& reader, BooleanFunction& bf)
+            {
+                u32 num_nodes;
+                if (!reader.read(num_nodes))
+                {
+                    return false;
+                }
+                if (num_nodes == 0)
+                {
+                    bf = BooleanFunction();
+                    return true;
+                }
+
+                std::vector<BooleanFunction::Node> nodes;
+                nodes.reserve(num_nodes);
+                for (u32 i = 0; i < num_nodes; i++)
+                {
+                    u16 type, size, index;
+                    u32 num_values;
+                    if (!reader.read(type) || !reader.read(size) || !reader.read(index) || !reader.read(num_values))
+                    {
+                        return false;
+                    }
+
+                    std::vector<BooleanFunction::Value> constant;
+                    constant.reserve(num_values);
+                    for (u32 j = 0; j < num_values; j++)
+                    {
+                        u8 value;
+                        if (!reader.read(value))
+                        {
+                            return false;
+                        }
+                        constant.push_back((BooleanFunction::Value)value);
+                    }
+
+                    std::string variable;
+                    if (!reader.read_string(variable))
+                    {
+                        return false;
+                    }
+
+                    BooleanFunction::Node node = BooleanFunction::Node::Operation(type, size);
+                    node.index                 = index;
+                    node.constant              = std::move(constant);
+                    node.variable              = std::move(variable);
+                    nodes.push_back(std::move(node));
+                }
+
+                auto res = BooleanFunction::build(std::move(nodes));
+                if (res.is_error())
+                {
+                    return false;
+                }
+                bf = res.get();
+                return true;
+            }
+
+            void write_component(BinaryWriter& writer, const GateTypeComponent* component)
+            {
+                writer.write<u32>((u32)component->get_type());
+                switch (component->get_type())
+                {
+                    case GateTypeComponent::ComponentType::lut: {
+                        writer.write<u8>(component->convert_to<LUTComponent>()->is_init_ascending());
+                        break;
+                    }
+                    case GateTypeComponent::ComponentType::ff: {
+                        const FFComponent* ff = component->convert_to<FFComponent>();
+                        write_boolean_function(writer, ff->get_next_state_function());
+                        write_boolean_function(writer, ff->get_clock_function());
+                        write_boolean_function(writer, ff->get_async_reset_function());
+                        write_boolean_function(writer, ff->get_async_set_function());
+                        writer.write<u32>((u32)ff->get_async_set_reset_behavior().first);
+                        writer.write<u32>((u32)ff->get_async_set_reset_behavior().second);
+                        break;
+                    }
+                    case GateTypeComponent::ComponentType::latch: {
+                        const LatchComponent* latch = component->convert_to<LatchComponent>();
+                        write_boolean_function(writer, latch->get_data_in_function());
+                        write_boolean_function(writer, latch->get_enable_function());
+                        write_boolean_function(writer, latch->get_async_reset_function());
+                        write_boolean_function(writer, latch->get_async_set_function());
+                        writer.write<u32>((u32)latch->get_async_set_reset_behavior().first);
+                        writer.write<u32>((u32)latch->get_async_set_reset_behavior().second);
+                        break;
+                    }
+                    case GateTypeComponent::ComponentType::ram: {
+                        writer.write<u32>(component->convert_to<RAMComponent>()->get_bit_size());
+                        break;
+                    }
+                    case GateTypeComponent::ComponentType::mac:
+                        break;
+                    case GateTypeComponent::ComponentType::init: {
+                        const InitComponent* init = component->convert_to<InitComponent>();
+                        writer.write_string(init->get_init_category());
+                        writer.write<u32>((u32)init->get_init_identifiers().size());
+                        for (const auto& identifier : init->get_init_identifiers())
+                        {
+                            writer.write_string(identifier);
+                        }
+                        break;
+                    }
+                    case GateTypeComponent::ComponentType::state: {
+                        const StateComponent* state = component->convert_to<StateComponent>();
+                        writer.write_string(state->get_state_identifier());
+                        writer.write_string(state->get_neg_state_identifier());
+                        break;
+                    }
+                    case GateTypeComponent::ComponentType::ram_port: {
+                        const RAMPortComponent* port = component->convert_to<RAMPortComponent>();
+                        writer.write_string(port->get_data_group());
+                        writer.write_string(port->get_address_group());
+                        write_boolean_function(writer, port->get_clock_function());
+                        write_boolean_function(writer, port->get_enable_function());
+                        writer.write<u8>(port->is_write_port());
+                        break;
+                    }
+                }
+            }
+
+            /**
+             * Components form a chain in which every component holds at most one child.
+             * The chain is stored from the innermost to the outermost component, which is the order returned by `GateType::get_components`, so that it can be rebuilt in a single pass.
+             */
+            void write_component_chain(BinaryWriter& writer, const std::vector<GateTypeComponent*>& chain)
+            {
+                writer.write<u32>((u32)chain.size());
+                for (const auto* component : chain)
+                {
+                    write_component(writer, component);
+                }
+            }
+
+            bool read_component(BinaryReader& reader, std::unique_ptr<GateTypeComponent> child, std::unique_ptr<GateTypeComponent>& component)
+            {
+                u32 type;
+                if (!reader.read(type))
+                {
+                    return false;
+                }
+
+                switch ((GateTypeComponent::ComponentType)type)
+                {
+                    case GateTypeComponent::ComponentType::lut: {
+                        u8 ascending;
+                        if (!reader.read(ascending))
+                        {
+                            return false;
+                        }
+                        component = GateTypeComponent::create_lut_component(std::move(child), ascending != 0);
+                        return true;
+                    }
+                    case GateTypeComponent::ComponentType::ff: {
+                        BooleanFunction next_state, clock, async_reset, async_set;
+                        u32 behav_state, behav_neg_state;
+                        if (!read_boolean_function(reader, next_state) || !read_boolean_function(reader, clock) || !read_boolean_function(reader, async_reset)
+                            || !read_boolean_function(reader, async_set) || !reader.read(behav_state) || !reader.read(behav_neg_state))
+                        {
+                            return false;
+                        }
+                        component       = GateTypeComponent::create_ff_component(std::move(child), next_state, clock);
+                        FFComponent* ff = component->convert_to<FFComponent>();
+                        ff->set_async_reset_function(async_reset);
+                        ff->set_async_set_function(async_set);
+                        ff->set_async_set_reset_behavior((AsyncSetResetBehavior)behav_state, (AsyncSetResetBehavior)behav_neg_state);
+                        return true;
+                    }
+                    case GateTypeComponent::ComponentType::latch: {
+                        BooleanFunction data_in, enable, async_reset, async_set;
+                        u32 behav_state, behav_neg_state;
+                        if (!read_boolean_function(reader, data_in) || !read_boolean_function(reader, enable) || !read_boolean_function(reader, async_reset)
+                            || !read_boolean_function(reader, async_set) || !reader.read(behav_state) || !reader.read(behav_neg_state))
+                        {
+                            return false;
+                        }
+                        component             = GateTypeComponent::create_latch_component(std::move(child));
+                        LatchComponent* latch = component->convert_to<LatchComponent>();
+                        latch->set_data_in_function(data_in);
+                        latch->set_enable_function(enable);
+                        latch->set_async_reset_function(async_reset);
+                        latch->set_async_set_function(async_set);
+                        latch->set_async_set_reset_behavior((AsyncSetResetBehavior)behav_state, (AsyncSetResetBehavior)behav_neg_state);
+                        return true;
+                    }
+                    case GateTypeComponent::ComponentType::ram: {
+                        u32 bit_size;
+                        if (!reader.read(bit_size))
+                        {
+                            return false;
+                        }
+                        component = GateTypeComponent::create_ram_component(std::move(child), bit_size);
+                        return true;
+                    }
+                    case GateTypeComponent::ComponentType::mac: {
+                        component = GateTypeComponent::create_mac_component();
+                        return true;
+                    }
+                    case GateTypeComponent::ComponentType::init: {
+                        std::string category;
+                        u32 num_identifiers;
+                        if (!reader.read_string(category) || !reader.read(num_identifiers))
+                        {
+                            return false;
+                        }
+                        std::vector<std::string> identifiers(num_identifiers);
+                        for (auto& identifier : identifiers)
+                        {
+                            if (!reader.read_string(identifier))
+                            {
+                                return false;
+                            }
+                        }
+                        component = GateTypeComponent::create_init_component(category, identifiers);
+                        return true;
+                    }
+                    case GateTypeComponent::ComponentType::state: {
+                        std::string state_identifier, neg_state_identifier;
+                        if (!reader.read_string(state_identifier) || !reader.read_string(neg_state_identifier))
+                        {
+                            return false;
+                        }
+                        component = GateTypeComponent::create_state_component(std::move(child), state_identifier, neg_state_identifier);
+                        return true;
+                    }
+                    case GateTypeComponent::ComponentType::ram_port: {
+                        std::string data_group, address_group;
+                        BooleanFunction clock, enable;
+                        u8 is_write;
+                        if (!reader.read_string(data_group) || !reader.read_string(address_group) || !read_boolean_function(reader, clock) || !read_boolean_function(reader, enable)
+                            || !reader.read(is_write))
+                        {
+                            return false;
+                        }
+                        component = GateTypeComponent::create_ram_port_component(std::move(child), data_group, address_group, clock, enable, is_write != 0);
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            bool read_component_chain(BinaryReader& reader, std::unique_ptr<GateTypeComponent>& component)
+            {
+                u32 chain_length;
+                if (!reader.read(chain_length))
+                {
+                    return false;
+                }
+
+                component = nullptr;
+                for (u32 i = 0; i < chain_length; i++)
+                {
+                    std::unique_ptr<GateTypeComponent> parent;
+                    if (!read_component(reader, std::move(component), parent))
+                    {
+                        return false;
+                    }
+                    component = std::move(parent);
+                }
+                return true;
+            }
+        }    // namespace
+
+        std::filesystem::path get_cache_directory()
+        {
+            if (const char* xdg_cache = getenv("XDG_CACHE_HOME"); xdg_cache != nullptr && *xdg_cache != '\0')
+            {
+                return std::filesystem::path(xdg_cache) / "hal" / "gate_libraries";
+            }
+            if (const char* home = getenv("HOME"); home != nullptr && *home != '\0')
+            {
+                return std::filesystem::path(home) / ".cache" / "hal" / "gate_libraries";
+            }
+            std::error_code ec;
+            return std::filesystem::temp_directory_path(ec) / "hal" / "gate_libraries";
+        }
+
+        std::filesystem::path get_cache_path(const std::filesystem::path& source_path)
+        {
+            // the hash of the absolute source path keeps libraries with equal file names in different directories apart
+            std::error_code ec;
+            std::filesystem::path absolute_path = std::filesystem::absolute(source_path, ec);
+            if (ec)
+            {
+                absolute_path = source_path;
+            }
+            u64 hash = 0xcbf29ce484222325ull;
+            for (const char c : absolute_path.lexically_normal().string())
+            {
+                hash ^= (u8)c;
+                hash *= 0x100000001b3ull;
+            }
+
+            char hash_str[17];
+            std::snprintf(hash_str, sizeof(hash_str), "%016llx", (unsigned long long)hash);
+            return get_cache_directory() / (source_path.filename().string() + "." + hash_str + cache_extension);
+        }
+
+        bool is_valid(const std::filesystem::path& source_path)
+        {
+            return get_library_name(source_path).is_ok();
+        }
+
+        Result<std::string> get_library_name(const std::filesystem::path& source_path)
+        {
+            const auto cache_path = get_cache_path(source_path);
+            std::ifstream ifs(cache_path, std::ios::binary);
+            if (!ifs.is_open())
+            {
+                return ERR("no cache exists for gate library file '" + source_path.string() + "'");
+            }
+
+            // only read the fixed-size part of the header followed by the versions and the library name
+            std::string prefix(sizeof(cache_magic) + 2 * sizeof(u32) + sizeof(i64) + 2 * sizeof(u64), '\0');
+            ifs.read(prefix.data(), prefix.size());
+            if (ifs.gcount() != (std::streamsize)prefix.size())
+            {
+                return ERR("cache of gate library file '" + source_path.string() + "' has an unsupported format");
+            }
+            for (u32 i = 0; i < 3; i++)
+            {
+                u32 size;
+                ifs.read(reinterpret_cast<char*>(&size), sizeof(size));
+                if (ifs.gcount() != (std::streamsize)sizeof(size) || size > (1u << 16))
+                {
+                    return ERR("cache of gate library file '" + source_path.string() + "' has an unsupported format");
+                }
+                prefix.append(reinterpret_cast<const char*>(&size), sizeof(size));
+                const size_t offset = prefix.size();
+                prefix.resize(offset + size);
+                ifs.read(prefix.data() + offset, size);
+                if (ifs.gcount() != (std::streamsize)size)
+                {
+                    return ERR("cache of gate library file '" + source_path.string() + "' is truncated");
+                }
+            }
+
+            BinaryReader reader(prefix);
+            if (auto res = read_valid_header(reader, source_path); res.is_error())
+            {
+                return ERR(res.get_error());
+            }
+            else
+            {
+                return OK(res.get().lib_name);
+            }
+        }
+
+        Result<std::monostate> write(const GateLibrary* gate_lib, const std::filesystem::path& source_path)
+        {
+            if (gate_lib == nullptr)
+            {
+                return ERR("could not write gate library cache: 'nullptr' given as gate library");
+            }
+
+            std::error_code ec;
+            const u64 source_size = std::filesystem::file_size(source_path, ec);
+            if (ec)
+            {
+                return ERR("could not write cache of gate library '" + gate_lib->get_name() + "': unable to access source file '" + source_path.string() + "'");
+            }
+
+            auto hash_res = compute_file_hash(source_path);
+            if (hash_res.is_error())
+            {
+                return ERR_APPEND(hash_res.get_error(), "could not write cache of gate library '" + gate_lib->get_name() + "'");
+            }
+
+            BinaryWriter writer;
+            writer.write_raw(cache_magic, sizeof(cache_magic));
+            writer.write<u32>(format_version);
+            writer.write<u32>(byte_order_mark);
+            writer.write<i64>(get_mtime(source_path));
+            writer.write<u64>(source_size);
+            writer.write<u64>(hash_res.get());
+            writer.write_string(hal_version::version);
+            writer.write_string(gate_library_parser_manager::get_parser_version(source_path));
+            writer.write_string(gate_lib->get_name());
+
+            writer.write_string(gate_lib->get_gate_location_data_category());
+            writer.write_string(gate_lib->get_gate_location_data_identifiers().first);
+            writer.write_string(gate_lib->get_gate_location_data_identifiers().second);
+
+            const auto includes = gate_lib->get_includes();
+            writer.write<u32>((u32)includes.size());
+            for (const auto& inc : includes)
+            {
+                writer.write_string(inc);
+            }
+
+            // restore gate types in the order of their IDs to reproduce the same IDs on reading
+            std::vector<GateType*> gate_types;
+            for (const auto& [gt_name, gt] : gate_lib->get_gate_types())
+            {
+                gate_types.push_back(gt);
+            }
+            std::sort(gate_types.begin(), gate_types.end(), [](const GateType* a, const GateType* b) { return a->get_id() < b->get_id(); });
+
+            writer.write<u32>((u32)gate_types.size());
+            for (const GateType* gt : gate_types)
+            {
+                writer.write_string(gt->get_name());
+
+                const auto properties = gt->get_property_list();
+                writer.write<u32>((u32)properties.size());
+                for (const auto property : properties)
+                {
+                    writer.write<u32>((u32)property);
+                }
+
+                write_component_chain(writer, gt->get_components());
+
+                const auto pins = gt->get_pins();
+                writer.write<u32>((u32)pins.size());
+                for (const GatePin* pin : pins)
+                {
+                    writer.write<u32>(pin->get_id());
+                    writer.write_string(pin->get_name());
+                    writer.write<u32>((u32)pin->get_direction());
+                    writer.write<u32>((u32)pin->get_type());
+                }
+
+                const auto pin_groups = gt->get_pin_groups();
+                writer.write<u32>((u32)pin_groups.size());
+                for (const PinGroup<GatePin>* pin_group : pin_groups)
+                {
+                    writer.write<u32>(pin_group->get_id());
+                    writer.write_string(pin_group->get_name());
+                    writer.write<u32>((u32)pin_group->get_direction());
+                    writer.write<u32>((u32)pin_group->get_type());
+                    writer.write<u8>(pin_group->is_ascending());
+                    writer.write<i32>(pin_group->get_start_index());
+
+                    const auto group_pins = pin_group->get_pins();
+                    writer.write<u32>((u32)group_pins.size());
+                    for (const GatePin* pin : group_pins)
+                    {
+                        writer.write<u32>(pin->get_id());
+                    }
+                }
+
+                const auto& functions = gt->get_boolean_functions();
+                writer.write<u32>((u32)functions.size());
+                for (const auto& [name, bf] : functions)
+                {
+                    writer.write_string(name);
+                    write_boolean_function(writer, bf);
+                }
+            }
+
+            for (const auto& marked : {gate_lib->get_vcc_gate_types(), gate_lib->get_gnd_gate_types()})
+            {
+                writer.write<u32>((u32)marked.size());
+                for (const auto& [gt_name, gt] : marked)
+                {
+                    writer.write_string(gt_name);
+                }
+            }
+
+            // write to a temporary file first so that concurrent readers never observe a partially written cache
+            const auto cache_path = get_cache_path(source_path);
+            auto tmp_path         = cache_path;
+            tmp_path += ".tmp";
+            std::filesystem::create_directories(cache_path.parent_path(), ec);
+            {
+                std::ofstream ofs(tmp_path, std::ios::binary | std::ios::trunc);
+                if (!ofs.is_open())
+                {
+                    return ERR("could not write cache of gate library '" + gate_lib->get_name() + "': unable to open file '" + tmp_path.string() + "'");
+                }
+                ofs.write(writer.get_buffer().data(), writer.get_buffer().size());
+                if (!ofs.good())
+                {
+                    ofs.close();
+                    std::filesystem::remove(tmp_path, ec);
+                    return ERR("could not write cache of gate library '" + gate_lib->get_name() + "': failed writing to file '" + tmp_path.string() + "'");
+                }
+            }
+
+            std::filesystem::rename(tmp_path, cache_path, ec);
+            if (ec)
+            {
+                std::filesystem::remove(tmp_path, ec);
+                return ERR("could not write cache of gate library '" + gate_lib->get_name() + "': unable to move cache file to '" + cache_path.string() + "'");
+            }
+
+            return OK({});
+        }
+
+        Result<std::unique_ptr<GateLibrary>> read(const std::filesystem::path& source_path)
+        {
+            const auto cache_path = get_cache_path(source_path);
+            if (!std::filesystem::exists(cache_path))
+            {
+                return ERR("no cache exists for gate library file '" + source_path.string() + "'");
+            }
+
+            auto content_res = read_file(cache_path);
+            if (content_res.is_error())
+            {
+                return ERR(content_res.get_error());
+            }
+            const std::string content = content_res.get();
+            BinaryReader reader(content);
+
+            auto header_res = read_valid_header(reader, source_path);
+            if (header_res.is_error())
+            {
+                return ERR(header_res.get_error());
+            }
+
+            const std::string malformed = "cache file '" + cache_path.string() + "' is malformed";
+
+            auto gate_lib = std::make_unique<GateLibrary>(source_path, header_res.get().lib_name);
+
+            std::string category, x_identifier, y_identifier;
+            u32 num_includes;
+            if (!reader.read_string(category) || !reader.read_string(x_identifier) || !reader.read_string(y_identifier) || !reader.read(num_includes))
+            {
+                return ERR(malformed);
+            }
+            gate_lib->set_gate_location_data_category(category);
+            gate_lib->set_gate_location_data_identifiers(x_identifier, y_identifier);
+            for (u32 i = 0; i < num_includes; i++)
+            {
+                std::string inc;
+                if (!reader.read_string(inc))
+                {
+                    return ERR(malformed);
+                }
+                gate_lib->add_include(inc);
+            }
+
+            u32 num_gate_types;
+            if (!reader.read(num_gate_types))
+            {
+                return ERR(malformed);
+            }
+            for (u32 i = 0; i < num_gate_types; i++)
+            {
+                std::string gt_name;
+                u32 num_properties;
+                if (!reader.read_string(gt_name) || !reader.read(num_properties))
+                {
+                    return ERR(malformed);
+                }
+
+                std::set<GateTypeProperty> properties;
+                for (u32 j = 0; j < num_properties; j++)
+                {
+                    u32 property;
+                    if (!reader.read(property))
+                    {
+                        return ERR(malformed);
+                    }
+                    properties.insert((GateTypeProperty)property);
+                }
+
+                std::unique_ptr<GateTypeComponent> component;
+                if (!read_component_chain(reader, component))
+                {
+                    return ERR(malformed);
+                }
+
+                GateType* gt = gate_lib->create_gate_type(gt_name, properties, std::move(component));
+                if (gt == nullptr)
+                {
+                    return ERR(malformed);
+                }
+
+                u32 num_pins;
+                if (!reader.read(num_pins))
+                {
+                    return ERR(malformed);
+                }
+                for (u32 j = 0; j < num_pins; j++)
+                {
+                    u32 pin_id, direction, type;
+                    std::string pin_name;
+                    if (!reader.read(pin_id) || !reader.read_string(pin_name) || !reader.read(direction) || !reader.read(type))
+                    {
+                        return ERR(malformed);
+                    }
+                    if (auto res = gt->create_pin(pin_id, pin_name, (PinDirection)direction, (PinType)type, false); res.is_error())
+                    {
+                        return ERR_APPEND(res.get_error(), malformed);
+                    }
+                }
+
+                u32 num_groups;
+                if (!reader.read(num_groups))
+                {
+                    return ERR(malformed);
+                }
+                for (u32 j = 0; j < num_groups; j++)
+                {
+                    u32 group_id, direction, type, num_group_pins;
+                    std::string group_name;
+                    u8 ascending;
+                    i32 start_index;
+                    if (!reader.read(group_id) || !reader.read_string(group_name) || !reader.read(direction) || !reader.read(type) || !reader.read(ascending) || !reader.read(start_index)
+                        || !reader.read(num_group_pins))
+                    {
+                        return ERR(malformed);
+                    }
+
+                    std::vector<GatePin*> group_pins;
+                    group_pins.reserve(num_group_pins);
+                    for (u32 k = 0; k < num_group_pins; k++)
+                    {
+                        u32 pin_id;
+                        if (!reader.read(pin_id))
+                        {
+                            return ERR(malformed);
+                        }
+                        GatePin* pin = gt->get_pin_by_id(pin_id);
+                        if (pin == nullptr)
+                        {
+                            return ERR(malformed);
+                        }
+                        group_pins.push_back(pin);
+                    }
+
+                    if (auto res = gt->create_pin_group(group_id, group_name, group_pins, (PinDirection)direction, (PinType)type, ascending != 0, start_index, false); res.is_error())
+                    {
+                        return ERR_APPEND(res.get_error(), malformed);
+                    }
+                }
+
+                u32 num_functions;
+                if (!reader.read(num_functions))
+                {
+                    return ERR(malformed);
+                }
+                std::unordered_map<std::string, BooleanFunction> functions;
+                for (u32 j = 0; j < num_functions; j++)
+                {
+                    std::string name;
+                    BooleanFunction bf;
+                    if (!reader.read_string(name) || !read_boolean_function(reader, bf))
+                    {
+                        return ERR(malformed);
+                    }
+                    functions.emplace(name, std::move(bf));
+                }
+                gt->add_boolean_functions(functions);
+            }
+
+            for (bool vcc : {true, false})
+            {
+                u32 num_marked;
+                if (!reader.read(num_marked))
+                {
+                    return ERR(malformed);
+                }
+                for (u32 j = 0; j < num_marked; j++)
+                {
+                    std::string gt_name;
+                    if (!reader.read_string(gt_name))
+                    {
+                        return ERR(malformed);
+                    }
+                    GateType* gt = gate_lib->get_gate_type_by_name(gt_name);
+                    if (gt == nullptr || !(vcc ? gate_lib->mark_vcc_gate_type(gt) : gate_lib->mark_gnd_gate_type(gt)))
+                    {
+                        return ERR(malformed);
+                    }
+                }
+            }
+
+            if (!reader.at_end())
+            {
+                return ERR(malformed);
+            }
+
+            return OK(std::move(gate_lib));
+        }
+    }    // namespace gate_library_cache
+}    // namespace hal
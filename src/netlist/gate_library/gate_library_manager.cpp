@@ -1,12 +1,16 @@
 #include "hal_core/netlist/gate_library/gate_library_manager.h"
 
 #include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/gate_library/gate_library_cache.h"
 #include "hal_core/netlist/gate_library/gate_library_parser/gate_library_parser_manager.h"
 #include "hal_core/netlist/gate_library/gate_library_writer/gate_library_writer_manager.h"
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/trace.h"
 #include "hal_core/utilities/utils.h"
 
+#include <chrono>
 #include <iostream>
+#include <mutex>
 
 namespace hal
 {
@@ -15,6 +19,10 @@ namespace hal
         namespace
         {
             std::map<std::filesystem::path, std::unique_ptr<GateLibrary>> m_gate_libraries;
+            bool m_use_cache = true;
+
+            // guards m_gate_libraries so that netlists can be parsed from multiple threads, recursive since lookups may trigger loading
+            std::recursive_mutex m_gate_libraries_mutex;
 
             Result<std::monostate> prepare_library(const std::unique_ptr<GateLibrary>& lib)
             {
@@ -74,6 +82,9 @@ namespace hal
 
         GateLibrary* load(std::filesystem::path file_path, bool reload)
         {
+            HAL_TRACE_SCOPE("gate_library_manager::load");
+            std::lock_guard<std::recursive_mutex> lock(m_gate_libraries_mutex);
+
             if (!std::filesystem::exists(file_path))
             {
                 log_error("gate_library_manager", "gate library file '{}' does not exist.", file_path.string());
@@ -94,6 +105,27 @@ namespace hal
                 }
             }
 
+            if (m_use_cache && !reload)
+            {
+                auto begin_time = std::chrono::high_resolution_clock::now();
+                if (auto res = gate_library_cache::read(file_path); res.is_ok())
+                {
+                    std::unique_ptr<GateLibrary> gate_lib = res.get();
+                    log_info("gate_library_manager",
+                             "loaded gate library '{}' from cache of file '{}' in {:2.2f} seconds.",
+                             gate_lib->get_name(),
+                             file_path.string(),
+                             (double)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - begin_time).count() / 1000);
+                    GateLibrary* lib                     = gate_lib.get();
+                    m_gate_libraries[file_path.string()] = std::move(gate_lib);
+                    return lib;
+                }
+                else
+                {
+                    log_debug("gate_library_manager", "not using gate library cache:\n{}", res.get_error().get());
+                }
+            }
+
             std::unique_ptr<GateLibrary> gate_lib = gate_library_parser_manager::parse(file_path);
             if (gate_lib == nullptr)
             {
@@ -106,6 +138,15 @@ namespace hal
                 return nullptr;
             }
 
+            if (m_use_cache)
+            {
+                // the cache directory may not be writable, so a missing cache is not an error
+                if (auto res = gate_library_cache::write(gate_lib.get(), file_path); res.is_error())
+                {
+                    log_debug("gate_library_manager", "could not cache gate library:\n{}", res.get_error().get());
+                }
+            }
+
             GateLibrary* res                     = gate_lib.get();
             m_gate_libraries[file_path.string()] = std::move(gate_lib);
             return res;
@@ -168,11 +209,14 @@ namespace hal
 
         void remove(std::filesystem::path file_path)
         {
+            std::lock_guard<std::recursive_mutex> lock(m_gate_libraries_mutex);
             m_gate_libraries.erase(file_path);
         }
 
         GateLibrary* get_gate_library(const std::string& file_path)
         {
+            std::lock_guard<std::recursive_mutex> lock(m_gate_libraries_mutex);
+
             std::filesystem::path absolute_path;
 
             if (std::filesystem::exists(file_path))
@@ -207,6 +251,8 @@ namespace hal
 
         GateLibrary* get_gate_library_by_name(const std::string& lib_name)
         {
+            std::lock_guard<std::recursive_mutex> lock(m_gate_libraries_mutex);
+
             for (const auto& it : m_gate_libraries)
             {
                 if (it.second->get_name() == lib_name)
@@ -214,11 +260,56 @@ namespace hal
                     return it.second.get();
                 }
             }
+
+            // not loaded yet -> search the standard directories, preferring libraries whose cache reveals their name without parsing
+            std::vector<std::filesystem::path> uncached_paths;
+            for (const auto& lib_path : get_all_path())
+            {
+                const auto absolute_path = std::filesystem::absolute(lib_path);
+                if (m_gate_libraries.find(absolute_path.string()) != m_gate_libraries.end())
+                {
+                    continue;
+                }
+
+                if (m_use_cache)
+                {
+                    if (auto res = gate_library_cache::get_library_name(absolute_path); res.is_ok())
+                    {
+                        if (res.get() == lib_name)
+                        {
+                            return load(absolute_path);
+                        }
+                        continue;
+                    }
+                }
+                uncached_paths.push_back(absolute_path);
+            }
+
+            for (const auto& lib_path : uncached_paths)
+            {
+                if (GateLibrary* lib = load(lib_path); lib != nullptr && lib->get_name() == lib_name)
+                {
+                    return lib;
+                }
+            }
+
             return nullptr;
         }
 
+        void set_cache_enabled(bool enable)
+        {
+            m_use_cache = enable;
+        }
+
+        bool is_cache_enabled()
+        {
+            return m_use_cache;
+        }
+
         std::vector<GateLibrary*> get_gate_libraries()
         {
+            std::lock_guard<std::recursive_mutex> lock(m_gate_libraries_mutex);
+
             std::vector<GateLibrary*> res;
             res.reserve(m_gate_libraries.size());
             for (const auto& it : m_gate_libraries)
@@ -17,15 +17,21 @@ namespace hal
         {
             std::unordered_map<std::string, std::vector<std::string>> m_parser_to_extensions;
             std::unordered_map<std::string, std::pair<std::string, ParserFactory>> m_extension_to_parser;
+            std::unordered_map<std::string, std::string> m_parser_to_version;
 
-            ParserFactory get_parser_factory_for_file(const std::filesystem::path& file_name)
+            std::string get_extension(const std::filesystem::path& file_name)
             {
                 auto extension = utils::to_lower(file_name.extension().string());
                 if (!extension.empty() && extension[0] != '.')
                 {
                     extension = "." + extension;
                 }
+                return extension;
+            }
 
+            ParserFactory get_parser_factory_for_file(const std::filesystem::path& file_name)
+            {
+                const auto extension = get_extension(file_name);
                 if (auto it = m_extension_to_parser.find(extension); it != m_extension_to_parser.end())
                 {
                     log_info("gate_library_parser", "selected gate library parser '{}'.", it->second.first);
@@ -37,8 +43,9 @@ namespace hal
             }
         }    // namespace
 
-        void register_parser(const std::string& name, const ParserFactory& parser_factory, const std::vector<std::string>& supported_file_extensions)
+        void register_parser(const std::string& name, const ParserFactory& parser_factory, const std::vector<std::string>& supported_file_extensions, const std::string& version)
         {
+            m_parser_to_version[name] = version;
             for (auto ext : supported_file_extensions)
             {
                 ext = utils::trim(utils::to_lower(ext));
@@ -72,6 +79,17 @@ namespace hal
                 }
                 m_parser_to_extensions.erase(it);
             }
+            m_parser_to_version.erase(name);
+        }
+
+        std::string get_parser_version(const std::filesystem::path& file_path)
+        {
+            if (auto it = m_extension_to_parser.find(get_extension(file_path)); it != m_extension_to_parser.end())
+            {
+                const std::string& name = it->second.first;
+                return name + " " + m_parser_to_version[name];
+            }
+            return "";
         }
 
         std::unique_ptr<GateLibrary> parse(std::filesystem::path file_path)
@@ -7,8 +7,6 @@ namespace hal
     GateType::GateType(GateLibrary* gate_library, u32 id, const std::string& name, std::set<GateTypeProperty> properties, std::unique_ptr<GateTypeComponent> component)
         : m_gate_library(gate_library), m_id(id), m_name(name), m_properties(properties), m_component(std::move(component))
     {
-        m_next_pin_id       = 1;
-        m_next_pin_group_id = 1;
     }
 
     std::vector<GateTypeComponent*> GateType::get_components(const std::function<bool(const GateTypeComponent*)>& filter) const
@@ -119,28 +117,12 @@ namespace hal
 
     u32 GateType::get_unique_pin_id()
     {
-        if (!m_free_pin_ids.empty())
-        {
-            return *(m_free_pin_ids.begin());
-        }
-        while (m_used_pin_ids.find(m_next_pin_id) != m_used_pin_ids.end())
-        {
-            m_next_pin_id++;
-        }
-        return m_next_pin_id;
+        return m_pin_ids.get_unique_id();
     }
 
     u32 GateType::get_unique_pin_group_id()
     {
-        if (!m_free_pin_group_ids.empty())
-        {
-            return *(m_free_pin_group_ids.begin());
-        }
-        while (m_used_pin_group_ids.find(m_next_pin_group_id) != m_used_pin_group_ids.end())
-        {
-            m_next_pin_group_id++;
-        }
-        return m_next_pin_group_id;
+        return m_pin_group_ids.get_unique_id();
     }
 
     Result<GatePin*> GateType::create_pin(const u32 id, const std::string& name, PinDirection direction, PinType type, bool create_group)
@@ -153,7 +135,7 @@ namespace hal
         {
             return ERR("could not create pin '" + name + "' for gate type '" + m_name + "' with ID " + std::to_string(m_id) + ": ID 0 is invalid");
         }
-        if (m_used_pin_ids.find(id) != m_used_pin_ids.end())
+        if (m_pin_ids.is_used(id))
         {
             return ERR("could not create pin '" + name + "' for gate type '" + m_name + "' with ID " + std::to_string(m_id) + ": ID " + std::to_string(id) + " is already taken");
         }
@@ -174,11 +156,7 @@ namespace hal
         m_pin_names_map[name] = pin;
 
         // mark pin ID as used
-        if (auto free_id_it = m_free_pin_ids.find(id); free_id_it != m_free_pin_ids.end())
-        {
-            m_free_pin_ids.erase(free_id_it);
-        }
-        m_used_pin_ids.insert(id);
+        m_pin_ids.acquire(id);
 
         if (create_group)
         {
@@ -328,7 +306,7 @@ namespace hal
         {
             return ERR("could not create pin group '" + name + "' for gate type '" + m_name + "' with ID " + std::to_string(m_id) + ": ID 0 is invalid");
         }
-        if (m_used_pin_group_ids.find(id) != m_used_pin_group_ids.end())
+        if (m_pin_group_ids.is_used(id))
         {
             return ERR("could not create pin group '" + name + "' for gate type '" + m_name + "' with ID " + std::to_string(m_id) + ": ID " + std::to_string(id) + " is already taken");
         }
@@ -346,11 +324,7 @@ namespace hal
         m_pin_group_names_map[name] = pin_group;
 
         // mark pin group ID as used
-        if (auto free_id_it = m_free_pin_group_ids.find(id); free_id_it != m_free_pin_group_ids.end())
-        {
-            m_free_pin_group_ids.erase(free_id_it);
-        }
-        m_used_pin_group_ids.insert(id);
+        m_pin_group_ids.acquire(id);
 
         return OK(pin_group);
     }
@@ -419,8 +393,7 @@ namespace hal
         m_pin_groups.erase(std::find_if(m_pin_groups.begin(), m_pin_groups.end(), [pin_group](const auto& pg) { return pg.get() == pin_group; }));
 
         // free pin group ID
-        m_free_pin_group_ids.insert(del_id);
-        m_used_pin_group_ids.erase(del_id);
+        m_pin_group_ids.release(del_id);
 
         return OK({});
     }
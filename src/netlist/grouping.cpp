@@ -34,6 +34,7 @@ namespace hal
 
         if (name != m_name)
         {
+            m_internal_manager->transaction_record(this);
             m_name = name;
             m_event_handler->notify(GroupingEvent::event::name_changed, this);
         }
@@ -51,6 +52,7 @@ namespace hal
 
     void Grouping::set_color(utils::Color c)
     {
+        m_internal_manager->transaction_record(this);
         m_color = c;
         m_event_handler->notify(GroupingEvent::event::color_changed, this);
     }
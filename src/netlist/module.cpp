@@ -17,9 +17,6 @@ namespace hal
         m_parent           = parent;
         m_name             = name;
 
-        m_next_pin_id       = 1;
-        m_next_pin_group_id = 1;
-
         m_event_handler = event_handler;
     }
 
@@ -98,11 +95,25 @@ namespace hal
         }
         if (name != m_name)
         {
-            m_name = name;
+            m_internal_manager->transaction_record(this);
+            const std::string old_name = m_name;
+            m_name                     = name;
+            m_internal_manager->name_index_rename(this, old_name);
+            m_internal_manager->search_index_update(this);
             m_event_handler->notify(ModuleEvent::event::name_changed, this);
         }
     }
 
+    void Module::notify_before_update()
+    {
+        m_internal_manager->transaction_record(this);
+    }
+
+    void Module::notify_updated()
+    {
+        m_internal_manager->search_index_update(this);
+    }
+
     std::string Module::get_type() const
     {
         return m_type;
@@ -112,7 +123,9 @@ namespace hal
     {
         if (type != m_type)
         {
+            m_internal_manager->transaction_record(this);
             m_type = type;
+            m_internal_manager->search_index_update(this);
             m_event_handler->notify(ModuleEvent::event::type_changed, this);
         }
     }
@@ -197,6 +210,8 @@ namespace hal
             new_parent->set_parent_module(m_parent);
         }
 
+        m_internal_manager->transaction_record(this);
+
         m_parent->m_submodules_map.erase(m_id);
         m_parent->m_submodules.erase(std::find(m_parent->m_submodules.begin(), m_parent->m_submodules.end(), this));
 
@@ -433,6 +448,8 @@ namespace hal
 
     void Module::update_nets()
     {
+        m_internal_manager->transaction_record_module_nets(this);
+
         m_nets.clear();
         m_input_nets.clear();
         m_output_nets.clear();
@@ -632,6 +649,8 @@ namespace hal
 
     Result<std::monostate> Module::check_net(Net* net, bool recursive)
     {
+        m_internal_manager->transaction_record_module_net(this, net);
+
         NetConnectivity con = check_net_endpoints(net);
         if (con.has_internal_source && con.has_internal_destination)
         {
@@ -659,13 +678,17 @@ namespace hal
                 if (direction == PinDirection::input)
                 {
                     m_output_nets.insert(net);
+                    m_internal_manager->transaction_record_module_pins(this);
                     pin->set_direction(PinDirection::inout);
+                    m_internal_manager->search_index_update(this);
                     m_event_handler->notify(ModuleEvent::event::pin_changed, this);
                 }
                 else if (direction == PinDirection::output)
                 {
                     m_input_nets.insert(net);
+                    m_internal_manager->transaction_record_module_pins(this);
                     pin->set_direction(PinDirection::inout);
+                    m_internal_manager->search_index_update(this);
                     m_event_handler->notify(ModuleEvent::event::pin_changed, this);
                 }
             }
@@ -686,7 +709,9 @@ namespace hal
                 {
                     m_input_nets.insert(net);
                     m_output_nets.erase(net);
+                    m_internal_manager->transaction_record_module_pins(this);
                     pin->set_direction(PinDirection::input);
+                    m_internal_manager->search_index_update(this);
                     m_event_handler->notify(ModuleEvent::event::pin_changed, this);
                 }
             }
@@ -708,7 +733,9 @@ namespace hal
                 {
                     m_output_nets.insert(net);
                     m_input_nets.erase(net);
+                    m_internal_manager->transaction_record_module_pins(this);
                     pin->set_direction(PinDirection::output);
+                    m_internal_manager->search_index_update(this);
                     m_event_handler->notify(ModuleEvent::event::pin_changed, this);
                 }
             }
@@ -760,32 +787,18 @@ namespace hal
 
     u32 Module::get_unique_pin_id()
     {
-        if (!m_free_pin_ids.empty())
-        {
-            return *(m_free_pin_ids.begin());
-        }
-        while (m_used_pin_ids.find(m_next_pin_id) != m_used_pin_ids.end())
-        {
-            m_next_pin_id++;
-        }
-        return m_next_pin_id;
+        return m_pin_ids.get_unique_id();
     }
 
     u32 Module::get_unique_pin_group_id()
     {
-        if (!m_free_pin_group_ids.empty())
-        {
-            return *(m_free_pin_group_ids.begin());
-        }
-        while (m_used_pin_group_ids.find(m_next_pin_group_id) != m_used_pin_group_ids.end())
-        {
-            m_next_pin_group_id++;
-        }
-        return m_next_pin_group_id;
+        return m_pin_group_ids.get_unique_id();
     }
 
     Result<ModulePin*> Module::create_pin(const u32 id, const std::string& name, Net* net, PinType type, bool create_group, bool force_name)
     {
+        m_internal_manager->transaction_record_module_pins(this);
+
         if (name.empty())
         {
             return ERR("could not create pin for module '" + m_name + "' with ID " + std::to_string(m_id) + ": empty string passed as name");
@@ -849,6 +862,7 @@ namespace hal
                     }
                 }
             }
+            m_internal_manager->search_index_update(this);
             m_event_handler->notify(ModuleEvent::event::pin_changed, this);
             return pin_res;
         }
@@ -1013,9 +1027,9 @@ namespace hal
             return nullptr;
         }
 
-        if (const auto it = std::find_if(m_pins.begin(), m_pins.end(), [net](const std::unique_ptr<ModulePin>& pin) { return pin->get_net() == net; }); it != m_pins.end())
+        if (const auto it = m_pin_nets_map.find(net); it != m_pin_nets_map.end())
         {
-            return it->get();
+            return it->second;
         }
 
         log_debug("module", "could not get pin by net for module '{}' with ID {}: no pin belongs to net '{}' with ID {}", m_name, m_id, net->get_name(), net->get_id());
@@ -1058,6 +1072,8 @@ namespace hal
 
     bool Module::set_pin_name(ModulePin* pin, const std::string& new_name, bool force_name)
     {
+        m_internal_manager->transaction_record_module_pins(this);
+
         if (pin == nullptr)
         {
             log_warning("module", "could not set name for pin of module '{}' with ID {}: pin is a 'nullptr'", m_name, m_id);
@@ -1104,6 +1120,7 @@ namespace hal
             m_pin_names_map.erase(old_name);
             pin->set_name(new_name);
             m_pin_names_map[new_name] = pin;
+            m_internal_manager->search_index_update(this);
             m_event_handler->notify(ModuleEvent::event::pin_changed, this);
         }
 
@@ -1112,6 +1129,8 @@ namespace hal
 
     bool Module::set_pin_type(ModulePin* pin, PinType new_type)
     {
+        m_internal_manager->transaction_record_module_pins(this);
+
         if (pin == nullptr)
         {
             log_warning("module", "could not set type for pin of module '{}' with ID {}: pin is a 'nullptr'", m_name, m_id);
@@ -1127,6 +1146,7 @@ namespace hal
         if (pin->get_type() != new_type)
         {
             pin->set_type(new_type);
+            m_internal_manager->search_index_update(this);
             m_event_handler->notify(ModuleEvent::event::pin_changed, this);
         }
 
@@ -1135,6 +1155,8 @@ namespace hal
 
     bool Module::set_pin_group_name(PinGroup<ModulePin>* pin_group, const std::string& new_name, bool force_name)
     {
+        m_internal_manager->transaction_record_module_pins(this);
+
         if (pin_group == nullptr)
         {
             log_warning("module", "could not set name for pin group of module '{}' with ID {}: pin group is a 'nullptr'", m_name, m_id);
@@ -1183,6 +1205,7 @@ namespace hal
             m_pin_group_names_map.erase(old_name);
             pin_group->set_name(new_name);
             m_pin_group_names_map[new_name] = pin_group;
+            m_internal_manager->search_index_update(this);
             m_event_handler->notify(ModuleEvent::event::pin_changed, this);
         }
 
@@ -1191,6 +1214,8 @@ namespace hal
 
     bool Module::set_pin_group_type(PinGroup<ModulePin>* pin_group, PinType new_type)
     {
+        m_internal_manager->transaction_record_module_pins(this);
+
         if (pin_group == nullptr)
         {
             log_warning("module", "could not set type for pin group of module '{}' with ID {}: pin group is a 'nullptr'", m_name, m_id);
@@ -1207,6 +1232,7 @@ namespace hal
         if (pin_group->get_type() != new_type)
         {
             pin_group->set_type(new_type);
+            m_internal_manager->search_index_update(this);
             m_event_handler->notify(ModuleEvent::event::pin_changed, this);
         }
         return true;
@@ -1214,6 +1240,8 @@ namespace hal
 
     bool Module::set_pin_group_direction(PinGroup<ModulePin>* pin_group, PinDirection new_direction)
     {
+        m_internal_manager->transaction_record_module_pins(this);
+
         if (pin_group == nullptr)
         {
             log_warning("module", "could not set direction for pin group of module '{}' with ID {}: pin group is a 'nullptr'", m_name, m_id);
@@ -1234,6 +1262,7 @@ namespace hal
         if (pin_group->get_direction() != new_direction)
         {
             pin_group->set_direction(new_direction);
+            m_internal_manager->search_index_update(this);
             m_event_handler->notify(ModuleEvent::event::pin_changed, this);
         }
         return true;
@@ -1249,6 +1278,8 @@ namespace hal
                                                           bool delete_empty_groups,
                                                           bool force_name)
     {
+        m_internal_manager->transaction_record_module_pins(this);
+
         if (name.empty())
         {
             return ERR("could not create pin group for module '" + m_name + "' with ID " + std::to_string(m_id) + ": empty string passed as name");
@@ -1273,6 +1304,7 @@ namespace hal
             }
         }
 
+        m_internal_manager->search_index_update(this);
         m_event_handler->notify(ModuleEvent::event::pin_changed, this);
         return OK(pin_group);
     }
@@ -1291,6 +1323,8 @@ namespace hal
 
     Result<std::monostate> Module::delete_pin_group(PinGroup<ModulePin>* pin_group)
     {
+        m_internal_manager->transaction_record_module_pins(this);
+
         if (pin_group == nullptr)
         {
             return ERR("could not delete pin group from module '" + m_name + "' with ID " + std::to_string(m_id) + ": pin group is a 'nullptr'");
@@ -1321,6 +1355,7 @@ namespace hal
 
         if (removed_pins)
         {
+            m_internal_manager->search_index_update(this);
             m_event_handler->notify(ModuleEvent::event::pin_changed, this);
         }
         return OK({});
@@ -1328,6 +1363,8 @@ namespace hal
 
     Result<std::monostate> Module::move_pin_group(PinGroup<ModulePin>* pin_group, u32 new_index)
     {
+        m_internal_manager->transaction_record_module_pins(this);
+
         if (pin_group == nullptr)
         {
             return ERR("could not move pin group of module '" + m_name + "' with ID " + std::to_string(m_id) + ": pin group is a 'nullptr'");
@@ -1362,12 +1399,15 @@ namespace hal
             m_pin_groups_ordered.splice(dst_it, m_pin_groups_ordered, src_it);
         }
 
+        m_internal_manager->search_index_update(this);
         m_event_handler->notify(ModuleEvent::event::pin_changed, this);
         return OK({});
     }
 
     Result<std::monostate> Module::assign_pin_to_group(PinGroup<ModulePin>* pin_group, ModulePin* pin, bool delete_empty_groups)
     {
+        m_internal_manager->transaction_record_module_pins(this);
+
         if (pin_group == nullptr)
         {
             return ERR("could not assign pin to pin group of module '" + m_name + "' with ID " + std::to_string(m_id) + ": pin group is a 'nullptr'");
@@ -1421,12 +1461,15 @@ namespace hal
                                   + std::to_string(pin_group->get_id()) + " of module '" + m_name + "' with ID " + std::to_string(m_id));
         }
 
+        m_internal_manager->search_index_update(this);
         m_event_handler->notify(ModuleEvent::event::pin_changed, this);
         return OK({});
     }
 
     Result<std::monostate> Module::move_pin_within_group(PinGroup<ModulePin>* pin_group, ModulePin* pin, u32 new_index)
     {
+        m_internal_manager->transaction_record_module_pins(this);
+
         if (pin_group == nullptr)
         {
             return ERR("could not move pin within pin group of module '" + m_name + "' with ID " + std::to_string(m_id) + ": pin group is a 'nullptr'");
@@ -1457,12 +1500,42 @@ namespace hal
                                   + std::to_string(pin_group->get_id()) + " of module '" + m_name + "' with ID " + std::to_string(m_id));
         }
 
+        m_internal_manager->search_index_update(this);
+        m_event_handler->notify(ModuleEvent::event::pin_changed, this);
+        return OK({});
+    }
+
+    Result<std::monostate> Module::reorder_pins_within_group(PinGroup<ModulePin>* pin_group, const std::vector<ModulePin*>& pins)
+    {
+        m_internal_manager->transaction_record_module_pins(this);
+
+        if (pin_group == nullptr)
+        {
+            return ERR("could not reorder pins within pin group of module '" + m_name + "' with ID " + std::to_string(m_id) + ": pin group is a 'nullptr'");
+        }
+
+        if (const auto it = m_pin_groups_map.find(pin_group->get_id()); it == m_pin_groups_map.end() || it->second != pin_group)
+        {
+            return ERR("could not reorder pins within pin group '" + pin_group->get_name() + "' with ID " + std::to_string(pin_group->get_id()) + " of module '" + m_name + "' with ID "
+                       + std::to_string(m_id) + ": pin group does not belong to module");
+        }
+
+        if (auto res = pin_group->reorder_pins(pins); res.is_error())
+        {
+            return ERR_APPEND(res.get_error(),
+                              "could not reorder pins within pin group '" + pin_group->get_name() + "' with ID " + std::to_string(pin_group->get_id()) + " of module '" + m_name + "' with ID "
+                                  + std::to_string(m_id));
+        }
+
+        m_internal_manager->search_index_update(this);
         m_event_handler->notify(ModuleEvent::event::pin_changed, this);
         return OK({});
     }
 
     Result<std::monostate> Module::remove_pin_from_group(PinGroup<ModulePin>* pin_group, ModulePin* pin, bool delete_empty_groups)
     {
+        m_internal_manager->transaction_record_module_pins(this);
+
         if (pin_group == nullptr)
         {
             return ERR("could not remove pin from pin group of module '" + m_name + "' with ID " + std::to_string(m_id) + ": pin group is a 'nullptr'");
@@ -1498,6 +1571,8 @@ namespace hal
 
     Result<ModulePin*> Module::assign_pin_net(const u32 pin_id, Net* net, PinDirection direction, const std::string& name, PinType type)
     {
+        m_internal_manager->transaction_record_module_pins(this);
+
         std::string name_internal;
 
         if (!name.empty())
@@ -1552,12 +1627,15 @@ namespace hal
             }
         }
 
+        m_internal_manager->search_index_update(this);
         m_event_handler->notify(ModuleEvent::event::pin_changed, this);
         return OK(pin);
     }
 
     Result<std::monostate> Module::remove_pin_net(Net* net)
     {
+        m_internal_manager->transaction_record_module_pins(this);
+
         auto pin = get_pin_by_net(net);
         if (pin == nullptr)
         {
@@ -1591,6 +1669,7 @@ namespace hal
                                   + ": failed to delete pin '" + pin->get_name() + "' with ID " + std::to_string(pin->get_id()));
         }
 
+        m_internal_manager->search_index_update(this);
         m_event_handler->notify(ModuleEvent::event::pin_changed, this);
         return OK({});
     }
@@ -1602,7 +1681,7 @@ namespace hal
         {
             return ERR("could not create pin '" + name + "' for module '" + m_name + "' with ID " + std::to_string(m_id) + ": ID 0 is invalid");
         }
-        if (m_used_pin_ids.find(id) != m_used_pin_ids.end())
+        if (m_pin_ids.is_used(id))
         {
             return ERR("could not create pin '" + name + "' for module '" + m_name + "' with ID " + std::to_string(m_id) + ": ID " + std::to_string(id) + " is already taken");
         }
@@ -1636,13 +1715,10 @@ namespace hal
         m_pins.push_back(std::move(pin_owner));
         m_pins_map[id]        = pin;
         m_pin_names_map[name] = pin;
+        m_pin_nets_map.emplace(net, pin);
 
         // mark pin ID as used
-        if (auto free_id_it = m_free_pin_ids.find(id); free_id_it != m_free_pin_ids.end())
-        {
-            m_free_pin_ids.erase(free_id_it);
-        }
-        m_used_pin_ids.insert(id);
+        m_pin_ids.acquire(id);
 
         return OK(pin);
     }
@@ -1665,11 +1741,19 @@ namespace hal
         const std::string& del_name = pin->get_name();
         m_pins_map.erase(del_id);
         m_pin_names_map.erase(del_name);
+        if (const auto it = m_pin_nets_map.find(pin->get_net()); it != m_pin_nets_map.end() && it->second == pin)
+        {
+            // another pin may be connected to the same net
+            m_pin_nets_map.erase(it);
+            if (const auto other_it = std::find_if(m_pins.begin(), m_pins.end(), [pin](const auto& p) { return p.get() != pin && p->get_net() == pin->get_net(); }); other_it != m_pins.end())
+            {
+                m_pin_nets_map[pin->get_net()] = other_it->get();
+            }
+        }
         m_pins.erase(std::find_if(m_pins.begin(), m_pins.end(), [pin](const auto& p) { return p.get() == pin; }));
 
         // free pin ID
-        m_free_pin_ids.insert(del_id);
-        m_used_pin_ids.erase(del_id);
+        m_pin_ids.release(del_id);
 
         return OK({});
     }
@@ -1681,7 +1765,7 @@ namespace hal
         {
             return ERR("could not create pin group '" + name + "' for module '" + m_name + "' with ID " + std::to_string(m_id) + ": ID 0 is invalid");
         }
-        if (m_used_pin_group_ids.find(id) != m_used_pin_group_ids.end())
+        if (m_pin_group_ids.is_used(id))
         {
             return ERR("could not create pin group '" + name + "' for module '" + m_name + "' with ID " + std::to_string(m_id) + ": ID " + std::to_string(id) + " is already taken");
         }
@@ -1710,11 +1794,7 @@ namespace hal
         m_pin_group_names_map[name] = pin_group;
 
         // mark pin group ID as used
-        if (auto free_id_it = m_free_pin_group_ids.find(id); free_id_it != m_free_pin_group_ids.end())
-        {
-            m_free_pin_group_ids.erase(free_id_it);
-        }
-        m_used_pin_group_ids.insert(id);
+        m_pin_group_ids.acquire(id);
 
         return OK(pin_group);
     }
@@ -1741,8 +1821,7 @@ namespace hal
         m_pin_groups.erase(std::find_if(m_pin_groups.begin(), m_pin_groups.end(), [pin_group](const auto& pg) { return pg.get() == pin_group; }));
 
         // free pin group ID
-        m_free_pin_group_ids.insert(del_id);
-        m_used_pin_group_ids.erase(del_id);
+        m_pin_group_ids.release(del_id);
 
         return OK({});
     }
@@ -109,11 +109,25 @@ namespace hal
         }
         if (name != m_name)
         {
-            m_name = name;
+            m_internal_manager->transaction_record(this);
+            const std::string old_name = m_name;
+            m_name                     = name;
+            m_internal_manager->name_index_rename(this, old_name);
+            m_internal_manager->search_index_update(this);
             m_event_handler->notify(NetEvent::event::name_changed, this);
         }
     }
 
+    void Net::notify_before_update()
+    {
+        m_internal_manager->transaction_record(this);
+    }
+
+    void Net::notify_updated()
+    {
+        m_internal_manager->search_index_update(this);
+    }
+
     Grouping* Net::get_grouping() const
     {
         return m_grouping;
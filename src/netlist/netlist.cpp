@@ -8,17 +8,83 @@
 #include "hal_core/netlist/netlist_internal_manager.h"
 #include "hal_core/utilities/log.h"
 
+#include <algorithm>
+
 namespace hal
 {
+    namespace
+    {
+        template<class T>
+        std::vector<T*> find_by_name(const NameIndex<T>* index, const std::vector<T*>& objects, const std::string& name)
+        {
+            if (index != nullptr)
+            {
+                return index->find(name);
+            }
+
+            std::vector<T*> res;
+            for (T* obj : objects)
+            {
+                if (obj->get_name() == name)
+                {
+                    res.push_back(obj);
+                }
+            }
+            std::sort(res.begin(), res.end(), [](const T* a, const T* b) { return a->get_id() < b->get_id(); });
+            return res;
+        }
+
+        template<class T, typename Predicate>
+        std::vector<T*> find_sorted_by_name(const std::vector<T*>& objects, const Predicate& predicate)
+        {
+            std::vector<std::pair<std::string, T*>> matches;
+            for (T* obj : objects)
+            {
+                if (std::string name = obj->get_name(); predicate(name))
+                {
+                    matches.emplace_back(std::move(name), obj);
+                }
+            }
+            std::sort(matches.begin(), matches.end(), [](const auto& a, const auto& b) { return a.first < b.first || (a.first == b.first && a.second->get_id() < b.second->get_id()); });
+
+            std::vector<T*> res;
+            res.reserve(matches.size());
+            for (const auto& [name, obj] : matches)
+            {
+                res.push_back(obj);
+            }
+            return res;
+        }
+
+        template<class T>
+        std::vector<T*> find_by_name_prefix(const NameIndex<T>* index, const std::vector<T*>& objects, const std::string& prefix)
+        {
+            if (index != nullptr)
+            {
+                return index->find_prefix(prefix);
+            }
+
+            return find_sorted_by_name(objects, [&prefix](const std::string& name) { return name.compare(0, prefix.size(), prefix) == 0; });
+        }
+
+        template<class T>
+        std::vector<T*> find_by_hierarchy(const NameIndex<T>* index, const std::vector<T*>& objects, const std::string& path, const std::string& separator, bool recursive)
+        {
+            if (index != nullptr)
+            {
+                return index->find_in_scope(path, separator, recursive);
+            }
+
+            const std::string prefix = path.empty() ? "" : path + separator;
+            return find_sorted_by_name(objects, [&prefix, &separator, recursive](const std::string& name) { return NameIndex<T>::is_in_scope(name, prefix, separator, recursive); });
+        }
+    }    // namespace
+
     Netlist::Netlist(const GateLibrary* library) : m_gate_library(library)
     {
         m_event_handler    = std::make_unique<EventHandler>();
         m_manager          = new NetlistInternalManager(this, m_event_handler.get());
         m_netlist_id       = 1;
-        m_next_gate_id     = 1;
-        m_next_net_id      = 1;
-        m_next_module_id   = 1;
-        m_next_grouping_id = 1;
         m_top_module       = nullptr;    // this triggers the internal manager to allow creation of a module without parent
         m_top_module       = create_module("top_module", nullptr);
     }
@@ -28,6 +94,69 @@ namespace hal
         delete m_manager;
     }
 
+    void Netlist::enable_name_index(bool enable)
+    {
+        if (!enable)
+        {
+            m_gate_name_index.reset();
+            m_net_name_index.reset();
+            m_module_name_index.reset();
+            return;
+        }
+
+        if (is_name_index_enabled())
+        {
+            return;
+        }
+
+        m_gate_name_index   = std::make_unique<NameIndex<Gate>>();
+        m_net_name_index    = std::make_unique<NameIndex<Net>>();
+        m_module_name_index = std::make_unique<NameIndex<Module>>();
+        for (Gate* gate : m_gates)
+        {
+            m_gate_name_index->insert(gate);
+        }
+        for (Net* net : m_nets)
+        {
+            m_net_name_index->insert(net);
+        }
+        for (Module* module : m_modules)
+        {
+            m_module_name_index->insert(module);
+        }
+    }
+
+    bool Netlist::is_name_index_enabled() const
+    {
+        return m_gate_name_index != nullptr;
+    }
+
+    void Netlist::enable_search_index(bool enable)
+    {
+        if (!enable)
+        {
+            m_search_index.reset();
+        }
+        else if (m_search_index == nullptr)
+        {
+            m_search_index = std::make_unique<SearchIndex>(this);
+        }
+    }
+
+    bool Netlist::is_search_index_enabled() const
+    {
+        return m_search_index != nullptr;
+    }
+
+    Result<SearchIndex::Matches> Netlist::search(const std::string& text, u8 fields, bool case_sensitive, bool exact_match, bool regex) const
+    {
+        if (m_search_index != nullptr)
+        {
+            return m_search_index->search(text, fields, case_sensitive, exact_match, regex);
+        }
+        return SearchIndex::scan(this, text, fields, case_sensitive, exact_match, regex);
+    }
+
     bool Netlist::operator==(const Netlist& other) const
     {
         if (m_file_name != other.get_input_filename() || m_design_name != other.get_design_name() || m_device_name != other.get_device_name())
@@ -159,15 +288,7 @@ namespace hal
 
     u32 Netlist::get_unique_gate_id()
     {
-        if (!m_free_gate_ids.empty())
-        {
-            return *(m_free_gate_ids.begin());
-        }
-        while (m_used_gate_ids.find(m_next_gate_id) != m_used_gate_ids.end())
-        {
-            m_next_gate_id++;
-        }
-        return m_next_gate_id;
+        return m_gate_ids.get_unique_id();
     }
 
     Gate* Netlist::create_gate(const u32 id, GateType* gt, const std::string& name, i32 x, i32 y)
@@ -225,12 +346,30 @@ namespace hal
         return res;
     }
 
+    std::vector<Gate*> Netlist::get_gates_by_name(const std::string& name) const
+    {
+        return find_by_name(m_gate_name_index.get(), m_gates, name);
+    }
+
+    std::vector<Gate*> Netlist::get_gates_by_name_prefix(const std::string& prefix) const
+    {
+        return find_by_name_prefix(m_gate_name_index.get(), m_gates, prefix);
+    }
+
+    std::vector<Gate*> Netlist::get_gates_by_hierarchy(const std::string& path, const std::string& separator, bool recursive) const
+    {
+        return find_by_hierarchy(m_gate_name_index.get(), m_gates, path, separator, recursive);
+    }
+
     bool Netlist::mark_vcc_gate(Gate* gate)
     {
         if (!is_gate_in_netlist(gate))
         {
             return false;
         }
+
+        m_manager->transaction_record(gate);
+
         if (is_vcc_gate(gate))
         {
             log_debug("netlist", "gate '{}' with ID {} is already registered as global VCC gate in the netlist with ID {}.", gate->get_name(), gate->get_id(), m_netlist_id);
@@ -247,6 +386,9 @@ namespace hal
         {
             return false;
         }
+
+        m_manager->transaction_record(gate);
+
         if (is_gnd_gate(gate))
         {
             log_debug("netlist", "gate '{}' with ID {} is already registered as global GND gate in the netlist with ID {}.", gate->get_name(), gate->get_id(), m_netlist_id);
@@ -263,6 +405,9 @@ namespace hal
         {
             return false;
         }
+
+        m_manager->transaction_record(gate);
+
         auto it = std::find(m_vcc_gates.begin(), m_vcc_gates.end(), gate);
         if (it == m_vcc_gates.end())
         {
@@ -280,6 +425,9 @@ namespace hal
         {
             return false;
         }
+
+        m_manager->transaction_record(gate);
+
         auto it = std::find(m_gnd_gates.begin(), m_gnd_gates.end(), gate);
         if (it == m_gnd_gates.end())
         {
@@ -319,15 +467,7 @@ namespace hal
 
     u32 Netlist::get_unique_net_id()
     {
-        if (!m_free_net_ids.empty())
-        {
-            return *(m_free_net_ids.begin());
-        }
-        while (m_used_net_ids.find(m_next_net_id) != m_used_net_ids.end())
-        {
-            m_next_net_id++;
-        }
-        return m_next_net_id;
+        return m_net_ids.get_unique_id();
     }
 
     Net* Netlist::create_net(const u32 id, const std::string& name)
@@ -384,12 +524,30 @@ namespace hal
         return res;
     }
 
+    std::vector<Net*> Netlist::get_nets_by_name(const std::string& name) const
+    {
+        return find_by_name(m_net_name_index.get(), m_nets, name);
+    }
+
+    std::vector<Net*> Netlist::get_nets_by_name_prefix(const std::string& prefix) const
+    {
+        return find_by_name_prefix(m_net_name_index.get(), m_nets, prefix);
+    }
+
+    std::vector<Net*> Netlist::get_nets_by_hierarchy(const std::string& path, const std::string& separator, bool recursive) const
+    {
+        return find_by_hierarchy(m_net_name_index.get(), m_nets, path, separator, recursive);
+    }
+
     bool Netlist::mark_global_input_net(Net* n)
     {
         if (!is_net_in_netlist(n))
         {
             return false;
         }
+
+        m_manager->transaction_record(n);
+
         if (is_global_input_net(n))
         {
             log_debug("netlist", "net '{}' with ID {} is already registered as global input net in the netlist with ID {}.", n->get_name(), n->get_id(), m_netlist_id);
@@ -420,6 +578,9 @@ namespace hal
         {
             return false;
         }
+
+        m_manager->transaction_record(n);
+
         if (is_global_output_net(n))
         {
             log_debug("netlist", "net '{}' with ID {} is already registered as global output net in the netlist with ID {}.", n->get_name(), n->get_id(), m_netlist_id);
@@ -450,6 +611,9 @@ namespace hal
         {
             return false;
         }
+
+        m_manager->transaction_record(n);
+
         auto it = std::find(m_global_input_nets.begin(), m_global_input_nets.end(), n);
         if (it == m_global_input_nets.end())
         {
@@ -481,6 +645,9 @@ namespace hal
         {
             return false;
         }
+
+        m_manager->transaction_record(n);
+
         auto it = std::find(m_global_output_nets.begin(), m_global_output_nets.end(), n);
         if (it == m_global_output_nets.end())
         {
@@ -539,15 +706,7 @@ namespace hal
 
     u32 Netlist::get_unique_module_id()
     {
-        if (!m_free_module_ids.empty())
-        {
-            return *(m_free_module_ids.begin());
-        }
-        while (m_used_module_ids.find(m_next_module_id) != m_used_module_ids.end())
-        {
-            m_next_module_id++;
-        }
-        return m_next_module_id;
+        return m_module_ids.get_unique_id();
     }
 
     Module* Netlist::create_module(const u32 id, const std::string& name, Module* parent, const std::vector<Gate*>& gates)
@@ -610,6 +769,21 @@ namespace hal
         return res;
     }
 
+    std::vector<Module*> Netlist::get_modules_by_name(const std::string& name) const
+    {
+        return find_by_name(m_module_name_index.get(), m_modules, name);
+    }
+
+    std::vector<Module*> Netlist::get_modules_by_name_prefix(const std::string& prefix) const
+    {
+        return find_by_name_prefix(m_module_name_index.get(), m_modules, prefix);
+    }
+
+    std::vector<Module*> Netlist::get_modules_by_hierarchy(const std::string& path, const std::string& separator, bool recursive) const
+    {
+        return find_by_hierarchy(m_module_name_index.get(), m_modules, path, separator, recursive);
+    }
+
     bool Netlist::is_module_in_netlist(Module* module) const
     {
         return (module != nullptr) && (m_modules_set.find(module) != m_modules_set.end());
@@ -623,15 +797,7 @@ namespace hal
 
     u32 Netlist::get_unique_grouping_id()
     {
-        if (!m_free_grouping_ids.empty())
-        {
-            return *(m_free_grouping_ids.begin());
-        }
-        while (m_used_grouping_ids.find(m_next_grouping_id) != m_used_grouping_ids.end())
-        {
-            m_next_grouping_id++;
-        }
-        return m_next_grouping_id;
+        return m_grouping_ids.get_unique_id();
     }
 
     Grouping* Netlist::create_grouping(const u32 id, const std::string& name)
@@ -696,122 +862,134 @@ namespace hal
 
     u32 Netlist::get_next_gate_id() const
     {
-        return m_next_gate_id;
+        return m_gate_ids.get_next_id();
     }
 
     void Netlist::set_next_gate_id(const u32 id)
     {
-        m_next_gate_id = id;
+        m_gate_ids.set_next_id(id);
     }
 
     std::set<u32> Netlist::get_used_gate_ids() const
     {
-        return m_used_gate_ids;
+        return m_gate_ids.get_used_ids();
     }
 
     void Netlist::set_used_gate_ids(const std::set<u32> ids)
     {
-        m_used_gate_ids = ids;
+        m_gate_ids.set_used_ids(ids);
     }
 
     std::set<u32> Netlist::get_free_gate_ids() const
     {
-        return m_free_gate_ids;
+        return m_gate_ids.get_free_ids();
     }
 
     void Netlist::set_free_gate_ids(const std::set<u32> ids)
     {
-        m_free_gate_ids = ids;
+        m_gate_ids.set_free_ids(ids);
     }
 
     u32 Netlist::get_next_net_id() const
     {
-        return m_next_net_id;
+        return m_net_ids.get_next_id();
     }
 
     void Netlist::set_next_net_id(const u32 id)
     {
-        m_next_net_id = id;
+        m_net_ids.set_next_id(id);
     }
 
     std::set<u32> Netlist::get_used_net_ids() const
     {
-        return m_used_net_ids;
+        return m_net_ids.get_used_ids();
     }
 
     void Netlist::set_used_net_ids(const std::set<u32> ids)
     {
-        m_used_net_ids = ids;
+        m_net_ids.set_used_ids(ids);
     }
 
     std::set<u32> Netlist::get_free_net_ids() const
     {
-        return m_free_net_ids;
+        return m_net_ids.get_free_ids();
     }
 
     void Netlist::set_free_net_ids(const std::set<u32> ids)
     {
-        m_free_net_ids = ids;
+        m_net_ids.set_free_ids(ids);
     }
 
     u32 Netlist::get_next_module_id() const
     {
-        return m_next_module_id;
+        return m_module_ids.get_next_id();
     }
 
     void Netlist::set_next_module_id(const u32 id)
     {
-        m_next_module_id = id;
+        m_module_ids.set_next_id(id);
     }
 
     std::set<u32> Netlist::get_used_module_ids() const
     {
-        return m_used_module_ids;
+        return m_module_ids.get_used_ids();
     }
 
     void Netlist::set_used_module_ids(const std::set<u32> ids)
     {
-        m_used_module_ids = ids;
+        m_module_ids.set_used_ids(ids);
     }
 
     std::set<u32> Netlist::get_free_module_ids() const
     {
-        return m_free_module_ids;
+        return m_module_ids.get_free_ids();
     }
 
     void Netlist::set_free_module_ids(const std::set<u32> ids)
     {
-        m_free_module_ids = ids;
+        m_module_ids.set_free_ids(ids);
     }
 
     u32 Netlist::get_next_grouping_id() const
     {
-        return m_next_grouping_id;
+        return m_grouping_ids.get_next_id();
     }
 
     void Netlist::set_next_grouping_id(const u32 id)
     {
-        m_next_grouping_id = id;
+        m_grouping_ids.set_next_id(id);
     }
 
     std::set<u32> Netlist::get_used_grouping_ids() const
     {
-        return m_used_grouping_ids;
+        return m_grouping_ids.get_used_ids();
     }
 
     void Netlist::set_used_grouping_ids(const std::set<u32> ids)
     {
-        m_used_grouping_ids = ids;
+        m_grouping_ids.set_used_ids(ids);
     }
 
     std::set<u32> Netlist::get_free_grouping_ids() const
     {
-        return m_free_grouping_ids;
+        return m_grouping_ids.get_free_ids();
     }
 
     void Netlist::set_free_grouping_ids(const std::set<u32> ids)
     {
-        m_free_grouping_ids = ids;
+        m_grouping_ids.set_free_ids(ids);
+    }
+
+    void Netlist::reserve_ids(const Netlist& other)
+    {
+        auto reserve = [](IdAllocator& ids, const IdAllocator& other_ids) {
+            ids.set_next_id(std::max({ids.get_next_id(), other_ids.get_next_id(), other_ids.get_max_id() + 1}));
+        };
+
+        reserve(m_gate_ids, other.m_gate_ids);
+        reserve(m_net_ids, other.m_net_ids);
+        reserve(m_module_ids, other.m_module_ids);
+        reserve(m_grouping_ids, other.m_grouping_ids);
     }
 
     /*
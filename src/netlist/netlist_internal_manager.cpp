@@ -9,6 +9,7 @@
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/netlist/netlist_factory.h"
+#include "hal_core/netlist/netlist_transaction.h"
 #include "hal_core/utilities/log.h"
 
 namespace hal
@@ -108,7 +109,7 @@ namespace hal
             // ignore top module, since this is already created by the constructor
             if (module->m_id == 1)
             {
-                c_netlist->m_top_module->m_data = module->get_data_map();
+                c_netlist->m_top_module->m_data = module->m_data;
                 c_netlist->m_top_module->m_type = module->m_type;
                 continue;
             }
@@ -214,21 +215,13 @@ namespace hal
         c_netlist->m_file_name   = nl->m_file_name;
 
         // update ids last, after all the creation
-        c_netlist->m_next_gate_id  = nl->m_next_gate_id;
-        c_netlist->m_used_gate_ids = nl->m_used_gate_ids;
-        c_netlist->m_free_gate_ids = nl->m_free_gate_ids;
+        c_netlist->m_gate_ids = nl->m_gate_ids;
 
-        c_netlist->m_next_net_id  = nl->m_next_net_id;
-        c_netlist->m_used_net_ids = nl->m_used_net_ids;
-        c_netlist->m_free_net_ids = nl->m_free_net_ids;
+        c_netlist->m_net_ids = nl->m_net_ids;
 
-        c_netlist->m_next_module_id  = nl->m_next_module_id;
-        c_netlist->m_used_module_ids = nl->m_used_module_ids;
-        c_netlist->m_free_module_ids = nl->m_free_module_ids;
+        c_netlist->m_module_ids = nl->m_module_ids;
 
-        c_netlist->m_next_grouping_id  = nl->m_next_grouping_id;
-        c_netlist->m_used_grouping_ids = nl->m_used_grouping_ids;
-        c_netlist->m_free_grouping_ids = nl->m_free_grouping_ids;
+        c_netlist->m_grouping_ids = nl->m_grouping_ids;
 
         // copy module port names
         for (Module* module : nl->m_modules)
@@ -268,6 +261,9 @@ namespace hal
             c_module->m_next_output_index = module->m_next_output_index;
         }
 
+        c_netlist->enable_name_index(nl->is_name_index_enabled());
+        c_netlist->enable_search_index(nl->is_search_index_enabled());
+
         c_netlist->enable_automatic_net_checks(true);
         return OK(std::move(c_netlist));
     }
@@ -283,7 +279,7 @@ namespace hal
             log_error("gate", "ID 0 represents an invalid gate ID.");
             return nullptr;
         }
-        if (m_netlist->m_used_gate_ids.find(id) != m_netlist->m_used_gate_ids.end())
+        if (m_netlist->m_gate_ids.is_used(id))
         {
             log_error("gate", "gate ID {} is already taken in netlist with ID {}.", id, m_netlist->m_netlist_id);
             return nullptr;
@@ -306,13 +302,7 @@ namespace hal
 
         auto new_gate = std::unique_ptr<Gate>(new Gate(this, m_event_handler, id, gt, name, x, y));
 
-        auto free_id_it = m_netlist->m_free_gate_ids.find(id);
-        if (free_id_it != m_netlist->m_free_gate_ids.end())
-        {
-            m_netlist->m_free_gate_ids.erase(free_id_it);
-        }
-
-        m_netlist->m_used_gate_ids.insert(id);
+        m_netlist->m_gate_ids.acquire(id);
 
         // add gate to top module
         new_gate->m_module = m_netlist->m_top_module;
@@ -322,11 +312,21 @@ namespace hal
         m_netlist->m_gates_map[id] = std::move(new_gate);
         m_netlist->m_gates_set.insert(raw);
         m_netlist->m_gates.push_back(raw);
+        if (m_netlist->m_gate_name_index != nullptr)
+        {
+            m_netlist->m_gate_name_index->insert(raw);
+        }
+        search_index_update(raw);
 
         m_netlist->m_top_module->m_gates_map[id] = raw;
         m_netlist->m_top_module->m_gates.push_back(raw);
 
         // notify
+        if (m_transaction != nullptr)
+        {
+            m_transaction->record_creation(raw);
+        }
+
         m_event_handler->notify(ModuleEvent::event::gate_assigned, m_netlist->m_top_module, id);
         m_event_handler->notify(GateEvent::event::created, raw);
 
@@ -340,6 +340,8 @@ namespace hal
             return false;
         }
 
+        transaction_record(gate);
+
         for (auto ep : gate->get_fan_out_endpoints())
         {
             if (!net_remove_source(ep->get_net(), ep))
@@ -375,13 +377,18 @@ namespace hal
         m_netlist->m_gates_map.erase(it);
         m_netlist->m_gates_set.erase(gate);
         utils::unordered_vector_erase(m_netlist->m_gates, gate);
+        if (m_netlist->m_gate_name_index != nullptr)
+        {
+            m_netlist->m_gate_name_index->remove(gate);
+        }
+        search_index_update(gate);
 
         // free ids
-        m_netlist->m_free_gate_ids.insert(gate->get_id());
-        m_netlist->m_used_gate_ids.erase(gate->get_id());
+        m_netlist->m_gate_ids.release(gate->get_id());
 
         m_event_handler->notify(ModuleEvent::event::gate_removed, gate->m_module, gate->get_id());
         m_event_handler->notify(GateEvent::event::removed, gate);
+        m_event_handler->defer_destruction(std::move(ptr));
 
         return true;
     }
@@ -402,7 +409,7 @@ namespace hal
             log_error("net", "ID 0 represents an invalid net ID.");
             return nullptr;
         }
-        if (m_netlist->m_used_net_ids.find(id) != m_netlist->m_used_net_ids.end())
+        if (m_netlist->m_net_ids.is_used(id))
         {
             log_error("net", "net ID {} is already taken in netlist with ID {}.", id, m_netlist->m_netlist_id);
             return nullptr;
@@ -415,19 +422,23 @@ namespace hal
 
         auto new_net = std::unique_ptr<Net>(new Net(this, m_event_handler, id, name));
 
-        auto free_id_it = m_netlist->m_free_net_ids.find(id);
-        if (free_id_it != m_netlist->m_free_net_ids.end())
-        {
-            m_netlist->m_free_net_ids.erase(free_id_it);
-        }
-
-        m_netlist->m_used_net_ids.insert(id);
+        m_netlist->m_net_ids.acquire(id);
 
         // add net to netlist
         auto raw                  = new_net.get();
         m_netlist->m_nets_map[id] = std::move(new_net);
         m_netlist->m_nets_set.insert(raw);
         m_netlist->m_nets.push_back(raw);
+        if (m_netlist->m_net_name_index != nullptr)
+        {
+            m_netlist->m_net_name_index->insert(raw);
+        }
+        search_index_update(raw);
+
+        if (m_transaction != nullptr)
+        {
+            m_transaction->record_creation(raw);
+        }
 
         // notify
         m_event_handler->notify(NetEvent::event::created, raw);
@@ -442,6 +453,8 @@ namespace hal
             return false;
         }
 
+        transaction_record(net);
+
         auto dsts = net->m_destinations_raw;
         for (auto dst : dsts)
         {
@@ -476,11 +489,16 @@ namespace hal
         m_netlist->m_nets_map.erase(it);
         m_netlist->m_nets_set.erase(net);
         utils::unordered_vector_erase(m_netlist->m_nets, net);
+        if (m_netlist->m_net_name_index != nullptr)
+        {
+            m_netlist->m_net_name_index->remove(net);
+        }
+        search_index_update(net);
 
-        m_netlist->m_free_net_ids.insert(net->get_id());
-        m_netlist->m_used_net_ids.erase(net->get_id());
+        m_netlist->m_net_ids.release(net->get_id());
 
         m_event_handler->notify(NetEvent::event::removed, net);
+        m_event_handler->defer_destruction(std::move(ptr));
 
         return true;
     }
@@ -530,6 +548,9 @@ namespace hal
             return nullptr;
         }
 
+        transaction_record(net);
+        transaction_record(gate);
+
         auto new_endpoint     = std::unique_ptr<Endpoint>(new Endpoint(gate, pin, net, false));
         auto new_endpoint_raw = new_endpoint.get();
         net->m_sources.push_back(std::move(new_endpoint));
@@ -570,6 +591,9 @@ namespace hal
             return false;
         }
 
+        transaction_record(net);
+        transaction_record(gate);
+
         bool removed = false;
         for (u32 i = 0; i < net->m_sources.size(); ++i)
         {
@@ -668,6 +692,9 @@ namespace hal
             return nullptr;
         }
 
+        transaction_record(net);
+        transaction_record(gate);
+
         std::unique_ptr<Endpoint> new_endpoint = std::unique_ptr<Endpoint>(new Endpoint(gate, pin, net, true));
         Endpoint* new_endpoint_raw             = new_endpoint.get();
         net->m_destinations.push_back(std::move(new_endpoint));
@@ -707,6 +734,9 @@ namespace hal
             return false;
         }
 
+        transaction_record(net);
+        transaction_record(gate);
+
         bool removed = false;
         for (u32 i = 0; i < net->m_destinations.size(); ++i)
         {
@@ -770,7 +800,7 @@ namespace hal
             log_error("module", "ID 0 represents an invalid module ID.");
             return nullptr;
         }
-        if (m_netlist->m_used_module_ids.find(id) != m_netlist->m_used_module_ids.end())
+        if (m_netlist->m_module_ids.is_used(id))
         {
             log_error("module", "module ID {} is already taken in netlist with ID {}.", id, m_netlist->m_netlist_id);
             return nullptr;
@@ -793,18 +823,17 @@ namespace hal
 
         auto m = std::unique_ptr<Module>(new Module(this, m_event_handler, id, parent, name));
 
-        auto free_id_it = m_netlist->m_free_module_ids.find(id);
-        if (free_id_it != m_netlist->m_free_module_ids.end())
-        {
-            m_netlist->m_free_module_ids.erase(free_id_it);
-        }
-
-        m_netlist->m_used_module_ids.insert(id);
+        m_netlist->m_module_ids.acquire(id);
 
         auto raw                     = m.get();
         m_netlist->m_modules_map[id] = std::move(m);
         m_netlist->m_modules_set.insert(raw);
         m_netlist->m_modules.push_back(raw);
+        if (m_netlist->m_module_name_index != nullptr)
+        {
+            m_netlist->m_module_name_index->insert(raw);
+        }
+        search_index_update(raw);
 
         if (parent != nullptr)
         {
@@ -812,6 +841,11 @@ namespace hal
             parent->m_submodules.push_back(raw);
         }
 
+        if (m_transaction != nullptr)
+        {
+            m_transaction->record_creation(raw);
+        }
+
         m_event_handler->notify(ModuleEvent::event::created, raw);
 
         if (parent != nullptr)
@@ -836,6 +870,13 @@ namespace hal
 
         // at this point parent is guaranteed to be not null
 
+        transaction_record_module_nets(to_remove);
+        transaction_record_module_pins(to_remove);
+        for (const Module* sm : to_remove->m_submodules)
+        {
+            transaction_record(sm);
+        }
+
         // remove from grouping
         if (Grouping* g = to_remove->get_grouping(); g != nullptr)
         {
@@ -870,11 +911,16 @@ namespace hal
         m_netlist->m_modules_map.erase(it);
         m_netlist->m_modules_set.erase(to_remove);
         utils::unordered_vector_erase(m_netlist->m_modules, to_remove);
+        if (m_netlist->m_module_name_index != nullptr)
+        {
+            m_netlist->m_module_name_index->remove(to_remove);
+        }
+        search_index_update(to_remove);
 
-        m_netlist->m_free_module_ids.insert(to_remove->get_id());
-        m_netlist->m_used_module_ids.erase(to_remove->get_id());
+        m_netlist->m_module_ids.release(to_remove->get_id());
 
         m_event_handler->notify(ModuleEvent::event::removed, to_remove);
+        m_event_handler->defer_destruction(std::move(ptr));
         return true;
     }
 
@@ -926,6 +972,11 @@ namespace hal
             }
         }
 
+        for (const Gate* g : gates)
+        {
+            transaction_record(g);
+        }
+
         m_event_handler->notify(ModuleEvent::event::gates_assign_begin, module, gates.size());
         for (const auto& [prev_mod, num_gates] : prev_modules)
         {
@@ -1015,7 +1066,7 @@ namespace hal
             log_error("grouping", "ID 0 represents an invalid grouping ID.");
             return nullptr;
         }
-        if (m_netlist->m_used_grouping_ids.find(id) != m_netlist->m_used_grouping_ids.end())
+        if (m_netlist->m_grouping_ids.is_used(id))
         {
             log_error("grouping", "grouping ID {} is already taken in netlist with ID {}.", id, m_netlist->m_netlist_id);
             return nullptr;
@@ -1028,13 +1079,7 @@ namespace hal
 
         auto new_grouping = std::unique_ptr<Grouping>(new Grouping(this, m_event_handler, id, name));
 
-        auto free_id_it = m_netlist->m_free_grouping_ids.find(id);
-        if (free_id_it != m_netlist->m_free_grouping_ids.end())
-        {
-            m_netlist->m_free_grouping_ids.erase(free_id_it);
-        }
-
-        m_netlist->m_used_grouping_ids.insert(id);
+        m_netlist->m_grouping_ids.acquire(id);
 
         auto raw = new_grouping.get();
 
@@ -1042,6 +1087,11 @@ namespace hal
         m_netlist->m_groupings_set.insert(raw);
         m_netlist->m_groupings.push_back(raw);
 
+        if (m_transaction != nullptr)
+        {
+            m_transaction->record_creation(raw);
+        }
+
         // notify
         m_event_handler->notify(GroupingEvent::event::created, raw);
 
@@ -1055,18 +1105,23 @@ namespace hal
             return false;
         }
 
+        transaction_record(grouping);
+
         for (Gate* gate : grouping->get_gates())
         {
+            transaction_record(gate);
             gate->m_grouping = nullptr;
         }
 
         for (Net* net : grouping->get_nets())
         {
+            transaction_record(net);
             net->m_grouping = nullptr;
         }
 
         for (Module* module : grouping->get_modules())
         {
+            transaction_record(module);
             module->m_grouping = nullptr;
         }
 
@@ -1077,11 +1132,11 @@ namespace hal
         utils::unordered_vector_erase(m_netlist->m_groupings, grouping);
 
         // free ids
-        m_netlist->m_free_grouping_ids.insert(grouping->get_id());
-        m_netlist->m_used_grouping_ids.erase(grouping->get_id());
+        m_netlist->m_grouping_ids.release(grouping->get_id());
 
         // notify
         m_event_handler->notify(GroupingEvent::event::removed, grouping);
+        m_event_handler->defer_destruction(std::move(ptr));
 
         return true;
     }
@@ -1093,6 +1148,8 @@ namespace hal
             return false;
         }
 
+        transaction_record(gate);
+
         u32 gate_id = gate->get_id();
 
         if (Grouping* other = gate->get_grouping(); other != nullptr)
@@ -1144,6 +1201,8 @@ namespace hal
             return false;
         }
 
+        transaction_record(gate);
+
         auto vec_it = std::find(grouping->m_gates.begin(), grouping->m_gates.end(), gate);
 
         *vec_it = grouping->m_gates.back();
@@ -1163,6 +1222,8 @@ namespace hal
             return false;
         }
 
+        transaction_record(net);
+
         u32 net_id = net->get_id();
 
         if (Grouping* other = net->get_grouping(); other != nullptr)
@@ -1214,6 +1275,8 @@ namespace hal
             return false;
         }
 
+        transaction_record(net);
+
         auto vec_it = std::find(grouping->m_nets.begin(), grouping->m_nets.end(), net);
 
         *vec_it = grouping->m_nets.back();
@@ -1233,6 +1296,8 @@ namespace hal
             return false;
         }
 
+        transaction_record(module);
+
         u32 module_id = module->get_id();
 
         if (Grouping* other = module->get_grouping(); other != nullptr)
@@ -1284,6 +1349,8 @@ namespace hal
             return false;
         }
 
+        transaction_record(module);
+
         auto vec_it = std::find(grouping->m_modules.begin(), grouping->m_modules.end(), module);
 
         *vec_it = grouping->m_modules.back();
@@ -1296,12 +1363,129 @@ namespace hal
         return true;
     }
 
+    //######################################################################
+    //###                        transactions                            ###
+    //######################################################################
+
+    void NetlistInternalManager::transaction_record(const Gate* gate)
+    {
+        if (m_transaction != nullptr)
+        {
+            m_transaction->record(gate);
+        }
+    }
+
+    void NetlistInternalManager::transaction_record(const Net* net)
+    {
+        if (m_transaction != nullptr)
+        {
+            m_transaction->record(net);
+        }
+    }
+
+    void NetlistInternalManager::transaction_record(const Module* module)
+    {
+        if (m_transaction != nullptr)
+        {
+            m_transaction->record(module);
+        }
+    }
+
+    void NetlistInternalManager::transaction_record(const Grouping* grouping)
+    {
+        if (m_transaction != nullptr)
+        {
+            m_transaction->record(grouping);
+        }
+    }
+
+    void NetlistInternalManager::transaction_record_module_net(const Module* module, const Net* net)
+    {
+        if (m_transaction != nullptr)
+        {
+            m_transaction->record_module_net(module, net);
+        }
+    }
+
+    void NetlistInternalManager::transaction_record_module_nets(const Module* module)
+    {
+        if (m_transaction != nullptr)
+        {
+            m_transaction->record_module_nets(module);
+        }
+    }
+
+    void NetlistInternalManager::transaction_record_module_pins(const Module* module)
+    {
+        if (m_transaction != nullptr)
+        {
+            m_transaction->record_module_pins(module);
+        }
+    }
+
     //######################################################################
     //###                           caches                               ###
     //######################################################################
 
     void NetlistInternalManager::clear_caches()
     {
+        std::unique_lock<std::shared_mutex> lock(m_lut_function_cache_mutex);
         m_lut_function_cache.clear();
     }
+
+    //######################################################################
+    //###                      name index                                ###
+    //######################################################################
+
+    void NetlistInternalManager::name_index_rename(Gate* gate, const std::string& old_name)
+    {
+        if (m_netlist->m_gate_name_index != nullptr)
+        {
+            m_netlist->m_gate_name_index->rename(gate, old_name);
+        }
+    }
+
+    void NetlistInternalManager::name_index_rename(Net* net, const std::string& old_name)
+    {
+        if (m_netlist->m_net_name_index != nullptr)
+        {
+            m_netlist->m_net_name_index->rename(net, old_name);
+        }
+    }
+
+    void NetlistInternalManager::name_index_rename(Module* module, const std::string& old_name)
+    {
+        if (m_netlist->m_module_name_index != nullptr)
+        {
+            m_netlist->m_module_name_index->rename(module, old_name);
+        }
+    }
+
+    //######################################################################
+    //###                      search index                              ###
+    //######################################################################
+
+    void NetlistInternalManager::search_index_update(Gate* gate)
+    {
+        if (m_netlist->m_search_index != nullptr)
+        {
+            m_netlist->m_search_index->invalidate(gate);
+        }
+    }
+
+    void NetlistInternalManager::search_index_update(Net* net)
+    {
+        if (m_netlist->m_search_index != nullptr)
+        {
+            m_netlist->m_search_index->invalidate(net);
+        }
+    }
+
+    void NetlistInternalManager::search_index_update(Module* module)
+    {
+        if (m_netlist->m_search_index != nullptr)
+        {
+            m_netlist->m_search_index->invalidate(module);
+        }
+    }
 }    // namespace hal
@@ -8,6 +8,7 @@
 #include "hal_core/plugin_system/plugin_manager.h"
 
 #include <fstream>
+#include <set>
 
 namespace hal
 {
@@ -82,10 +83,9 @@ namespace hal
                 else
                 {
                     log_warning("netlist_parser", "no (valid) gate library specified, trying to auto-detect gate library...");
-                    gate_library_manager::load_all();
 
-                    for (GateLibrary* lib_it : gate_library_manager::get_gate_libraries())
-                    {
+                    // returns true if no further gate libraries need to be tried
+                    auto try_gate_library = [&](GateLibrary* lib_it) {
                         begin_time = std::chrono::high_resolution_clock::now();
 
                         log_info("netlist_parser", "instantiating '{}' with gate library '{}'...", file_name.string(), lib_it->get_name());
@@ -94,7 +94,7 @@ namespace hal
                         {
                             log_info("netlist_parser", "failed to instantiate '{}' with gate library '{}':\n{}", file_name.string(), lib_it->get_name(), res.get_error().get());
                             // log_debug("netlist_parser", "error encountered during netlist instantiation:\n{}", res.get_error().get());
-                            continue;
+                            return false;
                         }
                         else
                         {
@@ -109,7 +109,34 @@ namespace hal
 
                             netlists.push_back(std::move(netlist));
 
-                            if (break_on_match)
+                            return break_on_match;
+                        }
+                    };
+
+                    // try the already loaded gate libraries first, then load the remaining ones from the standard directories one by one until a match is found
+                    std::set<GateLibrary*> tried_libs;
+                    bool done = false;
+                    for (GateLibrary* lib_it : gate_library_manager::get_gate_libraries())
+                    {
+                        tried_libs.insert(lib_it);
+                        if (try_gate_library(lib_it))
+                        {
+                            done = true;
+                            break;
+                        }
+                    }
+
+                    if (!done)
+                    {
+                        for (const auto& lib_path : gate_library_manager::get_all_path())
+                        {
+                            GateLibrary* lib_it = gate_library_manager::get_gate_library(lib_path.string());
+                            if (lib_it == nullptr || !tried_libs.insert(lib_it).second)
+                            {
+                                continue;
+                            }
+
+                            if (try_gate_library(lib_it))
                             {
                                 break;
                             }
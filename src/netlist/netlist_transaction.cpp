@@ -0,0 +1,965 @@
+#include "hal_core/netlist/netlist_transaction.h"
+
+#include "hal_core/netlist/endpoint.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/grouping.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_internal_manager.h"
+#include "hal_core/utilities/log.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+
+namespace hal
+{
+    namespace
+    {
+        // membership of a net in the net sets of a module
+        constexpr u8 MODULE_NET          = 1 << 0;
+        constexpr u8 MODULE_INPUT_NET    = 1 << 1;
+        constexpr u8 MODULE_OUTPUT_NET   = 1 << 2;
+        constexpr u8 MODULE_INTERNAL_NET = 1 << 3;
+
+        template<typename T>
+        T* find_by_id(const std::unordered_map<u32, std::unique_ptr<T>>& objects, u32 id)
+        {
+            if (const auto it = objects.find(id); it != objects.end())
+            {
+                return it->second.get();
+            }
+            return nullptr;
+        }
+
+        // applies the same permutation to both endpoint vectors of a net
+        void restore_endpoint_order(std::vector<std::unique_ptr<Endpoint>>& endpoints, std::vector<Endpoint*>& endpoints_raw, const std::vector<std::pair<u32, GatePin*>>& order)
+        {
+            std::map<std::pair<u32, const GatePin*>, u32> ranks;
+            for (u32 i = 0; i < order.size(); i++)
+            {
+                ranks.emplace(order[i], i);
+            }
+
+            std::vector<u32> endpoint_ranks;
+            endpoint_ranks.reserve(endpoints_raw.size());
+            for (const Endpoint* ep : endpoints_raw)
+            {
+                const auto it = ranks.find({ep->get_gate()->get_id(), ep->get_pin()});
+                endpoint_ranks.push_back((it != ranks.end()) ? it->second : order.size());
+            }
+
+            std::vector<u32> indices(endpoints_raw.size());
+            std::iota(indices.begin(), indices.end(), 0);
+            std::stable_sort(indices.begin(), indices.end(), [&endpoint_ranks](u32 a, u32 b) { return endpoint_ranks[a] < endpoint_ranks[b]; });
+
+            std::vector<std::unique_ptr<Endpoint>> sorted;
+            std::vector<Endpoint*> sorted_raw;
+            sorted.reserve(indices.size());
+            sorted_raw.reserve(indices.size());
+            for (u32 i : indices)
+            {
+                sorted.push_back(std::move(endpoints[i]));
+                sorted_raw.push_back(endpoints_raw[i]);
+            }
+            endpoints     = std::move(sorted);
+            endpoints_raw = std::move(sorted_raw);
+        }
+
+        // reorders the endpoints of a gate and the corresponding nets, every pin of a gate is connected to at most one net
+        void restore_endpoint_order(std::vector<Endpoint*>& endpoints, std::vector<Net*>& nets, const std::vector<std::pair<u32, GatePin*>>& order)
+        {
+            std::unordered_map<const GatePin*, u32> ranks;
+            for (u32 i = 0; i < order.size(); i++)
+            {
+                ranks.emplace(order[i].second, i);
+            }
+
+            auto get_rank = [&ranks, &order](const Endpoint* ep) {
+                const auto it = ranks.find(ep->get_pin());
+                return (it != ranks.end()) ? it->second : (u32)order.size();
+            };
+
+            std::stable_sort(endpoints.begin(), endpoints.end(), [&get_rank](const Endpoint* a, const Endpoint* b) { return get_rank(a) < get_rank(b); });
+            for (u32 i = 0; i < endpoints.size(); i++)
+            {
+                nets[i] = endpoints[i]->get_net();
+            }
+        }
+
+        template<typename T>
+        bool restore_grouping(Netlist* netlist, T* object, u32 grouping_id)
+        {
+            Grouping* current  = object->get_grouping();
+            Grouping* original = (grouping_id != 0) ? netlist->get_grouping_by_id(grouping_id) : nullptr;
+            if (current == original)
+            {
+                return true;
+            }
+
+            if (original == nullptr)
+            {
+                if constexpr (std::is_same_v<T, Gate>)
+                {
+                    return current->remove_gate(object);
+                }
+                else if constexpr (std::is_same_v<T, Net>)
+                {
+                    return current->remove_net(object);
+                }
+                else
+                {
+                    return current->remove_module(object);
+                }
+            }
+
+            if constexpr (std::is_same_v<T, Gate>)
+            {
+                return original->assign_gate(object, true);
+            }
+            else if constexpr (std::is_same_v<T, Net>)
+            {
+                return original->assign_net(object, true);
+            }
+            else
+            {
+                return original->assign_module(object, true);
+            }
+        }
+    }    // namespace
+
+    NetlistTransaction::NetlistTransaction(Netlist* netlist) : m_netlist(netlist)
+    {
+        assert(netlist != nullptr);
+
+        m_parent                          = netlist->m_manager->m_transaction;
+        netlist->m_manager->m_transaction = this;
+
+        m_design_name  = netlist->m_design_name;
+        m_device_name  = netlist->m_device_name;
+        m_file_name    = netlist->m_file_name;
+        m_gate_ids     = netlist->m_gate_ids;
+        m_net_ids      = netlist->m_net_ids;
+        m_module_ids   = netlist->m_module_ids;
+        m_grouping_ids = netlist->m_grouping_ids;
+    }
+
+    NetlistTransaction::~NetlistTransaction()
+    {
+        if (!m_active)
+        {
+            return;
+        }
+
+        if (const auto res = discard(); res.is_error())
+        {
+            log_error("netlist", "{}", res.get_error().get());
+
+            // unlink the transaction anyway so that no dangling pointer remains
+            NetlistInternalManager* manager = m_netlist->m_manager;
+            if (manager->m_transaction == this)
+            {
+                manager->m_transaction = m_parent;
+            }
+            else
+            {
+                for (NetlistTransaction* t = manager->m_transaction; t != nullptr; t = t->m_parent)
+                {
+                    if (t->m_parent == this)
+                    {
+                        t->m_parent = m_parent;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    Netlist* NetlistTransaction::get_netlist() const
+    {
+        return m_netlist;
+    }
+
+    bool NetlistTransaction::is_active() const
+    {
+        return m_active;
+    }
+
+    u32 NetlistTransaction::get_num_recorded_objects() const
+    {
+        return m_gates.size() + m_nets.size() + m_modules.size() + m_groupings.size();
+    }
+
+    Result<std::monostate> NetlistTransaction::commit()
+    {
+        if (!m_active)
+        {
+            return ERR("could not commit transaction on netlist with ID " + std::to_string(m_netlist->get_id()) + ": transaction has already been finished");
+        }
+        if (m_netlist->m_manager->m_transaction != this)
+        {
+            return ERR("could not commit transaction on netlist with ID " + std::to_string(m_netlist->get_id()) + ": a nested transaction is still active");
+        }
+
+        if (m_parent != nullptr)
+        {
+            merge_into_parent();
+        }
+
+        m_netlist->m_manager->m_transaction = m_parent;
+        m_active                            = false;
+
+        m_gates.clear();
+        m_nets.clear();
+        m_modules.clear();
+        m_groupings.clear();
+
+        return OK({});
+    }
+
+    Result<std::monostate> NetlistTransaction::discard()
+    {
+        if (!m_active)
+        {
+            return ERR("could not discard transaction on netlist with ID " + std::to_string(m_netlist->get_id()) + ": transaction has already been finished");
+        }
+
+        NetlistInternalManager* manager = m_netlist->m_manager;
+        if (manager->m_transaction != this)
+        {
+            return ERR("could not discard transaction on netlist with ID " + std::to_string(m_netlist->get_id()) + ": a nested transaction is still active");
+        }
+
+        // neither record the restoration nor let automatic net checks modify module pins while the original state is only partially restored
+        const bool net_checks_enabled = manager->m_net_checks_enabled;
+        manager->m_transaction        = nullptr;
+        manager->m_net_checks_enabled = false;
+
+        auto res = restore();
+
+        manager->m_net_checks_enabled = net_checks_enabled;
+        manager->m_transaction        = m_parent;
+        m_active                      = false;
+
+        m_gates.clear();
+        m_nets.clear();
+        m_modules.clear();
+        m_groupings.clear();
+
+        if (res.is_error())
+        {
+            return ERR_APPEND(res.get_error(), "could not discard transaction on netlist with ID " + std::to_string(m_netlist->get_id()) + ": failed to restore original state");
+        }
+        return OK({});
+    }
+
+    void NetlistTransaction::record(const Gate* gate)
+    {
+        auto [it, inserted] = m_gates.try_emplace(gate->m_id);
+        if (!inserted)
+        {
+            return;
+        }
+
+        GateRecord& record = it->second;
+        record.existed     = true;
+        record.type        = gate->m_type;
+        record.name        = gate->m_name;
+        record.x           = gate->m_x;
+        record.y           = gate->m_y;
+        record.data        = *gate;
+        record.functions   = gate->m_functions;
+        record.module_id   = gate->m_module->m_id;
+        record.grouping_id = (gate->m_grouping != nullptr) ? gate->m_grouping->m_id : 0;
+        record.is_gnd      = m_netlist->is_gnd_gate(gate);
+        record.is_vcc      = m_netlist->is_vcc_gate(gate);
+
+        record.fan_in.reserve(gate->m_in_endpoints.size());
+        for (const Endpoint* ep : gate->m_in_endpoints)
+        {
+            record.fan_in.emplace_back(ep->get_net()->get_id(), ep->get_pin());
+        }
+        record.fan_out.reserve(gate->m_out_endpoints.size());
+        for (const Endpoint* ep : gate->m_out_endpoints)
+        {
+            record.fan_out.emplace_back(ep->get_net()->get_id(), ep->get_pin());
+        }
+    }
+
+    void NetlistTransaction::record(const Net* net)
+    {
+        auto [it, inserted] = m_nets.try_emplace(net->m_id);
+        if (!inserted)
+        {
+            return;
+        }
+
+        NetRecord& record       = it->second;
+        record.existed          = true;
+        record.name             = net->m_name;
+        record.data             = *net;
+        record.is_global_input  = m_netlist->is_global_input_net(net);
+        record.is_global_output = m_netlist->is_global_output_net(net);
+        record.grouping_id      = (net->m_grouping != nullptr) ? net->m_grouping->m_id : 0;
+
+        record.sources.reserve(net->m_sources_raw.size());
+        for (const Endpoint* ep : net->m_sources_raw)
+        {
+            record.sources.emplace_back(ep->get_gate()->get_id(), ep->get_pin());
+        }
+        record.destinations.reserve(net->m_destinations_raw.size());
+        for (const Endpoint* ep : net->m_destinations_raw)
+        {
+            record.destinations.emplace_back(ep->get_gate()->get_id(), ep->get_pin());
+        }
+    }
+
+    void NetlistTransaction::record(const Module* module)
+    {
+        auto [it, inserted] = m_modules.try_emplace(module->m_id);
+        if (!inserted)
+        {
+            return;
+        }
+
+        ModuleRecord& record = it->second;
+        record.existed       = true;
+        record.name          = module->m_name;
+        record.type          = module->m_type;
+        record.parent_id     = (module->m_parent != nullptr) ? module->m_parent->m_id : 0;
+        record.data          = *module;
+        record.grouping_id   = (module->m_grouping != nullptr) ? module->m_grouping->m_id : 0;
+    }
+
+    void NetlistTransaction::record(const Grouping* grouping)
+    {
+        auto [it, inserted] = m_groupings.try_emplace(grouping->m_id);
+        if (!inserted)
+        {
+            return;
+        }
+
+        GroupingRecord& record = it->second;
+        record.existed         = true;
+        record.name            = grouping->m_name;
+        record.color           = grouping->m_color;
+    }
+
+    void NetlistTransaction::record_module_net(const Module* module, const Net* net)
+    {
+        record(module);
+
+        ModuleRecord& record = m_modules.at(module->m_id);
+        if (record.nets.find(net->m_id) != record.nets.end())
+        {
+            return;
+        }
+
+        Net* key = const_cast<Net*>(net);
+        u8 flags = 0;
+        flags |= (module->m_nets.find(key) != module->m_nets.end()) ? MODULE_NET : 0;
+        flags |= (module->m_input_nets.find(key) != module->m_input_nets.end()) ? MODULE_INPUT_NET : 0;
+        flags |= (module->m_output_nets.find(key) != module->m_output_nets.end()) ? MODULE_OUTPUT_NET : 0;
+        flags |= (module->m_internal_nets.find(key) != module->m_internal_nets.end()) ? MODULE_INTERNAL_NET : 0;
+        record.nets.emplace(net->m_id, flags);
+    }
+
+    void NetlistTransaction::record_module_nets(const Module* module)
+    {
+        record(module);
+
+        if (m_modules.at(module->m_id).all_nets_recorded)
+        {
+            return;
+        }
+
+        for (const auto* nets : {&module->m_nets, &module->m_input_nets, &module->m_output_nets, &module->m_internal_nets})
+        {
+            for (const Net* net : *nets)
+            {
+                record_module_net(module, net);
+            }
+        }
+        m_modules.at(module->m_id).all_nets_recorded = true;
+    }
+
+    void NetlistTransaction::record_module_pins(const Module* module)
+    {
+        record(module);
+
+        ModuleRecord& record = m_modules.at(module->m_id);
+        if (!record.existed || record.pins_recorded)
+        {
+            return;
+        }
+
+        record.pins_recorded     = true;
+        record.pin_ids           = module->m_pin_ids;
+        record.pin_group_ids     = module->m_pin_group_ids;
+        record.next_input_index  = module->m_next_input_index;
+        record.next_inout_index  = module->m_next_inout_index;
+        record.next_output_index = module->m_next_output_index;
+
+        record.pin_groups.reserve(module->m_pin_groups_ordered.size());
+        for (const PinGroup<ModulePin>* pin_group : module->m_pin_groups_ordered)
+        {
+            PinGroupRecord& group_record = record.pin_groups.emplace_back();
+            group_record.id              = pin_group->get_id();
+            group_record.name            = pin_group->get_name();
+            group_record.direction       = pin_group->get_direction();
+            group_record.type            = pin_group->get_type();
+            group_record.ascending       = pin_group->is_ascending();
+            group_record.start_index     = pin_group->get_start_index();
+            for (const ModulePin* pin : pin_group->get_pins())
+            {
+                group_record.pins.push_back({pin->get_id(), pin->get_name(), pin->get_net()->get_id(), pin->get_direction(), pin->get_type()});
+            }
+        }
+    }
+
+    void NetlistTransaction::record_creation(const Gate* gate)
+    {
+        if (auto [it, inserted] = m_gates.try_emplace(gate->m_id); inserted)
+        {
+            it->second.existed = false;
+        }
+        else
+        {
+            it->second.replaced = true;
+        }
+    }
+
+    void NetlistTransaction::record_creation(const Net* net)
+    {
+        if (auto [it, inserted] = m_nets.try_emplace(net->m_id); inserted)
+        {
+            it->second.existed = false;
+        }
+        else
+        {
+            it->second.replaced = true;
+        }
+    }
+
+    void NetlistTransaction::record_creation(const Module* module)
+    {
+        if (auto [it, inserted] = m_modules.try_emplace(module->m_id); inserted)
+        {
+            it->second.existed = false;
+        }
+        else
+        {
+            it->second.replaced = true;
+        }
+    }
+
+    void NetlistTransaction::record_creation(const Grouping* grouping)
+    {
+        if (auto [it, inserted] = m_groupings.try_emplace(grouping->m_id); inserted)
+        {
+            it->second.existed = false;
+        }
+        else
+        {
+            it->second.replaced = true;
+        }
+    }
+
+    void NetlistTransaction::merge_into_parent()
+    {
+        // a record of the parent is always older, objects that the parent does not know yet were unchanged from the start of the parent until the start of this transaction
+        auto merge = [](auto& records, auto& parent_records) {
+            for (auto& [id, record] : records)
+            {
+                if (auto [it, inserted] = parent_records.try_emplace(id, std::move(record)); !inserted)
+                {
+                    if (!record.existed || record.replaced)
+                    {
+                        it->second.replaced = true;
+                    }
+                }
+            }
+        };
+
+        merge(m_gates, m_parent->m_gates);
+        merge(m_nets, m_parent->m_nets);
+        merge(m_groupings, m_parent->m_groupings);
+
+        for (auto& [id, record] : m_modules)
+        {
+            if (auto [it, inserted] = m_parent->m_modules.try_emplace(id, std::move(record)); !inserted)
+            {
+                ModuleRecord& parent_record = it->second;
+                if (!record.existed || record.replaced)
+                {
+                    parent_record.replaced = true;
+                }
+                parent_record.nets.insert(record.nets.begin(), record.nets.end());
+                parent_record.all_nets_recorded |= record.all_nets_recorded;
+                if (record.pins_recorded && !parent_record.pins_recorded)
+                {
+                    // the pins have not been modified before the nested transaction recorded them, hence its record is the original state
+                    parent_record.pins_recorded     = true;
+                    parent_record.pin_groups        = std::move(record.pin_groups);
+                    parent_record.pin_ids           = std::move(record.pin_ids);
+                    parent_record.pin_group_ids     = std::move(record.pin_group_ids);
+                    parent_record.next_input_index  = record.next_input_index;
+                    parent_record.next_inout_index  = record.next_inout_index;
+                    parent_record.next_output_index = record.next_output_index;
+                }
+            }
+        }
+    }
+
+    Result<std::monostate> NetlistTransaction::restore()
+    {
+        NetlistInternalManager* manager = m_netlist->m_manager;
+        EventHandler* event_handler     = m_netlist->m_event_handler.get();
+
+        // subscribers are notified about all reverted modifications at once
+        EventBatchGuard batch_guard(event_handler);
+
+        // remove recorded nets from the net sets of modules before any net is deleted, they are inserted again according to their original state later on
+        for (const auto& [id, record] : m_modules)
+        {
+            Module* module = find_by_id(m_netlist->m_modules_map, id);
+            if (module == nullptr || !record.existed || record.replaced)
+            {
+                continue;
+            }
+
+            if (record.all_nets_recorded)
+            {
+                module->m_nets.clear();
+                module->m_input_nets.clear();
+                module->m_output_nets.clear();
+                module->m_internal_nets.clear();
+                continue;
+            }
+
+            for (const auto& [net_id, flags] : record.nets)
+            {
+                if (Net* net = find_by_id(m_netlist->m_nets_map, net_id); net != nullptr)
+                {
+                    module->m_nets.erase(net);
+                    module->m_input_nets.erase(net);
+                    module->m_output_nets.erase(net);
+                    module->m_internal_nets.erase(net);
+                }
+            }
+        }
+
+        // delete objects that have been created during the transaction
+        for (const auto& [id, record] : m_groupings)
+        {
+            if (Grouping* grouping = find_by_id(m_netlist->m_groupings_map, id); grouping != nullptr && (!record.existed || record.replaced) && !manager->delete_grouping(grouping))
+            {
+                return ERR("failed to delete grouping with ID " + std::to_string(id));
+            }
+        }
+        for (const auto& [id, record] : m_gates)
+        {
+            if (Gate* gate = find_by_id(m_netlist->m_gates_map, id); gate != nullptr && (!record.existed || record.replaced) && !manager->delete_gate(gate))
+            {
+                return ERR("failed to delete gate with ID " + std::to_string(id));
+            }
+        }
+        for (const auto& [id, record] : m_nets)
+        {
+            if (Net* net = find_by_id(m_netlist->m_nets_map, id); net != nullptr && (!record.existed || record.replaced) && !manager->delete_net(net))
+            {
+                return ERR("failed to delete net with ID " + std::to_string(id));
+            }
+        }
+        for (const auto& [id, record] : m_modules)
+        {
+            if (Module* module = find_by_id(m_netlist->m_modules_map, id); module != nullptr && (!record.existed || record.replaced) && !manager->delete_module(module))
+            {
+                return ERR("failed to delete module with ID " + std::to_string(id));
+            }
+        }
+
+        // re-create objects that have been deleted during the transaction, modules are attached to the top module until the hierarchy is restored
+        for (const auto& [id, record] : m_modules)
+        {
+            if (record.existed && find_by_id(m_netlist->m_modules_map, id) == nullptr && manager->create_module(id, m_netlist->m_top_module, record.name) == nullptr)
+            {
+                return ERR("failed to re-create module '" + record.name + "' with ID " + std::to_string(id));
+            }
+        }
+        for (const auto& [id, record] : m_gates)
+        {
+            if (record.existed && find_by_id(m_netlist->m_gates_map, id) == nullptr && manager->create_gate(id, record.type, record.name, record.x, record.y) == nullptr)
+            {
+                return ERR("failed to re-create gate '" + record.name + "' with ID " + std::to_string(id));
+            }
+        }
+        for (const auto& [id, record] : m_nets)
+        {
+            if (record.existed && find_by_id(m_netlist->m_nets_map, id) == nullptr && manager->create_net(id, record.name) == nullptr)
+            {
+                return ERR("failed to re-create net '" + record.name + "' with ID " + std::to_string(id));
+            }
+        }
+        for (const auto& [id, record] : m_groupings)
+        {
+            if (record.existed && find_by_id(m_netlist->m_groupings_map, id) == nullptr && manager->create_grouping(id, record.name) == nullptr)
+            {
+                return ERR("failed to re-create grouping '" + record.name + "' with ID " + std::to_string(id));
+            }
+        }
+
+        // restore module hierarchy, intermediate states may contain cycles but the final state equals the original tree
+        for (const auto& [id, record] : m_modules)
+        {
+            if (!record.existed || record.parent_id == 0)
+            {
+                continue;
+            }
+
+            Module* module = find_by_id(m_netlist->m_modules_map, id);
+            Module* parent = find_by_id(m_netlist->m_modules_map, record.parent_id);
+            if (parent == nullptr)
+            {
+                return ERR("failed to restore parent module of module '" + record.name + "' with ID " + std::to_string(id) + ": no module with ID " + std::to_string(record.parent_id));
+            }
+            if (module->m_parent == parent)
+            {
+                continue;
+            }
+
+            Module* old_parent = module->m_parent;
+            old_parent->m_submodules_map.erase(id);
+            utils::unordered_vector_erase(old_parent->m_submodules, module);
+            event_handler->notify(ModuleEvent::event::submodule_removed, old_parent, id);
+
+            module->m_parent             = parent;
+            parent->m_submodules_map[id] = module;
+            parent->m_submodules.push_back(module);
+            event_handler->notify(ModuleEvent::event::parent_changed, module);
+            event_handler->notify(ModuleEvent::event::submodule_added, parent, id);
+        }
+
+        // restore gates
+        for (const auto& [id, record] : m_gates)
+        {
+            if (!record.existed)
+            {
+                continue;
+            }
+
+            Gate* gate = find_by_id(m_netlist->m_gates_map, id);
+            gate->set_name(record.name);
+            gate->set_location(std::make_pair(record.x, record.y));
+            static_cast<DataContainer&>(*gate) = record.data;
+            gate->m_functions                  = record.functions;
+            manager->search_index_update(gate);
+
+            Module* module = find_by_id(m_netlist->m_modules_map, record.module_id);
+            if (module == nullptr)
+            {
+                return ERR("failed to restore module of gate '" + record.name + "' with ID " + std::to_string(id) + ": no module with ID " + std::to_string(record.module_id));
+            }
+            if (gate->m_module != module && !manager->module_assign_gate(module, gate))
+            {
+                return ERR("failed to move gate '" + record.name + "' with ID " + std::to_string(id) + " back to module with ID " + std::to_string(record.module_id));
+            }
+
+            if (record.is_gnd != m_netlist->is_gnd_gate(gate))
+            {
+                record.is_gnd ? m_netlist->mark_gnd_gate(gate) : m_netlist->unmark_gnd_gate(gate);
+            }
+            if (record.is_vcc != m_netlist->is_vcc_gate(gate))
+            {
+                record.is_vcc ? m_netlist->mark_vcc_gate(gate) : m_netlist->unmark_vcc_gate(gate);
+            }
+        }
+
+        // restore connections, connections that did not exist before are removed first so that the pins they occupy become available again
+        for (const auto& [id, record] : m_nets)
+        {
+            if (!record.existed)
+            {
+                continue;
+            }
+
+            Net* net = find_by_id(m_netlist->m_nets_map, id);
+            for (Endpoint* ep : std::vector<Endpoint*>(net->m_sources_raw))
+            {
+                if (std::find(record.sources.begin(), record.sources.end(), std::make_pair(ep->get_gate()->get_id(), ep->get_pin())) == record.sources.end()
+                    && !manager->net_remove_source(net, ep))
+                {
+                    return ERR("failed to remove source from net '" + record.name + "' with ID " + std::to_string(id));
+                }
+            }
+            for (Endpoint* ep : std::vector<Endpoint*>(net->m_destinations_raw))
+            {
+                if (std::find(record.destinations.begin(), record.destinations.end(), std::make_pair(ep->get_gate()->get_id(), ep->get_pin())) == record.destinations.end()
+                    && !manager->net_remove_destination(net, ep))
+                {
+                    return ERR("failed to remove destination from net '" + record.name + "' with ID " + std::to_string(id));
+                }
+            }
+        }
+
+        for (const auto& [id, record] : m_nets)
+        {
+            if (!record.existed)
+            {
+                continue;
+            }
+
+            Net* net = find_by_id(m_netlist->m_nets_map, id);
+            net->set_name(record.name);
+            static_cast<DataContainer&>(*net) = record.data;
+            manager->search_index_update(net);
+
+            for (const auto& [gate_id, pin] : record.sources)
+            {
+                Gate* gate = find_by_id(m_netlist->m_gates_map, gate_id);
+                if (gate == nullptr || (!net->is_a_source(gate, pin) && manager->net_add_source(net, gate, pin) == nullptr))
+                {
+                    return ERR("failed to add source with gate ID " + std::to_string(gate_id) + " to net '" + record.name + "' with ID " + std::to_string(id));
+                }
+            }
+            for (const auto& [gate_id, pin] : record.destinations)
+            {
+                Gate* gate = find_by_id(m_netlist->m_gates_map, gate_id);
+                if (gate == nullptr || (!net->is_a_destination(gate, pin) && manager->net_add_destination(net, gate, pin) == nullptr))
+                {
+                    return ERR("failed to add destination with gate ID " + std::to_string(gate_id) + " to net '" + record.name + "' with ID " + std::to_string(id));
+                }
+            }
+            restore_endpoint_order(net->m_sources, net->m_sources_raw, record.sources);
+            restore_endpoint_order(net->m_destinations, net->m_destinations_raw, record.destinations);
+
+            if (record.is_global_input != m_netlist->is_global_input_net(net))
+            {
+                record.is_global_input ? m_netlist->mark_global_input_net(net) : m_netlist->unmark_global_input_net(net);
+            }
+            if (record.is_global_output != m_netlist->is_global_output_net(net))
+            {
+                record.is_global_output ? m_netlist->mark_global_output_net(net) : m_netlist->unmark_global_output_net(net);
+            }
+        }
+
+        for (const auto& [id, record] : m_gates)
+        {
+            if (record.existed)
+            {
+                Gate* gate = find_by_id(m_netlist->m_gates_map, id);
+                restore_endpoint_order(gate->m_in_endpoints, gate->m_in_nets, record.fan_in);
+                restore_endpoint_order(gate->m_out_endpoints, gate->m_out_nets, record.fan_out);
+            }
+        }
+
+        // restore groupings and memberships
+        for (const auto& [id, record] : m_groupings)
+        {
+            if (record.existed)
+            {
+                Grouping* grouping = find_by_id(m_netlist->m_groupings_map, id);
+                grouping->set_name(record.name);
+                grouping->set_color(record.color);
+            }
+        }
+        for (const auto& [id, record] : m_gates)
+        {
+            if (record.existed && !restore_grouping(m_netlist, find_by_id(m_netlist->m_gates_map, id), record.grouping_id))
+            {
+                return ERR("failed to restore grouping of gate '" + record.name + "' with ID " + std::to_string(id));
+            }
+        }
+        for (const auto& [id, record] : m_nets)
+        {
+            if (record.existed && !restore_grouping(m_netlist, find_by_id(m_netlist->m_nets_map, id), record.grouping_id))
+            {
+                return ERR("failed to restore grouping of net '" + record.name + "' with ID " + std::to_string(id));
+            }
+        }
+        for (const auto& [id, record] : m_modules)
+        {
+            if (record.existed && !restore_grouping(m_netlist, find_by_id(m_netlist->m_modules_map, id), record.grouping_id))
+            {
+                return ERR("failed to restore grouping of module '" + record.name + "' with ID " + std::to_string(id));
+            }
+        }
+
+        // restore modules
+        for (const auto& [id, record] : m_modules)
+        {
+            if (!record.existed)
+            {
+                continue;
+            }
+
+            Module* module = find_by_id(m_netlist->m_modules_map, id);
+            module->set_name(record.name);
+            module->set_type(record.type);
+            static_cast<DataContainer&>(*module) = record.data;
+
+            for (const auto& [net_id, flags] : record.nets)
+            {
+                if (flags == 0)
+                {
+                    continue;
+                }
+
+                Net* net = find_by_id(m_netlist->m_nets_map, net_id);
+                if (net == nullptr)
+                {
+                    return ERR("failed to restore nets of module '" + record.name + "' with ID " + std::to_string(id) + ": no net with ID " + std::to_string(net_id));
+                }
+                if (flags & MODULE_NET)
+                {
+                    module->m_nets.insert(net);
+                }
+                if (flags & MODULE_INPUT_NET)
+                {
+                    module->m_input_nets.insert(net);
+                }
+                if (flags & MODULE_OUTPUT_NET)
+                {
+                    module->m_output_nets.insert(net);
+                }
+                if (flags & MODULE_INTERNAL_NET)
+                {
+                    module->m_internal_nets.insert(net);
+                }
+            }
+
+            if (record.pins_recorded)
+            {
+                if (auto res = restore_pins(module, record); res.is_error())
+                {
+                    return ERR_APPEND(res.get_error(), "failed to restore pins of module '" + record.name + "' with ID " + std::to_string(id));
+                }
+            }
+            manager->search_index_update(module);
+        }
+
+        // restore netlist properties
+        m_netlist->m_design_name  = m_design_name;
+        m_netlist->m_device_name  = m_device_name;
+        m_netlist->m_file_name    = m_file_name;
+        m_netlist->m_gate_ids     = m_gate_ids;
+        m_netlist->m_net_ids      = m_net_ids;
+        m_netlist->m_module_ids   = m_module_ids;
+        m_netlist->m_grouping_ids = m_grouping_ids;
+
+        manager->clear_caches();
+
+        return OK({});
+    }
+
+    Result<std::monostate> NetlistTransaction::restore_pins(Module* module, const ModuleRecord& record)
+    {
+        // pins and pin groups that still exist are reused so that pointers to them remain valid, they are detached from the module and its pin groups first
+        std::unordered_map<u32, std::unique_ptr<ModulePin>> old_pins;
+        for (auto& pin : module->m_pins)
+        {
+            old_pins.emplace(pin->get_id(), std::move(pin));
+        }
+        std::unordered_map<u32, std::unique_ptr<PinGroup<ModulePin>>> old_pin_groups;
+        for (auto& pin_group : module->m_pin_groups)
+        {
+            // removing the pins back to front does not require to update any index
+            for (auto pins = pin_group->get_pins(); !pins.empty(); pins.pop_back())
+            {
+                if (auto res = pin_group->remove_pin(pins.back()); res.is_error())
+                {
+                    return ERR(res.get_error());
+                }
+            }
+            old_pin_groups.emplace(pin_group->get_id(), std::move(pin_group));
+        }
+
+        module->m_pin_groups_ordered.clear();
+        module->m_pin_groups_map.clear();
+        module->m_pin_group_names_map.clear();
+        module->m_pin_groups.clear();
+        module->m_pins_map.clear();
+        module->m_pin_names_map.clear();
+        module->m_pin_nets_map.clear();
+        module->m_pins.clear();
+        module->m_pin_ids       = IdAllocator();
+        module->m_pin_group_ids = IdAllocator();
+
+        for (const PinGroupRecord& group_record : record.pin_groups)
+        {
+            // the order and indices of a pin group are fixed on creation, a pin group with the same ID but different order has been re-created during the transaction
+            PinGroup<ModulePin>* pin_group = nullptr;
+            if (auto it = old_pin_groups.find(group_record.id);
+                it != old_pin_groups.end() && it->second->is_ascending() == group_record.ascending && it->second->get_start_index() == static_cast<i32>(group_record.start_index))
+            {
+                pin_group = it->second.get();
+                pin_group->set_name(group_record.name);
+                pin_group->set_direction(group_record.direction);
+                pin_group->set_type(group_record.type);
+                module->m_pin_groups.push_back(std::move(it->second));
+                module->m_pin_groups_ordered.push_back(pin_group);
+                module->m_pin_groups_map[group_record.id]        = pin_group;
+                module->m_pin_group_names_map[group_record.name] = pin_group;
+                module->m_pin_group_ids.acquire(group_record.id);
+            }
+            else if (auto group_res = module->create_pin_group_internal(
+                         group_record.id, group_record.name, group_record.direction, group_record.type, group_record.ascending, group_record.start_index, false);
+                     group_res.is_error())
+            {
+                return ERR(group_res.get_error());
+            }
+            else
+            {
+                pin_group = group_res.get();
+            }
+
+            for (const PinRecord& pin_record : group_record.pins)
+            {
+                Net* net = find_by_id(m_netlist->m_nets_map, pin_record.net_id);
+                if (net == nullptr)
+                {
+                    return ERR("failed to restore pin '" + pin_record.name + "' with ID " + std::to_string(pin_record.id) + ": no net with ID " + std::to_string(pin_record.net_id));
+                }
+
+                // the net of a pin never changes, a pin with the same ID but another net has been re-created during the transaction
+                ModulePin* pin = nullptr;
+                if (auto it = old_pins.find(pin_record.id); it != old_pins.end() && it->second->get_net() == net)
+                {
+                    pin = it->second.get();
+                    pin->set_name(pin_record.name);
+                    pin->set_direction(pin_record.direction);
+                    pin->set_type(pin_record.type);
+                    module->m_pins.push_back(std::move(it->second));
+                    module->m_pins_map[pin_record.id]        = pin;
+                    module->m_pin_names_map[pin_record.name] = pin;
+                    module->m_pin_nets_map.emplace(net, pin);
+                    module->m_pin_ids.acquire(pin_record.id);
+                }
+                else if (auto pin_res = module->create_pin_internal(pin_record.id, pin_record.name, net, pin_record.direction, pin_record.type, false); pin_res.is_error())
+                {
+                    return ERR(pin_res.get_error());
+                }
+                else
+                {
+                    pin = pin_res.get();
+                }
+
+                if (auto res = pin_group->assign_pin(pin); res.is_error())
+                {
+                    return ERR(res.get_error());
+                }
+            }
+        }
+
+        module->m_pin_ids           = record.pin_ids;
+        module->m_pin_group_ids     = record.pin_group_ids;
+        module->m_next_input_index  = record.next_input_index;
+        module->m_next_inout_index  = record.next_inout_index;
+        module->m_next_output_index = record.next_output_index;
+
+        m_netlist->m_event_handler->notify(ModuleEvent::event::pin_changed, module);
+
+        return OK({});
+    }
+}    // namespace hal
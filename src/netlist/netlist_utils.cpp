@@ -481,6 +481,9 @@ namespace hal
 
         Result<u32> remove_buffers(Netlist* netlist, bool analyze_inputs)
         {
+            // subscribers are notified about all removals at once
+            EventBatchGuard batch_guard(netlist->get_event_handler());
+
             u32 num_gates = 0;
 
             for (const auto& gate : netlist->get_gates())
@@ -670,6 +673,8 @@ namespace hal
 
         Result<u32> remove_unused_lut_endpoints(Netlist* netlist)
         {
+            EventBatchGuard batch_guard(netlist->get_event_handler());
+
             u32 num_eps = 0;
 
             // net connected to GND
@@ -8,6 +8,7 @@
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/netlist/project_manager.h"
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/trace.h"
 #include "rapidjson/filereadstream.h"
 #include "rapidjson/stringbuffer.h"
 
@@ -632,6 +633,8 @@ namespace hal
             // serialize netlist
             void serialize(const Netlist* nl, rapidjson::Document& document)
             {
+                HAL_TRACE_SCOPE("netlist_serializer::serialize");
+
                 rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
                 rapidjson::Value root(rapidjson::kObjectType);
 
@@ -715,6 +718,8 @@ namespace hal
 
             std::unique_ptr<Netlist> deserialize(const rapidjson::Document& document, GateLibrary* gatelib)
             {
+                HAL_TRACE_SCOPE("netlist_serializer::deserialize");
+
                 if (!document.HasMember("netlist"))
                 {
                     log_error("netlist_persistent", "could not deserialize netlist: file has no 'netlist' node");
@@ -921,6 +926,8 @@ namespace hal
 
         bool serialize_to_file(const Netlist* nl, const std::filesystem::path& hal_file)
         {
+            HAL_TRACE_SCOPE("netlist_serializer::serialize_to_file");
+
             if (nl == nullptr)
             {
                 return false;
@@ -980,6 +987,8 @@ namespace hal
 
         std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& hal_file, GateLibrary* gatelib)
         {
+            HAL_TRACE_SCOPE("netlist_serializer::deserialize_from_file");
+
             auto begin_time = std::chrono::high_resolution_clock::now();
 
             // event_controls::enable_all(false);
@@ -0,0 +1,607 @@
+#include "hal_core/netlist/search_index.h"
+
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_type.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+
+#include <algorithm>
+#include <cctype>
+#include <optional>
+#include <regex>
+
+namespace hal
+{
+    namespace
+    {
+        constexpr u64 FIELD_SHIFT = 40;
+        constexpr u64 KIND_SHIFT  = 32;
+
+        // number of dead terms that is tolerated before the term table gets compacted
+        constexpr size_t MIN_DEAD_TERMS_FOR_COMPACTION = 4096;
+
+        char to_lower(char c)
+        {
+            return (char)std::tolower((unsigned char)c);
+        }
+
+        std::string to_lower(const std::string& str)
+        {
+            std::string res(str.size(), '\0');
+            std::transform(str.begin(), str.end(), res.begin(), [](char c) { return to_lower(c); });
+            return res;
+        }
+
+        std::vector<u32> get_trigrams(const std::string& lower)
+        {
+            std::vector<u32> res;
+            for (size_t i = 0; i + 3 <= lower.size(); i++)
+            {
+                res.push_back(((u32)(u8)lower[i] << 16) | ((u32)(u8)lower[i + 1] << 8) | (u32)(u8)lower[i + 2]);
+            }
+            std::sort(res.begin(), res.end());
+            res.erase(std::unique(res.begin(), res.end()), res.end());
+            return res;
+        }
+
+        /*
+         * Extracts a literal that every string matched by the ECMAScript regular expression contains, or an empty string if none is found.
+         * Errs on the safe side, i.e., groups, classes, alternatives, and optional characters end the literal.
+         */
+        std::string get_regex_literal(const std::string& pattern)
+        {
+            if (pattern.find('|') != std::string::npos)
+            {
+                return "";
+            }
+
+            std::string best;
+            std::string current;
+            auto end_run = [&best, &current]() {
+                if (current.size() > best.size())
+                {
+                    best = current;
+                }
+                current.clear();
+            };
+
+            for (size_t i = 0; i < pattern.size(); i++)
+            {
+                const char c = pattern[i];
+                if (c == '\\')
+                {
+                    if (i + 1 >= pattern.size() || std::isalnum((unsigned char)pattern[i + 1]))
+                    {
+                        // character class or back reference
+                        end_run();
+                    }
+                    else
+                    {
+                        current += pattern[i + 1];
+                    }
+                    i++;
+                }
+                else if (c == '[' || c == '(')
+                {
+                    // skip class or group, they might be optional or match anything
+                    const char close = (c == '[') ? ']' : ')';
+                    u32 depth        = 1;
+                    for (i++; i < pattern.size() && depth > 0; i++)
+                    {
+                        if (pattern[i] == '\\')
+                        {
+                            i++;
+                        }
+                        else if (pattern[i] == c && c == '(')
+                        {
+                            depth++;
+                        }
+                        else if (pattern[i] == close)
+                        {
+                            depth--;
+                        }
+                    }
+                    i--;
+                    end_run();
+                }
+                else if (c == '*' || c == '?' || c == '{')
+                {
+                    // previous character is optional
+                    if (!current.empty())
+                    {
+                        current.pop_back();
+                    }
+                    end_run();
+                    if (c == '{')
+                    {
+                        i = std::min(pattern.find('}', i), pattern.size());
+                    }
+                }
+                else if (c == '+' || c == '.' || c == '^' || c == '$' || c == ')' || c == ']' || c == '}')
+                {
+                    end_run();
+                }
+                else
+                {
+                    current += c;
+                }
+            }
+            end_run();
+            return best;
+        }
+
+        class Matcher
+        {
+        public:
+            static Result<Matcher> create(const std::string& text, bool case_sensitive, bool exact_match, bool regex)
+            {
+                Matcher matcher;
+                matcher.m_case_sensitive = case_sensitive;
+                matcher.m_exact_match    = exact_match;
+                matcher.m_text           = case_sensitive ? text : to_lower(text);
+                if (regex && !exact_match)
+                {
+                    try
+                    {
+                        matcher.m_regex = std::regex(text, case_sensitive ? std::regex::ECMAScript : (std::regex::ECMAScript | std::regex::icase));
+                    }
+                    catch (const std::regex_error& e)
+                    {
+                        return ERR("invalid regular expression '" + text + "': " + e.what());
+                    }
+                    matcher.m_literal = get_regex_literal(text);
+                }
+                else
+                {
+                    matcher.m_literal = text;
+                }
+                return OK(matcher);
+            }
+
+            bool operator()(const std::string& str) const
+            {
+                if (m_regex.has_value())
+                {
+                    return std::regex_search(str, *m_regex);
+                }
+
+                if (m_exact_match)
+                {
+                    return str.size() == m_text.size()
+                           && (m_case_sensitive ? str == m_text : std::equal(str.begin(), str.end(), m_text.begin(), [](char a, char b) { return to_lower(a) == b; }));
+                }
+
+                if (m_case_sensitive)
+                {
+                    return str.find(m_text) != std::string::npos;
+                }
+                return std::search(str.begin(), str.end(), m_text.begin(), m_text.end(), [](char a, char b) { return to_lower(a) == b; }) != str.end();
+            }
+
+            // a string that is contained (ignoring case) in every matching string
+            const std::string& literal() const
+            {
+                return m_literal;
+            }
+
+        private:
+            bool m_case_sensitive = false;
+            bool m_exact_match    = false;
+            std::string m_text;
+            std::string m_literal;
+            std::optional<std::regex> m_regex;
+        };
+
+        template<typename Callback>
+        void for_each_field(const Gate* gate, const Callback& callback)
+        {
+            callback(SearchIndex::Field::name, gate->get_name());
+            for (const auto& [identifier, content] : gate->get_data_map())
+            {
+                callback(SearchIndex::Field::data, std::get<1>(content));
+            }
+        }
+
+        template<typename Callback>
+        void for_each_field(const GateType* gate_type, const Callback& callback)
+        {
+            callback(SearchIndex::Field::type, gate_type->get_name());
+            for (const GatePin* pin : gate_type->get_pins())
+            {
+                callback(SearchIndex::Field::pin, pin->get_name());
+            }
+        }
+
+        template<typename Callback>
+        void for_each_field(const Net* net, const Callback& callback)
+        {
+            callback(SearchIndex::Field::name, net->get_name());
+            for (const auto& [identifier, content] : net->get_data_map())
+            {
+                callback(SearchIndex::Field::data, std::get<1>(content));
+            }
+        }
+
+        template<typename Callback>
+        void for_each_field(const Module* module, const Callback& callback)
+        {
+            callback(SearchIndex::Field::name, module->get_name());
+            callback(SearchIndex::Field::type, module->get_type());
+            for (const auto& [identifier, content] : module->get_data_map())
+            {
+                callback(SearchIndex::Field::data, std::get<1>(content));
+            }
+            for (const ModulePin* pin : module->get_pins())
+            {
+                callback(SearchIndex::Field::pin, pin->get_name());
+            }
+        }
+
+        template<typename T>
+        bool matches(const T* object, const Matcher& matcher, u8 fields)
+        {
+            bool res = false;
+            for_each_field(object, [&res, &matcher, fields](SearchIndex::Field field, const std::string& value) {
+                if (!res && (fields & field) && matcher(value))
+                {
+                    res = true;
+                }
+            });
+            return res;
+        }
+
+        void sort_unique(std::vector<u32>& ids)
+        {
+            std::sort(ids.begin(), ids.end());
+            ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+        }
+    }    // namespace
+
+    SearchIndex::SearchIndex(const Netlist* netlist) : m_netlist(netlist)
+    {
+        for (const Gate* gate : netlist->get_gates())
+        {
+            add_document(((u64)gate_kind << KIND_SHIFT) | gate->get_id());
+        }
+        for (const Net* net : netlist->get_nets())
+        {
+            add_document(((u64)net_kind << KIND_SHIFT) | net->get_id());
+        }
+        for (const Module* module : netlist->get_modules())
+        {
+            add_document(((u64)module_kind << KIND_SHIFT) | module->get_id());
+        }
+    }
+
+    void SearchIndex::invalidate(const Gate* gate)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_dirty.insert(((u64)gate_kind << KIND_SHIFT) | gate->get_id());
+    }
+
+    void SearchIndex::invalidate(const Net* net)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_dirty.insert(((u64)net_kind << KIND_SHIFT) | net->get_id());
+    }
+
+    void SearchIndex::invalidate(const Module* module)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_dirty.insert(((u64)module_kind << KIND_SHIFT) | module->get_id());
+    }
+
+    Result<SearchIndex::Matches> SearchIndex::search(const std::string& text, u8 fields, bool case_sensitive, bool exact_match, bool regex) const
+    {
+        auto matcher_res = Matcher::create(text, case_sensitive, exact_match, regex);
+        if (matcher_res.is_error())
+        {
+            return ERR(matcher_res.get_error());
+        }
+        const Matcher matcher = matcher_res.get();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        update();
+
+        Matches res;
+        std::vector<u32> gate_types;
+        for (u32 term_id : candidate_terms(matcher.literal()))
+        {
+            const Term& term = m_terms[term_id];
+            if (term.postings.empty() || !matcher(term.value))
+            {
+                continue;
+            }
+
+            for (u64 posting : term.postings)
+            {
+                if (!(fields & (u8)(posting >> FIELD_SHIFT)))
+                {
+                    continue;
+                }
+
+                const u32 id = (u32)posting;
+                switch ((Kind)((posting >> KIND_SHIFT) & 0xFF))
+                {
+                    case gate_kind:
+                        res.gates.push_back(id);
+                        break;
+                    case net_kind:
+                        res.nets.push_back(id);
+                        break;
+                    case module_kind:
+                        res.modules.push_back(id);
+                        break;
+                    case gate_type_kind:
+                        gate_types.push_back(id);
+                        break;
+                }
+            }
+        }
+
+        sort_unique(gate_types);
+        for (u32 gate_type_id : gate_types)
+        {
+            const auto& gates = m_gates_by_type.at(gate_type_id);
+            res.gates.insert(res.gates.end(), gates.begin(), gates.end());
+        }
+
+        sort_unique(res.gates);
+        sort_unique(res.nets);
+        sort_unique(res.modules);
+        return OK(res);
+    }
+
+    Result<SearchIndex::Matches> SearchIndex::scan(const Netlist* netlist, const std::string& text, u8 fields, bool case_sensitive, bool exact_match, bool regex)
+    {
+        auto matcher_res = Matcher::create(text, case_sensitive, exact_match, regex);
+        if (matcher_res.is_error())
+        {
+            return ERR(matcher_res.get_error());
+        }
+        const Matcher matcher = matcher_res.get();
+
+        Matches res;
+        std::unordered_map<const GateType*, bool> gate_type_matches;
+        for (const Gate* gate : netlist->get_gates())
+        {
+            auto [it, inserted] = gate_type_matches.try_emplace(gate->get_type(), false);
+            if (inserted)
+            {
+                it->second = matches(gate->get_type(), matcher, fields);
+            }
+            if (it->second || matches(gate, matcher, fields))
+            {
+                res.gates.push_back(gate->get_id());
+            }
+        }
+        for (const Net* net : netlist->get_nets())
+        {
+            if (matches(net, matcher, fields))
+            {
+                res.nets.push_back(net->get_id());
+            }
+        }
+        for (const Module* module : netlist->get_modules())
+        {
+            if (matches(module, matcher, fields))
+            {
+                res.modules.push_back(module->get_id());
+            }
+        }
+
+        sort_unique(res.gates);
+        sort_unique(res.nets);
+        sort_unique(res.modules);
+        return OK(res);
+    }
+
+    size_t SearchIndex::size() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        update();
+        return m_terms.size() - m_num_dead_terms;
+    }
+
+    void SearchIndex::update() const
+    {
+        for (u64 key : m_dirty)
+        {
+            remove_document(key);
+            add_document(key);
+        }
+        m_dirty.clear();
+
+        if (m_num_dead_terms >= MIN_DEAD_TERMS_FOR_COMPACTION && 2 * m_num_dead_terms > m_terms.size())
+        {
+            compact();
+        }
+    }
+
+    void SearchIndex::add_document(u64 key) const
+    {
+        const u32 id   = (u32)key;
+        const u8 kind  = (u8)(key >> KIND_SHIFT);
+        Document doc;
+        auto callback = [this, &doc, key](Field field, const std::string& value) { add_term(doc, key, field, value); };
+
+        if (kind == gate_kind)
+        {
+            const Gate* gate = m_netlist->get_gate_by_id(id);
+            if (gate == nullptr)
+            {
+                return;
+            }
+            for_each_field(gate, callback);
+
+            // type and pins are shared by all gates of a type and therefore indexed only once
+            const GateType* gate_type = gate->get_type();
+            doc.gate_type_id          = gate_type->get_id();
+            auto& gates               = m_gates_by_type[doc.gate_type_id];
+            if (gates.empty())
+            {
+                const u64 type_key = ((u64)gate_type_kind << KIND_SHIFT) | doc.gate_type_id;
+                Document type_doc;
+                for_each_field(gate_type, [this, &type_doc, type_key](Field field, const std::string& value) { add_term(type_doc, type_key, field, value); });
+                m_documents[type_key] = std::move(type_doc);
+            }
+            gates.insert(id);
+        }
+        else if (kind == net_kind)
+        {
+            const Net* net = m_netlist->get_net_by_id(id);
+            if (net == nullptr)
+            {
+                return;
+            }
+            for_each_field(net, callback);
+        }
+        else if (kind == module_kind)
+        {
+            const Module* module = m_netlist->get_module_by_id(id);
+            if (module == nullptr)
+            {
+                return;
+            }
+            for_each_field(module, callback);
+        }
+
+        m_documents[key] = std::move(doc);
+    }
+
+    void SearchIndex::remove_document(u64 key) const
+    {
+        auto it = m_documents.find(key);
+        if (it == m_documents.end())
+        {
+            return;
+        }
+
+        for (const auto& [term_id, field] : it->second.terms)
+        {
+            Term& term = m_terms[term_id];
+            term.postings.erase(key | ((u64)field << FIELD_SHIFT));
+            if (term.postings.empty())
+            {
+                // dead terms remain in the trigram index and are revived if the string is added again
+                m_num_dead_terms++;
+            }
+        }
+
+        const u32 gate_type_id = it->second.gate_type_id;
+        const bool is_gate     = (u8)(key >> KIND_SHIFT) == gate_kind;
+        m_documents.erase(it);
+
+        if (is_gate)
+        {
+            auto& gates = m_gates_by_type[gate_type_id];
+            gates.erase((u32)key);
+            if (gates.empty())
+            {
+                release_gate_type(gate_type_id);
+            }
+        }
+    }
+
+    void SearchIndex::release_gate_type(u32 gate_type_id) const
+    {
+        m_gates_by_type.erase(gate_type_id);
+        remove_document(((u64)gate_type_kind << KIND_SHIFT) | gate_type_id);
+    }
+
+    void SearchIndex::add_term(Document& doc, u64 key, Field field, const std::string& value) const
+    {
+        if (value.empty())
+        {
+            return;
+        }
+
+        auto [it, inserted] = m_term_ids.try_emplace(value, (u32)m_terms.size());
+        const u32 term_id   = it->second;
+        if (inserted)
+        {
+            m_terms.push_back({value, {}});
+            for (u32 trigram : get_trigrams(to_lower(value)))
+            {
+                m_trigrams[trigram].push_back(term_id);
+            }
+        }
+
+        Term& term = m_terms[term_id];
+        if (!inserted && term.postings.empty())
+        {
+            m_num_dead_terms--;
+        }
+        if (term.postings.insert(key | ((u64)field << FIELD_SHIFT)).second)
+        {
+            doc.terms.emplace_back(term_id, (u8)field);
+        }
+    }
+
+    void SearchIndex::compact() const
+    {
+        std::vector<u32> new_ids(m_terms.size(), 0);
+        std::vector<Term> terms;
+        terms.reserve(m_terms.size() - m_num_dead_terms);
+        m_term_ids.clear();
+        m_trigrams.clear();
+        for (u32 term_id = 0; term_id < m_terms.size(); term_id++)
+        {
+            Term& term = m_terms[term_id];
+            if (term.postings.empty())
+            {
+                continue;
+            }
+
+            new_ids[term_id] = (u32)terms.size();
+            m_term_ids.emplace(term.value, new_ids[term_id]);
+            for (u32 trigram : get_trigrams(to_lower(term.value)))
+            {
+                m_trigrams[trigram].push_back(new_ids[term_id]);
+            }
+            terms.push_back(std::move(term));
+        }
+        m_terms = std::move(terms);
+        m_num_dead_terms = 0;
+
+        for (auto& [key, doc] : m_documents)
+        {
+            for (auto& term : doc.terms)
+            {
+                term.first = new_ids[term.first];
+            }
+        }
+    }
+
+    std::vector<u32> SearchIndex::candidate_terms(const std::string& literal) const
+    {
+        const std::vector<u32> trigrams = get_trigrams(to_lower(literal));
+        if (trigrams.empty())
+        {
+            // too short for the trigram index, all strings have to be checked
+            std::vector<u32> res(m_terms.size());
+            for (u32 term_id = 0; term_id < m_terms.size(); term_id++)
+            {
+                res[term_id] = term_id;
+            }
+            return res;
+        }
+
+        // every string containing the literal contains all of its trigrams, so the shortest posting list suffices
+        const std::vector<u32>* shortest = nullptr;
+        for (u32 trigram : trigrams)
+        {
+            auto it = m_trigrams.find(trigram);
+            if (it == m_trigrams.end())
+            {
+                return {};
+            }
+            if (shortest == nullptr || it->second.size() < shortest->size())
+            {
+                shortest = &it->second;
+            }
+        }
+        return *shortest;
+    }
+}    // namespace hal
@@ -300,7 +300,7 @@ namespace hal
                 case FacExtensionInterface::FacGatelibParser:
                 {
                     FacFactoryProvider<GateLibraryParser>* fac = static_cast<FacFactoryProvider<GateLibraryParser>*>(feif->factory_provider);
-                    gate_library_parser_manager::register_parser(feif->get_description(), fac->m_factory, feif->get_supported_file_extensions());
+                    gate_library_parser_manager::register_parser(feif->get_description(), fac->m_factory, feif->get_supported_file_extensions(), instance->get_version());
                     break;
                 }
                 case FacExtensionInterface::FacGatelibWriter:
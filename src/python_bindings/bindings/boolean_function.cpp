@@ -1261,7 +1261,7 @@ namespace hal
             :rtype: hal_py.BooleanFunction
         )");
 
-        py_boolean_function.def("simplify", &BooleanFunction::simplify, R"(
+        py_boolean_function.def("simplify", &BooleanFunction::simplify, py::call_guard<py::gil_scoped_release>(), R"(
             Simplifies the Boolean function.
 
             :returns: The simplified Boolean function.
@@ -1403,6 +1403,7 @@ namespace hal
             },
             py::arg("ordered_variables")        = std::vector<std::string>(),
             py::arg("remove_unknown_variables") = false,
+            py::call_guard<py::gil_scoped_release>(),
             R"(
             Computes the truth table outputs for a Boolean function that comprises <= 10 single-bit variables.
 
@@ -0,0 +1,90 @@
+#include "hal_core/netlist/event_system/event_handler.h"
+
+#include "hal_core/python_bindings/python_bindings.h"
+
+namespace hal
+{
+    void event_handler_init(py::module& m)
+    {
+        py::class_<EventHandler, RawPtrWrapper<EventHandler>> py_event_handler(m, "EventHandler", R"(
+            The event handler of a netlist, which notifies subscribers about modifications of the netlist.
+            While batched delivery is enabled, events are queued and delivered at once to batch callbacks, e.g., to speed up bulk modifications of netlists that are shown in the GUI.
+        )");
+
+        py_event_handler.def_property("batching_enabled", &EventHandler::is_batching_enabled, &EventHandler::set_batching_enabled, R"(
+            ``True`` if batched delivery of events is enabled, ``False`` otherwise.
+            Disabling batched delivery delivers all queued events.
+
+            :type: bool
+        )");
+
+        py_event_handler.def("set_batching_enabled", &EventHandler::set_batching_enabled, py::arg("flag"), R"(
+            Enable or disable batched delivery of events.
+            While enabled, events are queued and delivered in order to the registered batch callbacks on flush.
+            Disabling batched delivery delivers all queued events.
+
+            :param bool flag: ``True`` to enable, ``False`` to disable.
+        )");
+
+        py_event_handler.def("is_batching_enabled", &EventHandler::is_batching_enabled, R"(
+            Check whether batched delivery of events is enabled.
+
+            :returns: ``True`` if enabled, ``False`` otherwise.
+            :rtype: bool
+        )");
+
+        py_event_handler.def("flush", &EventHandler::flush, R"(
+            Deliver all queued events to the registered batch callbacks.
+            Does nothing if no events are queued.
+        )");
+
+        py_event_handler.def(
+            "register_batch_callback",
+            [](EventHandler& self, const std::string& name, const std::function<void(const py::list&)>& callback) {
+                self.register_batch_callback(name, [callback](const EventBatch& batch) {
+                    py::gil_scoped_acquire acquire;
+                    py::list events;
+                    for (const EventBatch::Entry& entry : batch.events)
+                    {
+                        if (const auto* e = std::get_if<EventBatch::Event<NetlistEvent::event, Netlist>>(&entry))
+                        {
+                            events.append(py::make_tuple("netlist", enum_to_string(e->event), RawPtrWrapper<Netlist>(e->object), e->associated_data));
+                        }
+                        else if (const auto* e = std::get_if<EventBatch::Event<ModuleEvent::event, Module>>(&entry))
+                        {
+                            events.append(py::make_tuple("module", enum_to_string(e->event), py::cast(e->object, py::return_value_policy::reference), e->associated_data));
+                        }
+                        else if (const auto* e = std::get_if<EventBatch::Event<GateEvent::event, Gate>>(&entry))
+                        {
+                            events.append(py::make_tuple("gate", enum_to_string(e->event), py::cast(e->object, py::return_value_policy::reference), e->associated_data));
+                        }
+                        else if (const auto* e = std::get_if<EventBatch::Event<NetEvent::event, Net>>(&entry))
+                        {
+                            events.append(py::make_tuple("net", enum_to_string(e->event), py::cast(e->object, py::return_value_policy::reference), e->associated_data));
+                        }
+                        else if (const auto* e = std::get_if<EventBatch::Event<GroupingEvent::event, Grouping>>(&entry))
+                        {
+                            events.append(py::make_tuple("grouping", enum_to_string(e->event), py::cast(e->object, py::return_value_policy::reference), e->associated_data));
+                        }
+                    }
+                    callback(events);
+                });
+            },
+            py::arg("name"),
+            py::arg("callback"),
+            R"(
+            Register a batch callback function.
+            The callback is called with the list of coalesced events of each delivered batch, each event being a tuple of the object type (e.g., ``'gate'``), the name of the event (e.g., ``'removed'``), the affected object, and the associated data of the event.
+            Removed objects are still alive while the batch is delivered, but must not be used afterwards.
+
+            :param str name: The name of the callback, used for callback removal.
+            :param callable callback: The callback function.
+        )");
+
+        py_event_handler.def("unregister_callback", &EventHandler::unregister_callback, py::arg("name"), R"(
+            Remove all callback functions registered under the given name.
+
+            :param str name: The name of the callback.
+        )");
+    }
+}    // namespace hal
@@ -13,16 +13,19 @@ namespace hal
             [](std::filesystem::path file_path, bool reload) { return RawPtrWrapper<GateLibrary>(gate_library_manager::load(file_path, reload)); },
             py::arg("file_path"),
             py::arg("reload") = false,
+            py::call_guard<py::gil_scoped_release>(),
             R"(
             Load a gate library from file.
+            If the gate library cache is enabled, a valid cache file of the source file within the per-user cache directory is used instead of parsing the source file.
+            After parsing, the cache file is (re-)created if possible.
 
             :param pathlib.Path file_path: The input path.
-            :param bool reload: If true, reloads the library in case it is already loaded.
+            :param bool reload: If true, reloads the library from its source file in case it is already loaded, ignoring any cache file.
             :returns: The gate library on success, None otherwise.
             :rtype: hal_py.GateLibrary or None
         )");
 
-        py_gate_library_manager.def("load_all", &gate_library_manager::load_all, py::arg("reload") = false, R"(
+        py_gate_library_manager.def("load_all", &gate_library_manager::load_all, py::arg("reload") = false, py::call_guard<py::gil_scoped_release>(), R"(
             Load all gate libraries available in standard gate library directories.
 
             :param bool reload: If true, reloads all libraries that have already been loaded.
@@ -52,13 +55,28 @@ namespace hal
             [](const std::string& lib_name) { return RawPtrWrapper<GateLibrary>(gate_library_manager::get_gate_library_by_name(lib_name)); },
             py::arg("lib_name"),
             R"(
-            Get a gate library by name. If no library with the given name is loaded, None will be returned.
+            Get a gate library by name. If no library with the given name is loaded, the libraries within the standard gate library directories are loaded lazily until one with the given name is found.
+            Valid cache files are used to identify the matching library without parsing any of the other libraries.
+            If no such library exists, None will be returned.
 
             :param str lib_name: The name of the gate library.
             :returns: The gate library on success, None otherwise.
             :rtype: hal_py.GateLibrary or None
         )");
 
+        py_gate_library_manager.def("set_cache_enabled", &gate_library_manager::set_cache_enabled, py::arg("enable"), R"(
+            Enable or disable the binary gate library cache used when loading gate libraries. The cache is enabled by default.
+
+            :param bool enable: True to enable the cache, false to disable it.
+        )");
+
+        py_gate_library_manager.def("is_cache_enabled", &gate_library_manager::is_cache_enabled, R"(
+            Check whether the binary gate library cache is enabled.
+
+            :returns: True if the cache is enabled, false otherwise.
+            :rtype: bool
+        )");
+
         py_gate_library_manager.def(
             "get_gate_libraries",
             [] {
@@ -883,6 +883,33 @@ namespace hal
             :rtype: bool
         )");
 
+        py_module.def(
+            "reorder_pins_within_group",
+            [](Module& self, PinGroup<ModulePin>* pin_group, const std::vector<ModulePin*>& pins) {
+                auto res = self.reorder_pins_within_group(pin_group, pins);
+                if (res.is_ok())
+                {
+                    return true;
+                }
+                else
+                {
+                    log_error("python_context", "error encountered while reordering pins within pin group:\n{}", res.get_error().get());
+                    return false;
+                }
+            },
+            py::arg("pin_group"),
+            py::arg("pins"),
+            R"(
+            Reorder all pins of the given pin group at once.
+            The pins must be a permutation of the pins of the pin group, the first pin is assigned the start index of the group.
+            Other than repeated calls to ``hal_py.Module.move_pin_within_group``, only a single event is issued.
+
+            :param hal_py.ModulePinGroup pin_group: The pin group.
+            :param list[hal_py.ModulePin] pins: The pins of the pin group in their new order.
+            :returns: ``True`` on success, ``False`` otherwise.
+            :rtype: bool
+        )");
+
         py_module.def(
             "remove_pin_from_group",
             [](Module& self, PinGroup<ModulePin>* pin_group, ModulePin* pin, bool delete_empty_groups = true) {
@@ -4,6 +4,16 @@ namespace hal
 {
     void netlist_init(py::module& m)
     {
+        py::enum_<SearchIndex::Field>(m, "SearchField", py::arithmetic(), R"(
+            The properties of gates, nets, and modules that can be searched using hal_py.Netlist.search. Fields can be combined using bitwise OR.
+        )")
+            .value("name", SearchIndex::Field::name, R"(The name of the object.)")
+            .value("type", SearchIndex::Field::type, R"(The type of a gate or module.)")
+            .value("data", SearchIndex::Field::data, R"(The values stored in the data container of the object.)")
+            .value("pin", SearchIndex::Field::pin, R"(The pin names of a gate or module.)")
+            .value("all", SearchIndex::Field::all, R"(All of the above.)")
+            .export_values();
+
         py::class_<Netlist, std::shared_ptr<Netlist>> py_netlist(m, "Netlist", R"(
             Netlist class containing information about the netlist including its gates, modules, nets, and groupings as well as the underlying gate library.
         )");
@@ -125,6 +135,21 @@ namespace hal
             :rtype: hal_py.GateLibrary
         )");
 
+        py_netlist.def_property_readonly(
+            "event_handler", [](Netlist* nl) { return RawPtrWrapper<EventHandler>(nl->get_event_handler()); }, R"(
+            The event handler of the netlist.
+
+            :type: hal_py.EventHandler
+        )");
+
+        py_netlist.def(
+            "get_event_handler", [](Netlist* nl) { return RawPtrWrapper<EventHandler>(nl->get_event_handler()); }, R"(
+            Get the event handler of the netlist, e.g., to enable batched delivery of events during bulk modifications.
+
+            :returns: The event handler.
+            :rtype: hal_py.EventHandler
+        )");
+
         py_netlist.def(
             "copy",
             [](Netlist* nl) -> std::shared_ptr<Netlist> {
@@ -146,6 +171,81 @@ namespace hal
             :rtype: hal_py.Netlist
         )");
 
+        py_netlist.def("enable_name_index", &Netlist::enable_name_index, py::arg("enable"), R"(
+            Enable or disable the name index of the netlist.
+            While enabled, the name index is automatically kept up to date whenever gates, nets, or modules are created, removed, or renamed and speeds up name-based lookups such as get_gates_by_name.
+            Enabling the index builds it from all current gates, nets, and modules; disabling it frees its memory.
+            The name index is disabled by default.
+
+            :param bool enable: True to enable the name index, False to disable it.
+        )");
+
+        py_netlist.def("is_name_index_enabled", &Netlist::is_name_index_enabled, R"(
+            Check whether the name index of the netlist is enabled.
+
+            :returns: True if the name index is enabled, False otherwise.
+            :rtype: bool
+        )");
+
+        py_netlist.def("enable_search_index", &Netlist::enable_search_index, py::arg("enable"), R"(
+            Enable or disable the full-text search index of the netlist.
+            While enabled, gates, nets, and modules are reindexed whenever they are created, removed, renamed, or their type, data, or pins change, which speeds up search.
+            Enabling the index builds it from all current gates, nets, and modules; disabling it frees its memory.
+            The search index is disabled by default.
+
+            :param bool enable: True to enable the search index, False to disable it.
+        )");
+
+        py_netlist.def("is_search_index_enabled", &Netlist::is_search_index_enabled, R"(
+            Check whether the full-text search index of the netlist is enabled.
+
+            :returns: True if the search index is enabled, False otherwise.
+            :rtype: bool
+        )");
+
+        py_netlist.def(
+            "search",
+            [](const Netlist& self, const std::string& text, u8 fields, bool case_sensitive, bool exact_match, bool regex) -> std::optional<std::tuple<py::set, py::set, py::set>> {
+                auto res = self.search(text, fields, case_sensitive, exact_match, regex);
+                if (res.is_error())
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return std::nullopt;
+                }
+
+                const SearchIndex::Matches& matches = res.get();
+                auto to_set                         = [](const std::vector<u32>& ids) {
+                    py::set ids_set;
+                    for (u32 id : ids)
+                    {
+                        ids_set.add(id);
+                    }
+                    return ids_set;
+                };
+                return std::make_tuple(to_set(matches.gates), to_set(matches.nets), to_set(matches.modules));
+            },
+            py::arg("text"),
+            py::arg("fields")         = (u8)SearchIndex::Field::all,
+            py::arg("case_sensitive") = false,
+            py::arg("exact_match")    = false,
+            py::arg("regex")          = false,
+            R"(
+            Search for all gates, nets, and modules with at least one of the given fields matching the text.
+            By default, a field matches if it contains the text as a substring.
+            If exact_match is set, the field must be equal to the text instead.
+            If regex is set, the text is interpreted as an ECMAScript regular expression that has to match any part of the field.
+            If both are set, exact_match takes precedence.
+            Uses the search index if it is enabled, otherwise all gates, nets, and modules are searched.
+
+            :param str text: The text to search for.
+            :param int fields: The fields to search as a combination of hal_py.SearchField values. Defaults to all fields.
+            :param bool case_sensitive: Set True to match case-sensitively, False otherwise. Defaults to False.
+            :param bool exact_match: Set True to match the whole field, False otherwise. Defaults to False.
+            :param bool regex: Set True to interpret the text as a regular expression, False otherwise. Defaults to False.
+            :returns: A tuple of the sets of IDs of the matching gates, nets, and modules on success, None if the regular expression is invalid.
+            :rtype: tuple(set[int],set[int],set[int]) or None
+        )");
+
         py_netlist.def("clear_caches", &Netlist::clear_caches, R"(
             Clear all internal caches of the netlist.
             In a typical application, calling this function is not required.
@@ -244,6 +344,37 @@ namespace hal
             :rtype: list[hal_py.Gate]
         )");
 
+        py_netlist.def("get_gates_by_name", &Netlist::get_gates_by_name, py::arg("name"), R"(
+            Get all gates with exactly the given name, ordered by ID.
+            Uses the name index if it is enabled, otherwise all gates are searched.
+
+            :param str name: The name of the gate.
+            :returns: A list of gates.
+            :rtype: list[hal_py.Gate]
+        )");
+
+        py_netlist.def("get_gates_by_name_prefix", &Netlist::get_gates_by_name_prefix, py::arg("prefix"), R"(
+            Get all gates whose name starts with the given prefix, ordered by name and then by ID.
+            Uses the name index if it is enabled, otherwise all gates are searched.
+
+            :param str prefix: The name prefix.
+            :returns: A list of gates.
+            :rtype: list[hal_py.Gate]
+        )");
+
+        py_netlist.def("get_gates_by_hierarchy", &Netlist::get_gates_by_hierarchy, py::arg("path"), py::arg("separator") = "/", py::arg("recursive") = true, R"(
+            Get all gates within the given hierarchical scope, ordered by name and then by ID.
+            A gate is within the scope if its name is made up of the hierarchical path, followed by the separator and a (hierarchical) name, e.g., gate 'cpu/alu/add_0' is within scope 'cpu/alu' and, recursively, within scope 'cpu'.
+            An empty path refers to the root scope.
+            Uses the name index if it is enabled, otherwise all gates are searched.
+
+            :param str path: The hierarchical path of the scope.
+            :param str separator: The hierarchy separator. Defaults to '/'.
+            :param bool recursive: Set True to include gates within nested scopes, False otherwise. Defaults to True.
+            :returns: A list of gates.
+            :rtype: list[hal_py.Gate]
+        )");
+
         py_netlist.def("mark_vcc_gate", &Netlist::mark_vcc_gate, py::arg("gate"), R"(
             Mark a gate as global VCC gate.
 
@@ -392,6 +523,37 @@ namespace hal
             :rtype: list[hal_py.Net]
         )");
 
+        py_netlist.def("get_nets_by_name", &Netlist::get_nets_by_name, py::arg("name"), R"(
+            Get all nets with exactly the given name, ordered by ID.
+            Uses the name index if it is enabled, otherwise all nets are searched.
+
+            :param str name: The name of the net.
+            :returns: A list of nets.
+            :rtype: list[hal_py.Net]
+        )");
+
+        py_netlist.def("get_nets_by_name_prefix", &Netlist::get_nets_by_name_prefix, py::arg("prefix"), R"(
+            Get all nets whose name starts with the given prefix, ordered by name and then by ID.
+            Uses the name index if it is enabled, otherwise all nets are searched.
+
+            :param str prefix: The name prefix.
+            :returns: A list of nets.
+            :rtype: list[hal_py.Net]
+        )");
+
+        py_netlist.def("get_nets_by_hierarchy", &Netlist::get_nets_by_hierarchy, py::arg("path"), py::arg("separator") = "/", py::arg("recursive") = true, R"(
+            Get all nets within the given hierarchical scope, ordered by name and then by ID.
+            A net is within the scope if its name is made up of the hierarchical path, followed by the separator and a (hierarchical) name, e.g., net 'cpu/alu/add_0' is within scope 'cpu/alu' and, recursively, within scope 'cpu'.
+            An empty path refers to the root scope.
+            Uses the name index if it is enabled, otherwise all nets are searched.
+
+            :param str path: The hierarchical path of the scope.
+            :param str separator: The hierarchy separator. Defaults to '/'.
+            :param bool recursive: Set True to include nets within nested scopes, False otherwise. Defaults to True.
+            :returns: A list of nets.
+            :rtype: list[hal_py.Net]
+        )");
+
         py_netlist.def("mark_global_input_net", &Netlist::mark_global_input_net, py::arg("net"), R"(
             Mark a net as a global input net.
 
@@ -563,6 +725,37 @@ namespace hal
             :rtype: list[hal_py.Module]
         )");
 
+        py_netlist.def("get_modules_by_name", &Netlist::get_modules_by_name, py::arg("name"), R"(
+            Get all modules with exactly the given name, ordered by ID.
+            Uses the name index if it is enabled, otherwise all modules are searched.
+
+            :param str name: The name of the module.
+            :returns: A list of modules.
+            :rtype: list[hal_py.Module]
+        )");
+
+        py_netlist.def("get_modules_by_name_prefix", &Netlist::get_modules_by_name_prefix, py::arg("prefix"), R"(
+            Get all modules whose name starts with the given prefix, ordered by name and then by ID.
+            Uses the name index if it is enabled, otherwise all modules are searched.
+
+            :param str prefix: The name prefix.
+            :returns: A list of modules.
+            :rtype: list[hal_py.Module]
+        )");
+
+        py_netlist.def("get_modules_by_hierarchy", &Netlist::get_modules_by_hierarchy, py::arg("path"), py::arg("separator") = "/", py::arg("recursive") = true, R"(
+            Get all modules within the given hierarchical scope, ordered by name and then by ID.
+            A module is within the scope if its name is made up of the hierarchical path, followed by the separator and a (hierarchical) name, e.g., module 'cpu/alu/add_0' is within scope 'cpu/alu' and, recursively, within scope 'cpu'.
+            An empty path refers to the root scope.
+            Uses the name index if it is enabled, otherwise all modules are searched.
+
+            :param str path: The hierarchical path of the scope.
+            :param str separator: The hierarchy separator. Defaults to '/'.
+            :param bool recursive: Set True to include modules within nested scopes, False otherwise. Defaults to True.
+            :returns: A list of modules.
+            :rtype: list[hal_py.Module]
+        )");
+
         py_netlist.def_property_readonly("top_module", &Netlist::get_top_module, R"(
             The top module of the netlist.
 
@@ -811,6 +1004,14 @@ namespace hal
             :param set[int] ids: All freed grouping IDs.
         )");
 
+        py_netlist.def("reserve_ids", &Netlist::reserve_ids, py::arg("other"), R"(
+            Reserve all gate, net, module, and grouping IDs that have ever been assigned within another netlist.
+            Afterwards, new elements of this netlist are assigned IDs above the highest ID ever assigned within the other netlist, except for IDs freed within this netlist, which are still handed out first.
+            Only the next IDs are updated, so this takes constant time regardless of the number of IDs of the other netlist.
+
+            :param hal_py.Netlist other: The netlist whose IDs to reserve.
+        )");
+
         py_netlist.def(
             "load_gate_locations_from_data", &Netlist::load_gate_locations_from_data, py::arg("data_category") = std::string(), py::arg("data_identifiers") = std::pair<std::string, std::string>(), R"(
             Load the locations of the gates in the netlist from their associated data using the specified category and identifier.
@@ -21,6 +21,7 @@ namespace hal
                 },
                 py::arg("hdl_file"),
                 py::arg("gate_library_file") = "",
+                py::call_guard<py::gil_scoped_release>(),
                 R"(
                 Create a netlist from the given file using the specified gate library file.
 
@@ -50,6 +51,7 @@ namespace hal
                     return result;
                 },
                 py::arg("hdl_file"),
+                py::call_guard<py::gil_scoped_release>(),
                 R"(
                 Create a netlist from a given file for each matching pre-loaded gate library.
 
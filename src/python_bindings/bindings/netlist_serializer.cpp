@@ -8,7 +8,7 @@ namespace hal
             HAL Netlist Serializer functions.
         )");
 
-        py_netlist_serializer.def("serialize_to_file", netlist_serializer::serialize_to_file, py::arg("netlist"), py::arg("hal_file"), R"(
+        py_netlist_serializer.def("serialize_to_file", netlist_serializer::serialize_to_file, py::arg("netlist"), py::arg("hal_file"), py::call_guard<py::gil_scoped_release>(), R"(
             Serializes a netlist into a ``.hal`` file.
         
             :param hal_py.Netlist netlist: The netlist to serialize.
@@ -22,6 +22,7 @@ namespace hal
             [](const std::filesystem::path& hal_file, GateLibrary* gate_lib = nullptr) { return std::shared_ptr<Netlist>(netlist_serializer::deserialize_from_file(hal_file, gate_lib)); },
             py::arg("hal_file"),
             py::arg("gate_lib") = nullptr,
+            py::call_guard<py::gil_scoped_release>(),
             R"(
                 Deserializes a netlist from a ``.hal`` file using the provided gate library.
                 If no gate library is provided, a gate library path must be specified within the ``.hal`` file.
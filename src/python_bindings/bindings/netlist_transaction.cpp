@@ -0,0 +1,103 @@
+#include "hal_core/netlist/netlist_transaction.h"
+
+#include "hal_core/python_bindings/python_bindings.h"
+
+namespace hal
+{
+    void netlist_transaction_init(py::module& m)
+    {
+        py::class_<NetlistTransaction> py_netlist_transaction(m, "NetlistTransaction", R"(
+            A transaction allows to apply tentative modifications to a netlist and to either keep or revert them afterwards, e.g., to evaluate what-if transformations without copying the netlist.
+            The original state of every gate, net, module, and grouping is recorded right before the object is modified for the first time, hence discarding is proportional to the number of modified objects.
+            Transactions may be nested, but only the most recently started transaction that is still active may be committed or discarded.
+            When used in a ``with`` statement, the transaction is discarded on exit unless it has been committed before, e.g., ``with hal_py.NetlistTransaction(netlist) as t: ...``.
+        )");
+
+        py_netlist_transaction.def(py::init<Netlist*>(), py::arg("netlist"), py::keep_alive<1, 2>(), R"(
+            Start a new transaction on the given netlist.
+
+            :param hal_py.Netlist netlist: The netlist.
+        )");
+
+        py_netlist_transaction.def(
+            "__enter__", [](NetlistTransaction& self) -> NetlistTransaction& { return self; }, py::return_value_policy::reference);
+
+        py_netlist_transaction.def("__exit__", [](NetlistTransaction& self, const py::object&, const py::object&, const py::object&) {
+            if (self.is_active())
+            {
+                if (auto res = self.discard(); res.is_error())
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                }
+            }
+        });
+
+        py_netlist_transaction.def_property_readonly("netlist", &NetlistTransaction::get_netlist, R"(
+            The netlist the transaction operates on.
+
+            :type: hal_py.Netlist
+        )");
+
+        py_netlist_transaction.def("get_netlist", &NetlistTransaction::get_netlist, R"(
+            Get the netlist the transaction operates on.
+
+            :returns: The netlist.
+            :rtype: hal_py.Netlist
+        )");
+
+        py_netlist_transaction.def_property_readonly("active", &NetlistTransaction::is_active, R"(
+            ``True`` if the transaction has neither been committed nor discarded yet, ``False`` otherwise.
+
+            :type: bool
+        )");
+
+        py_netlist_transaction.def("is_active", &NetlistTransaction::is_active, R"(
+            Check whether the transaction has neither been committed nor discarded yet.
+
+            :returns: ``True`` if the transaction is active, ``False`` otherwise.
+            :rtype: bool
+        )");
+
+        py_netlist_transaction.def("get_num_recorded_objects", &NetlistTransaction::get_num_recorded_objects, R"(
+            Get the number of gates, nets, modules, and groupings whose original state has been recorded so far, i.e., that have been created, modified, or deleted during the transaction.
+
+            :returns: The number of recorded objects.
+            :rtype: int
+        )");
+
+        py_netlist_transaction.def(
+            "commit",
+            [](NetlistTransaction& self) -> bool {
+                if (auto res = self.commit(); res.is_error())
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return false;
+                }
+                return true;
+            },
+            R"(
+            Keep all modifications made during the transaction.
+
+            :returns: ``True`` on success, ``False`` otherwise.
+            :rtype: bool
+        )");
+
+        py_netlist_transaction.def(
+            "discard",
+            [](NetlistTransaction& self) -> bool {
+                if (auto res = self.discard(); res.is_error())
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return false;
+                }
+                return true;
+            },
+            R"(
+            Revert all modifications made during the transaction.
+            Python objects referring to gates, nets, modules, or groupings that have been deleted and restored by discarding become invalid.
+
+            :returns: ``True`` on success, ``False`` otherwise.
+            :rtype: bool
+        )");
+    }
+}    // namespace hal
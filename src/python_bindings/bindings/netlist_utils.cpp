@@ -24,6 +24,7 @@ namespace hal
             },
             py::arg("net"),
             py::arg("subgraph_gates"),
+            py::call_guard<py::gil_scoped_release>(),
             R"(
             Get the combined Boolean function of a subgraph of combinational gates starting at the source of the given net.
             The variables of the resulting Boolean function are made up of the IDs of the nets that influence the output ('net_[ID]').
@@ -35,7 +36,7 @@ namespace hal
         )");
 
         py_netlist_utils.def(
-            "copy_netlist", [](const Netlist* nl) { return std::shared_ptr<Netlist>(netlist_utils::copy_netlist(nl)); }, py::arg("nl"), R"(
+            "copy_netlist", [](const Netlist* nl) { return std::shared_ptr<Netlist>(netlist_utils::copy_netlist(nl)); }, py::arg("nl"), py::call_guard<py::gil_scoped_release>(), R"(
             Get a deep copy of an entire netlist including all of its gates, nets, modules, and groupings.
 
             :param hal_py.Netlist nl: The netlist to copy.
@@ -43,7 +44,7 @@ namespace hal
             :rtype: hal_py.Netlist
         )");
 
-        py_netlist_utils.def("get_ff_dependency_matrix", &netlist_utils::get_ff_dependency_matrix, py::arg("nl"), R"(
+        py_netlist_utils.def("get_ff_dependency_matrix", &netlist_utils::get_ff_dependency_matrix, py::arg("nl"), py::call_guard<py::gil_scoped_release>(), R"(
             Get the FF dependency matrix of a netlist.
 
             :param hal_py.Netlist nl: The netlist to extract the dependency matrix from.
@@ -99,6 +100,7 @@ namespace hal
                              py::arg("gate"),
                              py::arg("get_successors"),
                              py::arg("cache"),
+                             py::call_guard<py::gil_scoped_release>(),
                              R"(
             Find all sequential predecessors or successors of a gate.
             Traverses combinational logic of all input or output nets until sequential gates are found.
@@ -114,7 +116,7 @@ namespace hal
             :rtype: list[hal_py.Gate]
         )");
 
-        py_netlist_utils.def("get_next_sequential_gates", py::overload_cast<const Gate*, bool>(&netlist_utils::get_next_sequential_gates), py::arg("gate"), py::arg("get_successors"), R"(
+        py_netlist_utils.def("get_next_sequential_gates", py::overload_cast<const Gate*, bool>(&netlist_utils::get_next_sequential_gates), py::arg("gate"), py::arg("get_successors"), py::call_guard<py::gil_scoped_release>(), R"(
             Find all sequential predecessors or successors of a gate.
             Traverses combinational logic of all input or output nets until sequential gates are found.
             The result may include the provided gate itself.
@@ -130,6 +132,7 @@ namespace hal
                              py::arg("net"),
                              py::arg("get_successors"),
                              py::arg("cache"),
+                             py::call_guard<py::gil_scoped_release>(),
                              R"(
             Find all sequential predecessors or successors of a net.
             Traverses combinational logic of all input or output nets until sequential gates are found.
@@ -144,7 +147,7 @@ namespace hal
             :rtype: list[hal_py.Net]
         )");
 
-        py_netlist_utils.def("get_next_sequential_gates", py::overload_cast<const Net*, bool>(&netlist_utils::get_next_sequential_gates), py::arg("net"), py::arg("get_successors"), R"(
+        py_netlist_utils.def("get_next_sequential_gates", py::overload_cast<const Net*, bool>(&netlist_utils::get_next_sequential_gates), py::arg("net"), py::arg("get_successors"), py::call_guard<py::gil_scoped_release>(), R"(
             Find all sequential predecessors or successors of a net.
             Traverses combinational logic of all input or output nets until sequential gates are found.
 
@@ -160,6 +163,7 @@ namespace hal
                              py::arg("get_successors"),
                              py::arg("stop_properties"),
                              py::arg("cache"),
+                             py::call_guard<py::gil_scoped_release>(),
                              R"(
             Find all gates on the predecessor or successor path of a gate.
             Traverses all input or output nets until gates of the specified base types are found.
@@ -177,7 +181,7 @@ namespace hal
         )");
 
         py_netlist_utils.def(
-            "get_path", py::overload_cast<const Gate*, bool, std::set<GateTypeProperty>>(&netlist_utils::get_path), py::arg("gate"), py::arg("get_successors"), py::arg("stop_properties"), R"(
+            "get_path", py::overload_cast<const Gate*, bool, std::set<GateTypeProperty>>(&netlist_utils::get_path), py::arg("gate"), py::arg("get_successors"), py::arg("stop_properties"), py::call_guard<py::gil_scoped_release>(), R"(
             Find all gates on the predeccessor or successor path of a gate.
             Traverses all input or output nets until gates of the specified base types are found.
             The result may include the provided gate itself.
@@ -195,6 +199,7 @@ namespace hal
                              py::arg("get_successors"),
                              py::arg("stop_properties"),
                              py::arg("cache"),
+                             py::call_guard<py::gil_scoped_release>(),
                              R"(
             Find all gates on the predecessor or successor path of a net.
             Traverses all input or output nets until gates of the specified base types are found.
@@ -210,7 +215,7 @@ namespace hal
             :rtype: list[hal_py.Net]
         )");
         py_netlist_utils.def(
-            "get_path", py::overload_cast<const Net*, bool, std::set<GateTypeProperty>>(&netlist_utils::get_path), py::arg("net"), py::arg("get_successors"), py::arg("stop_properties"), R"(
+            "get_path", py::overload_cast<const Net*, bool, std::set<GateTypeProperty>>(&netlist_utils::get_path), py::arg("net"), py::arg("get_successors"), py::arg("stop_properties"), py::call_guard<py::gil_scoped_release>(), R"(
             Find all gates on the predecessor or successor path of a net.
             Traverses all input or output nets until gates of the specified base types are found.
 
@@ -391,7 +396,7 @@ namespace hal
             :rtype: list[hal_py.Gate]
         )");
 
-        py_netlist_utils.def("get_shortest_path", &netlist_utils::get_shortest_path, py::arg("start_gate"), py::arg("end_gate"), py::arg("search_both_directions") = false, R"(
+        py_netlist_utils.def("get_shortest_path", &netlist_utils::get_shortest_path, py::arg("start_gate"), py::arg("end_gate"), py::arg("search_both_directions") = false, py::call_guard<py::gil_scoped_release>(), R"(
             Find the shortest path (i.e., theresult set with the lowest number of gates) that connects the start gate with the end gate. 
             The gate where the search started from will be the first in the result vector, the end gate will be the last. 
             If there is no such path an empty vector is returned. If there is more than one path with the same length only the first one is returned.
@@ -391,6 +391,7 @@ namespace hal
                 }
             },
             py::arg("config") = SMT::QueryConfig(),
+            py::call_guard<py::gil_scoped_release>(),
             R"(
             Queries an SMT solver with the specified query configuration.
 
@@ -399,7 +400,7 @@ namespace hal
             :rtype: hal_py.SMT.Result or str
         )");
 
-        py_smt_solver.def("query_local", &SMT::Solver::query_local, py::arg("config"), R"(
+        py_smt_solver.def("query_local", &SMT::Solver::query_local, py::arg("config"), py::call_guard<py::gil_scoped_release>(), R"(
             Queries a local SMT solver with the specified query configuration.
 
             :param hal_py.SMT.QueryConfig config: The SMT solver query configuration.
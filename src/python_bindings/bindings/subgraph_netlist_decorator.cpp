@@ -29,6 +29,7 @@ namespace hal
                 }
             },
             py::arg("subgraph_gates"),
+            py::call_guard<py::gil_scoped_release>(),
             R"(
             Get a deep copy of a netlist subgraph including all of its gates and nets, but excluding modules and groupings.
 
@@ -52,6 +53,7 @@ namespace hal
                 }
             },
             py::arg("subgraph_module"),
+            py::call_guard<py::gil_scoped_release>(),
             R"(
             Get a deep copy of a netlist subgraph including all of its gates and nets, but excluding modules and groupings.
 
@@ -60,6 +62,64 @@ namespace hal
             :rtype: hal_py.Netlist or None
         )");
 
+        py_subgraph_netlist_decorator.def(
+            "copy_subgraph_netlists",
+            [](SubgraphNetlistDecorator& self, const std::vector<std::vector<const Gate*>>& subgraphs, u32 num_threads) -> std::optional<std::vector<std::shared_ptr<Netlist>>> {
+                auto res = self.copy_subgraph_netlists(subgraphs, num_threads);
+                if (res.is_ok())
+                {
+                    auto copies = res.get();
+                    return std::vector<std::shared_ptr<Netlist>>(std::make_move_iterator(copies.begin()), std::make_move_iterator(copies.end()));
+                }
+                else
+                {
+                    log_error("python_context", "error encountered while copying subgraph netlists:\n{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("subgraphs"),
+            py::arg("num_threads") = 0,
+            py::call_guard<py::gil_scoped_release>(),
+            R"(
+            Get deep copies of multiple netlist subgraphs including all of their gates and nets, but excluding modules and groupings.
+            The subgraphs are copied in parallel, each copy being equal to the result of ``copy_subgraph_netlist`` for the respective subgraph.
+            The netlist must not be modified while the subgraphs are copied.
+
+            :param list[list[hal_py.Gate]] subgraphs: The subgraphs that shall be copied from the netlist, each given by the gates making up the subgraph.
+            :param int num_threads: The number of threads to use. Defaults to ``0``, which uses as many threads as there are hardware threads.
+            :returns: The copied subgraph netlists in the order of the given subgraphs on success, None otherwise.
+            :rtype: list[hal_py.Netlist] or None
+        )");
+
+        py_subgraph_netlist_decorator.def(
+            "copy_subgraph_netlists",
+            [](SubgraphNetlistDecorator& self, const std::vector<const Module*>& subgraph_modules, u32 num_threads) -> std::optional<std::vector<std::shared_ptr<Netlist>>> {
+                auto res = self.copy_subgraph_netlists(subgraph_modules, num_threads);
+                if (res.is_ok())
+                {
+                    auto copies = res.get();
+                    return std::vector<std::shared_ptr<Netlist>>(std::make_move_iterator(copies.begin()), std::make_move_iterator(copies.end()));
+                }
+                else
+                {
+                    log_error("python_context", "error encountered while copying subgraph netlists:\n{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("subgraph_modules"),
+            py::arg("num_threads") = 0,
+            py::call_guard<py::gil_scoped_release>(),
+            R"(
+            Get deep copies of multiple netlist subgraphs including all of their gates and nets, but excluding modules and groupings.
+            The subgraphs are copied in parallel, each copy being equal to the result of ``copy_subgraph_netlist`` for the respective subgraph.
+            The netlist must not be modified while the subgraphs are copied.
+
+            :param list[hal_py.Module] subgraph_modules: The modules making up the subgraphs that shall be copied from the netlist.
+            :param int num_threads: The number of threads to use. Defaults to ``0``, which uses as many threads as there are hardware threads.
+            :returns: The copied subgraph netlists in the order of the given modules on success, None otherwise.
+            :rtype: list[hal_py.Netlist] or None
+        )");
+
         py_subgraph_netlist_decorator.def(
             "get_subgraph_function",
             [](SubgraphNetlistDecorator& self, const std::vector<const Gate*>& subgraph_gates, const Net* subgraph_output, std::map<std::pair<u32, const GatePin*>, BooleanFunction>& cache)
@@ -78,6 +138,7 @@ namespace hal
             py::arg("subgraph_gates"),
             py::arg("subgraph_output"),
             py::arg("cache"),
+            py::call_guard<py::gil_scoped_release>(),
             R"(
             Get the combined Boolean function of a subgraph of combinational gates starting at the source of the provided subgraph output net.
             The variables of the resulting Boolean function are created from the subgraph input nets using 'BooleanFunctionNetDecorator.get_boolean_variable'.
@@ -106,6 +167,7 @@ namespace hal
             },
             py::arg("subgraph_gates"),
             py::arg("subgraph_output"),
+            py::call_guard<py::gil_scoped_release>(),
             R"(
             Get the combined Boolean function of a subgraph of combinational gates starting at the source of the provided subgraph output net.
             The variables of the resulting Boolean function are created from the subgraph input nets using 'BooleanFunctionNetDecorator.get_boolean_variable'.
@@ -134,6 +196,7 @@ namespace hal
             py::arg("subgraph_module"),
             py::arg("subgraph_output"),
             py::arg("cache"),
+            py::call_guard<py::gil_scoped_release>(),
             R"(
             Get the combined Boolean function of a subgraph of combinational gates starting at the source of the provided subgraph output net.
             The variables of the resulting Boolean function are created from the subgraph input nets using 'BooleanFunctionNetDecorator.get_boolean_variable'.
@@ -162,6 +225,7 @@ namespace hal
             },
             py::arg("subgraph_module"),
             py::arg("subgraph_output"),
+            py::call_guard<py::gil_scoped_release>(),
             R"(
             Get the combined Boolean function of a subgraph of combinational gates starting at the source of the provided subgraph output net.
             The variables of the resulting Boolean function are created from the subgraph input nets using 'BooleanFunctionNetDecorator.get_boolean_variable'.
@@ -188,6 +252,7 @@ namespace hal
             },
             py::arg("subgraph_gates"),
             py::arg("subgraph_output"),
+            py::call_guard<py::gil_scoped_release>(),
             R"(
             Get the inputs of the combined Boolean function of a subgraph of combinational gates starting at the source of the provided subgraph output net.
             This does not actually build the boolean function but only determines the inputs the subgraph function would have, which is a lot faster.
@@ -214,6 +279,7 @@ namespace hal
             },
             py::arg("subgraph_module"),
             py::arg("subgraph_output"),
+            py::call_guard<py::gil_scoped_release>(),
             R"(
             Get the inputs of the combined Boolean function of a subgraph of combinational gates starting at the source of the provided subgraph output net.
             This does not actually build the boolean function but only determines the inputs the subgraph function would have, which is a lot faster.
@@ -0,0 +1,166 @@
+#include "hal_core/utilities/trace.h"
+
+#include "hal_core/python_bindings/python_bindings.h"
+
+namespace hal
+{
+    namespace
+    {
+        // span that is opened and closed explicitly, e.g., by a Python context manager
+        class PySpan
+        {
+        public:
+            PySpan(const std::string& name) : m_name(name)
+            {
+            }
+
+            void enter()
+            {
+                m_active = trace::is_enabled();
+                if (m_active)
+                {
+                    m_generation = trace::detail::begin_span(m_name);
+                }
+            }
+
+            void exit()
+            {
+                if (m_active)
+                {
+                    trace::detail::end_span(m_generation);
+                    m_active = false;
+                }
+            }
+
+        private:
+            std::string m_name;
+            bool m_active    = false;
+            u64 m_generation = 0;
+        };
+    }    // namespace
+
+    void trace_init(py::module& m)
+    {
+        auto py_trace = m.def_submodule("Trace", R"(
+            HAL profiling functions to record nested spans and counters and to export them as a summary or in the Chrome trace-event JSON format.
+        )");
+
+        py::class_<trace::SpanSummary> py_span_summary(py_trace, "SpanSummary", R"(
+            Aggregated statistics of all spans sharing the same name.
+        )");
+
+        py_span_summary.def_readonly("name", &trace::SpanSummary::name, R"(
+            The name of the spans.
+
+            :type: str
+        )");
+
+        py_span_summary.def_readonly("calls", &trace::SpanSummary::calls, R"(
+            The number of recorded spans.
+
+            :type: int
+        )");
+
+        py_span_summary.def_readonly("total_ns", &trace::SpanSummary::total_ns, R"(
+            The accumulated wall time of all spans in nanoseconds.
+
+            :type: int
+        )");
+
+        py_span_summary.def_readonly("self_ns", &trace::SpanSummary::self_ns, R"(
+            The accumulated wall time of all spans in nanoseconds, excluding the time spent in nested spans.
+
+            :type: int
+        )");
+
+        py_span_summary.def_readonly("max_ns", &trace::SpanSummary::max_ns, R"(
+            The wall time of the longest span in nanoseconds.
+
+            :type: int
+        )");
+
+        py_span_summary.def_readonly("counters", &trace::SpanSummary::counters, R"(
+            The accumulated counters of all spans.
+
+            :type: dict[str,int]
+        )");
+
+        py::class_<PySpan> py_span(py_trace, "Span", R"(
+            A span that is recorded while executing the body of a ``with`` statement, e.g., ``with hal_py.Trace.Span("my_analysis"): ...``.
+        )");
+
+        py_span.def(py::init<const std::string&>(), py::arg("name"), R"(
+            Construct a span that is opened when entering a ``with`` statement.
+
+            :param str name: The name of the span.
+        )");
+
+        py_span.def(
+            "__enter__",
+            [](PySpan& self) -> PySpan& {
+                self.enter();
+                return self;
+            },
+            py::return_value_policy::reference);
+
+        py_span.def("__exit__", [](PySpan& self, const py::object&, const py::object&, const py::object&) { self.exit(); });
+
+        py_trace.def("is_enabled", &trace::is_enabled, R"(
+            Check whether tracing is enabled.
+
+            :returns: ``True`` if tracing is enabled, ``False`` otherwise.
+            :rtype: bool
+        )");
+
+        py_trace.def("set_enabled", &trace::set_enabled, py::arg("enable"), R"(
+            Enable or disable tracing.
+            Spans that are already open when tracing is enabled are not recorded, spans that are open when tracing is disabled are still completed.
+
+            :param bool enable: ``True`` to enable tracing, ``False`` to disable it.
+        )");
+
+        py_trace.def("clear", &trace::clear, R"(
+            Discard all recorded spans and counters and restart the trace clock.
+            Spans that are open while clearing are discarded as well, closing them afterwards records nothing and does not affect spans opened after clearing.
+        )");
+
+        py_trace.def(
+            "count", [](const std::string& name, u64 value) { trace::count(name, value); }, py::arg("name"), py::arg("value") = 1, R"(
+            Increment a counter of the innermost open span of the calling thread.
+            Does nothing if tracing is disabled or no span is open.
+
+            :param str name: The name of the counter.
+            :param int value: The value to add. Defaults to ``1``.
+        )");
+
+        py_trace.def("get_summary", &trace::get_summary, R"(
+            Get the aggregated statistics of all recorded spans, sorted by descending total time.
+            Spans that are still open are not included.
+
+            :returns: A list of span summaries.
+            :rtype: list[hal_py.Trace.SpanSummary]
+        )");
+
+        py_trace.def("get_summary_table", &trace::get_summary_table, R"(
+            Get the aggregated statistics of all recorded spans as a human-readable table.
+
+            :returns: The table.
+            :rtype: str
+        )");
+
+        py_trace.def("get_chrome_trace", &trace::get_chrome_trace, R"(
+            Get all recorded spans in the Chrome trace-event JSON format.
+
+            :returns: The JSON string.
+            :rtype: str
+        )");
+
+        py_trace.def("write_chrome_trace", &trace::write_chrome_trace, py::arg("file_path"), R"(
+            Write all recorded spans to a file in the Chrome trace-event JSON format.
+
+            :param pathlib.Path file_path: The path of the output file.
+            :returns: ``True`` on success, ``False`` otherwise.
+            :rtype: bool
+        )");
+    }
+}    // namespace hal
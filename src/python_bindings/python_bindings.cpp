@@ -77,6 +77,12 @@ namespace hal
 
         log_init(m);
 
+        trace_init(m);
+
+        netlist_transaction_init(m);
+
+        event_handler_init(m);
+
 #ifndef PYBIND11_MODULE
         return m.ptr();
 #endif    // PYBIND11_MODULE
@@ -0,0 +1,234 @@
+#include "hal_core/utilities/id_allocator.h"
+
+#include <algorithm>
+
+namespace hal
+{
+    namespace
+    {
+        // number of words by which the dense range may grow beyond twice its current size to cover a new ID
+        constexpr u32 MAX_DENSE_GAP_WORDS = 1024;
+    }    // namespace
+
+    bool IdAllocator::IdBitmap::test(u32 id) const
+    {
+        const u32 word = id / 64;
+        if (word < m_words.size())
+        {
+            return (m_words[word] >> (id % 64)) & 1;
+        }
+        return m_sparse.find(id) != m_sparse.end();
+    }
+
+    bool IdAllocator::IdBitmap::set(u32 id)
+    {
+        const u32 word = id / 64;
+        if (word >= m_words.size() && word < 2 * m_words.size() + MAX_DENSE_GAP_WORDS)
+        {
+            m_words.resize(std::max<size_t>(word + 1, 2 * m_words.size()), 0);
+
+            // move sparse IDs that are now covered by the dense range into the bitmap
+            const u64 dense_end = (u64)m_words.size() * 64;
+            for (auto it = m_sparse.begin(); it != m_sparse.end() && *it < dense_end;)
+            {
+                m_words[*it / 64] |= (u64)1 << (*it % 64);
+                it = m_sparse.erase(it);
+            }
+        }
+
+        if (word < m_words.size())
+        {
+            const u64 mask = (u64)1 << (id % 64);
+            if (m_words[word] & mask)
+            {
+                return false;
+            }
+            m_words[word] |= mask;
+            m_first_word = std::min(m_first_word, word);
+        }
+        else if (!m_sparse.insert(id).second)
+        {
+            return false;
+        }
+
+        m_size++;
+        return true;
+    }
+
+    bool IdAllocator::IdBitmap::reset(u32 id)
+    {
+        const u32 word = id / 64;
+        if (word < m_words.size())
+        {
+            const u64 mask = (u64)1 << (id % 64);
+            if (!(m_words[word] & mask))
+            {
+                return false;
+            }
+            m_words[word] &= ~mask;
+        }
+        else if (m_sparse.erase(id) == 0)
+        {
+            return false;
+        }
+
+        m_size--;
+        return true;
+    }
+
+    u32 IdAllocator::IdBitmap::find_first()
+    {
+        if (m_size == 0)
+        {
+            return 0;
+        }
+
+        while (m_first_word < m_words.size())
+        {
+            if (const u64 w = m_words[m_first_word]; w != 0)
+            {
+                return m_first_word * 64 + __builtin_ctzll(w);
+            }
+            m_first_word++;
+        }
+
+        return m_sparse.empty() ? 0 : *m_sparse.begin();
+    }
+
+    std::set<u32> IdAllocator::IdBitmap::to_set() const
+    {
+        std::set<u32> res;
+        for (u32 word = 0; word < m_words.size(); word++)
+        {
+            for (u64 w = m_words[word]; w != 0; w &= w - 1)
+            {
+                res.insert(res.end(), word * 64 + __builtin_ctzll(w));
+            }
+        }
+        res.insert(m_sparse.begin(), m_sparse.end());
+        return res;
+    }
+
+    void IdAllocator::IdBitmap::assign(const std::set<u32>& ids)
+    {
+        clear();
+        for (u32 id : ids)
+        {
+            set(id);
+        }
+    }
+
+    void IdAllocator::IdBitmap::clear()
+    {
+        m_words.clear();
+        m_sparse.clear();
+        m_size       = 0;
+        m_first_word = 0;
+    }
+
+    u32 IdAllocator::IdBitmap::size() const
+    {
+        return m_size;
+    }
+
+    u32 IdAllocator::get_unique_id()
+    {
+        if (const u32 free_id = m_free.find_first(); free_id != 0)
+        {
+            return free_id;
+        }
+
+        while (m_used.test(m_next_id))
+        {
+            m_next_id++;
+        }
+        return m_next_id;
+    }
+
+    bool IdAllocator::is_used(u32 id) const
+    {
+        return m_used.test(id);
+    }
+
+    bool IdAllocator::is_free(u32 id) const
+    {
+        return m_free.test(id);
+    }
+
+    bool IdAllocator::acquire(u32 id)
+    {
+        if (id == 0 || !m_used.set(id))
+        {
+            return false;
+        }
+        m_free.reset(id);
+        m_max_id = std::max(m_max_id, id);
+        return true;
+    }
+
+    bool IdAllocator::release(u32 id)
+    {
+        if (!m_used.reset(id))
+        {
+            return false;
+        }
+        m_free.set(id);
+        return true;
+    }
+
+    u32 IdAllocator::get_next_id() const
+    {
+        return m_next_id;
+    }
+
+    void IdAllocator::set_next_id(u32 id)
+    {
+        m_next_id = id;
+    }
+
+    u32 IdAllocator::get_max_id() const
+    {
+        return m_max_id;
+    }
+
+    std::set<u32> IdAllocator::get_used_ids() const
+    {
+        return m_used.to_set();
+    }
+
+    void IdAllocator::set_used_ids(const std::set<u32>& ids)
+    {
+        m_used.assign(ids);
+        if (!ids.empty())
+        {
+            m_max_id = std::max(m_max_id, *ids.rbegin());
+        }
+    }
+
+    std::set<u32> IdAllocator::get_free_ids() const
+    {
+        return m_free.to_set();
+    }
+
+    void IdAllocator::set_free_ids(const std::set<u32>& ids)
+    {
+        m_free.assign(ids);
+        if (!ids.empty())
+        {
+            m_max_id = std::max(m_max_id, *ids.rbegin());
+        }
+    }
+
+    u32 IdAllocator::get_num_used_ids() const
+    {
+        return m_used.size();
+    }
+
+    void IdAllocator::clear()
+    {
+        m_used.clear();
+        m_free.clear();
+        m_next_id = 1;
+        m_max_id  = 0;
+    }
+}    // namespace hal
@@ -0,0 +1,40 @@
+#include "hal_core/utilities/parallel.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace hal
+{
+    namespace utils
+    {
+        u32 get_num_threads(u32 num_threads, u64 num_items)
+        {
+            if (num_threads == 0)
+            {
+                num_threads = std::max(1u, std::thread::hardware_concurrency());
+            }
+            return (u32)std::max(u64(1), std::min((u64)num_threads, num_items));
+        }
+
+        void run_workers(u32 num_threads, const std::function<void(u32 thread_index)>& worker)
+        {
+            if (num_threads <= 1)
+            {
+                worker(0);
+                return;
+            }
+
+            std::vector<std::thread> threads;
+            threads.reserve(num_threads);
+            for (u32 t = 0; t < num_threads; t++)
+            {
+                threads.emplace_back(worker, t);
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+    }    // namespace utils
+}    // namespace hal
@@ -0,0 +1,391 @@
+#include "hal_core/utilities/trace.h"
+
+#include "hal_core/utilities/utils.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace hal
+{
+    namespace trace
+    {
+        namespace detail
+        {
+            std::atomic<bool> enabled{false};
+        }    // namespace detail
+
+        namespace
+        {
+            // number of spans per thread that are kept for the Chrome trace, further spans only contribute to the summary
+            constexpr size_t MAX_RECORDED_SPANS_PER_THREAD = 1 << 20;
+
+            struct OpenSpan
+            {
+                const char* name;
+                u64 start_ns;
+                u64 child_ns;
+                std::vector<std::pair<const char*, u64>> counters;
+            };
+
+            struct ClosedSpan
+            {
+                const char* name;
+                u64 start_ns;
+                u64 end_ns;
+                std::vector<std::pair<const char*, u64>> counters;
+            };
+
+            struct Aggregate
+            {
+                u64 calls    = 0;
+                u64 total_ns = 0;
+                u64 self_ns  = 0;
+                u64 max_ns   = 0;
+                std::unordered_map<const char*, u64> counters;
+            };
+
+            struct ThreadBuffer
+            {
+                std::mutex mutex;
+                u32 thread_index;
+                u64 generation = 0;    // incremented by clear, which discards the open spans
+                std::vector<OpenSpan> open;
+                std::vector<ClosedSpan> closed;
+                u64 dropped = 0;
+                std::unordered_map<const char*, Aggregate> aggregates;
+            };
+
+            struct Registry
+            {
+                std::mutex mutex;
+                std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+                std::unordered_set<std::string> names;
+                std::atomic<i64> epoch_ns{std::chrono::steady_clock::now().time_since_epoch().count()};
+            };
+
+            // intentionally leaked so that spans closed during static destruction still find a valid registry
+            Registry& get_registry()
+            {
+                static Registry* registry = new Registry();
+                return *registry;
+            }
+
+            ThreadBuffer& get_thread_buffer()
+            {
+                thread_local std::shared_ptr<ThreadBuffer> buffer = []() {
+                    Registry& registry = get_registry();
+                    std::lock_guard<std::mutex> lock(registry.mutex);
+                    auto new_buffer          = std::make_shared<ThreadBuffer>();
+                    new_buffer->thread_index = registry.buffers.size();
+                    registry.buffers.push_back(new_buffer);
+                    return new_buffer;
+                }();
+                return *buffer;
+            }
+
+            u64 now_ns()
+            {
+                const i64 now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+                return (u64)std::max<i64>(0, now - get_registry().epoch_ns.load(std::memory_order_relaxed));
+            }
+
+            // span and counter names computed at runtime are stored only once, entries are never removed so that recorded pointers stay valid
+            const char* intern(const std::string& name)
+            {
+                Registry& registry = get_registry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                return registry.names.insert(name).first->c_str();
+            }
+
+            u64 push_span(const char* name)
+            {
+                ThreadBuffer& buffer = get_thread_buffer();
+                const u64 start      = now_ns();
+                std::lock_guard<std::mutex> lock(buffer.mutex);
+                buffer.open.push_back({name, start, 0, {}});
+                return buffer.generation;
+            }
+
+            std::string escape_json(const std::string& str)
+            {
+                std::string res;
+                res.reserve(str.size());
+                for (char c : str)
+                {
+                    switch (c)
+                    {
+                        case '"':
+                            res += "\\\"";
+                            break;
+                        case '\\':
+                            res += "\\\\";
+                            break;
+                        case '\n':
+                            res += "\\n";
+                            break;
+                        case '\t':
+                            res += "\\t";
+                            break;
+                        default:
+                            if ((unsigned char)c < 0x20)
+                            {
+                                std::stringstream ss;
+                                ss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << (int)c;
+                                res += ss.str();
+                            }
+                            else
+                            {
+                                res += c;
+                            }
+                    }
+                }
+                return res;
+            }
+
+            std::string format_ms(u64 ns)
+            {
+                std::stringstream ss;
+                ss << std::fixed << std::setprecision(3) << (double)ns / 1e6;
+                return ss.str();
+            }
+
+            std::string format_us(u64 ns)
+            {
+                std::stringstream ss;
+                ss << std::fixed << std::setprecision(3) << (double)ns / 1e3;
+                return ss.str();
+            }
+        }    // namespace
+
+        namespace detail
+        {
+            u64 begin_span(const char* name)
+            {
+                return push_span(name);
+            }
+
+            u64 begin_span(const std::string& name)
+            {
+                return push_span(intern(name));
+            }
+
+            void end_span(u64 generation)
+            {
+                ThreadBuffer& buffer = get_thread_buffer();
+                const u64 end        = now_ns();
+                std::lock_guard<std::mutex> lock(buffer.mutex);
+
+                // the trace has been cleared while the span was open, so the span is no longer on the stack
+                if (generation != buffer.generation || buffer.open.empty())
+                {
+                    return;
+                }
+
+                OpenSpan span = std::move(buffer.open.back());
+                buffer.open.pop_back();
+
+                const u64 duration = (end > span.start_ns) ? end - span.start_ns : 0;
+                if (!buffer.open.empty())
+                {
+                    buffer.open.back().child_ns += duration;
+                }
+
+                Aggregate& aggregate = buffer.aggregates[span.name];
+                aggregate.calls++;
+                aggregate.total_ns += duration;
+                aggregate.self_ns += (duration > span.child_ns) ? duration - span.child_ns : 0;
+                aggregate.max_ns = std::max(aggregate.max_ns, duration);
+                for (const auto& [counter, value] : span.counters)
+                {
+                    aggregate.counters[counter] += value;
+                }
+
+                if (buffer.closed.size() < MAX_RECORDED_SPANS_PER_THREAD)
+                {
+                    buffer.closed.push_back({span.name, span.start_ns, span.start_ns + duration, std::move(span.counters)});
+                }
+                else
+                {
+                    buffer.dropped++;
+                }
+            }
+
+            void add_to_counter(const char* name, u64 value)
+            {
+                ThreadBuffer& buffer = get_thread_buffer();
+                std::lock_guard<std::mutex> lock(buffer.mutex);
+                if (buffer.open.empty())
+                {
+                    return;
+                }
+
+                auto& counters = buffer.open.back().counters;
+                if (auto it = std::find_if(counters.begin(), counters.end(), [name](const auto& counter) { return counter.first == name; }); it != counters.end())
+                {
+                    it->second += value;
+                }
+                else
+                {
+                    counters.emplace_back(name, value);
+                }
+            }
+
+            void add_to_counter(const std::string& name, u64 value)
+            {
+                add_to_counter(intern(name), value);
+            }
+        }    // namespace detail
+
+        void set_enabled(bool enable)
+        {
+            detail::enabled.store(enable, std::memory_order_relaxed);
+        }
+
+        void clear()
+        {
+            Registry& registry = get_registry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            for (const auto& buffer : registry.buffers)
+            {
+                std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+                buffer->generation++;
+                buffer->open.clear();
+                buffer->closed.clear();
+                buffer->dropped = 0;
+                buffer->aggregates.clear();
+            }
+            registry.epoch_ns.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+        }
+
+        std::vector<SpanSummary> get_summary()
+        {
+            std::map<std::string, SpanSummary> merged;
+
+            Registry& registry = get_registry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            for (const auto& buffer : registry.buffers)
+            {
+                std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+                for (const auto& [name, aggregate] : buffer->aggregates)
+                {
+                    SpanSummary& summary = merged[name];
+                    summary.name         = name;
+                    summary.calls += aggregate.calls;
+                    summary.total_ns += aggregate.total_ns;
+                    summary.self_ns += aggregate.self_ns;
+                    summary.max_ns = std::max(summary.max_ns, aggregate.max_ns);
+                    for (const auto& [counter, value] : aggregate.counters)
+                    {
+                        summary.counters[counter] += value;
+                    }
+                }
+            }
+
+            std::vector<SpanSummary> res;
+            res.reserve(merged.size());
+            for (auto& [name, summary] : merged)
+            {
+                res.push_back(std::move(summary));
+            }
+            std::stable_sort(res.begin(), res.end(), [](const SpanSummary& a, const SpanSummary& b) { return a.total_ns > b.total_ns; });
+            return res;
+        }
+
+        std::string get_summary_table()
+        {
+            const std::vector<SpanSummary> summary = get_summary();
+
+            size_t name_width = 4;
+            for (const auto& entry : summary)
+            {
+                name_width = std::max(name_width, entry.name.size());
+            }
+
+            std::stringstream ss;
+            ss << std::left << std::setw(name_width) << "span" << std::right << std::setw(10) << "calls" << std::setw(14) << "total [ms]" << std::setw(14) << "self [ms]" << std::setw(14)
+               << "avg [ms]" << std::setw(14) << "max [ms]"
+               << "  counters" << std::endl;
+            ss << std::string(name_width + 76, '-') << std::endl;
+
+            for (const auto& entry : summary)
+            {
+                std::vector<std::string> counters;
+                for (const auto& [counter, value] : entry.counters)
+                {
+                    counters.push_back(counter + "=" + std::to_string(value));
+                }
+
+                ss << std::left << std::setw(name_width) << entry.name << std::right << std::setw(10) << entry.calls << std::setw(14) << format_ms(entry.total_ns) << std::setw(14)
+                   << format_ms(entry.self_ns) << std::setw(14) << format_ms(entry.calls == 0 ? 0 : entry.total_ns / entry.calls) << std::setw(14) << format_ms(entry.max_ns) << "  "
+                   << utils::join(", ", counters) << std::endl;
+            }
+
+            return ss.str();
+        }
+
+        std::string get_chrome_trace()
+        {
+            std::stringstream ss;
+            ss << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+            bool first = true;
+            auto separator = [&first]() {
+                const char* res = first ? "\n" : ",\n";
+                first           = false;
+                return res;
+            };
+
+            u64 dropped = 0;
+
+            Registry& registry = get_registry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            for (const auto& buffer : registry.buffers)
+            {
+                std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+                if (buffer->closed.empty())
+                {
+                    continue;
+                }
+
+                ss << separator() << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->thread_index << ",\"args\":{\"name\":\"thread " << buffer->thread_index << "\"}}";
+                for (const auto& span : buffer->closed)
+                {
+                    ss << separator() << "{\"name\":\"" << escape_json(span.name) << "\",\"cat\":\"hal\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->thread_index << ",\"ts\":" << format_us(span.start_ns)
+                       << ",\"dur\":" << format_us(span.end_ns - span.start_ns);
+                    if (!span.counters.empty())
+                    {
+                        ss << ",\"args\":{";
+                        for (u32 i = 0; i < span.counters.size(); i++)
+                        {
+                            ss << (i == 0 ? "" : ",") << "\"" << escape_json(span.counters[i].first) << "\":" << span.counters[i].second;
+                        }
+                        ss << "}";
+                    }
+                    ss << "}";
+                }
+                dropped += buffer->dropped;
+            }
+
+            ss << "\n],\"otherData\":{\"dropped_spans\":" << dropped << "}}" << std::endl;
+            return ss.str();
+        }
+
+        bool write_chrome_trace(const std::filesystem::path& file_path)
+        {
+            std::ofstream ofs(file_path);
+            if (!ofs.is_open())
+            {
+                return false;
+            }
+            ofs << get_chrome_trace();
+            return ofs.good();
+        }
+    }    // namespace trace
+}    // namespace hal
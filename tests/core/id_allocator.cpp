@@ -0,0 +1,137 @@
+#include "hal_core/utilities/id_allocator.h"
+#include "netlist_test_utils.h"
+
+#include "test_def.h"
+
+#include "gtest/gtest.h"
+
+namespace hal
+{
+    class IdAllocatorTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp()
+        {
+            test_utils::init_log_channels();
+        }
+
+        virtual void TearDown()
+        {
+        }
+    };
+
+    /**
+     * Testing the allocation and release of IDs.
+     *
+     * Functions: get_unique_id, acquire, release, is_used, is_free, get_num_used_ids
+     */
+    TEST_F(IdAllocatorTest, check_allocation)
+    {
+        TEST_START
+        {
+            IdAllocator ids;
+            EXPECT_EQ(ids.get_unique_id(), 1);
+            EXPECT_EQ(ids.get_unique_id(), 1);    // not marked as used until acquired
+            EXPECT_FALSE(ids.acquire(0));
+
+            for (u32 i = 0; i < 1000; i++)
+            {
+                u32 id = ids.get_unique_id();
+                EXPECT_EQ(id, i + 1);
+                EXPECT_TRUE(ids.acquire(id));
+            }
+            EXPECT_EQ(ids.get_num_used_ids(), 1000);
+            EXPECT_FALSE(ids.acquire(500));
+            EXPECT_TRUE(ids.is_used(500));
+            EXPECT_FALSE(ids.is_used(1001));
+
+            // released IDs are handed out again, smallest first
+            EXPECT_TRUE(ids.release(700));
+            EXPECT_TRUE(ids.release(300));
+            EXPECT_FALSE(ids.release(300));
+            EXPECT_FALSE(ids.release(5000));
+            EXPECT_TRUE(ids.is_free(300));
+            EXPECT_FALSE(ids.is_used(300));
+            EXPECT_EQ(ids.get_num_used_ids(), 998);
+            EXPECT_EQ(ids.get_unique_id(), 300);
+            EXPECT_TRUE(ids.acquire(300));
+            EXPECT_FALSE(ids.is_free(300));
+            EXPECT_EQ(ids.get_unique_id(), 700);
+            EXPECT_TRUE(ids.acquire(700));
+            EXPECT_EQ(ids.get_unique_id(), 1001);
+
+            // explicitly acquired IDs are skipped
+            EXPECT_TRUE(ids.acquire(1001));
+            EXPECT_TRUE(ids.acquire(1002));
+            EXPECT_EQ(ids.get_unique_id(), 1003);
+        }
+        {
+            // IDs far beyond the dense range
+            IdAllocator ids;
+            EXPECT_TRUE(ids.acquire(0xFFFFFFF0));
+            EXPECT_TRUE(ids.acquire(3000000));
+            EXPECT_TRUE(ids.is_used(0xFFFFFFF0));
+            EXPECT_FALSE(ids.acquire(0xFFFFFFF0));
+            EXPECT_EQ(ids.get_unique_id(), 1);
+            for (u32 i = 1; i <= 100000; i++)
+            {
+                EXPECT_TRUE(ids.acquire(i));
+            }
+            EXPECT_TRUE(ids.is_used(3000000));
+            EXPECT_EQ(ids.get_num_used_ids(), 100002);
+            EXPECT_TRUE(ids.release(0xFFFFFFF0));
+            EXPECT_EQ(ids.get_unique_id(), 0xFFFFFFF0);
+            EXPECT_TRUE(ids.release(3000000));
+            EXPECT_EQ(ids.get_unique_id(), 3000000);
+            EXPECT_EQ(ids.get_free_ids(), std::set<u32>({3000000, 0xFFFFFFF0}));
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing the access to the state of the allocator.
+     *
+     * Functions: get_next_id, set_next_id, get_max_id, get_used_ids, set_used_ids, get_free_ids, set_free_ids, clear
+     */
+    TEST_F(IdAllocatorTest, check_state_access)
+    {
+        TEST_START
+        {
+            IdAllocator ids;
+            for (u32 id : {1, 2, 3, 5, 64, 65, 200})
+            {
+                ids.acquire(id);
+            }
+            ids.release(2);
+            ids.release(64);
+            EXPECT_EQ(ids.get_used_ids(), std::set<u32>({1, 3, 5, 65, 200}));
+            EXPECT_EQ(ids.get_free_ids(), std::set<u32>({2, 64}));
+            EXPECT_EQ(ids.get_max_id(), 200);
+
+            // restore the state into another allocator
+            IdAllocator other;
+            other.set_next_id(ids.get_next_id());
+            other.set_used_ids(ids.get_used_ids());
+            other.set_free_ids(ids.get_free_ids());
+            EXPECT_EQ(other.get_used_ids(), ids.get_used_ids());
+            EXPECT_EQ(other.get_free_ids(), ids.get_free_ids());
+            EXPECT_EQ(other.get_num_used_ids(), 5);
+            EXPECT_EQ(other.get_unique_id(), 2);
+
+            other.set_free_ids({});
+            EXPECT_EQ(other.get_unique_id(), 2);
+            other.set_next_id(4);
+            other.acquire(4);
+            EXPECT_EQ(other.get_unique_id(), 6);
+            EXPECT_EQ(other.get_next_id(), 6);
+
+            other.clear();
+            EXPECT_TRUE(other.get_used_ids().empty());
+            EXPECT_TRUE(other.get_free_ids().empty());
+            EXPECT_EQ(other.get_next_id(), 1);
+            EXPECT_EQ(other.get_unique_id(), 1);
+            EXPECT_EQ(other.get_max_id(), 0);
+        }
+        TEST_END
+    }
+}    // namespace hal
@@ -0,0 +1,88 @@
+#include "hal_core/utilities/parallel.h"
+#include "netlist_test_utils.h"
+
+#include "test_def.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace hal
+{
+    class ParallelTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp()
+        {
+            test_utils::init_log_channels();
+        }
+
+        virtual void TearDown()
+        {
+        }
+    };
+
+    /**
+     * Testing the resolution of the number of worker threads.
+     *
+     * Functions: get_num_threads
+     */
+    TEST_F(ParallelTest, check_get_num_threads)
+    {
+        TEST_START
+        {
+            EXPECT_EQ(utils::get_num_threads(4, 100), 4);
+            EXPECT_EQ(utils::get_num_threads(4, 3), 3);
+            EXPECT_EQ(utils::get_num_threads(4, 0), 1);
+            EXPECT_EQ(utils::get_num_threads(1, 100), 1);
+
+            const u32 hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+            EXPECT_EQ(utils::get_num_threads(0, 1000000), hardware_threads);
+            EXPECT_EQ(utils::get_num_threads(0, 1), 1);
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing that every worker is run exactly once and all work items are processed.
+     *
+     * Functions: run_workers
+     */
+    TEST_F(ParallelTest, check_run_workers)
+    {
+        TEST_START
+        {
+            for (u32 num_threads : {1u, 2u, 5u})
+            {
+                std::vector<std::atomic<u32>> calls(num_threads);
+                std::vector<std::atomic<u32>> processed(1000);
+                std::atomic<u32> next_item{0};
+
+                utils::run_workers(num_threads, [&](u32 thread_index) {
+                    calls.at(thread_index)++;
+                    for (u32 i = next_item++; i < processed.size(); i = next_item++)
+                    {
+                        processed[i]++;
+                    }
+                });
+
+                for (u32 t = 0; t < num_threads; t++)
+                {
+                    EXPECT_EQ(calls[t], 1);
+                }
+                for (u32 i = 0; i < processed.size(); i++)
+                {
+                    EXPECT_EQ(processed[i], 1);
+                }
+            }
+
+            // a single worker runs on the calling thread
+            std::thread::id worker_id;
+            utils::run_workers(1, [&worker_id](u32) { worker_id = std::this_thread::get_id(); });
+            EXPECT_EQ(worker_id, std::this_thread::get_id());
+        }
+        TEST_END
+    }
+}    // namespace hal
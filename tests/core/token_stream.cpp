@@ -0,0 +1,118 @@
+#include "hal_core/utilities/token_stream.h"
+#include "netlist_test_utils.h"
+
+#include "test_def.h"
+
+#include "gtest/gtest.h"
+
+namespace hal
+{
+    class TokenStreamTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp()
+        {
+            test_utils::init_log_channels();
+        }
+
+        virtual void TearDown()
+        {
+        }
+
+        TokenStream<std::string> create_stream(const std::vector<std::string>& strings)
+        {
+            std::vector<Token<std::string>> tokens;
+            for (u32 i = 0; i < strings.size(); i++)
+            {
+                tokens.emplace_back(i + 1, strings.at(i));
+            }
+            return TokenStream<std::string>(std::move(tokens));
+        }
+    };
+
+    /**
+     * Testing the extraction of nested sub-streams.
+     *
+     * Functions: extract_until, consume, peek, at, size, remaining, position
+     */
+    TEST_F(TokenStreamTest, check_extract_until)
+    {
+        TEST_START
+        {
+            TokenStream<std::string> ts = create_stream({"a", "(", "b", ";", "c", ")", ";", "d", "e", ";"});
+
+            TokenStream<std::string> first = ts.extract_until(";");
+            EXPECT_EQ(ts.position(), 6);
+            EXPECT_TRUE(ts.consume(";"));
+            EXPECT_EQ(ts.peek().string, "d");
+
+            // positions of the sub-stream are relative to its first token
+            ASSERT_EQ(first.size(), 6);
+            EXPECT_EQ(first.position(), 0);
+            EXPECT_EQ(first.at(0).string, "a");
+            EXPECT_EQ(first.at(5).string, ")");
+            EXPECT_EQ(first.at(5).number, 6);
+            EXPECT_THROW(first.at(6), TokenStream<std::string>::TokenStreamException);
+
+            EXPECT_EQ(first.consume().string, "a");
+            EXPECT_TRUE(first.consume("(", true));
+            TokenStream<std::string> inner = first.extract_until(")");
+            EXPECT_EQ(first.remaining(), 1);
+            EXPECT_EQ(inner.size(), 3);
+
+            TokenStream<std::string> innermost = inner.extract_until(";");
+            EXPECT_EQ(innermost.size(), 1);
+            EXPECT_EQ(innermost.join("").string, "b");
+            EXPECT_EQ(inner.consume_until(";").string, "b");
+            EXPECT_EQ(inner.join("").string, ";c");
+
+            // extraction until the end of the stream if nothing matches
+            TokenStream<std::string> rest = ts.extract_until("x");
+            EXPECT_EQ(rest.size(), 3);
+            EXPECT_EQ(ts.remaining(), 0);
+            EXPECT_THROW(ts.extract_until("x", TokenStream<std::string>::END_OF_STREAM, true, true), TokenStream<std::string>::TokenStreamException);
+
+            // an empty sub-stream still reports the line of the parent stream's tokens
+            TokenStream<std::string> empty = rest.extract_until("d");
+            EXPECT_EQ(empty.size(), 0);
+            try
+            {
+                empty.consume("y", true);
+                FAIL();
+            }
+            catch (const TokenStream<std::string>::TokenStreamException& e)
+            {
+                EXPECT_EQ(e.line_number, (u32)TokenStream<std::string>::END_OF_STREAM);
+            }
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing that copies of a stream share its tokens but keep their own position.
+     *
+     * Functions: TokenStream(const TokenStream&), operator=, consume, join_until
+     */
+    TEST_F(TokenStreamTest, check_copy)
+    {
+        TEST_START
+        {
+            TokenStream<std::string> ts = create_stream({"a", "b", ",", "c"});
+            ts.consume();
+
+            TokenStream<std::string> copy = ts;
+            EXPECT_EQ(copy.position(), 1);
+            EXPECT_EQ(copy.join_until(",", "_").string, "b");
+            EXPECT_EQ(copy.position(), 2);
+            EXPECT_EQ(ts.position(), 1);
+            EXPECT_EQ(&copy.at(3), &ts.at(3));
+
+            TokenStream<std::string> sub = ts.extract_until(",");
+            copy                         = sub;
+            EXPECT_EQ(copy.size(), 1);
+            EXPECT_EQ(copy.consume().string, "b");
+            EXPECT_EQ(sub.remaining(), 1);
+        }
+        TEST_END
+    }
+}    // namespace hal
@@ -0,0 +1,208 @@
+#include "hal_core/utilities/trace.h"
+#include "netlist_test_utils.h"
+
+#include "test_def.h"
+
+#include "gtest/gtest.h"
+
+#include <thread>
+
+namespace hal
+{
+    class TraceTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp()
+        {
+            test_utils::init_log_channels();
+            trace::clear();
+            trace::set_enabled(true);
+        }
+
+        virtual void TearDown()
+        {
+            trace::set_enabled(false);
+            trace::clear();
+        }
+
+        const trace::SpanSummary* find_summary(const std::vector<trace::SpanSummary>& summary, const std::string& name)
+        {
+            for (const auto& entry : summary)
+            {
+                if (entry.name == name)
+                {
+                    return &entry;
+                }
+            }
+            return nullptr;
+        }
+    };
+
+    /**
+     * Testing the aggregation of nested spans and counters.
+     *
+     * Functions: HAL_TRACE_SCOPE, count, get_summary
+     */
+    TEST_F(TraceTest, check_nested_spans)
+    {
+        TEST_START
+        {
+            for (u32 i = 0; i < 3; i++)
+            {
+                HAL_TRACE_SCOPE("outer");
+                trace::count("iterations");
+                {
+                    HAL_TRACE_SCOPE("inner");
+                    trace::count("items", 5);
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+                {
+                    HAL_TRACE_SCOPE(std::string("inner"));
+                    trace::count(std::string("items"), 2);
+                }
+            }
+
+            const auto summary = trace::get_summary();
+            ASSERT_EQ(summary.size(), 2);
+            EXPECT_EQ(summary.at(0).name, "outer");
+
+            const trace::SpanSummary* outer = find_summary(summary, "outer");
+            const trace::SpanSummary* inner = find_summary(summary, "inner");
+            ASSERT_NE(outer, nullptr);
+            ASSERT_NE(inner, nullptr);
+
+            EXPECT_EQ(outer->calls, 3);
+            EXPECT_EQ(inner->calls, 6);
+            EXPECT_EQ(outer->counters.at("iterations"), 3);
+            EXPECT_EQ(outer->counters.count("items"), 0);
+            EXPECT_EQ(inner->counters.at("items"), 21);
+
+            EXPECT_GE(inner->total_ns, 3'000'000);
+            EXPECT_GE(outer->total_ns, inner->total_ns);
+            EXPECT_EQ(inner->self_ns, inner->total_ns);
+            EXPECT_LE(outer->self_ns, outer->total_ns - inner->total_ns);
+            EXPECT_LE(outer->max_ns, outer->total_ns);
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing that nothing is recorded while tracing is disabled and that the trace can be cleared.
+     *
+     * Functions: set_enabled, is_enabled, clear
+     */
+    TEST_F(TraceTest, check_enable_and_clear)
+    {
+        TEST_START
+        {
+            {
+                HAL_TRACE_SCOPE("recorded");
+            }
+            EXPECT_EQ(trace::get_summary().size(), 1);
+
+            trace::set_enabled(false);
+            EXPECT_FALSE(trace::is_enabled());
+            {
+                HAL_TRACE_SCOPE("not_recorded");
+                trace::count("ignored");
+            }
+            EXPECT_EQ(trace::get_summary().size(), 1);
+            EXPECT_EQ(find_summary(trace::get_summary(), "not_recorded"), nullptr);
+
+            // a span opened while tracing is enabled is still completed after disabling it
+            trace::set_enabled(true);
+            {
+                HAL_TRACE_SCOPE("completed");
+                trace::set_enabled(false);
+            }
+            EXPECT_NE(find_summary(trace::get_summary(), "completed"), nullptr);
+
+            // counters outside of any span are ignored
+            trace::set_enabled(true);
+            trace::count("orphan");
+
+            trace::clear();
+            EXPECT_TRUE(trace::get_summary().empty());
+
+            // spans open while clearing are discarded, even if they are closed after spans opened after clearing, e.g., by Python context managers
+            {
+                HAL_TRACE_SCOPE("discarded");
+                const u64 discarded_generation = trace::detail::begin_span("discarded_out_of_order");
+                trace::clear();
+                const u64 recorded_generation = trace::detail::begin_span("recorded");
+                trace::count("steps");
+                trace::detail::end_span(discarded_generation);
+                trace::count("steps");
+                trace::detail::end_span(recorded_generation);
+            }
+            const auto summary = trace::get_summary();
+            ASSERT_EQ(summary.size(), 1);
+            EXPECT_EQ(summary.front().name, "recorded");
+            EXPECT_EQ(summary.front().calls, 1);
+            EXPECT_EQ(summary.front().counters, (std::map<std::string, u64>{{"steps", 2}}));
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing spans recorded by multiple threads.
+     *
+     * Functions: HAL_TRACE_SCOPE, get_summary, get_chrome_trace
+     */
+    TEST_F(TraceTest, check_threads)
+    {
+        TEST_START
+        {
+            std::vector<std::thread> threads;
+            for (u32 t = 0; t < 4; t++)
+            {
+                threads.emplace_back([]() {
+                    for (u32 i = 0; i < 100; i++)
+                    {
+                        HAL_TRACE_SCOPE("worker");
+                        trace::count("work");
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            const auto summary = trace::get_summary();
+            ASSERT_EQ(summary.size(), 1);
+            EXPECT_EQ(summary.at(0).calls, 400);
+            EXPECT_EQ(summary.at(0).counters.at("work"), 400);
+
+            const std::string json = trace::get_chrome_trace();
+            EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+            EXPECT_NE(json.find("\"name\":\"worker\""), std::string::npos);
+            EXPECT_NE(json.find("\"args\":{\"work\":1}"), std::string::npos);
+            EXPECT_NE(json.find("\"dropped_spans\":0"), std::string::npos);
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing the escaping of span names in the Chrome trace and the summary table.
+     *
+     * Functions: get_chrome_trace, get_summary_table
+     */
+    TEST_F(TraceTest, check_export)
+    {
+        TEST_START
+        {
+            {
+                HAL_TRACE_SCOPE(std::string("quoted \"name\"\\"));
+            }
+
+            const std::string json = trace::get_chrome_trace();
+            EXPECT_NE(json.find("\"name\":\"quoted \\\"name\\\"\\\\\""), std::string::npos);
+
+            const std::string table = trace::get_summary_table();
+            EXPECT_NE(table.find("calls"), std::string::npos);
+            EXPECT_NE(table.find("quoted \"name\"\\"), std::string::npos);
+        }
+        TEST_END
+    }
+}    // namespace hal
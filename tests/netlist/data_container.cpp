@@ -32,7 +32,7 @@ namespace hal
 
     private:
         bool m_notified = false;
-        void notify_updated()
+        void notify_updated() override
         {
             m_notified = true;
         }
@@ -66,7 +66,7 @@ namespace hal
     EXPECT_TRUE(d_cont.set_data("category_1", "key_2", "data_type_2", "value_2", false));
     EXPECT_TRUE(d_cont.set_data("category_1", "key_0", "data_type_3", "value_3", false));
 
-    //EXPECT_TRUE(d_cont.data_update_notified());
+    EXPECT_TRUE(d_cont.data_update_notified());
     EXPECT_EQ(d_cont.get_data("category_0", "key_0"), std::make_tuple("data_type_0", "value_0"));
     EXPECT_EQ(d_cont.get_data("category_0", "key_1"), std::make_tuple("data_type_1", "value_1"));
     EXPECT_EQ(d_cont.get_data("category_1", "key_2"), std::make_tuple("data_type_2", "value_2"));
@@ -76,11 +76,11 @@ namespace hal
     // Overwrites data with the same key and category
     TestDataContainer d_cont;
     EXPECT_TRUE(d_cont.set_data("category", "key", "data_type", "value", false));
-    //EXPECT_TRUE(d_cont.data_update_notified());
+    EXPECT_TRUE(d_cont.data_update_notified());
     EXPECT_EQ(d_cont.get_data("category", "key"), std::make_tuple("data_type", "value"));
 
     EXPECT_TRUE(d_cont.set_data("category", "key", "new_data_type", "new_value", false));
-    //EXPECT_TRUE(d_cont.data_update_notified());
+    EXPECT_TRUE(d_cont.data_update_notified());
     EXPECT_EQ(d_cont.get_data("category", "key"), std::make_tuple("new_data_type", "new_value"));
 }
 {
@@ -97,7 +97,7 @@ namespace hal
     NO_COUT_TEST_BLOCK;
     TestDataContainer d_cont;
     EXPECT_FALSE(d_cont.set_data("", "key", "data_type", "value"));
-    //EXPECT_FALSE(d_cont.data_update_notified());
+    EXPECT_FALSE(d_cont.data_update_notified());
     EXPECT_EQ(d_cont.get_data("", "key"), m_empty_pair);
 }
 {
@@ -105,7 +105,7 @@ namespace hal
     NO_COUT_TEST_BLOCK;
     TestDataContainer d_cont;
     EXPECT_FALSE(d_cont.set_data("category", "", "data_type", "value"));
-    //EXPECT_FALSE(d_cont.data_update_notified());
+    EXPECT_FALSE(d_cont.data_update_notified());
     EXPECT_EQ(d_cont.get_data("category", ""), m_empty_pair);
 }
 
@@ -121,11 +121,11 @@ TEST_END
 TEST_F(DataContainerTest, check_delete_data){TEST_START{// Delete an existing entry
                                                         TestDataContainer d_cont;
 d_cont.set_data("category", "key", "data_type", "value", false);    // create an entry
-//EXPECT_TRUE(d_cont.data_update_notified());
+EXPECT_TRUE(d_cont.data_update_notified());
 
 // delete the created entry
 EXPECT_TRUE(d_cont.delete_data("category", "key"));
-//EXPECT_TRUE(d_cont.data_update_notified());
+EXPECT_TRUE(d_cont.data_update_notified());
 EXPECT_EQ(d_cont.get_data("category", "key"), m_empty_pair);
 }
 {
@@ -135,7 +135,7 @@ EXPECT_EQ(d_cont.get_data("category", "key"), m_empty_pair);
     // delete the created entry
     EXPECT_TRUE(d_cont.delete_data("category", "key"));
     EXPECT_EQ(d_cont.get_data("category", "key"), m_empty_pair);
-    //EXPECT_FALSE(d_cont.data_update_notified());
+    EXPECT_FALSE(d_cont.data_update_notified());
 }
 {
     // Log with info level = true
@@ -155,7 +155,7 @@ EXPECT_EQ(d_cont.get_data("category", "key"), m_empty_pair);
     d_cont.set_data("category", "key", "data_type", "value", false);
     d_cont.data_update_notified();
     EXPECT_FALSE(d_cont.delete_data("", "key", false));
-    //EXPECT_FALSE(d_cont.data_update_notified());
+    EXPECT_FALSE(d_cont.data_update_notified());
 }
 {
     // Leave key empty
@@ -164,7 +164,7 @@ EXPECT_EQ(d_cont.get_data("category", "key"), m_empty_pair);
     d_cont.set_data("category", "key", "data_type", "value", false);
     d_cont.data_update_notified();
     EXPECT_FALSE(d_cont.delete_data("category", "", false));
-    //EXPECT_FALSE(d_cont.data_update_notified());
+    EXPECT_FALSE(d_cont.data_update_notified());
 }
 
 TEST_END
@@ -233,4 +233,62 @@ TEST_F(DataContainerTest, check_get_data)
 
     TEST_END
 }
+
+/**
+     * Testing that typed values are restored exactly
+     *
+     * Functions: set_data, get_data, get_data_map, set_data_map, copy_data_from, get_num_data_entries, operator==
+     */
+TEST_F(DataContainerTest, check_typed_values)
+{
+    TEST_START
+    std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> data;
+    data[std::make_tuple("generic", "INIT_0")]  = std::make_tuple("bit_vector", "0000FFFF");
+    data[std::make_tuple("generic", "INIT_1")]  = std::make_tuple("bit_vector", "00ab");
+    data[std::make_tuple("generic", "INIT_2")]  = std::make_tuple("bit_vector", "0123456789ABCDEF0123");
+    data[std::make_tuple("generic", "INIT_3")]  = std::make_tuple("bit_vector", "aBcD");
+    data[std::make_tuple("generic", "WIDTH")]   = std::make_tuple("integer", "-42");
+    data[std::make_tuple("generic", "DEPTH")]   = std::make_tuple("integer", "0");
+    data[std::make_tuple("generic", "OFFSET")]  = std::make_tuple("integer", "007");
+    data[std::make_tuple("generic", "HUGE")]    = std::make_tuple("integer", "123456789012345678901234");
+    data[std::make_tuple("generic", "NOTINT")]  = std::make_tuple("integer", "12x");
+    data[std::make_tuple("attribute", "NAME")]  = std::make_tuple("string", "FFFF");
+
+    TestDataContainer d_cont;
+    for (const auto& [identifier, content] : data)
+    {
+        EXPECT_TRUE(d_cont.set_data(std::get<0>(identifier), std::get<1>(identifier), std::get<0>(content), std::get<1>(content)));
+    }
+    for (const auto& [identifier, content] : data)
+    {
+        EXPECT_EQ(d_cont.get_data(std::get<0>(identifier), std::get<1>(identifier)), content);
+    }
+    EXPECT_EQ(d_cont.get_data_map(), data);
+    EXPECT_EQ(d_cont.get_num_data_entries(), data.size());
+
+    // overwriting an entry changes its type and value
+    d_cont.set_data("generic", "WIDTH", "string", "wide");
+    EXPECT_EQ(d_cont.get_data("generic", "WIDTH"), std::make_tuple("string", "wide"));
+    EXPECT_EQ(d_cont.get_num_data_entries(), data.size());
+
+    // containers built from maps compare equal to containers built entry by entry
+    TestDataContainer other;
+    other.set_data_map(data);
+    EXPECT_TRUE(other.data_update_notified());
+    EXPECT_EQ(other.get_data_map(), data);
+    EXPECT_FALSE(other == d_cont);
+    d_cont.set_data("generic", "WIDTH", "integer", "-42");
+    EXPECT_TRUE(other == d_cont);
+
+    // copying a container keeps all entries and notifies about the update
+    TestDataContainer copy;
+    copy.set_data("category", "key", "string", "overwritten");
+    copy.data_update_notified();
+    copy.copy_data_from(d_cont);
+    EXPECT_TRUE(copy.data_update_notified());
+    EXPECT_TRUE(copy == d_cont);
+    EXPECT_EQ(copy.get_data_map(), data);
+
+    TEST_END
+}
 }
@@ -7,6 +7,8 @@
 #include "hal_core/netlist/decorators/boolean_function_net_decorator.h"
 #include "hal_core/netlist/decorators/boolean_function_decorator.h"
 #include "hal_core/netlist/decorators/netlist_modification_decorator.h"
+#include "hal_core/netlist/decorators/subgraph_netlist_decorator.h"
+#include "hal_core/netlist/module.h"
 #include "netlist_test_utils.h"
 
 
@@ -506,4 +508,138 @@ namespace hal {
         }
         TEST_END
     }
+
+    /**
+     * Test SubgraphNetlistDecorator::copy_subgraph_netlist and SubgraphNetlistDecorator::copy_subgraph_netlists.
+     */
+    TEST_F(DecoratorTest, check_subgraph_netlist_decorator)
+    {
+        TEST_START
+        {
+            std::unique_ptr<Netlist> nl_owner = test_utils::create_empty_netlist();
+            auto* nl = nl_owner.get();
+            ASSERT_NE(nl, nullptr);
+            const auto* gl = nl->get_gate_library();
+
+            auto* and0 = nl->create_gate(gl->get_gate_type_by_name("AND2"), "and0");
+            ASSERT_NE(and0, nullptr);
+            auto* or0 = nl->create_gate(gl->get_gate_type_by_name("OR2"), "or0");
+            ASSERT_NE(or0, nullptr);
+            auto* inv0 = nl->create_gate(gl->get_gate_type_by_name("INV"), "inv0");
+            ASSERT_NE(inv0, nullptr);
+            auto* buf0 = nl->create_gate(gl->get_gate_type_by_name("BUF"), "buf0");
+            ASSERT_NE(buf0, nullptr);
+
+            Net* in_0 = test_utils::connect_global_in(nl, and0, "I0", "in_0");
+            ASSERT_NE(in_0, nullptr);
+            Net* in_1 = test_utils::connect_global_in(nl, and0, "I1", "in_1");
+            ASSERT_NE(in_1, nullptr);
+            Net* n_a = test_utils::connect(nl, and0, "O", or0, "I0", "n_a");
+            ASSERT_NE(n_a, nullptr);
+            Net* in_2 = test_utils::connect_global_in(nl, or0, "I1", "in_2");
+            ASSERT_NE(in_2, nullptr);
+            Net* n_b = test_utils::connect(nl, or0, "O", inv0, "I", "n_b");
+            ASSERT_NE(n_b, nullptr);
+            Net* out_0 = test_utils::connect_global_out(nl, inv0, "O", "out_0");
+            ASSERT_NE(out_0, nullptr);
+            ASSERT_NE(test_utils::connect_global_in(nl, buf0, "I", "in_3"), nullptr);
+            ASSERT_NE(test_utils::connect_global_out(nl, buf0, "O", "out_1"), nullptr);
+
+            SubgraphNetlistDecorator decorator(*nl);
+            {
+                // only the nets connected to the subgraph are copied
+                auto res = decorator.copy_subgraph_netlist(std::vector<const Gate*>({or0}));
+                ASSERT_TRUE(res.is_ok());
+                std::unique_ptr<Netlist> copy = res.get();
+
+                EXPECT_EQ(copy->get_gates().size(), 1);
+                ASSERT_EQ(copy->get_nets().size(), 3);
+                Gate* c_or0 = copy->get_gate_by_id(or0->get_id());
+                ASSERT_NE(c_or0, nullptr);
+                EXPECT_EQ(c_or0->get_name(), "or0");
+
+                Net* c_n_a = copy->get_net_by_id(n_a->get_id());
+                Net* c_in_2 = copy->get_net_by_id(in_2->get_id());
+                Net* c_n_b = copy->get_net_by_id(n_b->get_id());
+                ASSERT_NE(c_n_a, nullptr);
+                ASSERT_NE(c_in_2, nullptr);
+                ASSERT_NE(c_n_b, nullptr);
+                EXPECT_TRUE(c_n_a->is_a_destination(c_or0, "I0"));
+                EXPECT_TRUE(c_n_b->is_a_source(c_or0, "O"));
+
+                EXPECT_TRUE(copy->is_global_input_net(c_n_a));
+                EXPECT_TRUE(copy->is_global_input_net(c_in_2));
+                EXPECT_TRUE(copy->is_global_output_net(c_n_b));
+                EXPECT_EQ(copy->get_top_module()->get_input_pins().size(), 2);
+                EXPECT_EQ(copy->get_top_module()->get_output_pins().size(), 1);
+
+                // new elements of the copy do not reuse IDs of the source netlist
+                EXPECT_EQ(nl->get_gate_by_id(copy->get_unique_gate_id()), nullptr);
+                EXPECT_EQ(nl->get_net_by_id(copy->get_unique_net_id()), nullptr);
+
+                // only the IDs of the copied elements are tracked as used
+                EXPECT_EQ(copy->get_used_gate_ids(), std::set<u32>({or0->get_id()}));
+            }
+            {
+                // IDs above the next ID of the source netlist are not reused either
+                Gate* far_gate = nl->create_gate(1000, gl->get_gate_type_by_name("BUF"), "far");
+                ASSERT_NE(far_gate, nullptr);
+                nl->set_next_gate_id(5);
+                auto res = decorator.copy_subgraph_netlist(std::vector<const Gate*>({or0}));
+                ASSERT_TRUE(res.is_ok());
+                std::unique_ptr<Netlist> copy = res.get();
+                EXPECT_GT(copy->get_unique_gate_id(), far_gate->get_id());
+
+                // IDs freed within the copy are still handed out first
+                ASSERT_TRUE(copy->delete_gate(copy->get_gate_by_id(or0->get_id())));
+                EXPECT_EQ(copy->get_unique_gate_id(), or0->get_id());
+                ASSERT_TRUE(nl->delete_gate(far_gate));
+            }
+            {
+                // copying the same gate twice fails
+                auto res = decorator.copy_subgraph_netlist(std::vector<const Gate*>({or0, or0}));
+                EXPECT_TRUE(res.is_error());
+            }
+            {
+                // batched copies equal individual copies
+                std::vector<std::vector<const Gate*>> subgraphs = {{and0}, {or0, inv0}, {buf0}, {and0, or0, inv0}};
+                auto res = decorator.copy_subgraph_netlists(subgraphs, 2);
+                ASSERT_TRUE(res.is_ok());
+                std::vector<std::unique_ptr<Netlist>> copies = res.get();
+                ASSERT_EQ(copies.size(), subgraphs.size());
+
+                for (u32 i = 0; i < subgraphs.size(); i++)
+                {
+                    auto single_res = decorator.copy_subgraph_netlist(subgraphs.at(i));
+                    ASSERT_TRUE(single_res.is_ok());
+                    std::unique_ptr<Netlist> single = single_res.get();
+
+                    ASSERT_NE(copies.at(i), nullptr);
+                    EXPECT_EQ(copies.at(i)->get_gates().size(), single->get_gates().size());
+                    EXPECT_EQ(copies.at(i)->get_nets().size(), single->get_nets().size());
+                    EXPECT_EQ(copies.at(i)->get_global_input_nets().size(), single->get_global_input_nets().size());
+                    EXPECT_EQ(copies.at(i)->get_global_output_nets().size(), single->get_global_output_nets().size());
+                }
+
+                EXPECT_EQ(copies.at(3)->get_nets().size(), 6);
+                EXPECT_EQ(copies.at(3)->get_global_input_nets().size(), 3);
+                EXPECT_EQ(copies.at(3)->get_global_output_nets().size(), 1);
+
+                // errors are reported for the respective subgraph
+                EXPECT_TRUE(decorator.copy_subgraph_netlists({{and0}, {or0, or0}}).is_error());
+                EXPECT_TRUE(decorator.copy_subgraph_netlists(std::vector<std::vector<const Gate*>>()).is_ok());
+            }
+            {
+                Module* m = nl->create_module("mod", nl->get_top_module(), {or0, inv0});
+                ASSERT_NE(m, nullptr);
+                auto res = decorator.copy_subgraph_netlists(std::vector<const Module*>({m}));
+                ASSERT_TRUE(res.is_ok());
+                std::vector<std::unique_ptr<Netlist>> copies = res.get();
+                ASSERT_EQ(copies.size(), 1);
+                EXPECT_EQ(copies.at(0)->get_gates().size(), 2);
+                EXPECT_EQ(copies.at(0)->get_nets().size(), 4);
+            }
+        }
+        TEST_END
+    }
 }
\ No newline at end of file
@@ -1,16 +1,23 @@
 #include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_library_cache.h"
 #include "hal_core/netlist/gate_library/gate_library_manager.h"
+#include "hal_core/netlist/gate_library/gate_library_parser/gate_library_parser_manager.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ff_component.h"
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/netlist/netlist_factory.h"
 #include "hal_core/plugin_system/plugin_manager.h"
 #include "hal_core/utilities/log.h"
 #include "hal_core/utilities/utils.h"
+#include "gate_library_test_utils.h"
 #include "netlist_test_utils.h"
 
 #include "gtest/gtest.h"
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <optional>
+#include <unistd.h>
 
 namespace hal
 {
@@ -19,11 +26,22 @@ namespace hal
     protected:
         // The path, where the library is temporary stored
         std::filesystem::path m_test_lib_path;
+        // The temporary cache home, so that the tests do not write to the cache of the user
+        std::filesystem::path m_test_cache_home;
+        std::optional<std::string> m_xdg_cache_home;
 
         virtual void SetUp()
         {
             NO_COUT_BLOCK;
             test_utils::init_log_channels();
+
+            if (const char* xdg_cache_home = getenv("XDG_CACHE_HOME"); xdg_cache_home != nullptr)
+            {
+                m_xdg_cache_home = xdg_cache_home;
+            }
+            m_test_cache_home = std::filesystem::temp_directory_path() / ("hal_test_cache_" + std::to_string(getpid()));
+            setenv("XDG_CACHE_HOME", m_test_cache_home.c_str(), 1);
+
             plugin_manager::load_all_plugins();
             m_test_lib_path = (utils::get_gate_library_directories()[0]) / "test1.lib";
         }
@@ -32,6 +50,16 @@ namespace hal
         {
             std::filesystem::remove(m_test_lib_path);
             plugin_manager::unload_all_plugins();
+
+            std::filesystem::remove_all(m_test_cache_home);
+            if (m_xdg_cache_home.has_value())
+            {
+                setenv("XDG_CACHE_HOME", m_xdg_cache_home->c_str(), 1);
+            }
+            else
+            {
+                unsetenv("XDG_CACHE_HOME");
+            }
         }
 
         /**
@@ -157,6 +185,7 @@ namespace hal
         {
             // Parse a file that does not contain a GND or VCC Gate type (constant 0 / constant 1)
             NO_COUT_TEST_BLOCK;
+            std::filesystem::remove(gate_library_cache::get_cache_path(m_test_lib_path));
             m_test_lib_path = (utils::get_gate_library_directories()[0]) / "test2.lib";
             std::ofstream test_lib(m_test_lib_path.string());
             test_lib << "/* This file only exists for testing purposes and should be already destroyed*/\n"
@@ -187,6 +216,146 @@ namespace hal
             EXPECT_TRUE(vcc_bf.at("O").has_constant_value(1));
         }
         std::filesystem::remove(m_test_lib_path);
+        std::filesystem::remove(gate_library_cache::get_cache_path(m_test_lib_path));
+        TEST_END
+    }
+
+    /**
+     * Testing the binary gate library cache by writing a gate library to the cache and reading it back.
+     *
+     * Functions: gate_library_cache::write, gate_library_cache::read, gate_library_cache::get_library_name, load
+     */
+    TEST_F(GateLibraryManagerTest, check_cache)
+    {
+        TEST_START
+        {
+            // write and read back a gate library containing all kinds of components and pin groups
+            NO_COUT_TEST_BLOCK;
+            create_test_lib();
+            std::unique_ptr<GateLibrary> gl = test_utils::create_gate_library(m_test_lib_path);
+            ASSERT_NE(gl, nullptr);
+
+            ASSERT_TRUE(gate_library_cache::write(gl.get(), m_test_lib_path).is_ok());
+            ASSERT_TRUE(gate_library_cache::is_valid(m_test_lib_path));
+
+            // the cache is written to the per-user cache directory instead of the library directory
+            EXPECT_EQ(gate_library_cache::get_cache_directory(), m_test_cache_home / "hal" / "gate_libraries");
+            EXPECT_EQ(gate_library_cache::get_cache_path(m_test_lib_path).parent_path(), gate_library_cache::get_cache_directory());
+            EXPECT_TRUE(std::filesystem::exists(gate_library_cache::get_cache_path(m_test_lib_path)));
+            EXPECT_FALSE(std::filesystem::exists(m_test_lib_path.parent_path() / gate_library_cache::get_cache_path(m_test_lib_path).filename()));
+            auto name_res = gate_library_cache::get_library_name(m_test_lib_path);
+            ASSERT_TRUE(name_res.is_ok());
+            EXPECT_EQ(name_res.get(), gl->get_name());
+
+            auto res = gate_library_cache::read(m_test_lib_path);
+            ASSERT_TRUE(res.is_ok());
+            std::unique_ptr<GateLibrary> cached_gl = res.get();
+
+            EXPECT_EQ(cached_gl->get_name(), gl->get_name());
+            EXPECT_EQ(cached_gl->get_path(), m_test_lib_path);
+            EXPECT_EQ(cached_gl->get_gate_location_data_category(), gl->get_gate_location_data_category());
+            EXPECT_EQ(cached_gl->get_gate_location_data_identifiers(), gl->get_gate_location_data_identifiers());
+            EXPECT_EQ(cached_gl->get_includes(), gl->get_includes());
+            ASSERT_EQ(cached_gl->get_gate_types().size(), gl->get_gate_types().size());
+            EXPECT_EQ(cached_gl->get_gnd_gate_types().size(), gl->get_gnd_gate_types().size());
+            EXPECT_EQ(cached_gl->get_vcc_gate_types().size(), gl->get_vcc_gate_types().size());
+
+            for (const auto& [name, gt] : gl->get_gate_types())
+            {
+                GateType* cached_gt = cached_gl->get_gate_type_by_name(name);
+                ASSERT_NE(cached_gt, nullptr);
+                EXPECT_EQ(cached_gt->get_id(), gt->get_id());
+                EXPECT_EQ(cached_gt->get_properties(), gt->get_properties());
+                EXPECT_EQ(cached_gt->get_boolean_functions(), gt->get_boolean_functions());
+
+                auto pins        = gt->get_pins();
+                auto cached_pins = cached_gt->get_pins();
+                ASSERT_EQ(cached_pins.size(), pins.size());
+                for (u32 i = 0; i < pins.size(); i++)
+                {
+                    EXPECT_EQ(*cached_pins.at(i), *pins.at(i));
+                }
+
+                auto groups        = gt->get_pin_groups();
+                auto cached_groups = cached_gt->get_pin_groups();
+                ASSERT_EQ(cached_groups.size(), groups.size());
+                for (u32 i = 0; i < groups.size(); i++)
+                {
+                    EXPECT_EQ(*cached_groups.at(i), *groups.at(i));
+                }
+
+                auto components        = gt->get_components();
+                auto cached_components = cached_gt->get_components();
+                ASSERT_EQ(cached_components.size(), components.size());
+                for (u32 i = 0; i < components.size(); i++)
+                {
+                    EXPECT_EQ(cached_components.at(i)->get_type(), components.at(i)->get_type());
+                }
+
+                if (FFComponent* ff = gt->get_component_as<FFComponent>([](const GateTypeComponent* c) { return FFComponent::is_class_of(c); }); ff != nullptr)
+                {
+                    FFComponent* cached_ff = cached_gt->get_component_as<FFComponent>([](const GateTypeComponent* c) { return FFComponent::is_class_of(c); });
+                    ASSERT_NE(cached_ff, nullptr);
+                    EXPECT_EQ(cached_ff->get_next_state_function(), ff->get_next_state_function());
+                    EXPECT_EQ(cached_ff->get_clock_function(), ff->get_clock_function());
+                    EXPECT_EQ(cached_ff->get_async_reset_function(), ff->get_async_reset_function());
+                    EXPECT_EQ(cached_ff->get_async_set_function(), ff->get_async_set_function());
+                    EXPECT_EQ(cached_ff->get_async_set_reset_behavior(), ff->get_async_set_reset_behavior());
+                }
+            }
+        }
+        {
+            // the cache is invalidated once the source file changes
+            NO_COUT_TEST_BLOCK;
+            create_test_lib();
+            std::unique_ptr<GateLibrary> gl = test_utils::create_gate_library(m_test_lib_path);
+            ASSERT_TRUE(gate_library_cache::write(gl.get(), m_test_lib_path).is_ok());
+            ASSERT_TRUE(gate_library_cache::read(m_test_lib_path).is_ok());
+
+            std::ofstream test_lib(m_test_lib_path.string(), std::ios::app);
+            test_lib << "\n/* modified */\n";
+            test_lib.close();
+
+            EXPECT_FALSE(gate_library_cache::is_valid(m_test_lib_path));
+            EXPECT_TRUE(gate_library_cache::read(m_test_lib_path).is_error());
+        }
+        {
+            // loading a gate library creates its cache, which is then used by further loads
+            NO_COUT_TEST_BLOCK;
+            create_test_lib();
+            std::filesystem::remove(gate_library_cache::get_cache_path(m_test_lib_path));
+            GateLibrary* test_lib = gate_library_manager::load(m_test_lib_path, true);
+            ASSERT_NE(test_lib, nullptr);
+            EXPECT_TRUE(gate_library_cache::is_valid(m_test_lib_path));
+
+            gate_library_manager::remove(m_test_lib_path);
+            GateLibrary* cached_lib = gate_library_manager::load(m_test_lib_path);
+            ASSERT_NE(cached_lib, nullptr);
+            EXPECT_EQ(cached_lib->get_name(), "example_lib");
+            EXPECT_EQ(cached_lib->get_gnd_gate_types().size(), 1);
+            EXPECT_EQ(cached_lib->get_vcc_gate_types().size(), 1);
+        }
+        {
+            // the cache is invalidated once the responsible parser changes its version
+            NO_COUT_TEST_BLOCK;
+            create_test_lib();
+            std::unique_ptr<GateLibrary> gl = test_utils::create_gate_library(m_test_lib_path);
+            std::filesystem::path test_path = m_test_lib_path;
+            test_path.replace_extension(".testlib");
+            std::filesystem::copy_file(m_test_lib_path, test_path, std::filesystem::copy_options::overwrite_existing);
+
+            gate_library_parser_manager::register_parser("test_parser", []() { return nullptr; }, {".testlib"}, "1.0");
+            ASSERT_TRUE(gate_library_cache::write(gl.get(), test_path).is_ok());
+            EXPECT_TRUE(gate_library_cache::is_valid(test_path));
+
+            gate_library_parser_manager::unregister_parser("test_parser");
+            gate_library_parser_manager::register_parser("test_parser", []() { return nullptr; }, {".testlib"}, "2.0");
+            EXPECT_FALSE(gate_library_cache::is_valid(test_path));
+            EXPECT_TRUE(gate_library_cache::read(test_path).is_error());
+
+            gate_library_parser_manager::unregister_parser("test_parser");
+            std::filesystem::remove(test_path);
+        }
         TEST_END
     }
 
@@ -1173,6 +1173,25 @@ namespace hal {
                 EXPECT_EQ(in_group->get_index(in_pin_1).get(), 2);
                 EXPECT_EQ(in_group->get_pin_at_index(1).get(), in_pin_0);
                 EXPECT_EQ(in_group->get_pin_at_index(2).get(), in_pin_1);
+
+                // reorder all pins of group at once
+                EXPECT_TRUE(in_group->reorder_pins({in_pin_0, in_pin_1}).is_ok());
+                EXPECT_EQ(in_group->get_pins(), std::vector<ModulePin*>({in_pin_0, in_pin_1}));
+                EXPECT_EQ(in_pin_0->get_group(), std::pair(in_group, i32(2)));
+                EXPECT_EQ(in_pin_1->get_group(), std::pair(in_group, i32(1)));
+                EXPECT_EQ(in_group->get_pin_at_index(2).get(), in_pin_0);
+                EXPECT_EQ(in_group->get_pin_at_index(1).get(), in_pin_1);
+                EXPECT_TRUE(in_group->reorder_pins({in_pin_0}).is_error());
+                EXPECT_TRUE(in_group->reorder_pins({in_pin_0, in_pin_0}).is_error());
+                EXPECT_TRUE(in_group->reorder_pins({in_pin_0, out_pin_0}).is_error());
+                EXPECT_EQ(in_group->get_pins(), std::vector<ModulePin*>({in_pin_0, in_pin_1}));
+
+                EXPECT_TRUE(m_1->reorder_pins_within_group(in_group, {in_pin_1, in_pin_0}).is_ok());
+                EXPECT_EQ(in_group->get_pins(), std::vector<ModulePin*>({in_pin_1, in_pin_0}));
+                EXPECT_EQ(in_pin_0->get_group(), std::pair(in_group, i32(1)));
+                EXPECT_EQ(in_pin_1->get_group(), std::pair(in_group, i32(2)));
+                EXPECT_TRUE(m_1->reorder_pins_within_group(nullptr, {in_pin_1, in_pin_0}).is_error());
+                EXPECT_TRUE(m_1->reorder_pins_within_group(in_group, {in_pin_1}).is_error());
             }
         }
         TEST_END
@@ -1611,6 +1611,216 @@ namespace hal {
         TEST_END
     }
 
+    /**
+     * Testing the name-based lookup of gates, nets, and modules with and without the name index.
+     *
+     * Functions: enable_name_index, is_name_index_enabled, get_gates_by_name, get_gates_by_name_prefix, get_gates_by_hierarchy, get_nets_by_name,
+     *            get_nets_by_name_prefix, get_nets_by_hierarchy, get_modules_by_name, get_modules_by_name_prefix, get_modules_by_hierarchy
+     */
+    TEST_F(NetlistTest, check_name_lookup) {
+        TEST_START
+            for (bool use_index : {false, true})
+            {
+                auto nl = test_utils::create_empty_netlist();
+                const GateLibrary* gl = nl->get_gate_library();
+                EXPECT_FALSE(nl->is_name_index_enabled());
+
+                Gate* g_add_0 = nl->create_gate(gl->get_gate_type_by_name("BUF"), "cpu/alu/add_0");
+                Gate* g_add_1 = nl->create_gate(gl->get_gate_type_by_name("BUF"), "cpu/alu/add_1");
+                Gate* g_reg   = nl->create_gate(gl->get_gate_type_by_name("BUF"), "cpu/reg");
+                Gate* g_other = nl->create_gate(gl->get_gate_type_by_name("BUF"), "cpuX/reg");
+                Gate* g_dup   = nl->create_gate(gl->get_gate_type_by_name("BUF"), "cpu/reg");
+
+                if (use_index)
+                {
+                    // gates created before enabling the index must be found as well
+                    nl->enable_name_index(true);
+                    EXPECT_TRUE(nl->is_name_index_enabled());
+                }
+
+                Net* n_0 = nl->create_net("cpu/n_0");
+                Net* n_1 = nl->create_net("cpu/alu/n_1");
+                Module* m_cpu = nl->create_module("cpu", nl->get_top_module(), {});
+                Module* m_alu = nl->create_module("cpu/alu", m_cpu, {});
+
+                // exact name
+                EXPECT_EQ(nl->get_gates_by_name("cpu/alu/add_0"), std::vector<Gate*>({g_add_0}));
+                EXPECT_EQ(nl->get_gates_by_name("cpu/reg"), std::vector<Gate*>({g_reg, g_dup}));
+                EXPECT_TRUE(nl->get_gates_by_name("cpu").empty());
+                EXPECT_EQ(nl->get_nets_by_name("cpu/n_0"), std::vector<Net*>({n_0}));
+                EXPECT_EQ(nl->get_modules_by_name("cpu"), std::vector<Module*>({m_cpu}));
+                EXPECT_EQ(nl->get_modules_by_name("top_module"), std::vector<Module*>({nl->get_top_module()}));
+
+                // prefix
+                EXPECT_EQ(nl->get_gates_by_name_prefix("cpu/alu/"), std::vector<Gate*>({g_add_0, g_add_1}));
+                EXPECT_EQ(nl->get_gates_by_name_prefix("cpu").size(), 5);
+                EXPECT_TRUE(nl->get_gates_by_name_prefix("gpu").empty());
+                EXPECT_EQ(nl->get_modules_by_name_prefix("cpu"), std::vector<Module*>({m_cpu, m_alu}));
+
+                // hierarchy
+                EXPECT_EQ(nl->get_gates_by_hierarchy("cpu/alu"), std::vector<Gate*>({g_add_0, g_add_1}));
+                EXPECT_EQ(nl->get_gates_by_hierarchy("cpu").size(), 4);
+                EXPECT_EQ(nl->get_gates_by_hierarchy("cpu", "/", false), std::vector<Gate*>({g_reg, g_dup}));
+                EXPECT_EQ(nl->get_gates_by_hierarchy("", "/", false), std::vector<Gate*>());
+                EXPECT_EQ(nl->get_gates_by_hierarchy("").size(), 5);
+                EXPECT_EQ(nl->get_nets_by_hierarchy("cpu", "/", false), std::vector<Net*>({n_0}));
+                EXPECT_EQ(nl->get_nets_by_hierarchy("cpu"), std::vector<Net*>({n_1, n_0}));
+                EXPECT_EQ(nl->get_modules_by_hierarchy("cpu"), std::vector<Module*>({m_alu}));
+                EXPECT_EQ(nl->get_gates_by_hierarchy("cpu.alu", ".").size(), 0);
+
+                // renaming
+                g_add_1->set_name("cpu/mul_0");
+                EXPECT_TRUE(nl->get_gates_by_name("cpu/alu/add_1").empty());
+                EXPECT_EQ(nl->get_gates_by_name("cpu/mul_0"), std::vector<Gate*>({g_add_1}));
+                EXPECT_EQ(nl->get_gates_by_hierarchy("cpu/alu"), std::vector<Gate*>({g_add_0}));
+                n_1->set_name("n_1");
+                EXPECT_EQ(nl->get_nets_by_hierarchy("cpu"), std::vector<Net*>({n_0}));
+                // equal names stay ordered by ID
+                g_reg->set_name("cpu/tmp");
+                g_reg->set_name("cpu/reg");
+                EXPECT_EQ(nl->get_gates_by_name("cpu/reg"), std::vector<Gate*>({g_reg, g_dup}));
+                EXPECT_EQ(nl->get_gates_by_name_prefix("cpu/reg"), std::vector<Gate*>({g_reg, g_dup}));
+                m_alu->set_name("alu");
+                EXPECT_EQ(nl->get_modules_by_name("alu"), std::vector<Module*>({m_alu}));
+                EXPECT_TRUE(nl->get_modules_by_name("cpu/alu").empty());
+
+                // deleting
+                ASSERT_TRUE(nl->delete_gate(g_dup));
+                EXPECT_EQ(nl->get_gates_by_name("cpu/reg"), std::vector<Gate*>({g_reg}));
+                ASSERT_TRUE(nl->delete_net(n_0));
+                EXPECT_TRUE(nl->get_nets_by_name("cpu/n_0").empty());
+                ASSERT_TRUE(nl->delete_module(m_alu));
+                EXPECT_TRUE(nl->get_modules_by_name("alu").empty());
+
+                // the index is carried over to copies
+                auto copy = nl->copy();
+                ASSERT_TRUE(copy.is_ok());
+                auto nl_copy = copy.get();
+                EXPECT_EQ(nl_copy->is_name_index_enabled(), use_index);
+                ASSERT_EQ(nl_copy->get_gates_by_name("cpu/reg").size(), 1);
+                EXPECT_EQ(nl_copy->get_gates_by_name("cpu/reg").front()->get_id(), g_reg->get_id());
+
+                // disabling the index falls back to searching all objects
+                nl->enable_name_index(false);
+                EXPECT_FALSE(nl->is_name_index_enabled());
+                EXPECT_EQ(nl->get_gates_by_name_prefix("cpu/"), std::vector<Gate*>({g_add_0, g_add_1, g_reg}));
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing the full-text search over gates, nets, and modules with and without search index.
+     *
+     * Functions: search, enable_search_index, is_search_index_enabled
+     */
+    TEST_F(NetlistTest, check_search) {
+        TEST_START
+            for (bool use_index : {false, true})
+            {
+                auto nl = test_utils::create_empty_netlist();
+                const GateLibrary* gl = nl->get_gate_library();
+                EXPECT_FALSE(nl->is_search_index_enabled());
+
+                Gate* g_add = nl->create_gate(gl->get_gate_type_by_name("AND2"), "alu_add_0");
+                Gate* g_buf = nl->create_gate(gl->get_gate_type_by_name("BUF"), "ALU_buf");
+                g_buf->set_data("generic", "comment", "string", "critical path");
+
+                if (use_index)
+                {
+                    // gates created before enabling the index must be found as well
+                    nl->enable_search_index(true);
+                    EXPECT_TRUE(nl->is_search_index_enabled());
+                }
+
+                Net* n_in  = nl->create_net("alu_in");
+                Net* n_out = nl->create_net("result");
+                n_in->add_destination(g_add, "I0");
+                n_out->add_source(g_add, "O");
+                nl->mark_global_input_net(n_in);
+                Module* m_alu = nl->create_module("alu", nl->get_top_module(), {g_add});
+                m_alu->set_type("arithmetic");
+
+                auto search = [&nl](const std::string& text, u8 fields = SearchIndex::Field::all, bool case_sensitive = false, bool exact_match = false, bool regex = false) {
+                    auto res = nl->search(text, fields, case_sensitive, exact_match, regex);
+                    EXPECT_TRUE(res.is_ok());
+                    return res.is_ok() ? res.get() : SearchIndex::Matches();
+                };
+
+                // substring, case-insensitive by default
+                auto matches = search("alu");
+                EXPECT_EQ(matches.gates, std::vector<u32>({g_add->get_id(), g_buf->get_id()}));
+                EXPECT_EQ(matches.nets, std::vector<u32>({n_in->get_id()}));
+                EXPECT_EQ(matches.modules, std::vector<u32>({m_alu->get_id()}));
+                EXPECT_EQ(search("alu", SearchIndex::Field::all, true).gates, std::vector<u32>({g_add->get_id()}));
+                EXPECT_EQ(search("al", SearchIndex::Field::name, true).gates, std::vector<u32>({g_add->get_id()}));
+                EXPECT_TRUE(search("xyz").gates.empty());
+
+                // fields
+                EXPECT_EQ(search("and", SearchIndex::Field::type).gates, std::vector<u32>({g_add->get_id()}));
+                EXPECT_TRUE(search("and", SearchIndex::Field::name).gates.empty());
+                EXPECT_EQ(search("I1", SearchIndex::Field::pin).gates, std::vector<u32>({g_add->get_id()}));
+                EXPECT_EQ(search("critical", SearchIndex::Field::data).gates, std::vector<u32>({g_buf->get_id()}));
+                EXPECT_TRUE(search("critical", SearchIndex::Field::name | SearchIndex::Field::type).gates.empty());
+                EXPECT_EQ(search("arith", SearchIndex::Field::type).modules, std::vector<u32>({m_alu->get_id()}));
+
+                // exact match
+                EXPECT_EQ(search("ALU_BUF", SearchIndex::Field::all, false, true).gates, std::vector<u32>({g_buf->get_id()}));
+                EXPECT_TRUE(search("ALU_BUF", SearchIndex::Field::all, true, true).gates.empty());
+                EXPECT_TRUE(search("alu_add", SearchIndex::Field::all, false, true).gates.empty());
+
+                // regular expressions
+                EXPECT_EQ(search("^alu_[a-z]+_0$", SearchIndex::Field::name, false, false, true).gates, std::vector<u32>({g_add->get_id()}));
+                EXPECT_EQ(search("alu_(add|buf)", SearchIndex::Field::name, true, false, true).gates, std::vector<u32>({g_add->get_id()}));
+                EXPECT_EQ(search("resu?lt", SearchIndex::Field::name, false, false, true).nets, std::vector<u32>({n_out->get_id()}));
+                EXPECT_TRUE(nl->search("alu_(", SearchIndex::Field::all, false, false, true).is_error());
+
+                // exact matches take precedence over regular expressions
+                EXPECT_TRUE(search("alu_[a-z]+_0", SearchIndex::Field::name, false, true, true).gates.empty());
+                EXPECT_EQ(search("ALU_BUF", SearchIndex::Field::name, false, true, true).gates, std::vector<u32>({g_buf->get_id()}));
+                EXPECT_TRUE(nl->search("alu_(", SearchIndex::Field::all, false, true, true).is_ok());
+
+                // modifications
+                g_add->set_name("mul_0");
+                EXPECT_EQ(search("alu", SearchIndex::Field::name).gates, std::vector<u32>({g_buf->get_id()}));
+                EXPECT_EQ(search("mul", SearchIndex::Field::name).gates, std::vector<u32>({g_add->get_id()}));
+                g_buf->delete_data("generic", "comment");
+                EXPECT_TRUE(search("critical").gates.empty());
+                n_out->set_data("generic", "comment", "string", "critical net");
+                EXPECT_EQ(search("critical").nets, std::vector<u32>({n_out->get_id()}));
+                m_alu->set_type("logic");
+                EXPECT_TRUE(search("arith").modules.empty());
+                ModulePin* pin = m_alu->get_pin_by_net(n_in);
+                ASSERT_NE(pin, nullptr);
+                EXPECT_TRUE(m_alu->set_pin_name(pin, "operand_a"));
+                EXPECT_EQ(search("operand", SearchIndex::Field::pin).modules, std::vector<u32>({m_alu->get_id()}));
+
+                // deleting
+                const u32 add_id = g_add->get_id();
+                ASSERT_TRUE(nl->delete_gate(g_add));
+                EXPECT_TRUE(search("I1", SearchIndex::Field::pin).gates.empty());
+                Gate* g_new = nl->create_gate(add_id, gl->get_gate_type_by_name("BUF"), "new_gate");
+                ASSERT_NE(g_new, nullptr);
+                EXPECT_TRUE(search("mul").gates.empty());
+                EXPECT_EQ(search("new_gate").gates, std::vector<u32>({add_id}));
+                ASSERT_TRUE(nl->delete_module(m_alu));
+                EXPECT_TRUE(search("logic").modules.empty());
+
+                // the index is carried over to copies
+                auto copy = nl->copy();
+                ASSERT_TRUE(copy.is_ok());
+                auto nl_copy = copy.get();
+                EXPECT_EQ(nl_copy->is_search_index_enabled(), use_index);
+                auto copy_res = nl_copy->search("new_gate");
+                ASSERT_TRUE(copy_res.is_ok());
+                EXPECT_EQ(copy_res.get().gates, std::vector<u32>({add_id}));
+
+                nl->enable_search_index(false);
+                EXPECT_FALSE(nl->is_search_index_enabled());
+                EXPECT_EQ(search("ALU").gates, std::vector<u32>({g_buf->get_id()}));
+            }
+        TEST_END
+    }
+
     /*************************************
      * Event System
      *************************************/
@@ -1698,4 +1908,228 @@ namespace hal {
         TEST_END
     }
 
+    /**
+     * Testing the batched delivery of coalesced events.
+     *
+     * Functions: set_batching_enabled, is_batching_enabled, flush, register_batch_callback, defer_destruction, EventBatch::get_id_ranges, EventBatchGuard
+     */
+    TEST_F(NetlistTest, check_batched_events) {
+        TEST_START
+            {
+                auto nl = test_utils::create_empty_netlist();
+                const GateLibrary* gl = nl->get_gate_library();
+                EventHandler* eh = nl->get_event_handler();
+                EXPECT_FALSE(eh->is_batching_enabled());
+
+                // a subscriber without a batch callback, which gets the batched events replayed
+                using GateEvents = std::vector<std::tuple<GateEvent::event, u32, std::string>>;
+                GateEvents replayed_events;
+                eh->register_callback("test_gate_cb",
+                                      std::function<void(GateEvent::event, Gate*, u32)>([&replayed_events](GateEvent::event e, Gate* g, u32) { replayed_events.emplace_back(e, g->get_id(), g->get_name()); }));
+
+                // a subscriber with a batch callback, its per-event callback is only executed while batching is disabled
+                u32 num_gate_events = 0;
+                eh->register_callback("test_batch_cb", std::function<void(GateEvent::event, Gate*, u32)>([&num_gate_events](GateEvent::event, Gate*, u32) { num_gate_events++; }));
+
+                // record the gate events of each batch as (event, id, name) while the gates are still alive
+                std::vector<GateEvents> batches;
+                std::vector<u32> num_batch_events;
+                std::vector<std::vector<std::pair<u32, u32>>> created_ranges;
+                eh->register_batch_callback("test_batch_cb", [&batches, &num_batch_events, &created_ranges](const EventBatch& batch) {
+                    auto& gate_events = batches.emplace_back();
+                    for (const auto& entry : batch.events)
+                    {
+                        if (const auto* e = std::get_if<EventBatch::Event<GateEvent::event, Gate>>(&entry); e != nullptr)
+                        {
+                            gate_events.emplace_back(e->event, e->object->get_id(), e->object->get_name());
+                        }
+                    }
+                    num_batch_events.push_back(batch.num_events);
+                    created_ranges.push_back(batch.get_id_ranges(GateEvent::event::created));
+                });
+
+                // nothing is queued while batching is disabled
+                Gate* g_1 = nl->create_gate(1, gl->get_gate_type_by_name("BUF"), "gate_1");
+                eh->flush();
+                EXPECT_TRUE(batches.empty());
+                EXPECT_EQ(num_gate_events, 1);
+                EXPECT_EQ(replayed_events.size(), 1);
+
+                // per-event callbacks are not executed while batching
+                eh->set_batching_enabled(true);
+                EXPECT_TRUE(eh->is_batching_enabled());
+                Gate* g_2 = nl->create_gate(2, gl->get_gate_type_by_name("BUF"), "gate_2");
+                g_1->set_name("gate_1_renamed");
+                g_1->set_name("gate_1_renamed_again");
+                g_2->set_name("gate_2_renamed");
+                g_1->set_name("gate_1_renamed_once_more");
+                EXPECT_EQ(num_gate_events, 1);
+                EXPECT_EQ(replayed_events.size(), 1);
+                EXPECT_TRUE(batches.empty());
+
+                // events are delivered in order, repeated events of an object are coalesced, and subscribers without a batch callback get them replayed
+                eh->flush();
+                const GateEvents expected_events = {{GateEvent::event::created, 2, "gate_2_renamed"},
+                                                    {GateEvent::event::name_changed, 1, "gate_1_renamed_once_more"},
+                                                    {GateEvent::event::name_changed, 2, "gate_2_renamed"}};
+                ASSERT_EQ(batches.size(), 1);
+                EXPECT_EQ(batches.at(0), expected_events);
+                // created gate_2 is also assigned to the top module
+                EXPECT_EQ(num_batch_events.at(0), 6);
+                EXPECT_EQ(num_gate_events, 1);
+                ASSERT_EQ(replayed_events.size(), 4);
+                EXPECT_EQ(GateEvents(replayed_events.begin() + 1, replayed_events.end()), expected_events);
+
+                // flushing without queued events does not deliver a batch
+                eh->flush();
+                EXPECT_EQ(batches.size(), 1);
+
+                // removing an object does not deliver the batch, the object is kept alive until delivery even if its ID is reused in the meantime
+                g_2->set_name("gate_2_removed");
+                nl->delete_gate(g_2);
+                EXPECT_EQ(batches.size(), 1);
+
+                Gate* g_2_new = nl->create_gate(2, gl->get_gate_type_by_name("BUF"), "gate_2_new");
+                ASSERT_NE(g_2_new, nullptr);
+                EXPECT_NE(g_2_new, g_2);
+                EXPECT_EQ(batches.size(), 1);
+
+                // disabling batching flushes the queue
+                eh->set_batching_enabled(false);
+                EXPECT_FALSE(eh->is_batching_enabled());
+                ASSERT_EQ(batches.size(), 2);
+                EXPECT_EQ(batches.at(1),
+                          (GateEvents{{GateEvent::event::name_changed, 2, "gate_2_removed"}, {GateEvent::event::removed, 2, "gate_2_removed"}, {GateEvent::event::created, 2, "gate_2_new"}}));
+                EXPECT_EQ(replayed_events.size(), 7);
+
+                // per-event callbacks are executed again
+                nl->delete_gate(g_1);
+                EXPECT_EQ(num_gate_events, 2);
+                EXPECT_EQ(replayed_events.size(), 8);
+                EXPECT_EQ(batches.size(), 2);
+
+                // the IDs of the affected objects are compressed into ranges, guards enable batching until the outermost guard is destroyed
+                {
+                    EventBatchGuard guard(eh);
+                    EXPECT_TRUE(eh->is_batching_enabled());
+                    for (u32 id : {12, 10, 14, 11, 13, 16})
+                    {
+                        nl->create_gate(id, gl->get_gate_type_by_name("BUF"), "gate_" + std::to_string(id));
+                    }
+                    {
+                        EventBatchGuard nested_guard(eh);
+                        nl->create_gate(20, gl->get_gate_type_by_name("BUF"), "gate_20");
+                    }
+                    EXPECT_TRUE(eh->is_batching_enabled());
+                    EXPECT_EQ(batches.size(), 2);
+                }
+                EXPECT_FALSE(eh->is_batching_enabled());
+                ASSERT_EQ(batches.size(), 3);
+                EXPECT_EQ(created_ranges.at(2), (std::vector<std::pair<u32, u32>>{{10, 14}, {16, 16}, {20, 20}}));
+
+                eh->unregister_callback("test_gate_cb");
+                eh->unregister_callback("test_batch_cb");
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing the coalescing of interleaved events of different types on the same objects.
+     *
+     * Functions: set_batching_enabled, register_batch_callback, EventBatch::get_id_ranges
+     */
+    TEST_F(NetlistTest, check_batched_events_interleaved) {
+        TEST_START
+            {
+                auto nl = test_utils::create_empty_netlist();
+                const GateLibrary* gl = nl->get_gate_library();
+                EventHandler* eh = nl->get_event_handler();
+
+                Gate* g = nl->create_gate(1, gl->get_gate_type_by_name("BUF"), "gate");
+                Net* n = nl->create_net(1, "net");
+                Module* top = nl->get_top_module();
+                Module* m = nl->create_module(2, "mod", top);
+                ASSERT_NE(g, nullptr);
+                ASSERT_NE(n, nullptr);
+                ASSERT_NE(m, nullptr);
+
+                // record the events of the gate, the net, and both modules as (event, id, associated data)
+                using GateEvents   = std::vector<std::tuple<GateEvent::event, u32, u32>>;
+                using NetEvents    = std::vector<std::tuple<NetEvent::event, u32, u32>>;
+                using ModuleEvents = std::vector<std::tuple<ModuleEvent::event, u32, u32>>;
+                GateEvents gate_events;
+                NetEvents net_events;
+                ModuleEvents module_events;
+                std::vector<std::pair<u32, u32>> assigned_ranges;
+                eh->register_batch_callback("test_batch_cb", [&](const EventBatch& batch) {
+                    for (const auto& entry : batch.events)
+                    {
+                        if (const auto* e = std::get_if<EventBatch::Event<GateEvent::event, Gate>>(&entry); e != nullptr)
+                        {
+                            gate_events.emplace_back(e->event, e->object->get_id(), e->associated_data);
+                        }
+                        else if (const auto* e = std::get_if<EventBatch::Event<NetEvent::event, Net>>(&entry); e != nullptr)
+                        {
+                            net_events.emplace_back(e->event, e->object->get_id(), e->associated_data);
+                        }
+                        else if (const auto* e = std::get_if<EventBatch::Event<ModuleEvent::event, Module>>(&entry); e != nullptr && e->event != ModuleEvent::event::pin_changed)
+                        {
+                            module_events.emplace_back(e->event, e->object->get_id(), e->associated_data);
+                        }
+                    }
+                    assigned_ranges = batch.get_id_ranges(ModuleEvent::event::gate_assigned);
+                });
+
+                {
+                    EventBatchGuard guard(eh);
+
+                    // alternating state changes of an object are each delivered once
+                    g->set_name("gate_a");
+                    g->set_location_x(1);
+                    g->set_name("gate_b");
+                    g->set_location_x(2);
+                    m->set_name("mod_a");
+                    m->set_type("type");
+                    m->set_name("mod_b");
+
+                    // connecting a gate to another pin of the same net is not cancelled out
+                    ASSERT_NE(n->add_destination(g, "I"), nullptr);
+                    ASSERT_TRUE(n->remove_destination(g, "I"));
+                    ASSERT_NE(n->add_destination(g, "I"), nullptr);
+
+                    // moving the gate into the module, back to the top module, and into the module again
+                    ASSERT_TRUE(m->assign_gate(g));
+                    ASSERT_TRUE(top->assign_gate(g));
+                    ASSERT_TRUE(m->assign_gate(g));
+                }
+
+                EXPECT_EQ(gate_events, (GateEvents{{GateEvent::event::name_changed, 1, 0xFFFFFFFF}, {GateEvent::event::location_changed, 1, 0xFFFFFFFF}}));
+                EXPECT_EQ(net_events,
+                          (NetEvents{{NetEvent::event::dst_added, 1, 1}, {NetEvent::event::dst_removed, 1, 1}, {NetEvent::event::dst_added, 1, 1}}));
+
+                // the assignment to the module undone by the move back is dropped along with its removal, the delimiting events are kept
+                const ModuleEvents expected_module_events = {{ModuleEvent::event::name_changed, 2, 0xFFFFFFFF},
+                                                             {ModuleEvent::event::type_changed, 2, 0xFFFFFFFF},
+                                                             {ModuleEvent::event::gates_assign_begin, 2, 1},
+                                                             {ModuleEvent::event::gates_remove_begin, 1, 1},
+                                                             {ModuleEvent::event::gate_removed, 1, 1},
+                                                             {ModuleEvent::event::gates_assign_end, 2, 1},
+                                                             {ModuleEvent::event::gates_remove_end, 1, 1},
+                                                             {ModuleEvent::event::gates_assign_begin, 1, 1},
+                                                             {ModuleEvent::event::gates_remove_begin, 2, 1},
+                                                             {ModuleEvent::event::gates_assign_end, 1, 1},
+                                                             {ModuleEvent::event::gates_remove_end, 2, 1},
+                                                             {ModuleEvent::event::gates_assign_begin, 2, 1},
+                                                             {ModuleEvent::event::gates_remove_begin, 1, 1},
+                                                             {ModuleEvent::event::gate_assigned, 2, 1},
+                                                             {ModuleEvent::event::gates_assign_end, 2, 1},
+                                                             {ModuleEvent::event::gates_remove_end, 1, 1}};
+                EXPECT_EQ(module_events, expected_module_events);
+                EXPECT_EQ(assigned_ranges, (std::vector<std::pair<u32, u32>>{{2, 2}}));
+
+                eh->unregister_callback("test_batch_cb");
+            }
+        TEST_END
+    }
+
 } //namespace hal
@@ -0,0 +1,298 @@
+#include "hal_core/netlist/netlist_transaction.h"
+
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/grouping.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "netlist_test_utils.h"
+
+#include "gtest/gtest.h"
+
+namespace hal
+{
+    using test_utils::MIN_GATE_ID;
+    using test_utils::MIN_MODULE_ID;
+    using test_utils::MIN_NET_ID;
+
+    class NetlistTransactionTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp()
+        {
+            test_utils::init_log_channels();
+        }
+
+        virtual void TearDown()
+        {
+        }
+
+        // example netlist with a submodule containing gates 0 and 3 and a grouping containing gate 4
+        std::unique_ptr<Netlist> create_netlist()
+        {
+            auto nl = test_utils::create_example_netlist();
+            nl->create_module("mod", nl->get_top_module(), {nl->get_gate_by_id(MIN_GATE_ID + 0), nl->get_gate_by_id(MIN_GATE_ID + 3)});
+            Grouping* grouping = nl->create_grouping("grouping");
+            grouping->assign_gate(nl->get_gate_by_id(MIN_GATE_ID + 4));
+            nl->mark_global_input_net(nl->get_net_by_id(MIN_NET_ID + 13));
+            return nl;
+        }
+
+        // describes all pins of a module including their IDs, nets, and positions within their groups
+        std::vector<std::string> describe_pins(const Module* module)
+        {
+            std::vector<std::string> result;
+            for (const PinGroup<ModulePin>* pin_group : module->get_pin_groups())
+            {
+                for (const ModulePin* pin : pin_group->get_pins())
+                {
+                    result.push_back(pin_group->get_name() + "/" + std::to_string(pin->get_id()) + ":" + pin->get_name() + ":" + std::to_string(pin->get_net()->get_id()) + ":"
+                                     + std::to_string(pin->get_group().second));
+                }
+            }
+            return result;
+        }
+    };
+
+    /**
+     * Testing that discarding a transaction restores the original netlist.
+     *
+     * Functions: NetlistTransaction, discard, is_active
+     */
+    TEST_F(NetlistTransactionTest, check_discard)
+    {
+        TEST_START
+        {
+            auto nl   = create_netlist();
+            auto copy = nl->copy().get();
+
+            Module* mod                         = nl->get_module_by_id(MIN_MODULE_ID);
+            const std::vector<std::string> pins = describe_pins(mod);
+            const u32 next_gate_id              = nl->get_unique_gate_id();
+            const u32 next_net_id               = nl->get_unique_net_id();
+            const u32 next_module_id            = nl->get_unique_module_id();
+            const u32 next_grouping_id          = nl->get_unique_grouping_id();
+
+            Gate* gate_0 = nl->get_gate_by_id(MIN_GATE_ID + 0);
+            Gate* gate_3 = nl->get_gate_by_id(MIN_GATE_ID + 3);
+            Gate* gate_5 = nl->get_gate_by_id(MIN_GATE_ID + 5);
+            Gate* gate_8 = nl->get_gate_by_id(MIN_GATE_ID + 8);
+
+            {
+                NetlistTransaction transaction(nl.get());
+                EXPECT_TRUE(transaction.is_active());
+
+                // modify attributes
+                nl->set_design_name("changed");
+                gate_0->set_name("renamed");
+                gate_0->set_location({10, 20});
+                gate_0->set_data("category", "key", "string", "value");
+                gate_0->delete_data("a", "b");
+                nl->mark_gnd_gate(gate_5);
+                nl->get_net_by_id(MIN_NET_ID + 30)->set_name("renamed_net");
+                nl->unmark_global_input_net(nl->get_net_by_id(MIN_NET_ID + 13));
+                nl->mark_global_output_net(nl->get_net_by_id(MIN_NET_ID + 78));
+                mod->set_type("changed");
+                mod->set_pin_name(mod->get_pins().front(), "renamed_pin");
+
+                // modify connections
+                Net* net_0_4_5 = nl->get_net_by_id(MIN_NET_ID + 045);
+                net_0_4_5->remove_destination(gate_5, "I0");
+                nl->get_net_by_id(MIN_NET_ID + 78)->add_destination(gate_5, "I0");
+
+                // create and delete objects
+                ASSERT_TRUE(nl->delete_gate(nl->get_gate_by_id(MIN_GATE_ID + 4)));
+                ASSERT_TRUE(nl->delete_net(nl->get_net_by_id(MIN_NET_ID + 20)));
+                Gate* new_gate = nl->create_gate(nl->get_gate_library()->get_gate_type_by_name("AND2"), "new_gate");
+                Net* new_net   = nl->create_net("new_net");
+                new_net->add_source(gate_8, "O");
+                new_net->add_destination(new_gate, "I0");
+                Module* new_mod = nl->create_module("new_mod", mod, {gate_3, new_gate});
+                ASSERT_NE(new_mod, nullptr);
+                ASSERT_TRUE(nl->delete_module(mod));
+                nl->create_grouping("new_grouping")->assign_gate(gate_0);
+                nl->get_grouping_by_id(1)->set_color({1, 2, 3});
+
+                EXPECT_NE(*nl, *copy);
+                EXPECT_TRUE(transaction.discard().is_ok());
+                EXPECT_FALSE(transaction.is_active());
+                EXPECT_TRUE(transaction.discard().is_error());
+            }
+
+            EXPECT_EQ(*nl, *copy);
+            EXPECT_EQ(nl->get_design_name(), copy->get_design_name());
+            EXPECT_EQ(nl->get_gates().size(), copy->get_gates().size());
+            EXPECT_EQ(nl->get_nets().size(), copy->get_nets().size());
+            EXPECT_EQ(nl->get_modules().size(), copy->get_modules().size());
+            EXPECT_EQ(nl->get_groupings().size(), copy->get_groupings().size());
+
+            mod = nl->get_module_by_id(MIN_MODULE_ID);
+            ASSERT_NE(mod, nullptr);
+            EXPECT_EQ(describe_pins(mod), pins);
+            EXPECT_EQ(mod->get_input_nets().size(), copy->get_module_by_id(MIN_MODULE_ID)->get_input_nets().size());
+            EXPECT_EQ(mod->get_output_nets().size(), copy->get_module_by_id(MIN_MODULE_ID)->get_output_nets().size());
+
+            Gate* restored = nl->get_gate_by_id(MIN_GATE_ID + 4);
+            ASSERT_NE(restored, nullptr);
+            ASSERT_NE(restored->get_grouping(), nullptr);
+            EXPECT_EQ(restored->get_grouping()->get_name(), "grouping");
+            EXPECT_EQ(nl->get_grouping_by_id(1)->get_color().h, copy->get_grouping_by_id(1)->get_color().h);
+            EXPECT_EQ(nl->get_grouping_by_id(1)->get_color().s, copy->get_grouping_by_id(1)->get_color().s);
+            EXPECT_TRUE(nl->is_global_input_net(nl->get_net_by_id(MIN_NET_ID + 13)));
+            EXPECT_FALSE(nl->is_gnd_gate(gate_5));
+
+            EXPECT_EQ(nl->get_unique_gate_id(), next_gate_id);
+            EXPECT_EQ(nl->get_unique_net_id(), next_net_id);
+            EXPECT_EQ(nl->get_unique_module_id(), next_module_id);
+            EXPECT_EQ(nl->get_unique_grouping_id(), next_grouping_id);
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing that discarding a transaction restores pins and pin groups in place.
+     *
+     * Functions: discard, commit
+     */
+    TEST_F(NetlistTransactionTest, check_discard_pins)
+    {
+        TEST_START
+        {
+            auto nl = create_netlist();
+
+            Module* mod                         = nl->get_module_by_id(MIN_MODULE_ID);
+            const std::vector<std::string> pins = describe_pins(mod);
+            ModulePin* pin                      = mod->get_pins().front();
+            ModulePin* other                    = mod->get_pins().back();
+            PinGroup<ModulePin>* pin_group      = pin->get_group().first;
+            const std::string pin_name          = pin->get_name();
+            ASSERT_NE(pin, other);
+
+            {
+                // pins and pin groups that have been modified but not deleted are restored in place, hence pointers to them remain valid
+                NetlistTransaction transaction(nl.get());
+                ASSERT_TRUE(mod->set_pin_name(pin, "renamed_pin"));
+                ASSERT_TRUE(mod->set_pin_group_name(pin_group, "renamed_group"));
+                ASSERT_TRUE(mod->create_pin_group("bus", {pin, other}, PinDirection::inout, PinType::none, true, 0, false).is_ok());
+                EXPECT_TRUE(transaction.discard().is_ok());
+            }
+            EXPECT_EQ(describe_pins(mod), pins);
+            EXPECT_EQ(mod->get_pin_by_id(pin->get_id()), pin);
+            EXPECT_EQ(mod->get_pin_group_by_id(pin_group->get_id()), pin_group);
+            EXPECT_EQ(pin->get_name(), pin_name);
+            EXPECT_EQ(pin->get_group().first, pin_group);
+
+            {
+                // the pins are only recorded by the inner transaction, committing it hands their original state over to the outer one
+                NetlistTransaction outer(nl.get());
+                mod->set_type("changed");
+                {
+                    NetlistTransaction inner(nl.get());
+                    ASSERT_TRUE(mod->set_pin_name(pin, "renamed_pin"));
+                    EXPECT_TRUE(inner.commit().is_ok());
+                }
+                EXPECT_TRUE(outer.discard().is_ok());
+            }
+            EXPECT_EQ(describe_pins(mod), pins);
+            EXPECT_EQ(mod->get_pin_by_id(pin->get_id()), pin);
+            EXPECT_EQ(pin->get_name(), pin_name);
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing that committing a transaction keeps all modifications and that a transaction is discarded when it goes out of scope.
+     *
+     * Functions: commit, ~NetlistTransaction, get_num_recorded_objects
+     */
+    TEST_F(NetlistTransactionTest, check_commit)
+    {
+        TEST_START
+        {
+            auto nl   = create_netlist();
+            auto copy = nl->copy().get();
+
+            {
+                NetlistTransaction transaction(nl.get());
+                EXPECT_EQ(transaction.get_netlist(), nl.get());
+                EXPECT_EQ(transaction.get_num_recorded_objects(), 0);
+
+                nl->get_gate_by_id(MIN_GATE_ID + 0)->set_name("renamed");
+                nl->get_gate_by_id(MIN_GATE_ID + 0)->set_name("renamed_again");
+                EXPECT_EQ(transaction.get_num_recorded_objects(), 1);
+                nl->create_net("new_net");
+                EXPECT_EQ(transaction.get_num_recorded_objects(), 2);
+
+                EXPECT_TRUE(transaction.commit().is_ok());
+                EXPECT_FALSE(transaction.is_active());
+                EXPECT_TRUE(transaction.commit().is_error());
+            }
+            EXPECT_EQ(nl->get_gate_by_id(MIN_GATE_ID + 0)->get_name(), "renamed_again");
+            EXPECT_EQ(nl->get_nets([](const Net* n) { return n->get_name() == "new_net"; }).size(), 1);
+
+            // an active transaction is discarded on destruction, compare against a copy of the fresh netlist since pin orders may differ between separately created netlists
+            nl   = create_netlist();
+            copy = nl->copy().get();
+            {
+                NetlistTransaction transaction(nl.get());
+                nl->delete_gate(nl->get_gate_by_id(MIN_GATE_ID + 0));
+                nl->get_top_module()->set_name("renamed");
+            }
+            EXPECT_EQ(*nl, *copy);
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing nested transactions.
+     *
+     * Functions: NetlistTransaction, commit, discard
+     */
+    TEST_F(NetlistTransactionTest, check_nested)
+    {
+        TEST_START
+        {
+            auto nl   = create_netlist();
+            auto copy = nl->copy().get();
+
+            {
+                // committing the inner transaction hands its modifications over to the outer one
+                NetlistTransaction outer(nl.get());
+                nl->get_gate_by_id(MIN_GATE_ID + 0)->set_name("outer");
+                {
+                    NetlistTransaction inner(nl.get());
+                    nl->get_gate_by_id(MIN_GATE_ID + 0)->set_name("inner");
+                    nl->delete_net(nl->get_net_by_id(MIN_NET_ID + 78));
+
+                    // only the innermost transaction can be finished
+                    EXPECT_TRUE(outer.commit().is_error());
+                    EXPECT_TRUE(outer.discard().is_error());
+                    EXPECT_TRUE(outer.is_active());
+
+                    EXPECT_TRUE(inner.commit().is_ok());
+                }
+                EXPECT_EQ(nl->get_gate_by_id(MIN_GATE_ID + 0)->get_name(), "inner");
+                EXPECT_EQ(nl->get_net_by_id(MIN_NET_ID + 78), nullptr);
+                EXPECT_TRUE(outer.discard().is_ok());
+            }
+            EXPECT_EQ(*nl, *copy);
+
+            {
+                // discarding the inner transaction keeps the modifications of the outer one
+                NetlistTransaction outer(nl.get());
+                nl->get_gate_by_id(MIN_GATE_ID + 0)->set_name("outer");
+                {
+                    NetlistTransaction inner(nl.get());
+                    nl->get_gate_by_id(MIN_GATE_ID + 0)->set_name("inner");
+                    nl->create_gate(nl->get_gate_library()->get_gate_type_by_name("BUF"), "new_gate");
+                    EXPECT_TRUE(inner.discard().is_ok());
+                }
+                EXPECT_EQ(nl->get_gate_by_id(MIN_GATE_ID + 0)->get_name(), "outer");
+                EXPECT_EQ(nl->get_gates().size(), copy->get_gates().size());
+                EXPECT_TRUE(outer.discard().is_ok());
+            }
+            EXPECT_EQ(*nl, *copy);
+        }
+        TEST_END
+    }
+}    // namespace hal
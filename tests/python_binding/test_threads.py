@@ -0,0 +1,104 @@
+import sys
+import os
+
+# Automatically searches for the hal_py.so file and adds its path to the environment variables
+
+dirname = os.path.dirname(__file__)
+hal_path = os.path.join(dirname, '../../')
+hal_py_path = None
+hal_base_path = None
+
+for p in os.listdir(hal_path):
+    build_path = os.path.join(hal_path, p)
+    if not os.path.isfile(build_path):
+        if os.path.exists(os.path.join(hal_path, p + '/lib/hal_py.so')):
+            hal_base_path = build_path
+            hal_py_path = os.path.join(hal_path, p + '/lib/')
+            break
+
+if not hal_py_path is None:
+    sys.path.append(hal_py_path)
+    os.environ["HAL_BASE_PATH"] = str(build_path)
+else:
+    print("Can't find hal_py.so instance. Did you build it? If it can't be found anyway, make sure its directory is added to your PYTHONPATH and your HAL_BASE_PATH to your environment variables.")
+
+
+import unittest
+import hal_py
+import logging
+import threading
+
+'''
+NOTE: Every function is only tested once with all possible amounts of inputs,
+      but NOT extensively (its already done in the c++ tests)
+'''
+
+
+class TestThreads(unittest.TestCase):
+    NUM_THREADS = 4
+
+    @classmethod
+    def setUpClass(cls):
+        logging.basicConfig()
+
+    @classmethod
+    def tearDownClass(cls):
+        pass
+
+    def setUp(self):
+        self.log = logging.getLogger("LOG")
+
+    def tearDown(self):
+        pass
+
+    def run_threads(self, worker):
+        results = [None] * self.NUM_THREADS
+
+        def run(index):
+            results[index] = worker()
+
+        threads = [threading.Thread(target=run, args=(i,)) for i in range(self.NUM_THREADS)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        return results
+
+    # ====== TEST CASES =======
+
+    # Testing the python binding for function: BooleanFunction.simplify(), which releases the GIL, from several Python threads
+    def test_simplify_threads(self):
+        expressions = ["(A & B) | (A & !B)", "!(!A | !B) ^ C", "(A | B) & (A | !B) & (C | C)"]
+        expected = [hal_py.BooleanFunction.from_string(e).simplify() for e in expressions]
+
+        def worker():
+            results = []
+            for _ in range(20):
+                results = [hal_py.BooleanFunction.from_string(e).simplify() for e in expressions]
+            return results
+
+        for results in self.run_threads(worker):
+            self.assertEqual(results, expected)
+
+    # Testing the python binding for function: NetlistUtils.copy_netlist(), which releases the GIL, from several Python threads
+    def test_copy_netlist_threads(self):
+        gl = hal_py.GateLibrary("", "threads")
+        nl = hal_py.NetlistFactory.create_netlist(gl)
+        for i in range(100):
+            nl.create_net("net_" + str(i))
+        for i in range(10):
+            nl.create_module("module_" + str(i), nl.get_top_module(), [])
+
+        def summary(netlist):
+            nets = sorted((n.get_id(), n.get_name()) for n in netlist.get_nets())
+            modules = sorted((m.get_id(), m.get_name()) for m in netlist.get_modules())
+            return nets, modules
+
+        expected = summary(nl)
+        copies = self.run_threads(lambda: [hal_py.NetlistUtils.copy_netlist(nl) for _ in range(5)])
+        for thread_copies in copies:
+            for copy in thread_copies:
+                self.assertEqual(summary(copy), expected)
+
+if __name__ == '__main__':
+    unittest.main()
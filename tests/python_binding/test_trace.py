@@ -0,0 +1,148 @@
+import sys
+import os
+
+# Automatically searches for the hal_py.so file and adds its path to the environment variables
+
+dirname = os.path.dirname(__file__)
+hal_path = os.path.join(dirname, '../../')
+hal_py_path = None
+hal_base_path = None
+
+for p in os.listdir(hal_path):
+    build_path = os.path.join(hal_path, p)
+    if not os.path.isfile(build_path):
+        if os.path.exists(os.path.join(hal_path, p + '/lib/hal_py.so')):
+            hal_base_path = build_path
+            hal_py_path = os.path.join(hal_path, p + '/lib/')
+            break
+
+if not hal_py_path is None:
+    sys.path.append(hal_py_path)
+    os.environ["HAL_BASE_PATH"] = str(build_path)
+else:
+    print("Can't find hal_py.so instance. Did you build it? If it can't be found anyway, make sure its directory is added to your PYTHONPATH and your HAL_BASE_PATH to your environment variables.")
+
+
+import unittest
+import hal_py
+import json
+import logging
+import tempfile
+import threading
+
+'''
+NOTE: Every function is only tested once with all possible amounts of inputs,
+      but NOT extensively (its already done in the c++ tests)
+'''
+
+
+class TestTrace(unittest.TestCase):
+    @classmethod
+    def setUpClass(cls):
+        logging.basicConfig()
+
+    @classmethod
+    def tearDownClass(cls):
+        pass
+
+    def setUp(self):
+        self.log = logging.getLogger("LOG")
+        self.trace = hal_py.Trace
+        self.trace.clear()
+        self.trace.set_enabled(True)
+
+    def tearDown(self):
+        self.trace.set_enabled(False)
+        self.trace.clear()
+
+    def get_span(self, name):
+        summaries = [s for s in self.trace.get_summary() if s.name == name]
+        self.assertEqual(len(summaries), 1)
+        return summaries[0]
+
+    # ====== TEST CASES =======
+
+    # Testing the python binding for functions: is_enabled(), set_enabled()
+    def test_enabled(self):
+        self.assertTrue(self.trace.is_enabled())
+        self.trace.set_enabled(False)
+        self.assertFalse(self.trace.is_enabled())
+
+        # spans are not recorded while tracing is disabled
+        with self.trace.Span("disabled"):
+            pass
+        self.assertEqual(self.trace.get_summary(), [])
+
+    # Testing the python binding for class: Span and functions: count(), get_summary(), clear()
+    def test_span_summary(self):
+        for _ in range(3):
+            with self.trace.Span("outer"):
+                self.trace.count("items")
+                with self.trace.Span("inner"):
+                    self.trace.count("items", 5)
+
+        outer = self.get_span("outer")
+        inner = self.get_span("inner")
+        self.assertEqual(outer.calls, 3)
+        self.assertEqual(inner.calls, 3)
+        self.assertEqual(outer.counters, {"items": 3})
+        self.assertEqual(inner.counters, {"items": 15})
+        self.assertGreaterEqual(outer.total_ns, inner.total_ns)
+        self.assertLessEqual(outer.self_ns, outer.total_ns)
+        self.assertLessEqual(outer.max_ns, outer.total_ns)
+
+        # counters outside of a span are dropped
+        self.trace.count("dropped")
+        self.assertTrue(all("dropped" not in s.counters for s in self.trace.get_summary()))
+
+        self.assertIn("outer", self.trace.get_summary_table())
+
+        self.trace.clear()
+        self.assertEqual(self.trace.get_summary(), [])
+
+    # Testing the python binding for function: clear() while a span is open
+    def test_clear_open_span(self):
+        # the span open while clearing is discarded, even if it is closed within a span opened after clearing
+        discarded = self.trace.Span("discarded")
+        discarded.__enter__()
+        self.trace.clear()
+        with self.trace.Span("recorded"):
+            discarded.__exit__(None, None, None)
+            self.trace.count("steps")
+
+        self.assertEqual([s.name for s in self.trace.get_summary()], ["recorded"])
+        self.assertEqual(self.get_span("recorded").counters, {"steps": 1})
+
+    # Testing the python binding for class: Span used from several Python threads
+    def test_span_threads(self):
+        def worker():
+            for _ in range(10):
+                with self.trace.Span("worker"):
+                    self.trace.count("steps")
+
+        threads = [threading.Thread(target=worker) for _ in range(4)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+
+        span = self.get_span("worker")
+        self.assertEqual(span.calls, 40)
+        self.assertEqual(span.counters, {"steps": 40})
+
+    # Testing the python binding for functions: get_chrome_trace(), write_chrome_trace()
+    def test_chrome_trace(self):
+        with self.trace.Span("exported"):
+            pass
+
+        events = json.loads(self.trace.get_chrome_trace())["traceEvents"]
+        self.assertTrue(any(e.get("name") == "exported" for e in events))
+
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            file_path = os.path.join(tmp_dir, "trace.json")
+            self.assertTrue(self.trace.write_chrome_trace(file_path))
+            with open(file_path) as f:
+                self.assertEqual(json.load(f), json.loads(self.trace.get_chrome_trace()))
+
+if __name__ == '__main__':
+    unittest.main()